@@ -1,3 +1,4 @@
+CLA_SCRATCHPAD_SIZE = 0x100;
 
 MEMORY
 {
@@ -9,10 +10,8 @@ MEMORY
 //   RAMM1_RSVD       : origin = 0x0007F8, length = 0x000008     /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
    RAMD0            : origin = 0x00C000, length = 0x000800
    RAMD1            : origin = 0x00C800, length = 0x000800
-   RAMLS0           : origin = 0x008000, length = 0x000800
-   RAMLS1           : origin = 0x008800, length = 0x000800
-   RAMLS2           : origin = 0x009000, length = 0x000800
-   RAMLS3           : origin = 0x009800, length = 0x000800
+   /* RAMLS0 to RAMLS3 as one block for the code copied from flash (.TI.ramfunc) */
+   RAMLS0_3         : origin = 0x008000, length = 0x002000
    RAMLS4           : origin = 0x00A000, length = 0x000800
    RAMLS5           : origin = 0x00A800, length = 0x000800
    RAMLS6           : origin = 0x00B000, length = 0x000800
@@ -48,8 +47,8 @@ MEMORY
    FLASH9           : origin = 0x0B0000, length = 0x008000  /* on-chip Flash */
    FLASH10          : origin = 0x0B8000, length = 0x002000  /* on-chip Flash */
    FLASH11          : origin = 0x0BA000, length = 0x002000  /* on-chip Flash */
-   FLASH12          : origin = 0x0BC000, length = 0x002000  /* on-chip Flash */
-   FLASH13          : origin = 0x0BE000, length = 0x001FF0  /* on-chip Flash */
+   FLASH12          : origin = 0x0BC000, length = 0x002000  /* on-chip Flash, parameter store (TB_Params.h) */
+   FLASH13          : origin = 0x0BE000, length = 0x001FF0  /* on-chip Flash, parameter store (TB_Params.h) */
 //   FLASH13_RSVD     : origin = 0x0BFFF0, length = 0x000010  /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
 
    CPU1TOCPU2RAM   : origin = 0x03A000, length = 0x000800
@@ -60,6 +59,10 @@ MEMORY
    CANA_MSG_RAM     : origin = 0x049000, length = 0x000800
    CANB_MSG_RAM     : origin = 0x04B000, length = 0x000800
 
+   /* Message RAMs of the CLA (see TB_CLA.h) */
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
+
    RESET            : origin = 0x3FFFC0, length = 0x000002
 }
 
@@ -70,12 +73,17 @@ SECTIONS
    .cinit              : > FLASH4, ALIGN(8)
    .switch             : > FLASH1, ALIGN(8)
    .reset              : > RESET, TYPE = DSECT /* not used, */
-   .stack              : > RAMM1
+   /* Stack, painted by DeviceInit() and checked by DeviceStackService() (see TB_Device.h) */
+   #if defined(__TI_EABI__)
+       .stack : > RAMM1, RUN_START(DeviceStackStart), RUN_SIZE(DeviceStackSize)
+   #else
+       .stack : > RAMM1, RUN_START(_DeviceStackStart), RUN_SIZE(_DeviceStackSize)
+   #endif
 
 #if defined(__TI_EABI__)
    .init_array      : > FLASH1, ALIGN(8)
    .bss             : > RAMLS5
-   .bss:output      : > RAMLS3
+   .bss:output      : > RAMLS4
    .bss:cio         : > RAMLS5
    .data            : > RAMLS5
    .sysmem          : > RAMLS5
@@ -90,8 +98,28 @@ SECTIONS
    .econst          : >> FLASH4 | FLASH5, ALIGN(8)
 #endif
 
+   /* Large buffers which are set by their init function, not zeroed by the C startup */
+   noinitbuf : >> RAMD0 | RAMD1, type=NOINIT
+
    ramgs0 : > RAMGS0, type=NOINIT
    ramgs1 : > RAMGS1, type=NOINIT
+
+   /* Shared RAM of CPU1 and CPU2 (see TB_Shared.h) */
+   SHARERAMGS2 : > RAMGS2, type=NOINIT
+   SHARERAMGS3 : > RAMGS3, type=NOINIT
+
+   /* Offload queues of CPU1 and CPU2 (see TB_Offload.h) */
+   SHARERAMGS4 : > RAMGS4, type=NOINIT
+   SHARERAMGS5 : > RAMGS5, type=NOINIT
+
+   /* Sample table of the DAC waveform generator, read by the DMA (see TB_DAC.h) */
+   ramgs6 : > RAMGS6, type=NOINIT
+
+   /* Brightness curve of the PWM_LED fade engine, read by the DMA (see TB_LedFade.h) */
+   ramgs9 : > RAMGS9, type=NOINIT
+
+   /* ADC calibration table, kept over a reset (see TB_ADCCal.h) */
+   adccal : > RAMGS7, type=NOINIT
    
    MSGRAM_CPU1_TO_CPU2 : > CPU1TOCPU2RAM, type=NOINIT
    MSGRAM_CPU2_TO_CPU1 : > CPU2TOCPU1RAM, type=NOINIT
@@ -106,9 +134,41 @@ SECTIONS
    Filter4_RegsFile : > RAMGS4, fill=0x4444
    Difference_RegsFile : >RAMGS5, fill=0x3333
 
+   /* CLA program (RAMLS6, copied by ClaAdcInit() with DeviceCopyWords()) and data (RAMLS7), see TB_CLA.h */
+   #if defined(__TI_EABI__)
+       Cla1Prog    :    LOAD = FLASH6,
+                        RUN = RAMLS6,
+                        LOAD_START(Cla1funcsLoadStart),
+                        LOAD_END(Cla1funcsLoadEnd),
+                        RUN_START(Cla1funcsRunStart),
+                        LOAD_SIZE(Cla1funcsLoadSize),
+                        ALIGN(8)
+   #else
+       Cla1Prog    :    LOAD = FLASH6,
+                        RUN = RAMLS6,
+                        LOAD_START(_Cla1funcsLoadStart),
+                        LOAD_END(_Cla1funcsLoadEnd),
+                        RUN_START(_Cla1funcsRunStart),
+                        LOAD_SIZE(_Cla1funcsLoadSize),
+                        ALIGN(8)
+   #endif
+   Cla1DataRam      : > RAMLS7
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
+   /* CLA C compiler sections, must be allocated to memory the CLA has write access to */
+   CLAscratch       :
+                     { *.obj(CLAscratch)
+                     . += CLA_SCRATCHPAD_SIZE;
+                     *.obj(CLAscratch_end) } > RAMLS7
+   .scratchpad      : > RAMLS7
+   .bss_cla         : > RAMLS7
+
+   /* ISRs and functions called by ISRs (CODE_SECTION ".TI.ramfunc"), copied by DeviceInit() with DeviceCopyWords() */
    #if defined(__TI_EABI__)
-       .TI.ramfunc : {} LOAD = FLASH3,
-                        RUN = RAMLS0 | RAMLS1 | RAMLS2 |RAMLS3,
+       /* The Flash API runs from RAM while bank 0 is erased or programmed (TB_Params.c) */
+       .TI.ramfunc : { *(.TI.ramfunc) -l FAPI_F2838x_EABI_v1.58.10.lib }
+                        LOAD = FLASH3,
+                        RUN = RAMLS0_3,
                         LOAD_START(RamfuncsLoadStart),
                         LOAD_SIZE(RamfuncsLoadSize),
                         LOAD_END(RamfuncsLoadEnd),
@@ -117,8 +177,9 @@ SECTIONS
                         RUN_END(RamfuncsRunEnd),
                         ALIGN(8)
    #else
-       .TI.ramfunc : {} LOAD = FLASH3,
-                        RUN = RAMLS0 | RAMLS1 | RAMLS2 |RAMLS3,
+       .TI.ramfunc : { *(.TI.ramfunc) -l FAPI_F2838x_EABI_v1.58.10.lib }
+                        LOAD = FLASH3,
+                        RUN = RAMLS0_3,
                         LOAD_START(_RamfuncsLoadStart),
                         LOAD_SIZE(_RamfuncsLoadSize),
                         LOAD_END(_RamfuncsLoadEnd),
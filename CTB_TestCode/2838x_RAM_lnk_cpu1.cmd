@@ -1,3 +1,5 @@
+CLA_SCRATCHPAD_SIZE = 0x100;
+
 MEMORY
 {
    /* BEGIN is used for the "boot to SARAM" bootloader mode   */
@@ -47,8 +49,8 @@ MEMORY
    FLASH9           : origin = 0x0B0000, length = 0x008000  /* on-chip Flash */
    FLASH10          : origin = 0x0B8000, length = 0x002000  /* on-chip Flash */
    FLASH11          : origin = 0x0BA000, length = 0x002000  /* on-chip Flash */
-   FLASH12          : origin = 0x0BC000, length = 0x002000  /* on-chip Flash */
-   FLASH13          : origin = 0x0BE000, length = 0x002000  /* on-chip Flash */
+   FLASH12          : origin = 0x0BC000, length = 0x002000  /* on-chip Flash, parameter store (TB_Params.h) */
+   FLASH13          : origin = 0x0BE000, length = 0x002000  /* on-chip Flash, parameter store (TB_Params.h) */
    CPU1TOCPU2RAM    : origin = 0x03A000, length = 0x000800
    CPU2TOCPU1RAM    : origin = 0x03B000, length = 0x000800
 
@@ -57,6 +59,10 @@ MEMORY
 
    CANA_MSG_RAM     : origin = 0x049000, length = 0x000800
    CANB_MSG_RAM     : origin = 0x04B000, length = 0x000800
+
+   /* Message RAMs of the CLA (see TB_CLA.h) */
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
    RESET            : origin = 0x3FFFC0, length = 0x000002
 }
 
@@ -69,12 +75,17 @@ SECTIONS
    .switch          : > RAMM0
    .reset           : > RESET, TYPE = DSECT /* not used, */
 
-   .stack           : > RAMM1
+   /* Stack, painted by DeviceInit() and checked by DeviceStackService() (see TB_Device.h) */
+   #if defined(__TI_EABI__)
+       .stack : > RAMM1, RUN_START(DeviceStackStart), RUN_SIZE(DeviceStackSize)
+   #else
+       .stack : > RAMM1, RUN_START(_DeviceStackStart), RUN_SIZE(_DeviceStackSize)
+   #endif
 #if defined(__TI_EABI__)
    .bss             : > RAMLS5
    .bss:output      : > RAMLS3
    .init_array      : > RAMM0
-   .const           : > RAMLS5 | RAMLS6
+   .const           : >> RAMLS5 | RAMGS8
    .data            : > RAMLS5
    .sysmem          : > RAMLS4
 #else
@@ -84,9 +95,29 @@ SECTIONS
    .esysmem         : > RAMLS5
 #endif
 
+   /* Large buffers which are set by their init function, not zeroed by the C startup */
+   noinitbuf : > RAMGS8, type=NOINIT
+
    ramgs0 : > RAMGS0, type=NOINIT
    ramgs1 : > RAMGS1, type=NOINIT
 
+   /* Shared RAM of CPU1 and CPU2 (see TB_Shared.h) */
+   SHARERAMGS2 : > RAMGS2, type=NOINIT
+   SHARERAMGS3 : > RAMGS3, type=NOINIT
+
+   /* Offload queues of CPU1 and CPU2 (see TB_Offload.h) */
+   SHARERAMGS4 : > RAMGS4, type=NOINIT
+   SHARERAMGS5 : > RAMGS5, type=NOINIT
+
+   /* Sample table of the DAC waveform generator, read by the DMA (see TB_DAC.h) */
+   ramgs6 : > RAMGS6, type=NOINIT
+
+   /* Brightness curve of the PWM_LED fade engine, read by the DMA (see TB_LedFade.h) */
+   ramgs9 : > RAMGS9, type=NOINIT
+
+   /* ADC calibration table, kept over a reset (see TB_ADCCal.h) */
+   adccal : > RAMGS7, type=NOINIT
+
    MSGRAM_CPU1_TO_CPU2 > CPU1TOCPU2RAM, type=NOINIT
    MSGRAM_CPU2_TO_CPU1 > CPU2TOCPU1RAM, type=NOINIT
    MSGRAM_CPU_TO_CM   > CPUTOCMRAM, type=NOINIT
@@ -100,7 +131,21 @@ SECTIONS
    Filter4_RegsFile : > RAMGS4, fill=0x4444
    Difference_RegsFile : >RAMGS5, fill=0x3333
 
-    .TI.ramfunc : {} > RAMM0
+   /* CLA program (RAMLS6) and data (RAMLS7), see TB_CLA.h */
+   Cla1Prog         : > RAMLS6
+   Cla1DataRam      : > RAMLS7
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
+   /* CLA C compiler sections, must be allocated to memory the CLA has write access to */
+   CLAscratch       :
+                     { *.obj(CLAscratch)
+                     . += CLA_SCRATCHPAD_SIZE;
+                     *.obj(CLAscratch_end) } > RAMLS7
+   .scratchpad      : > RAMLS7
+   .bss_cla         : > RAMLS7
+
+   /* ISRs and functions called by ISRs (CODE_SECTION ".TI.ramfunc") */
+   .TI.ramfunc      : >> RAMD0 | RAMD1 | RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3
 
 }
 
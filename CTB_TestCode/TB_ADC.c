@@ -6,6 +6,11 @@
 ///             configured so that the external 3.0 V reference is used and the ADCs run at
 ///             50 MHz clock (SYSCLK = 200 MHz). The measurement is triggered by the ePWM1 module
 ///             triggered. The measurement inputs are each ADCINx3 (x= A, B, C or D).
+///             The limit check of the ADCIN check runs in the post-processing blocks (PPB), the
+///             CPU is only interrupted if a result leaves the limits (AdcPpbEventISR())
+///             Slow housekeeping channels (e.g. the temperature sensor) form a second sampling
+///             group which is triggered by CPU timer 0, the SOCs of the PWM synchronous group
+///             have high priority (ADCSOCPRICTL), the slow group runs in round robin behind them
 ///
 /// @version    V1.1.0
 ///
@@ -17,10 +22,314 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_ADC.h"
+#include "TB_LED.h"
+#include "TB_Trace.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// The PPB functions are called by the sequencer ISR and run from LSx RAM without flash wait
+// states (see TB_Sequencer.c)
+#pragma CODE_SECTION(AdcPpbWriteLimits, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcPpbSelect, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcPpbSetCode, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcPpbCheck, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcPpbEventISR, ".TI.ramfunc");
+// The mode switch only writes registers from the trim cache and may be called by an ISR
+#pragma CODE_SECTION(AdcSetMode, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcReadSlowChannel, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Channel table of the board test (all SOCs triggered by ePWM1 SOCA). ADC_ACQPS_BOARD_TEST is the
+// default window, ADC_TuneAcqps() replaces it with the measured window of every channel
+AdcChannelConfig adcChannelTable[ADC_NUMBER_OF_CHANNELS] =
+{
+    // module       SOC                 CHSEL                       ACQPS                   trigger
+    {ADC_MODULE_A, ADC_SOC_NUMBER_2,  ADC_SINGLE_ENDED_ADCIN2,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_A, ADC_SOC_NUMBER_3,  ADC_SINGLE_ENDED_ADCIN3,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_A, ADC_SOC_NUMBER_4,  ADC_SINGLE_ENDED_ADCIN4,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_A, ADC_SOC_NUMBER_5,  ADC_SINGLE_ENDED_ADCIN5,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_A, ADC_SOC_NUMBER_14, ADC_SINGLE_ENDED_ADCIN14, ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_A, ADC_SOC_NUMBER_15, ADC_SINGLE_ENDED_ADCIN15, ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_B, ADC_SOC_NUMBER_0,  ADC_SINGLE_ENDED_ADCIN0,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_B, ADC_SOC_NUMBER_2,  ADC_SINGLE_ENDED_ADCIN2,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_B, ADC_SOC_NUMBER_3,  ADC_SINGLE_ENDED_ADCIN3,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_B, ADC_SOC_NUMBER_4,  ADC_SINGLE_ENDED_ADCIN4,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_B, ADC_SOC_NUMBER_5,  ADC_SINGLE_ENDED_ADCIN5,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_C, ADC_SOC_NUMBER_2,  ADC_SINGLE_ENDED_ADCIN2,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_C, ADC_SOC_NUMBER_3,  ADC_SINGLE_ENDED_ADCIN3,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_C, ADC_SOC_NUMBER_4,  ADC_SINGLE_ENDED_ADCIN4,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_C, ADC_SOC_NUMBER_5,  ADC_SINGLE_ENDED_ADCIN5,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_0,  ADC_SINGLE_ENDED_ADCIN0,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_1,  ADC_SINGLE_ENDED_ADCIN1,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_2,  ADC_SINGLE_ENDED_ADCIN2,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_3,  ADC_SINGLE_ENDED_ADCIN3,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_4,  ADC_SINGLE_ENDED_ADCIN4,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+    {ADC_MODULE_D, ADC_SOC_NUMBER_5,  ADC_SINGLE_ENDED_ADCIN5,  ADC_ACQPS_BOARD_TEST, ADC_TRIGGER_EPWM1_SOCA},
+};
+
+// Channel table of the slow group (triggered by CPU timer 0 every ADC_SLOW_TRIGGER_PERIOD_US).
+// Another group can use a second timer or ePWM1 SOCB (ADC_TRIGGER_EPWM1_SOCB with its own
+// prescaler) in the same way, it only needs free SOCs above ADC_HIGH_PRIORITY_SOCS
+const AdcChannelConfig adcSlowChannelTable[ADC_NUMBER_OF_SLOW_CHANNELS] =
+{
+    // module       SOC                 CHSEL                       ACQPS                   trigger
+    {ADC_MODULE_A, ADC_SOC_NUMBER_8,  ADC_TEMP_SENSOR_CHANNEL,  ADC_ACQPS_TEMP_SENSOR, ADC_TRIGGER_CPU1_TIMER0},
+};
+
+// PPB table of the ADCIN check, order of the channels of Mux_Select() and ADC_ErrorCheck().
+// The offsets are the board specific offset corrections in LSB
+const AdcPpbConfig adcPpbTable[ADC_NUMBER_OF_CHANNELS] =
+{
+    // module       SOC                offset  Error_LED
+    {ADC_MODULE_A, ADC_SOC_NUMBER_2,  0,       1},     // 0  A2
+    {ADC_MODULE_A, ADC_SOC_NUMBER_3,  0,       2},     // 1  A3
+    {ADC_MODULE_A, ADC_SOC_NUMBER_4,  0,       3},     // 2  A4
+    {ADC_MODULE_A, ADC_SOC_NUMBER_5,  0,       4},     // 3  A5
+    {ADC_MODULE_B, ADC_SOC_NUMBER_0,  0,       5},     // 4  B0
+    {ADC_MODULE_B, ADC_SOC_NUMBER_2,  0,       6},     // 5  B2
+    {ADC_MODULE_B, ADC_SOC_NUMBER_3,  0,       7},     // 6  B3
+    {ADC_MODULE_B, ADC_SOC_NUMBER_4,  0,       8},     // 7  B4
+    {ADC_MODULE_B, ADC_SOC_NUMBER_5,  0,       9},     // 8  B5
+    {ADC_MODULE_C, ADC_SOC_NUMBER_2,  0,       10},    // 9  C2
+    {ADC_MODULE_C, ADC_SOC_NUMBER_3,  0,       11},    // 10 C3
+    {ADC_MODULE_C, ADC_SOC_NUMBER_4,  0,       12},    // 11 C4
+    {ADC_MODULE_C, ADC_SOC_NUMBER_5,  0,       13},    // 12 C5
+    {ADC_MODULE_D, ADC_SOC_NUMBER_0,  0,       14},    // 13 D0
+    {ADC_MODULE_D, ADC_SOC_NUMBER_1,  0,       15},    // 14 D1
+    {ADC_MODULE_D, ADC_SOC_NUMBER_2,  0,       16},    // 15 D2
+    {ADC_MODULE_D, ADC_SOC_NUMBER_3,  0,       17},    // 16 D3
+    {ADC_MODULE_D, ADC_SOC_NUMBER_4,  0,       18},    // 17 D4
+    {ADC_MODULE_D, ADC_SOC_NUMBER_5,  0,       19},    // 18 D5
+    {ADC_MODULE_A, ADC_SOC_NUMBER_14, 0,       20},    // 19 IN14
+    {ADC_MODULE_A, ADC_SOC_NUMBER_15, 0,       21},    // 20 IN15
+};
+
+// Register sets of the ADC modules, indexed with ADC_MODULE_x
+volatile struct ADC_REGS *const adcRegs[ADC_NUMBER_OF_MODULES] =
+{
+    &AdcaRegs,
+    &AdcbRegs,
+    &AdccRegs,
+    &AdcdRegs
+};
+// Base addresses of the ADC result registers, indexed with ADC_MODULE_x
+volatile uint16_t *const adcResultBase[ADC_NUMBER_OF_MODULES] =
+{
+    &AdcaResultRegs.ADCRESULT0,
+    &AdcbResultRegs.ADCRESULT0,
+    &AdccResultRegs.ADCRESULT0,
+    &AdcdResultRegs.ADCRESULT0
+};
+
+// Time of the power up of the ADC modules (DeviceGetTime()), valid if "adcPoweredUp" is true
+uint32_t adcPowerUpTime = 0;
+bool adcPoweredUp = false;
+
+// Limits of the PPB relative to the DAC code (same tolerance as ADC_ErrorCheck())
+float32 adcPpbLowFactor = 0.96f;
+float32 adcPpbHighFactor = 1.04f;
+// Channel checked by PPB1 and last DAC code checked on it
+volatile uint16_t adcPpbChannel = ADC_NUMBER_OF_CHANNELS;
+static uint16_t adcPpbCheckedCode = ADC_PPB_NO_CODE;
+// Limit violations per channel since its selection
+volatile uint16_t adcPpbErrorCount[ADC_NUMBER_OF_CHANNELS];
+
+// Trims of all modules and modes, filled once by AdcTrimCacheInit(), afterwards a mode switch
+// does not read the OTP
+AdcTrimSet adcTrimCache[ADC_NUMBER_OF_MODULES][ADC_NUMBER_OF_MODES];
+volatile uint16_t adcModuleMode[ADC_NUMBER_OF_MODULES];
+// OTP addresses of the trims, indexed with ADC_MODULE_x
+static const uint32_t *const adcInlTrimOtp[ADC_NUMBER_OF_MODULES] =
+{
+    ADC_A_INLTRIM_OTP_ADDR_START, ADC_B_INLTRIM_OTP_ADDR_START,
+    ADC_C_INLTRIM_OTP_ADDR_START, ADC_D_INLTRIM_OTP_ADDR_START
+};
+static const uint16_t *const adcOffsetTrimOtp12Bit[ADC_NUMBER_OF_MODULES] =
+{
+    ADC_A_OFFSETTRIM_OTP_12BIT, ADC_B_OFFSETTRIM_OTP_12BIT,
+    ADC_C_OFFSETTRIM_OTP_12BIT, ADC_D_OFFSETTRIM_OTP_12BIT
+};
+static const uint16_t *const adcOffsetTrimOtp16Bit[ADC_NUMBER_OF_MODULES] =
+{
+    ADC_A_OFFSETTRIM_OTP_16BIT, ADC_B_OFFSETTRIM_OTP_16BIT,
+    ADC_C_OFFSETTRIM_OTP_16BIT, ADC_D_OFFSETTRIM_OTP_16BIT
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcPpbWriteLimits =================================================================
+///
+/// @brief  Function writes the limits of PPB1 of the module of the selected channel for the DAC
+///         codes lowCode..highCode, clears old events and enables the event interrupt again
+///
+/// @param  uint16_t lowCode, uint16_t highCode
+///
+/// @return void
+///
+//=================================================================================================
+static void AdcPpbWriteLimits(uint16_t lowCode, uint16_t highCode)
+{
+    volatile struct ADC_REGS *regs;
+    float32 high;
+
+    if (adcPpbChannel >= ADC_NUMBER_OF_CHANNELS)
+        return;
+
+    regs = adcRegs[adcPpbTable[adcPpbChannel].module];
+    high = adcPpbHighFactor * highCode;
+
+    EALLOW;
+    regs->ADCPPB1TRIPLO.bit.LIMITLO = (uint16_t)(adcPpbLowFactor * lowCode);
+    regs->ADCPPB1TRIPHI.bit.LIMITHI = (high > ADC_PPB_MAX_RESULT) ? ADC_PPB_MAX_RESULT : (uint16_t)high;
+    regs->ADCEVTCLR.bit.PPB1TRIPLO = 1;
+    regs->ADCEVTCLR.bit.PPB1TRIPHI = 1;
+    regs->ADCEVTINTSEL.bit.PPB1TRIPLO = 1;
+    regs->ADCEVTINTSEL.bit.PPB1TRIPHI = 1;
+    EDIS;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcTrimCacheInit ==================================================================
+///
+/// @brief  Function copies the trims of all modules and operating modes from the OTP into
+///         "adcTrimCache". The values are prepared like in AdcInitTrimRegister(): in 12 bit mode
+///         ADCINLTRIM1/2/4/5 are masked, the offset trim comes from the OTP word of the
+///         resolution (MSB for single-ended, LSB for differential)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcTrimCacheInit(void)
+{
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+    {
+        for (uint16_t mode = 0; mode < ADC_NUMBER_OF_MODES; mode++)
+        {
+            AdcTrimSet *trim = &adcTrimCache[module][mode];
+            bool resolution16Bit = (mode >> 1) == ADC_RESOLUTION_16_BIT;
+            uint16_t offsetTrim;
+
+            for (uint16_t i = 0; i < 6; i++)
+                trim->inlTrim[i] = adcInlTrimOtp[module][i];
+
+            if (resolution16Bit)
+            {
+                offsetTrim = *adcOffsetTrimOtp16Bit[module];
+            }
+            else
+            {
+                trim->inlTrim[0] &= 0xFFFF0000;
+                trim->inlTrim[1] &= 0xFFFF0000;
+                trim->inlTrim[3] &= 0xFFFF0000;
+                trim->inlTrim[4] &= 0xFFFF0000;
+                offsetTrim = *adcOffsetTrimOtp12Bit[module];
+            }
+
+            if ((mode & 1) == ADC_SINGLE_ENDED_MODE)
+                trim->offTrim = offsetTrim >> 8;
+            else
+                trim->offTrim = offsetTrim & 0xFF;
+        }
+    }
+}
+
+//=== Function: AdcSetMode ========================================================================
+///
+/// @brief  Function switches a module to another resolution and signal mode (ADC_MODE_...) and
+///         writes the cached trims of the mode. Takes a few SYSCLK cycles, no OTP access and no
+///         new power up. Returns false if the module is converting or the mode is invalid, the
+///         module keeps its mode then. The SOCs must match the mode: differential channels use
+///         the even channel of a pair in CHSEL, the 16 bit mode needs ACQPS >= ADC_ACQPS_16_BIT.
+///         AdcTrimCacheInit() must have been called before (done by AdcPowerUpAll())
+///
+/// @param  uint16_t module, uint16_t mode
+///
+/// @return bool switched
+///
+//=================================================================================================
+bool AdcSetMode(uint16_t module, uint16_t mode)
+{
+    volatile struct ADC_REGS *regs;
+    const AdcTrimSet *trim;
+
+    if (module >= ADC_NUMBER_OF_MODULES || mode >= ADC_NUMBER_OF_MODES)
+        return false;
+
+    regs = adcRegs[module];
+    if (regs->ADCCTL1.bit.ADCBSY)
+        return false;
+
+    trim = &adcTrimCache[module][mode];
+
+    EALLOW;
+    regs->ADCCTL2.bit.RESOLUTION = mode >> 1;
+    regs->ADCCTL2.bit.SIGNALMODE = mode & 1;
+    regs->ADCINLTRIM1 = trim->inlTrim[0];
+    regs->ADCINLTRIM2 = trim->inlTrim[1];
+    regs->ADCINLTRIM3 = trim->inlTrim[2];
+    regs->ADCINLTRIM4 = trim->inlTrim[3];
+    regs->ADCINLTRIM5 = trim->inlTrim[4];
+    regs->ADCINLTRIM6 = trim->inlTrim[5];
+    regs->ADCOFFTRIM.bit.OFFTRIM = trim->offTrim;
+    EDIS;
+
+    adcModuleMode[module] = mode;
+    return true;
+}
+
+//=== Function: AdcPowerUpAll =====================================================================
+///
+/// @brief  Function requests the clocks of all ADC modules (A,B,C,D), fills the trim cache,
+///         sets prescaler and the 12 bit single-ended mode (AdcSetMode()) and powers them up
+///         without waiting. The settling time runs
+///         from here, so other peripherals can be initialised in the meantime. AdcInitAll() only
+///         waits for the rest of the settling time
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcPowerUpAll(void)
+{
+    EALLOW;
+
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+        ClockRequest(CLOCK_ADC_A + module);
+
+    AdcTrimCacheInit();
+
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+    {
+        adcRegs[module]->ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
+        AdcSetMode(module, ADC_MODE_12BIT_SINGLE_ENDED);    // ends with EDIS
+        EALLOW;
+        adcRegs[module]->ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
+    }
+
+    adcPowerUpTime = DeviceGetTime();
+    adcPoweredUp = true;
+
+    EDIS;
+}
 
 //=== Function: AdcInitAll ==========================================================================
 ///
-/// @brief  Function initialises the all ADC (module A,B,C,D)
+/// @brief  Function initialises the all ADC (module A,B,C,D). All modules are powered up together
+///         and share one settling time, afterwards the SOCs are configured from "adcChannelTable"
+///         and the slow group is started (AdcInitSlowGroup()). The SOCA of ePWM1 is moved to
+///         the middle of the quiet part of its period (PwmInitSamplePoint()).
+///         If AdcPowerUpAll() has been called before, only the rest of the settling time is waited
 ///
 /// @param  void
 ///
@@ -28,134 +337,357 @@
 ///
 //=================================================================================================
 void AdcInitAll(void)
+{
+    if (!adcPoweredUp)
+        AdcPowerUpAll();
+
+    // One settling time for all modules
+    DeviceWaitSince(adcPowerUpTime, ADC_POWER_UP_DELAY_US);
+
+    EALLOW;
+
+    AdcInitChannels(adcChannelTable, ADC_NUMBER_OF_CHANNELS);
+
+    EDIS;
+
+    AdcSetPriority(ADC_HIGH_PRIORITY_SOCS);
+    AdcInitSlowGroup();
+    // Centre the conversions of the board test in the quiet part of the ePWM1 period
+    PwmInitSamplePoint(&EPwm1Regs, AdcGetSocaWindow());
+
+    AdcInitPpb();
+}
+
+//=== Function: AdcInitChannels ===================================================================
+///
+/// @brief  Function configures the SOCs given in a channel table (module, SOC, CHSEL, ACQPS,
+///         trigger). The SOC control registers ADCSOC0CTL..ADCSOC15CTL are consecutive, so the
+///         SOC number is used as index
+///
+/// @param  const AdcChannelConfig *table, uint16_t numberOfEntries
+///
+/// @return void
+///
+//=================================================================================================
+void AdcInitChannels(const AdcChannelConfig *table,
+                     uint16_t numberOfEntries)
+{
+    EALLOW;
+
+    for (uint16_t i = 0; i < numberOfEntries; i++)
+    {
+        volatile union ADCSOC0CTL_REG *socCtl = &adcRegs[table[i].module]->ADCSOC0CTL + table[i].soc;
+
+        socCtl->bit.TRIGSEL = table[i].trigger;
+        socCtl->bit.CHSEL = table[i].chsel;
+        socCtl->bit.ACQPS = table[i].acqps;
+    }
+
+    EDIS;
+}
+
+//=== Function: AdcFindChannel ====================================================================
+///
+/// @brief  Function returns the index of the entry of "adcChannelTable" which converts the given
+///         SOC of a module
+///
+/// @param  uint16_t module (ADC_MODULE_x), uint16_t soc
+///
+/// @return uint16_t index (ADC_NO_CHANNEL if the SOC is not in the table)
+///
+//=================================================================================================
+uint16_t AdcFindChannel(uint16_t module, uint16_t soc)
+{
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHANNELS; i++)
+    {
+        if (adcChannelTable[i].module == module && adcChannelTable[i].soc == soc)
+            return i;
+    }
+    return ADC_NO_CHANNEL;
+}
+
+//=== Function: AdcSetAcqps =======================================================================
+///
+/// @brief  Function stores the acquisition window of an entry of "adcChannelTable" (limited to
+///         ADC_ACQPS_MIN..ADC_ACQPS_MAX) and writes it into ACQPS of its SOC. The next
+///         conversion of the SOC uses the new window
+///
+/// @param  uint16_t index, uint16_t acqps
+///
+/// @return void
+///
+//=================================================================================================
+void AdcSetAcqps(uint16_t index, uint16_t acqps)
+{
+    AdcChannelConfig *channel = &adcChannelTable[index];
+
+    if (acqps < ADC_ACQPS_MIN)
+        acqps = ADC_ACQPS_MIN;
+    if (acqps > ADC_ACQPS_MAX)
+        acqps = ADC_ACQPS_MAX;
+    channel->acqps = acqps;
+
+    EALLOW;
+    (&adcRegs[channel->module]->ADCSOC0CTL + channel->soc)->bit.ACQPS = acqps;
+    EDIS;
+}
+
+//=== Function: AdcGetSocaWindow ==================================================================
+///
+/// @brief  Function returns the time from the ePWM1 SOCA to the end of the last conversion of
+///         the board test: the sum of the acquisition windows and conversions of every module,
+///         the longest sum of all modules (the modules convert in parallel)
+///
+/// @param  void
+///
+/// @return uint16_t windowSysclk
+///
+//=================================================================================================
+uint16_t AdcGetSocaWindow(void)
+{
+    uint16_t window[ADC_NUMBER_OF_MODULES] = {0, 0, 0, 0};
+    uint16_t longest = 0;
+
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHANNELS; i++)
+        window[adcChannelTable[i].module] += adcChannelTable[i].acqps + 1 + ADC_CONVERSION_SYSCLK;
+
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+    {
+        if (window[module] > longest)
+            longest = window[module];
+    }
+    return longest;
+}
+
+//=== Function: AdcSetPriority ====================================================================
+///
+/// @brief  Function sets the number of high priority SOCs of all modules. SOC 0 ... n - 1 are
+///         converted in the order of their number as soon as they are triggered, the remaining
+///         SOCs share the slots in round robin. 0 sets all SOCs to round robin
+///
+/// @param  uint16_t highPrioritySocs
+///
+/// @return void
+///
+//=================================================================================================
+void AdcSetPriority(uint16_t highPrioritySocs)
+{
+    EALLOW;
+
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+        adcRegs[module]->ADCSOCPRICTL.bit.SOCPRIORITY = highPrioritySocs;
+
+    EDIS;
+}
+
+//=== Function: AdcInitSlowGroup ==================================================================
+///
+/// @brief  Function configures the SOCs of "adcSlowChannelTable", enables the temperature sensor
+///         and starts CPU timer 0 with ADC_SLOW_TRIGGER_PERIOD_US. The timer only triggers the
+///         SOCs, its PIE interrupt (INT1.7) stays disabled, so the slow group costs no CPU time.
+///         The results stay in ADCRESULTx and are read with AdcReadSlowChannel()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcInitSlowGroup(void)
+{
+    AdcInitChannels(adcSlowChannelTable, ADC_NUMBER_OF_SLOW_CHANNELS);
+
+    EALLOW;
+
+    AnalogSubsysRegs.TSNSCTL.bit.ENABLE = 1;
+
+    // CPU timer 0 without prescaler, TINT0 is the trigger of the SOCs
+    CpuTimer0Regs.TCR.bit.TSS  = 1;
+    CpuTimer0Regs.PRD.all      = ADC_SLOW_TRIGGER_PERIOD_US * DEVICE_SYSCLK_MHZ - 1UL;
+    CpuTimer0Regs.TPR.all      = 0;
+    CpuTimer0Regs.TPRH.all     = 0;
+    CpuTimer0Regs.TCR.bit.TRB  = 1;
+    CpuTimer0Regs.TCR.bit.TIE  = 1;
+    CpuTimer0Regs.TCR.bit.TSS  = 0;
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 0;
+
+    EDIS;
+}
+
+//=== Function: AdcReadSlowChannel ================================================================
+///
+/// @brief  Function returns the last result of a channel of the slow group
+///
+/// @param  uint16_t index (ADC_SLOW_x)
+///
+/// @return uint16_t result
+///
+//=================================================================================================
+uint16_t AdcReadSlowChannel(uint16_t index)
+{
+    const AdcChannelConfig *channel = &adcSlowChannelTable[index];
+
+    return adcResultBase[channel->module][channel->soc];
+}
+
+//=== Function: AdcInitPpb ========================================================================
+///
+/// @brief  Function prepares PPB1 of all modules for the limit check of the ADCIN check. The
+///         event interrupts stay disabled until a channel is selected with AdcPpbSelect(). Each
+///         module has only four PPBs, so PPB1 is assigned to the channel under test instead of
+///         one PPB per channel. The ADCx_EVT interrupts (PIE group 10.1, 10.5, 10.9, 10.13)
+///         call AdcPpbEventISR()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcInitPpb(void)
+{
+    adcPpbChannel = ADC_NUMBER_OF_CHANNELS;
+    adcPpbCheckedCode = ADC_PPB_NO_CODE;
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHANNELS; i++)
+        adcPpbErrorCount[i] = 0;
+
+    EALLOW;
+
+    for (uint16_t module = 0; module < ADC_NUMBER_OF_MODULES; module++)
+    {
+        adcRegs[module]->ADCEVTINTSEL.all = 0;
+        adcRegs[module]->ADCPPB1OFFCAL.bit.OFFCAL = 0;
+        adcRegs[module]->ADCPPB1OFFREF = 0;
+        adcRegs[module]->ADCPPB1TRIPLO.bit.LIMITLO = 0;
+        adcRegs[module]->ADCPPB1TRIPHI.bit.LIMITHI = ADC_PPB_MAX_RESULT;
+        adcRegs[module]->ADCEVTCLR.all = 0xFFFF;
+    }
+
+    PieVectTable.ADCA_EVT_INT = &AdcPpbEventISR;
+    PieVectTable.ADCB_EVT_INT = &AdcPpbEventISR;
+    PieVectTable.ADCC_EVT_INT = &AdcPpbEventISR;
+    PieVectTable.ADCD_EVT_INT = &AdcPpbEventISR;
+    PieCtrlRegs.PIEIER10.bit.INTx1 = 1;
+    PieCtrlRegs.PIEIER10.bit.INTx5 = 1;
+    PieCtrlRegs.PIEIER10.bit.INTx9 = 1;
+    PieCtrlRegs.PIEIER10.bit.INTx13 = 1;
+    IER |= M_INT10;
+
+    EDIS;
+}
+
+//=== Function: AdcPpbSelect ======================================================================
+///
+/// @brief  Function assigns PPB1 of the module of "channel" to its SOC and sets its offset
+///         correction. The PPB of the previous channel is released, its SOC returns to the
+///         uncorrected result. The limits stay open until the first DAC code has been checked.
+///         Channels without an entry in "adcPpbTable" (e.g. 23) only release the PPB
+///
+/// @param  uint16_t channel
+///
+/// @return void
+///
+//=================================================================================================
+void AdcPpbSelect(uint16_t channel)
 {
     EALLOW;
 
-    CpuSysRegs.PCLKCR13.bit.ADC_A = 1;
-    __asm(" RPT #4 || NOP");
-
-    AdcaRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
-    AdcaRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
-    DELAY_US(500);
-    AdcaRegs.ADCCTL2.bit.RESOLUTION = 0;
-    AdcaRegs.ADCCTL2.bit.SIGNALMODE = 0;
-    AdcInitTrimRegister(ADC_MODULE_A, 0, 0);
-
-    AdcaRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
-    AdcaRegs.ADCSOC2CTL.bit.ACQPS = 29;
-
-    AdcaRegs.ADCSOC3CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC3CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN3;
-    AdcaRegs.ADCSOC3CTL.bit.ACQPS = 29;
-
-    AdcaRegs.ADCSOC4CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC4CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN4;
-    AdcaRegs.ADCSOC4CTL.bit.ACQPS = 29;
-
-    AdcaRegs.ADCSOC5CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC5CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN5;
-    AdcaRegs.ADCSOC5CTL.bit.ACQPS = 29;
-
-    AdcaRegs.ADCSOC14CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC14CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN14;
-    AdcaRegs.ADCSOC14CTL.bit.ACQPS = 29;
-
-    AdcaRegs.ADCSOC15CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcaRegs.ADCSOC15CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN15;
-    AdcaRegs.ADCSOC15CTL.bit.ACQPS = 29;
-
-    CpuSysRegs.PCLKCR13.bit.ADC_B = 1;
-    __asm(" RPT #4 || NOP");
-
-    AdcbRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
-    AdcbRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
-    DELAY_US(500);
-    AdcbRegs.ADCCTL2.bit.RESOLUTION = 0;
-    AdcbRegs.ADCCTL2.bit.SIGNALMODE = 0;
-    AdcInitTrimRegister(ADC_MODULE_B, 0, 0);
-
-    AdcbRegs.ADCSOC0CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcbRegs.ADCSOC0CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN0;
-    AdcbRegs.ADCSOC0CTL.bit.ACQPS = 29;
-
-    AdcbRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcbRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
-    AdcbRegs.ADCSOC2CTL.bit.ACQPS = 29;
-
-    AdcbRegs.ADCSOC3CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcbRegs.ADCSOC3CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN3;
-    AdcbRegs.ADCSOC3CTL.bit.ACQPS = 29;
-
-    AdcbRegs.ADCSOC4CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcbRegs.ADCSOC4CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN4;
-    AdcbRegs.ADCSOC4CTL.bit.ACQPS = 29;
-
-    AdcbRegs.ADCSOC5CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcbRegs.ADCSOC5CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN5;
-    AdcbRegs.ADCSOC5CTL.bit.ACQPS = 29;
-
-    CpuSysRegs.PCLKCR13.bit.ADC_C = 1;
-    __asm(" RPT #4 || NOP");
-
-    AdccRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
-    AdccRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
-    DELAY_US(500);
-    AdccRegs.ADCCTL2.bit.RESOLUTION = 0;
-    AdccRegs.ADCCTL2.bit.SIGNALMODE = 0;
-    AdcInitTrimRegister(ADC_MODULE_C, 0, 0);
-
-    AdccRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdccRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
-    AdccRegs.ADCSOC2CTL.bit.ACQPS = 29;
-
-    AdccRegs.ADCSOC3CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdccRegs.ADCSOC3CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN3;
-    AdccRegs.ADCSOC3CTL.bit.ACQPS = 29;
-
-    AdccRegs.ADCSOC4CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdccRegs.ADCSOC4CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN4;
-    AdccRegs.ADCSOC4CTL.bit.ACQPS = 29;
-
-    AdccRegs.ADCSOC5CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdccRegs.ADCSOC5CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN5;
-    AdccRegs.ADCSOC5CTL.bit.ACQPS = 29;
-
-    CpuSysRegs.PCLKCR13.bit.ADC_D = 1;
-    __asm(" RPT #4 || NOP");
-
-    AdcdRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
-    AdcdRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
-    DELAY_US(500);
-    AdcdRegs.ADCCTL2.bit.RESOLUTION = 0;
-    AdcdRegs.ADCCTL2.bit.SIGNALMODE = 0;
-    AdcInitTrimRegister(ADC_MODULE_D, 0, 0);
-
-    AdcdRegs.ADCSOC0CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC0CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN0;
-    AdcdRegs.ADCSOC0CTL.bit.ACQPS = 29;
-
-    AdcdRegs.ADCSOC1CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC1CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN1;
-    AdcdRegs.ADCSOC1CTL.bit.ACQPS = 29;
-
-    AdcdRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
-    AdcdRegs.ADCSOC2CTL.bit.ACQPS = 29;
-
-    AdcdRegs.ADCSOC3CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC3CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN3;
-    AdcdRegs.ADCSOC3CTL.bit.ACQPS = 29;
-
-    AdcdRegs.ADCSOC4CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC4CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN4;
-    AdcdRegs.ADCSOC4CTL.bit.ACQPS = 29;
-
-    AdcdRegs.ADCSOC5CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
-    AdcdRegs.ADCSOC5CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN5;
-    AdcdRegs.ADCSOC5CTL.bit.ACQPS = 29;
+    if (adcPpbChannel < ADC_NUMBER_OF_CHANNELS)
+    {
+        volatile struct ADC_REGS *regs = adcRegs[adcPpbTable[adcPpbChannel].module];
+
+        regs->ADCEVTINTSEL.bit.PPB1TRIPLO = 0;
+        regs->ADCEVTINTSEL.bit.PPB1TRIPHI = 0;
+        regs->ADCPPB1OFFCAL.bit.OFFCAL = 0;
+    }
+
+    adcPpbChannel = (channel < ADC_NUMBER_OF_CHANNELS) ? channel : ADC_NUMBER_OF_CHANNELS;
+    adcPpbCheckedCode = ADC_PPB_NO_CODE;
+
+    if (adcPpbChannel < ADC_NUMBER_OF_CHANNELS)
+    {
+        volatile struct ADC_REGS *regs = adcRegs[adcPpbTable[channel].module];
+
+        adcPpbErrorCount[channel] = 0;
+        regs->ADCPPB1CONFIG.bit.CONFIG = adcPpbTable[channel].soc;
+        // OFFCAL is a 10 bit two's complement value
+        regs->ADCPPB1OFFCAL.bit.OFFCAL = (uint16_t)adcPpbTable[channel].offset & 0x3FF;
+    }
 
     EDIS;
+
+    AdcPpbWriteLimits(0, ADC_PPB_MAX_RESULT);
+}
+
+//=== Function: AdcPpbSetCode =====================================================================
+///
+/// @brief  Function sets the limits for the transition to a new DAC code. While the mux and the
+///         ADC input settle, the result stays between the last checked code and the new code,
+///         so the limits span both codes and the check keeps running without false faults
+///
+/// @param  uint16_t code
+///
+/// @return void
+///
+//=================================================================================================
+void AdcPpbSetCode(uint16_t code)
+{
+    if (adcPpbCheckedCode == ADC_PPB_NO_CODE)
+        return;
+
+    if (code < adcPpbCheckedCode)
+        AdcPpbWriteLimits(code, adcPpbCheckedCode);
+    else
+        AdcPpbWriteLimits(adcPpbCheckedCode, code);
+}
+
+//=== Function: AdcPpbCheck =======================================================================
+///
+/// @brief  Function narrows the limits to the settled DAC code. Replaces the software comparison
+///         of ADC_ErrorCheck(), from here on every conversion is checked by PPB1
+///
+/// @param  uint16_t code
+///
+/// @return void
+///
+//=================================================================================================
+void AdcPpbCheck(uint16_t code)
+{
+    adcPpbCheckedCode = code;
+    AdcPpbWriteLimits(code, code);
+}
+
+//=== Function: AdcPpbEventISR ====================================================================
+///
+/// @brief  ISR is called when the result of the selected channel leaves the limits of PPB1. The
+///         violation is counted and the event interrupt is disabled until the next limits are
+///         written, so every DAC code counts at most once (as ADC_ErrorCheck()). After more than
+///         ADC_PPB_ERROR_THRESHOLD faults the Error_LED of the channel is switched on
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void AdcPpbEventISR(void)
+{
+    uint16_t channel = adcPpbChannel;
+
+    TRACE(TRACE_CONTEXT_ADC_EVENT, TRACE_EVENT_ADC_LIMIT, channel);
+    if (channel < ADC_NUMBER_OF_CHANNELS)
+    {
+        volatile struct ADC_REGS *regs = adcRegs[adcPpbTable[channel].module];
+
+        EALLOW;
+        regs->ADCEVTINTSEL.bit.PPB1TRIPLO = 0;
+        regs->ADCEVTINTSEL.bit.PPB1TRIPHI = 0;
+        regs->ADCEVTCLR.bit.PPB1TRIPLO = 1;
+        regs->ADCEVTCLR.bit.PPB1TRIPHI = 1;
+        EDIS;
+
+        if (++adcPpbErrorCount[channel] > ADC_PPB_ERROR_THRESHOLD)
+            LedOn(&ledErrorGroup, 1UL << (adcPpbTable[channel].errorLed - 1));
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP10;
 }
 
 
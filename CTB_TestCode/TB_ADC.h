@@ -6,6 +6,11 @@
 ///             configured so that the external 3.0 V reference is used and the ADCs run at
 ///             50 MHz clock (SYSCLK = 200 MHz). The measurement is triggered by the ePWM1 module
 ///             triggered. The measurement inputs are each ADCINx3 (x= A, B, C or D).
+///             The limit check of the ADCIN check runs in the post-processing blocks (PPB), the
+///             CPU is only interrupted if a result leaves the limits (AdcPpbEventISR())
+///             Slow housekeeping channels (e.g. the temperature sensor) form a second sampling
+///             group which is triggered by CPU timer 0, the SOCs of the PWM synchronous group
+///             have high priority (ADCSOCPRICTL), the slow group runs in round robin behind them
 ///
 /// @version    V1.1.0
 ///
@@ -19,6 +24,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_Device.h"
+#include "TB_Clock.h"
 #include "TB_PWM.h"
 
 
@@ -170,6 +176,91 @@
 // Interrupt-Impulserzeugung
 #define ADC_INT_PULSE_ONE_SHOT							0
 #define ADC_INT_PULSE_CONTINOUS							1
+// Number of ADC modules (A to D)
+#define ADC_NUMBER_OF_MODULES								4
+// Number of entries in the channel table of the board test
+#define ADC_NUMBER_OF_CHANNELS							21
+// Acquisition window of the board test (30 SYSCLK cycles)
+#define ADC_ACQPS_BOARD_TEST								29
+// Limits of the acquisition window tuned per channel by ADC_TuneAcqps(): minimum of the 12 bit
+// mode (75 ns = 15 SYSCLK cycles) and the longest window (reference of the tuning, 320 ns)
+#define ADC_ACQPS_MIN												14
+#define ADC_ACQPS_MAX												63
+// Sampling window of the ePWM1 SOCA group for PwmInitSamplePoint() (AdcGetSocaWindow()): every
+// SOC needs its acquisition window and about 10.5 ADCCLK (42 SYSCLK at ADCCLK = SYSCLK / 4) for
+// the 12 bit conversion, the module with the longest sum sets the window
+#define ADC_CONVERSION_SYSCLK								42
+// No entry in the channel table (AdcFindChannel())
+#define ADC_NO_CHANNEL											0xFFFF
+// Settling time after power up of the ADC modules in us
+#define ADC_POWER_UP_DELAY_US								500
+// Limit check of the ADCIN check
+// 1: PPB1 of the module of the selected channel checks every conversion in hardware, a
+//    violation raises the ADCx_EVT interrupt (AdcPpbEventISR())
+// 0: ADC_ErrorCheck() compares the results in software
+#define ADC_ERROR_CHECK_PPB									1
+// No DAC code has been checked since the channel has been selected, limits are open
+#define ADC_PPB_NO_CODE											0xFFFF
+// Largest 12 bit result (upper end of the PPB limits)
+#define ADC_PPB_MAX_RESULT									4095
+// Number of faults of a channel up to which its Error_LED stays off
+#define ADC_PPB_ERROR_THRESHOLD							2
+// Operating modes of AdcSetMode() (index of the trim cache = 2 * resolution + signal mode).
+// The board test and the PPB limits use ADC_MODE_12BIT_SINGLE_ENDED
+#define ADC_MODE_12BIT_SINGLE_ENDED					0
+#define ADC_MODE_12BIT_DIFFERENTIAL					1
+#define ADC_MODE_16BIT_SINGLE_ENDED					2
+#define ADC_MODE_16BIT_DIFFERENTIAL					3
+#define ADC_NUMBER_OF_MODES									4
+// Sampling groups: the SOCs 0 ... ADC_HIGH_PRIORITY_SOCS - 1 of every module have high priority
+// and are converted first after a trigger, the remaining SOCs run in round robin. The SOCs of
+// the board test which are triggered by ePWM1 SOCA use SOC 0 ... 5 (ADC-A also 14, 15), the
+// slow group uses the free SOCs 6 ... 13 and does not delay a conversion of the board test
+// by more than one conversion
+#define ADC_HIGH_PRIORITY_SOCS							6
+// Number of entries in the channel table of the slow group
+#define ADC_NUMBER_OF_SLOW_CHANNELS					1
+// Trigger period of the slow group in us (CPU timer 0, 1 kHz)
+#define ADC_SLOW_TRIGGER_PERIOD_US					1000UL
+// Acquisition window of the temperature sensor (min. 450 ns, 100 SYSCLK cycles = 500 ns)
+#define ADC_ACQPS_TEMP_SENSOR								99
+// Internal temperature sensor, connected to ADCIN13 of ADC-A
+#define ADC_TEMP_SENSOR_CHANNEL							ADC_SINGLE_ENDED_ADCIN13
+// Indices of the slow channel table
+#define ADC_SLOW_TEMP_SENSOR								0
+// Minimum acquisition window in 16 bit mode (320 ns = 64 SYSCLK cycles)
+#define ADC_ACQPS_16_BIT										63
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Entry of a channel table, describes the configuration of one SOC
+typedef struct
+{
+		uint16_t module;
+		uint16_t soc;
+		uint16_t chsel;
+		uint16_t acqps;
+		uint16_t trigger;
+} AdcChannelConfig;
+
+// Entry of the PPB table, describes the offset correction and the Error_LED of one channel
+// of the ADCIN check (index = channel number of Mux_Select())
+typedef struct
+{
+		uint16_t module;
+		uint16_t soc;
+		int16_t offset;						// offset correction (OFFCAL) in LSB, -512..511
+		uint16_t errorLed;				// numbering of Error_LEDs_On()
+} AdcPpbConfig;
+
+// Trims of one module in one operating mode (copy of the OTP values, see AdcInitTrimRegister())
+typedef struct
+{
+		uint32_t inlTrim[6];			// ADCINLTRIM1 ... ADCINLTRIM6
+		uint16_t offTrim;					// ADCOFFTRIM.OFFTRIM
+} AdcTrimSet;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -200,7 +291,28 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-
+// Channel table of the board test (ACQPS tuned by ADC_TuneAcqps())
+extern AdcChannelConfig adcChannelTable[ADC_NUMBER_OF_CHANNELS];
+// Channel table of the slow group (housekeeping, CPU timer 0)
+extern const AdcChannelConfig adcSlowChannelTable[ADC_NUMBER_OF_SLOW_CHANNELS];
+// PPB table of the ADCIN check
+extern const AdcPpbConfig adcPpbTable[ADC_NUMBER_OF_CHANNELS];
+// Register sets of the ADC modules, indexed with ADC_MODULE_x
+extern volatile struct ADC_REGS *const adcRegs[ADC_NUMBER_OF_MODULES];
+// Base addresses of the ADC result registers, indexed with ADC_MODULE_x
+extern volatile uint16_t *const adcResultBase[ADC_NUMBER_OF_MODULES];
+// Limits of the PPB relative to the DAC code (can be changed in the debugger)
+extern float32 adcPpbLowFactor;
+extern float32 adcPpbHighFactor;
+// Channel checked by the PPB (ADC_NUMBER_OF_CHANNELS if none) and faults per channel
+extern volatile uint16_t adcPpbChannel;
+extern volatile uint16_t adcPpbErrorCount[ADC_NUMBER_OF_CHANNELS];
+// Time of the power up of the ADC modules and state of the power up
+extern uint32_t adcPowerUpTime;
+extern bool adcPoweredUp;
+// Trims of all modules and modes (read from the OTP once) and current mode of every module
+extern AdcTrimSet adcTrimCache[ADC_NUMBER_OF_MODULES][ADC_NUMBER_OF_MODES];
+extern volatile uint16_t adcModuleMode[ADC_NUMBER_OF_MODULES];
 
 
 //-------------------------------------------------------------------------------------------------
@@ -213,8 +325,39 @@ extern void AdcInitTrimRegister(uint32_t adcModule,
 																uint32_t resolution,
 																uint32_t signalMode);
 
+// Function copies the trims of all modules and modes from the OTP into "adcTrimCache"
+extern void AdcTrimCacheInit(void);
+// Function switches a module to another resolution and signal mode with the cached trims
+extern bool AdcSetMode(uint16_t module, uint16_t mode);
+// Function powers up all ADC modules without waiting for the settling time
+extern void AdcPowerUpAll(void);
 // Funktion initialisiert den ADC (Modul A, B, C, D)
 extern void AdcInitAll(void);
+// Function configures the SOCs given in a channel table
+extern void AdcInitChannels(const AdcChannelConfig *table,
+														uint16_t numberOfEntries);
+// Function returns the index of a SOC in the channel table of the board test
+extern uint16_t AdcFindChannel(uint16_t module, uint16_t soc);
+// Function sets the acquisition window of an entry of the channel table and of its SOC
+extern void AdcSetAcqps(uint16_t index, uint16_t acqps);
+// Function returns the sampling window of the ePWM1 SOCA group in SYSCLK cycles
+extern uint16_t AdcGetSocaWindow(void);
+// Function sets the number of high priority SOCs of all modules
+extern void AdcSetPriority(uint16_t highPrioritySocs);
+// Function configures the slow group and starts CPU timer 0 as its trigger
+extern void AdcInitSlowGroup(void);
+// Function returns the last result of a channel of the slow group
+extern uint16_t AdcReadSlowChannel(uint16_t index);
+// Function prepares the PPBs and the ADCx_EVT interrupts for the limit check
+extern void AdcInitPpb(void);
+// Function assigns PPB1 of its module to a channel of the ADCIN check
+extern void AdcPpbSelect(uint16_t channel);
+// Function sets the limits for the transition to a new DAC code
+extern void AdcPpbSetCode(uint16_t code);
+// Function narrows the limits to the settled DAC code
+extern void AdcPpbCheck(uint16_t code);
+// ISR of the ADCx_EVT interrupts, counts a limit violation
+extern __interrupt void AdcPpbEventISR(void);
 
 #endif
 
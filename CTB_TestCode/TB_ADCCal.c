@@ -0,0 +1,261 @@
+//=================================================================================================
+/// @file     TB_ADCCal.c
+///
+/// @brief    File contains the closed-loop calibration of the ADC channels. The DACs step through
+///           ADC_CAL_NUMBER_OF_POINTS codes, every channel with an ADC result is selected with the
+///           mux and the averaged result is fitted to the DAC code (least squares, gain and
+///           offset). The remaining deviation of every point is stored as INL correction. The
+///           compact table is applied by AdcCalRead() with one multiply-add (plus one table add
+///           with ADC_CAL_INL)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_ADCCal.h"
+#include "TB_Functions.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Read path of the ADC results, may be called from ISRs
+#pragma CODE_SECTION(AdcCalRead, ".TI.ramfunc");
+#pragma CODE_SECTION(AdcCalCorrect, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// The table is not initialised by the C start-up code, a calibration is kept over a reset
+#pragma DATA_SECTION(adcCal, "adccal");
+AdcCalTable adcCal;
+uint16_t adcCalRequest = 0;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcCalChecksum ====================================================================
+///
+/// @brief  Function returns the sum of all words of the table in front of the checksum
+///
+/// @param  const AdcCalTable *table
+///
+/// @return uint16_t checksum
+///
+//=================================================================================================
+static uint16_t AdcCalChecksum(const AdcCalTable *table)
+{
+    const uint16_t *word = (const uint16_t *)table;
+    uint16_t sum = 0;
+
+    while (word < &table->checksum)
+        sum += *word++;
+
+    return sum;
+}
+
+//=== Function: AdcCalSetUncorrected ==============================================================
+///
+/// @brief  Function sets gain 1, offset 0 and no INL correction for one channel
+///
+/// @param  uint16_t channel
+///
+/// @return void
+///
+//=================================================================================================
+static void AdcCalSetUncorrected(uint16_t channel)
+{
+    adcCal.gain[channel] = ADC_CAL_GAIN_ONE;
+    adcCal.offset[channel] = 0;
+#if ADC_CAL_INL
+    for (uint16_t p = 0; p < ADC_CAL_NUMBER_OF_POINTS; p++)
+        adcCal.inl[channel][p] = 0;
+#endif
+}
+
+//=== Function: AdcCalAverage =====================================================================
+///
+/// @brief  Function returns the mean result of one channel over ADC_CAL_AVERAGE_FRAMES frames
+///
+/// @param  uint16_t channel
+///
+/// @return float32 mean
+///
+//=================================================================================================
+static float32 AdcCalAverage(uint16_t channel)
+{
+    uint32_t sum = 0;
+
+    for (uint16_t n = 0; n < ADC_CAL_AVERAGE_FRAMES; n++)
+    {
+        ADC_WaitFrames(1);
+        sum += ADCtoPWM_Read(adcPwmRoute[channel].source);
+    }
+
+    return (float32)sum / ADC_CAL_AVERAGE_FRAMES;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcCalInit ========================================================================
+///
+/// @brief  Function checks the table of the last calibration (kept in RAM over a reset). Without
+///         a valid table all channels are read uncorrected
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcCalInit(void)
+{
+    if (adcCal.magic == ADC_CAL_MAGIC && adcCal.checksum == AdcCalChecksum(&adcCal))
+        return;
+
+    for (uint16_t i = 0; i < ADC_CAL_NUMBER_OF_CHANNELS; i++)
+        AdcCalSetUncorrected(i);
+    adcCal.calibrated = 0;
+    adcCal.magic = 0;
+    adcCal.checksum = 0;
+}
+
+//=== Function: AdcCalRun =========================================================================
+///
+/// @brief  Function calibrates all channels. For every channel the mux is selected and the DACs
+///         step through the calibration points, the result of every point is averaged after
+///         the settling time (adcSettleFrames). Gain and offset are the least squares fit of the
+///         DAC code over the result, the INL entry is the remaining deviation of the point.
+///         A channel with a gain outside ADC_CAL_GAIN_MIN..MAX stays uncorrected.
+///         Must not be called from an ISR (waits for the DMA frames)
+///
+/// @param  void
+///
+/// @return bool all channels calibrated
+///
+//=================================================================================================
+bool AdcCalRun(void)
+{
+    float32 mean[ADC_CAL_NUMBER_OF_POINTS];
+#if ADC_CAL_INL
+    int16_t inl[ADC_CAL_NUMBER_OF_POINTS];
+#endif
+
+    adcCal.magic = 0;   // Table is invalid while it is changed
+    adcCal.calibrated = 0;
+
+    EALLOW;
+    for (uint16_t i = 0; i < ADC_CAL_NUMBER_OF_CHANNELS; i++)
+    {
+        float32 sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+        float32 gain, offset, det;
+
+        Mux_Select(i);
+        for (uint16_t p = 0; p < ADC_CAL_NUMBER_OF_POINTS; p++)
+        {
+            float32 code = ADC_CAL_FIRST_CODE + ((uint32_t)p << ADC_CAL_POINT_SHIFT);
+
+            ADC_SetDACs((uint16_t)code);
+            ADC_WaitFrames(adcSettleFrames);
+            mean[p] = AdcCalAverage(i);
+
+            sumX += mean[p];
+            sumY += code;
+            sumXX += mean[p] * mean[p];
+            sumXY += mean[p] * code;
+        }
+        Mux_Select(23);
+
+        det = ADC_CAL_NUMBER_OF_POINTS * sumXX - sumX * sumX;
+        gain = (det != 0.0f) ? (ADC_CAL_NUMBER_OF_POINTS * sumXY - sumX * sumY) / det : 0.0f;
+        if (gain < ADC_CAL_GAIN_MIN || gain > ADC_CAL_GAIN_MAX)
+        {
+            AdcCalSetUncorrected(i);
+            continue;
+        }
+        offset = (sumY - gain * sumX) / ADC_CAL_NUMBER_OF_POINTS;
+
+        adcCal.gain[i] = (uint16_t)(gain * ADC_CAL_GAIN_ONE + 0.5f);
+        adcCal.offset[i] = (int32_t)(offset * ADC_CAL_GAIN_ONE);
+#if ADC_CAL_INL
+        // Deviation of every point after the gain/offset correction (same arithmetic as
+        // AdcCalCorrect(), therefore computed with all INL entries 0 and stored afterwards)
+        for (uint16_t p = 0; p < ADC_CAL_NUMBER_OF_POINTS; p++)
+            adcCal.inl[i][p] = 0;
+        for (uint16_t p = 0; p < ADC_CAL_NUMBER_OF_POINTS; p++)
+        {
+            int16_t code = ADC_CAL_FIRST_CODE + (p << ADC_CAL_POINT_SHIFT);
+
+            inl[p] = code - (int16_t)AdcCalCorrect(i, (uint16_t)(mean[p] + 0.5f));
+        }
+        for (uint16_t p = 0; p < ADC_CAL_NUMBER_OF_POINTS; p++)
+            adcCal.inl[i][p] = inl[p];
+#endif
+        adcCal.calibrated++;
+    }
+    ADC_SetDACs(0);
+    EDIS;
+
+    adcCal.magic = ADC_CAL_MAGIC;
+    adcCal.checksum = AdcCalChecksum(&adcCal);
+
+    return adcCal.calibrated == ADC_CAL_NUMBER_OF_CHANNELS;
+}
+
+//=== Function: AdcCalCorrect =====================================================================
+///
+/// @brief  Function corrects a raw result of one channel with gain and offset and, with
+///         ADC_CAL_INL, the deviation of the nearest calibration point
+///
+/// @param  uint16_t channel, uint16_t raw
+///
+/// @return uint16_t corrected (0..4095)
+///
+//=================================================================================================
+uint16_t AdcCalCorrect(uint16_t channel, uint16_t raw)
+{
+    int32_t value;
+
+    if (channel >= ADC_CAL_NUMBER_OF_CHANNELS)
+        return raw;
+
+    value = ((int32_t)raw * adcCal.gain[channel] + adcCal.offset[channel]
+             + (1L << (ADC_CAL_FRACTION_BITS - 1))) >> ADC_CAL_FRACTION_BITS;
+#if ADC_CAL_INL
+    if (value > 0)
+    {
+        uint16_t point = (uint16_t)value >> ADC_CAL_POINT_SHIFT;
+
+        if (point >= ADC_CAL_NUMBER_OF_POINTS)
+            point = ADC_CAL_NUMBER_OF_POINTS - 1;
+        value += adcCal.inl[channel][point];
+    }
+#endif
+
+    if (value < 0)
+        return 0;
+    if (value > ADC_CAL_MAX_VALUE)
+        return ADC_CAL_MAX_VALUE;
+    return (uint16_t)value;
+}
+
+//=== Function: AdcCalRead ========================================================================
+///
+/// @brief  Function returns the corrected result of one channel (last DMA frame or result
+///         register, see ADCtoPWM_Read())
+///
+/// @param  uint16_t channel
+///
+/// @return uint16_t corrected (0..4095)
+///
+//=================================================================================================
+uint16_t AdcCalRead(uint16_t channel)
+{
+    if (channel >= ADC_CAL_NUMBER_OF_CHANNELS)
+        return 0;
+    return AdcCalCorrect(channel, ADCtoPWM_Read(adcPwmRoute[channel].source));
+}
@@ -0,0 +1,86 @@
+//=================================================================================================
+/// @file     TB_ADCCal.h
+///
+/// @brief    File contains the closed-loop calibration of the ADC channels. The DACs step through
+///           ADC_CAL_NUMBER_OF_POINTS codes, every channel with an ADC result is selected with the
+///           mux and the averaged result is fitted to the DAC code (least squares, gain and
+///           offset). The remaining deviation of every point is stored as INL correction. The
+///           compact table is applied by AdcCalRead() with one multiply-add (plus one table add
+///           with ADC_CAL_INL)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYADCCAL_H_
+#define MYADCCAL_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_ADCStats.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of calibrated channels (mux channels 0..20, same as the statistics)
+#define ADC_CAL_NUMBER_OF_CHANNELS  ADC_STATS_NUMBER_OF_CHANNELS
+// DAC codes of the calibration points: ADC_CAL_FIRST_CODE + n * 2^ADC_CAL_POINT_SHIFT,
+// so the INL entry of a result is found with one shift
+#define ADC_CAL_POINT_SHIFT         8
+#define ADC_CAL_FIRST_CODE          (1U << (ADC_CAL_POINT_SHIFT - 1))
+#define ADC_CAL_NUMBER_OF_POINTS    15
+// Number of averaged DMA frames (5 us each) per calibration point
+#define ADC_CAL_AVERAGE_FRAMES      16
+// 1: the deviation of every point from the fitted line is corrected too
+#define ADC_CAL_INL                 1
+// Fixed point format of gain and offset (Q14, gain 1.0 = 16384)
+#define ADC_CAL_FRACTION_BITS       14
+#define ADC_CAL_GAIN_ONE            (1U << ADC_CAL_FRACTION_BITS)
+// Accepted gain of a channel (a channel outside is not calibrated, e.g. open input)
+#define ADC_CAL_GAIN_MIN            0.8f
+#define ADC_CAL_GAIN_MAX            1.25f
+// Marker of a valid table (with checksum)
+#define ADC_CAL_MAGIC               0xCA1BU
+// Largest ADC result
+#define ADC_CAL_MAX_VALUE           4095
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Calibration table of all channels: corrected = (raw * gain + offset) >> ADC_CAL_FRACTION_BITS
+typedef struct
+{
+    uint16_t magic;                                                 // ADC_CAL_MAGIC if valid
+    uint16_t calibrated;                                            // number of calibrated channels
+    uint16_t gain[ADC_CAL_NUMBER_OF_CHANNELS];                      // Q14
+    int32_t  offset[ADC_CAL_NUMBER_OF_CHANNELS];                    // Q14, in LSB
+#if ADC_CAL_INL
+    int16_t  inl[ADC_CAL_NUMBER_OF_CHANNELS][ADC_CAL_NUMBER_OF_POINTS];   // LSB, per point
+#endif
+    uint16_t checksum;                                              // sum of all words above
+} AdcCalTable;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Calibration table used by AdcCalRead() (retained RAM, see AdcCalInit())
+extern AdcCalTable adcCal;
+// 1: AdcCalRun() is executed before the analog checks (can be set in the debugger)
+extern uint16_t adcCalRequest;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function keeps a valid table of the last calibration, otherwise all channels are uncorrected
+extern void AdcCalInit(void);
+// Function calibrates all channels with the DACs, returns false if a channel failed
+extern bool AdcCalRun(void);
+// Function returns the corrected result of one channel
+extern uint16_t AdcCalRead(uint16_t channel);
+// Function corrects a raw result of one channel
+extern uint16_t AdcCalCorrect(uint16_t channel, uint16_t raw);
+
+#endif
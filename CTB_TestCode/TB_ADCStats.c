@@ -0,0 +1,154 @@
+//=================================================================================================
+/// @file     TB_ADCStats.c
+///
+/// @brief    File contains the statistics of the ADCIN check. For every channel with an ADC result
+///           the deviation of the result from the expected DAC code is accumulated (min, max,
+///           mean, INL) and for consecutive codes the DNL. The values are stored as a structure
+///           of arrays, one array entry per channel, and can be read with the debugger after
+///           ADCINs_Check()
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_ADCStats.h"
+#include "TB_Functions.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the sequencer ISR for every ADC result, runs from LSx RAM (see TB_Sequencer.c)
+#pragma CODE_SECTION(AdcStatsEvaluateChannel, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+AdcChannelStats adcStats;
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcStatsReset =====================================================================
+///
+/// @brief  Function clears the statistics of all channels
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcStatsReset(void)
+{
+    for (uint16_t i = 0; i < ADC_STATS_NUMBER_OF_CHANNELS; i++)
+    {
+        adcStats.count[i] = 0;
+        adcStats.errorMin[i] = ADC_STATS_INIT_MIN;
+        adcStats.errorMax[i] = ADC_STATS_INIT_MAX;
+        adcStats.errorSum[i] = 0;
+        adcStats.dnlMin[i] = ADC_STATS_INIT_MIN;
+        adcStats.dnlMax[i] = ADC_STATS_INIT_MAX;
+        adcStats.lastCode[i] = ADC_STATS_NOT_DRIVEN;
+        adcStats.lastValue[i] = 0;
+    }
+}
+
+//=== Function: AdcStatsEvaluateChannel ===========================================================
+///
+/// @brief  Function adds the current result of one channel (last DMA frame or result register)
+///         to the statistics. The DNL is only updated if the code is the successor of the code
+///         of the last evaluation (full sweep)
+///
+/// @param  uint16_t channel, uint16_t expected
+///
+/// @return void
+///
+//=================================================================================================
+void AdcStatsEvaluateChannel(uint16_t channel, uint16_t expected)
+{
+    uint16_t value;
+    int16_t error;
+
+    if (channel >= ADC_STATS_NUMBER_OF_CHANNELS || expected == ADC_STATS_NOT_DRIVEN)
+        return;
+
+    value = ADCtoPWM_Read(adcPwmRoute[channel].source);
+    error = (int16_t)value - (int16_t)expected;
+
+    adcStats.count[channel]++;
+    adcStats.errorSum[channel] += error;
+    if (error < adcStats.errorMin[channel])
+        adcStats.errorMin[channel] = error;
+    if (error > adcStats.errorMax[channel])
+        adcStats.errorMax[channel] = error;
+
+    if (adcStats.lastCode[channel] != ADC_STATS_NOT_DRIVEN
+        && expected == adcStats.lastCode[channel] + 1)
+    {
+        int16_t dnl = (int16_t)value - (int16_t)adcStats.lastValue[channel] - 1;
+
+        if (dnl < adcStats.dnlMin[channel])
+            adcStats.dnlMin[channel] = dnl;
+        if (dnl > adcStats.dnlMax[channel])
+            adcStats.dnlMax[channel] = dnl;
+    }
+    adcStats.lastCode[channel] = expected;
+    adcStats.lastValue[channel] = value;
+}
+
+//=== Function: AdcStatsEvaluateAll ===============================================================
+///
+/// @brief  Function adds the current results of all channels to the statistics, "expected"
+///         contains one code per channel (ADC_STATS_NOT_DRIVEN: channel is not evaluated)
+///
+/// @param  const uint16_t *expected
+///
+/// @return void
+///
+//=================================================================================================
+void AdcStatsEvaluateAll(const uint16_t *expected)
+{
+    for (uint16_t i = 0; i < ADC_STATS_NUMBER_OF_CHANNELS; i++)
+        AdcStatsEvaluateChannel(i, expected[i]);
+}
+
+//=== Function: AdcStatsMeanError =================================================================
+///
+/// @brief  Function returns the mean deviation of one channel in LSB
+///
+/// @param  uint16_t channel
+///
+/// @return float32 mean
+///
+//=================================================================================================
+float32 AdcStatsMeanError(uint16_t channel)
+{
+    if (channel >= ADC_STATS_NUMBER_OF_CHANNELS || adcStats.count[channel] == 0)
+        return 0;
+    return (float32)adcStats.errorSum[channel] / adcStats.count[channel];
+}
+
+//=== Function: AdcStatsINL =======================================================================
+///
+/// @brief  Function returns the INL (max. absolute deviation from the ideal code) of one channel
+///         in LSB
+///
+/// @param  uint16_t channel
+///
+/// @return uint16_t inl
+///
+//=================================================================================================
+uint16_t AdcStatsINL(uint16_t channel)
+{
+    int16_t low, high;
+
+    if (channel >= ADC_STATS_NUMBER_OF_CHANNELS || adcStats.count[channel] == 0)
+        return 0;
+    low = -adcStats.errorMin[channel];
+    high = adcStats.errorMax[channel];
+    return (uint16_t)((low > high) ? low : high);
+}
@@ -0,0 +1,70 @@
+//=================================================================================================
+/// @file     TB_ADCStats.h
+///
+/// @brief    File contains the statistics of the ADCIN check. For every channel with an ADC result
+///           the deviation of the result from the expected DAC code is accumulated (min, max,
+///           mean, INL) and for consecutive codes the DNL. The values are stored as a structure
+///           of arrays, one array entry per channel, and can be read with the debugger after
+///           ADCINs_Check()
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYADCSTATS_H_
+#define MYADCSTATS_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of channels in the statistics (mux channels 0..20, routes 0..20 of ADCtoPWM())
+#define ADC_STATS_NUMBER_OF_CHANNELS    21
+// Expected code of a channel which is not driven by the DAC (not evaluated)
+#define ADC_STATS_NOT_DRIVEN            0xFFFF
+// Start values of the min. and max. values
+#define ADC_STATS_INIT_MIN              32767
+#define ADC_STATS_INIT_MAX              (-32767 - 1)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Statistics of all channels, deviations in LSB (result - expected code)
+typedef struct
+{
+    uint16_t count[ADC_STATS_NUMBER_OF_CHANNELS];       // number of evaluated results
+    int16_t  errorMin[ADC_STATS_NUMBER_OF_CHANNELS];    // min. deviation
+    int16_t  errorMax[ADC_STATS_NUMBER_OF_CHANNELS];    // max. deviation
+    int32_t  errorSum[ADC_STATS_NUMBER_OF_CHANNELS];    // sum of the deviations (mean)
+    int16_t  dnlMin[ADC_STATS_NUMBER_OF_CHANNELS];      // min. DNL (consecutive codes only)
+    int16_t  dnlMax[ADC_STATS_NUMBER_OF_CHANNELS];      // max. DNL (consecutive codes only)
+    uint16_t lastCode[ADC_STATS_NUMBER_OF_CHANNELS];    // code of the last evaluation
+    uint16_t lastValue[ADC_STATS_NUMBER_OF_CHANNELS];   // result of the last evaluation
+} AdcChannelStats;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Statistics of the ADCIN check
+extern AdcChannelStats adcStats;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function clears the statistics of all channels
+extern void AdcStatsReset(void);
+// Function adds the current result of one channel to the statistics
+extern void AdcStatsEvaluateChannel(uint16_t channel, uint16_t expected);
+// Function adds the current results of all channels to the statistics
+extern void AdcStatsEvaluateAll(const uint16_t *expected);
+// Function returns the mean deviation of one channel in LSB
+extern float32 AdcStatsMeanError(uint16_t channel);
+// Function returns the INL (max. absolute deviation) of one channel in LSB
+extern uint16_t AdcStatsINL(uint16_t channel);
+
+#endif
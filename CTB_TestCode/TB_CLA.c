@@ -0,0 +1,341 @@
+//=================================================================================================
+/// @file     TB_CLA.c
+///
+/// @brief    File contains the set up of the CLA and the hand over of the routes and checks of
+///           the ADCIN check to the CLA tasks, see TB_CLA.h. Register description see chapter
+///           "Control Law Accelerator (CLA)" of the Reference Manual TMS320F2838x, SPRUII0D
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_CLA.h"
+#include "TB_Functions.h"
+#include "TB_Clock.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the sequencer steps (see TB_Sequencer.c)
+#pragma CODE_SECTION(ClaAdcCommand, ".TI.ramfunc");
+#pragma CODE_SECTION(ClaAdcSelect, ".TI.ramfunc");
+#pragma CODE_SECTION(ClaAdcCheck, ".TI.ramfunc");
+#pragma CODE_SECTION(ClaAdcResetErrorCounts, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Message RAMs, cleared by ClaAdcInit() (variables cannot be initialised here)
+#pragma DATA_SECTION(claAdcInput, "CpuToCla1MsgRAM");
+ClaAdcInput claAdcInput;
+#pragma DATA_SECTION(claAdcOutput, "Cla1ToCpuMsgRAM");
+ClaAdcOutput claAdcOutput;
+// CLA data memory (RAMLS7)
+#pragma DATA_SECTION(claAdcRoute, "Cla1DataRam");
+ClaAdcRoute claAdcRoute[CLA_ADC_NUMBER_OF_ROUTES];
+#pragma DATA_SECTION(claAdcGammaLut, "Cla1DataRam");
+uint16_t claAdcGammaLut[CLA_ADC_LUT_SIZE];
+// CLA data memory of the sliding DFT, cleared by the CLA with every new configuration
+#pragma DATA_SECTION(claHarmonicState, "Cla1DataRam");
+ClaHarmonicState claHarmonicState[CLA_HARMONIC_NUMBER_OF_BINS];
+#pragma DATA_SECTION(claHarmonicHistory, "Cla1DataRam");
+uint16_t claHarmonicHistory[CLA_HARMONIC_NUMBER_OF_CHANNELS][CLA_HARMONIC_WINDOW];
+#pragma DATA_SECTION(claHarmonicPosition, "Cla1DataRam");
+uint16_t claHarmonicPosition;
+#pragma DATA_SECTION(claHarmonicDecimationCount, "Cla1DataRam");
+uint16_t claHarmonicDecimationCount;
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Set by ClaAdcInit(), commands before are ignored (e.g. Mux_Init())
+static bool claAdcReady = false;
+// Channel of the last CLA_ADC_COMMAND_CHECK, its result is taken over with the next command
+static uint16_t claAdcPendingCheck = CLA_ADC_NUMBER_OF_CHANNELS;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaAdcCommand =====================================================================
+///
+/// @brief  Function waits until task 2 has executed the last command (at most one run of task 1
+///         and task 2), switches on the error LED of the last checked channel after more than
+///         CLA_ADC_ERROR_LED_COUNT errors and starts task 2 with the new command. EALLOW must
+///         be set
+///
+/// @param  uint16_t command, uint16_t channel, uint16_t limit
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaAdcCommand(uint16_t command, uint16_t channel, uint16_t limit)
+{
+    if (!claAdcReady)
+        return;
+
+    while (claAdcOutput.commandDone != claAdcInput.commandCount)
+    {
+    }
+
+    if (claAdcPendingCheck < CLA_ADC_NUMBER_OF_CHANNELS
+        && claAdcOutput.errorCount[claAdcPendingCheck] > CLA_ADC_ERROR_LED_COUNT)
+        Error_LEDs_On(claAdcPendingCheck + 1);
+    claAdcPendingCheck = (command == CLA_ADC_COMMAND_CHECK) ? channel : CLA_ADC_NUMBER_OF_CHANNELS;
+
+    claAdcInput.command = command;
+    claAdcInput.channel = channel;
+    claAdcInput.limit = limit;
+    claAdcInput.commandCount++;
+    Cla1Regs.MIFRC.bit.INT2 = 1;
+}
+
+//=== Function: ClaHarmonicChanged ================================================================
+///
+/// @brief  Function tells task 1 that the configuration of the harmonic tracking has changed,
+///         task 1 restarts the tracking with its next frame
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaHarmonicChanged(void)
+{
+    claAdcInput.harmonicConfigCount++;
+}
+
+//=== Function: ClaHarmonicInit ===================================================================
+///
+/// @brief  Function sets the default configuration of the harmonic tracking after the message
+///         RAMs have been cleared: all bins off, a sample every frame, channel i on route i. The
+///         weights r^m of the window give r^N of the comb and the scale of the amplitude
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaHarmonicInit(void)
+{
+    float weight = 1.0f;
+    float sum = 0.0f;
+
+    for (uint16_t i = 0; i < CLA_HARMONIC_WINDOW; i++)
+    {
+        sum += weight;
+        weight *= CLA_HARMONIC_DAMPING;
+    }
+    claAdcInput.harmonicDampingN = weight;
+    claAdcInput.harmonicScale = 2.0f / sum;
+    claAdcInput.harmonicDecimation = 1;
+    for (uint16_t i = 0; i < CLA_HARMONIC_NUMBER_OF_CHANNELS; i++)
+        claAdcInput.harmonicRoute[i] = i;
+    for (uint16_t i = 0; i < CLA_HARMONIC_NUMBER_OF_BINS; i++)
+        claAdcInput.harmonicBin[i].channel = CLA_HARMONIC_OFF;
+    // harmonicConfigDone is 0 after the clear, task 1 restarts with its first frame
+    ClaHarmonicChanged();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaAdcInit ========================================================================
+///
+/// @brief  Function copies the CLA program from flash, clears the message RAMs, assigns RAMLS6
+///         (program) and RAMLS7 (data) to the CLA and fills the route table and the gamma lookup
+///         table (from adcGammaLut) and the default configuration of the harmonic tracking
+///         (all bins off). Task 1 is started by ADC-A INT1, task 2 by software, both
+///         without CPU interrupt. Must be called after ADCtoPWM_Init()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaAdcInit(void)
+{
+    // Placeholders for constants of the linker, the names must not be changed
+    extern Uint16 Cla1funcsRunStart, Cla1funcsLoadStart, Cla1funcsLoadSize;
+#ifdef _FLASH
+    DeviceCopyWords(&Cla1funcsRunStart, &Cla1funcsLoadStart, (uint32_t)&Cla1funcsLoadSize);
+#endif
+
+    EALLOW;
+    ClockRequest(CLOCK_CLA1);
+
+    MemCfgRegs.MSGxINIT.bit.INIT_CPUTOCLA1 = 1;
+    while (MemCfgRegs.MSGxINITDONE.bit.INITDONE_CPUTOCLA1 == 0)
+    {
+    }
+    MemCfgRegs.MSGxINIT.bit.INIT_CLA1TOCPU = 1;
+    while (MemCfgRegs.MSGxINITDONE.bit.INITDONE_CLA1TOCPU == 0)
+    {
+    }
+
+    // LS6: CLA program memory, LS7: CLA data memory (CPU keeps access to LS7)
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS6 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS6 = 1;
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS7 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS7 = 0;
+
+    for (uint16_t i = 0; i < CLA_ADC_NUMBER_OF_ROUTES; i++)
+    {
+        uint16_t source = adcPwmRoute[i].source;
+        volatile uint16_t *result = (source == ADC_SOURCE_DACA)
+            ? (volatile uint16_t *)&DacaRegs.DACVALS.all
+            : &adcResultBase[source / DMA_ADC_RESULTS_PER_MODULE][source % DMA_ADC_RESULTS_PER_MODULE];
+
+        claAdcRoute[i].result = (uint16_t)(uint32_t)result;
+        claAdcRoute[i].compare = (uint16_t)(uint32_t)adcPwmRoute[i].compare;
+    }
+    for (uint16_t i = 0; i < CLA_ADC_LUT_SIZE; i++)
+        claAdcGammaLut[i] = adcGammaLut[i << CLA_ADC_LUT_SHIFT];
+
+    claAdcInput.route = CLA_ADC_ROUTE_NONE;
+    claAdcPendingCheck = CLA_ADC_NUMBER_OF_CHANNELS;
+
+    ClaHarmonicInit();
+
+    Cla1Regs.MVECT1 = (uint16_t)&ClaAdcTask1;
+    Cla1Regs.MVECT2 = (uint16_t)&ClaAdcTask2;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 = CLA_TRIGGER_ADCAINT1;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK2 = CLA_TRIGGER_SOFTWARE;
+    // No CPU interrupt at the end of the tasks
+    PieCtrlRegs.PIEIER11.bit.INTx1 = 0;
+    PieCtrlRegs.PIEIER11.bit.INTx2 = 0;
+    Cla1Regs.MIER.bit.INT1 = 1;
+    Cla1Regs.MIER.bit.INT2 = 1;
+
+    // ADC-A INT1 with the EOC of its last SOC, continuous (same setting as DmaInitAdcCapture())
+    AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = DMA_ADC_LAST_SOC_A;
+    AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+    AdcaRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+    EDIS;
+
+    claAdcReady = true;
+}
+
+//=== Function: ClaAdcSelect ======================================================================
+///
+/// @brief  Function hands over the route whose compare is written by task 1 from the next frame
+///         on (0..31, CLA_ADC_ROUTE_NONE switches all PWM_LEDs off, CLA_ADC_ROUTE_ALL updates
+///         all routes)
+///
+/// @param  uint16_t route
+///
+/// @return void
+///
+//=================================================================================================
+void ClaAdcSelect(uint16_t route)
+{
+    claAdcInput.route = route;
+}
+
+//=== Function: ClaAdcCheck =======================================================================
+///
+/// @brief  Function starts the check of the latched result of a channel (result < limit counts
+///         an error). EALLOW must be set
+///
+/// @param  uint16_t channel, uint16_t limit
+///
+/// @return void
+///
+//=================================================================================================
+void ClaAdcCheck(uint16_t channel, uint16_t limit)
+{
+    ClaAdcCommand(CLA_ADC_COMMAND_CHECK, channel, limit);
+}
+
+//=== Function: ClaAdcResetErrorCounts ============================================================
+///
+/// @brief  Function clears the error counters after the last check has been taken over.
+///         EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaAdcResetErrorCounts(void)
+{
+    ClaAdcCommand(CLA_ADC_COMMAND_RESET, 0, 0);
+}
+
+//=== Function: ClaHarmonicSetChannel =============================================================
+///
+/// @brief  Function selects the route (0..31, result latched by task 1) of a channel of the
+///         harmonic tracking and restarts the tracking
+///
+/// @param  uint16_t channel, uint16_t route
+///
+/// @return bool valid
+///
+//=================================================================================================
+bool ClaHarmonicSetChannel(uint16_t channel, uint16_t route)
+{
+    if (channel >= CLA_HARMONIC_NUMBER_OF_CHANNELS || route >= CLA_ADC_NUMBER_OF_ROUTES)
+        return false;
+
+    claAdcInput.harmonicRoute[channel] = route;
+    ClaHarmonicChanged();
+    return true;
+}
+
+//=== Function: ClaHarmonicSetBin =================================================================
+///
+/// @brief  Function sets a tracked bin: channel (CLA_HARMONIC_OFF switches the bin off),
+///         frequency bin k (1..N/2, frequency k / (N * decimation * 5 us)) and the amplitude in
+///         ADC counts above which its alarm bit is set. The twiddle factor is computed here, the
+///         tracking restarts
+///
+/// @param  uint16_t bin, uint16_t channel, uint16_t k, float limit
+///
+/// @return bool valid
+///
+//=================================================================================================
+bool ClaHarmonicSetBin(uint16_t bin, uint16_t channel, uint16_t k, float limit)
+{
+    ClaHarmonicBin *config;
+    float angle;
+
+    if (bin >= CLA_HARMONIC_NUMBER_OF_BINS
+        || (channel >= CLA_HARMONIC_NUMBER_OF_CHANNELS && channel != CLA_HARMONIC_OFF)
+        || k == 0 || k > CLA_HARMONIC_WINDOW / 2)
+        return false;
+
+    config = &claAdcInput.harmonicBin[bin];
+    angle = 6.2831853f * k / CLA_HARMONIC_WINDOW;
+    config->channel = CLA_HARMONIC_OFF;
+    config->bin = k;
+    config->twiddleRe = cosf(angle);
+    config->twiddleIm = sinf(angle);
+    config->limit = limit;
+    config->channel = channel;
+    ClaHarmonicChanged();
+    return true;
+}
+
+//=== Function: ClaHarmonicSetDecimation ==========================================================
+///
+/// @brief  Function sets the number of frames per sample of the harmonic tracking (1: every
+///         frame of 5 us, the window is N * decimation frames long) and restarts the tracking
+///
+/// @param  uint16_t decimation
+///
+/// @return bool valid
+///
+//=================================================================================================
+bool ClaHarmonicSetDecimation(uint16_t decimation)
+{
+    if (decimation == 0)
+        return false;
+
+    claAdcInput.harmonicDecimation = decimation;
+    ClaHarmonicChanged();
+    return true;
+}
@@ -0,0 +1,183 @@
+//=================================================================================================
+/// @file     TB_CLA.h
+///
+/// @brief    File contains the CLA tasks of the ADCIN check. CLA task 1 is started by ADC-A INT1
+///           (EOC of the last SOC of ADC-A, the module with the most SOCs finishes last), so it
+///           runs once per ePWM1 SOCA frame (5 us) without the CPU:
+///           - the results of all 32 routes of adcPwmRoute are latched in claAdcOutput.result
+///           - the compare of the selected route (or of all routes) is written through the gamma
+///             lookup table claAdcGammaLut and loaded with the next global load of ePWM1
+///           CLA task 2 is started by software for every command of the CPU: it compares the
+///           latched result of a channel with the limit handed over by ADC_ErrorCheck() and
+///           counts the errors in claAdcOutput.errorCount, or clears the counters.
+///           With CLA_HARMONIC_ENABLE task 1 also tracks up to CLA_HARMONIC_NUMBER_OF_BINS
+///           harmonics of up to CLA_HARMONIC_NUMBER_OF_CHANNELS routes with a sliding DFT over
+///           the last CLA_HARMONIC_WINDOW samples (every harmonicDecimation-th frame):
+///             S(n) = W * (r * S(n-1) + x(n) - r^N * x(n-N)),  W = exp(j*2*pi*k/N)
+///           The damping r (CLA_HARMONIC_DAMPING) keeps the rounding errors of W from growing.
+///           A bin costs one complex multiply and a square root per sample, the amplitudes and
+///           the alarm bits (amplitude above the limit of the bin) are written to
+///           claAdcOutput every sample, the phase of one bin per sample (round robin). The phase
+///           refers to the oldest sample of the window, the difference of two bins of the same
+///           k is the phase shift between their channels. ClaHarmonicSetChannel(),
+///           ClaHarmonicSetBin() and ClaHarmonicSetDecimation() change the configuration, the
+///           CLA then restarts the tracking (amplitudes valid when harmonicSamples reaches
+///           CLA_HARMONIC_WINDOW).
+///           CPU1 only sequences the check: ADCtoPWM() hands over the route, ADC_ErrorCheck()
+///           the limit of the settled DAC code. The error LEDs stay with CPU1 (GPxCSEL: a pin
+///           written by the CLA could no longer be written by CPU1), a check is taken over
+///           and its LED switched on with the next command.
+///           The result variables (A2 .. IN15) and the *_Error_count variables of TB_Functions
+///           are not updated, see claAdcOutput in the debugger.
+///           Memory: RAMLS6 is CLA program memory, RAMLS7 CLA data memory, the message RAMs
+///           CpuToCla1MsgRAM and Cla1ToCpuMsgRAM (see 2838x_FLASH_lnk_cpu1.cmd)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYCLA_H_
+#define MYCLA_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: the PWM_LED compares and the ADC error check of ADCINs_Check() run on the CLA
+// 0: ADCtoPWM() and ADC_ErrorCheck() run on the CPU
+// With ADC_ERROR_CHECK_PPB (TB_ADC.h) the error check stays in the PPB, the CLA only writes
+// the compares
+#define CLA_ADC_ENABLE                  1
+// Number of routes (ADC_PWM_NUMBER_OF_ROUTES) and of checked channels
+// (ADC_NUMBER_OF_CHECKED_CHANNELS), TB_Functions.h cannot be included by the CLA compiler
+#define CLA_ADC_NUMBER_OF_ROUTES        32
+#define CLA_ADC_NUMBER_OF_CHANNELS      21
+// Routes of claAdcInput.route besides 0..31: all compares 0 (as ADCtoPWM(32)), all routes
+#define CLA_ADC_ROUTE_NONE              CLA_ADC_NUMBER_OF_ROUTES
+#define CLA_ADC_ROUTE_ALL               (CLA_ADC_NUMBER_OF_ROUTES + 1)
+// Gamma lookup table of the CLA: one entry per 4 results (12 bit result >> 2) fits into RAMLS7
+#define CLA_ADC_LUT_SHIFT               2
+#define CLA_ADC_LUT_SIZE                (4096 >> CLA_ADC_LUT_SHIFT)
+// Commands of CLA task 2
+#define CLA_ADC_COMMAND_CHECK           0
+#define CLA_ADC_COMMAND_RESET           1
+// Error LED of a channel is switched on with more errors than this (as ADC_ErrorCheck())
+#define CLA_ADC_ERROR_LED_COUNT         2
+// Trigger sources of the CLA tasks (CLA1TASKSRCSELx, same numbers as the DMA triggers)
+#define CLA_TRIGGER_SOFTWARE            0
+#define CLA_TRIGGER_ADCAINT1            1
+// 1: task 1 tracks the configured harmonics (sliding DFT)
+#define CLA_HARMONIC_ENABLE             1
+// Tracked bins, tracked channels (routes) and samples of the window N
+#define CLA_HARMONIC_NUMBER_OF_BINS     8
+#define CLA_HARMONIC_NUMBER_OF_CHANNELS 2
+#define CLA_HARMONIC_WINDOW             128
+// Damping r of the recursion (1 - 2^-16)
+#define CLA_HARMONIC_DAMPING            0.9999847412f
+// Channel of a bin which is not used
+#define CLA_HARMONIC_OFF                0xFFFF
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Addresses are 16 bit (all registers lie below 0x10000), the CLA uses 16 bit pointers
+typedef struct
+{
+    uint16_t result;                    // address of the ADC result register or of DACVALS
+    uint16_t compare;                   // address of the 16 bit compare value CMPA/CMPB
+} ClaAdcRoute;
+
+// Configuration of one tracked bin (ClaHarmonicSetBin())
+typedef struct
+{
+    uint16_t channel;                   // 0..CLA_HARMONIC_NUMBER_OF_CHANNELS-1 or CLA_HARMONIC_OFF
+    uint16_t bin;                       // k, frequency k / (N * decimation * 5 us)
+    float twiddleRe;                    // cos(2*pi*k/N)
+    float twiddleIm;                    // sin(2*pi*k/N)
+    float limit;                        // amplitude above which the alarm bit is set
+} ClaHarmonicBin;
+
+// State of the sliding DFT of one bin
+typedef struct
+{
+    float re;
+    float im;
+} ClaHarmonicState;
+
+// Written by the CPU, read by the CLA (CpuToCla1MsgRAM)
+typedef struct
+{
+    uint16_t route;                     // 0..31, CLA_ADC_ROUTE_NONE or CLA_ADC_ROUTE_ALL
+    uint16_t command;                   // CLA_ADC_COMMAND_x
+    uint16_t channel;                   // channel of CLA_ADC_COMMAND_CHECK
+    uint16_t limit;                     // result < limit is an error
+    uint16_t commandCount;              // incremented with every command
+    uint16_t harmonicDecimation;        // frames per sample of the sliding DFT (1: every frame)
+    uint16_t harmonicRoute[CLA_HARMONIC_NUMBER_OF_CHANNELS];   // route of each channel
+    uint16_t harmonicConfigCount;       // incremented with every change of the configuration
+    float harmonicDampingN;             // r^N
+    float harmonicScale;                // 2 / (1 + r + .. r^(N-1)), amplitude in ADC counts
+    ClaHarmonicBin harmonicBin[CLA_HARMONIC_NUMBER_OF_BINS];
+} ClaAdcInput;
+
+// Written by the CLA, read by the CPU (Cla1ToCpuMsgRAM)
+typedef struct
+{
+    uint32_t frames;                    // runs of task 1
+    uint32_t checks;                    // executed CLA_ADC_COMMAND_CHECK
+    uint16_t route;                     // route applied by task 1
+    uint16_t commandDone;               // commandCount of the last executed command
+    uint16_t result[CLA_ADC_NUMBER_OF_ROUTES];
+    uint16_t errorCount[CLA_ADC_NUMBER_OF_CHANNELS];
+    uint16_t harmonicConfigDone;        // harmonicConfigCount of the running tracking
+    uint16_t harmonicSamples;           // samples since the restart, up to CLA_HARMONIC_WINDOW
+    uint16_t harmonicAlarm;             // bit b: amplitude of bin b above its limit
+    uint16_t harmonicPhaseBin;          // bin whose phase is computed next
+    float harmonicAmplitude[CLA_HARMONIC_NUMBER_OF_BINS];      // ADC counts
+    float harmonicPhase[CLA_HARMONIC_NUMBER_OF_BINS];          // rad, -pi..pi
+} ClaAdcOutput;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Message RAMs
+extern ClaAdcInput claAdcInput;
+extern ClaAdcOutput claAdcOutput;
+// CLA data memory, written by ClaAdcInit()
+extern ClaAdcRoute claAdcRoute[CLA_ADC_NUMBER_OF_ROUTES];
+extern uint16_t claAdcGammaLut[CLA_ADC_LUT_SIZE];
+// CLA data memory, sliding DFT (reset by the CLA after every change of the configuration)
+extern ClaHarmonicState claHarmonicState[CLA_HARMONIC_NUMBER_OF_BINS];
+extern uint16_t claHarmonicHistory[CLA_HARMONIC_NUMBER_OF_CHANNELS][CLA_HARMONIC_WINDOW];
+extern uint16_t claHarmonicPosition;
+extern uint16_t claHarmonicDecimationCount;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA tasks (TB_CLA.cla)
+__interrupt void ClaAdcTask1(void);
+__interrupt void ClaAdcTask2(void);
+#ifndef __TMS320C28XX_CLA__
+// Function copies the CLA program, sets up the tables and starts the tasks with ADC-A INT1
+extern void ClaAdcInit(void);
+// Function hands over the route of the PWM_LEDs (as ADCtoPWM(): 0..31 or CLA_ADC_ROUTE_x)
+extern void ClaAdcSelect(uint16_t route);
+// Function starts the check of a channel against the limit
+extern void ClaAdcCheck(uint16_t channel, uint16_t limit);
+// Function clears the error counters
+extern void ClaAdcResetErrorCounts(void);
+// Function selects the route of a channel of the harmonic tracking
+extern bool ClaHarmonicSetChannel(uint16_t channel, uint16_t route);
+// Function sets the channel, the frequency bin k and the alarm limit of a tracked bin
+extern bool ClaHarmonicSetBin(uint16_t bin, uint16_t channel, uint16_t k, float limit);
+// Function sets the number of frames per sample of the harmonic tracking
+extern bool ClaHarmonicSetDecimation(uint16_t decimation);
+#endif
+
+#endif
@@ -0,0 +1,406 @@
+//=================================================================================================
+/// @file     TB_CLB.c
+///
+/// @brief    File contains the monitor of the hardware error detection reset lines with CLB1 and
+///           CLB2. The tiles are configured directly with the register values of the tile logic
+///           (no CLB tool), the signal numbers below follow the tables "CLB tile signals" and
+///           "Global Signals and Mux Selection" of the Reference Manual TMS320F2838x, SPRUII0D.
+///           See TB_CLB.h for the function of the tiles
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_CLB.h"
+#include "TB_Trace.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Signals inside a tile (selection of counter, LUT, FSM and HLC event inputs)
+#define CLB_SIGNAL_C0_MATCH1        1
+#define CLB_SIGNAL_C1_MATCH1        4
+#define CLB_SIGNAL_IN0              24      // BOUNDARY.in0 ... in7 = 24 ... 31
+// Boundary inputs of a tile
+#define CLB_IN_LINE0                0       // edges of the first line (AUXSIG)
+#define CLB_IN_LINE1                1       // edges of the second line (AUXSIG)
+#define CLB_IN_PWM_ZERO             2       // ePWM1 CTR=ZERO
+#define CLB_IN_CLEAR                6       // GP register bit, clears the edge counters
+#define CLB_IN_ONE                  7       // GP register bit, always 1
+// Global mux: ePWM1 CTR=ZERO and AUXSIG0 of the CLB X-BAR (AUXSIGn = 64 + n)
+#define CLB_GLOBAL_EPWM1_CTR_ZERO   4
+#define CLB_GLOBAL_AUXSIG0          64
+// Input filter: detection of both edges (one pulse of the tile clock per edge)
+#define CLB_FILTER_ANY_EDGE         3
+// Addresses of the load interface (CLB_LOAD_ADDR)
+#define CLB_ADDR_COUNTER_0_MATCH1   0x04
+#define CLB_ADDR_COUNTER_1_MATCH1   0x05
+#define CLB_ADDR_HLC_R0             0x0C
+#define CLB_ADDR_HLC_R1             0x0D
+#define CLB_ADDR_HLC_BASE           0x20    // 8 instructions per HLC program
+// HLC instructions: stop bit, opcode, source, destination (INTR: tag instead of the operands)
+#define CLB_HLC_MOV                 0x00
+#define CLB_HLC_INTR                0x07
+#define CLB_HLC_R0                  0x0
+#define CLB_HLC_R1                  0x1
+#define CLB_HLC_C2                  0x6
+#define CLB_HLC_STOP                (1UL << 11)
+#define CLB_HLC_INSTRUCTION(opcode, source, destination) \
+    (CLB_HLC_STOP | ((uint32_t)(opcode) << 6) | ((uint32_t)(source) << 3) | (destination))
+// Each counter, LUT input or HLC event has a 5 bit selection field
+#define CLB_SELECT(index, signal)   ((uint32_t)(signal) << (5 * (index)))
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the analog check of the sequencer, runs from LSx RAM like the ISR (see TB_Sequencer.c)
+#pragma CODE_SECTION(ClbArm, ".TI.ramfunc");
+#pragma CODE_SECTION(ClbCheck, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// CLB1: GPIO98, GPIO10 / CLB2: GPIO11, GPIO97 (order of Hardware_Error_Detection_Check())
+const ClbTileConfig clbTileTable[CLB_NUMBER_OF_TILES] =
+{
+    // cfgRegs           ctrlRegs            pin
+    {&Clb1LogicCfgRegs,  &Clb1LogicCtrlRegs, {98, 10}},
+    {&Clb2LogicCfgRegs,  &Clb2LogicCtrlRegs, {11, 97}}
+};
+volatile uint16_t clbAlarmCount[CLB_NUMBER_OF_LINES];
+volatile uint32_t clbAlarmTimestamp[CLB_NUMBER_OF_LINES];
+bool clbCheckPassed = false;
+// Input X-BAR outputs INPUT1 to INPUT4 of the lines
+volatile uint16_t *const clbXbarSelect[CLB_NUMBER_OF_LINES] =
+{
+    &InputXbarRegs.INPUT1SELECT,
+    &InputXbarRegs.INPUT2SELECT,
+    &InputXbarRegs.INPUT3SELECT,
+    &InputXbarRegs.INPUT4SELECT
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClbWriteInterface =================================================================
+///
+/// @brief  Function writes a value into a counter match register, an HLC register or an HLC
+///         instruction of a tile through the load interface. EALLOW must be set
+///
+/// @param  volatile struct CLB_LOGIC_CONTROL_REGS *regs, uint16_t address, uint32_t value
+///
+/// @return void
+///
+//=================================================================================================
+static void ClbWriteInterface(volatile struct CLB_LOGIC_CONTROL_REGS *regs, uint16_t address,
+                              uint32_t value)
+{
+    regs->CLB_LOAD_ADDR.all = address;
+    regs->CLB_LOAD_DATA = value;
+    regs->CLB_LOAD_EN.bit.LOAD_EN = 1;
+}
+
+//=== Function: ClbInitGlitchFilter ===============================================================
+///
+/// @brief  Function sets the input qualification of the reset lines to 6 samples with the
+///         sampling period CLB_QUALIFICATION_PERIOD. Only the input path of the pins is changed,
+///         the lines stay outputs of the error detection check. EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClbInitGlitchFilter(void)
+{
+    // GPIO8 to GPIO15 and GPIO96 to GPIO103 share one sampling period
+    GpioCtrlRegs.GPACTRL.bit.QUALPRD1 = CLB_QUALIFICATION_PERIOD;
+    GpioCtrlRegs.GPDCTRL.bit.QUALPRD0 = CLB_QUALIFICATION_PERIOD;
+    // 0: synchronous to SYSCLK, 1: 3 samples, 2: 6 samples, 3: asynchronous
+    GpioCtrlRegs.GPAQSEL1.bit.GPIO10 = 2;
+    GpioCtrlRegs.GPAQSEL1.bit.GPIO11 = 2;
+    GpioCtrlRegs.GPDQSEL1.bit.GPIO97 = 2;
+    GpioCtrlRegs.GPDQSEL1.bit.GPIO98 = 2;
+}
+
+//=== Function: ClbInitXbar =======================================================================
+///
+/// @brief  Function connects line n to INPUT(CLB_FIRST_XBAR_INPUT + n) of the input X-BAR and
+///         this input to AUXSIGn of the CLB X-BAR (MUX1, MUX3, MUX5, MUX7 = INPUT1 to INPUT4).
+///         EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClbInitXbar(void)
+{
+    for (uint16_t tile = 0; tile < CLB_NUMBER_OF_TILES; tile++)
+        for (uint16_t i = 0; i < CLB_LINES_PER_TILE; i++)
+            *clbXbarSelect[tile * CLB_LINES_PER_TILE + i] = clbTileTable[tile].pin[i];
+
+    CLBXbarRegs.AUXSIG0MUX0TO15CFG.bit.MUX1 = 1;
+    CLBXbarRegs.AUXSIG0MUXENABLE.bit.MUX1 = 1;
+    CLBXbarRegs.AUXSIG1MUX0TO15CFG.bit.MUX3 = 1;
+    CLBXbarRegs.AUXSIG1MUXENABLE.bit.MUX3 = 1;
+    CLBXbarRegs.AUXSIG2MUX0TO15CFG.bit.MUX5 = 1;
+    CLBXbarRegs.AUXSIG2MUXENABLE.bit.MUX5 = 1;
+    CLBXbarRegs.AUXSIG3MUX0TO15CFG.bit.MUX7 = 1;
+    CLBXbarRegs.AUXSIG3MUXENABLE.bit.MUX7 = 1;
+    CLBXbarRegs.AUXSIGOUTINV.all = 0;
+}
+
+//=== Function: ClbInitTile =======================================================================
+///
+/// @brief  Function configures the inputs and the logic of one tile:
+///         in0/in1: edges of the lines, in2: ePWM1 CTR=ZERO, in6: clear, in7: always 1
+///         COUNTER_0/1: +1 per edge of in0/in1, reset by in6, match1 = limit of the edges
+///         COUNTER_2:   +1 per CLB clock, reset by in2 (position in the ePWM1 period)
+///         HLC event 0/1 (edge of in0/in1): MOV C2,R0 / MOV C2,R1 (timestamp of the edge)
+///         HLC event 2/3 (limit of COUNTER_0/1): INTR 1 / INTR 2
+///         EALLOW must be set
+///
+/// @param  uint16_t tile
+///
+/// @return void
+///
+//=================================================================================================
+static void ClbInitTile(uint16_t tile)
+{
+    volatile struct CLB_LOGIC_CONFIG_REGS *cfg = clbTileTable[tile].cfgRegs;
+    volatile struct CLB_LOGIC_CONTROL_REGS *ctrl = clbTileTable[tile].ctrlRegs;
+    uint16_t auxsig = CLB_GLOBAL_AUXSIG0 + tile * CLB_LINES_PER_TILE;
+
+    ctrl->CLB_LOAD_EN.bit.GLOBAL_EN = 0;
+
+    // Inputs: in0..in2 from the global mux, in6/in7 from the GP register
+    ctrl->CLB_GLBL_MUX_SEL_1.bit.GLBL_MUX_SEL_IN_0 = auxsig;
+    ctrl->CLB_GLBL_MUX_SEL_1.bit.GLBL_MUX_SEL_IN_1 = auxsig + 1;
+    ctrl->CLB_GLBL_MUX_SEL_1.bit.GLBL_MUX_SEL_IN_2 = CLB_GLOBAL_EPWM1_CTR_ZERO;
+    ctrl->CLB_LCL_MUX_SEL_1.all = 0;        // 0: global input
+    ctrl->CLB_LCL_MUX_SEL_2.all = 0;
+    ctrl->CLB_IN_MUX_SEL_0.all = (1U << CLB_IN_CLEAR) | (1U << CLB_IN_ONE);
+    ctrl->CLB_GP_REG.all = 1U << CLB_IN_ONE;
+    // The X-BAR signals are asynchronous to the tile clock
+    ctrl->CLB_INPUT_FILTER.all = 0;
+    ctrl->CLB_INPUT_FILTER.bit.SYNC0 = 1;
+    ctrl->CLB_INPUT_FILTER.bit.SYNC1 = 1;
+    ctrl->CLB_INPUT_FILTER.bit.FIN0 = CLB_FILTER_ANY_EDGE;
+    ctrl->CLB_INPUT_FILTER.bit.FIN1 = CLB_FILTER_ANY_EDGE;
+    // The tile drives no peripheral signal
+    ctrl->CLB_OUT_EN = 0;
+
+    // Counters
+    cfg->CLB_COUNT_RESET.all = CLB_SELECT(0, CLB_SIGNAL_IN0 + CLB_IN_CLEAR)
+                             | CLB_SELECT(1, CLB_SIGNAL_IN0 + CLB_IN_CLEAR)
+                             | CLB_SELECT(2, CLB_SIGNAL_IN0 + CLB_IN_PWM_ZERO);
+    cfg->CLB_COUNT_MODE_0.all = CLB_SELECT(0, CLB_SIGNAL_IN0 + CLB_IN_LINE0)
+                              | CLB_SELECT(1, CLB_SIGNAL_IN0 + CLB_IN_LINE1)
+                              | CLB_SELECT(2, CLB_SIGNAL_IN0 + CLB_IN_ONE);
+    cfg->CLB_COUNT_MODE_1.all = CLB_SELECT(0, CLB_SIGNAL_IN0 + CLB_IN_ONE)
+                              | CLB_SELECT(1, CLB_SIGNAL_IN0 + CLB_IN_ONE)
+                              | CLB_SELECT(2, CLB_SIGNAL_IN0 + CLB_IN_ONE);
+    cfg->CLB_COUNT_EVENT.all = 0;
+    cfg->CLB_MISC_CONTROL.all = 0;
+    ClbWriteInterface(ctrl, CLB_ADDR_COUNTER_0_MATCH1, 1);
+    ClbWriteInterface(ctrl, CLB_ADDR_COUNTER_1_MATCH1, 1);
+
+    // HLC
+    cfg->CLB_HLC_EVENT_SEL.all = CLB_SELECT(0, CLB_SIGNAL_IN0 + CLB_IN_LINE0)
+                               | CLB_SELECT(1, CLB_SIGNAL_IN0 + CLB_IN_LINE1)
+                               | CLB_SELECT(2, CLB_SIGNAL_C0_MATCH1)
+                               | CLB_SELECT(3, CLB_SIGNAL_C1_MATCH1);
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_R0, 0);
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_R1, 0);
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_BASE + 0 * 8,
+                      CLB_HLC_INSTRUCTION(CLB_HLC_MOV, CLB_HLC_C2, CLB_HLC_R0));
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_BASE + 1 * 8,
+                      CLB_HLC_INSTRUCTION(CLB_HLC_MOV, CLB_HLC_C2, CLB_HLC_R1));
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_BASE + 2 * 8, CLB_HLC_INSTRUCTION(CLB_HLC_INTR, 0, 1));
+    ClbWriteInterface(ctrl, CLB_ADDR_HLC_BASE + 3 * 8, CLB_HLC_INSTRUCTION(CLB_HLC_INTR, 0, 2));
+    ctrl->CLB_INTR_TAG_REG.all = 0;
+
+    ctrl->CLB_LOAD_EN.bit.GLOBAL_EN = 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClbInit ===========================================================================
+///
+/// @brief  Function switches on CLB1 and CLB2 (synchronous to SYSCLK, clocked by EPWMCLK),
+///         configures the glitch filter of the reset lines, the X-BARs and both tiles and
+///         enables the CLB1/CLB2 interrupts (PIE group 5.5, 5.6). The monitor is armed with
+///         zero expected pulses. Must be called after GpioInit_Hardware_Error_Detection() and
+///         PwmInitAll()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClbInit(void)
+{
+    for (uint16_t i = 0; i < CLB_NUMBER_OF_LINES; i++)
+    {
+        clbAlarmCount[i] = 0;
+        clbAlarmTimestamp[i] = 0;
+    }
+    clbCheckPassed = false;
+
+    EALLOW;
+
+    for (uint16_t tile = 0; tile < CLB_NUMBER_OF_TILES; tile++)
+        ClockRequest(CLOCK_CLB1 + tile);
+    ClkCfgRegs.CLBCLKCTL.bit.CLKMODECLB1 = 0;
+    ClkCfgRegs.CLBCLKCTL.bit.CLKMODECLB2 = 0;
+
+    ClbInitGlitchFilter();
+    ClbInitXbar();
+    for (uint16_t tile = 0; tile < CLB_NUMBER_OF_TILES; tile++)
+        ClbInitTile(tile);
+
+    PieVectTable.CLB1_INT = &ClbErrorLineISR;
+    PieVectTable.CLB2_INT = &ClbErrorLineISR;
+    PieCtrlRegs.PIEIER5.bit.INTx5 = 1;
+    PieCtrlRegs.PIEIER5.bit.INTx6 = 1;
+    IER |= M_INT5;
+
+    ClbArm(0);
+
+    EDIS;
+}
+
+//=== Function: ClbArm ============================================================================
+///
+/// @brief  Function sets the limit of the edge counters to one edge more than "expectedPulses"
+///         pulses and clears the counters (pulse on in6). Every further edge raises the CLB
+///         interrupt. With 0 every edge of an idle line is reported. EALLOW must be set (as in
+///         the steps of the sequencer)
+///
+/// @param  uint16_t expectedPulses
+///
+/// @return void
+///
+//=================================================================================================
+void ClbArm(uint16_t expectedPulses)
+{
+    uint32_t limit = (uint32_t)expectedPulses * CLB_EDGES_PER_PULSE + 1;
+
+    for (uint16_t tile = 0; tile < CLB_NUMBER_OF_TILES; tile++)
+    {
+        volatile struct CLB_LOGIC_CONTROL_REGS *ctrl = clbTileTable[tile].ctrlRegs;
+
+        ClbWriteInterface(ctrl, CLB_ADDR_COUNTER_0_MATCH1, limit);
+        ClbWriteInterface(ctrl, CLB_ADDR_COUNTER_1_MATCH1, limit);
+        ctrl->CLB_GP_REG.all = (1U << CLB_IN_ONE) | (1U << CLB_IN_CLEAR);
+        ctrl->CLB_GP_REG.all = 1U << CLB_IN_ONE;
+    }
+}
+
+//=== Function: ClbGetEdges =======================================================================
+///
+/// @brief  Function returns the edge counter of a line
+///
+/// @param  uint16_t line
+///
+/// @return uint32_t edges (0 for an invalid line)
+///
+//=================================================================================================
+uint32_t ClbGetEdges(uint16_t line)
+{
+    volatile struct CLB_LOGIC_CONTROL_REGS *ctrl;
+
+    if (line >= CLB_NUMBER_OF_LINES)
+        return 0;
+
+    ctrl = clbTileTable[line / CLB_LINES_PER_TILE].ctrlRegs;
+    return (line % CLB_LINES_PER_TILE) ? ctrl->CLB_DBG_C1 : ctrl->CLB_DBG_C0;
+}
+
+//=== Function: ClbGetTimestamp ===================================================================
+///
+/// @brief  Function returns the position of the last edge of a line in the ePWM1 period in
+///         CLB clocks (HLC register R0/R1 of the tile)
+///
+/// @param  uint16_t line
+///
+/// @return uint32_t timestamp (0 for an invalid line)
+///
+//=================================================================================================
+uint32_t ClbGetTimestamp(uint16_t line)
+{
+    volatile struct CLB_LOGIC_CONTROL_REGS *ctrl;
+
+    if (line >= CLB_NUMBER_OF_LINES)
+        return 0;
+
+    ctrl = clbTileTable[line / CLB_LINES_PER_TILE].ctrlRegs;
+    return (line % CLB_LINES_PER_TILE) ? ctrl->CLB_DBG_R1 : ctrl->CLB_DBG_R0;
+}
+
+//=== Function: ClbCheck ==========================================================================
+///
+/// @brief  Function compares the edges of every line since the last ClbArm() with
+///         "expectedPulses" pulses and stores the result in clbCheckPassed
+///
+/// @param  uint16_t expectedPulses
+///
+/// @return bool passed (false: missing or additional edges on at least one line)
+///
+//=================================================================================================
+bool ClbCheck(uint16_t expectedPulses)
+{
+    uint32_t expected = (uint32_t)expectedPulses * CLB_EDGES_PER_PULSE;
+    bool passed = true;
+
+    for (uint16_t line = 0; line < CLB_NUMBER_OF_LINES; line++)
+    {
+        if (ClbGetEdges(line) != expected)
+            passed = false;
+    }
+
+    clbCheckPassed = passed;
+    return passed;
+}
+
+//=== Function: ClbErrorLineISR ===================================================================
+///
+/// @brief  ISR is called by the HLC of a tile when an edge counter reaches its limit. The tag
+///         (1: first line, 2: second line of the tile) selects the line, the alarm is counted
+///         with the timestamp of the last edge. The counter keeps counting, so the alarm is
+///         raised once per ClbArm()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void ClbErrorLineISR(void)
+{
+    for (uint16_t tile = 0; tile < CLB_NUMBER_OF_TILES; tile++)
+    {
+        volatile struct CLB_LOGIC_CONTROL_REGS *ctrl = clbTileTable[tile].ctrlRegs;
+        uint16_t tag = ctrl->CLB_INTR_TAG_REG.bit.TAG;
+
+        if (tag >= 1 && tag <= CLB_LINES_PER_TILE)
+        {
+            uint16_t line = tile * CLB_LINES_PER_TILE + tag - 1;
+
+            clbAlarmCount[line]++;
+            TRACE(TRACE_CONTEXT_CLB, TRACE_EVENT_CLB_ALARM, line);
+            clbAlarmTimestamp[line] = ClbGetTimestamp(line);
+        }
+        EALLOW;
+        ctrl->CLB_INTR_TAG_REG.all = 0;
+        EDIS;
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP5;
+}
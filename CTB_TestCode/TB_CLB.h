@@ -0,0 +1,89 @@
+//=================================================================================================
+/// @file     TB_CLB.h
+///
+/// @brief    File contains a monitor of the reset lines of the hardware error detection (GPIO98,
+///           GPIO10, GPIO11, GPIO97) built from two CLB tiles. The input qualification of the
+///           GPIOs filters glitches, the input X-BAR and the CLB X-BAR bring the filtered input
+///           path of the pins to the tiles. Each tile serves two lines:
+///           - COUNTER_0/COUNTER_1 count every edge of their line (edge detection of the input
+///             filter, one count per edge)
+///           - COUNTER_2 counts the CLB clock since the last ePWM1 CTR=ZERO (position in the PWM
+///             period), the HLC copies it into R0/R1 on every edge of the line, so the last edge
+///             of every line carries a timestamp against the PWM time base
+///           - the HLC raises the CLB interrupt when an edge counter reaches its limit
+///           The CPU does nothing per edge: ClbArm() sets the number of expected pulses before
+///           a check, ClbCheck() compares the counters afterwards and ClbErrorLineISR() only runs
+///           on an abnormal pattern (more edges than expected). Between the checks the monitor
+///           is armed with zero pulses, so every edge on an idle line is reported
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYCLB_H_
+#define MYCLB_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Clock.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of used tiles (CLB1, CLB2) and monitored lines (two per tile)
+#define CLB_NUMBER_OF_TILES         2
+#define CLB_LINES_PER_TILE          2
+#define CLB_NUMBER_OF_LINES         (CLB_NUMBER_OF_TILES * CLB_LINES_PER_TILE)
+// Input X-BAR output of line 0, line n uses INPUT(CLB_FIRST_XBAR_INPUT + n) and AUXSIGn
+#define CLB_FIRST_XBAR_INPUT        1
+// Glitch filter of the GPIOs: 6 samples every 2 * CLB_QUALIFICATION_PERIOD SYSCLK cycles,
+// pulses shorter than about 5 * 2 * 255 / 200 MHz = 12.75 us are suppressed
+#define CLB_QUALIFICATION_PERIOD    255
+// Edges of one pulse of the reset lines (falling and rising edge)
+#define CLB_EDGES_PER_PULSE         2
+// Clock of the tiles (EPWMCLK), unit of the timestamps
+#define CLB_CLOCK_HZ                (DEVICE_SYSCLK_MHZ * 1000000.0f / 2.0f)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Configuration of one tile
+typedef struct
+{
+    volatile struct CLB_LOGIC_CONFIG_REGS *cfgRegs;
+    volatile struct CLB_LOGIC_CONTROL_REGS *ctrlRegs;
+    uint16_t pin[CLB_LINES_PER_TILE];       // GPIO of the monitored lines (input path of the pin)
+} ClbTileConfig;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Monitored lines of all tiles
+extern const ClbTileConfig clbTileTable[CLB_NUMBER_OF_TILES];
+// Abnormal patterns of every line since ClbInit() (written by ClbErrorLineISR())
+extern volatile uint16_t clbAlarmCount[CLB_NUMBER_OF_LINES];
+// Position of the last edge in the ePWM1 period (CLB clocks) when the alarm was raised
+extern volatile uint32_t clbAlarmTimestamp[CLB_NUMBER_OF_LINES];
+// Result of the last ClbCheck()
+extern bool clbCheckPassed;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function configures the glitch filter, the X-BARs, both tiles and the CLB interrupts
+extern void ClbInit(void);
+// Function clears the edge counters and sets the number of expected pulses per line
+extern void ClbArm(uint16_t expectedPulses);
+// Function returns the number of edges of a line since the last ClbArm()
+extern uint32_t ClbGetEdges(uint16_t line);
+// Function returns the position of the last edge of a line in the ePWM1 period (CLB clocks)
+extern uint32_t ClbGetTimestamp(uint16_t line);
+// Function compares the edges of all lines with the expected pulses
+extern bool ClbCheck(uint16_t expectedPulses);
+// ISR of CLB1 and CLB2 (abnormal pattern of a line)
+extern __interrupt void ClbErrorLineISR(void);
+
+#endif
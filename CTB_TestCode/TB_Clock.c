@@ -0,0 +1,253 @@
+//=================================================================================================
+/// @file     TB_Clock.c
+///
+/// @brief    File contains the central clock gating of the peripherals. The bits follow the
+///           description of the PCLKCRx registers in the Reference Manual TMS320F2838x, SPRUII0D.
+///           See TB_Clock.h for the use of the references
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Clock.h"
+#include "TB_Functions.h"
+#include "TB_ECAP.h"
+#include "TB_CLA.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the drivers while the sequencer is running (e.g. DACWaveStart()), runs from LSx RAM
+#pragma CODE_SECTION(ClockRequest, ".TI.ramfunc");
+#pragma CODE_SECTION(ClockRelease, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Order of the CLOCK_x defines
+const ClockGate clockTable[CLOCK_NUMBER_OF_PERIPHERALS] =
+{
+    // reg              mask
+    {CLOCK_PCLKCR0,     1UL << 2},      // DMA
+    {CLOCK_PCLKCR0,     1UL << 16},     // HRCAL
+    {CLOCK_PCLKCR2,     1UL << 0},      // EPWM1
+    {CLOCK_PCLKCR2,     1UL << 1},
+    {CLOCK_PCLKCR2,     1UL << 2},
+    {CLOCK_PCLKCR2,     1UL << 3},
+    {CLOCK_PCLKCR2,     1UL << 4},
+    {CLOCK_PCLKCR2,     1UL << 5},
+    {CLOCK_PCLKCR2,     1UL << 6},
+    {CLOCK_PCLKCR2,     1UL << 7},
+    {CLOCK_PCLKCR2,     1UL << 8},
+    {CLOCK_PCLKCR2,     1UL << 9},
+    {CLOCK_PCLKCR2,     1UL << 10},
+    {CLOCK_PCLKCR2,     1UL << 11},
+    {CLOCK_PCLKCR2,     1UL << 12},
+    {CLOCK_PCLKCR2,     1UL << 13},
+    {CLOCK_PCLKCR2,     1UL << 14},
+    {CLOCK_PCLKCR2,     1UL << 15},     // EPWM16
+    {CLOCK_PCLKCR3,     1UL << 0},      // ECAP1
+    {CLOCK_PCLKCR3,     1UL << 1},
+    {CLOCK_PCLKCR3,     1UL << 2},
+    {CLOCK_PCLKCR3,     1UL << 3},
+    {CLOCK_PCLKCR3,     1UL << 4},
+    {CLOCK_PCLKCR3,     1UL << 5},
+    {CLOCK_PCLKCR3,     1UL << 6},      // ECAP7
+    {CLOCK_PCLKCR13,    1UL << 0},      // ADC_A
+    {CLOCK_PCLKCR13,    1UL << 1},
+    {CLOCK_PCLKCR13,    1UL << 2},
+    {CLOCK_PCLKCR13,    1UL << 3},      // ADC_D
+    {CLOCK_PCLKCR16,    1UL << 16},     // DAC_A
+    {CLOCK_PCLKCR16,    1UL << 17},
+    {CLOCK_PCLKCR16,    1UL << 18},     // DAC_C
+    {CLOCK_PCLKCR17,    1UL << 0},      // CLB1
+    {CLOCK_PCLKCR17,    1UL << 1},      // CLB2
+    {CLOCK_PCLKCR21,    1UL << 0},      // DCC0
+    {CLOCK_PCLKCR0,     1UL << 0},      // CLA1
+    {CLOCK_PCLKCR7,     1UL << 0}       // SCI_A
+};
+uint16_t clockReferences[CLOCK_NUMBER_OF_PERIPHERALS];
+uint16_t clockUnused[CLOCK_NUMBER_OF_PERIPHERALS];
+uint16_t clockNumberOfUnused = 0;
+// Order of the CLOCK_PCLKCRx defines
+static volatile uint32_t *const clockRegisters[CLOCK_NUMBER_OF_REGISTERS] =
+{
+    &CpuSysRegs.PCLKCR0.all,
+    &CpuSysRegs.PCLKCR2.all,
+    &CpuSysRegs.PCLKCR3.all,
+    &CpuSysRegs.PCLKCR13.all,
+    &CpuSysRegs.PCLKCR16.all,
+    &CpuSysRegs.PCLKCR17.all,
+    &CpuSysRegs.PCLKCR21.all,
+    &CpuSysRegs.PCLKCR7.all
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClockIsUsed =======================================================================
+///
+/// @brief  Function returns whether the configuration of this program uses the peripheral, i.e.
+///         its clock is switched on by ClockInit()
+///
+/// @param  uint16_t peripheral (CLOCK_x)
+///
+/// @return bool used
+///
+//=================================================================================================
+static bool ClockIsUsed(uint16_t peripheral)
+{
+    if (peripheral == CLOCK_DMA)
+    {
+        if (ADC_CAPTURE_DMA)
+            return true;
+        for (uint16_t i = 0; i < ECAP_NUMBER_OF_CHANNELS; i++)
+        {
+            if (ecapConfigTable[i].readout == ECAP_READ_DMA)
+                return true;
+        }
+        return false;
+    }
+
+    if (peripheral == CLOCK_HRCAL)
+        return PWM_HRPWM;
+
+    if (peripheral >= CLOCK_EPWM1 && peripheral < CLOCK_EPWM1 + CLOCK_NUMBER_OF_EPWM)
+    {
+        for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+        {
+            if (CLOCK_EPWM(pwmConfigTable[m].module) == peripheral)
+                return true;
+        }
+        return false;
+    }
+
+    if (peripheral >= CLOCK_ECAP1 && peripheral < CLOCK_ECAP1 + CLOCK_NUMBER_OF_ECAP)
+    {
+        // eCAP7 measures the detection latency of the error lines (TB_Trip)
+        if (peripheral == CLOCK_ECAP(TRIP_LATENCY_ECAP))
+            return true;
+        for (uint16_t i = 0; i < ECAP_NUMBER_OF_CHANNELS; i++)
+        {
+            if (CLOCK_ECAP(ecapConfigTable[i].module) == peripheral)
+                return true;
+        }
+        return false;
+    }
+
+    if (peripheral == CLOCK_CLA1)
+        return CLA_ADC_ENABLE;
+
+    if (peripheral == CLOCK_SCIA)
+        return UART_ENABLE;
+
+    // ADC A to D, DAC A to C and CLB1, CLB2 are all used, DCC0 only by DeviceInit()
+    return peripheral != CLOCK_DCC0;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClockInit =========================================================================
+///
+/// @brief  Function clears all references and switches on the clocks of the peripherals used
+///         by the configuration tables and off the clocks of all other managed peripherals.
+///         Every PCLKCRx register is written once, the bits which are not managed keep their
+///         value. Afterwards the 5 clocks until the modules can be accessed are waited once.
+///         Must be called directly after DeviceInit()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClockInit(void)
+{
+    uint32_t managed[CLOCK_NUMBER_OF_REGISTERS] = {0};
+    uint32_t used[CLOCK_NUMBER_OF_REGISTERS] = {0};
+
+    for (uint16_t i = 0; i < CLOCK_NUMBER_OF_PERIPHERALS; i++)
+    {
+        clockReferences[i] = 0;
+        managed[clockTable[i].reg] |= clockTable[i].mask;
+        if (ClockIsUsed(i))
+            used[clockTable[i].reg] |= clockTable[i].mask;
+    }
+
+    EALLOW;
+    for (uint16_t r = 0; r < CLOCK_NUMBER_OF_REGISTERS; r++)
+        *clockRegisters[r] = (*clockRegisters[r] & ~managed[r]) | used[r];
+    __asm(" RPT #4 || NOP");
+    EDIS;
+}
+
+//=== Function: ClockRequest ======================================================================
+///
+/// @brief  Function takes a reference of the peripheral. If its clock is off at the first
+///         reference, it is switched on and 5 clocks are waited. EALLOW must be set
+///
+/// @param  uint16_t peripheral (CLOCK_x)
+///
+/// @return void
+///
+//=================================================================================================
+void ClockRequest(uint16_t peripheral)
+{
+    const ClockGate *gate = &clockTable[peripheral];
+
+    if (clockReferences[peripheral]++ == 0 && (*clockRegisters[gate->reg] & gate->mask) == 0)
+    {
+        *clockRegisters[gate->reg] |= gate->mask;
+        __asm(" RPT #4 || NOP");
+    }
+}
+
+//=== Function: ClockRelease ======================================================================
+///
+/// @brief  Function returns a reference of the peripheral and switches off its clock with the
+///         last reference. A release without reference is ignored. EALLOW must be set
+///
+/// @param  uint16_t peripheral (CLOCK_x)
+///
+/// @return void
+///
+//=================================================================================================
+void ClockRelease(uint16_t peripheral)
+{
+    const ClockGate *gate = &clockTable[peripheral];
+
+    if (clockReferences[peripheral] == 0)
+        return;
+
+    if (--clockReferences[peripheral] == 0)
+        *clockRegisters[gate->reg] &= ~gate->mask;
+}
+
+//=== Function: ClockReport =======================================================================
+///
+/// @brief  Function lists all managed peripherals whose clock is running without a reference
+///         in clockUnused (e.g. a module switched on by ClockInit() which no driver requested).
+///         Called after the initialisation of all drivers
+///
+/// @param  void
+///
+/// @return uint16_t number of unused peripherals (0: every running clock is used)
+///
+//=================================================================================================
+uint16_t ClockReport(void)
+{
+    clockNumberOfUnused = 0;
+
+    for (uint16_t i = 0; i < CLOCK_NUMBER_OF_PERIPHERALS; i++)
+    {
+        if (clockReferences[i] == 0 && (*clockRegisters[clockTable[i].reg] & clockTable[i].mask))
+            clockUnused[clockNumberOfUnused++] = i;
+    }
+    return clockNumberOfUnused;
+}
@@ -0,0 +1,106 @@
+//=================================================================================================
+/// @file     TB_Clock.h
+///
+/// @brief    File contains the central clock gating of the peripherals (PCLKCRx registers).
+///           Every managed peripheral has an entry in clockTable (register and bit) and a
+///           reference counter. ClockInit() switches on the clocks of all peripherals which are
+///           used by the configuration tables (pwmConfigTable, ecapConfigTable, ADC, DAC, CLB,
+///           DMA, CLA, SCI-A) and switches off all other managed clocks (e.g. DCC0 after the PLL check of
+///           DeviceInit()). All registers are written in one sequence with a single wait of
+///           5 clocks afterwards.
+///
+///           Every driver takes a reference with ClockRequest() before it accesses its module
+///           and returns it with ClockRelease() when the module is no longer used. The register
+///           is only written if the clock is off at the first request or the last reference is
+///           released, so the requests of the drivers cost no wait after ClockInit().
+///           ClockReport() lists the peripherals whose clock runs without a reference.
+///           The CPU timers and the synchronisation bits of PCLKCR0 (TBCLKSYNC, GTBCLKSYNC) are
+///           not managed
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYCLOCK_H_
+#define MYCLOCK_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Managed peripherals (index of clockTable), modules with a number are consecutive
+#define CLOCK_DMA                   0
+#define CLOCK_HRCAL                 1
+#define CLOCK_EPWM1                 2       // ePWMn: CLOCK_EPWM1 + n - 1 (ePWM1 to ePWM16)
+#define CLOCK_ECAP1                 18      // eCAPn: CLOCK_ECAP1 + n - 1 (eCAP1 to eCAP7)
+#define CLOCK_ADC_A                 25      // ADC A to D: CLOCK_ADC_A + module
+#define CLOCK_DAC_A                 29      // DAC A to C: CLOCK_DAC_A + module
+#define CLOCK_CLB1                  32      // CLBn: CLOCK_CLB1 + n - 1 (CLB1, CLB2)
+#define CLOCK_DCC0                  34
+#define CLOCK_CLA1                  35
+#define CLOCK_SCIA                  36
+#define CLOCK_NUMBER_OF_PERIPHERALS 37
+// Used PCLKCRx registers (index of clockRegisters)
+#define CLOCK_PCLKCR0               0
+#define CLOCK_PCLKCR2               1
+#define CLOCK_PCLKCR3               2
+#define CLOCK_PCLKCR13              3
+#define CLOCK_PCLKCR16              4
+#define CLOCK_PCLKCR17              5
+#define CLOCK_PCLKCR21              6
+#define CLOCK_PCLKCR7               7
+#define CLOCK_NUMBER_OF_REGISTERS   8
+// Number of ePWM, eCAP, ADC, DAC and CLB modules in clockTable
+#define CLOCK_NUMBER_OF_EPWM        16
+#define CLOCK_NUMBER_OF_ECAP        7
+#define CLOCK_NUMBER_OF_ADC         4
+#define CLOCK_NUMBER_OF_DAC         3
+#define CLOCK_NUMBER_OF_CLB         2
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Peripheral of a numbered module (n = 1 .. number of modules)
+#define CLOCK_EPWM(n)               (CLOCK_EPWM1 + (n) - 1)
+#define CLOCK_ECAP(n)               (CLOCK_ECAP1 + (n) - 1)
+#define CLOCK_CLB(n)                (CLOCK_CLB1 + (n) - 1)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Clock gate of one peripheral
+typedef struct
+{
+    uint16_t reg;                       // CLOCK_PCLKCRx (index of clockRegisters)
+    uint32_t mask;                      // bit of the peripheral in PCLKCRx
+} ClockGate;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Register and bit of all managed peripherals
+extern const ClockGate clockTable[CLOCK_NUMBER_OF_PERIPHERALS];
+// References of every peripheral (ClockRequest() - ClockRelease())
+extern uint16_t clockReferences[CLOCK_NUMBER_OF_PERIPHERALS];
+// Peripherals with running clock and without reference (set by ClockReport())
+extern uint16_t clockUnused[CLOCK_NUMBER_OF_PERIPHERALS];
+extern uint16_t clockNumberOfUnused;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function switches the clocks of all managed peripherals on or off in one sequence
+extern void ClockInit(void);
+// Function takes a reference and switches on the clock of the peripheral if it is off
+extern void ClockRequest(uint16_t peripheral);
+// Function returns a reference and switches off the clock with the last one
+extern void ClockRelease(uint16_t peripheral);
+// Function lists the peripherals with running clock and without reference
+extern uint16_t ClockReport(void);
+
+#endif
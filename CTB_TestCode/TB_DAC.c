@@ -3,6 +3,10 @@
 ///
 /// @brief      file contains variables and functions to use the internal digital-analogue converter
 ///             of the TMS320F2838x. The code configures all DACs i.e DACOUTA, DACOUTB, DACOUTC
+///             The waveform generator outputs a sample table on all three DACs: on every n-th
+///             ePWM1 period the SOCB triggers DMA CH5, which copies one sample (A, B, C) into the
+///             DACVALS registers. The DACs load DACVALS with the ePWM1 SYNCPER, so all three
+///             outputs change at the same time without the CPU.
 ///
 /// @version    V1.1.0
 ///
@@ -14,57 +18,243 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_DAC.h"
+#include "TB_DMA.h"
+#include "TB_LedFade.h"
+#include <math.h>
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Time of the power up of the DAC modules (DeviceGetTime()), valid if "dacPoweredUp" is true
+uint32_t dacPowerUpTime = 0;
+bool dacPoweredUp = false;
+// Sample table (the DMA can not access the LSx RAM, therefore GSx RAM is used)
+#pragma DATA_SECTION(dacWaveTable, "ramgs6");
+uint16_t dacWaveTable[DAC_WAVE_MAX_SAMPLES][DAC_WAVE_NUMBER_OF_DACS];
+bool dacWaveRunning = false;
 
 
 //-------------------------------------------------------------------------------------------------
 // Global functions
 //-------------------------------------------------------------------------------------------------
-//=== Function: DACInitAll ==========================================================================
+//=== Function: DACPowerUpAll ======================================================================
 ///
-/// @brief Function initialises the DAC-A,B,C modules
+/// @brief Function configures the DAC-A,B,C modules and switches on their outputs without waiting.
+///        The settling time of all three outputs runs from here, DACInitAll() only waits for the
+///        rest of it
 ///
 /// @param void
 ///
 /// @return void
 ///
 //=================================================================================================
-void DACInitAll(void)
+void DACPowerUpAll(void)
 {
 
     EALLOW; // Cancel register write protection
 
-    CpuSysRegs.PCLKCR16.bit.DAC_A = 1;    // Switch on the clock for the DAC module and wait 5 clocks
-    __asm(" RPT #4 || NOP");
+    ClockRequest(CLOCK_DAC_A);       // Clock of the DAC module (switched on by ClockInit())
     DacaRegs.DACCTL.bit.DACREFSEL = DAC_REF_VREFHI;   // ADC VREFHI/VSSA are the reference voltage
     DacaRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;   // Synchronise DAC value via SYSCLK
     DacaRegs.DACCTL.bit.SYNCSEL = DAC_EPWM1SYNCPER;   // ePWM1 loads the value from the DACVALS register into the DACVALA register
     DacaRegs.DACOUTEN.bit.DACOUTEN = DAC_ENABLE_OUTPUT;   // Switch on the output of the DAC - output at pin DACOUTA (ADCINA0)
     DacaRegs.DACVALS.bit.DACVALS = 4000;
-    DELAY_US(500);
 
-    CpuSysRegs.PCLKCR16.bit.DAC_B = 1;    // Switch on the clock for the DAC module and wait 5 clocks
-    __asm(" RPT #4 || NOP");
+    ClockRequest(CLOCK_DAC_A + 1);   // Clock of the DAC module (switched on by ClockInit())
     DacbRegs.DACCTL.bit.DACREFSEL = DAC_REF_VREFHI;   // ADC VREFHI/VSSA are the reference voltage
     DacbRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;   // Synchronise DAC value via SYSCLK
     DacbRegs.DACCTL.bit.SYNCSEL = DAC_EPWM1SYNCPER;   // ePWM1 loads the value from the DACVALS register into the DACVALA register
     DacbRegs.DACOUTEN.bit.DACOUTEN = DAC_ENABLE_OUTPUT;   // Switch on the output of the DAC - output at pin DACOUTB (ADCINA1)
     DacbRegs.DACVALS.bit.DACVALS = 4000;
-    DELAY_US(500);
 
-    CpuSysRegs.PCLKCR16.bit.DAC_C = 1;    // Switch on the clock for the DAC module and wait 5 clocks
-    __asm(" RPT #4 || NOP");
+    ClockRequest(CLOCK_DAC_A + 2);   // Clock of the DAC module (switched on by ClockInit())
     DaccRegs.DACCTL.bit.DACREFSEL = DAC_REF_VREFHI;   // ADC VREFHI/VSSA are the reference voltage
     DaccRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;   // Synchronise DAC value via SYSCLK
     DaccRegs.DACCTL.bit.SYNCSEL = DAC_EPWM1SYNCPER;   // ePWM1 loads the value from the DACVALS register into the DACVALA register
     DaccRegs.DACOUTEN.bit.DACOUTEN = DAC_ENABLE_OUTPUT;   // Switch on the output of the DAC - output at pin DACOUTC (ADCINB1)
     DaccRegs.DACVALS.bit.DACVALS = 4000;
-    DELAY_US(500);
+
+    dacPowerUpTime = DeviceGetTime();
+    dacPoweredUp = true;
 
     EDIS;   // Set register write protection
 
 }
+
+//=== Function: DACInitAll ==========================================================================
+///
+/// @brief Function initialises the DAC-A,B,C modules. The three outputs share one settling time,
+///        if DACPowerUpAll() has been called before only the rest of it is waited
+///
+/// @param void
+///
+/// @return void
+///
+//=================================================================================================
+void DACInitAll(void)
+{
+    if (!dacPoweredUp)
+        DACPowerUpAll();
+
+    DeviceWaitSince(dacPowerUpTime, DAC_SETTLE_US);
+}
+
+//=== Function: DACWaveFillRamp ===================================================================
+///
+/// @brief Function writes a ramp from "start" (first sample) to "end" (last sample) into the
+///        samples of one DAC. The other DACs of the table are not changed
+///
+/// @param uint16_t dac (DAC_WAVE_x), uint16_t numberOfSamples, uint16_t start, uint16_t end
+///
+/// @return void
+///
+//=================================================================================================
+void DACWaveFillRamp(uint16_t dac, uint16_t numberOfSamples, uint16_t start, uint16_t end)
+{
+    if (dac >= DAC_WAVE_NUMBER_OF_DACS || numberOfSamples == 0 || numberOfSamples > DAC_WAVE_MAX_SAMPLES)
+        return;
+
+    for (uint16_t i = 0; i < numberOfSamples; i++)
+    {
+        int32_t step = (numberOfSamples > 1) ? ((int32_t)end - start) * i / (numberOfSamples - 1) : 0;
+
+        dacWaveTable[i][dac] = (uint16_t)(start + step);
+    }
+}
+
+//=== Function: DACWaveFillSine ===================================================================
+///
+/// @brief Function writes one period of a sine (offset + amplitude * sin) into the samples of
+///        one DAC. Values outside 0..DAC_MAX_VALUE are limited
+///
+/// @param uint16_t dac (DAC_WAVE_x), uint16_t numberOfSamples, uint16_t offset, uint16_t amplitude
+///
+/// @return void
+///
+//=================================================================================================
+void DACWaveFillSine(uint16_t dac, uint16_t numberOfSamples, uint16_t offset, uint16_t amplitude)
+{
+    if (dac >= DAC_WAVE_NUMBER_OF_DACS || numberOfSamples == 0 || numberOfSamples > DAC_WAVE_MAX_SAMPLES)
+        return;
+
+    for (uint16_t i = 0; i < numberOfSamples; i++)
+    {
+        float32 value = offset + amplitude * sinf(6.2831853f * i / numberOfSamples);
+
+        if (value < 0.0f)
+            value = 0.0f;
+        else if (value > DAC_MAX_VALUE)
+            value = DAC_MAX_VALUE;
+
+        dacWaveTable[i][dac] = (uint16_t)(value + 0.5f);
+    }
+}
+
+//=== Function: DACWaveStart ======================================================================
+///
+/// @brief Function starts the output of the first numberOfSamples samples on DAC-A,B,C. One
+///        sample is copied every "divider" ePWM1 periods (5 us * divider) by one DMA burst of
+///        three words, the channel runs continuously and starts again with the first sample.
+///        DACInitAll() and PwmInitAll() must be called before. DmaInitAdcCapture() resets the
+///        DMA, so it has to be called before this function
+///
+/// @param uint16_t numberOfSamples, uint16_t divider (1 .. DAC_WAVE_MAX_DIVIDER)
+///
+/// @return bool started (false: invalid number of samples or divider, or CH5 used by the LED fade)
+///
+//=================================================================================================
+bool DACWaveStart(uint16_t numberOfSamples, uint16_t divider)
+{
+    volatile struct CH_REGS *channel = &DmaRegs.CH5;
+
+    if (numberOfSamples == 0 || numberOfSamples > DAC_WAVE_MAX_SAMPLES
+        || divider == 0 || divider > DAC_WAVE_MAX_DIVIDER || ledFadeRunning)
+        return false;
+
+    DACWaveStop();
+
+    EALLOW;
+
+    ClockRequest(CLOCK_DMA);    // Returned by DACWaveStop()
+    DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+    channel->CONTROL.bit.SOFTRESET = 1;
+    __asm(" NOP");
+
+    // Source: sample table, destination: DACVALS of DAC-A, B and C (one burst per sample)
+    channel->SRC_BEG_ADDR_SHADOW = (uint32_t)&dacWaveTable[0][0];
+    channel->SRC_ADDR_SHADOW = (uint32_t)&dacWaveTable[0][0];
+    channel->DST_BEG_ADDR_SHADOW = (uint32_t)&DacaRegs.DACVALS;
+    channel->DST_ADDR_SHADOW = (uint32_t)&DacaRegs.DACVALS;
+
+    channel->BURST_SIZE.bit.BURSTSIZE = DAC_WAVE_NUMBER_OF_DACS - 1;
+    channel->SRC_BURST_STEP = 1;
+    channel->DST_BURST_STEP = (int16_t)((uint32_t)&DacbRegs.DACVALS - (uint32_t)&DacaRegs.DACVALS);
+    channel->TRANSFER_SIZE = numberOfSamples - 1;
+    channel->SRC_TRANSFER_STEP = 1;   // From the last DAC of a sample to the next sample
+    channel->DST_TRANSFER_STEP = (int16_t)((uint32_t)&DacaRegs.DACVALS - (uint32_t)&DaccRegs.DACVALS);
+    channel->SRC_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->SRC_WRAP_STEP = 0;
+    channel->DST_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->DST_WRAP_STEP = 0;
+
+    DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5 = DMA_TRIGGER_EPWM1SOCB;
+    channel->MODE.bit.PERINTSEL = 5;
+    channel->MODE.bit.PERINTE = 1;
+    channel->MODE.bit.OVRINTE = 0;
+    channel->MODE.bit.ONESHOT = 0;
+    channel->MODE.bit.CONTINUOUS = 1;   // Reload the table start after the last sample
+    channel->MODE.bit.DATASIZE = DMA_DATA_SIZE_16_BIT;
+    channel->MODE.bit.CHINTE = 0;
+    channel->CONTROL.bit.PERINTCLR = 1;
+    channel->CONTROL.bit.ERRCLR = 1;
+
+    // DACVALS is loaded into DACVALA with the ePWM1 SYNCPER (SYNCSEL = DAC_EPWM1SYNCPER)
+    DacaRegs.DACCTL.bit.LOADMODE = DAC_SYNC_EPWM;
+    DacbRegs.DACCTL.bit.LOADMODE = DAC_SYNC_EPWM;
+    DaccRegs.DACCTL.bit.LOADMODE = DAC_SYNC_EPWM;
+
+    channel->CONTROL.bit.RUN = 1;
+
+    // SOCB of ePWM1 at counter = 0 on every "divider"-th period. The 4 bit prescaler of
+    // ETSOCPS also replaces the prescaler of SOCA, which keeps its value
+    EPwm1Regs.ETSOCPS.bit.SOCAPRD2 = EPwm1Regs.ETPS.bit.SOCAPRD;
+    EPwm1Regs.ETSOCPS.bit.SOCBPRD2 = divider;
+    EPwm1Regs.ETPS.bit.SOCPSSEL = 1;
+    EPwm1Regs.ETSEL.bit.SOCBSEL = DAC_WAVE_EPWM_CTR_ZERO;
+    EPwm1Regs.ETCLR.bit.SOCB = 1;
+    EPwm1Regs.ETSEL.bit.SOCBEN = 1;
+
+    EDIS;
+
+    dacWaveRunning = true;
+    return true;
+}
+
+//=== Function: DACWaveStop =======================================================================
+///
+/// @brief Function stops the waveform generator. The DACs keep the last sample and load new
+///        values written by the CPU immediately again (DAC_SYNC_SYSCLK)
+///
+/// @param void
+///
+/// @return void
+///
+//=================================================================================================
+void DACWaveStop(void)
+{
+    if (!dacWaveRunning)
+        return;
+
+    EALLOW;
+    EPwm1Regs.ETSEL.bit.SOCBEN = 0;
+    DmaRegs.CH5.CONTROL.bit.HALT = 1;
+    DacaRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
+    DacbRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
+    DaccRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
+    ClockRelease(CLOCK_DMA);
+    EDIS;
+
+    dacWaveRunning = false;
+}
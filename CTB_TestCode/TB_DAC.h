@@ -3,6 +3,9 @@
 ///
 /// @brief      file contains variables and functions to use the internal digital-analogue converter
 ///             of the TMS320F2838x. The code configures all DACs i.e DACOUTA, DACOUTB, DACOUTC
+///             The waveform generator outputs a sample table on all three DACs with DMA CH5,
+///             paced by the ePWM1 SOCB and loaded by the ePWM1 SYNCPER. DMA CH5 is shared with
+///             the fade engine of the PWM_LEDs (TB_LedFade), only one of both can run.
 ///
 /// @version    V1.1.0
 ///
@@ -16,6 +19,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_Device.h"
+#include "TB_Clock.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -47,6 +51,20 @@
 // Output
 #define DAC_DISABLE_OUTPUT  0
 #define DAC_ENABLE_OUTPUT   1
+// Settling time of the DAC outputs after the power up in us
+#define DAC_SETTLE_US       500
+// Largest DAC value (12 bit)
+#define DAC_MAX_VALUE       4095
+// Waveform generator: DACs in one sample of the table (A, B, C) and maximum number of samples
+#define DAC_WAVE_A                  0
+#define DAC_WAVE_B                  1
+#define DAC_WAVE_C                  2
+#define DAC_WAVE_NUMBER_OF_DACS     3
+#define DAC_WAVE_MAX_SAMPLES        1024
+// Maximum number of ePWM1 periods per sample (ETSOCPS.SOCBPRD2)
+#define DAC_WAVE_MAX_DIVIDER        15
+// ePWM event that triggers the SOCB of a new sample (counter = 0)
+#define DAC_WAVE_EPWM_CTR_ZERO      1
 
 
 //-------------------------------------------------------------------------------------------------
@@ -57,13 +75,30 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Time of the power up of the DAC modules and state of the power up
+extern uint32_t dacPowerUpTime;
+extern bool dacPoweredUp;
+// Samples of the waveform generator in GSx RAM, one value per DAC and sample
+extern uint16_t dacWaveTable[DAC_WAVE_MAX_SAMPLES][DAC_WAVE_NUMBER_OF_DACS];
+// State of the waveform generator
+extern bool dacWaveRunning;
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Function configures the DAC-A,B,C modules and switches on their outputs without waiting
+extern void DACPowerUpAll(void);
 // Function initialises the DAC-A,B,C modules
 extern void DACInitAll(void);
+// Function writes a ramp from "start" to "end" into the samples of one DAC
+extern void DACWaveFillRamp(uint16_t dac, uint16_t numberOfSamples, uint16_t start, uint16_t end);
+// Function writes one period of a sine into the samples of one DAC
+extern void DACWaveFillSine(uint16_t dac, uint16_t numberOfSamples, uint16_t offset, uint16_t amplitude);
+// Function starts the output of the sample table on all three DACs by the DMA (CH5)
+extern bool DACWaveStart(uint16_t numberOfSamples, uint16_t divider);
+// Function stops the waveform generator, the DACs keep the last sample
+extern void DACWaveStop(void);
 
 
 #endif
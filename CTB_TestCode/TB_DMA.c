@@ -0,0 +1,332 @@
+//=================================================================================================
+/// @file       TB_DMA.c
+///
+/// @brief      file contains variables and functions to capture the ADC results of all four ADC
+///             modules (A to D) with the DMA. On every ePWM1 SOCA the ADCs convert the configured
+///             SOCs, the end of the last SOC of each module triggers one DMA channel (CH1 to CH4),
+///             which copies the result registers ADCRESULT0..15 of its module into a frame of a
+///             ping-pong buffer in GSx RAM. The CPU only reads completed frames.
+///             Every completed frame also clocks a frame-locked test sequence (SequencerFrame()).
+///             Every channel raises its own interrupt at the end of its transfer and switches only
+///             its own destination, the frame is published when all four channels are done
+///             (the order of ADC A to D is not fixed: SOC priorities, ACQPS, CPU-timer SOC8).
+///
+/// @version    V1.3.0
+///
+/// @date       14-10-2026
+///
+/// @author     Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_DMA.h"
+#include "TB_Telemetry.h"
+#include "TB_ProcessImage.h"
+#include "TB_Sequencer.h"
+#include "TB_Trace.h"
+#include "TB_Datalog.h"
+#include "TB_Sfra.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// The ISRs run from LSx RAM without flash wait states (see TB_Sequencer.c)
+#pragma CODE_SECTION(DmaAdcChannelDone, ".TI.ramfunc");
+#pragma CODE_SECTION(DmaAdcFrameDone, ".TI.ramfunc");
+#pragma CODE_SECTION(DmaAdcCh1ISR, ".TI.ramfunc");
+#pragma CODE_SECTION(DmaAdcCh2ISR, ".TI.ramfunc");
+#pragma CODE_SECTION(DmaAdcCh3ISR, ".TI.ramfunc");
+#pragma CODE_SECTION(DmaAdcCh4ISR, ".TI.ramfunc");
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ping-pong buffer (the DMA can not access the LSx RAM, therefore GSx RAM is used)
+#pragma DATA_SECTION(dmaAdcBuffer, "ramgs0");
+uint16_t dmaAdcBuffer[DMA_ADC_NUMBER_OF_FRAMES][DMA_ADC_FRAME_SIZE];
+volatile uint16_t *dmaAdcFrame = dmaAdcBuffer[0];
+volatile uint32_t dmaAdcFrameCount = 0;
+// Frame of the ping-pong buffer which is currently written by the DMA
+uint16_t dmaAdcWriteFrame = 0;
+// Channels which have finished their transfer into the current frame (bit 0: CH1 ... bit 3: CH4)
+static uint16_t dmaAdcDoneMask = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DmaInitAdcChannel =================================================================
+///
+/// @brief  Function configures one DMA channel to copy the 16 result registers of one ADC module
+///         into the ping-pong buffer. Each trigger moves one burst of 16 words, the channel runs
+///         continuously and reloads its addresses from the shadow registers after every transfer
+///
+/// @param  volatile struct CH_REGS *channel, uint16_t channelNumber, volatile uint16_t *source,
+///         uint16_t offset
+///
+/// @return void
+///
+//=================================================================================================
+static void DmaInitAdcChannel(volatile struct CH_REGS *channel,
+                              uint16_t channelNumber,
+                              volatile uint16_t *source,
+                              uint16_t offset)
+{
+    channel->CONTROL.bit.SOFTRESET = 1;
+    __asm(" NOP");
+
+    // Source: ADCRESULT0..15, destination: module offset in the first frame
+    channel->SRC_BEG_ADDR_SHADOW = (uint32_t)source;
+    channel->SRC_ADDR_SHADOW = (uint32_t)source;
+    channel->DST_BEG_ADDR_SHADOW = (uint32_t)&dmaAdcBuffer[0][offset];
+    channel->DST_ADDR_SHADOW = (uint32_t)&dmaAdcBuffer[0][offset];
+
+    // One burst of 16 words per trigger, one burst per transfer
+    channel->BURST_SIZE.bit.BURSTSIZE = DMA_ADC_RESULTS_PER_MODULE - 1;
+    channel->SRC_BURST_STEP = 1;
+    channel->DST_BURST_STEP = 1;
+    channel->TRANSFER_SIZE = 0;
+    channel->SRC_TRANSFER_STEP = 0;
+    channel->DST_TRANSFER_STEP = 0;
+    channel->SRC_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->SRC_WRAP_STEP = 0;
+    channel->DST_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->DST_WRAP_STEP = 0;
+
+    channel->MODE.bit.PERINTSEL = channelNumber;
+    channel->MODE.bit.PERINTE = 1;
+    channel->MODE.bit.OVRINTE = 0;
+    channel->MODE.bit.ONESHOT = 0;
+    channel->MODE.bit.CONTINUOUS = 1;
+    channel->MODE.bit.DATASIZE = DMA_DATA_SIZE_16_BIT;
+    channel->MODE.bit.CHINTMODE = DMA_INT_AT_END_OF_TRANSFER;
+    channel->MODE.bit.CHINTE = 0;
+
+    channel->CONTROL.bit.PERINTCLR = 1;
+    channel->CONTROL.bit.ERRCLR = 1;
+}
+
+//=== Function: DmaAdcChannelDone =================================================================
+///
+/// @brief  Function is called by the ISR of a channel at the end of its transfer. The channel was
+///         the last writer of its part of the current frame, so only its shadow destination is
+///         switched to the other frame (active with its next trigger). When all four channels are
+///         done, the frame is published with DmaAdcFrameDone()
+///
+/// @param  volatile struct CH_REGS *channel, uint16_t offset, uint16_t mask
+///
+/// @return void
+///
+//=================================================================================================
+static void DmaAdcChannelDone(volatile struct CH_REGS *channel, uint16_t offset, uint16_t mask)
+{
+    uint16_t *next = dmaAdcBuffer[dmaAdcWriteFrame ^ 1];
+
+    EALLOW;
+    channel->DST_BEG_ADDR_SHADOW = (uint32_t)&next[offset];
+    channel->DST_ADDR_SHADOW = (uint32_t)&next[offset];
+    EDIS;
+
+    dmaAdcDoneMask |= mask;
+    if (dmaAdcDoneMask == DMA_ADC_ALL_CHANNELS)
+    {
+        dmaAdcDoneMask = 0;
+        DmaAdcFrameDone();
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP7;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DmaInitAdcCapture =================================================================
+///
+/// @brief  Function initialises DMA CH1 to CH4 and the ADC interrupts to capture the results of
+///         ADC A to D on every ePWM1 SOCA. AdcInitAll() must be called before
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DmaInitAdcCapture(void)
+{
+    EALLOW;
+
+    ClockRequest(CLOCK_DMA);
+
+    DmaRegs.DMACTRL.bit.HARDRESET = 1;
+    __asm(" NOP");
+    // DMA keeps running when the debugger halts the CPU
+    DmaRegs.DEBUGCTRL.bit.FREE = 1;
+    // All channels same priority (round robin)
+    DmaRegs.PRIORITYCTRL1.bit.CH1PRIORITY = 0;
+
+    // ADCINTx1 is generated by the EOC of the last SOC of each module. Continuous mode so
+    // that the flag does not have to be cleared by the CPU
+    AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = DMA_ADC_LAST_SOC_A;
+    AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+    AdcaRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+    AdcbRegs.ADCINTSEL1N2.bit.INT1SEL = DMA_ADC_LAST_SOC_B;
+    AdcbRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+    AdcbRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+    AdccRegs.ADCINTSEL1N2.bit.INT1SEL = DMA_ADC_LAST_SOC_C;
+    AdccRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+    AdccRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+    AdcdRegs.ADCINTSEL1N2.bit.INT1SEL = DMA_ADC_LAST_SOC_D;
+    AdcdRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+    AdcdRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = DMA_TRIGGER_ADCAINT1;
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2 = DMA_TRIGGER_ADCBINT1;
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3 = DMA_TRIGGER_ADCCINT1;
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH4 = DMA_TRIGGER_ADCDINT1;
+
+    DmaInitAdcChannel(&DmaRegs.CH1, 1, &AdcaResultRegs.ADCRESULT0, DMA_ADC_OFFSET_a);
+    DmaInitAdcChannel(&DmaRegs.CH2, 2, &AdcbResultRegs.ADCRESULT0, DMA_ADC_OFFSET_b);
+    DmaInitAdcChannel(&DmaRegs.CH3, 3, &AdccResultRegs.ADCRESULT0, DMA_ADC_OFFSET_c);
+    DmaInitAdcChannel(&DmaRegs.CH4, 4, &AdcdResultRegs.ADCRESULT0, DMA_ADC_OFFSET_d);
+
+    // The modules do not finish in a fixed order (round robin SOCs of ADC-A, CPU-timer SOC8,
+    // ACQPS per channel), so every channel reports the end of its transfer
+    DmaRegs.CH1.MODE.bit.CHINTE = 1;
+    DmaRegs.CH2.MODE.bit.CHINTE = 1;
+    DmaRegs.CH3.MODE.bit.CHINTE = 1;
+    DmaRegs.CH4.MODE.bit.CHINTE = 1;
+
+    dmaAdcWriteFrame = 0;
+    dmaAdcDoneMask = 0;
+    dmaAdcFrame = dmaAdcBuffer[DMA_ADC_NUMBER_OF_FRAMES - 1];
+    dmaAdcFrameCount = 0;
+
+    // DMA CH1 to CH4 interrupts (PIE group 7.1 to 7.4)
+    PieVectTable.DMA_CH1_INT = &DmaAdcCh1ISR;
+    PieVectTable.DMA_CH2_INT = &DmaAdcCh2ISR;
+    PieVectTable.DMA_CH3_INT = &DmaAdcCh3ISR;
+    PieVectTable.DMA_CH4_INT = &DmaAdcCh4ISR;
+    PieCtrlRegs.PIEIER7.bit.INTx1 = 1;
+    PieCtrlRegs.PIEIER7.bit.INTx2 = 1;
+    PieCtrlRegs.PIEIER7.bit.INTx3 = 1;
+    PieCtrlRegs.PIEIER7.bit.INTx4 = 1;
+    IER |= M_INT7;
+
+    DmaRegs.CH1.CONTROL.bit.RUN = 1;
+    DmaRegs.CH2.CONTROL.bit.RUN = 1;
+    DmaRegs.CH3.CONTROL.bit.RUN = 1;
+    DmaRegs.CH4.CONTROL.bit.RUN = 1;
+
+    EDIS;
+}
+
+//=== Function: DmaWaitAdcFrames ==================================================================
+///
+/// @brief  Function waits until the given number of new frames is completed. With the ePWM1
+///         period of 5 us one frame takes 5 us
+///
+/// @param  uint16_t numberOfFrames
+///
+/// @return void
+///
+//=================================================================================================
+void DmaWaitAdcFrames(uint16_t numberOfFrames)
+{
+    uint32_t start = dmaAdcFrameCount;
+
+    while ((dmaAdcFrameCount - start) < numberOfFrames);
+}
+
+//=== Function: DmaAdcFrameDone ===================================================================
+///
+/// @brief  Function is called from the ISR of the channel which finishes a frame last (all four
+///         channels have written it). The frame is published and handed to the frame-locked
+///         modules, the channels already write the other frame with their next trigger
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DmaAdcFrameDone(void)
+{
+    // Publish the frame which has just been completed
+    dmaAdcFrame = dmaAdcBuffer[dmaAdcWriteFrame];
+    dmaAdcFrameCount++;
+    TRACE(TRACE_CONTEXT_DMA, TRACE_EVENT_DMA_FRAME, dmaAdcFrameCount);
+    // Hand the frame to the UDP stream of the CM (returns at once if the CM is not ready)
+    TelemetryPublishFrame(dmaAdcFrame);
+    // Exchange the process image with the CM every PROCESS_IMAGE_CYCLE_FRAMES frames
+    ProcessImageCycle(dmaAdcFrame);
+#if DLOG_ENABLE
+    // Sample the variables selected by the host for the datalogger (returns at once if stopped)
+    DlogSample();
+#endif
+#if SFRA_ENABLE
+    // Perturbation of the DAC codes and correlation of the ADC result (returns at once if idle)
+    SfraFrame();
+#endif
+    // Next step of a frame-locked sequence (mux address and DAC codes of the analog checks)
+    SequencerFrame();
+
+    // The channels have already been switched to the other half of the ping-pong buffer
+    dmaAdcWriteFrame ^= 1;
+}
+
+//=== Function: DmaAdcCh1ISR ======================================================================
+///
+/// @brief  ISR is called when DMA CH1 (ADC-A) has finished its transfer
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void DmaAdcCh1ISR(void)
+{
+    DmaAdcChannelDone(&DmaRegs.CH1, DMA_ADC_OFFSET_a, 0x1);
+}
+
+//=== Function: DmaAdcCh2ISR ======================================================================
+///
+/// @brief  ISR is called when DMA CH2 (ADC-B) has finished its transfer
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void DmaAdcCh2ISR(void)
+{
+    DmaAdcChannelDone(&DmaRegs.CH2, DMA_ADC_OFFSET_b, 0x2);
+}
+
+//=== Function: DmaAdcCh3ISR ======================================================================
+///
+/// @brief  ISR is called when DMA CH3 (ADC-C) has finished its transfer
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void DmaAdcCh3ISR(void)
+{
+    DmaAdcChannelDone(&DmaRegs.CH3, DMA_ADC_OFFSET_c, 0x4);
+}
+
+//=== Function: DmaAdcCh4ISR ======================================================================
+///
+/// @brief  ISR is called when DMA CH4 (ADC-D) has finished its transfer
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void DmaAdcCh4ISR(void)
+{
+    DmaAdcChannelDone(&DmaRegs.CH4, DMA_ADC_OFFSET_d, 0x8);
+}
@@ -0,0 +1,100 @@
+//=================================================================================================
+/// @file       TB_DMA.h
+///
+/// @brief      file contains variables and functions to capture the ADC results of all four ADC
+///             modules (A to D) with the DMA. On every ePWM1 SOCA the ADCs convert the configured
+///             SOCs, the end of the last SOC of each module triggers one DMA channel (CH1 to CH4),
+///             which copies the result registers ADCRESULT0..15 of its module into a frame of a
+///             ping-pong buffer in GSx RAM. The CPU only reads completed frames.
+///
+/// @version    V1.1.0
+///
+/// @date       23-04-2024
+///
+/// @author     Vijay
+//=================================================================================================
+#ifndef MYDMA_H_
+#define MYDMA_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Clock.h"
+#include "TB_ADC.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Trigger sources of the DMA channels (DMACHSRCSELx)
+#define DMA_TRIGGER_SOFTWARE                0
+#define DMA_TRIGGER_ADCAINT1                1
+#define DMA_TRIGGER_ADCBINT1                6
+#define DMA_TRIGGER_ADCCINT1                11
+#define DMA_TRIGGER_ADCDINT1                16
+#define DMA_TRIGGER_EPWM1SOCB               37
+// Data size of one DMA word
+#define DMA_DATA_SIZE_16_BIT                0
+#define DMA_DATA_SIZE_32_BIT                1
+// Generation of the channel interrupt
+#define DMA_INT_AT_BEGINNING_OF_TRANSFER    0
+#define DMA_INT_AT_END_OF_TRANSFER          1
+// Wrap function not used
+#define DMA_WRAP_DISABLE                    0xFFFF
+// Number of ADC modules and copied result registers per module
+#define DMA_ADC_NUMBER_OF_MODULES           4
+#define DMA_ADC_RESULTS_PER_MODULE          16
+// Size of one frame (all result registers of ADC A to D)
+#define DMA_ADC_FRAME_SIZE                  (DMA_ADC_NUMBER_OF_MODULES * DMA_ADC_RESULTS_PER_MODULE)
+// Number of frames in the ping-pong buffer
+#define DMA_ADC_NUMBER_OF_FRAMES            2
+// Offset of the ADC modules inside of a frame
+#define DMA_ADC_OFFSET_a                    (0 * DMA_ADC_RESULTS_PER_MODULE)
+#define DMA_ADC_OFFSET_b                    (1 * DMA_ADC_RESULTS_PER_MODULE)
+#define DMA_ADC_OFFSET_c                    (2 * DMA_ADC_RESULTS_PER_MODULE)
+#define DMA_ADC_OFFSET_d                    (3 * DMA_ADC_RESULTS_PER_MODULE)
+// Last SOC of each module, its EOC triggers the DMA channel
+#define DMA_ADC_LAST_SOC_A                  ADC_EOC_NUMBER_15
+#define DMA_ADC_LAST_SOC_B                  ADC_EOC_NUMBER_5
+#define DMA_ADC_LAST_SOC_C                  ADC_EOC_NUMBER_5
+#define DMA_ADC_LAST_SOC_D                  ADC_EOC_NUMBER_5
+// All channels have finished the frame (dmaAdcDoneMask)
+#define DMA_ADC_ALL_CHANNELS                0xF
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Result of SOC "soc" of ADC module "module" (a, b, c or d) in the last completed frame
+#define DMA_ADC_RESULT(module, soc)         (dmaAdcFrame[DMA_ADC_OFFSET_##module + (soc)])
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ping-pong buffer in GSx RAM, written by the DMA
+extern uint16_t dmaAdcBuffer[DMA_ADC_NUMBER_OF_FRAMES][DMA_ADC_FRAME_SIZE];
+// Points to the last completed frame of the ping-pong buffer
+extern volatile uint16_t *dmaAdcFrame;
+// Number of completed frames since DmaInitAdcCapture()
+extern volatile uint32_t dmaAdcFrameCount;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function initialises DMA CH1 to CH4 and the ADC interrupts
+// to capture the results of ADC A to D on every ePWM1 SOCA
+extern void DmaInitAdcCapture(void);
+// Function waits until the given number of new frames is completed
+extern void DmaWaitAdcFrames(uint16_t numberOfFrames);
+// Function publishes a frame when all four channels have written it (called by the ISRs below)
+extern void DmaAdcFrameDone(void);
+// Interrupt service routines, called when DMA CH1 to CH4 (ADC A to D) have finished a transfer
+__interrupt void DmaAdcCh1ISR(void);
+__interrupt void DmaAdcCh2ISR(void);
+__interrupt void DmaAdcCh3ISR(void);
+__interrupt void DmaAdcCh4ISR(void);
+
+
+#endif
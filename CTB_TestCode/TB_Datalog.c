@@ -0,0 +1,375 @@
+//=================================================================================================
+/// @file     TB_Datalog.c
+///
+/// @brief    File contains the registration table, the PWM-synchronous sampler and the UART
+///           transmission of the datalogger. See TB_Datalog.h for the frames
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Datalog.h"
+#include "TB_Functions.h"
+#include "TB_PWM.h"
+#include "TB_DMA.h"
+#include "TB_CLA.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by DmaAdcFrameDone(), runs from LSx RAM like the ISR (see TB_Sequencer.c)
+#pragma CODE_SECTION(DlogSample, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// The index of a variable must not change, the host addresses the variables by their index
+const DlogVariable dlogVariableTable[DLOG_NUMBER_OF_VARIABLES] =
+{
+    // Results of ADCtoPWM() / the CLA (one per PWM_LED)
+    {"A2",                  &A2,                    DLOG_TYPE_UINT16},      // 0
+    {"A3",                  &A3,                    DLOG_TYPE_UINT16},      // 1
+    {"A4",                  &A4,                    DLOG_TYPE_UINT16},      // 2
+    {"A5",                  &A5,                    DLOG_TYPE_UINT16},      // 3
+    {"B0",                  &B0,                    DLOG_TYPE_UINT16},      // 4
+    {"B2",                  &B2,                    DLOG_TYPE_UINT16},      // 5
+    {"B3",                  &B3,                    DLOG_TYPE_UINT16},      // 6
+    {"B4",                  &B4,                    DLOG_TYPE_UINT16},      // 7
+    {"B5",                  &B5,                    DLOG_TYPE_UINT16},      // 8
+    {"C2",                  &C2,                    DLOG_TYPE_UINT16},      // 9
+    {"C3",                  &C3,                    DLOG_TYPE_UINT16},      // 10
+    {"C4",                  &C4,                    DLOG_TYPE_UINT16},      // 11
+    {"C5",                  &C5,                    DLOG_TYPE_UINT16},      // 12
+    {"D0",                  &D0,                    DLOG_TYPE_UINT16},      // 13
+    {"D1",                  &D1,                    DLOG_TYPE_UINT16},      // 14
+    {"D2",                  &D2,                    DLOG_TYPE_UINT16},      // 15
+    {"D3",                  &D3,                    DLOG_TYPE_UINT16},      // 16
+    {"D4",                  &D4,                    DLOG_TYPE_UINT16},      // 17
+    {"D5",                  &D5,                    DLOG_TYPE_UINT16},      // 18
+    {"IN14",                &IN14,                  DLOG_TYPE_UINT16},      // 19
+    {"IN15",                &IN15,                  DLOG_TYPE_UINT16},      // 20
+    // State of the checks
+    {"muxSelected",         &muxSelected,           DLOG_TYPE_INT16},       // 21
+    {"ADC_error_buffer",    &ADC_error_buffer,      DLOG_TYPE_FLOAT32},     // 22
+    {"pwmPhaseActual[0]",   &pwmPhaseActual[0],     DLOG_TYPE_UINT16},      // 23
+    // Counters of the DMA and the CLA (Cla1ToCpuMsgRAM)
+    {"dmaAdcFrameCount",    &dmaAdcFrameCount,      DLOG_TYPE_UINT32},      // 24
+    {"claAdcOutput.frames", &claAdcOutput.frames,   DLOG_TYPE_UINT32},      // 25
+    {"claAdcOutput.route",  &claAdcOutput.route,    DLOG_TYPE_UINT16},      // 26
+    {"dlogDroppedSamples",  &dlogDroppedSamples,    DLOG_TYPE_UINT32},      // 27
+};
+
+uint16_t dlogSelected[DLOG_MAX_SELECTED];
+uint16_t dlogNumberOfSelected = 0;
+uint16_t dlogDecimation = 1;
+volatile uint32_t dlogDroppedSamples = 0;
+
+// Ring of packets, "head" is moved by DlogSample(), "tail" by DlogService() only. The selection
+// is only changed by the main loop while "dlogRunning" is false. The packets and the transmit
+// frame are written before they are sent, therefore not zeroed by the C startup
+#pragma DATA_SECTION(dlogPackets, "noinitbuf");
+static DlogPacket dlogPackets[DLOG_NUMBER_OF_PACKETS];
+static volatile uint16_t dlogHead = 0;
+static volatile uint16_t dlogTail = 0;
+static volatile bool dlogRunning = false;
+static uint16_t dlogDecimationCount = 0;
+static uint16_t dlogSampleIndex = 0;
+static uint16_t dlogSequence = 0;
+// Packet which is sent over the UART
+#pragma DATA_SECTION(dlogTxFrame, "noinitbuf");
+static uint16_t dlogTxFrame[DLOG_FRAME_BYTES];
+static uint16_t dlogTxLength = 0;
+static uint16_t dlogTxPosition = 0;
+// Answer of the last select frame, sent between two packets
+static uint16_t dlogAnswer = DLOG_NO_ANSWER;
+// Receiver of the select frame
+static uint16_t dlogRxState = DLOG_RX_COUNT;
+static uint16_t dlogRxNumberOfSelected;
+static uint16_t dlogRxSelected[DLOG_MAX_SELECTED];
+static uint16_t dlogRxIndex;
+static uint16_t dlogRxDecimation;
+static uint16_t dlogRxChecksum;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DlogSelect ========================================================================
+///
+/// @brief  Function stops the sampling, takes over a new selection and starts the sampling
+///         again if variables are selected. The packets which were not sent are discarded
+///
+/// @param  const uint16_t *selected, uint16_t numberOfSelected, uint16_t decimation
+///
+/// @return void
+///
+//=================================================================================================
+static void DlogSelect(const uint16_t *selected, uint16_t numberOfSelected, uint16_t decimation)
+{
+    dlogRunning = false;
+
+    for (uint16_t i = 0; i < numberOfSelected; i++)
+        dlogSelected[i] = selected[i];
+    dlogNumberOfSelected = numberOfSelected;
+    dlogDecimation = decimation;
+    dlogDecimationCount = 0;
+    dlogSampleIndex = 0;
+    dlogTail = dlogHead;
+
+    dlogRunning = (numberOfSelected > 0);
+}
+
+//=== Function: DlogBuildFrame ====================================================================
+///
+/// @brief  Function writes a packet of the ring as bytes into the transmit buffer
+///
+/// @param  const DlogPacket *packet
+///
+/// @return void
+///
+//=================================================================================================
+static void DlogBuildFrame(const DlogPacket *packet)
+{
+    uint16_t length = 0;
+    uint16_t checksum = 0;
+
+    dlogTxFrame[length++] = DLOG_SYNC;
+    dlogTxFrame[length++] = packet->sequence & 0x00FF;
+    dlogTxFrame[length++] = packet->sequence >> 8;
+    dlogTxFrame[length++] = packet->numberOfVariables;
+    dlogTxFrame[length++] = DLOG_SAMPLES_PER_PACKET;
+    for (uint16_t i = 0; i < 4; i++)
+        dlogTxFrame[length++] = (uint16_t)(packet->time >> (8 * i)) & 0x00FF;
+    for (uint16_t i = 0; i < packet->numberOfWords; i++)
+    {
+        dlogTxFrame[length++] = packet->data[i] & 0x00FF;
+        dlogTxFrame[length++] = packet->data[i] >> 8;
+    }
+    for (uint16_t i = 1; i < length; i++)
+        checksum += dlogTxFrame[i];
+    dlogTxFrame[length++] = checksum & 0x00FF;
+
+    dlogTxLength = length;
+    dlogTxPosition = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DlogInit ==========================================================================
+///
+/// @brief  Function stops the sampling, clears the ring and the receiver
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DlogInit(void)
+{
+    dlogRunning = false;
+    dlogNumberOfSelected = 0;
+    dlogDecimation = 1;
+    dlogHead = 0;
+    dlogTail = 0;
+    dlogSequence = 0;
+    dlogDroppedSamples = 0;
+    dlogTxLength = 0;
+    dlogTxPosition = 0;
+    dlogAnswer = DLOG_NO_ANSWER;
+    dlogRxState = DLOG_RX_COUNT;
+}
+
+//=== Function: DlogReceive =======================================================================
+///
+/// @brief  Function processes one byte of a select frame after DLOG_REQUEST. A complete frame
+///         with a correct checksum, valid indices and a decimation > 0 becomes the new
+///         selection and is answered with DLOG_ACK, every other frame with DLOG_NAK. The answer
+///         is sent by DlogService() between two packets
+///
+/// @param  uint16_t byte
+///
+/// @return bool done (true: the frame has ended, the next byte belongs to another frame)
+///
+//=================================================================================================
+bool DlogReceive(uint16_t byte)
+{
+    uint16_t answer = DLOG_NAK;
+
+    switch (dlogRxState)
+    {
+        case DLOG_RX_COUNT:
+            dlogRxNumberOfSelected = byte;
+            dlogRxIndex = 0;
+            dlogRxChecksum = byte;
+            if (byte > DLOG_MAX_SELECTED)
+                break;
+            dlogRxState = (byte == 0) ? DLOG_RX_DECIMATION_LOW : DLOG_RX_INDEX;
+            return false;
+
+        case DLOG_RX_INDEX:
+            dlogRxSelected[dlogRxIndex] = byte;
+            dlogRxChecksum += byte;
+            if (byte >= DLOG_NUMBER_OF_VARIABLES)
+                break;
+            if (++dlogRxIndex == dlogRxNumberOfSelected)
+                dlogRxState = DLOG_RX_DECIMATION_LOW;
+            return false;
+
+        case DLOG_RX_DECIMATION_LOW:
+            dlogRxDecimation = byte;
+            dlogRxChecksum += byte;
+            dlogRxState = DLOG_RX_DECIMATION_HIGH;
+            return false;
+
+        case DLOG_RX_DECIMATION_HIGH:
+            dlogRxDecimation |= byte << 8;
+            dlogRxChecksum += byte;
+            dlogRxState = DLOG_RX_CHECKSUM;
+            return false;
+
+        default:
+            if (byte == (dlogRxChecksum & 0x00FF) && dlogRxDecimation > 0)
+            {
+                DlogSelect(dlogRxSelected, dlogRxNumberOfSelected, dlogRxDecimation);
+                answer = DLOG_ACK;
+            }
+            break;
+    }
+
+    dlogRxState = DLOG_RX_COUNT;
+    dlogAnswer = answer;
+    return true;
+}
+
+//=== Function: DlogSample ========================================================================
+///
+/// @brief  Function packs the selected variables into the open packet every "decimation"-th
+///         call and publishes the packet by moving the head when it holds
+///         DLOG_SAMPLES_PER_PACKET samples. If all packets are published and not sent, the
+///         sample is dropped and counted. Called from DmaAdcFrameDone()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DlogSample(void)
+{
+    uint16_t head = dlogHead;
+    DlogPacket *packet;
+    uint16_t *words;
+
+    if (!dlogRunning)
+        return;
+
+    if (++dlogDecimationCount < dlogDecimation)
+        return;
+    dlogDecimationCount = 0;
+
+    // All packets published and not sent yet, the UART is too slow
+    if ((uint16_t)(head - dlogTail) >= DLOG_NUMBER_OF_PACKETS)
+    {
+        dlogDroppedSamples++;
+        return;
+    }
+
+    packet = &dlogPackets[head & DLOG_PACKET_MASK];
+    if (dlogSampleIndex == 0)
+    {
+        packet->time = 0xFFFFFFFFUL - CpuTimer2Regs.TIM.all;
+        packet->numberOfWords = 0;
+    }
+
+    words = &packet->data[packet->numberOfWords];
+    for (uint16_t i = 0; i < dlogNumberOfSelected; i++)
+    {
+        const DlogVariable *variable = &dlogVariableTable[dlogSelected[i]];
+
+        if (variable->type >= DLOG_TYPE_UINT32)
+        {
+            uint32_t value = *(const volatile uint32_t *)variable->address;
+
+            *words++ = (uint16_t)value;
+            *words++ = (uint16_t)(value >> 16);
+        }
+        else
+        {
+            *words++ = *(const volatile uint16_t *)variable->address;
+        }
+    }
+    packet->numberOfWords = words - packet->data;
+
+    if (++dlogSampleIndex < DLOG_SAMPLES_PER_PACKET)
+        return;
+    dlogSampleIndex = 0;
+
+    packet->sequence = dlogSequence++;
+    packet->numberOfVariables = dlogNumberOfSelected;
+    // The packet is complete before the head is moved (DlogService() only reads up to the head)
+    dlogHead = head + 1;
+}
+
+//=== Function: DlogService =======================================================================
+///
+/// @brief  Function sends the pending answer and the published packets as far as the transmit
+///         FIFO has room, it never waits for the UART. A packet is continued in the next call.
+///         Called in the main loop
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DlogService(void)
+{
+    uint16_t free = UartTxFree();
+
+    while (free > 0)
+    {
+        uint16_t numberOfBytes;
+
+        if (dlogTxPosition == dlogTxLength)
+        {
+            if (dlogAnswer != DLOG_NO_ANSWER)
+            {
+                UartWriteBytes(&dlogAnswer, 1);
+                dlogAnswer = DLOG_NO_ANSWER;
+                free--;
+                continue;
+            }
+            if (dlogTail == dlogHead)
+                return;
+
+            DlogBuildFrame(&dlogPackets[dlogTail & DLOG_PACKET_MASK]);
+            dlogTail++;
+        }
+
+        numberOfBytes = dlogTxLength - dlogTxPosition;
+        if (numberOfBytes > free)
+            numberOfBytes = free;
+        UartWriteBytes(&dlogTxFrame[dlogTxPosition], numberOfBytes);
+        dlogTxPosition += numberOfBytes;
+        free -= numberOfBytes;
+    }
+}
+
+//=== Function: DlogSending =======================================================================
+///
+/// @brief  Function returns true while a packet is partly sent. Other frames on the UART have
+///         to wait until it is complete
+///
+/// @param  void
+///
+/// @return bool sending
+///
+//=================================================================================================
+bool DlogSending(void)
+{
+    return dlogTxPosition != dlogTxLength;
+}
@@ -0,0 +1,125 @@
+//=================================================================================================
+/// @file     TB_Datalog.h
+///
+/// @brief    File contains a datalogger for internal variables, which replaces the slow sampling
+///           of CCS expressions over JTAG. dlogVariableTable registers the variables (address
+///           and type) which may be logged, the host selects up to DLOG_MAX_SELECTED of them and
+///           a decimation factor. DmaAdcFrameDone() calls DlogSample() for every DMA frame of
+///           TB_DMA (one frame per ePWM1 SOCA, 5 us), so all values of a sample are taken at the
+///           same point of the PWM period. Every "decimation"-th frame the selected values are
+///           packed into the open packet of a ring, DlogService() in the main loop sends the
+///           full packets over the UART of TB_UART when the transmit FIFO has room and never
+///           waits. If the UART falls behind, samples are dropped and counted instead.
+///           The UART carries about 11 kB/s, the host has to choose the decimation to match the
+///           selected variables (e.g. 4 variables of 16 bit: decimation >= 25)
+///
+///           Select frame (host, bytes):
+///             DLOG_REQUEST, number of variables n (0: stop), n * index of dlogVariableTable,
+///             decimation (16 bit, 1: every frame), checksum
+///             checksum: lower 8 bits of the sum of all bytes after DLOG_REQUEST
+///           The frame is answered with DLOG_ACK or DLOG_NAK between two packets. The packets
+///           of the old selection which were not sent yet are discarded.
+///           Packet (bytes):
+///             DLOG_SYNC, sequence (16 bit), number of variables n, samples per packet m,
+///             time of the first sample (32 bit, DeviceGetTime()),
+///             m * (n * value, 2 bytes for 16 bit and 4 bytes for 32 bit types), checksum
+///             checksum: lower 8 bits of the sum of all bytes after DLOG_SYNC
+///           All values are little endian. A gap in the sequence shows lost packets
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYDATALOG_H_
+#define MYDATALOG_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: DmaAdcFrameDone() samples the selected variables
+#define DLOG_ENABLE                 1
+// Number of entries in dlogVariableTable
+#define DLOG_NUMBER_OF_VARIABLES    28
+// Largest number of selected variables and the samples per packet
+#define DLOG_MAX_SELECTED           8
+#define DLOG_SAMPLES_PER_PACKET     4
+// Words of the data of a packet (all selected variables of 32 bit)
+#define DLOG_PACKET_WORDS           (DLOG_SAMPLES_PER_PACKET * DLOG_MAX_SELECTED * 2)
+// Bytes of a packet on the UART: header, data and checksum
+#define DLOG_HEADER_BYTES           9
+#define DLOG_FRAME_BYTES            (DLOG_HEADER_BYTES + 2 * DLOG_PACKET_WORDS + 1)
+// Number of packets of the ring (power of two)
+#define DLOG_NUMBER_OF_PACKETS      4
+#define DLOG_PACKET_MASK            (DLOG_NUMBER_OF_PACKETS - 1)
+// Types of the variables
+#define DLOG_TYPE_UINT16            0
+#define DLOG_TYPE_INT16             1
+#define DLOG_TYPE_UINT32            2
+#define DLOG_TYPE_FLOAT32           3
+// Frame bytes
+#define DLOG_REQUEST                0x44
+#define DLOG_SYNC                   0xA8
+#define DLOG_ACK                    0x06
+#define DLOG_NAK                    0x15
+#define DLOG_NO_ANSWER              0xFFFF
+// States of the receiver of the select frame
+#define DLOG_RX_COUNT               0
+#define DLOG_RX_INDEX               1
+#define DLOG_RX_DECIMATION_LOW      2
+#define DLOG_RX_DECIMATION_HIGH     3
+#define DLOG_RX_CHECKSUM            4
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Registration of one variable
+typedef struct
+{
+    const char *name;
+    const volatile void *address;
+    uint16_t type;                  // DLOG_TYPE_x
+} DlogVariable;
+
+// One packet of the ring, "data" holds the 16 bit words of the values in the order of the frame
+typedef struct
+{
+    uint16_t sequence;
+    uint16_t numberOfVariables;
+    uint32_t time;
+    uint16_t numberOfWords;
+    uint16_t data[DLOG_PACKET_WORDS];
+} DlogPacket;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Variables which can be selected by the host (index = number in the select frame)
+extern const DlogVariable dlogVariableTable[DLOG_NUMBER_OF_VARIABLES];
+// Selection of the host (indices of dlogVariableTable) and decimation in DMA frames
+extern uint16_t dlogSelected[DLOG_MAX_SELECTED];
+extern uint16_t dlogNumberOfSelected;
+extern uint16_t dlogDecimation;
+// Samples which were dropped because the ring was full
+extern volatile uint32_t dlogDroppedSamples;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function stops the sampling and clears the ring
+extern void DlogInit(void);
+// Function processes one byte of a select frame, returns true when the frame has ended
+extern bool DlogReceive(uint16_t byte);
+// Function packs the selected variables every "decimation"-th DMA frame (DmaAdcFrameDone())
+extern void DlogSample(void);
+// Function sends the answer and the full packets as far as the transmit FIFO has room
+extern void DlogService(void);
+// Function returns true while a packet is partly sent
+extern bool DlogSending(void);
+
+#endif
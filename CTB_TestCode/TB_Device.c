@@ -5,9 +5,25 @@
 ///             initialise it. To do this, the watchdog timer is switched off, the system clock
 ///             set, the flash memory initialised and the interrupts enabled and initialised.
 ///
-/// @version    V1.2
+///             nderung in Version 1.3: Zeitbasis mit CPU-Timer 2 (INTOSC2, 0,1 us pro Takt) zur
+///             Messung der Boot-Zeit und Schnellstart (DEVICE_FAST_BOOT) ohne feste Wartezeit
+///             fr den externen Oszillator
 ///
-/// @date       13.02.2023
+///             nderung in Version 1.4: Die Zeitbasis wird nach der Takt-Initialisierung auf
+///             den Systemtakt umgeschaltet (5 ns pro Takt). DELAY_US() wartet mit der Zeitbasis
+///             (DeviceDelayUs()) statt mit einer Warteschleife, dazu Fristen fr nicht
+///             blockierende Wartezeiten (DeviceDeadline(), DeviceDeadlineReached())
+///
+///             nderung in Version 1.5: Stack-berwachung mit Fllmuster (DeviceStackPaint()),
+///             High-Water-Mark und Schutzbereich (DeviceStackService()) und optionalem
+///             Hardware-Watchpoint (ERAD) auf den Schutzbereich
+///
+///             nderung in Version 1.6: Die RAM-Sektionen werden mit DeviceCopyWords() (32-Bit-
+///             Zugriffe, je Durchlauf eine Flash-Zeile von 128 Bit) statt mit memcpy() kopiert
+///
+/// @version    V1.6
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -20,6 +36,48 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Belegung des Stacks (im Debugger sichtbar)
+DeviceStackInfo deviceStack;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU1
+//=== Function: DeviceSwitchTimeBase ==============================================================
+///
+/// @brief  Funktion schaltet die Taktquelle der Zeitbasis (CPU-Timer 2) von INTOSC2 auf den
+///					Systemtakt um. Die bis dahin vergangene Zeit wird in Takte des Systemtakts
+///					umgerechnet und als Startwert geladen, damit DeviceGetTime() weiterhin die Zeit
+///					seit DeviceInitTimeBase() liefert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void DeviceSwitchTimeBase(void)
+{
+		uint32_t elapsed;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		CpuTimer2Regs.TCR.bit.TSS  = 1;
+		elapsed = (DeviceGetTime() / DEVICE_INTOSC2_MHZ) * DEVICE_SYSCLK_MHZ;
+
+		// Taktquelle Systemtakt, Startwert laden und danach den grten Wert als
+		// Periode setzen (wird erst beim nchsten berlauf neu geladen)
+		CpuSysRegs.TMR2CLKCTL.bit.TMR2CLKSRCSEL = DEVICE_TIMER2_CLKSRC_SYSCLK;
+		CpuTimer2Regs.PRD.all      = 0xFFFFFFFFUL - elapsed;
+		CpuTimer2Regs.TCR.bit.TRB  = 1;
+		CpuTimer2Regs.PRD.all      = 0xFFFFFFFFUL;
+		CpuTimer2Regs.TCR.bit.TSS  = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -37,6 +95,9 @@
 //=================================================================================================
 void DeviceInit(uint32_t clockSource)
 {
+		// Freien Teil des Stacks fr die Stack-berwachung fllen
+		DeviceStackPaint();
+
 #ifdef CPU1
 		// bergabeparameter fr die Taktquelle prfen
 		if (   (clockSource == DEVICE_CLKSRC_INTOSC2)
@@ -63,7 +124,7 @@ void DeviceInit(uint32_t clockSource)
 ///					- Speicherinhalte zeitkritischer Funktionen von FLASH in dern RAM kopieren
 ///					- Flash-Speicher fr 200 MHz initialisieren
 ///					- Systemtakt einstellen (interner 10 MHz-Oszillator oder externer (single-ended)
-///																	 25 MHz Oszillator, 200 MHz Systemtakt, 50 MHz Low Speed CLK)
+///             										 25 MHz Oszillator, 200 MHz Systemtakt, 50 MHz Low Speed CLK)
 ///					- Fabrikationsdaten aus dem OTP-Speicher in die ADC-Trimmregister kopieren
 ///					- CPU-Interrupts aus-, PIE-Vectrotabelle ein- und Interrupts global einschalten
 ///
@@ -78,6 +139,9 @@ void DeviceInitCPU1(uint32_t clockSource)
     // Watchdog-Timer ausschalten
     WdRegs.WDCR.bit.WDDIS = 1;
 
+    // Zeitbasis zur Messung der Boot-Zeit starten
+    DeviceInitTimeBase();
+
     // Flash-Speicher initialisieren:
     // Funktion zur Initialisierung des Flash-Speichers zur RAM-Sektion zuordnen
     // (wird ber die .cmd-Datei durch den Linker entsprechen in den RAM kopiert)
@@ -90,7 +154,7 @@ void DeviceInitCPU1(uint32_t clockSource)
     extern Uint16 RamfuncsRunStart, RamfuncsLoadStart, RamfuncsLoadSize;
 #ifdef _FLASH
     // Flash-Initialisierungsfunktion in den RAM-Speicher kopieren
-		memcpy(&RamfuncsRunStart, &RamfuncsLoadStart, (size_t)&RamfuncsLoadSize);
+		DeviceCopyWords(&RamfuncsRunStart, &RamfuncsLoadStart, (uint32_t)&RamfuncsLoadSize);
 		// Flash initialisieren. Muss vom RAM aus aufgerufen werden
 		DeviceInitFlashMemory();
 #endif
@@ -226,8 +290,13 @@ void DeviceInitCPU1(uint32_t clockSource)
 				ClkCfgRegs.XTALCR.bit.OSCOFF = 0;
 				// Betriebsart auf Single-Ended setzen
 				ClkCfgRegs.XTALCR.bit.SE = 1;
-				// Kurz warten bis der Oszillator eingeschaltet und eingeschwungen ist
-				DELAY_US(1000);
+#if !DEVICE_FAST_BOOT
+				// Kurz warten bis der Oszillator eingeschaltet und eingeschwungen ist.
+				// Beim Schnellstart entfllt diese Wartezeit, da der folgende Flanken-
+				// zhler ohnehin erst dann durchluft, wenn der Oszillator schwingt
+				// (Warteschleife, da die Zeitbasis noch mit INTOSC2 luft)
+				DEVICE_DELAY_US_LOOP(1000);
+#endif
 				// Vier mal den Flankenzhler von Pin X1 zurcksetzen
 				// (siehe S. 248 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
 				for (uint32_t i=0; i<4; i++)
@@ -352,6 +421,9 @@ void DeviceInitCPU1(uint32_t clockSource)
     		__asm(" ESTOP0");
     }
 
+    // Systemtakt ist eingestellt -> Zeitbasis auf den Systemtakt umschalten
+    DeviceSwitchTimeBase();
+
     // Funktion kalibriert ADC-Referenz, DAC-Offset und die internen Oszillatoren
     DEVICE_CALIBRATION();
 
@@ -426,9 +498,12 @@ void DeviceInitCPU2(void)
     extern Uint16 RamfuncsRunStart, RamfuncsLoadStart, RamfuncsLoadSize;
 #ifdef _FLASH
     // Flash-Initialisierungsfunktion in den RAM-Speicher kopieren
-		memcpy(&RamfuncsRunStart, &RamfuncsLoadStart, (size_t)&RamfuncsLoadSize);
+		DeviceCopyWords(&RamfuncsRunStart, &RamfuncsLoadStart, (uint32_t)&RamfuncsLoadSize);
 #endif
 
+		// Zeitbasis fr DELAY_US() starten (Systemtakt, von CPU1 bereits eingestellt)
+		DeviceInitTimeBase();
+
 		// Register-Schreibschutz aufheben
 		EALLOW;
 
@@ -572,3 +647,274 @@ void DeviceInitFlashMemory(void)
 		// Register-Schreibschutz setzen
 		EDIS;
 }
+
+
+//=== Function: DeviceInitTimeBase ================================================================
+///
+/// @brief  Funktion startet CPU-Timer 2 als freilaufende Zeitbasis. Auf CPU1 wird der Timer
+///					zunchst mit dem internen Oszillator INTOSC2 getaktet, damit die Zeit auch whrend
+///					der Umschaltung des Systemtakts (PLL) gleichmig weiterluft. Danach schaltet
+///					DeviceSwitchTimeBase() auf den Systemtakt um. Auf CPU2 luft der Timer direkt mit
+///					dem Systemtakt (DEVICE_TIME_TICKS_PER_US Takte pro us, berlauf nach ca. 21 s)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceInitTimeBase(void)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Taktquelle ohne Vorteiler
+#ifdef CPU1
+		CpuSysRegs.TMR2CLKCTL.bit.TMR2CLKSRCSEL   = DEVICE_TIMER2_CLKSRC_INTOSC2;
+#else
+		CpuSysRegs.TMR2CLKCTL.bit.TMR2CLKSRCSEL   = DEVICE_TIMER2_CLKSRC_SYSCLK;
+#endif
+		CpuSysRegs.TMR2CLKCTL.bit.TMR2CLKPRESCALE = 0;
+
+		// Timer anhalten, Interrupt ausschalten und mit dem grten Wert starten
+		CpuTimer2Regs.TCR.bit.TSS  = 1;
+		CpuTimer2Regs.TCR.bit.TIE  = 0;
+		CpuTimer2Regs.PRD.all      = 0xFFFFFFFFUL;
+		CpuTimer2Regs.TPR.all      = 0;
+		CpuTimer2Regs.TPRH.all     = 0;
+		CpuTimer2Regs.TCR.bit.TRB  = 1;
+		CpuTimer2Regs.TCR.bit.TSS  = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: DeviceGetTime =====================================================================
+///
+/// @brief  Funktion gibt die Zeit seit DeviceInitTimeBase() in Takten von CPU-Timer 2 zurck
+///					(DEVICE_TIME_TICKS_PER_US Takte pro us). Der Timer zhlt abwrts
+///
+/// @param  void
+///
+/// @return uint32_t ticks
+///
+//=================================================================================================
+uint32_t DeviceGetTime(void)
+{
+		return 0xFFFFFFFFUL - CpuTimer2Regs.TIM.all;
+}
+
+
+//=== Function: DeviceWaitSince ===================================================================
+///
+/// @brief  Funktion wartet, bis seit dem Zeitpunkt "start" (Rckgabewert von DeviceGetTime())
+///					die Zeit "timeUs" vergangen ist. Ist die Zeit bereits vergangen (z.B. weil in der
+///					Zwischenzeit andere Module initialisiert wurden), kehrt die Funktion sofort zurck
+///
+/// @param  uint32_t start, uint32_t timeUs
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceWaitSince(uint32_t start, uint32_t timeUs)
+{
+		uint32_t ticks = timeUs * DEVICE_TIME_TICKS_PER_US;
+
+		while ((DeviceGetTime() - start) < ticks);
+}
+
+
+//=== Function: DeviceDelayUs =====================================================================
+///
+/// @brief  Funktion wartet die Zeit "timeUs" mit der Zeitbasis (CPU-Timer 2). Anders als die
+///					Warteschleife F28x_usDelay() hngt die Wartezeit nicht vom Speicher ab, aus dem der
+///					Code ausgefhrt wird, und Interrupts verlngern sie nicht. Lange Wartezeiten werden
+///					in Abschnitte von DEVICE_DEADLINE_MAX_US aufgeteilt
+///
+/// @param  uint32_t timeUs
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceDelayUs(uint32_t timeUs)
+{
+		uint32_t start = DeviceGetTime();
+		uint32_t part;
+
+		while (timeUs > 0)
+		{
+				part = (timeUs > DEVICE_DEADLINE_MAX_US) ? DEVICE_DEADLINE_MAX_US : timeUs;
+				DeviceWaitSince(start, part);
+				start += part * DEVICE_TIME_TICKS_PER_US;
+				timeUs -= part;
+		}
+}
+
+
+//=== Function: DeviceDeadline ====================================================================
+///
+/// @brief  Funktion gibt den Zeitpunkt zurck, der "timeUs" nach dem aktuellen Zeitpunkt liegt.
+///					Die Frist wird mit DeviceDeadlineReached() geprft (hchstens DEVICE_DEADLINE_MAX_US)
+///
+/// @param  uint32_t timeUs
+///
+/// @return uint32_t deadline
+///
+//=================================================================================================
+uint32_t DeviceDeadline(uint32_t timeUs)
+{
+		if (timeUs > DEVICE_DEADLINE_MAX_US)
+				timeUs = DEVICE_DEADLINE_MAX_US;
+
+		return DeviceGetTime() + timeUs * DEVICE_TIME_TICKS_PER_US;
+}
+
+
+//=== Function: DeviceDeadlineReached =============================================================
+///
+/// @brief  Funktion gibt true zurck, wenn die Frist "deadline" (Rckgabewert von
+///					DeviceDeadline()) erreicht ist. Der Vergleich ber die vorzeichenbehaftete
+///					Differenz ist auch beim berlauf der Zeitbasis richtig
+///
+/// @param  uint32_t deadline
+///
+/// @return bool reached
+///
+//=================================================================================================
+bool DeviceDeadlineReached(uint32_t deadline)
+{
+		return (int32_t)(DeviceGetTime() - deadline) >= 0;
+}
+
+
+//=== Function: DeviceCopyWords ===================================================================
+///
+/// @brief  Funktion kopiert "size" Worte von "source" nach "destination". Sind beide Adressen
+///					gerade (ALIGN(8) im Linker-Skript), wird mit 32-Bit-Zugriffen kopiert und je
+///					Durchlauf eine Flash-Zeile (128 Bit, 8 Worte) gelesen. Das halbiert die
+///					Zugriffe gegenber memcpy() und die Schleife kostet nur einmal je Zeile. Der DMA
+///					kann nicht genutzt werden, da er keinen Zugriff auf den Flash hat. Die Funktion
+///					liegt im Flash (.text), da sie .TI.ramfunc kopiert
+///
+/// @param  void *destination, const void *source, uint32_t size (in Worten)
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceCopyWords(void *destination, const void *source, uint32_t size)
+{
+		uint16_t *destination16 = (uint16_t *)destination;
+		const uint16_t *source16 = (const uint16_t *)source;
+
+		if ((((uint32_t)destination16 | (uint32_t)source16) & 1UL) == 0)
+		{
+				uint32_t *destination32 = (uint32_t *)destination16;
+				const uint32_t *source32 = (const uint32_t *)source16;
+				uint32_t lines = size >> 3;
+
+				while (lines-- > 0)
+				{
+						destination32[0] = source32[0];
+						destination32[1] = source32[1];
+						destination32[2] = source32[2];
+						destination32[3] = source32[3];
+						destination32 += 4;
+						source32 += 4;
+				}
+				destination16 = (uint16_t *)destination32;
+				source16 = (const uint16_t *)source32;
+				size &= 7;
+		}
+
+		// Rest (oder ungerade Adressen) wortweise
+		while (size-- > 0)
+		{
+				*destination16++ = *source16++;
+		}
+}
+
+
+//=== Function: DeviceStackPaint ==================================================================
+///
+/// @brief  Funktion fllt den Stack oberhalb des aktuellen Stackpointers (plus
+///					DEVICE_STACK_PAINT_MARGIN Worte) bis zum Ende mit DEVICE_STACK_PAINT_PATTERN. Der
+///					Stack wchst auf dem C28x zu hheren Adressen, Anfang und Gre kommen aus dem
+///					Linker-Skript (RUN_START/RUN_SIZE von .stack). Mit DEVICE_STACK_GUARD_WATCHPOINT = 1
+///					wird zustzlich der Bus-Komparator 1 des ERAD so eingestellt, dass die CPU bei einem
+///					Schreibzugriff in den Schutzbereich (letzte DEVICE_STACK_GUARD_WORDS Worte) anhlt.
+///					Wird am Anfang von DeviceInit() aufgerufen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceStackPaint(void)
+{
+    extern Uint16 DeviceStackStart, DeviceStackSize;
+		uint16_t marker = 0;
+		volatile uint16_t *word = &marker + DEVICE_STACK_PAINT_MARGIN;
+		volatile uint16_t *end = &DeviceStackStart + (uint16_t)(uintptr_t)&DeviceStackSize;
+
+		while (word < end)
+				*word++ = DEVICE_STACK_PAINT_PATTERN;
+
+		deviceStack.size = (uint16_t)(uintptr_t)&DeviceStackSize;
+		deviceStack.used = 0;
+		deviceStack.free = deviceStack.size;
+		deviceStack.guardHit = 0;
+
+#if DEVICE_STACK_GUARD_WATCHPOINT
+		// Register-Schreibschutz aufheben
+		EALLOW;
+		EradGlobalRegs.GLBL_OWNER.bit.OWNER = DEVICE_ERAD_OWNER_APPLICATION;
+		EradGlobalRegs.GLBL_ENABLE.bit.HWBP1 = 0;
+		EradHWBP1Regs.HWBP_CLEAR.bit.EVENT_CLR = 1;
+		// Vergleich nur der oberen Adressbits, damit jede Adresse des Schutzbereichs trifft
+		EradHWBP1Regs.HWBP_MASK = DEVICE_STACK_GUARD_WORDS - 1;
+		EradHWBP1Regs.HWBP_REF  = (uint32_t)(uintptr_t)(end - DEVICE_STACK_GUARD_WORDS)
+														& ~(uint32_t)(DEVICE_STACK_GUARD_WORDS - 1);
+		EradHWBP1Regs.HWBP_CNTL.bit.BUS_SEL   = DEVICE_ERAD_BUS_DWAB;
+		EradHWBP1Regs.HWBP_CNTL.bit.COMP_MODE = DEVICE_ERAD_COMPARE_EQUAL;
+		EradHWBP1Regs.HWBP_CNTL.bit.RTOSINT   = 0;
+		EradHWBP1Regs.HWBP_CNTL.bit.STOP      = 1;
+		EradGlobalRegs.GLBL_ENABLE.bit.HWBP1 = 1;
+		// Register-Schreibschutz setzen
+		EDIS;
+#endif
+}
+
+
+//=== Function: DeviceStackService ================================================================
+///
+/// @brief  Funktion sucht vom Ende des Stacks abwrts das erste Wort, das nicht mehr das
+///					Fllmuster enthlt, und aktualisiert damit "deviceStack" (maximale Belegung seit
+///					DeviceInit()). Wurde ein Wort im Schutzbereich beschrieben oder hat der Watchpoint
+///					ausgelst, wird "deviceStack.guardHit" gesetzt. Sollte zyklisch in der Dauerschleife
+///					aufgerufen werden, die Laufzeit ist proportional zum freien Teil des Stacks
+///
+/// @param  void
+///
+/// @return uint16_t used
+///
+//=================================================================================================
+uint16_t DeviceStackService(void)
+{
+    extern Uint16 DeviceStackStart;
+		volatile uint16_t *start = &DeviceStackStart;
+		uint16_t used = deviceStack.size;
+
+		while (used > deviceStack.used && start[used - 1] == DEVICE_STACK_PAINT_PATTERN)
+				used--;
+
+		deviceStack.used = used;
+		deviceStack.free = deviceStack.size - used;
+		if (deviceStack.free < DEVICE_STACK_GUARD_WORDS)
+				deviceStack.guardHit = 1;
+#if DEVICE_STACK_GUARD_WATCHPOINT
+		if (EradHWBP1Regs.HWBP_STATUS.bit.EVENT_FIRED)
+				deviceStack.guardHit = 1;
+#endif
+
+		return used;
+}
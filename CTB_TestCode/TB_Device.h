@@ -5,9 +5,32 @@
 ///             initialise it. To do this, the watchdog timer is switched off, the system clock
 ///             set, the flash memory initialised and the interrupts enabled and initialised.
 ///
-/// @version    V1.2
+///             nderung in Version 1.3: Zeitbasis mit CPU-Timer 2 (INTOSC2, 0,1 us pro Takt) zur
+///             Messung der Boot-Zeit und Schnellstart (DEVICE_FAST_BOOT) ohne feste Wartezeit
+///             fr den externen Oszillator
 ///
-/// @date       13.02.2023
+///             nderung in Version 1.4: Die Zeitbasis luft nach der Takt-Initialisierung mit
+///             dem Systemtakt (DEVICE_SYSCLK_MHZ). DELAY_US() nutzt die Zeitbasis statt einer
+///             Warteschleife mit long-double-Rechnung, dazu Fristen (Deadlines) fr nicht
+///             blockierende Wartezeiten
+///
+///             nderung in Version 1.5: Stack-berwachung. DeviceInit() fllt den freien Teil des
+///             Stacks mit DEVICE_STACK_PAINT_PATTERN, DeviceStackService() bestimmt daraus die
+///             maximale Belegung (High-Water-Mark) und prft einen Schutzbereich am Ende des
+///             Stacks, optional mit einem Hardware-Watchpoint (ERAD)
+///
+///             nderung in Version 1.6: Build-Profile. Mit DEVICE_BUILD_PERFORMANCE (Build-
+///             Konfiguration CPUx_FLASH_PERF) entfallen DEVICE_ASSERT() und die Messungen
+///             (DEVICE_INSTRUMENTATION)
+///
+///             nderung in Version 1.7: DeviceCopyWords() kopiert die RAM-Sektionen (.TI.ramfunc,
+///             CLA-Programm) beim Booten mit 32-Bit-Zugriffen statt mit memcpy(). Groe Puffer, die
+///             von ihrer Init-Funktion gesetzt werden, liegen in "noinitbuf" (type=NOINIT) und werden
+///             nicht vom C-Startup mit Null beschrieben
+///
+/// @version    V1.7
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -20,7 +43,9 @@
 #include "f2838x_cla_typedefs.h"
 // Header zur Nutzung der Registernamen und Einbindung von Standard-Bibliotheken
 #include "f2838x_device.h"
-#include "stdio.h"
+// memcpy(), ohne stdio.h: printf() ber .cio hlt die CPU bei jedem Aufruf an (Diagnose
+// stattdessen mit TB_Log)
+#include "string.h"
 #include "math.h"
 
 
@@ -50,14 +75,52 @@
 #define DEVICE_CPU2_SET_RESET										1
 #define DEVICE_CPU2_IS_NOT_IN_RESET							1
 #define DEVICE_CPU2_IS_IN_RESET									0
+// Schnellstart: Statusbits (Flankenzhler X1, PLL-Lock) abfragen
+// statt fester Wartezeiten
+// 0: feste Wartezeiten wie bisher
+// 1: Schnellstart
+#define DEVICE_FAST_BOOT												1
+// Systemtakt in MHz (muss zur Konfiguration der PLL passen)
+#define DEVICE_SYSCLK_MHZ												200UL
+// Zeitbasis (CPU-Timer 2): Taktquelle INTOSC2 (10 MHz, unabhngig von der PLL)
+// whrend der Takt-Initialisierung, danach der Systemtakt
+#define DEVICE_TIMER2_CLKSRC_SYSCLK							0
+#define DEVICE_TIMER2_CLKSRC_INTOSC2						2
+#define DEVICE_INTOSC2_MHZ											10UL
+#define DEVICE_TIME_TICKS_PER_US								DEVICE_SYSCLK_MHZ
+// Lngste Wartezeit einer Frist in us (halber Zhlbereich der Zeitbasis, ca. 10 s)
+#define DEVICE_DEADLINE_MAX_US									(0x7FFFFFFFUL / DEVICE_TIME_TICKS_PER_US)
+// Stack-berwachung: Fllmuster der unbenutzten Worte und Abstand zum aktuellen Stackpointer
+// beim Fllen in Worten (der Stack wchst zu hheren Adressen)
+#define DEVICE_STACK_PAINT_PATTERN							0xA5C3
+#define DEVICE_STACK_PAINT_MARGIN								16
+// Gre des Schutzbereichs am Ende des Stacks in Worten (Zweierpotenz)
+#define DEVICE_STACK_GUARD_WORDS								8
+// Hardware-Watchpoint (ERAD, Bus-Komparator 1) auf den Schutzbereich
+// 0: aus
+// 1: CPU hlt bei einem Schreibzugriff in den Schutzbereich an (Debugger verbunden)
+#define DEVICE_STACK_GUARD_WATCHPOINT						0
+// ERAD: Owner Anwendung, Bus "Data Write Address" und Vergleich auf Gleichheit
+// (siehe Kapitel ERAD, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define DEVICE_ERAD_OWNER_APPLICATION						1
+#define DEVICE_ERAD_BUS_DWAB										4
+#define DEVICE_ERAD_COMPARE_EQUAL								0
+// Build-Profil, wird ber die Predefined Symbols der Build-Konfiguration gewhlt:
+// CPUx_RAM, CPUx_FLASH (DEBUG):	ohne Optimierung, Prfungen und Messungen eingeschaltet
+// CPUx_FLASH_PERF (DEVICE_BUILD_PERFORMANCE, NDEBUG): -O4 und --opt_for_speed=5, Prfungen
+//						(DEVICE_ASSERT()) und Messungen (z.B. die Stack-berwachung) ausgeschaltet
+#if defined(DEVICE_BUILD_PERFORMANCE)
+#define DEVICE_INSTRUMENTATION									0
+#else
+#define DEVICE_INSTRUMENTATION									1
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
-// Delay-Funktion
-// 200 MHz SYSCLK
-#define DEVICE_CPU_RATE   											5.00L
+// Warteschleife (nur whrend der Takt-Initialisierung, solange die Zeitbasis
+// noch nicht mit dem Systemtakt luft)
 // 190 MHz SYSCLK
 //#define DEVICE_CPU_RATE   5.263L
 // 180 MHz SYSCLK
@@ -75,7 +138,19 @@
 // 120 MHz SYSCLK
 //#define DEVICE_CPU_RATE   8.333L
 extern void F28x_usDelay(long LoopCount);
-#define DELAY_US(A)  														F28x_usDelay(((((long double) A * 1000.0L) / (long double)DEVICE_CPU_RATE) - 9.0L) / 5.0L)
+// Dauer eines Systemtakts in ns
+#define DEVICE_CPU_RATE   											(1000.0L / DEVICE_SYSCLK_MHZ)
+#define DEVICE_DELAY_US_LOOP(A)  								F28x_usDelay(((((long double) A * 1000.0L) / (long double)DEVICE_CPU_RATE) - 9.0L) / 5.0L)
+// Delay-Funktion mit der Zeitbasis (ohne Gleitkommarechnung)
+#define DELAY_US(A)  														DeviceDelayUs((uint32_t)(A))
+
+// Prfung einer Bedingung, bei einer Verletzung hlt die CPU an (ESTOP0, Debugger verbunden).
+// Mit DEVICE_BUILD_PERFORMANCE wird die Bedingung nicht ausgewertet (keine Nebeneffekte verwenden)
+#if defined(DEVICE_BUILD_PERFORMANCE)
+#define DEVICE_ASSERT(expr)											((void)0)
+#else
+#define DEVICE_ASSERT(expr)											do { if (!(expr)) { __asm(" ESTOP0"); } } while (0)
+#endif
 
 // Makro zeigt auf Funktion, welche die ADC-Referenz, den DAC-Offset
 // und die internen Oszillatoren kalibriert (direkt bernommen aus
@@ -83,9 +158,24 @@ extern void F28x_usDelay(long LoopCount);
 #define DEVICE_CALIBRATION ((void (*)(void))((uintptr_t)0x70260))
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Belegung des Stacks (in Worten)
+typedef struct
+{
+		uint16_t size;												// Gre des Stacks (.stack im Linker-Skript)
+		uint16_t used;												// maximale Belegung seit DeviceInit()
+		uint16_t free;												// nie benutzte Worte
+		uint16_t guardHit;										// 1: Schutzbereich wurde beschrieben
+} DeviceStackInfo;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Belegung des Stacks (im Debugger sichtbar)
+extern DeviceStackInfo deviceStack;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -106,6 +196,24 @@ void DeviceInitCPU2(void);
 void DeviceBootCPU2(void);
 // Funktion initialisert den Flash-Speicher fr 100 MHz Systemtakt
 void DeviceInitFlashMemory(void);
+// Funktion startet die Zeitbasis (CPU-Timer 2) zur Messung der Boot-Zeit
+void DeviceInitTimeBase(void);
+// Funktion gibt die Zeit seit dem Start der Zeitbasis in Takten (0,1 us) zurck
+uint32_t DeviceGetTime(void);
+// Funktion wartet, bis seit dem Zeitpunkt "start" die Zeit "timeUs" vergangen ist
+void DeviceWaitSince(uint32_t start, uint32_t timeUs);
+// Funktion wartet die Zeit "timeUs"
+void DeviceDelayUs(uint32_t timeUs);
+// Funktion gibt den Zeitpunkt in "timeUs" zurck (Frist fr DeviceDeadlineReached())
+uint32_t DeviceDeadline(uint32_t timeUs);
+// Funktion gibt true zurck, wenn die Frist "deadline" erreicht ist
+bool DeviceDeadlineReached(uint32_t deadline);
+// Funktion kopiert "size" Worte von "source" nach "destination" (Flash -> RAM beim Booten)
+void DeviceCopyWords(void *destination, const void *source, uint32_t size);
+// Funktion fllt den freien Teil des Stacks mit dem Fllmuster
+void DeviceStackPaint(void);
+// Funktion bestimmt die maximale Belegung des Stacks und prft den Schutzbereich
+uint16_t DeviceStackService(void);
 
 
 #endif
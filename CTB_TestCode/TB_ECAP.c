@@ -0,0 +1,313 @@
+//=================================================================================================
+/// @file     TB_ECAP.c
+///
+/// @brief    File contains the capture driver for feedback signals. All eCAP modules capture in
+///           delta mode (counter reset on every edge), CAP1 to CAP4 hold low, high, low and high
+///           time of the last two periods. The signals come from the input path of the GPIOs
+///           through the input X-BAR, so PWM outputs can be measured on their own pins
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_ECAP.h"
+#include "TB_DMA.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// eCAP1..4: ePWM1A..4A (PWM_LEDs), eCAP5/6: reset lines of the hardware error detection
+// (GPIO98, GPIO10). Any GPIO input can be used, e.g. for an external tach signal
+const EcapConfig ecapConfigTable[ECAP_NUMBER_OF_CHANNELS] =
+{
+    // regs       module pin  readout
+    {&ECap1Regs,  1,     145, ECAP_READ_DMA},
+    {&ECap2Regs,  2,     147, ECAP_READ_CPU},
+    {&ECap3Regs,  3,     149, ECAP_READ_CPU},
+    {&ECap4Regs,  4,     151, ECAP_READ_CPU},
+    {&ECap5Regs,  5,      98, ECAP_READ_CPU},
+    {&ECap6Regs,  6,      10, ECAP_READ_CPU}
+};
+EcapMeasurement ecapMeasurement[ECAP_NUMBER_OF_CHANNELS];
+// History of the DMA channel (the DMA can not access the LSx RAM, therefore GSx RAM is used)
+#pragma DATA_SECTION(ecapDmaHistory, "ramgs6");
+uint32_t ecapDmaHistory[ECAP_DMA_HISTORY][ECAP_NUMBER_OF_CAPTURES];
+// Input X-BAR outputs INPUT7 to INPUT12 of eCAP1 to eCAP6
+volatile uint16_t *const ecapXbarSelect[ECAP_NUMBER_OF_CHANNELS] =
+{
+    &InputXbarRegs.INPUT7SELECT,
+    &InputXbarRegs.INPUT8SELECT,
+    &InputXbarRegs.INPUT9SELECT,
+    &InputXbarRegs.INPUT10SELECT,
+    &InputXbarRegs.INPUT11SELECT,
+    &InputXbarRegs.INPUT12SELECT
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EcapInitDma =======================================================================
+///
+/// @brief  Function configures DMA CH6 to copy CAP1 to CAP4 of an eCAP module after every fourth
+///         edge into the next entry of ecapDmaHistory (one burst of four 32 bit words, the
+///         channel runs continuously and starts again with the first entry)
+///
+/// @param  const EcapConfig *config
+///
+/// @return void
+///
+//=================================================================================================
+static void EcapInitDma(const EcapConfig *config)
+{
+    volatile struct CH_REGS *channel = &DmaRegs.CH6;
+
+    ClockRequest(CLOCK_DMA);
+    DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+    channel->CONTROL.bit.SOFTRESET = 1;
+    __asm(" NOP");
+
+    channel->SRC_BEG_ADDR_SHADOW = (uint32_t)&config->regs->CAP1;
+    channel->SRC_ADDR_SHADOW = (uint32_t)&config->regs->CAP1;
+    channel->DST_BEG_ADDR_SHADOW = (uint32_t)&ecapDmaHistory[0][0];
+    channel->DST_ADDR_SHADOW = (uint32_t)&ecapDmaHistory[0][0];
+
+    // Sizes and steps in 16 bit words: CAP1..CAP4 are four consecutive 32 bit registers
+    channel->BURST_SIZE.bit.BURSTSIZE = 2 * ECAP_NUMBER_OF_CAPTURES - 1;
+    channel->SRC_BURST_STEP = 2;
+    channel->DST_BURST_STEP = 2;
+    channel->TRANSFER_SIZE = ECAP_DMA_HISTORY - 1;
+    channel->SRC_TRANSFER_STEP = -2 * (ECAP_NUMBER_OF_CAPTURES - 1);   // From CAP4 back to CAP1
+    channel->DST_TRANSFER_STEP = 2;                                    // To the next entry
+    channel->SRC_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->SRC_WRAP_STEP = 0;
+    channel->DST_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->DST_WRAP_STEP = 0;
+
+    DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6 = ECAP_DMA_TRIGGER_ECAP1 + config->module - 1;
+    channel->MODE.bit.PERINTSEL = 6;
+    channel->MODE.bit.PERINTE = 1;
+    channel->MODE.bit.OVRINTE = 0;
+    channel->MODE.bit.ONESHOT = 0;
+    channel->MODE.bit.CONTINUOUS = 1;   // Start again with the first entry of the history
+    channel->MODE.bit.DATASIZE = DMA_DATA_SIZE_32_BIT;
+    channel->MODE.bit.CHINTE = 0;
+    channel->CONTROL.bit.PERINTCLR = 1;
+    channel->CONTROL.bit.ERRCLR = 1;
+
+    config->regs->ECCTL2.bit.DMAEVTSEL = ECAP_DMA_EVENT_CEVT4;
+
+    channel->CONTROL.bit.RUN = 1;
+}
+
+//=== Function: EcapUpdate ========================================================================
+///
+/// @brief  Function writes one new period into the measurement of a channel
+///
+/// @param  EcapMeasurement *result, uint32_t highCycles, uint32_t periodCycles
+///
+/// @return void
+///
+//=================================================================================================
+static void EcapUpdate(EcapMeasurement *result, uint32_t highCycles, uint32_t periodCycles)
+{
+    if (periodCycles == 0)
+        return;
+
+    result->highCycles = highCycles;
+    result->periodCycles = periodCycles;
+    result->frequencyHz = ECAP_CLOCK_HZ / periodCycles;
+    result->duty = (float)highCycles / periodCycles;
+    if (periodCycles < result->minPeriodCycles)
+        result->minPeriodCycles = periodCycles;
+    if (periodCycles > result->maxPeriodCycles)
+        result->maxPeriodCycles = periodCycles;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EcapInitAll =======================================================================
+///
+/// @brief  Function configures all channels of ecapConfigTable: input X-BAR, eCAP module in
+///         continuous delta mode (CAP1 rising, CAP2 falling, CAP3 rising, CAP4 falling edge,
+///         counter reset on every edge) and DMA CH6 for the ECAP_READ_DMA channel. The GPIOs
+///         are not changed. DmaInitAdcCapture() resets the DMA, so it has to be called before
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EcapInitAll(void)
+{
+    EALLOW;
+
+    for (uint16_t i = 0; i < ECAP_NUMBER_OF_CHANNELS; i++)
+    {
+        const EcapConfig *config = &ecapConfigTable[i];
+        volatile struct ECAP_REGS *regs = config->regs;
+
+        ClockRequest(CLOCK_ECAP(config->module));   // Clock of the eCAP module
+
+        // Input path of the pin to the eCAP module (INPUTSEL 0..15: INPUTXBAR1..16)
+        *ecapXbarSelect[config->module - 1] = config->pin;
+        regs->ECCTL0.bit.INPUTSEL = ECAP_FIRST_XBAR_INPUT + config->module - 2;
+
+        regs->ECCTL2.bit.TSCTRSTOP = 0;
+        regs->ECEINT.all = 0;
+        regs->ECCLR.all = 0xFFFF;
+
+        regs->ECCTL1.bit.CAP1POL = ECAP_RISING_EDGE;
+        regs->ECCTL1.bit.CAP2POL = ECAP_FALLING_EDGE;
+        regs->ECCTL1.bit.CAP3POL = ECAP_RISING_EDGE;
+        regs->ECCTL1.bit.CAP4POL = ECAP_FALLING_EDGE;
+        regs->ECCTL1.bit.CTRRST1 = 1;   // Delta mode: every capture holds the time since the last edge
+        regs->ECCTL1.bit.CTRRST2 = 1;
+        regs->ECCTL1.bit.CTRRST3 = 1;
+        regs->ECCTL1.bit.CTRRST4 = 1;
+        regs->ECCTL1.bit.PRESCALE = 0;
+        regs->ECCTL1.bit.CAPLDEN = 1;
+        regs->ECCTL1.bit.FREE_SOFT = 3;   // Keep capturing while the CPU is halted
+
+        regs->ECCTL2.bit.CAP_APWM = 0;
+        regs->ECCTL2.bit.CONT_ONESHT = 0;   // Continuous, wrap after CEVT4
+        regs->ECCTL2.bit.STOP_WRAP = ECAP_NUMBER_OF_CAPTURES - 1;
+        regs->ECCTL2.bit.SYNCI_EN = 0;
+
+        ecapMeasurement[i].valid = false;
+        ecapMeasurement[i].updates = 0;
+        ecapMeasurement[i].minPeriodCycles = 0xFFFFFFFFUL;
+        ecapMeasurement[i].maxPeriodCycles = 0;
+        ecapMeasurement[i].lastUpdate = DeviceGetTime();
+
+        if (config->readout == ECAP_READ_DMA)
+        {
+            for (uint16_t j = 0; j < ECAP_DMA_HISTORY; j++)
+                for (uint16_t k = 0; k < ECAP_NUMBER_OF_CAPTURES; k++)
+                    ecapDmaHistory[j][k] = 0;
+            EcapInitDma(config);
+        }
+
+        regs->TSCTR = 0;
+        regs->ECCTL2.bit.TSCTRSTOP = 1;
+        regs->ECCTL2.bit.REARM = 1;
+    }
+
+    EDIS;
+}
+
+//=== Function: EcapRead ==========================================================================
+///
+/// @brief  Function reads the last complete period of a channel (CAP3 low time followed by
+///         CAP4 high time) if a new one was captured since the last call. CAP3 and CAP4 are
+///         only written again two edges after the flag, so both values belong to one period
+///
+/// @param  uint16_t channel, uint32_t *highCycles, uint32_t *periodCycles
+///
+/// @return bool new period (false: no new period or invalid channel)
+///
+//=================================================================================================
+bool EcapRead(uint16_t channel, uint32_t *highCycles, uint32_t *periodCycles)
+{
+    volatile struct ECAP_REGS *regs;
+    uint32_t low;
+
+    if (channel >= ECAP_NUMBER_OF_CHANNELS)
+        return false;
+
+    regs = ecapConfigTable[channel].regs;
+    if (regs->ECFLG.bit.CEVT4 == 0)
+        return false;
+    regs->ECCLR.bit.CEVT4 = 1;
+
+    low = regs->CAP3;
+    *highCycles = regs->CAP4;
+    *periodCycles = low + *highCycles;
+    return true;
+}
+
+//=== Function: EcapService =======================================================================
+///
+/// @brief  Function updates ecapMeasurement of all channels. For the DMA channel the minimum
+///         and maximum include every period of the history (two per entry), so single deviating
+///         periods are found without reading every edge. A channel without a new period within
+///         ECAP_TIMEOUT_US becomes invalid (signal missing or stuck)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EcapService(void)
+{
+    uint32_t now = DeviceGetTime();
+
+    for (uint16_t i = 0; i < ECAP_NUMBER_OF_CHANNELS; i++)
+    {
+        EcapMeasurement *result = &ecapMeasurement[i];
+        uint32_t high;
+        uint32_t period;
+
+        if (EcapRead(i, &high, &period))
+        {
+            if (ecapConfigTable[i].readout == ECAP_READ_DMA)
+            {
+                // Entries not written yet are 0. CAP1 of the very first entry contains the
+                // time since the start of the counter, so only CAP2..CAP4 are used
+                for (uint16_t j = 0; j < ECAP_DMA_HISTORY; j++)
+                {
+                    const uint32_t *capture = ecapDmaHistory[j];
+
+                    if (capture[1] != 0 && capture[2] != 0)
+                        EcapUpdate(result, capture[1], capture[1] + capture[2]);
+                    if (capture[2] != 0 && capture[3] != 0)
+                        EcapUpdate(result, capture[3], capture[2] + capture[3]);
+                }
+            }
+            EcapUpdate(result, high, period);
+            result->updates++;
+            result->lastUpdate = now;
+            result->valid = true;
+        }
+        else if (now - result->lastUpdate > ECAP_TIMEOUT_US * DEVICE_TIME_TICKS_PER_US)
+        {
+            result->valid = false;
+        }
+    }
+}
+
+//=== Function: EcapCheck =========================================================================
+///
+/// @brief  Function checks the last frequency and duty of a channel and its shortest and longest
+///         period against the expected values
+///
+/// @param  uint16_t channel, float frequencyHz, float duty (0.0 .. 1.0),
+///         float tolerance (relative for the frequency, absolute for the duty, e.g. 0.01)
+///
+/// @return bool passed (false: deviation, no valid measurement or invalid channel)
+///
+//=================================================================================================
+bool EcapCheck(uint16_t channel, float frequencyHz, float duty, float tolerance)
+{
+    const EcapMeasurement *result;
+    float expectedPeriod;
+
+    if (channel >= ECAP_NUMBER_OF_CHANNELS || frequencyHz <= 0.0f)
+        return false;
+
+    result = &ecapMeasurement[channel];
+    if (!result->valid)
+        return false;
+
+    expectedPeriod = ECAP_CLOCK_HZ / frequencyHz;
+    return result->minPeriodCycles >= expectedPeriod * (1.0f - tolerance)
+        && result->maxPeriodCycles <= expectedPeriod * (1.0f + tolerance)
+        && result->duty >= duty - tolerance
+        && result->duty <= duty + tolerance;
+}
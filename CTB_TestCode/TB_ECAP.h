@@ -0,0 +1,101 @@
+//=================================================================================================
+/// @file     TB_ECAP.h
+///
+/// @brief    File contains the capture driver for feedback signals (PWM outputs, hardware error
+///           detection lines, external tach signals). Every eCAP module runs continuously in delta
+///           mode: the counter is reset on every edge, so the capture registers hold the low and
+///           high times of the signal directly (CAP1/CAP3 low time, CAP2/CAP4 high time) without
+///           any CPU work. One channel is copied by DMA CH6 after every fourth edge into a
+///           history, so every period is checked at full rate. The other channels are read from
+///           the capture registers
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYECAP_H_
+#define MYECAP_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Clock.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of used eCAP modules (eCAP1 to eCAP6)
+#define ECAP_NUMBER_OF_CHANNELS     6
+// Input X-BAR output of eCAP1, eCAP n uses INPUT(ECAP_FIRST_XBAR_INPUT + n - 1)
+#define ECAP_FIRST_XBAR_INPUT       7
+// Readout of a channel
+#define ECAP_READ_CPU               0
+#define ECAP_READ_DMA               1
+// Trigger source of DMA CH6 for eCAP1 (eCAP n: ECAP_DMA_TRIGGER_ECAP1 + n - 1)
+#define ECAP_DMA_TRIGGER_ECAP1      75
+// DMA event of the eCAP module (ECCTL2.DMAEVTSEL): after the fourth capture
+#define ECAP_DMA_EVENT_CEVT4        3
+// Edge of a capture event (ECCTL1.CAPxPOL)
+#define ECAP_RISING_EDGE            0
+#define ECAP_FALLING_EDGE           1
+// Number of capture registers (CAP1 to CAP4)
+#define ECAP_NUMBER_OF_CAPTURES     4
+// Number of DMA bursts (CAP1 to CAP4 after every fourth edge) in the history of the DMA channel
+#define ECAP_DMA_HISTORY            64
+// A measurement is invalid if no new period was captured within this time (slowest LED PWM
+// plus margin), e.g. the signal is stuck or missing
+#define ECAP_TIMEOUT_US             1000000UL
+// Counter clock of the eCAP modules (SYSCLK)
+#define ECAP_CLOCK_HZ               (DEVICE_SYSCLK_MHZ * 1000000.0f)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Configuration of one capture channel
+typedef struct
+{
+    volatile struct ECAP_REGS *regs;    // eCAP module
+    uint16_t module;                    // 1 .. ECAP_NUMBER_OF_CHANNELS
+    uint16_t pin;                       // GPIO of the captured signal (input path of the pin)
+    uint16_t readout;                   // ECAP_READ_CPU or ECAP_READ_DMA (only one channel)
+} EcapConfig;
+
+// Result of one channel (times in SYSCLK cycles)
+typedef struct
+{
+    uint32_t highCycles;
+    uint32_t periodCycles;
+    float frequencyHz;
+    float duty;                         // 0.0 .. 1.0
+    uint32_t minPeriodCycles;           // Shortest and longest period since EcapInitAll()
+    uint32_t maxPeriodCycles;           // (DMA channel: every period of the history)
+    uint32_t updates;                   // Number of new periods read by EcapService()
+    uint32_t lastUpdate;                // DeviceGetTime() of the last new period
+    bool valid;                         // false: no period within ECAP_TIMEOUT_US
+} EcapMeasurement;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Captured signals of all channels
+extern const EcapConfig ecapConfigTable[ECAP_NUMBER_OF_CHANNELS];
+// Results of all channels, updated by EcapService()
+extern EcapMeasurement ecapMeasurement[ECAP_NUMBER_OF_CHANNELS];
+// CAP1 to CAP4 of the DMA channel, written by DMA CH6 after every fourth edge (ring buffer)
+extern uint32_t ecapDmaHistory[ECAP_DMA_HISTORY][ECAP_NUMBER_OF_CAPTURES];
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function configures the input X-BAR, all eCAP modules of ecapConfigTable and DMA CH6
+extern void EcapInitAll(void);
+// Function reads the last complete period of a channel
+extern bool EcapRead(uint16_t channel, uint32_t *highCycles, uint32_t *periodCycles);
+// Function updates ecapMeasurement of all channels (called from the main loop)
+extern void EcapService(void);
+// Function checks frequency and duty of a channel against expected values
+extern bool EcapCheck(uint16_t channel, float frequencyHz, float duty, float tolerance);
+
+#endif
@@ -0,0 +1,257 @@
+//=================================================================================================
+/// @file     TB_ERAD.c
+///
+/// @brief    File contains the configuration of the ERAD bus comparators and counters for the
+///           profiles of eradProfileTable. The registers follow the chapter ERAD of the Reference
+///           Manual TMS320F2838x, SPRUII0D. See TB_ERAD.h for the measurement
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_ERAD.h"
+#include "TB_Functions.h"
+#include "TB_Sequencer.h"
+#include "TB_ADC.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Profiled functions, ERAD_PROFILE_CYCLES only for ISRs (the exit is their IRET)
+const EradProfileConfig eradProfileTable[ERAD_NUMBER_OF_PROFILES] =
+{
+    // name                 function                                mode
+    {"DmaAdcFrameDone",     ERAD_FUNCTION(DmaAdcFrameDone),         ERAD_PROFILE_CALLS},
+    {"SequencerISR",        ERAD_FUNCTION(SequencerISR),            ERAD_PROFILE_CYCLES},
+    {"ADCtoPWM",            ERAD_FUNCTION(ADCtoPWM),                ERAD_PROFILE_CALLS},
+    {"AdcPpbEventISR",      ERAD_FUNCTION(AdcPpbEventISR),          ERAD_PROFILE_CALLS}
+};
+EradProfile eradProfiles[ERAD_NUMBER_OF_PROFILES];
+bool eradOwned = false;
+// Bus comparators HWBP1 to HWBP8 and counters CTM1 to CTM4
+static volatile struct ERAD_HWBP_REGS *const eradHwbpRegs[ERAD_NUMBER_OF_HWBP] =
+{
+    &EradHWBP1Regs,
+    &EradHWBP2Regs,
+    &EradHWBP3Regs,
+    &EradHWBP4Regs,
+    &EradHWBP5Regs,
+    &EradHWBP6Regs,
+    &EradHWBP7Regs,
+    &EradHWBP8Regs
+};
+static volatile struct ERAD_COUNTER_REGS *const eradCounterRegs[ERAD_NUMBER_OF_COUNTERS] =
+{
+    &EradCounter1Regs,
+    &EradCounter2Regs,
+    &EradCounter3Regs,
+    &EradCounter4Regs
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EradFindIret ======================================================================
+///
+/// @brief  Function searches the first IRET of an ISR from its entry address
+///
+/// @param  uint32_t entry
+///
+/// @return uint32_t address of the IRET (ERAD_NO_ADDRESS if not found)
+///
+//=================================================================================================
+static uint32_t EradFindIret(uint32_t entry)
+{
+    const volatile uint16_t *code = (const volatile uint16_t *)(uintptr_t)entry;
+
+    for (uint16_t i = 0; i < ERAD_MAX_ISR_WORDS; i++)
+    {
+        if (code[i] == ERAD_OPCODE_IRET)
+            return entry + i;
+    }
+    return ERAD_NO_ADDRESS;
+}
+
+//=== Function: EradInitHwbp ======================================================================
+///
+/// @brief  Function sets a bus comparator to an event on the instruction at "address" (no halt,
+///         no RTOS interrupt). EALLOW must be set
+///
+/// @param  uint16_t hwbp (0..7: HWBP1..HWBP8), uint32_t address
+///
+/// @return void
+///
+//=================================================================================================
+static void EradInitHwbp(uint16_t hwbp, uint32_t address)
+{
+    volatile struct ERAD_HWBP_REGS *regs = eradHwbpRegs[hwbp];
+
+    regs->HWBP_CLEAR.bit.EVENT_CLR = 1;
+    regs->HWBP_MASK = 0;
+    regs->HWBP_REF = address;
+    regs->HWBP_CNTL.bit.BUS_SEL = ERAD_BUS_VPC_I_ALIGNED;
+    regs->HWBP_CNTL.bit.COMP_MODE = DEVICE_ERAD_COMPARE_EQUAL;
+    regs->HWBP_CNTL.bit.RTOSINT = 0;
+    regs->HWBP_CNTL.bit.STOP = 0;
+}
+
+//=== Function: EradInitCounter ===================================================================
+///
+/// @brief  Function configures a counter. With ERAD_PROFILE_CYCLES it counts the CPU cycles from
+///         the start to the stop comparator (start-stop mode, restarted from 0 on every start),
+///         with ERAD_PROFILE_CALLS the events of the start comparator. The reference is never
+///         reached, the counter neither halts nor interrupts. EALLOW must be set
+///
+/// @param  uint16_t counter (0..3: CTM1..CTM4), uint16_t mode, uint16_t start, uint16_t stop
+///         (comparators 0..7)
+///
+/// @return void
+///
+//=================================================================================================
+static void EradInitCounter(uint16_t counter, uint16_t mode, uint16_t start, uint16_t stop)
+{
+    volatile struct ERAD_COUNTER_REGS *regs = eradCounterRegs[counter];
+
+    regs->CTM_CNTL.all = 0;
+    regs->CTM_REF = 0xFFFFFFFFUL;
+    regs->CTM_CLEAR.all = 0xFFFF;
+
+    if (mode == ERAD_PROFILE_CYCLES)
+    {
+        regs->CTM_CNTL.bit.EVENT_MODE = ERAD_COUNT_CYCLES;
+        regs->CTM_INPUT_SEL_2.bit.STA_INP_SEL = start;
+        regs->CTM_INPUT_SEL_2.bit.STO_INP_SEL = stop;
+        regs->CTM_CNTL.bit.START_STOP_MODE = 1;
+    }
+    else
+    {
+        regs->CTM_CNTL.bit.EVENT_MODE = ERAD_COUNT_EVENTS;
+        regs->CTM_INPUT_SEL.bit.CNT_INP_SEL = start;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EradInit ==========================================================================
+///
+/// @brief  Function takes the ownership of the ERAD and configures one counter and its
+///         comparators per entry of eradProfileTable, starting with ERAD_FIRST_PROFILE_HWBP.
+///         A cycle profile whose IRET is not found stays inactive. If the debugger owns the
+///         ERAD nothing is configured (eradOwned = false)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EradInit(void)
+{
+    uint16_t hwbp = ERAD_FIRST_PROFILE_HWBP - 1;
+    uint32_t enable = 0;
+
+    for (uint16_t i = 0; i < ERAD_NUMBER_OF_PROFILES; i++)
+    {
+        eradProfiles[i].entry = (uint32_t)(uintptr_t)eradProfileTable[i].function;
+        eradProfiles[i].exit = ERAD_NO_ADDRESS;
+        eradProfiles[i].count = 0;
+        eradProfiles[i].maxCycles = 0;
+        eradProfiles[i].active = false;
+    }
+
+#if ERAD_ENABLE
+    EALLOW;
+    EradGlobalRegs.GLBL_OWNER.bit.OWNER = DEVICE_ERAD_OWNER_APPLICATION;
+    eradOwned = (EradGlobalRegs.GLBL_OWNER.bit.OWNER == DEVICE_ERAD_OWNER_APPLICATION);
+    if (!eradOwned)
+    {
+        EDIS;
+        return;
+    }
+
+    for (uint16_t i = 0; i < ERAD_NUMBER_OF_PROFILES && i < ERAD_NUMBER_OF_COUNTERS; i++)
+    {
+        EradProfile *profile = &eradProfiles[i];
+        uint16_t mode = eradProfileTable[i].mode;
+        uint16_t start = hwbp;
+        uint16_t stop = hwbp;
+
+        if (mode == ERAD_PROFILE_CYCLES)
+        {
+            profile->exit = EradFindIret(profile->entry);
+            if (profile->exit == ERAD_NO_ADDRESS || hwbp + 2 > ERAD_NUMBER_OF_HWBP)
+                continue;
+            stop = hwbp + 1;
+            EradInitHwbp(stop, profile->exit);
+        }
+        else if (hwbp + 1 > ERAD_NUMBER_OF_HWBP)
+        {
+            continue;
+        }
+        EradInitHwbp(start, profile->entry);
+        EradInitCounter(i, mode, start, stop);
+
+        // GLBL_ENABLE: bits 0..7 HWBP1..HWBP8, bits 8..11 CTM1..CTM4
+        enable |= (1UL << start) | (1UL << stop) | (1UL << (8 + i));
+        hwbp = stop + 1;
+        profile->active = true;
+    }
+
+    EradGlobalRegs.GLBL_CTM_RESET.all = (1U << ERAD_NUMBER_OF_COUNTERS) - 1;
+    EradGlobalRegs.GLBL_ENABLE.all |= enable;
+    EDIS;
+#endif
+}
+
+//=== Function: EradClear =========================================================================
+///
+/// @brief  Function resets the counts and the longest runs of all profiles
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EradClear(void)
+{
+    if (!eradOwned)
+        return;
+
+    EALLOW;
+    for (uint16_t i = 0; i < ERAD_NUMBER_OF_PROFILES && i < ERAD_NUMBER_OF_COUNTERS; i++)
+    {
+        eradCounterRegs[i]->CTM_MAX_COUNT = 0;
+        eradProfiles[i].count = 0;
+        eradProfiles[i].maxCycles = 0;
+    }
+    EradGlobalRegs.GLBL_CTM_RESET.all = (1U << ERAD_NUMBER_OF_COUNTERS) - 1;
+    EDIS;
+}
+
+//=== Function: EradRead ==========================================================================
+///
+/// @brief  Function copies the counter of every active profile into eradProfiles: the cycles of
+///         the last run and the longest run or the number of calls. Called by the report
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EradRead(void)
+{
+    for (uint16_t i = 0; i < ERAD_NUMBER_OF_PROFILES && i < ERAD_NUMBER_OF_COUNTERS; i++)
+    {
+        if (!eradProfiles[i].active)
+            continue;
+
+        eradProfiles[i].count = eradCounterRegs[i]->CTM_COUNT;
+        if (eradProfileTable[i].mode == ERAD_PROFILE_CYCLES)
+            eradProfiles[i].maxCycles = eradCounterRegs[i]->CTM_MAX_COUNT;
+    }
+}
@@ -0,0 +1,99 @@
+//=================================================================================================
+/// @file     TB_ERAD.h
+///
+/// @brief    File contains a profiling service with the Embedded Real-time Analysis and Diagnostic
+///           module (ERAD) of CPU1. Every entry of eradProfileTable takes one counter (CTM) and
+///           one or two bus comparators (HWBP), which watch the instruction address of the CPU
+///           (VPC), so the measured code is neither patched nor slowed down:
+///             ERAD_PROFILE_CYCLES: the counter runs in start-stop mode from the first
+///                                  instruction of an ISR to its IRET, CTM_COUNT holds the
+///                                  cycles of the last run, CTM_MAX_COUNT the longest run
+///             ERAD_PROFILE_CALLS:  the counter counts every execution of the first
+///                                  instruction of a function or ISR (calls, interrupts)
+///           The IRET of an ISR is searched from its entry (the compiler emits one epilogue per
+///           ISR). Bus comparator 1 stays free for the stack watchpoint of TB_Device.
+///           EradRead() copies the counters into eradProfiles, the report (TB_Report) sends
+///           them over UART
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYERAD_H_
+#define MYERAD_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: EradInit() configures the profiles of eradProfileTable. The measurement costs no CPU time,
+//    so it is also part of the performance build (DEVICE_BUILD_PERFORMANCE)
+#define ERAD_ENABLE                 1
+// Number of entries in eradProfileTable (one counter each, at most 4)
+#define ERAD_NUMBER_OF_PROFILES     4
+// Bus comparators and counters of the ERAD, the first comparator of the profiles
+#define ERAD_NUMBER_OF_HWBP         8
+#define ERAD_NUMBER_OF_COUNTERS     4
+#define ERAD_FIRST_PROFILE_HWBP     2
+// Modes of a profile
+#define ERAD_PROFILE_CYCLES         0
+#define ERAD_PROFILE_CALLS          1
+// Bus of the comparators: instruction address at the issue of an instruction (VPC, aligned)
+#define ERAD_BUS_VPC_I_ALIGNED      1
+// Counter: count the cycles while the input is active / count the rising edges of the input
+#define ERAD_COUNT_CYCLES           0
+#define ERAD_COUNT_EVENTS           1
+// Opcode of IRET and the longest ISR which is searched for it in words
+#define ERAD_OPCODE_IRET            0x7602
+#define ERAD_MAX_ISR_WORDS          2048
+// Address of a profile whose IRET was not found
+#define ERAD_NO_ADDRESS             0xFFFFFFFFUL
+// Entry of eradProfileTable for a function or ISR of any signature
+#define ERAD_FUNCTION(f)            ((void (*)(void))(f))
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Definition of one profile
+typedef struct
+{
+    const char *name;
+    void (*function)(void);                 // entry address of the function or ISR
+    uint16_t mode;                          // ERAD_PROFILE_x
+} EradProfileConfig;
+
+// Results of one profile (cycles: CPU cycles of the last and the longest run, calls: count)
+typedef struct
+{
+    uint32_t entry;
+    uint32_t exit;                          // address of the IRET (ERAD_PROFILE_CYCLES)
+    uint32_t count;                         // cycles of the last run or number of calls
+    uint32_t maxCycles;
+    bool active;                            // comparators and counter are configured
+} EradProfile;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Profiled functions and their results
+extern const EradProfileConfig eradProfileTable[ERAD_NUMBER_OF_PROFILES];
+extern EradProfile eradProfiles[ERAD_NUMBER_OF_PROFILES];
+// false if the debugger owns the ERAD (the profiles are not configured)
+extern bool eradOwned;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function configures the comparators and counters of all profiles
+extern void EradInit(void);
+// Function resets the counters of all profiles
+extern void EradClear(void);
+// Function copies the counters of all profiles into eradProfiles
+extern void EradRead(void);
+
+#endif
@@ -18,21 +18,242 @@
 //-------------------------------------------------------------------------------------------------
 #include "TB_Functions.h"
 
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Functions called by the sequencer ISR run from LSx RAM without flash wait states
+// (see TB_Sequencer.c)
+#pragma CODE_SECTION(ADCtoPWM_Read, ".TI.ramfunc");
+#pragma CODE_SECTION(ADCtoPWM, ".TI.ramfunc");
+#pragma CODE_SECTION(ADCtoPWM_All, ".TI.ramfunc");
+#pragma CODE_SECTION(ADC_ErrorCheck, ".TI.ramfunc");
+#pragma CODE_SECTION(ADC_SetDACs, ".TI.ramfunc");
+#pragma CODE_SECTION(Mux_Select, ".TI.ramfunc");
+#pragma CODE_SECTION(Mux_Preselect, ".TI.ramfunc");
+#pragma CODE_SECTION(Mux_Release, ".TI.ramfunc");
+#pragma CODE_SECTION(MuxWriteLevel, ".TI.ramfunc");
+#pragma CODE_SECTION(MuxResetErrorCounts, ".TI.ramfunc");
+#pragma CODE_SECTION(Error_LEDs_On, ".TI.ramfunc");
+#pragma CODE_SECTION(Error_LEDs_Off, ".TI.ramfunc");
+#pragma CODE_SECTION(PWM_LEDs_On, ".TI.ramfunc");
+#pragma CODE_SECTION(PWM_LEDs_Off, ".TI.ramfunc");
+#pragma CODE_SECTION(GPIOLEDs_On, ".TI.ramfunc");
+#pragma CODE_SECTION(GPIOLEDs_Off, ".TI.ramfunc");
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
 long double OFFTIME = 10000, ONTIME = 500000;
 uint16_t  Repeat_count = 3;
+uint16_t  adcSweepMode = ADC_SWEEP_SPARSE;
+uint16_t  pwmLedCheckMode = PWM_LED_CHECK_VISUAL;
+uint16_t  gpioLedCheckMode = GPIO_LED_CHECK_VISUAL;
+LedLoopbackResult gpioLedLoopback;
+uint16_t  adcSettleFrames = ADC_SETTLE_MAX_FRAMES;
+uint16_t  adcAcqpsFailed = 0;
+const uint16_t adcCheckCodes[ADC_NUMBER_OF_CHECK_CODES] = {1000, 2000, 3000, ADC_SWEEP_CODES - 1};
 float32   ADC_error_buffer=0.96;
-uint16_t  S=0,A2=0,A3=0,A4=0,A5=0,B0=0,B2=0,B3=0,B4=0,B5=0,C2=0,C3=0,C4=0,C5=0,D0=0,D1=0,D2=0,D3=0,D4=0,D5=0,IN14=0,IN15=0;
+uint16_t  A2=0,A3=0,A4=0,A5=0,B0=0,B2=0,B3=0,B4=0,B5=0,C2=0,C3=0,C4=0,C5=0,D0=0,D1=0,D2=0,D3=0,D4=0,D5=0,IN14=0,IN15=0;
 uint16_t  A2_Error_count=0,A3_Error_count=0,A4_Error_count=0,A5_Error_count=0;
 uint16_t  B0_Error_count=0,B2_Error_count=0,B3_Error_count=0,B4_Error_count=0,B5_Error_count=0;
 uint16_t  C2_Error_count=0,C3_Error_count=0,C4_Error_count=0,C5_Error_count=0;
 uint16_t  D0_Error_count=0,D1_Error_count=0,D2_Error_count=0,D3_Error_count=0,D4_Error_count=0,D5_Error_count=0,IN14_Error_count=0,IN15_Error_count=0;
 
+// Routing of the ADC results (or the DAC-A value) to the PWM compares of the PWM_LEDs
+const ADCtoPWM_Route adcPwmRoute[ADC_PWM_NUMBER_OF_ROUTES] =
+{
+    // source               compare                          result variable
+    {ADC_SOURCE(a, 2),      PWM_CMPA_ADDR(EPwm1Regs),        &A2},   // 0
+    {ADC_SOURCE(a, 3),      PWM_CMPB_ADDR(EPwm1Regs),        &A3},   // 1
+    {ADC_SOURCE(a, 4),      PWM_CMPA_ADDR(EPwm2Regs),        &A4},   // 2
+    {ADC_SOURCE(a, 5),      PWM_CMPB_ADDR(EPwm2Regs),        &A5},   // 3
+    {ADC_SOURCE(b, 0),      PWM_CMPA_ADDR(EPwm3Regs),        &B0},   // 4
+    {ADC_SOURCE(b, 2),      PWM_CMPB_ADDR(EPwm3Regs),        &B2},   // 5
+    {ADC_SOURCE(b, 3),      PWM_CMPA_ADDR(EPwm4Regs),        &B3},   // 6
+    {ADC_SOURCE(b, 4),      PWM_CMPB_ADDR(EPwm4Regs),        &B4},   // 7
+    {ADC_SOURCE(b, 5),      PWM_CMPA_ADDR(EPwm5Regs),        &B5},   // 8
+    {ADC_SOURCE(c, 2),      PWM_CMPB_ADDR(EPwm5Regs),        &C2},   // 9
+    {ADC_SOURCE(c, 3),      PWM_CMPA_ADDR(EPwm6Regs),        &C3},   // 10
+    {ADC_SOURCE(c, 4),      PWM_CMPB_ADDR(EPwm6Regs),        &C4},   // 11
+    {ADC_SOURCE(c, 5),      PWM_CMPA_ADDR(EPwm7Regs),        &C5},   // 12
+    {ADC_SOURCE(d, 0),      PWM_CMPB_ADDR(EPwm7Regs),        &D0},   // 13
+    {ADC_SOURCE(d, 1),      PWM_CMPA_ADDR(EPwm8Regs),        &D1},   // 14
+    {ADC_SOURCE(d, 2),      PWM_CMPB_ADDR(EPwm8Regs),        &D2},   // 15
+    {ADC_SOURCE(d, 3),      PWM_CMPA_ADDR(EPwm9Regs),        &D3},   // 16
+    {ADC_SOURCE(d, 4),      PWM_CMPB_ADDR(EPwm9Regs),        &D4},   // 17
+    {ADC_SOURCE(d, 5),      PWM_CMPA_ADDR(EPwm10Regs),       &D5},   // 18
+    {ADC_SOURCE(a, 14),     PWM_CMPB_ADDR(EPwm10Regs),       &IN14}, // 19
+    {ADC_SOURCE(a, 15),     PWM_CMPA_ADDR(EPwm11Regs),       &IN15}, // 20
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm11Regs),       0},     // 21
+    {ADC_SOURCE_DACA,       PWM_CMPA_ADDR(EPwm12Regs),       0},     // 22
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm12Regs),       0},     // 23
+    {ADC_SOURCE_DACA,       PWM_CMPA_ADDR(EPwm13Regs),       0},     // 24
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm13Regs),       0},     // 25
+    {ADC_SOURCE_DACA,       PWM_CMPA_ADDR(EPwm14Regs),       0},     // 26
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm14Regs),       0},     // 27
+    {ADC_SOURCE_DACA,       PWM_CMPA_ADDR(EPwm15Regs),       0},     // 28
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm15Regs),       0},     // 29
+    {ADC_SOURCE_DACA,       PWM_CMPA_ADDR(EPwm16Regs),       0},     // 30
+    {ADC_SOURCE_DACA,       PWM_CMPB_ADDR(EPwm16Regs),       0}      // 31
+};
+// Address of the mux channels 0..20 (ports B, D, E)
+const MuxAddress muxAddress[MUX_NUMBER_OF_CHANNELS] =
+{
+    // group        port B                                     port D         port E
+    {MUX_GROUP_2,  {0,                                         0,             MUX_E(132) | MUX_E(131)}},                // 0
+    {MUX_GROUP_2,  {0,                                         0,             MUX_E(136)}},                             // 1
+    {MUX_GROUP_1,  {0,                                         0,             0}},                                      // 2
+    {MUX_GROUP_1,  {0,                                         0,             MUX_E(130)}},                             // 3
+    {MUX_GROUP_2,  {0,                                         0,             MUX_E(132)}},                             // 4
+    {MUX_GROUP_3,  {MUX_B(44) | MUX_B(57),                     0,             0}},                                      // 5
+    {MUX_GROUP_3,  {MUX_B(44) | MUX_B(57) | MUX_B(55),         0,             0}},                                      // 6
+    {MUX_GROUP_1,  {0,                                         MUX_D(126),    MUX_E(128)}},                             // 7
+    {MUX_GROUP_1,  {0,                                         MUX_D(126),    MUX_E(128) | MUX_E(130)}},                // 8
+    {MUX_GROUP_3,  {MUX_B(44),                                 0,             0}},                                      // 9
+    {MUX_GROUP_3,  {MUX_B(44) | MUX_B(55),                     0,             0}},                                      // 10
+    {MUX_GROUP_1,  {0,                                         MUX_D(126),    0}},                                      // 11
+    {MUX_GROUP_1,  {0,                                         MUX_D(126),    MUX_E(130)}},                             // 12
+    {MUX_GROUP_3,  {MUX_B(57),                                 0,             0}},                                      // 13
+    {MUX_GROUP_3,  {MUX_B(57) | MUX_B(55),                     0,             0}},                                      // 14
+    {MUX_GROUP_1,  {0,                                         0,             MUX_E(128)}},                             // 15
+    {MUX_GROUP_1,  {0,                                         0,             MUX_E(128) | MUX_E(130)}},                // 16
+    {MUX_GROUP_3,  {0,                                         0,             0}},                                      // 17
+    {MUX_GROUP_3,  {MUX_B(55),                                 0,             0}},                                      // 18
+    {MUX_GROUP_2,  {0,                                         0,             MUX_E(136) | MUX_E(132)}},                // 19
+    {MUX_GROUP_2,  {0,                                         0,             MUX_E(136) | MUX_E(131)}}                 // 20
+};
+// Select lines of every mux (ports B, D, E)
+const uint32_t muxGroupLines[MUX_NUMBER_OF_GROUPS][MUX_NUMBER_OF_PORTS] =
+{
+    {0,                                 0,              0},                                     // MUX_GROUP_NONE
+    {0,                                 MUX_D(126),     MUX_E(128) | MUX_E(130)},               // MUX_GROUP_1
+    {0,                                 0,              MUX_E(136) | MUX_E(132) | MUX_E(131)},  // MUX_GROUP_2
+    {MUX_B(44) | MUX_B(57) | MUX_B(55), 0,              0}                                      // MUX_GROUP_3
+};
+// Data registers (DAT, SET, CLEAR, TOGGLE) of the ports B, D and E
+volatile uint32_t *const muxPortRegs[MUX_NUMBER_OF_PORTS] =
+{
+    &GpioDataRegs.GPBDAT.all,
+    &GpioDataRegs.GPDDAT.all,
+    &GpioDataRegs.GPEDAT.all
+};
+volatile int muxSelected = MUX_PARK;
+uint32_t muxLevel[MUX_NUMBER_OF_PORTS];
+// Gamma lookup table (compare value for every 12 bit result), computed by ADCtoPWM_Init()
+#pragma DATA_SECTION(adcGammaLut, "ramgs1");
+uint16_t  adcGammaLut[ADC_GAMMA_LUT_SIZE];
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: MuxWriteLevel =====================================================================
+///
+/// @brief  Function changes the select lines of one mux to "level". Per port the lines which have
+///         to change are toggled with one 32 bit write, muxLevel[] keeps the written level (the
+///         DAT register would show the pins a few clocks late)
+///
+/// @param  uint16_t group, const uint32_t *level
+///
+/// @return void
+///
+//=================================================================================================
+static void MuxWriteLevel(uint16_t group, const uint32_t *level)
+{
+    for (uint16_t p = 0; p < MUX_NUMBER_OF_PORTS; p++)
+    {
+        uint32_t lines = muxGroupLines[group][p];
+        uint32_t toggle = (muxLevel[p] ^ level[p]) & lines;
+
+        if (toggle != 0)
+        {
+            muxPortRegs[p][LED_PORT_TOGGLE] = toggle;
+            muxLevel[p] ^= toggle;
+        }
+    }
+}
+
+//=== Function: MuxResetErrorCounts ===============================================================
+///
+/// @brief  Function clears the error counters of ADC_ErrorCheck()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MuxResetErrorCounts(void)
+{
+#if CLA_ADC_ENABLE && !ADC_ERROR_CHECK_PPB
+    ClaAdcResetErrorCounts();
+#endif
+    A2_Error_count = 0;
+    A3_Error_count = 0;
+    A4_Error_count = 0;
+    A5_Error_count = 0;
+    B0_Error_count = 0;
+    B2_Error_count = 0;
+    B3_Error_count = 0;
+    B4_Error_count = 0;
+    B5_Error_count = 0;
+    C2_Error_count = 0;
+    C3_Error_count = 0;
+    C4_Error_count = 0;
+    C5_Error_count = 0;
+    D0_Error_count = 0;
+    D1_Error_count = 0;
+    D2_Error_count = 0;
+    D3_Error_count = 0;
+    D4_Error_count = 0;
+    D5_Error_count = 0;
+    IN14_Error_count = 0;
+    IN15_Error_count = 0;
+}
+
+//=== Function: ADC_ReadMean ======================================================================
+///
+/// @brief  Function returns the mean of the results of a source over ADC_ACQPS_TUNE_SAMPLES
+///         frames. The first frame is skipped, it may have been converted with the old window
+///
+/// @param  uint16_t source (ADC_SOURCE())
+///
+/// @return uint16_t mean
+///
+//=================================================================================================
+static uint16_t ADC_ReadMean(uint16_t source)
+{
+    uint32_t sum = 0;
+
+    ADC_WaitFrames(1);
+    for (uint16_t i = 0; i < ADC_ACQPS_TUNE_SAMPLES; i++)
+    {
+        ADC_WaitFrames(1);
+        sum += ADCtoPWM_Read(source);
+    }
+    return (uint16_t)((sum + ADC_ACQPS_TUNE_SAMPLES / 2) / ADC_ACQPS_TUNE_SAMPLES);
+}
+
 //-------------------------------------------------------------------------------------------------
 // Global functions
 //-------------------------------------------------------------------------------------------------
+//=== Function: ADCtoPWM_Read =====================================================================
+///
+/// @brief  Function returns the value of a routing source (ADC result or DAC-A value)
+///
+/// @param  uint16_t source
+///
+/// @return uint16_t value (0..4095)
+///
+//=================================================================================================
+uint16_t ADCtoPWM_Read(uint16_t source)
+{
+    if (source == ADC_SOURCE_DACA)
+        return DacaRegs.DACVALS.bit.DACVALS;
+#if ADC_CAPTURE_DMA
+    return dmaAdcFrame[source] & 0x0FFF;
+#else
+    return adcResultBase[source / DMA_ADC_RESULTS_PER_MODULE][source % DMA_ADC_RESULTS_PER_MODULE] & 0x0FFF;
+#endif
+}
 
 //=== Function: Error_LEDs_Check ==========================================================================
 ///
@@ -64,6 +285,8 @@ void Error_LEDs_Check(void)
 ///
 /// @brief  Function to light-up all PWM LEDs connected to GPIOs, four at a time
 ///         repeats the process for 3 times
+///         With pwmLedCheckMode = PWM_LED_CHECK_FADE the fade engine runs the chase animation
+///         on the ePWM outputs instead (LedFadeStartCheck())
 ///
 /// @param  void
 ///
@@ -72,6 +295,18 @@ void Error_LEDs_Check(void)
 //=================================================================================================
 void PWM_LEDs_Check(void)
 {
+    if (pwmLedCheckMode == PWM_LED_CHECK_FADE)
+    {
+        uint32_t timeUs = LedFadeStartCheck(Repeat_count);
+
+        if (timeUs != 0)
+        {
+            DELAY_US(timeUs);
+            LedFadeStop();
+        }
+        return;
+    }
+
     EALLOW;
     for(uint16_t j = 0; j < Repeat_count; j++)
     {
@@ -91,6 +326,8 @@ void PWM_LEDs_Check(void)
 /// @brief  Function to light-up the First LEDs of all the Group-A to Group-H and followed...
 ///         by the next LEDs till the last LEDs of all groups.
 ///         repeats the process for 16 times
+///         With gpioLedCheckMode = GPIO_LED_CHECK_LOOPBACK all GPIOs are checked by
+///         LedLoopbackCheck() instead (result in gpioLedLoopback, < 1 ms)
 ///
 /// @param  void
 ///
@@ -99,6 +336,12 @@ void PWM_LEDs_Check(void)
 //=================================================================================================
 void GPIOLEDs_Check(void)
 {
+    if (gpioLedCheckMode == GPIO_LED_CHECK_LOOPBACK)
+    {
+        LedLoopbackCheck(&ledGpioGroup, &gpioLedLoopback);
+        return;
+    }
+
     EALLOW;
     for(uint16_t j = 0; j < 16; j++)
     {
@@ -120,6 +363,8 @@ void GPIOLEDs_Check(void)
 ///         it will light up the respective Error LED. The ADCIN values are simultaneously sent to ePWMs,
 ///         which control the brightness of PWM LEDs, making them gradually brighter.
 ///         repeats the process for 3 times
+///         With adcSweepMode = ADC_SWEEP_SPARSE only the check point codes are set and the
+///         measured settling time is waited, ADC_SWEEP_FULL steps through all 3900 codes
 ///
 /// @param  void
 ///
@@ -128,21 +373,42 @@ void GPIOLEDs_Check(void)
 //=================================================================================================
 void ADCINs_Check(void)
 {
+    if (adcSweepMode == ADC_SWEEP_SPARSE)
+        ADC_MeasureSettleTime();
+    AdcStatsReset();
+
     EALLOW;
     for(uint16_t k = 0; k < Repeat_count; k++)
     {
         for(uint16_t i = 0; i < 32; i++)
         {
             Mux_Select(i);
-            for(uint16_t j = 0; j<3900; j++)
+            if (adcSweepMode == ADC_SWEEP_SPARSE)
             {
-                DacaRegs.DACVALS.bit.DACVALS = j;
-                DacbRegs.DACVALS.bit.DACVALS = j;
-                DaccRegs.DACVALS.bit.DACVALS = j;
-                ADCtoPWM(i);
-                if(j == 1000 || j == 2000 || j == 3000 || j>3898)
+                for(uint16_t c = 0; c < ADC_NUMBER_OF_CHECK_CODES; c++)
+                {
+                    ADC_SetDACs(adcCheckCodes[c]);
+                    ADC_WaitFrames(adcSettleFrames);
+                    ADCtoPWM(i);
                     ADC_ErrorCheck(i);
-                DELAY_US(500);
+                    AdcStatsEvaluateChannel(i, adcCheckCodes[c]);
+                }
+            }
+            else
+            {
+                for(uint16_t j = 0; j<ADC_SWEEP_CODES; j++)
+                {
+                    ADC_SetDACs(j);
+                    ADCtoPWM(i);
+                    if(j == 1000 || j == 2000 || j == 3000 || j>3898)
+                        ADC_ErrorCheck(i);
+#if ADC_CAPTURE_DMA
+                    DmaWaitAdcFrames(ADC_SETTLE_FRAMES);
+#else
+                    DELAY_US(500);
+#endif
+                    AdcStatsEvaluateChannel(i, j);
+                }
             }
             ADCtoPWM(32);
             Mux_Select(23);
@@ -151,9 +417,175 @@ void ADCINs_Check(void)
     EDIS;
 }
 
+//=== Function: ADC_SetDACs =======================================================================
+///
+/// @brief  Function sets the same code on DAC A, B and C
+///
+/// @param  uint16_t code
+///
+/// @return void
+///
+//=================================================================================================
+void ADC_SetDACs(uint16_t code)
+{
+    DacaRegs.DACVALS.bit.DACVALS = code;
+    DacbRegs.DACVALS.bit.DACVALS = code;
+    DaccRegs.DACVALS.bit.DACVALS = code;
+#if ADC_ERROR_CHECK_PPB
+    AdcPpbSetCode(code);
+#endif
+}
+
+//=== Function: ADC_WaitFrames ====================================================================
+///
+/// @brief  Function waits the given number of ADC conversions (one per ePWM1 SOCA, 5 us)
+///
+/// @param  uint16_t numberOfFrames
+///
+/// @return void
+///
+//=================================================================================================
+void ADC_WaitFrames(uint16_t numberOfFrames)
+{
+#if ADC_CAPTURE_DMA
+    DmaWaitAdcFrames(numberOfFrames);
+#else
+    DELAY_US(5 * (uint32_t)numberOfFrames);
+#endif
+}
+
+//=== Function: ADC_MeasureSettleTime =============================================================
+///
+/// @brief  Function measures the settling time of the DAC/mux/ADC path. On every channel with an
+///         ADC result the DACs step from 0 to the highest check point code, the number of frames
+///         until the result passes the error limit and two frames differ less than
+///         ADC_SETTLE_TOLERANCE is counted. The worst case plus a margin is stored in
+///         adcSettleFrames (limited to ADC_SETTLE_MAX_FRAMES, e.g. for a faulty channel).
+///         Must not be called from an ISR (waits for the DMA frames)
+///
+/// @param  void
+///
+/// @return uint16_t adcSettleFrames
+///
+//=================================================================================================
+uint16_t ADC_MeasureSettleTime(void)
+{
+    uint16_t code = adcCheckCodes[ADC_NUMBER_OF_CHECK_CODES - 1];
+    uint16_t worst = 0;
+
+    EALLOW;
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHECKED_CHANNELS; i++)
+    {
+        uint16_t frames = 0;
+        uint16_t last;
+
+        Mux_Select(i);
+        ADC_SetDACs(0);
+        ADC_WaitFrames(ADC_SETTLE_MAX_FRAMES);
+        last = ADCtoPWM_Read(adcPwmRoute[i].source);
+
+        ADC_SetDACs(code);
+        while (frames < ADC_SETTLE_MAX_FRAMES)
+        {
+            uint16_t value;
+
+            ADC_WaitFrames(1);
+            frames++;
+            value = ADCtoPWM_Read(adcPwmRoute[i].source);
+            if (value >= ADC_error_buffer * code
+                && ((value > last) ? (value - last) : (last - value)) < ADC_SETTLE_TOLERANCE)
+                break;
+            last = value;
+        }
+        if (frames > worst)
+            worst = frames;
+        Mux_Select(23);
+    }
+    ADC_SetDACs(0);
+    EDIS;
+
+    worst += ADC_SETTLE_MARGIN_FRAMES;
+    adcSettleFrames = (worst < ADC_SETTLE_MAX_FRAMES) ? worst : ADC_SETTLE_MAX_FRAMES;
+    return adcSettleFrames;
+}
+
+//=== Function: ADC_TuneAcqps =====================================================================
+///
+/// @brief  Function tunes the acquisition window of every channel with an ADC result. The DACs
+///         drive the highest check point code into the selected channel, the SOC before it on
+///         the same module converts a deselected channel, so every conversion samples a known
+///         step from about 0 V to the code. The result with ADC_ACQPS_MAX is the reference, the
+///         window is shortened in ADC_ACQPS_TUNE_STEP until the mean deviates more than
+///         ADC_ACQPS_TUNE_TOLERANCE. The shortest passing window plus ADC_ACQPS_TUNE_MARGIN is
+///         stored in adcChannelTable, afterwards the ePWM1 sampling point is placed for the new
+///         windows. A channel whose reference fails the error limit keeps ADC_ACQPS_MAX and is
+///         counted in adcAcqpsFailed. Must be called before ADC_MeasureSettleTime() and not
+///         from an ISR
+///
+/// @param  void
+///
+/// @return uint16_t adcAcqpsFailed
+///
+//=================================================================================================
+uint16_t ADC_TuneAcqps(void)
+{
+    uint16_t code = adcCheckCodes[ADC_NUMBER_OF_CHECK_CODES - 1];
+
+    adcAcqpsFailed = 0;
+
+    EALLOW;
+    ADC_SetDACs(code);
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHECKED_CHANNELS; i++)
+    {
+        uint16_t index = AdcFindChannel(adcPpbTable[i].module, adcPpbTable[i].soc);
+        uint16_t source = adcPwmRoute[i].source;
+        uint16_t passed = ADC_ACQPS_MAX;
+        uint16_t reference;
+
+        if (index == ADC_NO_CHANNEL)
+            continue;
+
+        Mux_Select(i);
+        AdcSetAcqps(index, ADC_ACQPS_MAX);
+        ADC_WaitFrames(ADC_SETTLE_MAX_FRAMES);
+        reference = ADC_ReadMean(source);
+
+        if (reference < ADC_error_buffer * code)
+        {
+            adcAcqpsFailed++;
+        }
+        else
+        {
+            for (int16_t acqps = ADC_ACQPS_MAX - ADC_ACQPS_TUNE_STEP; acqps >= ADC_ACQPS_MIN;
+                 acqps -= ADC_ACQPS_TUNE_STEP)
+            {
+                uint16_t value;
+
+                AdcSetAcqps(index, (uint16_t)acqps);
+                value = ADC_ReadMean(source);
+                if (((value > reference) ? (value - reference) : (reference - value))
+                    > ADC_ACQPS_TUNE_TOLERANCE)
+                    break;
+                passed = (uint16_t)acqps;
+            }
+        }
+        AdcSetAcqps(index, passed + ADC_ACQPS_TUNE_MARGIN);
+        Mux_Select(23);
+    }
+    ADC_SetDACs(0);
+    EDIS;
+
+    PwmInitSamplePoint(&EPwm1Regs, AdcGetSocaWindow());
+    return adcAcqpsFailed;
+}
+
 //=== Function: Hardware_Error_Detection_Check ==========================================================================
 ///
-/// @brief  Function to check the all Hardware Error Detections
+/// @brief  Function to check the all Hardware Error Detections. The pulses on the reset lines
+///         are counted by the CLB monitor (TB_CLB), the result is stored in clbCheckPassed.
+///         The hardware trip of the PWMs (TB_Trip) is disarmed while the lines are pulsed.
+///         Every pulse is injected by TripLatencyInject() and its detection latency measured
+///         after OFFTIME, the result is stored in tripLatencyPassed
 ///
 /// @param  void
 ///
@@ -163,30 +595,39 @@ void ADCINs_Check(void)
 void Hardware_Error_Detection_Check(void)
 {
     EALLOW;
+    //  the CLB counts the edges of the reset lines, more than expected raise ClbErrorLineISR()
+    ClbArm(Repeat_count);
+    //  the pulses must not trip the PWMs
+    TripDisarm();
+    TripLatencyClear();
     for(uint16_t i = 0; i < Repeat_count; i++)
     {
         Mux_Select(0);
         DELAY_US(ONTIME);
-        GpioDataRegs.GPDCLEAR.bit.GPIO98 = 1;
+        TripLatencyInject(0);
         DELAY_US(OFFTIME);
+        TripLatencyMeasure(0);
         Mux_Select(23);
 
         Mux_Select(5);
         DELAY_US(ONTIME);
-        GpioDataRegs.GPACLEAR.bit.GPIO10 = 1;
+        TripLatencyInject(1);
         DELAY_US(OFFTIME);
+        TripLatencyMeasure(1);
         Mux_Select(23);
 
         Mux_Select(11);
         DELAY_US(ONTIME);
-        GpioDataRegs.GPACLEAR.bit.GPIO11 = 1;
+        TripLatencyInject(2);
         DELAY_US(OFFTIME);
+        TripLatencyMeasure(2);
         Mux_Select(23);
 
         Mux_Select(13);
         DELAY_US(ONTIME);
-        GpioDataRegs.GPDCLEAR.bit.GPIO97 = 1;
+        TripLatencyInject(3);
         DELAY_US(OFFTIME);
+        TripLatencyMeasure(3);
         Mux_Select(23);
         DELAY_US(OFFTIME);
         GpioDataRegs.GPDSET.bit.GPIO98  = 1;
@@ -195,12 +636,21 @@ void Hardware_Error_Detection_Check(void)
         GpioDataRegs.GPDSET.bit.GPIO97  = 1;
         DELAY_US(ONTIME);
     }
+    //  every line must have seen all pulses, afterwards every edge is abnormal
+    ClbCheck(Repeat_count);
+    TripLatencyCheck(Repeat_count);
+    ClbArm(0);
+    TripArm();
     EDIS;
 }
 
 //=== Function: ADC_ErrorCheck ==========================================================================
 ///
 /// @brief  Function to detect errors in ADC results and accordingly indicates error through Error_LEDs
+///         With ADC_ERROR_CHECK_PPB the current DAC code is only handed to the PPB of the selected
+///         channel (AdcPpbCheck()), the comparison runs in hardware on every conversion.
+///         With CLA_ADC_ENABLE the limit is handed to CLA task 2, which compares the result of
+///         the last frame and counts the errors in claAdcOutput (see TB_CLA.h)
 ///
 /// @param  void
 ///
@@ -209,6 +659,18 @@ void Hardware_Error_Detection_Check(void)
 //===========================================================================================================
 void ADC_ErrorCheck(int i)
 {
+#if ADC_ERROR_CHECK_PPB
+    // The settled DAC code becomes the limit of PPB1, faults are counted by AdcPpbEventISR()
+    AdcPpbCheck(DacaRegs.DACVALS.bit.DACVALS);
+#elif CLA_ADC_ENABLE
+    // Smallest result without error: result >= ADC_error_buffer * DAC value, rounded up
+    float32 threshold = ADC_error_buffer * DacaRegs.DACVALS.bit.DACVALS;
+    uint16_t limit = (uint16_t)threshold;
+
+    if (limit < threshold)
+        limit++;
+    ClaAdcCheck(i, limit);
+#else
     switch(i)
     {
         case 0:
@@ -298,6 +760,37 @@ void ADC_ErrorCheck(int i)
         default:
             break;
     }
+#endif
+}
+
+//=== Function: ADC_GetErrorCount ==========================================================================
+///
+/// @brief  Function returns the number of ADC errors of all channels counted by the active error
+///         check (PPB events, CLA task 2 or ADC_ErrorCheck()), saturated to 0xFFFF
+///
+/// @param  void
+///
+/// @return uint16_t errors
+///
+//===========================================================================================================
+uint16_t ADC_GetErrorCount(void)
+{
+    uint32_t errors = 0;
+
+#if ADC_ERROR_CHECK_PPB
+    for (uint16_t i = 0; i < ADC_NUMBER_OF_CHANNELS; i++)
+        errors += adcPpbErrorCount[i];
+#elif CLA_ADC_ENABLE
+    for (uint16_t i = 0; i < CLA_ADC_NUMBER_OF_CHANNELS; i++)
+        errors += claAdcOutput.errorCount[i];
+#else
+    errors = (uint32_t)A2_Error_count + A3_Error_count + A4_Error_count + A5_Error_count
+           + B0_Error_count + B2_Error_count + B3_Error_count + B4_Error_count + B5_Error_count
+           + C2_Error_count + C3_Error_count + C4_Error_count + C5_Error_count
+           + D0_Error_count + D1_Error_count + D2_Error_count + D3_Error_count + D4_Error_count
+           + D5_Error_count + IN14_Error_count + IN15_Error_count;
+#endif
+    return (errors > 0xFFFF) ? 0xFFFF : (uint16_t)errors;
 }
 
 //=== Function: Error_LEDs_Off ==========================================================================
@@ -311,39 +804,8 @@ void ADC_ErrorCheck(int i)
 //===========================================================================================================
 void Error_LEDs_Off(int i)
 {
-    switch(i)
-    {
-        case 1: GpioDataRegs.GPBSET.bit.GPIO47 = 1; break;
-        case 2: GpioDataRegs.GPCSET.bit.GPIO73 = 1; break;
-        case 3: GpioDataRegs.GPBSET.bit.GPIO34 = 1; break;
-        case 4: GpioDataRegs.GPASET.bit.GPIO23 = 1; break;
-        case 5: GpioDataRegs.GPASET.bit.GPIO26 = 1; break;
-        case 6: GpioDataRegs.GPASET.bit.GPIO25 = 1; break;
-        case 7: GpioDataRegs.GPDSET.bit.GPIO102 = 1; break;
-        case 8: GpioDataRegs.GPDSET.bit.GPIO101 = 1; break;
-        case 9: GpioDataRegs.GPASET.bit.GPIO18 = 1; break;
-        case 10: GpioDataRegs.GPASET.bit.GPIO17 = 1; break;
-        case 11: GpioDataRegs.GPASET.bit.GPIO13 = 1; break;
-        case 12: GpioDataRegs.GPASET.bit.GPIO0 = 1; break;
-        case 13: GpioDataRegs.GPASET.bit.GPIO4 = 1; break;
-        case 14: GpioDataRegs.GPDSET.bit.GPIO109 = 1; break;
-        case 15: GpioDataRegs.GPDSET.bit.GPIO110 = 1; break;
-        case 16: GpioDataRegs.GPDSET.bit.GPIO106 = 1; break;
-        case 17: GpioDataRegs.GPDSET.bit.GPIO108 = 1; break;
-        case 18: GpioDataRegs.GPDSET.bit.GPIO105 = 1; break;
-        case 19: GpioDataRegs.GPBSET.bit.GPIO33 = 1; break;
-        case 20: GpioDataRegs.GPASET.bit.GPIO22 = 1; break;
-        case 21: GpioDataRegs.GPASET.bit.GPIO27 = 1; break;
-        case 22: GpioDataRegs.GPASET.bit.GPIO24 = 1; break;
-        case 23: GpioDataRegs.GPDSET.bit.GPIO103 = 1; break;
-        case 24: GpioDataRegs.GPDSET.bit.GPIO100 = 1; break;
-        case 25: GpioDataRegs.GPASET.bit.GPIO19 = 1; break;
-        case 26: GpioDataRegs.GPASET.bit.GPIO16 = 1; break;
-        case 27: GpioDataRegs.GPASET.bit.GPIO12 = 1; break;
-        case 28: GpioDataRegs.GPASET.bit.GPIO1 = 1; break;
-        case 29: GpioDataRegs.GPCSET.bit.GPIO70 = 1; break;
-        default:  break;
-    }
+    if (i >= 1 && i <= LED_NUMBER_OF_ERROR_LEDS)
+        LedOff(&ledErrorGroup, 1UL << (i - 1));
 }
 
 //=== Function: Error_LEDs_On ==========================================================================
@@ -357,39 +819,8 @@ void Error_LEDs_Off(int i)
 //===========================================================================================================
 void Error_LEDs_On(int i)
 {
-    switch(i)
-    {
-        case 1: GpioDataRegs.GPBCLEAR.bit.GPIO47 = 1; break;
-        case 2: GpioDataRegs.GPCCLEAR.bit.GPIO73 = 1; break;
-        case 3: GpioDataRegs.GPBCLEAR.bit.GPIO34 = 1; break;
-        case 4: GpioDataRegs.GPACLEAR.bit.GPIO23 = 1; break;
-        case 5: GpioDataRegs.GPACLEAR.bit.GPIO26 = 1; break;
-        case 6: GpioDataRegs.GPACLEAR.bit.GPIO25 = 1; break;
-        case 7: GpioDataRegs.GPDCLEAR.bit.GPIO102 = 1; break;
-        case 8: GpioDataRegs.GPDCLEAR.bit.GPIO101 = 1; break;
-        case 9: GpioDataRegs.GPACLEAR.bit.GPIO18 = 1; break;
-        case 10: GpioDataRegs.GPACLEAR.bit.GPIO17 = 1; break;
-        case 11: GpioDataRegs.GPACLEAR.bit.GPIO13 = 1; break;
-        case 12: GpioDataRegs.GPACLEAR.bit.GPIO0 = 1; break;
-        case 13: GpioDataRegs.GPACLEAR.bit.GPIO4 = 1; break;
-        case 14: GpioDataRegs.GPDCLEAR.bit.GPIO109 = 1; break;
-        case 15: GpioDataRegs.GPDCLEAR.bit.GPIO110 = 1; break;
-        case 16: GpioDataRegs.GPDCLEAR.bit.GPIO106 = 1; break;
-        case 17: GpioDataRegs.GPDCLEAR.bit.GPIO108 = 1; break;
-        case 18: GpioDataRegs.GPDCLEAR.bit.GPIO105 = 1; break;
-        case 19: GpioDataRegs.GPBCLEAR.bit.GPIO33 = 1; break;
-        case 20: GpioDataRegs.GPACLEAR.bit.GPIO22 = 1; break;
-        case 21: GpioDataRegs.GPACLEAR.bit.GPIO27 = 1; break;
-        case 22: GpioDataRegs.GPACLEAR.bit.GPIO24 = 1; break;
-        case 23: GpioDataRegs.GPDCLEAR.bit.GPIO103 = 1; break;
-        case 24: GpioDataRegs.GPDCLEAR.bit.GPIO100 = 1; break;
-        case 25: GpioDataRegs.GPACLEAR.bit.GPIO19 = 1; break;
-        case 26: GpioDataRegs.GPACLEAR.bit.GPIO16 = 1; break;
-        case 27: GpioDataRegs.GPACLEAR.bit.GPIO12 = 1; break;
-        case 28: GpioDataRegs.GPACLEAR.bit.GPIO1 = 1; break;
-        case 29: GpioDataRegs.GPCCLEAR.bit.GPIO70 = 1; break;
-        default:  break;
-    }
+    if (i >= 1 && i <= LED_NUMBER_OF_ERROR_LEDS)
+        LedOn(&ledErrorGroup, 1UL << (i - 1));
 }
 
 //=== Function: PWM_LEDs_On ==========================================================================
@@ -403,59 +834,8 @@ void Error_LEDs_On(int i)
 //===========================================================================================================
 void PWM_LEDs_On(int i)
 {
-    switch(i)
-    {
-        case 0:
-            GpioDataRegs.GPESET.bit.GPIO145 = 1;
-            GpioDataRegs.GPESET.bit.GPIO153 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO161 = 1;
-            GpioDataRegs.GPESET.bit.GPIO137 = 1;
-            break;
-        case 1:
-            GpioDataRegs.GPESET.bit.GPIO146 = 1;
-            GpioDataRegs.GPESET.bit.GPIO154 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO162 = 1;
-            GpioDataRegs.GPESET.bit.GPIO138 = 1;
-            break;
-        case 2:
-            GpioDataRegs.GPESET.bit.GPIO147 = 1;
-            GpioDataRegs.GPESET.bit.GPIO155 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO163 = 1;
-            GpioDataRegs.GPESET.bit.GPIO139 = 1;
-            break;
-        case 3:
-            GpioDataRegs.GPESET.bit.GPIO148 = 1;
-            GpioDataRegs.GPESET.bit.GPIO156 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO164 = 1;
-            GpioDataRegs.GPESET.bit.GPIO140 = 1;
-            break;
-        case 4:
-            GpioDataRegs.GPESET.bit.GPIO149 = 1;
-            GpioDataRegs.GPESET.bit.GPIO157 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO165 = 1;
-            GpioDataRegs.GPESET.bit.GPIO141 = 1;
-            break;
-        case 5:
-            GpioDataRegs.GPESET.bit.GPIO150 = 1;
-            GpioDataRegs.GPESET.bit.GPIO158 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO166 = 1;
-            GpioDataRegs.GPESET.bit.GPIO142 = 1;
-            break;
-        case 6:
-            GpioDataRegs.GPESET.bit.GPIO151 = 1;
-            GpioDataRegs.GPESET.bit.GPIO159 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO167 = 1;
-            GpioDataRegs.GPESET.bit.GPIO143 = 1;
-            break;
-        case 7:
-            GpioDataRegs.GPESET.bit.GPIO152 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO160 = 1;
-            GpioDataRegs.GPFSET.bit.GPIO168 = 1;
-            GpioDataRegs.GPESET.bit.GPIO144 = 1;
-            break;
-        default:
-            break;
-    }
+    if (i >= 0 && i < LED_NUMBER_OF_PWM_LEDS)
+        LedOn(&ledPwmGroup, 1UL << i);
 }
 
 //=== Function: PWM_LEDs_Off ==========================================================================
@@ -469,404 +849,194 @@ void PWM_LEDs_On(int i)
 //===========================================================================================================
 void PWM_LEDs_Off(int i)
 {
-    switch(i)
+    if (i >= 0 && i < LED_NUMBER_OF_PWM_LEDS)
+        LedOff(&ledPwmGroup, 1UL << i);
+}
+
+//=== Function: Mux_Select ==========================================================================
+///
+/// @brief  Function sets the select lines of the mux of channel i for passing DACOUT to ADCIN.
+///         The address comes from muxAddress[], only the lines of the mux of the channel are
+///         changed. The lines of one port change with one write to GPxTOGGLE, so a mux never sees
+///         an intermediate address. MUX_PARK sets all lines of all muxes high and clears the
+///         error counters of ADC_ErrorCheck(). Mux_Init() must be called before
+///
+/// @param  int i
+///
+/// @return void
+///
+//===========================================================================================================
+void Mux_Select(int i)
+{
+#if ADC_ERROR_CHECK_PPB
+    AdcPpbSelect(i);
+#endif
+    if (i == MUX_PARK)
     {
-        case 0:
-            GpioDataRegs.GPECLEAR.bit.GPIO145 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO153 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO161 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO137 = 1;
-            break;
-        case 1:
-            GpioDataRegs.GPECLEAR.bit.GPIO146 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO154 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO162 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO138 = 1;
-            break;
-        case 2:
-            GpioDataRegs.GPECLEAR.bit.GPIO147 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO155 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO163 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO139 = 1;
-            break;
-        case 3:
-            GpioDataRegs.GPECLEAR.bit.GPIO148 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO156 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO164 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO140 = 1;
-            break;
-        case 4:
-            GpioDataRegs.GPECLEAR.bit.GPIO149 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO157 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO165 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO141 = 1;
-            break;
-        case 5:
-            GpioDataRegs.GPECLEAR.bit.GPIO150 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO158 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO166 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO142 = 1;
-            break;
-        case 6:
-            GpioDataRegs.GPECLEAR.bit.GPIO151 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO159 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO167 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO143 = 1;
-            break;
-        case 7:
-            GpioDataRegs.GPECLEAR.bit.GPIO152 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO160 = 1;
-            GpioDataRegs.GPFCLEAR.bit.GPIO168 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO144 = 1;
-            break;
-        default:
-            break;
+        for (uint16_t g = MUX_GROUP_1; g < MUX_NUMBER_OF_GROUPS; g++)
+            MuxWriteLevel(g, muxGroupLines[g]);
+        MuxResetErrorCounts();
     }
+    else if (i >= 0 && i < MUX_NUMBER_OF_CHANNELS)
+    {
+        MuxWriteLevel(muxAddress[i].group, muxAddress[i].level);
+    }
+    muxSelected = i;
 }
 
-//=== Function: Mux_Select ==========================================================================
+//=== Function: Mux_Preselect =====================================================================
 ///
-/// @brief  Function to set Mux Select pins for passing DACOUT to ADCIN
+/// @brief  Function sets the address of channel "next" while the current channel is still
+///         measured, so the settling of the mux overlaps with the last conversions of the current
+///         channel. Only possible if "next" is on another mux than the selected channel. The PPB
+///         and muxSelected are not changed, this is done by Mux_Select(next)
+///
+/// @param  int next
+///
+/// @return bool preselected (false: same mux or channel without mux, nothing changed)
+///
+//=================================================================================================
+bool Mux_Preselect(int next)
+{
+    uint16_t group;
+
+    if (next < 0 || next >= MUX_NUMBER_OF_CHANNELS)
+        return false;
+    group = muxAddress[next].group;
+    if (muxSelected >= 0 && muxSelected < MUX_NUMBER_OF_CHANNELS && muxAddress[muxSelected].group == group)
+        return false;
+
+    MuxWriteLevel(group, muxAddress[next].level);
+    return true;
+}
+
+//=== Function: Mux_Release =======================================================================
+///
+/// @brief  Function parks only the mux of channel i (all its lines high) and clears the error
+///         counters like MUX_PARK. A channel preselected on another mux keeps its address
+///
+/// @param  int i
+///
+/// @return void
+///
+//=================================================================================================
+void Mux_Release(int i)
+{
+    if (i >= 0 && i < MUX_NUMBER_OF_CHANNELS)
+        MuxWriteLevel(muxAddress[i].group, muxGroupLines[muxAddress[i].group]);
+    MuxResetErrorCounts();
+}
+
+//=== Function: Mux_Init ==========================================================================
+///
+/// @brief  Function parks all muxes with SET writes, from then on muxLevel[] is the level of the
+///         select lines. Must be called after the GPIOs of the select lines are configured
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void Mux_Init(void)
+{
+    GpioDataRegs.GPBSET.all = muxGroupLines[MUX_GROUP_3][MUX_PORT_B];
+    GpioDataRegs.GPDSET.all = muxGroupLines[MUX_GROUP_1][MUX_PORT_D];
+    GpioDataRegs.GPESET.all = muxGroupLines[MUX_GROUP_1][MUX_PORT_E] | muxGroupLines[MUX_GROUP_2][MUX_PORT_E];
+    for (uint16_t p = 0; p < MUX_NUMBER_OF_PORTS; p++)
+    {
+        muxLevel[p] = 0;
+        for (uint16_t g = MUX_GROUP_1; g < MUX_NUMBER_OF_GROUPS; g++)
+            muxLevel[p] |= muxGroupLines[g][p];
+    }
+    muxSelected = MUX_PARK;
+}
+
+
+//=== Function: ADCtoPWM_Init ======================================================================
+///
+/// @brief  Function computes the gamma lookup table (square law) for the brightness of the PWM_LEDs.
+///         Has to be called after PwmInitAll(), all ePWMs use the same period
 ///
 /// @param  void
 ///
 /// @return void
 ///
 //===========================================================================================================
-void Mux_Select(int i)
+void ADCtoPWM_Init(void)
 {
-    switch (i)
+    float32 period = EPwm1Regs.TBPRD;
+
+    for (uint16_t i = 0; i < ADC_GAMMA_LUT_SIZE; i++)
     {
-        case 0:
-            GpioDataRegs.GPECLEAR.bit.GPIO136 = 1;
-            GpioDataRegs.GPESET.bit.GPIO132 = 1;
-            GpioDataRegs.GPESET.bit.GPIO131 = 1;
-            S = 0;
-            break;
-        case 1:
-            GpioDataRegs.GPESET.bit.GPIO136 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO132 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO131 = 1;
-            S = 1;
-            break;
-        case 2:
-            GpioDataRegs.GPDCLEAR.bit.GPIO126 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO128 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO130 = 1;
-            S = 2;
-            break;
-        case 3:
-            GpioDataRegs.GPDCLEAR.bit.GPIO126 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO128 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            S = 3;
-            break;
-        case 4:
-            GpioDataRegs.GPECLEAR.bit.GPIO136 = 1;
-            GpioDataRegs.GPESET.bit.GPIO132 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO131 = 1;
-            S = 4;
-            break;
-        case 5:
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO55 = 1;
-            S = 5;
-            break;
-        case 6:
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            S = 6;
-            break;
-        case 7:
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO130 = 1;
-            S = 7;
-            break;
-        case 8:
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            S = 8;
-            break;
-        case 9:
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO57 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO55 = 1;
-            S = 9;
-            break;
-        case 10:
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO57 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            S = 10;
-            break;
-        case 11:
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO128 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO130 = 1;
-            S = 11;
-            break;
-        case 12:
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO128 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            S = 12;
-            break;
-        case 13:
-            GpioDataRegs.GPBCLEAR.bit.GPIO44 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO55 = 1;
-            S = 13;
-            break;
-        case 14:
-            GpioDataRegs.GPBCLEAR.bit.GPIO44 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            S = 14;
-            break;
-        case 15:
-            GpioDataRegs.GPDCLEAR.bit.GPIO126 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO130 = 1;
-            S = 15;
-            break;
-        case 16:
-            GpioDataRegs.GPDCLEAR.bit.GPIO126 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            S = 16;
-            break;
-        case 17:
-            GpioDataRegs.GPBCLEAR.bit.GPIO44 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO57 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO55 = 1;
-            S = 17;
-            break;
-        case 18:
-            GpioDataRegs.GPBCLEAR.bit.GPIO44 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO57 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            S = 18;
-            break;
-        case 19:
-            GpioDataRegs.GPESET.bit.GPIO136 = 1;
-            GpioDataRegs.GPESET.bit.GPIO132 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO131 = 1;
-            S = 19;
-            break;
-        case 20:
-            GpioDataRegs.GPESET.bit.GPIO136 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO132 = 1;
-            GpioDataRegs.GPESET.bit.GPIO131 = 1;
-            S = 20;
-            break;
-        case 23:
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            GpioDataRegs.GPESET.bit.GPIO136 = 1;
-            GpioDataRegs.GPESET.bit.GPIO132 = 1;
-            GpioDataRegs.GPESET.bit.GPIO131 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            A2_Error_count = 0;
-            A3_Error_count = 0;
-            A4_Error_count = 0;
-            A5_Error_count = 0;
-            B0_Error_count = 0;
-            B2_Error_count = 0;
-            B3_Error_count = 0;
-            B4_Error_count = 0;
-            B5_Error_count = 0;
-            C2_Error_count = 0;
-            C3_Error_count = 0;
-            C4_Error_count = 0;
-            C5_Error_count = 0;
-            D0_Error_count = 0;
-            D1_Error_count = 0;
-            D2_Error_count = 0;
-            D3_Error_count = 0;
-            D4_Error_count = 0;
-            D5_Error_count = 0;
-            IN14_Error_count = 0;
-            IN15_Error_count = 0;
-            break;
-        default:
-            break;
+        float32 x = (float32)i / 4095.0f;
+        adcGammaLut[i] = (uint16_t)(period * x * x);
     }
 }
 
 //=== Function: ADCtoPWM ==========================================================================
 ///
 /// @brief  Function to store the ADC result and also pass it to PWM compares for adjusting brightness of PWM_LEDs
+///         i = 0..31 updates one channel of "adcPwmRoute", i = 32 switches all PWM_LEDs off.
+///         The compares are shadowed, the new values are applied at the next TBCTR = 0 (PwmDutyCommit()).
+///         With CLA_ADC_ENABLE only the route is handed over, CLA task 1 writes the compare after
+///         every ADC frame
 ///
-/// @param  void
+/// @param  int i
 ///
 /// @return void
 ///
 //===========================================================================================================
 void ADCtoPWM(int i)
 {
-    switch(i)
+#if CLA_ADC_ENABLE
+    if (i <= ADC_PWM_NUMBER_OF_ROUTES)
+        ClaAdcSelect(i);
+    PwmSampleTrack();
+#else
+    if (i < ADC_PWM_NUMBER_OF_ROUTES)
     {
-        case 0:
-            EPwm1Regs.CMPA.bit.CMPA = EPwm1Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT2 / 4095.0), 2.0);
-            A2 = AdcaResultRegs.ADCRESULT2;
-            break;
-        case 1:
-            EPwm1Regs.CMPB.bit.CMPB = EPwm1Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT3 / 4095.0), 2.0);
-            A3 = AdcaResultRegs.ADCRESULT3;
-            break;
-        case 2:
-            EPwm2Regs.CMPA.bit.CMPA = EPwm2Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT4 / 4095.0), 2.0);
-            A4 = AdcaResultRegs.ADCRESULT4;
-            break;
-        case 3:
-            EPwm2Regs.CMPB.bit.CMPB = EPwm2Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT5 / 4095.0), 2.0);
-            A5 = AdcaResultRegs.ADCRESULT5;
-            break;
-        case 4:
-            EPwm3Regs.CMPA.bit.CMPA = EPwm3Regs.TBPRD * powf((AdcbResultRegs.ADCRESULT0 / 4095.0), 2.0);
-            B0 = AdcbResultRegs.ADCRESULT0;
-            break;
-        case 5:
-            EPwm3Regs.CMPB.bit.CMPB = EPwm3Regs.TBPRD * powf((AdcbResultRegs.ADCRESULT2 / 4095.0), 2.0);
-            B2 = AdcbResultRegs.ADCRESULT2;
-            break;
-        case 6:
-            EPwm4Regs.CMPA.bit.CMPA = EPwm4Regs.TBPRD * powf((AdcbResultRegs.ADCRESULT3 / 4095.0), 2.0);
-            B3 = AdcbResultRegs.ADCRESULT3;
-            break;
-        case 7:
-            EPwm4Regs.CMPB.bit.CMPB = EPwm4Regs.TBPRD * powf((AdcbResultRegs.ADCRESULT4 / 4095.0), 2.0);
-            B4 = AdcbResultRegs.ADCRESULT4;
-            break;
-        case 8:
-            EPwm5Regs.CMPA.bit.CMPA = EPwm5Regs.TBPRD * powf((AdcbResultRegs.ADCRESULT5 / 4095.0), 2.0);
-            B5 = AdcbResultRegs.ADCRESULT5;
-            break;
-        case 9:
-            EPwm5Regs.CMPB.bit.CMPB = EPwm5Regs.TBPRD * powf((AdccResultRegs.ADCRESULT2 / 4095.0), 2.0);
-            C2 = AdccResultRegs.ADCRESULT2;
-            break;
-        case 10:
-            EPwm6Regs.CMPA.bit.CMPA = EPwm6Regs.TBPRD * powf((AdccResultRegs.ADCRESULT3 / 4095.0), 2.0);
-            C3 = AdccResultRegs.ADCRESULT3;
-            break;
-        case 11:
-            EPwm6Regs.CMPB.bit.CMPB = EPwm6Regs.TBPRD * powf((AdccResultRegs.ADCRESULT4 / 4095.0), 2.0);
-            C4 = AdccResultRegs.ADCRESULT4;
-            break;
-        case 12:
-            EPwm7Regs.CMPA.bit.CMPA = EPwm7Regs.TBPRD * powf((AdccResultRegs.ADCRESULT5 / 4095.0), 2.0);
-            C5 = AdccResultRegs.ADCRESULT5;
-            break;
-        case 13:
-            EPwm7Regs.CMPB.bit.CMPB = EPwm7Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT0 / 4095.0), 2.0);
-            D0 = AdcdResultRegs.ADCRESULT0;
-            break;
-        case 14:
-            EPwm8Regs.CMPA.bit.CMPA = EPwm8Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT1 / 4095.0), 2.0);
-            D1 = AdcdResultRegs.ADCRESULT1;
-            break;
-        case 15:
-            EPwm8Regs.CMPB.bit.CMPB = EPwm8Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT2 / 4095.0), 2.0);
-            D2 = AdcdResultRegs.ADCRESULT2;
-            break;
-        case 16:
-            EPwm9Regs.CMPA.bit.CMPA = EPwm9Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT3 / 4095.0), 2.0);
-            D3 = AdcdResultRegs.ADCRESULT3;
-            break;
-        case 17:
-            EPwm9Regs.CMPB.bit.CMPB = EPwm9Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT4 / 4095.0), 2.0);
-            D4 = AdcdResultRegs.ADCRESULT4;
-            break;
-        case 18:
-            EPwm10Regs.CMPA.bit.CMPA = EPwm10Regs.TBPRD * powf((AdcdResultRegs.ADCRESULT5 / 4095.0), 2.0);
-            D5 = AdcdResultRegs.ADCRESULT5;
-            break;
-        case 19:
-            EPwm10Regs.CMPB.bit.CMPB = EPwm10Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT14 / 4095.0), 2.0);
-            IN14 = AdcaResultRegs.ADCRESULT14;
-            break;
-        case 20:
-            EPwm11Regs.CMPA.bit.CMPA = EPwm11Regs.TBPRD * powf((AdcaResultRegs.ADCRESULT15 / 4095.0), 2.0);
-            IN15 = AdcaResultRegs.ADCRESULT15;
-            break;
-        case 21:
-            EPwm11Regs.CMPB.bit.CMPB = EPwm11Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 22:
-            EPwm12Regs.CMPA.bit.CMPA = EPwm12Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 23:
-            EPwm12Regs.CMPB.bit.CMPB = EPwm12Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 24:
-            EPwm13Regs.CMPA.bit.CMPA = EPwm13Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 25:
-            EPwm13Regs.CMPB.bit.CMPB = EPwm13Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 26:
-            EPwm14Regs.CMPA.bit.CMPA = EPwm14Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 27:
-            EPwm14Regs.CMPB.bit.CMPB = EPwm14Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 28:
-            EPwm15Regs.CMPA.bit.CMPA = EPwm15Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 29:
-            EPwm15Regs.CMPB.bit.CMPB = EPwm15Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 30:
-            EPwm16Regs.CMPA.bit.CMPA = EPwm16Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 31:
-            EPwm16Regs.CMPB.bit.CMPB = EPwm16Regs.TBPRD * powf((DacaRegs.DACVALS.bit.DACVALS / 4095.0), 2.0);
-            break;
-        case 32:
-            EPwm1Regs.CMPA.bit.CMPA = 0;
-            EPwm1Regs.CMPB.bit.CMPB = 0;
-            EPwm2Regs.CMPA.bit.CMPA = 0;
-            EPwm2Regs.CMPB.bit.CMPB = 0;
-            EPwm3Regs.CMPA.bit.CMPA = 0;
-            EPwm3Regs.CMPB.bit.CMPB = 0;
-            EPwm4Regs.CMPA.bit.CMPA = 0;
-            EPwm4Regs.CMPB.bit.CMPB = 0;
-            EPwm5Regs.CMPA.bit.CMPA = 0;
-            EPwm5Regs.CMPB.bit.CMPB = 0;
-            EPwm6Regs.CMPA.bit.CMPA = 0;
-            EPwm6Regs.CMPB.bit.CMPB = 0;
-            EPwm7Regs.CMPA.bit.CMPA = 0;
-            EPwm7Regs.CMPB.bit.CMPB = 0;
-            EPwm8Regs.CMPA.bit.CMPA = 0;
-            EPwm8Regs.CMPB.bit.CMPB = 0;
-            EPwm9Regs.CMPA.bit.CMPA = 0;
-            EPwm9Regs.CMPB.bit.CMPB = 0;
-            EPwm10Regs.CMPA.bit.CMPA = 0;
-            EPwm10Regs.CMPB.bit.CMPB = 0;
-            EPwm11Regs.CMPA.bit.CMPA = 0;
-            EPwm11Regs.CMPB.bit.CMPB = 0;
-            EPwm12Regs.CMPA.bit.CMPA = 0;
-            EPwm12Regs.CMPB.bit.CMPB = 0;
-            EPwm13Regs.CMPA.bit.CMPA = 0;
-            EPwm13Regs.CMPB.bit.CMPB = 0;
-            EPwm14Regs.CMPA.bit.CMPA = 0;
-            EPwm14Regs.CMPB.bit.CMPB = 0;
-            EPwm15Regs.CMPA.bit.CMPA = 0;
-            EPwm15Regs.CMPB.bit.CMPB = 0;
-            EPwm16Regs.CMPA.bit.CMPA = 0;
-            EPwm16Regs.CMPB.bit.CMPB = 0;
-            break;
-        default:
-            break;
+        uint16_t value = ADCtoPWM_Read(adcPwmRoute[i].source);
+
+        if (adcPwmRoute[i].shadow != 0)
+            *adcPwmRoute[i].shadow = value;
+        *adcPwmRoute[i].compare = adcGammaLut[value];
+    }
+    else if (i == ADC_PWM_NUMBER_OF_ROUTES)
+    {
+        for (uint16_t j = 0; j < ADC_PWM_NUMBER_OF_ROUTES; j++)
+            *adcPwmRoute[j].compare = 0;
+    }
+    PwmDutyCommit();
+#endif
+}
+
+//=== Function: ADCtoPWM_All ======================================================================
+///
+/// @brief  Function updates the PWM compares and result variables of all 32 channels in one loop.
+///         All channels are committed together and switch at the same counter-zero event.
+///         With CLA_ADC_ENABLE CLA task 1 updates all routes after every ADC frame
+///
+/// @param  void
+///
+/// @return void
+///
+//===========================================================================================================
+void ADCtoPWM_All(void)
+{
+#if CLA_ADC_ENABLE
+    ClaAdcSelect(CLA_ADC_ROUTE_ALL);
+    PwmSampleTrack();
+#else
+    for (uint16_t i = 0; i < ADC_PWM_NUMBER_OF_ROUTES; i++)
+    {
+        uint16_t value = ADCtoPWM_Read(adcPwmRoute[i].source);
+
+        if (adcPwmRoute[i].shadow != 0)
+            *adcPwmRoute[i].shadow = value;
+        *adcPwmRoute[i].compare = adcGammaLut[value];
     }
+    PwmDutyCommit();
+#endif
 }
 
 //=== Function: GPIOLEDs_On ==========================================================================
@@ -880,111 +1050,8 @@ void ADCtoPWM(int i)
 //===========================================================================================================
 void GPIOLEDs_On(int i)
 {
-    switch (i)
-    {
-        case 0:
-            GpioDataRegs.GPDCLEAR.bit.GPIO116 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO38 = 1;
-            GpioDataRegs.GPACLEAR.bit.GPIO29 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO85 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO32 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO39 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO125 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO72 = 1;
-            break;
-        case 1:
-            GpioDataRegs.GPDCLEAR.bit.GPIO121 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO50 = 1;
-            GpioDataRegs.GPACLEAR.bit.GPIO30 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO69 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO37 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO49 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO131 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO71 = 1;
-            break;
-        case 2:
-            GpioDataRegs.GPDCLEAR.bit.GPIO117 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO40 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO134 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO77 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO120 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO51 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO132 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO87 = 1;
-            break;
-        case 3:
-            GpioDataRegs.GPCCLEAR.bit.GPIO83 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO52 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO48 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO119 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO53 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO136 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO58 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO86 = 1;
-            break;
-        case 4:
-            GpioDataRegs.GPCCLEAR.bit.GPIO81 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO55 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO124 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO122 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO54 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO60 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO59 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO80 = 1;
-            break;
-        case 5:
-            GpioDataRegs.GPCCLEAR.bit.GPIO84 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO57 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO115 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO114 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO56 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO64 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO65 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO82 = 1;
-            break;
-        case 6:
-            GpioDataRegs.GPBCLEAR.bit.GPIO46 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO44 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO123 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO112 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO41 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO66 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO61 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO90 = 1;
-            break;
-        case 7:
-            GpioDataRegs.GPCCLEAR.bit.GPIO88 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO130 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO118 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO107 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO45 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO63 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO79 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO89 = 1;
-            break;
-        case 8:
-            GpioDataRegs.GPBCLEAR.bit.GPIO43 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO128 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO113 = 1;
-            GpioDataRegs.GPACLEAR.bit.GPIO31 = 1;
-            GpioDataRegs.GPECLEAR.bit.GPIO129 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO62 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO76 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO42 = 1;
-            break;
-        case 9:
-            GpioDataRegs.GPACLEAR.bit.GPIO9 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO126 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO111 = 1;
-            GpioDataRegs.GPBCLEAR.bit.GPIO36 = 1;
-            GpioDataRegs.GPDCLEAR.bit.GPIO127 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO78 = 1;
-            GpioDataRegs.GPCCLEAR.bit.GPIO68 = 1;
-            GpioDataRegs.GPACLEAR.bit.GPIO8 = 1;
-            break;
-        default:
-            break;
-    }
+    if (i >= 0 && i < LED_NUMBER_OF_GPIO_LEDS)
+        LedOn(&ledGpioGroup, 1UL << i);
 }
 
 //=== Function: GPIOLEDs_Off ==========================================================================
@@ -998,109 +1065,6 @@ void GPIOLEDs_On(int i)
 //===========================================================================================================
 void GPIOLEDs_Off(int i)
 {
-    switch (i)
-    {
-        case 0:
-            GpioDataRegs.GPDSET.bit.GPIO116 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO38 = 1;
-            GpioDataRegs.GPASET.bit.GPIO29 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO85 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO32 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO39 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO125 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO72 = 1;
-            break;
-        case 1:
-            GpioDataRegs.GPDSET.bit.GPIO121 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO50 = 1;
-            GpioDataRegs.GPASET.bit.GPIO30 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO69 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO37 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO49 = 1;
-            GpioDataRegs.GPESET.bit.GPIO131 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO71 = 1;
-            break;
-        case 2:
-            GpioDataRegs.GPDSET.bit.GPIO117 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO40 = 1;
-            GpioDataRegs.GPESET.bit.GPIO134 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO77 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO120 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO51 = 1;
-            GpioDataRegs.GPESET.bit.GPIO132 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO87 = 1;
-            break;
-        case 3:
-            GpioDataRegs.GPCSET.bit.GPIO83 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO52 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO48 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO119 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO53 = 1;
-            GpioDataRegs.GPESET.bit.GPIO136 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO58 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO86 = 1;
-            break;
-        case 4:
-            GpioDataRegs.GPCSET.bit.GPIO81 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO124 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO122 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO54 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO60 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO59 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO80 = 1;
-            break;
-        case 5:
-            GpioDataRegs.GPCSET.bit.GPIO84 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO115 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO114 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO56 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO64 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO65 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO82 = 1;
-            break;
-        case 6:
-            GpioDataRegs.GPBSET.bit.GPIO46 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO123 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO112 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO41 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO66 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO61 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO90 = 1;
-            break;
-        case 7:
-            GpioDataRegs.GPCSET.bit.GPIO88 = 1;
-            GpioDataRegs.GPESET.bit.GPIO130 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO118 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO107 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO45 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO63 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO79 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO89 = 1;
-            break;
-        case 8:
-            GpioDataRegs.GPBSET.bit.GPIO43 = 1;
-            GpioDataRegs.GPESET.bit.GPIO128 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO113 = 1;
-            GpioDataRegs.GPASET.bit.GPIO31 = 1;
-            GpioDataRegs.GPESET.bit.GPIO129 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO62 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO76 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO42 = 1;
-            break;
-        case 9:
-            GpioDataRegs.GPASET.bit.GPIO9 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO111 = 1;
-            GpioDataRegs.GPBSET.bit.GPIO36 = 1;
-            GpioDataRegs.GPDSET.bit.GPIO127 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO78 = 1;
-            GpioDataRegs.GPCSET.bit.GPIO68 = 1;
-            GpioDataRegs.GPASET.bit.GPIO8 = 1;
-            break;
-        default:
-            break;
-    }
+    if (i >= 0 && i < LED_NUMBER_OF_GPIO_LEDS)
+        LedOff(&ledGpioGroup, 1UL << i);
 }
@@ -15,15 +15,145 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_Device.h"
+#include "TB_DMA.h"
+#include "TB_PWM.h"
+#include "TB_Shared.h"
+#include "TB_LED.h"
+#include "TB_ADCStats.h"
+#include "TB_CLB.h"
+#include "TB_Trip.h"
+#include "TB_CLA.h"
+#include "TB_LedFade.h"
 
 //-------------------------------------------------------------------------------------------------
-// Global variables
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Source of the ADC results in ADCINs_Check()
+// 1: frames captured by the DMA (DmaInitAdcCapture() must be called after AdcInitAll())
+// 0: ADC result registers read by the CPU
+#define ADC_CAPTURE_DMA             1
+// Number of DMA frames (5 us each) to wait after every DAC step
+#define ADC_SETTLE_FRAMES           4
+// Sweep modes of ADCINs_Check()
+// ADC_SWEEP_SPARSE: only the check point codes are set, waiting the measured settling time
+// ADC_SWEEP_FULL:   full linearity sweep through all DAC codes
+#define ADC_SWEEP_SPARSE            0
+#define ADC_SWEEP_FULL              1
+// Number of DAC codes of the full sweep
+#define ADC_SWEEP_CODES             3900
+// Number of check point codes of the sparse sweep
+#define ADC_NUMBER_OF_CHECK_CODES   4
+// Number of mux channels with an ADC result (channels 21..31 are routed to DAC-A)
+#define ADC_NUMBER_OF_CHECKED_CHANNELS  21
+// Settling time measurement: maximum deviation of two frames in LSB,
+// upper limit (500 us) and margin in frames
+#define ADC_SETTLE_TOLERANCE        8
+#define ADC_SETTLE_MAX_FRAMES       100
+#define ADC_SETTLE_MARGIN_FRAMES    2
+// Acquisition window tuning (ADC_TuneAcqps()): maximum deviation in LSB of the mean of
+// ADC_ACQPS_TUNE_SAMPLES frames from the reference window ADC_ACQPS_MAX, step of the search and
+// margin added to the shortest passing window
+#define ADC_ACQPS_TUNE_TOLERANCE    2
+#define ADC_ACQPS_TUNE_SAMPLES      8
+#define ADC_ACQPS_TUNE_STEP         4
+#define ADC_ACQPS_TUNE_MARGIN       8
+// 1: GPIO LED check (Group-A to Group-H) is executed by CPU2 (project CTB_TestCode_CPU2)
+//    while CPU1 runs the Error LED and PWM LED checks
+// 0: all LED checks are executed by CPU1
+#define TB_GPIOLEDS_ON_CPU2         1
+// Modes of GPIOLEDs_Check()
+// GPIO_LED_CHECK_VISUAL:   the LEDs light up row by row for an operator (on CPU2 with TB_GPIOLEDS_ON_CPU2)
+// GPIO_LED_CHECK_LOOPBACK: walking-ones/zeros loopback of all GPIOs on CPU1, result in gpioLedLoopback
+#define GPIO_LED_CHECK_VISUAL       0
+#define GPIO_LED_CHECK_LOOPBACK     1
+// Modes of PWM_LEDs_Check()
+// PWM_LED_CHECK_VISUAL: the PWM LEDs light up one after the other (GPIO mode of the pins)
+// PWM_LED_CHECK_FADE:   the ePWMs drive the pins, the fade engine (TB_LedFade) runs a chase
+//                       animation Repeat_count times without the CPU
+#define PWM_LED_CHECK_VISUAL        0
+#define PWM_LED_CHECK_FADE          1
+// Number of channels routed to the PWM_LEDs by ADCtoPWM()
+#define ADC_PWM_NUMBER_OF_ROUTES    32
+// Number of entries of the gamma lookup table (one per 12 bit result)
+#define ADC_GAMMA_LUT_SIZE          4096
+// Routing source: value of DAC-A instead of an ADC result
+#define ADC_SOURCE_DACA             0xFFFF
+// Mux channels with an address (0..20) and channel which parks all muxes
+#define MUX_NUMBER_OF_CHANNELS      21
+#define MUX_PARK                    23
+// Muxes, each has three select lines (GPIO126/128/130, GPIO136/132/131, GPIO44/57/55)
+#define MUX_GROUP_NONE              0
+#define MUX_GROUP_1                 1
+#define MUX_GROUP_2                 2
+#define MUX_GROUP_3                 3
+#define MUX_NUMBER_OF_GROUPS        4
+// GPIO ports with select lines: B (GPIO32..63), D (GPIO96..127), E (GPIO128..159)
+#define MUX_NUMBER_OF_PORTS         3
+#define MUX_PORT_B                  0
+#define MUX_PORT_D                  1
+#define MUX_PORT_E                  2
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
 //-------------------------------------------------------------------------------------------------
+// Entry of the routing table of ADCtoPWM()
+typedef struct
+{
+    uint16_t source;                // ADC_SOURCE() or ADC_SOURCE_DACA
+    volatile uint16_t *compare;     // PWM compare register
+    uint16_t *shadow;               // result variable (0 if not used)
+} ADCtoPWM_Route;
 
+// Address of one mux channel: level of the select lines of its mux per port (B, D, E)
+typedef struct
+{
+    uint16_t group;                         // MUX_GROUP_x, only its lines are written
+    uint32_t level[MUX_NUMBER_OF_PORTS];    // bit set: select line high
+} MuxAddress;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// On/off times of the LED checks in us and number of repetitions of the checks
+extern long double OFFTIME, ONTIME;
+extern uint16_t Repeat_count;
+// Sweep mode of ADCINs_Check() (can be changed in the debugger before the analog checks)
+extern uint16_t adcSweepMode;
+// Mode of PWM_LEDs_Check() (can be changed in the debugger before the LED checks)
+extern uint16_t pwmLedCheckMode;
+// Mode of GPIOLEDs_Check() and stuck/shorted GPIOs of Group-A to Group-H found by the loopback
+extern uint16_t gpioLedCheckMode;
+extern LedLoopbackResult gpioLedLoopback;
+// Measured settling time of the DAC/mux/ADC path in frames (5 us), set by ADC_MeasureSettleTime()
+extern uint16_t adcSettleFrames;
+// Channels whose reference result at ADC_ACQPS_MAX failed the error limit, set by ADC_TuneAcqps()
+extern uint16_t adcAcqpsFailed;
+// Tolerance of the ADC results (result >= ADC_error_buffer * DAC value)
+extern float32 ADC_error_buffer;
+// DAC codes at which the ADC results are checked
+extern const uint16_t adcCheckCodes[ADC_NUMBER_OF_CHECK_CODES];
+// Routing table and gamma lookup table of ADCtoPWM()
+extern const ADCtoPWM_Route adcPwmRoute[ADC_PWM_NUMBER_OF_ROUTES];
+extern uint16_t adcGammaLut[ADC_GAMMA_LUT_SIZE];
+// Address table of the mux channels and select lines of every mux
+extern const MuxAddress muxAddress[MUX_NUMBER_OF_CHANNELS];
+extern const uint32_t muxGroupLines[MUX_NUMBER_OF_GROUPS][MUX_NUMBER_OF_PORTS];
+// Selected mux channel and level of all select lines as written by Mux_Select()
+extern volatile int muxSelected;
+extern uint32_t muxLevel[MUX_NUMBER_OF_PORTS];
 
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
+// Routing source of SOC "soc" of ADC module "module" (a, b, c or d), index into a DMA frame
+#define ADC_SOURCE(module, soc)     (DMA_ADC_OFFSET_##module + (soc))
+// Select line masks of the GPIO ports B, D and E
+#define MUX_B(gpio)                 (1UL << ((gpio) - 32))
+#define MUX_D(gpio)                 (1UL << ((gpio) - 96))
+#define MUX_E(gpio)                 (1UL << ((gpio) - 128))
+// Address of the 16 bit compare value CMPA/CMPB (upper word of the register, lower word is HRPWM)
+#define PWM_CMPA_ADDR(regs)         ((volatile uint16_t *)&(regs).CMPA + 1)
+#define PWM_CMPB_ADDR(regs)         ((volatile uint16_t *)&(regs).CMPB + 1)
 
 
 //-------------------------------------------------------------------------------------------------
@@ -36,12 +166,23 @@ extern void GPIOLEDs_Check(void);
 extern void ADCINs_Check(void);
 extern void Hardware_Error_Detection_Check(void);
 extern void ADC_ErrorCheck(int);
+extern uint16_t ADC_GetErrorCount(void);
 extern void Error_LEDs_Off(int);
 extern void Error_LEDs_On(int);
 extern void PWM_LEDs_On(int);
 extern void PWM_LEDs_Off(int);
+extern void Mux_Init(void);
 extern void Mux_Select(int);
+extern bool Mux_Preselect(int);
+extern void Mux_Release(int);
 extern void ADCtoPWM(int);
+extern void ADCtoPWM_Init(void);
+extern void ADCtoPWM_All(void);
+extern uint16_t ADCtoPWM_Read(uint16_t);
+extern void ADC_SetDACs(uint16_t);
+extern void ADC_WaitFrames(uint16_t);
+extern uint16_t ADC_MeasureSettleTime(void);
+extern uint16_t ADC_TuneAcqps(void);
 extern void GPIOLEDs_On(int);
 extern void GPIOLEDs_Off(int);
 
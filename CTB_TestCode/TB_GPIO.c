@@ -17,1150 +17,451 @@
 #include "TB_GPIO.h"
 
 
-//=== Function: GpioInit_Error_LEDs ==========================================================================
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// GPIOs of the LEDs in Group-A to Group-H (in the order of GPIOLEDs_On())
+const uint16_t gpioGroupAtoHPins[GPIO_NUMBER_OF_GROUP_A_TO_H_PINS] =
+{
+    116,  38,  29,  85,  32,  39, 125,  72,
+    121,  50,  30,  69,  37,  49, 131,  71,
+    117,  40, 134,  77, 120,  51, 132,  87,
+     83,  52,  48, 119,  53, 136,  58,  86,
+     81,  55, 124, 122,  54,  60,  59,  80,
+     84,  57, 115, 114,  56,  64,  65,  82,
+     46,  44, 123, 112,  41,  66,  61,  90,
+     88, 130, 118, 107,  45,  63,  79,  89,
+     43, 128, 113,  31, 129,  62,  76,  42,
+      9, 126, 111,  36, 127,  78,  68,   8
+};
+
+// Pin table of the Error LEDs
+const GpioPinConfig gpioErrorLedPins[GPIO_NUMBER_OF_ERROR_LED_PINS] =
+{
+    { 47, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 1
+    { 73, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 2
+    { 34, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 3
+    { 23, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 4
+    { 26, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 5
+    { 25, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 6
+    {102, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 7
+    {101, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 8
+    { 18, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 9
+    { 17, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 10
+    { 13, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 11
+    {  0, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 12
+    {  4, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 13
+    {109, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 14
+    {110, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 15
+    {106, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 16
+    {108, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 17
+    {105, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 18
+    { 33, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 19
+    { 22, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 20
+    { 27, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 21
+    { 24, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 22
+    {103, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 23
+    {100, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 24
+    { 19, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 25
+    { 16, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 26
+    { 12, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 27
+    {  1, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Error 28
+    { 70, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH}    // Error 29
+};
+
+// Pin table of Group-A to Group-D
+const GpioPinConfig gpioGroupABCDPins[GPIO_NUMBER_OF_GROUP_ABCD_PINS] =
+{
+    {116, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {121, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {117, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 48, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {124, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {115, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {123, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {118, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {113, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {111, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 38, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 50, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 40, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 53, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 54, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 56, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 41, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 45, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {129, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {127, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 29, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 30, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {134, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 58, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 59, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 65, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 61, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 79, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 76, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 68, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 85, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 69, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 77, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 83, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 81, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 84, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 46, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 88, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 43, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {  9, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH}
+};
+
+// Pin table of Group-E to Group-H
+const GpioPinConfig gpioGroupEFGHPins[GPIO_NUMBER_OF_GROUP_EFGH_PINS] =
+{
+    { 32, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 37, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {120, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {119, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {122, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {114, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {112, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {107, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 31, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 36, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 39, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 49, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 51, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 52, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 55, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 57, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 44, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {130, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {128, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {126, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {125, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {131, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {132, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {136, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 60, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 64, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 66, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 63, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 62, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 78, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 72, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 71, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 87, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 86, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 80, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 82, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 90, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 89, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 42, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    {  8, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH}
+};
+
+// Pin table of the hardware error detection (reset outputs, Q & Q-bar inputs)
+const GpioPinConfig gpioHardwareErrorPins[GPIO_NUMBER_OF_HARDWARE_ERROR_PINS] =
+{
+    { 98, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},   // Reset
+    { 10, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 11, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 97, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_HIGH},
+    { 96, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},   // Q & Q-bar
+    { 99, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    { 95, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    { 15, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    { 14, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    {104, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    { 21, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP},
+    { 20, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_INPUT, GPIO_LEVEL_KEEP}
+};
+
+// Pin table of the PWM_LEDs (level set later by the LED checks)
+const GpioPinConfig gpioPwmLedPins[GPIO_NUMBER_OF_PWM_LED_PINS] =
+{
+    {137, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {138, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {139, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {140, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {141, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {142, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {143, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {144, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {145, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {146, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {147, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {148, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {149, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {150, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {151, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {152, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {153, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {154, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {155, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {156, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {157, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {158, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {159, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {160, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {161, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {162, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {163, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {164, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {165, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {166, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {167, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP},
+    {168, GPIO_MULTIPLEX_GPIO, GPIO_DISABLE_PULLUP, GPIO_OUTPUT, GPIO_LEVEL_KEEP}
+};
+
+// First pin found twice in the pin tables (GPIO_NO_CONFLICT: none), set by GpioInitTable()
+uint16_t gpioConflictPin = GPIO_NO_CONFLICT;
+// Pins configured by GpioInitTable() so far, one bit per GPIO
+uint32_t gpioConfiguredPins[GPIO_NUMBER_OF_PORTS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: GpioInitTable =====================================================================
 ///
-/// @brief  Function initialises all Error LEDs GPIO's as outputs
+/// @brief  Function configures all pins of a pin table. The table is collected per port into
+///         32 bit masks, so every LOCK, GMUX, MUX, PUD and DIR register of a port is written once
+///         instead of once per pin. The output latch (SET/CLEAR) is written before DIR, so an
+///         output starts with its level. Following the TRM the MUX bits are cleared before GMUX
+///         is changed. A pin which is found twice in the table or which was already configured
+///         by another table is reported in gpioConflictPin and the table is not written
 ///
-/// @param  void
+/// @param  const GpioPinConfig *table, uint16_t numberOfPins
 ///
-/// @return void
+/// @return bool success (false: pin conflict or invalid pin)
 ///
-//===========================================================================================================
-void GpioInit_Error_LEDs(void)
+//=================================================================================================
+bool GpioInitTable(const GpioPinConfig *table, uint16_t numberOfPins)
 {
-    EALLOW;
-
-    // Error 1
-    GpioCtrlRegs.GPBLOCK.bit.GPIO47 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO47 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO47 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO47 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO47 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO47 = 1;
-
-    // Error 2
-    GpioCtrlRegs.GPCLOCK.bit.GPIO73 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO73 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO73 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO73 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO73 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO73 = 1;
-
-    // Error 3
-    GpioCtrlRegs.GPBLOCK.bit.GPIO34 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO34 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO34 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO34 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO34 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO34 = 1;
-
-    // Error 4
-    GpioCtrlRegs.GPALOCK.bit.GPIO23 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO23 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO23 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO23 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO23 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO23 = 1;
-
-    // Error 5
-    GpioCtrlRegs.GPALOCK.bit.GPIO26 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO26 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO26 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO26 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO26 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO26 = 1;
-
-    // Error 6
-    GpioCtrlRegs.GPALOCK.bit.GPIO25 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO25 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO25 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO25 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO25 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO25 = 1;
-
-    // Error 7
-    GpioCtrlRegs.GPDLOCK.bit.GPIO102 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO102 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO102 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO102 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO102 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO102 = 1;
-
-    // Error 8
-    GpioCtrlRegs.GPDLOCK.bit.GPIO101 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO101 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO101 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO101 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO101 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO101 = 1;
-
-    // Error 9
-    GpioCtrlRegs.GPALOCK.bit.GPIO18 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO18 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO18 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO18 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO18 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO18 = 1;
+    uint32_t tablePins[GPIO_NUMBER_OF_PORTS] = {0};
+    uint16_t port;
+    uint16_t i;
+
+    // Check the whole table before the first register is written
+    for (i = 0; i < numberOfPins; i++)
+    {
+        uint16_t pin = table[i].pin;
+        uint32_t mask = 1UL << (pin % 32);
+
+        if (pin > GPIO_MAX_PIN || ((tablePins[pin / 32] | gpioConfiguredPins[pin / 32]) & mask))
+        {
+            if (gpioConflictPin == GPIO_NO_CONFLICT)
+                gpioConflictPin = pin;
+            return false;
+        }
+        tablePins[pin / 32] |= mask;
+    }
 
-    // Error 10
-    GpioCtrlRegs.GPALOCK.bit.GPIO17 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO17 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO17 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO17 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO17 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO17 = 1;
-
-    // Error 11
-    GpioCtrlRegs.GPALOCK.bit.GPIO13 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO13 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO13 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO13 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO13 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO13 = 1;
-
-    // Error 12
-    GpioCtrlRegs.GPALOCK.bit.GPIO0 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO0 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO0 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO0 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO0 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO0 = 1;
-
-    // Error 13
-    GpioCtrlRegs.GPALOCK.bit.GPIO4 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO4 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO4 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO4 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO4 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO4 = 1;
-
-    // Error 14
-    GpioCtrlRegs.GPDLOCK.bit.GPIO109 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO109 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO109 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO109 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO109 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO109 = 1;
-
-    // Error 15
-    GpioCtrlRegs.GPDLOCK.bit.GPIO110 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO110 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO110 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO110 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO110 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO110 = 1;
-
-    // Error 16
-    GpioCtrlRegs.GPDLOCK.bit.GPIO106 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO106 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO106 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO106 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO106 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO106 = 1;
-
-    // Error 17
-    GpioCtrlRegs.GPDLOCK.bit.GPIO108 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO108 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO108 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO108 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO108 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO108 = 1;
+    EALLOW;
 
-    // Error 18
-    GpioCtrlRegs.GPDLOCK.bit.GPIO105 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO105 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO105 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO105 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO105 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO105 = 1;
+    for (port = 0; port < GPIO_NUMBER_OF_PORTS; port++)
+    {
+        // The control registers of one port take 0x40 words, the data registers 8 words
+        volatile uint32_t *ctrl = (volatile uint32_t *)&GpioCtrlRegs.GPACTRL + port * (GPIO_PORT_REGS_SIZE / 2);
+        volatile uint32_t *data = (volatile uint32_t *)&GpioDataRegs.GPADAT + port * GPIO_PORT_DATA_REGS;
+        uint32_t muxMask[2] = {0, 0};
+        uint32_t muxValue[2] = {0, 0};
+        uint32_t gmuxValue[2] = {0, 0};
+        uint32_t pudDisable = 0;
+        uint32_t output = 0;
+        uint32_t high = 0;
+        uint32_t low = 0;
+        uint16_t half;
+
+        if (tablePins[port] == 0)
+            continue;
+
+        for (i = 0; i < numberOfPins; i++)
+        {
+            const GpioPinConfig *config = &table[i];
+            uint16_t bit = config->pin % 32;
+            uint32_t mask = 1UL << bit;
+            // GPxMUX1/2 and GPxGMUX1/2 hold 16 GPIOs with two bits each
+            uint16_t shift = (bit % 16) * 2;
+
+            if (config->pin / 32 != port)
+                continue;
+
+            muxMask[bit / 16] |= 3UL << shift;
+            muxValue[bit / 16] |= (uint32_t)(config->mux & 0x03) << shift;
+            gmuxValue[bit / 16] |= (uint32_t)(config->mux >> 2) << shift;
+            if (config->pullup == GPIO_DISABLE_PULLUP)
+                pudDisable |= mask;
+            if (config->direction == GPIO_OUTPUT)
+                output |= mask;
+            if (config->level == GPIO_LEVEL_HIGH)
+                high |= mask;
+            else if (config->level == GPIO_LEVEL_LOW)
+                low |= mask;
+        }
+
+        if (high != 0)
+            data[GPIO_PORT_SET] = high;
+        if (low != 0)
+            data[GPIO_PORT_CLEAR] = low;
+
+        ctrl[GPIO_REG_LOCK] &= ~tablePins[port];
+        for (half = 0; half < 2; half++)
+        {
+            if (muxMask[half] == 0)
+                continue;
+            ctrl[GPIO_REG_MUX1 + half] &= ~muxMask[half];
+            ctrl[GPIO_REG_GMUX1 + half] = (ctrl[GPIO_REG_GMUX1 + half] & ~muxMask[half]) | gmuxValue[half];
+            ctrl[GPIO_REG_MUX1 + half] |= muxValue[half];
+        }
+        ctrl[GPIO_REG_PUD] = (ctrl[GPIO_REG_PUD] & ~tablePins[port]) | pudDisable;
+        ctrl[GPIO_REG_DIR] = (ctrl[GPIO_REG_DIR] & ~tablePins[port]) | output;
+
+        gpioConfiguredPins[port] |= tablePins[port];
+    }
 
-    // Error 19
-    GpioCtrlRegs.GPBLOCK.bit.GPIO33 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO33 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO33 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO33 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO33 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO33 = 1;
+    EDIS;
 
-    // Error 20
-    GpioCtrlRegs.GPALOCK.bit.GPIO22 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO22 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO22 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO22 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO22 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO22 = 1;
+    return true;
+}
 
-    // Error 21
-    GpioCtrlRegs.GPALOCK.bit.GPIO27 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO27 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO27 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO27 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO27 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO27 = 1;
 
-    // Error 22
-    GpioCtrlRegs.GPALOCK.bit.GPIO24 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO24 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO24 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO24 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO24 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO24 = 1;
+//=== Function: GpioSetCore_GroupAtoH =======================================================================
+///
+/// @brief  Function selects the core which controls the data registers of the GPIOs in Group-A
+///         to Group-H (GPxCSELy, four bits per GPIO). The pin configuration stays on CPU1
+///
+/// @param  uint16_t core (GPIO_CONTROLLED_BY_CPU1, GPIO_CONTROLLED_BY_CPU2, ...)
+///
+/// @return void
+///
+//===========================================================================================================
+void GpioSetCore_GroupAtoH(uint16_t core)
+{
+    EALLOW;
 
-    // Error 23
-    GpioCtrlRegs.GPDLOCK.bit.GPIO103 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO103 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO103 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO103 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO103 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO103 = 1;
+    for (uint16_t i = 0; i < GPIO_NUMBER_OF_GROUP_A_TO_H_PINS; i++)
+    {
+        uint16_t pin = gpioGroupAtoHPins[i];
+        // The registers of one port take 0x40 words, GPxCSEL1..4 hold 8 GPIOs each
+        volatile uint32_t *csel = (volatile uint32_t *)&GpioCtrlRegs.GPACSEL1
+                                  + (pin / 32) * (GPIO_PORT_REGS_SIZE / 2) + (pin % 32) / 8;
+        uint16_t shift = (pin % 8) * 4;
 
-    // Error 24
-    GpioCtrlRegs.GPDLOCK.bit.GPIO100 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO100 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO100 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO100 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO100 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO100 = 1;
+        *csel = (*csel & ~(0xFUL << shift)) | ((uint32_t)core << shift);
+    }
 
-    // Error 25
-    GpioCtrlRegs.GPALOCK.bit.GPIO19 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO19 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO19 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO19 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO19 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO19 = 1;
+    EDIS;
+}
 
-    // Error 26
-    GpioCtrlRegs.GPALOCK.bit.GPIO16 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO16 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO16 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO16 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO16 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO16 = 1;
 
-    // Error 27
-    GpioCtrlRegs.GPALOCK.bit.GPIO12 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO12 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO12 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO12 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO12 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO12 = 1;
+//=== Function: GpioSetPeripheral =================================================================
+///
+/// @brief  Function assigns a peripheral function to one GPIO: unlocks the configuration, writes
+///         the multiplexer (GPxGMUX = mux / 4, GPxMUX = mux % 4) and the pull-up resistor
+///
+/// @param  uint16_t pin, uint16_t mux (e.g. GPIO_MULTIPLEX_EPWM),
+///         uint16_t pullup (GPIO_ENABLE_PULLUP or GPIO_DISABLE_PULLUP)
+///
+/// @return void
+///
+//===========================================================================================================
+void GpioSetPeripheral(uint16_t pin, uint16_t mux, uint16_t pullup)
+{
+    // The registers of one port take 0x40 words (0x20 32 bit registers)
+    uint16_t port = (pin / 32) * (GPIO_PORT_REGS_SIZE / 2);
+    uint16_t bit = pin % 32;
+    // GPxMUX1/2 and GPxGMUX1/2 hold 16 GPIOs with two bits each
+    uint16_t shift = (bit % 16) * 2;
+    volatile uint32_t *lock = (volatile uint32_t *)&GpioCtrlRegs.GPALOCK + port;
+    volatile uint32_t *gmux = (volatile uint32_t *)&GpioCtrlRegs.GPAGMUX1 + port + bit / 16;
+    volatile uint32_t *muxReg = (volatile uint32_t *)&GpioCtrlRegs.GPAMUX1 + port + bit / 16;
+    volatile uint32_t *pud = (volatile uint32_t *)&GpioCtrlRegs.GPAPUD + port;
 
-    // Error 28
-    GpioCtrlRegs.GPALOCK.bit.GPIO1 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO1 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO1 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO1 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO1 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO1 = 1;
+    EALLOW;
 
-    // Error 29
-    GpioCtrlRegs.GPCLOCK.bit.GPIO70 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO70 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO70 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO70 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO70 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO70 = 1;
+    *lock &= ~(1UL << bit);
+    *gmux = (*gmux & ~(3UL << shift)) | ((uint32_t)(mux >> 2) << shift);
+    *muxReg = (*muxReg & ~(3UL << shift)) | ((uint32_t)(mux & 0x03) << shift);
+    if (pullup == GPIO_DISABLE_PULLUP)
+        *pud |= 1UL << bit;
+    else
+        *pud &= ~(1UL << bit);
 
     EDIS;
+}
 
+//=== Function: GpioInit_Error_LEDs =============================================================
+///
+/// @brief  Function initialises all Error LEDs GPIO's as outputs (high = LED off).
+///         The pins are listed in gpioErrorLedPins[]
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void GpioInit_Error_LEDs(void)
+{
+    GpioInitTable(gpioErrorLedPins, GPIO_NUMBER_OF_ERROR_LED_PINS);
 }
 
-//=== Function: GpioInit_GroupABCD ==========================================================================
+//=== Function: GpioInit_GroupABCD ==============================================================
 ///
-/// @brief  Function initialises all GPIOs in GroupA to GroupD as outputs
+/// @brief  Function initialises all GPIOs in GroupA to GroupD as outputs.
+///         The pins are listed in gpioGroupABCDPins[]
 ///
 /// @param  void
 ///
 /// @return void
 ///
-//===========================================================================================================
+//=================================================================================================
 void GpioInit_GroupABCD(void)
 {
-    EALLOW;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO116 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO116 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO116 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO116 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO116 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO116 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO121 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO121 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO121 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO121 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO121 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO121 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO117 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO117 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO117 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO117 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO117 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO117 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO48 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO48 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO48 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO48 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO48 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO48 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO124 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO124 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO124 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO124 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO124 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO124 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO115 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO115 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO115 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO115 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO115 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO115 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO123 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO123 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO123 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO123 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO123 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO123 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO118 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO118 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO118 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO118 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO118 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO118 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO113 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO113 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO113 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO113 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO113 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO113 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO111 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO111 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO111 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO111 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO111 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO111 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO38 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO38 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO38 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO38 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO38 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO38 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO50 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO50 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO50 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO50 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO50 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO50 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO40 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO40 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO40 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO40 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO40 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO40 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO53 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO53 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO53 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO53 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO53 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO53 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO54 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO54 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO54 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO54 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO54 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO54 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO56 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO56 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO56 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO56 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO56 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO56 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO41 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO41 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO41 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO41 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO41 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO41 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO45 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO45 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO45 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO45 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO45 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO45 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO129 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO129 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO129 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO129 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO129 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO129 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO127 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO127 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO127 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO127 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO127 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO127 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO29 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO29 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO29 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO29 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO29 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO29 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO30 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO30 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO30 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO30 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO30 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO30 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO134 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO134 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO134 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO134 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO134 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO134 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO58 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO58 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO58 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO58 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO58 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO58 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO59 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO59 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO59 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO59 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO59 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO59 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO65 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO65 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO65 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO65 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO65 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO65 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO61 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO61 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO61 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO61 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO61 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO61 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO79 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO79 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO79 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO79 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO79 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO79 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO76 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO76 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO76 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO76 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO76 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO76 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO68 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO68 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO68 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO68 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO68 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO68 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO85 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO85 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO85 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO85 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO85 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO85 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO69 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO69 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO69 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO69 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO69 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO69 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO77 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO77 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO77 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO77 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO77 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO77 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO83 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO83 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO83 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO83 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO83 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO83 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO81 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO81 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO81 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO81 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO81 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO81 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO84 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO84 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO84 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO84 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO84 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO84 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO46 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO46 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO46 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO46 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO46 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO46 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO88 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO88 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO88 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO88 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO88 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO88 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO43 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO43 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO43 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO43 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO43 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO43 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO9 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO9 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO9 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO9 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO9 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO9 = 1;
-
-    EDIS;
-
+    GpioInitTable(gpioGroupABCDPins, GPIO_NUMBER_OF_GROUP_ABCD_PINS);
 }
 
-//=== Function: GpioInit_GroupEFGH ==========================================================================
+//=== Function: GpioInit_GroupEFGH ==============================================================
 ///
-/// @brief  Function initialises all GPIOs in GroupE to GroupH as outputs
+/// @brief  Function initialises all GPIOs in GroupE to GroupH as outputs.
+///         The pins are listed in gpioGroupEFGHPins[]
 ///
 /// @param  void
 ///
 /// @return void
 ///
-//===========================================================================================================
+//=================================================================================================
 void GpioInit_GroupEFGH(void)
 {
-    EALLOW;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO32 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO32 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO32 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO32 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO32 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO32 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO37 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO37 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO37 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO37 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO37 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO37 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO120 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO120 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO120 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO120 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO120 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO120 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO119 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO119 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO119 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO119 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO119 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO119 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO122 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO122 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO122 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO122 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO122 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO122 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO114 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO114 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO114 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO114 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO114 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO114 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO112 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO112 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO112 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO112 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO112 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO112 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO107 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO107 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO107 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO107 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO107 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO107 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO31 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO31 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO31 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO31 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO31 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO31 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO36 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO36 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO36 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO36 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO36 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO36 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO39 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO39 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO39 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO39 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO39 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO39 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO49 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO49 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO49 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO49 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO49 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO49 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO51 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO51 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO51 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO51 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO51 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO51 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO52 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO52 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO52 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO52 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO52 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO52 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO55 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO55 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO55 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO55 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO55 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO55 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO57 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO57 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO57 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO57 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO57 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO57 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO44 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO44 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO44 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO44 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO44 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO44 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO130 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO130 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO130 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO130 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO130 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO130 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO128 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO128 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO128 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO128 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO128 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO128 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO126 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO126 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO126 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO126 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO126 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO126 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO125 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX2.bit.GPIO125 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX2.bit.GPIO125 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO125 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO125 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO125 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO131 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO131 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO131 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO131 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO131 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO131 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO132 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO132 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO132 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO132 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO132 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO132 = 1;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO136 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO136 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO136 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO136 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO136 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPESET.bit.GPIO136 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO60 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO60 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO60 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO60 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO60 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO60 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO64 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO64 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO64 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO64 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO64 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO64 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO66 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO66 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO66 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO66 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO66 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO66 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO63 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO63 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO63 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO63 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO63 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO63 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO62 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO62 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX2.bit.GPIO62 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO62 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO62 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO62 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO78 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO78 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO78 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO78 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO78 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO78 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO72 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO72 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO72 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO72 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO72 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO72 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO71 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX1.bit.GPIO71 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX1.bit.GPIO71 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO71 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO71 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO71 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO87 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO87 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO87 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO87 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO87 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO87 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO86 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO86 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO86 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO86 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO86 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO86 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO80 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO80 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO80 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO80 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO80 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO80 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO82 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO82 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO82 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO82 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO82 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO82 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO90 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO90 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO90 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO90 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO90 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO90 = 1;
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO89 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO89 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO89 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO89 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO89 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPCSET.bit.GPIO89 = 1;
-
-    GpioCtrlRegs.GPBLOCK.bit.GPIO42 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPBGMUX1.bit.GPIO42 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPBMUX1.bit.GPIO42 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPBPUD.bit.GPIO42 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPBDIR.bit.GPIO42 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPBSET.bit.GPIO42 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO8 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO8 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO8 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO8 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO8 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO8 = 1;
-
-    EDIS;
-
+    GpioInitTable(gpioGroupEFGHPins, GPIO_NUMBER_OF_GROUP_EFGH_PINS);
 }
 
-//=== Function: GpioInit_Hardware_Error_Detection ==========================================================================
+//=== Function: GpioInit_Hardware_Error_Detection ===============================================
 ///
-/// @brief  Function configures all GPIOs related to LCB's Hardware error detection
+/// @brief  Function configures all GPIOs related to LCB's Hardware error detection.
+///         The pins are listed in gpioHardwareErrorPins[]
 ///
 /// @param  void
 ///
 /// @return void
 ///
-//==========================================================================================================================
+//=================================================================================================
 void GpioInit_Hardware_Error_Detection(void)
 {
-    EALLOW;
-
-    //reset GPIOs
-    GpioCtrlRegs.GPDLOCK.bit.GPIO98 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO98 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO98 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO98 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO98 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO98 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO10 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO10 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO10 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO10 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO10 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO10 = 1;
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO11 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO11 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO11 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO11 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO11 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPASET.bit.GPIO11 = 1;
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO97 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO97 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO97 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO97 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO97 = GPIO_OUTPUT;             // Set as output
-    GpioDataRegs.GPDSET.bit.GPIO97 = 1;
-
-    //Q & Q-bar
-    GpioCtrlRegs.GPDLOCK.bit.GPIO96 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO96 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO96 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO96 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO96 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO99 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO99 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO99 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO99 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO99 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPCLOCK.bit.GPIO95 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO95 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPCMUX2.bit.GPIO95 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPCPUD.bit.GPIO95 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPCDIR.bit.GPIO95 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO15 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO15 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO15 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO15 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO15 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO14 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX1.bit.GPIO14 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX1.bit.GPIO14 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO14 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO14 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPDLOCK.bit.GPIO104 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPDGMUX1.bit.GPIO104 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPDMUX1.bit.GPIO104 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPDPUD.bit.GPIO104 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPDDIR.bit.GPIO104 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO21 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO21 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO21 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO21 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO21 = GPIO_INPUT;             // Set as output
-
-    GpioCtrlRegs.GPALOCK.bit.GPIO20 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO20 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPAMUX2.bit.GPIO20 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPAPUD.bit.GPIO20 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPADIR.bit.GPIO20 = GPIO_INPUT;             // Set as output
-
-    EDIS;
-
+    GpioInitTable(gpioHardwareErrorPins, GPIO_NUMBER_OF_HARDWARE_ERROR_PINS);
 }
 
-//=== Function: GpioInit_PWM_LEDs ==========================================================================
+//=== Function: GpioInit_PWM_LEDs ===============================================================
 ///
-/// @brief  Function configures all GPIOs related to PWM_LEDs section
+/// @brief  Function configures all GPIOs related to PWM_LEDs section.
+///         The pins are listed in gpioPwmLedPins[]
 ///
 /// @param  void
 ///
 /// @return void
 ///
-//==========================================================================================================================
+//=================================================================================================
 void GpioInit_PWM_LEDs(void)
 {
-
-    EALLOW;
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO137 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO137 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO137 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO137 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO137 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO138 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO138 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO138 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO138 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO138 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO139 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO139 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO139 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO139 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO139 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO140 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO140 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO140 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO140 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO140 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO141 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO141 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO141 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO141 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO141 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO142 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO142 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO142 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO142 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO142 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO143 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX1.bit.GPIO143 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO143 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO143 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO143 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO144 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO144 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO144 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO144 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO144 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO145 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO145 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO145 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO145 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO145 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO146 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO146 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO146 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO146 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO146 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO147 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO147 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO147 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO147 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO147 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO148 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO148 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO148 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO148 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO148 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO149 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO149 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO149 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO149 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO149 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO150 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO150 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO150 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO150 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO150 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO151 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO151 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO151 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO151 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO151 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO152 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO152 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO152 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO152 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO152 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO153 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO153 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO153 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO153 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO153 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO154 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO154 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO154 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO154 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO154 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO155 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO155 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO155 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO155 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO155 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO156 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO156 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO156 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO156 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO156 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO157 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO157 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO157 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO157 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO157 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO158 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO158 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO158 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO158 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO158 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPELOCK.bit.GPIO159 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEMUX2.bit.GPIO159 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO159 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO159 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPEDIR.bit.GPIO159 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO160 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO160 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO160 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO160 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO160 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO161 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO161 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO161 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO161 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO161 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO162 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO162 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO162 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO162 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO162 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO163 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO163 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO163 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO163 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO163 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO164 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO164 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO164 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO164 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO164 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO165 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO165 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO165 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO165 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO165 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO166 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO166 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO166 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO166 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO166 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO167 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO167 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO167 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO167 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO167 = GPIO_OUTPUT;             // Set as output
-
-    GpioCtrlRegs.GPFLOCK.bit.GPIO168 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFMUX1.bit.GPIO168 = (GPIO_MULTIPLEX_GPIO >> 2);    // Set to GPIO functionality
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO168 = (GPIO_MULTIPLEX_GPIO & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO168 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    GpioCtrlRegs.GPFDIR.bit.GPIO168 = GPIO_OUTPUT;             // Set as output
-
-    EDIS;
-
+    GpioInitTable(gpioPwmLedPins, GPIO_NUMBER_OF_PWM_LED_PINS);
 }
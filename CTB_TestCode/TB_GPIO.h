@@ -39,24 +39,82 @@
 #define GPIO_CONTROLLED_BY_CPU2 							2
 #define GPIO_CONTROLLED_BY_CLA_CPU2						3
 #define GPIO_CONTROLLED_BY_CM									4
+// Number of GPIOs in Group-A to Group-H
+#define GPIO_NUMBER_OF_GROUP_A_TO_H_PINS			80
+// Size of the control registers of one GPIO port in words
+#define GPIO_PORT_REGS_SIZE										0x40
+// Number of GPIO ports (A to F) and highest GPIO
+#define GPIO_NUMBER_OF_PORTS						6
+#define GPIO_MAX_PIN								168
+// Offsets of the control registers of a port in 32 bit registers (from GPxCTRL)
+#define GPIO_REG_MUX1								0x03
+#define GPIO_REG_DIR								0x05
+#define GPIO_REG_PUD								0x06
+#define GPIO_REG_GMUX1								0x10
+#define GPIO_REG_LOCK								0x1E
+// Data registers of a port (DAT, SET, CLEAR, TOGGLE) in 32 bit registers
+#define GPIO_PORT_DATA_REGS							4
+#define GPIO_PORT_SET								1
+#define GPIO_PORT_CLEAR								2
+// Level of an output after GpioInitTable()
+#define GPIO_LEVEL_KEEP								0
+#define GPIO_LEVEL_LOW								1
+#define GPIO_LEVEL_HIGH								2
+// Pin counts of the pin tables
+#define GPIO_NUMBER_OF_ERROR_LED_PINS				29
+#define GPIO_NUMBER_OF_GROUP_ABCD_PINS				40
+#define GPIO_NUMBER_OF_GROUP_EFGH_PINS				40
+#define GPIO_NUMBER_OF_HARDWARE_ERROR_PINS			12
+#define GPIO_NUMBER_OF_PWM_LED_PINS					32
+// gpioConflictPin without conflict
+#define GPIO_NO_CONFLICT							0xFFFF
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Configuration of one pin in a pin table (GpioInitTable())
+typedef struct
+{
+    uint16_t pin;           // GPIO number
+    uint16_t mux;           // GPIO_MULTIPLEX_GPIO, GPIO_MULTIPLEX_EPWM, ...
+    uint16_t pullup;        // GPIO_ENABLE_PULLUP or GPIO_DISABLE_PULLUP
+    uint16_t direction;     // GPIO_INPUT or GPIO_OUTPUT
+    uint16_t level;         // GPIO_LEVEL_KEEP, GPIO_LEVEL_LOW or GPIO_LEVEL_HIGH
+} GpioPinConfig;
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-
+// GPIOs of the LEDs in Group-A to Group-H
+extern const uint16_t gpioGroupAtoHPins[GPIO_NUMBER_OF_GROUP_A_TO_H_PINS];
+// Pin tables of the GpioInit_* functions
+extern const GpioPinConfig gpioErrorLedPins[GPIO_NUMBER_OF_ERROR_LED_PINS];
+extern const GpioPinConfig gpioGroupABCDPins[GPIO_NUMBER_OF_GROUP_ABCD_PINS];
+extern const GpioPinConfig gpioGroupEFGHPins[GPIO_NUMBER_OF_GROUP_EFGH_PINS];
+extern const GpioPinConfig gpioHardwareErrorPins[GPIO_NUMBER_OF_HARDWARE_ERROR_PINS];
+extern const GpioPinConfig gpioPwmLedPins[GPIO_NUMBER_OF_PWM_LED_PINS];
+// First pin found twice in the pin tables (GPIO_NO_CONFLICT: none)
+extern uint16_t gpioConflictPin;
+// Pins configured by GpioInitTable() so far, one bit per GPIO
+extern uint32_t gpioConfiguredPins[GPIO_NUMBER_OF_PORTS];
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Function configures all pins of a pin table with one write per register and port
+extern bool GpioInitTable(const GpioPinConfig *table, uint16_t numberOfPins);
 // Funktion initialisiert GPIOs als Ein- bzw. Ausgnge
 extern void GpioInit_Error_LEDs(void);
 extern void GpioInit_GroupABCD(void);
 extern void GpioInit_GroupEFGH(void);
 extern void GpioInit_PWM_LEDs(void);
 extern void GpioInit_Hardware_Error_Detection(void);
+// Function selects the core which controls the GPIOs in Group-A to Group-H
+extern void GpioSetCore_GroupAtoH(uint16_t core);
+// Function assigns a peripheral function (GPxGMUX/GPxMUX) to one GPIO
+extern void GpioSetPeripheral(uint16_t pin, uint16_t mux, uint16_t pullup);
 
 
 #endif
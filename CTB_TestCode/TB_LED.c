@@ -0,0 +1,407 @@
+//=================================================================================================
+/// @file     TB_LED.c
+///
+/// @brief    File contains a bitmask based driver for the LEDs of the CTB (Error_LEDs, PWM_LEDs and
+///           the LEDs of Group-A to Group-H). A const pin map assigns the GPIOs to every LED,
+///           LedInit() precomputes the 32 bit port masks of every LED. A pattern (bit n = LED n)
+///           is written with the SET/CLEAR/TOGGLE registers of the ports, which switches all LEDs
+///           of the pattern at the same time with at most one word write per port and register.
+///           The file is linked into the CPU2 project as well (GPIO LED check on CPU2)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_LED.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Functions called by the sequencer ISR run from LSx RAM without flash wait states
+// (see TB_Sequencer.c)
+#pragma CODE_SECTION(LedWriteMasks, ".TI.ramfunc");
+#pragma CODE_SECTION(LedGetMasks, ".TI.ramfunc");
+#pragma CODE_SECTION(LedOn, ".TI.ramfunc");
+#pragma CODE_SECTION(LedOff, ".TI.ramfunc");
+#pragma CODE_SECTION(LedToggle, ".TI.ramfunc");
+#pragma CODE_SECTION(LedSetPattern, ".TI.ramfunc");
+#pragma CODE_SECTION(LedLoopbackRead, ".TI.ramfunc");
+#pragma CODE_SECTION(LedLoopbackCompare, ".TI.ramfunc");
+#pragma CODE_SECTION(LedLoopbackCheck, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Pin maps, order of the LEDs as numbered by Error_LEDs_On(), PWM_LEDs_On() and GPIOLEDs_On()
+const uint16_t ledErrorPins[LED_NUMBER_OF_ERROR_LEDS * LED_PINS_PER_ERROR_LED] =
+{
+     47,   // Error_LED 1
+     73,   // Error_LED 2
+     34,   // Error_LED 3
+     23,   // Error_LED 4
+     26,   // Error_LED 5
+     25,   // Error_LED 6
+    102,   // Error_LED 7
+    101,   // Error_LED 8
+     18,   // Error_LED 9
+     17,   // Error_LED 10
+     13,   // Error_LED 11
+      0,   // Error_LED 12
+      4,   // Error_LED 13
+    109,   // Error_LED 14
+    110,   // Error_LED 15
+    106,   // Error_LED 16
+    108,   // Error_LED 17
+    105,   // Error_LED 18
+     33,   // Error_LED 19
+     22,   // Error_LED 20
+     27,   // Error_LED 21
+     24,   // Error_LED 22
+    103,   // Error_LED 23
+    100,   // Error_LED 24
+     19,   // Error_LED 25
+     16,   // Error_LED 26
+     12,   // Error_LED 27
+      1,   // Error_LED 28
+     70    // Error_LED 29
+};
+
+const uint16_t ledPwmPins[LED_NUMBER_OF_PWM_LEDS * LED_PINS_PER_PWM_LED] =
+{
+    145, 153, 161, 137,   // PWM_LEDs 0
+    146, 154, 162, 138,   // PWM_LEDs 1
+    147, 155, 163, 139,   // PWM_LEDs 2
+    148, 156, 164, 140,   // PWM_LEDs 3
+    149, 157, 165, 141,   // PWM_LEDs 4
+    150, 158, 166, 142,   // PWM_LEDs 5
+    151, 159, 167, 143,   // PWM_LEDs 6
+    152, 160, 168, 144    // PWM_LEDs 7
+};
+
+const uint16_t ledGpioPins[LED_NUMBER_OF_GPIO_LEDS * LED_PINS_PER_GPIO_LED] =
+{
+    116,  38,  29,  85,  32,  39, 125,  72,   // row 0
+    121,  50,  30,  69,  37,  49, 131,  71,   // row 1
+    117,  40, 134,  77, 120,  51, 132,  87,   // row 2
+     83,  52,  48, 119,  53, 136,  58,  86,   // row 3
+     81,  55, 124, 122,  54,  60,  59,  80,   // row 4
+     84,  57, 115, 114,  56,  64,  65,  82,   // row 5
+     46,  44, 123, 112,  41,  66,  61,  90,   // row 6
+     88, 130, 118, 107,  45,  63,  79,  89,   // row 7
+     43, 128, 113,  31, 129,  62,  76,  42,   // row 8
+      9, 126, 111,  36, 127,  78,  68,   8    // row 9
+};
+
+// Port masks of every LED, computed by LedInit()
+LedPortMasks ledErrorMasks[LED_NUMBER_OF_ERROR_LEDS];
+LedPortMasks ledPwmMasks[LED_NUMBER_OF_PWM_LEDS];
+LedPortMasks ledGpioMasks[LED_NUMBER_OF_GPIO_LEDS];
+
+const LedGroup ledErrorGroup = {ledErrorPins, LED_NUMBER_OF_ERROR_LEDS, LED_PINS_PER_ERROR_LED, true,  ledErrorMasks};
+const LedGroup ledPwmGroup   = {ledPwmPins,   LED_NUMBER_OF_PWM_LEDS,   LED_PINS_PER_PWM_LED,   false, ledPwmMasks};
+const LedGroup ledGpioGroup  = {ledGpioPins,  LED_NUMBER_OF_GPIO_LEDS,  LED_PINS_PER_GPIO_LED,  true,  ledGpioMasks};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LedInitGroup ======================================================================
+///
+/// @brief  Function computes the port masks of all LEDs of one group from its pin map
+///
+/// @param  const LedGroup *group
+///
+/// @return void
+///
+//=================================================================================================
+static void LedInitGroup(const LedGroup *group)
+{
+    for (uint16_t n = 0; n < group->numberOfLeds; n++)
+    {
+        LedPortMasks *masks = &group->masks[n];
+
+        for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+            masks->port[p] = 0;
+
+        for (uint16_t k = 0; k < group->pinsPerLed; k++)
+        {
+            uint16_t pin = group->pins[n * group->pinsPerLed + k];
+
+            masks->port[pin / 32] |= 1UL << (pin % 32);
+        }
+    }
+}
+
+//=== Function: LedWriteMasks =====================================================================
+///
+/// @brief  Function writes the port masks into one data register (SET, CLEAR or TOGGLE) of the
+///         GPIO ports. Ports without a bit in the mask are not written
+///
+/// @param  const LedPortMasks *masks, uint16_t reg
+///
+/// @return void
+///
+//=================================================================================================
+static void LedWriteMasks(const LedPortMasks *masks, uint16_t reg)
+{
+    volatile uint32_t *data = &GpioDataRegs.GPADAT.all;
+
+    for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+    {
+        if (masks->port[p] != 0)
+            data[p * LED_PORT_DATA_REGS + reg] = masks->port[p];
+    }
+}
+
+//=== Function: LedLoopbackRead ===================================================================
+///
+/// @brief  Function waits LED_LOOPBACK_SETTLE_US and reads the level of the GPIOs in "masks"
+///         with one word read of GPxDAT per port
+///
+/// @param  const LedPortMasks *masks, LedPortMasks *level
+///
+/// @return void
+///
+//=================================================================================================
+static void LedLoopbackRead(const LedPortMasks *masks, LedPortMasks *level)
+{
+    volatile uint32_t *data = &GpioDataRegs.GPADAT.all;
+
+    DELAY_US(LED_LOOPBACK_SETTLE_US);
+    for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+        level->port[p] = data[p * LED_PORT_DATA_REGS] & masks->port[p];
+}
+
+//=== Function: LedLoopbackCompare ================================================================
+///
+/// @brief  Function compares the read level with the expected level and marks every differing
+///         GPIO which is not stuck as shorted
+///
+/// @param  const LedPortMasks *masks, const LedPortMasks *expected, const LedPortMasks *level,
+///         LedLoopbackResult *result
+///
+/// @return bool differing GPIO found
+///
+//=================================================================================================
+static bool LedLoopbackCompare(const LedPortMasks *masks, const LedPortMasks *expected,
+                               const LedPortMasks *level, LedLoopbackResult *result)
+{
+    uint32_t wrong = 0;
+
+    for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+    {
+        uint32_t diff = (level->port[p] ^ expected->port[p]) & masks->port[p]
+                        & ~(result->stuckHigh.port[p] | result->stuckLow.port[p]);
+
+        result->shorted.port[p] |= diff;
+        wrong |= diff;
+    }
+    return wrong != 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LedInit ===========================================================================
+///
+/// @brief  Function computes the port masks of all LEDs from the pin maps. Must be called before
+///         the LEDs are switched
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void LedInit(void)
+{
+    LedInitGroup(&ledErrorGroup);
+    LedInitGroup(&ledPwmGroup);
+    LedInitGroup(&ledGpioGroup);
+}
+
+//=== Function: LedGetMasks =======================================================================
+///
+/// @brief  Function computes the port masks of the LEDs in "pattern" (bit n = LED n)
+///
+/// @param  const LedGroup *group, uint32_t pattern, LedPortMasks *masks
+///
+/// @return void
+///
+//=================================================================================================
+void LedGetMasks(const LedGroup *group, uint32_t pattern, LedPortMasks *masks)
+{
+    for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+        masks->port[p] = 0;
+
+    for (uint16_t n = 0; n < group->numberOfLeds && pattern != 0; n++, pattern >>= 1)
+    {
+        if (pattern & 1)
+        {
+            for (uint16_t p = 0; p < LED_NUMBER_OF_PORTS; p++)
+                masks->port[p] |= group->masks[n].port[p];
+        }
+    }
+}
+
+//=== Function: LedOn =============================================================================
+///
+/// @brief  Function switches the LEDs in "pattern" on, all other LEDs of the group keep their state
+///
+/// @param  const LedGroup *group, uint32_t pattern
+///
+/// @return void
+///
+//=================================================================================================
+void LedOn(const LedGroup *group, uint32_t pattern)
+{
+    LedPortMasks masks;
+
+    LedGetMasks(group, pattern, &masks);
+    LedWriteMasks(&masks, group->activeLow ? LED_PORT_CLEAR : LED_PORT_SET);
+}
+
+//=== Function: LedOff ============================================================================
+///
+/// @brief  Function switches the LEDs in "pattern" off, all other LEDs of the group keep their state
+///
+/// @param  const LedGroup *group, uint32_t pattern
+///
+/// @return void
+///
+//=================================================================================================
+void LedOff(const LedGroup *group, uint32_t pattern)
+{
+    LedPortMasks masks;
+
+    LedGetMasks(group, pattern, &masks);
+    LedWriteMasks(&masks, group->activeLow ? LED_PORT_SET : LED_PORT_CLEAR);
+}
+
+//=== Function: LedToggle =========================================================================
+///
+/// @brief  Function toggles the LEDs in "pattern"
+///
+/// @param  const LedGroup *group, uint32_t pattern
+///
+/// @return void
+///
+//=================================================================================================
+void LedToggle(const LedGroup *group, uint32_t pattern)
+{
+    LedPortMasks masks;
+
+    LedGetMasks(group, pattern, &masks);
+    LedWriteMasks(&masks, LED_PORT_TOGGLE);
+}
+
+//=== Function: LedSetPattern =====================================================================
+///
+/// @brief  Function switches the LEDs in "pattern" on and all other LEDs of the group off
+///
+/// @param  const LedGroup *group, uint32_t pattern
+///
+/// @return void
+///
+//=================================================================================================
+void LedSetPattern(const LedGroup *group, uint32_t pattern)
+{
+    LedPortMasks on, off;
+
+    LedGetMasks(group, pattern, &on);
+    LedGetMasks(group, ~pattern & LED_ALL(group->numberOfLeds), &off);
+    if (group->activeLow)
+    {
+        LedWriteMasks(&on, LED_PORT_CLEAR);
+        LedWriteMasks(&off, LED_PORT_SET);
+    }
+    else
+    {
+        LedWriteMasks(&on, LED_PORT_SET);
+        LedWriteMasks(&off, LED_PORT_CLEAR);
+    }
+}
+
+//=== Function: LedLoopbackCheck ==================================================================
+///
+/// @brief  Function checks all GPIOs of the group in loopback: With all GPIOs low (high) every
+///         GPIO reading high (low) is stuck. Then a walking one (all other GPIOs low) and a
+///         walking zero (all other GPIOs high) is driven on every GPIO of the pin map with word
+///         writes of the SET/CLEAR registers and all ports are read back via GPxDAT. A GPIO
+///         which is not stuck and differs from the pattern is shorted, the driven GPIO is marked
+///         as well. Afterwards the GPIOs get their level from before the check (e.g. mux select
+///         lines). The GPIOs must be outputs of this CPU, 2 * pins + 2 reads of
+///         LED_LOOPBACK_SETTLE_US (ledGpioGroup: approx. 0.2 ms)
+///
+/// @param  const LedGroup *group, LedLoopbackResult *result
+///
+/// @return uint16_t number of faulty GPIOs (0: all GPIOs passed)
+///
+//=================================================================================================
+uint16_t LedLoopbackCheck(const LedGroup *group, LedLoopbackResult *result)
+{
+    LedPortMasks all, saved, level, expected, restore;
+    uint16_t numberOfPins = group->numberOfLeds * group->pinsPerLed;
+    uint16_t p;
+
+    LedGetMasks(group, LED_ALL(group->numberOfLeds), &all);
+    LedLoopbackRead(&all, &saved);
+
+    // Static patterns: all GPIOs low, all GPIOs high
+    LedWriteMasks(&all, LED_PORT_CLEAR);
+    LedLoopbackRead(&all, &result->stuckHigh);
+    LedWriteMasks(&all, LED_PORT_SET);
+    LedLoopbackRead(&all, &level);
+    for (p = 0; p < LED_NUMBER_OF_PORTS; p++)
+    {
+        result->stuckLow.port[p] = ~level.port[p] & all.port[p];
+        result->shorted.port[p] = 0;
+    }
+
+    for (uint16_t i = 0; i < numberOfPins; i++)
+    {
+        uint16_t pinPort = group->pins[i] / 32;
+        uint32_t pinMask = 1UL << (group->pins[i] % 32);
+        bool wrong;
+
+        // Walking one
+        for (p = 0; p < LED_NUMBER_OF_PORTS; p++)
+            expected.port[p] = 0;
+        expected.port[pinPort] = pinMask;
+        LedWriteMasks(&all, LED_PORT_CLEAR);
+        LedWriteMasks(&expected, LED_PORT_SET);
+        LedLoopbackRead(&all, &level);
+        wrong = LedLoopbackCompare(&all, &expected, &level, result);
+
+        // Walking zero
+        for (p = 0; p < LED_NUMBER_OF_PORTS; p++)
+            expected.port[p] = all.port[p];
+        expected.port[pinPort] &= ~pinMask;
+        LedWriteMasks(&all, LED_PORT_SET);
+        LedWriteMasks(&expected, LED_PORT_CLEAR);
+        LedLoopbackRead(&all, &level);
+        wrong |= LedLoopbackCompare(&all, &expected, &level, result);
+
+        if (wrong && ((result->stuckHigh.port[pinPort] | result->stuckLow.port[pinPort]) & pinMask) == 0)
+            result->shorted.port[pinPort] |= pinMask;
+    }
+
+    // Restore the level from before the check
+    for (p = 0; p < LED_NUMBER_OF_PORTS; p++)
+        restore.port[p] = all.port[p] & ~saved.port[p];
+    LedWriteMasks(&saved, LED_PORT_SET);
+    LedWriteMasks(&restore, LED_PORT_CLEAR);
+
+    result->numberOfErrors = 0;
+    for (p = 0; p < LED_NUMBER_OF_PORTS; p++)
+    {
+        uint32_t faulty = result->stuckHigh.port[p] | result->stuckLow.port[p] | result->shorted.port[p];
+
+        for (; faulty != 0; faulty &= faulty - 1)
+            result->numberOfErrors++;
+    }
+    return result->numberOfErrors;
+}
@@ -0,0 +1,103 @@
+//=================================================================================================
+/// @file     TB_LED.h
+///
+/// @brief    File contains a bitmask based driver for the LEDs of the CTB (Error_LEDs, PWM_LEDs and
+///           the LEDs of Group-A to Group-H). A const pin map assigns the GPIOs to every LED,
+///           LedInit() precomputes the 32 bit port masks of every LED. A pattern (bit n = LED n)
+///           is written with the SET/CLEAR/TOGGLE registers of the ports, which switches all LEDs
+///           of the pattern at the same time with at most one word write per port and register.
+///           LedLoopbackCheck() drives all GPIOs of a group with walking-ones/zeros patterns and
+///           reads them back via GPxDAT (stuck and shorted pins without an operator)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYLED_H_
+#define MYLED_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of GPIO ports with LEDs (A to F, GPIO0 to GPIO191)
+#define LED_NUMBER_OF_PORTS         6
+// Number of 32 bit data registers (DAT, SET, CLEAR, TOGGLE) of one GPIO port
+#define LED_PORT_DATA_REGS          4
+#define LED_PORT_SET                1
+#define LED_PORT_CLEAR              2
+#define LED_PORT_TOGGLE             3
+// Settling time of the GPIOs after a pattern write before they are read back in us
+#define LED_LOOPBACK_SETTLE_US      1
+// Number of LEDs and GPIOs per LED of the LED groups
+#define LED_NUMBER_OF_ERROR_LEDS    29
+#define LED_PINS_PER_ERROR_LED      1
+#define LED_NUMBER_OF_PWM_LEDS      8
+#define LED_PINS_PER_PWM_LED        4
+#define LED_NUMBER_OF_GPIO_LEDS     10
+#define LED_PINS_PER_GPIO_LED       8
+// Pattern with all LEDs of a group
+#define LED_ALL(numberOfLeds)       (((numberOfLeds) >= 32) ? 0xFFFFFFFFUL : ((1UL << (numberOfLeds)) - 1))
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// 32 bit masks of the GPIO ports A to F
+typedef struct
+{
+    uint32_t port[LED_NUMBER_OF_PORTS];
+} LedPortMasks;
+
+// Group of LEDs, LED n uses the GPIOs pins[n * pinsPerLed] to pins[(n + 1) * pinsPerLed - 1]
+typedef struct
+{
+    const uint16_t *pins;           // pin map
+    uint16_t numberOfLeds;          // max. 32
+    uint16_t pinsPerLed;
+    bool activeLow;                 // true: LED is on if the GPIO is low
+    LedPortMasks *masks;            // port masks of every LED, computed by LedInit()
+} LedGroup;
+
+// Result of LedLoopbackCheck(), bit set: GPIO of the port is faulty
+typedef struct
+{
+    LedPortMasks stuckHigh;         // reads high while all GPIOs of the group are low
+    LedPortMasks stuckLow;          // reads low while all GPIOs of the group are high
+    LedPortMasks shorted;           // follows another GPIO or does not follow its own pattern
+    uint16_t numberOfErrors;        // number of faulty GPIOs
+} LedLoopbackResult;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Error_LEDs 1 to 29 (LED n of the group is Error_LED n + 1)
+extern const LedGroup ledErrorGroup;
+// PWM_LEDs, eight groups of four LEDs
+extern const LedGroup ledPwmGroup;
+// LEDs of Group-A to Group-H, ten rows of eight LEDs
+extern const LedGroup ledGpioGroup;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function computes the port masks of all LEDs from the pin maps
+extern void LedInit(void);
+// Function computes the port masks of the LEDs in "pattern"
+extern void LedGetMasks(const LedGroup *group, uint32_t pattern, LedPortMasks *masks);
+// Function switches the LEDs in "pattern" on, all other LEDs of the group keep their state
+extern void LedOn(const LedGroup *group, uint32_t pattern);
+// Function switches the LEDs in "pattern" off, all other LEDs of the group keep their state
+extern void LedOff(const LedGroup *group, uint32_t pattern);
+// Function toggles the LEDs in "pattern"
+extern void LedToggle(const LedGroup *group, uint32_t pattern);
+// Function switches the LEDs in "pattern" on and all other LEDs of the group off
+extern void LedSetPattern(const LedGroup *group, uint32_t pattern);
+// Function checks all GPIOs of the group in loopback and returns the number of faulty GPIOs
+extern uint16_t LedLoopbackCheck(const LedGroup *group, LedLoopbackResult *result);
+
+#endif
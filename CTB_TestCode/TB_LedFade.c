@@ -0,0 +1,276 @@
+//=================================================================================================
+/// @file     TB_LedFade.c
+///
+/// @brief    File contains the fade engine of the PWM_LEDs (DMA CH5 writes a precomputed
+///           brightness curve into CMPA/CMPB of all ePWM modules), see TB_LedFade.h
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_LedFade.h"
+#include "TB_DAC.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Curve in GSx RAM (the DMA has no access to LSx RAM), computed by LedFadeBuild()
+#pragma DATA_SECTION(ledFadeTable, "ramgs9");
+uint32_t ledFadeTable[LED_FADE_MAX_STEPS][LED_FADE_WORDS_PER_STEP];
+uint16_t ledFadeSteps = 0;
+uint16_t ledFadeDivider = 1;
+bool ledFadeRunning = false;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LedFadeLedOfPin ===================================================================
+///
+/// @brief  Function returns the PWM LED which is driven by the GPIO "pin" (see ledPwmPins)
+///
+/// @param  uint16_t pin
+///
+/// @return uint16_t led (LED_NUMBER_OF_PWM_LEDS: pin drives no PWM LED)
+///
+//=================================================================================================
+static uint16_t LedFadeLedOfPin(uint16_t pin)
+{
+    for (uint16_t i = 0; i < LED_NUMBER_OF_PWM_LEDS * LED_PINS_PER_PWM_LED; i++)
+    {
+        if (ledPwmPins[i] == pin)
+            return i / LED_PINS_PER_PWM_LED;
+    }
+    return LED_NUMBER_OF_PWM_LEDS;
+}
+
+//=== Function: LedFadeCompare ====================================================================
+///
+/// @brief  Function computes the compare value of step "phase" of a curve with numberOfSteps
+///         steps: the brightness rises linearly to the middle of the curve and falls back to 0,
+///         the compare value follows the square law of ADCtoPWM_Init() (gamma)
+///
+/// @param  uint16_t phase, uint16_t numberOfSteps, uint16_t period (TBPRD)
+///
+/// @return uint32_t compare (upper word, lower HRPWM word 0)
+///
+//=================================================================================================
+static uint32_t LedFadeCompare(uint16_t phase, uint16_t numberOfSteps, uint16_t period)
+{
+    float32 x = 2.0f * (float32)phase / (float32)numberOfSteps;
+
+    if (x > 1.0f)
+        x = 2.0f - x;
+
+    return (uint32_t)(uint16_t)((float32)period * x * x + 0.5f) << 16;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LedFadeBuild ======================================================================
+///
+/// @brief  Function computes numberOfSteps steps of the brightness curve of all ePWM outputs
+///         into ledFadeTable. The entries follow pwmConfigTable (ePWM1 to ePWM16), the compare
+///         values are scaled to the actual TBPRD of every module, so PwmInitFromTable() must
+///         be called before. With LED_FADE_PATTERN_CHASE the outputs of a PWM LED are delayed
+///         by LED / LED_NUMBER_OF_PWM_LEDS of the curve. Must not be called while the engine runs
+///
+/// @param  uint16_t pattern (LED_FADE_PATTERN_x), uint16_t numberOfSteps (2 .. LED_FADE_MAX_STEPS)
+///
+/// @return bool built (false: invalid pattern or number of steps, or engine running)
+///
+//=================================================================================================
+bool LedFadeBuild(uint16_t pattern, uint16_t numberOfSteps)
+{
+    if (ledFadeRunning || numberOfSteps < 2 || numberOfSteps > LED_FADE_MAX_STEPS
+        || (pattern != LED_FADE_PATTERN_BREATHE && pattern != LED_FADE_PATTERN_CHASE))
+        return false;
+
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        const PwmConfig *config = &pwmConfigTable[m];
+        uint16_t period = config->regs->TBPRD;
+        uint16_t delayA = 0;
+        uint16_t delayB = 0;
+
+        if (pattern == LED_FADE_PATTERN_CHASE)
+        {
+            // An output without PWM LED gets the delay of a full curve (no delay)
+            delayA = LedFadeLedOfPin(config->pinA) * numberOfSteps / LED_NUMBER_OF_PWM_LEDS % numberOfSteps;
+            delayB = LedFadeLedOfPin(config->pinB) * numberOfSteps / LED_NUMBER_OF_PWM_LEDS % numberOfSteps;
+        }
+
+        // Step s of an output delayed by d shows step s - d of the curve
+        for (uint16_t s = 0; s < numberOfSteps; s++)
+        {
+            ledFadeTable[s][m] =
+                LedFadeCompare((s + numberOfSteps - delayA) % numberOfSteps, numberOfSteps, period);
+            ledFadeTable[s][PWM_NUMBER_OF_MODULES + m] =
+                LedFadeCompare((s + numberOfSteps - delayB) % numberOfSteps, numberOfSteps, period);
+        }
+    }
+
+    ledFadeSteps = numberOfSteps;
+    return true;
+}
+
+//=== Function: LedFadeStart ======================================================================
+///
+/// @brief  Function starts the output of the curve of LedFadeBuild(). ePWM2 generates a SOCB at
+///         counter = 0 and counter = period (every "divider"-th event), each SOCB lets DMA CH5
+///         write one burst: CMPA of ePWM1 to ePWM16 (destination step = distance of two ePWM
+///         modules), then CMPB of all modules. All modules load their shadow registers at every
+///         counter = 0 while the engine runs (GLDCTL.OSHTMODE), the CPU is not involved until
+///         LedFadeStop(). PwmInitFromTable() (or PwmInitAll()) and LedFadeBuild() must be
+///         called before
+///
+/// @param  uint16_t divider (1 .. LED_FADE_MAX_DIVIDER, ePWM2 periods per step),
+///         bool continuous (true: start again with the first step, false: stop at the last step)
+///
+/// @return bool started (false: no curve, invalid divider or DMA CH5 used by the DAC waveform)
+///
+//=================================================================================================
+bool LedFadeStart(uint16_t divider, bool continuous)
+{
+    volatile struct CH_REGS *channel = &DmaRegs.CH5;
+    // The ePWM modules are 0x100 words apart, the registers of the DMA are 16 bit offsets
+    int16_t moduleStep = (int16_t)((uint32_t)&EPwm2Regs - (uint32_t)&EPwm1Regs);
+
+    if (ledFadeSteps == 0 || divider == 0 || divider > LED_FADE_MAX_DIVIDER || dacWaveRunning)
+        return false;
+
+    LedFadeStop();
+
+    EALLOW;
+
+    ClockRequest(CLOCK_DMA);    // Returned by LedFadeStop()
+    DmaRegs.DEBUGCTRL.bit.FREE = 1;
+    // DMA instead of the CLA as secondary master of peripheral frame 1 (ePWM)
+    CpuSysRegs.SECMSEL.bit.PF1SEL = 1;
+
+    // Load the compares written by the DMA at every counter = 0
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+        pwmConfigTable[m].regs->GLDCTL.bit.OSHTMODE = PWM_GLD_CONTINUOUS;
+
+    channel->CONTROL.bit.SOFTRESET = 1;
+    __asm(" NOP");
+
+    // Source: curve, destination: CMPA of ePWM1 (32 bit, CMPA:CMPAHR)
+    channel->SRC_BEG_ADDR_SHADOW = (uint32_t)&ledFadeTable[0][0];
+    channel->SRC_ADDR_SHADOW = (uint32_t)&ledFadeTable[0][0];
+    channel->DST_BEG_ADDR_SHADOW = (uint32_t)&EPwm1Regs.CMPA;
+    channel->DST_ADDR_SHADOW = (uint32_t)&EPwm1Regs.CMPA;
+
+    // Sizes and steps in 16 bit words: one burst = one 32 bit register of every module
+    channel->BURST_SIZE.bit.BURSTSIZE = 2 * PWM_NUMBER_OF_MODULES - 1;
+    channel->SRC_BURST_STEP = 2;
+    channel->DST_BURST_STEP = moduleStep;
+    channel->TRANSFER_SIZE = 2 * ledFadeSteps - 1;
+    channel->SRC_TRANSFER_STEP = 2;   // Next half of the step or first half of the next step
+    // From CMPA of ePWM16 to CMPB of ePWM1, after the CMPB burst the wrap returns to CMPA
+    channel->DST_TRANSFER_STEP = (int16_t)((uint32_t)&EPwm1Regs.CMPB
+                                           - ((uint32_t)&EPwm1Regs.CMPA + (PWM_NUMBER_OF_MODULES - 1) * moduleStep));
+    channel->SRC_WRAP_SIZE = DMA_WRAP_DISABLE;
+    channel->SRC_WRAP_STEP = 0;
+    channel->DST_WRAP_SIZE = 1;   // Two bursts
+    channel->DST_WRAP_STEP = 0;
+
+    DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5 = LED_FADE_DMA_TRIGGER;
+    channel->MODE.bit.PERINTSEL = 5;
+    channel->MODE.bit.PERINTE = 1;
+    channel->MODE.bit.OVRINTE = 0;
+    channel->MODE.bit.ONESHOT = 0;
+    channel->MODE.bit.CONTINUOUS = continuous ? 1 : 0;
+    channel->MODE.bit.DATASIZE = DMA_DATA_SIZE_32_BIT;
+    channel->MODE.bit.CHINTE = 0;
+    channel->CONTROL.bit.PERINTCLR = 1;
+    channel->CONTROL.bit.ERRCLR = 1;
+
+    channel->CONTROL.bit.RUN = 1;
+
+    // SOCB of ePWM2 at counter = 0 and counter = period on every "divider"-th event. The 4 bit
+    // prescaler of ETSOCPS also replaces the prescaler of SOCA, which keeps its value
+    EPwm2Regs.ETSOCPS.bit.SOCAPRD2 = EPwm2Regs.ETPS.bit.SOCAPRD;
+    EPwm2Regs.ETSOCPS.bit.SOCBPRD2 = divider;
+    EPwm2Regs.ETPS.bit.SOCPSSEL = 1;
+    EPwm2Regs.ETSEL.bit.SOCBSEL = PWM_ET_CTR_PRDZERO;
+    EPwm2Regs.ETCLR.bit.SOCB = 1;
+    EPwm2Regs.ETSEL.bit.SOCBEN = 1;
+
+    EDIS;
+
+    ledFadeDivider = divider;
+    ledFadeRunning = true;
+    return true;
+}
+
+//=== Function: LedFadeStop =======================================================================
+///
+/// @brief  Function stops the fade engine. The modules keep the last written step and load new
+///         compares again only with PwmDutyCommit(), the CLA is the secondary master of
+///         peripheral frame 1 again
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void LedFadeStop(void)
+{
+    if (!ledFadeRunning)
+        return;
+
+    EALLOW;
+    EPwm2Regs.ETSEL.bit.SOCBEN = 0;
+    DmaRegs.CH5.CONTROL.bit.HALT = 1;
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+        pwmConfigTable[m].regs->GLDCTL.bit.OSHTMODE = PWM_GLD_ONE_SHOT;
+    CpuSysRegs.SECMSEL.bit.PF1SEL = 0;
+    ClockRelease(CLOCK_DMA);
+    EDIS;
+
+    ledFadeRunning = false;
+}
+
+//=== Function: LedFadeDurationUs =================================================================
+///
+/// @brief  Function returns the time of one pass through the curve: one step per "divider"
+///         periods of ePWM2 (two SOCB events per period, one burst per event)
+///
+/// @param  void
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t LedFadeDurationUs(void)
+{
+    return (uint32_t)((float32)ledFadeSteps * (float32)ledFadeDivider * PwmGetPeriodUs(&EPwm2Regs));
+}
+
+//=== Function: LedFadeStartCheck =================================================================
+///
+/// @brief  Function starts the fade mode of the PWM LED check (PWM_LED_CHECK_FADE): the ePWM
+///         outputs take over the PWM LED pins (PwmInitFromTable(), usually done later by
+///         PwmInitAll()), the curve LED_FADE_CHECK_PATTERN is computed and runs continuously.
+///         The caller stops the engine with LedFadeStop() after the returned time
+///
+/// @param  uint16_t repetitions (passes through the curve)
+///
+/// @return uint32_t timeUs (0: the engine could not be started)
+///
+//=================================================================================================
+uint32_t LedFadeStartCheck(uint16_t repetitions)
+{
+    PwmInitFromTable(pwmConfigTable, PWM_NUMBER_OF_MODULES);
+
+    if (!LedFadeBuild(LED_FADE_CHECK_PATTERN, LED_FADE_CHECK_STEPS)
+        || !LedFadeStart(LED_FADE_CHECK_DIVIDER, true))
+        return 0;
+
+    return (uint32_t)repetitions * LedFadeDurationUs();
+}
@@ -0,0 +1,83 @@
+//=================================================================================================
+/// @file     TB_LedFade.h
+///
+/// @brief    File contains a fade engine for the PWM_LEDs which runs without the CPU. A brightness
+///           curve of every ePWM output is precomputed into ledFadeTable (LedFadeBuild()),
+///           DMA CH5 writes one step of it into CMPA and CMPB of all 16 ePWM modules per period
+///           of ePWM2 (LedFadeStart()). Per SOCB event of ePWM2 (counter = 0 and counter = period)
+///           the DMA writes one burst of 16 32 bit words: the CMPA register (CMPA:CMPAHR) of
+///           ePWM1 to ePWM16, at the next event CMPB of all modules. The destination wraps back
+///           to CMPA of ePWM1 after every second burst. While the engine runs the modules load
+///           CMPA/CMPB at every counter = 0 (continuous global load), CMPB follows CMPA one period
+///           later.
+///           DMA CH5 is also used by the DAC waveform generator (TB_DAC), only one of both can
+///           run. The DMA becomes the secondary master of peripheral frame 1 (ePWM) while the
+///           engine runs, so the CLA of the ADCIN check (ClaAdcInit()) must not run at the same
+///           time. PwmDutyStage()/PwmDutyCommit() and ADCtoPWM() must not be used while the
+///           engine runs. DmaInitAdcCapture() resets the DMA, LedFadeStop() must be called before
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYLEDFADE_H_
+#define MYLEDFADE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Clock.h"
+#include "TB_DMA.h"
+#include "TB_PWM.h"
+#include "TB_LED.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Maximum number of steps of a curve (64 steps * 32 outputs * 32 bit = RAMGS9)
+#define LED_FADE_MAX_STEPS          64
+// 32 bit compare registers per step: CMPA of ePWM1 to ePWM16, then CMPB of ePWM1 to ePWM16
+#define LED_FADE_WORDS_PER_STEP     (2 * PWM_NUMBER_OF_MODULES)
+// Maximum number of ePWM2 periods per step (4 bit prescaler ETSOCPS.SOCBPRD2)
+#define LED_FADE_MAX_DIVIDER        15
+// Trigger source of DMA CH5 (DMACHSRCSEL2.CH5)
+#define LED_FADE_DMA_TRIGGER        39      // EPWM2SOCB
+// Brightness curves of LedFadeBuild()
+// LED_FADE_PATTERN_BREATHE: all outputs fade in and out together (status indication)
+// LED_FADE_PATTERN_CHASE:   the fade of PWM LED n is delayed by n/8 of the curve (test animation)
+#define LED_FADE_PATTERN_BREATHE    0
+#define LED_FADE_PATTERN_CHASE      1
+// Curve of the PWM LED check (PWM_LED_CHECK_FADE, see TB_Functions.h), one step per period of
+// ePWM2 (about 9 ms)
+#define LED_FADE_CHECK_PATTERN      LED_FADE_PATTERN_CHASE
+#define LED_FADE_CHECK_STEPS        LED_FADE_MAX_STEPS
+#define LED_FADE_CHECK_DIVIDER      1
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Compare values of every step (upper word, the lower word is the HRPWM part), read by the DMA
+extern uint32_t ledFadeTable[LED_FADE_MAX_STEPS][LED_FADE_WORDS_PER_STEP];
+// Number of steps computed by LedFadeBuild() and ePWM2 periods per step of LedFadeStart()
+extern uint16_t ledFadeSteps;
+extern uint16_t ledFadeDivider;
+// DMA CH5 writes the compare registers
+extern bool ledFadeRunning;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function computes the brightness curve of all ePWM outputs (after PwmInitFromTable())
+extern bool LedFadeBuild(uint16_t pattern, uint16_t numberOfSteps);
+// Function starts the output of the curve by DMA CH5 at the period events of ePWM2
+extern bool LedFadeStart(uint16_t divider, bool continuous);
+// Function stops the fade engine, the compares keep the last step
+extern void LedFadeStop(void);
+// Function returns the time of one pass through the curve in us
+extern uint32_t LedFadeDurationUs(void);
+// Function initialises the ePWMs and starts the curve of the PWM LED check
+extern uint32_t LedFadeStartCheck(uint16_t repetitions);
+
+#endif
@@ -0,0 +1,128 @@
+//=================================================================================================
+/// @file     TB_Log.c
+///
+/// @brief    File contains the ring and the transmission of the deferred binary log. See
+///           TB_Log.h for the records
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Log.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the ISRs, runs from LSx RAM like them
+#pragma CODE_SECTION(LogWrite, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile uint16_t logDropped = 0;
+// Ring, "head" is moved by the writers (with blocked interrupts), "tail" by LogService() only.
+// Only records between "tail" and "head" are read, therefore not zeroed by the C startup
+#pragma DATA_SECTION(logRing, "noinitbuf");
+static LogRecord logRing[LOG_RING_SIZE];
+static volatile uint16_t logHead = 0;
+static volatile uint16_t logTail = 0;
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LogInit ===========================================================================
+///
+/// @brief  Function clears the ring and the number of dropped records
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void LogInit(void)
+{
+    logHead = 0;
+    logTail = 0;
+    logDropped = 0;
+}
+
+//=== Function: LogWrite ==========================================================================
+///
+/// @brief  Function pushes one record into the ring. The main loop and every ISR may write, the
+///         interrupts are blocked while the record is written (a few cycles). If the ring is
+///         full the record is dropped and counted in logDropped
+///
+/// @param  uint16_t id (LOG_ID_x), uint16_t numberOfArgs (0..LOG_MAX_ARGS), uint32_t arg0,
+///         uint32_t arg1
+///
+/// @return void
+///
+//=================================================================================================
+void LogWrite(uint16_t id, uint16_t numberOfArgs, uint32_t arg0, uint32_t arg1)
+{
+    uint16_t interruptState = __disable_interrupts();
+    uint16_t head = logHead;
+
+    if ((uint16_t)(head - logTail) >= LOG_RING_SIZE)
+    {
+        logDropped++;
+    }
+    else
+    {
+        LogRecord *record = &logRing[head & LOG_RING_MASK];
+
+        record->header = (id & LOG_ID_MASK) | (numberOfArgs << 12);
+        record->time = 0xFFFFFFFFUL - CpuTimer2Regs.TIM.all;
+        record->args[0] = arg0;
+        record->args[1] = arg1;
+        logHead = head + 1;
+    }
+
+    __restore_interrupts(interruptState);
+}
+
+//=== Function: LogService ========================================================================
+///
+/// @brief  Function sends the oldest records of the ring as long as a complete record fits
+///         into the transmit FIFO, it never waits for the UART. Called in the main loop
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void LogService(void)
+{
+    while (logTail != logHead)
+    {
+        const LogRecord *record = &logRing[logTail & LOG_RING_MASK];
+        uint16_t numberOfArgs = record->header >> 12;
+        uint16_t frame[LOG_RECORD_BYTES(LOG_MAX_ARGS)];
+        uint16_t length = 0;
+        uint16_t checksum = 0;
+
+        if (UartTxFree() < LOG_RECORD_BYTES(numberOfArgs))
+            return;
+
+        frame[length++] = LOG_SYNC;
+        frame[length++] = record->header & 0x00FF;
+        frame[length++] = record->header >> 8;
+        for (uint16_t i = 0; i < 4; i++)
+            frame[length++] = (uint16_t)(record->time >> (8 * i)) & 0x00FF;
+        for (uint16_t j = 0; j < numberOfArgs; j++)
+            for (uint16_t i = 0; i < 4; i++)
+                frame[length++] = (uint16_t)(record->args[j] >> (8 * i)) & 0x00FF;
+        for (uint16_t i = 1; i < length; i++)
+            checksum += frame[i];
+        frame[length++] = checksum & 0x00FF;
+
+        UartWriteBytes(frame, length);
+        logTail++;
+    }
+}
@@ -0,0 +1,91 @@
+//=================================================================================================
+/// @file     TB_Log.h
+///
+/// @brief    File contains a deferred binary log instead of printf(). LOG0() to LOG2() only push
+///           the id of a message and its raw arguments with a time stamp into a ring (a few
+///           cycles, also from an ISR), LogService() in the main loop sends the records over the
+///           UART of TB_UART when the transmit FIFO has room and never waits. The host keeps the
+///           format strings of the ids (see the LOG_ID_x defines) and formats the messages, so
+///           the log can stay in the performance build without stalling the CPU like the CIO
+///           of printf().
+///
+///           Record (bytes, little endian):
+///             LOG_SYNC, header (16 bit: id in bits 11..0, number of arguments in bits 15..12),
+///             time (32 bit, DeviceGetTime()), n * argument (32 bit), checksum
+///             checksum: lower 8 bits of the sum of all bytes after LOG_SYNC
+///           A record is only written if it fits into the transmit FIFO completely, so it is
+///           never split by the text of the report. The host separates the records from the
+///           other data of the UART by LOG_SYNC and the checksum
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYLOG_H_
+#define MYLOG_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: LOGx() writes records, 0: LOGx() is removed by the preprocessor
+#define LOG_ENABLE                  1
+// Records of the ring (power of two)
+#define LOG_RING_SIZE               32
+#define LOG_RING_MASK               (LOG_RING_SIZE - 1)
+// Arguments per record, a record with LOG_MAX_ARGS arguments fills the transmit FIFO (16 bytes)
+#define LOG_MAX_ARGS                2
+#define LOG_SYNC                    0xA7
+#define LOG_RECORD_BYTES(n)         (8 + 4 * (n))
+#define LOG_ID_MASK                 0x0FFF
+// Message ids and their format strings on the host
+#define LOG_ID_BOOT                 1       // "boot done after %lu us"
+#define LOG_ID_ANALOG_INIT          2       // "analog init done after %lu us"
+#define LOG_ID_REPORT_SENT          3       // "report sent, %lu failed phases"
+#define LOG_ID_PLAN_REJECTED        4       // "test plan rejected (%lu so far)"
+#define LOG_ID_PARAM_SAVED          5       // "parameter %lu saved, value %f" (float32 bits)
+
+// Push a message with 0, 1 or 2 arguments into the ring
+#if LOG_ENABLE
+#define LOG0(id)                    LogWrite((id), 0, 0, 0)
+#define LOG1(id, a)                 LogWrite((id), 1, (uint32_t)(a), 0)
+#define LOG2(id, a, b)              LogWrite((id), 2, (uint32_t)(a), (uint32_t)(b))
+#else
+#define LOG0(id)                    ((void)0)
+#define LOG1(id, a)                 ((void)0)
+#define LOG2(id, a, b)              ((void)0)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// One record of the ring
+typedef struct
+{
+    uint16_t header;                // id and number of arguments
+    uint32_t time;
+    uint32_t args[LOG_MAX_ARGS];
+} LogRecord;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Records which were dropped because the ring was full
+extern volatile uint16_t logDropped;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function clears the ring
+extern void LogInit(void);
+// Function pushes one record into the ring (use LOG0() to LOG2())
+extern void LogWrite(uint16_t id, uint16_t numberOfArgs, uint32_t arg0, uint32_t arg1);
+// Function sends the records of the ring which fit into the transmit FIFO (main loop)
+extern void LogService(void);
+
+#endif
@@ -0,0 +1,326 @@
+//=================================================================================================
+/// @file     TB_Modulator.c
+///
+/// @brief    File contains the three-phase SVPWM/DPWM modulator. See TB_Modulator.h for the
+///           variants and the normalisation of the voltages
+///
+/// @version  V1.1.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Modulator.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the control ISR together with PwmDutyStage(), runs from LSx RAM like it
+#pragma CODE_SECTION(ModRun, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Modulator check: MOD_CHECK_OFF or MOD_MODE_x + 1 (hexagon overmodulation), magnitude of the
+// reference (MOD_LINEAR_LIMIT = linear limit) and the modulator of ePWM2 to ePWM4
+uint16_t modCheckRequest = MOD_CHECK_OFF;
+float32 modCheckMagnitude = 0.5f;
+Modulator modCheck;
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Running variant, angle of the reference and time of the last ModCheckService() call
+static uint16_t modCheckActive = MOD_CHECK_OFF;
+static float32 modCheckAngle;
+static uint32_t modCheckLastTime;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ModInverseClarke ==================================================================
+///
+/// @brief  Function computes the three phase voltages of an alpha/beta vector
+///
+/// @param  float32 alpha, float32 beta, float32 *v (MOD_NUMBER_OF_PHASES values)
+///
+/// @return void
+///
+//=================================================================================================
+static void ModInverseClarke(float32 alpha, float32 beta, float32 *v)
+{
+    v[0] = alpha;
+    v[1] = -0.5f * alpha + MOD_SQRT3_2 * beta;
+    v[2] = -0.5f * alpha - MOD_SQRT3_2 * beta;
+}
+
+//=== Function: ModClampShifted ===================================================================
+///
+/// @brief  Function returns the zero-sequence voltage which clamps the leg with the largest
+///         voltage magnitude of the reference rotated by +-30 deg (DPWM0, DPWM2). The leg is
+///         clamped to the rail of the sign of its rotated voltage. Within the linear range the
+///         clamped leg is always the largest (or smallest) phase voltage of the unrotated
+///         reference, so no other leg leaves 0..1
+///
+/// @param  const float32 *v, float32 alpha, float32 beta, float32 sinShift
+///
+/// @return float32 zeroSequence
+///
+//=================================================================================================
+static float32 ModClampShifted(const float32 *v, float32 alpha, float32 beta, float32 sinShift)
+{
+    float32 shifted[MOD_NUMBER_OF_PHASES];
+    uint16_t clamped = 0;
+
+    ModInverseClarke(alpha * MOD_COS_30 - beta * sinShift,
+                     alpha * sinShift + beta * MOD_COS_30, shifted);
+    for (uint16_t i = 1; i < MOD_NUMBER_OF_PHASES; i++)
+    {
+        if (fabsf(shifted[i]) > fabsf(shifted[clamped]))
+            clamped = i;
+    }
+
+    return (shifted[clamped] >= 0.0f) ? 0.5f - v[clamped] : -0.5f - v[clamped];
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ModInit ===========================================================================
+///
+/// @brief  Function assigns three ePWM modules to a modulator, e.g. modules initialised by
+///         PwmInitFromTable() and PwmInitLeg(). The modules have to count up-down with the
+///         output A high from TBCTR = 0 to CMPA (aqZero = PWM_AQ_SET, aqCompareUp =
+///         PWM_AQ_CLEAR as in pwmConfigTable), so the duty cycle of the high side is
+///         CMPA / TBPRD. Modules with HRPWM are staged with fractional compare values
+///
+/// @param  Modulator *mod, volatile struct EPWM_REGS *regsA, volatile struct EPWM_REGS *regsB,
+///         volatile struct EPWM_REGS *regsC, uint16_t mode (MOD_MODE_x),
+///         uint16_t overmodulation (MOD_OVERMOD_x)
+///
+/// @return bool initialised (false: module missing or not up-down, unknown variant)
+///
+//=================================================================================================
+bool ModInit(Modulator *mod, volatile struct EPWM_REGS *regsA, volatile struct EPWM_REGS *regsB,
+             volatile struct EPWM_REGS *regsC, uint16_t mode, uint16_t overmodulation)
+{
+    mod->regs[0] = regsA;
+    mod->regs[1] = regsB;
+    mod->regs[2] = regsC;
+    for (uint16_t i = 0; i < MOD_NUMBER_OF_PHASES; i++)
+    {
+        if (mod->regs[i] == 0 || mod->regs[i]->TBCTL.bit.CTRMODE != PWM_TB_COUNT_UPDOWN)
+        {
+            mod->regs[0] = 0;    // ModRun() does nothing
+            return false;
+        }
+        mod->duty[i] = 0.5f;
+    }
+    mod->zeroSequence = 0.0f;
+    mod->modulationIndex = 0.0f;
+    mod->overmodulated = 0;
+
+    if (!ModSetMode(mod, mode, overmodulation))
+    {
+        mod->regs[0] = 0;
+        return false;
+    }
+
+    return true;
+}
+
+//=== Function: ModSetMode ========================================================================
+///
+/// @brief  Function selects the zero-sequence voltage and the overmodulation strategy of a
+///         modulator. Can be changed while the modulator runs, e.g. SVPWM at low and DPWM at
+///         high modulation index
+///
+/// @param  Modulator *mod, uint16_t mode (MOD_MODE_x), uint16_t overmodulation (MOD_OVERMOD_x)
+///
+/// @return bool changed (false: unknown variant, the previous one is kept)
+///
+//=================================================================================================
+bool ModSetMode(Modulator *mod, uint16_t mode, uint16_t overmodulation)
+{
+    if (mode >= MOD_NUMBER_OF_MODES || overmodulation >= MOD_NUMBER_OF_OVERMODS)
+        return false;
+
+    mod->mode = mode;
+    mod->overmodulation = overmodulation;
+
+    return true;
+}
+
+//=== Function: ModRun ============================================================================
+///
+/// @brief  Function computes the duty cycles of an alpha/beta voltage reference and stages the
+///         compare values of the three legs (PwmDutyStage(), output B with the same value).
+///         The caller applies them with PwmDutyCommit(), so all legs switch to the new values
+///         at the same counter-zero event. Steps:
+///         1. Phase voltages of the reference, the line-to-line span max - min is at most 1
+///            (DC link voltage) for a realisable reference
+///         2. Overmodulation: MOD_OVERMOD_NONE scales the reference back to the circle
+///            |v| = 1/sqrt(3), MOD_OVERMOD_HEXAGON to the hexagon (span = 1, angle kept),
+///            MOD_OVERMOD_CLAMP leaves the reference unchanged and clamps the duty cycles
+///         3. Zero-sequence voltage of the variant and duty = 0.5 + v + zeroSequence
+///
+/// @param  Modulator *mod, float32 alpha, float32 beta (normalised to the DC link voltage)
+///
+/// @return void
+///
+//=================================================================================================
+void ModRun(Modulator *mod, float32 alpha, float32 beta)
+{
+    float32 v[MOD_NUMBER_OF_PHASES];
+    float32 magnitude = sqrtf(alpha * alpha + beta * beta);
+    float32 vMax;
+    float32 vMin;
+    float32 span;
+    float32 zero;
+
+    if (mod->regs[0] == 0)
+        return;
+
+    mod->modulationIndex = magnitude * (1.0f / MOD_LINEAR_LIMIT);
+    if (mod->overmodulation == MOD_OVERMOD_NONE && magnitude > MOD_LINEAR_LIMIT)
+    {
+        float32 scale = MOD_LINEAR_LIMIT / magnitude;
+
+        alpha *= scale;
+        beta *= scale;
+        mod->overmodulated++;
+    }
+
+    ModInverseClarke(alpha, beta, v);
+    vMax = v[0];
+    vMin = v[0];
+    for (uint16_t i = 1; i < MOD_NUMBER_OF_PHASES; i++)
+    {
+        if (v[i] > vMax)
+            vMax = v[i];
+        if (v[i] < vMin)
+            vMin = v[i];
+    }
+
+    span = vMax - vMin;
+    if (span > 1.0f && mod->overmodulation != MOD_OVERMOD_NONE)
+    {
+        if (mod->overmodulation == MOD_OVERMOD_HEXAGON)
+        {
+            float32 scale = 1.0f / span;
+
+            for (uint16_t i = 0; i < MOD_NUMBER_OF_PHASES; i++)
+                v[i] *= scale;
+            alpha *= scale;
+            beta *= scale;
+            vMax *= scale;
+            vMin *= scale;
+        }
+        mod->overmodulated++;
+    }
+
+    switch (mod->mode)
+    {
+    case MOD_MODE_DPWM0:
+        zero = ModClampShifted(v, alpha, beta, MOD_SIN_30);
+        break;
+    case MOD_MODE_DPWM1:
+        zero = (vMax + vMin >= 0.0f) ? 0.5f - vMax : -0.5f - vMin;
+        break;
+    case MOD_MODE_DPWM2:
+        zero = ModClampShifted(v, alpha, beta, -MOD_SIN_30);
+        break;
+    case MOD_MODE_DPWM3:
+        zero = (vMax + vMin >= 0.0f) ? -0.5f - vMin : 0.5f - vMax;
+        break;
+    case MOD_MODE_DPWMMAX:
+        zero = 0.5f - vMax;
+        break;
+    case MOD_MODE_DPWMMIN:
+        zero = -0.5f - vMin;
+        break;
+    default:    // MOD_MODE_SVPWM
+        zero = -0.5f * (vMax + vMin);
+        break;
+    }
+    mod->zeroSequence = zero;
+
+    for (uint16_t i = 0; i < MOD_NUMBER_OF_PHASES; i++)
+    {
+        volatile struct EPWM_REGS *regs = mod->regs[i];
+        float32 duty = 0.5f + v[i] + zero;
+        float32 compare;
+
+        // Rounding errors at a clamped leg and MOD_OVERMOD_CLAMP
+        if (duty > 1.0f)
+            duty = 1.0f;
+        else if (duty < 0.0f)
+            duty = 0.0f;
+        mod->duty[i] = duty;
+
+        compare = duty * (float32)regs->TBPRD;
+#if PWM_HRPWM
+        if (regs->HRCNFG.bit.EDGMODE != 0)
+        {
+            uint32_t fraction = (uint32_t)(compare * (float32)(1UL << PWM_HR_FRACTION_BITS) + 0.5f);
+
+            PwmHrDutyStage(regs, fraction, fraction);
+            continue;
+        }
+#endif
+        PwmDutyStage(regs, (uint16_t)(compare + 0.5f), (uint16_t)(compare + 0.5f));
+    }
+}
+
+//=== Function: ModCheckService ===================================================================
+///
+/// @brief  Function runs the modulator check on ePWM2 to ePWM4 (PWM_LEDs of adcPwmRoute 2, 4 and
+///         6). A new modCheckRequest (re)starts the modulator with the selected variant, the
+///         reference turns once per MOD_CHECK_PERIOD_US with the magnitude modCheckMagnitude.
+///         With a DPWM variant every LED stays fully on or off for a third of the turn.
+///         MOD_CHECK_OFF (or an unknown variant) switches the three LEDs off. Called in the main
+///         loop after the checks, when the sequencer no longer writes the compares
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ModCheckService(void)
+{
+    uint32_t now;
+
+    if (modCheckRequest != modCheckActive)
+    {
+        modCheckActive = MOD_CHECK_OFF;
+        if (modCheckRequest == MOD_CHECK_OFF
+            || !ModInit(&modCheck, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs,
+                        modCheckRequest - 1, MOD_OVERMOD_HEXAGON))
+        {
+            modCheckRequest = MOD_CHECK_OFF;
+            PwmDutyStage(&EPwm2Regs, 0, 0);
+            PwmDutyStage(&EPwm3Regs, 0, 0);
+            PwmDutyStage(&EPwm4Regs, 0, 0);
+            PwmDutyCommit();
+            return;
+        }
+        modCheckActive = modCheckRequest;
+        modCheckAngle = 0.0f;
+        modCheckLastTime = DeviceGetTime();
+    }
+    if (modCheckActive == MOD_CHECK_OFF)
+        return;
+
+    now = DeviceGetTime();
+    modCheckAngle += MOD_TWO_PI * (float32)(now - modCheckLastTime)
+                     / (float32)(MOD_CHECK_PERIOD_US * DEVICE_TIME_TICKS_PER_US);
+    modCheckLastTime = now;
+    while (modCheckAngle >= MOD_TWO_PI)
+        modCheckAngle -= MOD_TWO_PI;
+
+    ModRun(&modCheck, modCheckMagnitude * cosf(modCheckAngle), modCheckMagnitude * sinf(modCheckAngle));
+    PwmDutyCommit();
+}
@@ -0,0 +1,100 @@
+//=================================================================================================
+/// @file     TB_Modulator.h
+///
+/// @brief    File contains a three-phase modulator for three half-bridge legs. It turns an
+///           alpha/beta voltage reference into the compare values of three center-aligned
+///           ePWM modules and stages them with PwmDutyStage()/PwmHrDutyStage(), the caller
+///           applies them with PwmDutyCommit(). The zero-sequence voltage selects continuous
+///           space-vector PWM (SVPWM) or one of the discontinuous variants (DPWM), which clamp
+///           every leg to one DC rail for 120 degrees of the fundamental period and so switch
+///           a third less often. References outside of the linear range are limited by the
+///           selected overmodulation strategy.
+///           Voltages are normalised to the DC link voltage, the phase voltages are referred to
+///           the DC link midpoint (duty cycle 0.5 = 0 V). The linear range of the modulator is
+///           the circle inscribed in the voltage hexagon, |v| <= 1/sqrt(3)
+///           ModCheckService() runs the modulator on ePWM2 to ePWM4 after the checks, the duty
+///           cycles of the three legs show up as the brightness of three PWM_LEDs
+///
+/// @version  V1.1.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYMODULATOR_H_
+#define MYMODULATOR_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_PWM.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Zero-sequence voltage (Modulator.mode)
+#define MOD_MODE_SVPWM                  0       // continuous, centred (min-max injection)
+#define MOD_MODE_DPWM0                  1       // clamped 60 deg around 30 deg before the peak
+#define MOD_MODE_DPWM1                  2       // clamped 60 deg around the peak of each phase
+#define MOD_MODE_DPWM2                  3       // clamped 60 deg around 30 deg after the peak
+#define MOD_MODE_DPWM3                  4       // clamped 30..60 deg before and after the peak
+#define MOD_MODE_DPWMMAX                5       // clamped to the positive rail only
+#define MOD_MODE_DPWMMIN                6       // clamped to the negative rail only
+#define MOD_NUMBER_OF_MODES             7
+// Limitation outside of the linear range (Modulator.overmodulation)
+#define MOD_OVERMOD_NONE                0       // magnitude limited to the circle, 1/sqrt(3)
+#define MOD_OVERMOD_HEXAGON             1       // magnitude limited to the hexagon, angle kept
+                                                // (minimum phase error)
+#define MOD_OVERMOD_CLAMP               2       // duties clamped to 0..1, up to six-step
+                                                // (minimum magnitude error)
+#define MOD_NUMBER_OF_OVERMODS          3
+// Linear limit of the reference and DPWM0/DPWM2 selection angle (+-30 deg)
+#define MOD_LINEAR_LIMIT                0.57735027f
+#define MOD_SQRT3_2                     0.86602540f
+#define MOD_COS_30                      0.86602540f
+#define MOD_SIN_30                      0.5f
+// Number of legs
+#define MOD_NUMBER_OF_PHASES            3
+// Modulator check (modCheckRequest): off, otherwise MOD_MODE_x + 1
+#define MOD_CHECK_OFF                   0
+// One turn of the reference of the modulator check, slow enough to follow on the PWM_LEDs
+#define MOD_CHECK_PERIOD_US             2000000UL
+#define MOD_TWO_PI                      6.2831853f
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Modulator of three legs (ModInit()), the results of the last ModRun() stay readable
+typedef struct
+{
+    volatile struct EPWM_REGS *regs[MOD_NUMBER_OF_PHASES]; // legs a, b, c (up-down counting)
+    uint16_t mode;                      // MOD_MODE_x
+    uint16_t overmodulation;            // MOD_OVERMOD_x
+    float32 duty[MOD_NUMBER_OF_PHASES]; // duty cycle of the high side of each leg, 0..1
+    float32 zeroSequence;               // injected zero-sequence voltage
+    float32 modulationIndex;            // |v| / MOD_LINEAR_LIMIT of the reference
+    uint32_t overmodulated;             // number of ModRun() calls outside of the linear range
+} Modulator;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Modulator check on ePWM2 to ePWM4 (ModCheckService()), set in the debugger after the checks
+extern uint16_t modCheckRequest;
+extern float32 modCheckMagnitude;
+extern Modulator modCheck;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function assigns three initialised ePWM modules to a modulator and selects the variant
+extern bool ModInit(Modulator *mod, volatile struct EPWM_REGS *regsA, volatile struct EPWM_REGS *regsB,
+                    volatile struct EPWM_REGS *regsC, uint16_t mode, uint16_t overmodulation);
+// Function changes the variant of a modulator, applied by the next ModRun()
+extern bool ModSetMode(Modulator *mod, uint16_t mode, uint16_t overmodulation);
+// Function computes the duty cycles of the reference and stages the compare values
+extern void ModRun(Modulator *mod, float32 alpha, float32 beta);
+// Function turns the reference of the modulator check and applies the duty cycles
+extern void ModCheckService(void);
+
+#endif
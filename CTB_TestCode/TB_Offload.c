@@ -0,0 +1,275 @@
+//=================================================================================================
+/// @file     TB_Offload.c
+///
+/// @brief    File contains a framework to offload work from CPU1 to CPU2. CPU1 writes jobs
+///           (function ID and arguments) into a command queue in RAMGS4 (master CPU1), the worker
+///           loop of CPU2 executes the registered function of each job and writes the result into
+///           a completion queue in RAMGS5 (master CPU2). Both queues have one writer and one
+///           reader, every index is written by one CPU only. The file is linked into the CPU2
+///           project (CTB_TestCode_CPU2/.project)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Offload.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Command queue (master of RAMGS4 is CPU1, CPU2 can only read)
+OffloadCpu1Area offloadCpu1;
+#pragma DATA_SECTION(offloadCpu1,"SHARERAMGS4");
+// Completion queue (master of RAMGS5 is CPU2, CPU1 can only read)
+OffloadCpu2Area offloadCpu2;
+#pragma DATA_SECTION(offloadCpu2,"SHARERAMGS5");
+
+#ifdef CPU2
+// Registered functions of the worker
+static OffloadFunction offloadFunctions[OFFLOAD_NUMBER_OF_FUNCTIONS];
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU2
+//=== Function: OffloadEcho =======================================================================
+///
+/// @brief  Function of OFFLOAD_FUNCTION_ECHO, returns the first argument. Used by CPU1 to check
+///         the path to the worker
+///
+/// @param  const uint32_t *arg, uint16_t numberOfArgs
+///
+/// @return uint32_t result
+///
+//=================================================================================================
+static uint32_t OffloadEcho(const uint32_t *arg, uint16_t numberOfArgs)
+{
+    return (numberOfArgs > 0) ? arg[0] : 0;
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: OffloadInit =======================================================================
+///
+/// @brief  CPU1: Function clears both queues, gives RAMGS5 to CPU2 and sets its ready flag.
+///         Must be called once after DeviceInit() and before CPU2 can use the queues.
+///         CPU2: Function waits for the ready flag of CPU1, resets the completion queue and sets
+///         its ready flag. The write is repeated until it is visible, because the writes of CPU2
+///         are ignored as long as CPU1 has not given RAMGS5 to CPU2
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void OffloadInit(void)
+{
+#ifdef CPU1
+    offloadCpu1.ready = 0;
+    offloadCpu1.commandHead = 0;
+    offloadCpu1.completionTail = 0;
+    offloadCpu2.ready = 0;
+
+    EALLOW;
+    MemCfgRegs.GSxMSEL.bit.MSEL_GS5 = 1;
+    EDIS;
+
+    offloadCpu1.ready = OFFLOAD_READY_KEY;
+#endif
+#ifdef CPU2
+    uint16_t i;
+
+    for (i = 0; i < OFFLOAD_NUMBER_OF_FUNCTIONS; i++)
+        offloadFunctions[i] = 0;
+    offloadFunctions[OFFLOAD_FUNCTION_ECHO] = OffloadEcho;
+
+    while (offloadCpu1.ready != OFFLOAD_READY_KEY);
+
+    do
+    {
+        // CPU1 has cleared its command queue, start with its head
+        offloadCpu2.commandTail = offloadCpu1.commandHead;
+        offloadCpu2.completionHead = offloadCpu1.completionTail;
+        offloadCpu2.ready = OFFLOAD_READY_KEY;
+    } while (offloadCpu2.ready != OFFLOAD_READY_KEY);
+#endif
+}
+
+//=== Function: OffloadWorkerReady ================================================================
+///
+/// @brief  Function returns true if the worker of CPU2 has set up the completion queue
+///
+/// @param  void
+///
+/// @return bool ready
+///
+//=================================================================================================
+bool OffloadWorkerReady(void)
+{
+    return offloadCpu2.ready == OFFLOAD_READY_KEY;
+}
+
+#ifdef CPU1
+//=== Function: OffloadDispatch ===================================================================
+///
+/// @brief  Function writes a job into the command queue and sets OFFLOAD_IPC_FLAG. The number of
+///         the job is returned in "tag" (can be 0). Returns false if the worker is not ready or
+///         OFFLOAD_QUEUE_SIZE jobs are not collected yet, so the completion queue can not overflow
+///
+/// @param  uint16_t function, const uint32_t *arg, uint16_t numberOfArgs, uint16_t *tag
+///
+/// @return bool dispatched
+///
+//=================================================================================================
+bool OffloadDispatch(uint16_t function, const uint32_t *arg, uint16_t numberOfArgs, uint16_t *tag)
+{
+    uint16_t head = offloadCpu1.commandHead;
+    volatile OffloadJob *job;
+    uint16_t i;
+
+    if (!OffloadWorkerReady() || numberOfArgs > OFFLOAD_NUMBER_OF_ARGS
+        || (uint16_t)(head - offloadCpu1.completionTail) >= OFFLOAD_QUEUE_SIZE)
+        return false;
+
+    job = &offloadCpu1.command[head & OFFLOAD_QUEUE_MASK];
+    job->function = function;
+    job->tag = head;
+    job->numberOfArgs = numberOfArgs;
+    for (i = 0; i < numberOfArgs; i++)
+        job->arg[i] = arg[i];
+
+    // The job is complete before the head is moved (the worker only reads up to the head)
+    offloadCpu1.commandHead = head + 1;
+    Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.all = OFFLOAD_IPC_FLAG;
+
+    if (tag)
+        *tag = head;
+    return true;
+}
+
+//=== Function: OffloadGetCompletion ==============================================================
+///
+/// @brief  Function copies the next completion of the worker into "completion"
+///
+/// @param  OffloadCompletion *completion
+///
+/// @return bool available
+///
+//=================================================================================================
+bool OffloadGetCompletion(OffloadCompletion *completion)
+{
+    uint16_t tail = offloadCpu1.completionTail;
+    volatile OffloadCompletion *entry;
+
+    if (!OffloadWorkerReady() || tail == offloadCpu2.completionHead)
+        return false;
+
+    entry = &offloadCpu2.completion[tail & OFFLOAD_QUEUE_MASK];
+    completion->function = entry->function;
+    completion->tag = entry->tag;
+    completion->status = entry->status;
+    completion->result = entry->result;
+
+    offloadCpu1.completionTail = tail + 1;
+    return true;
+}
+
+//=== Function: OffloadGetPending =================================================================
+///
+/// @brief  Function returns the number of dispatched jobs whose completion is not collected yet
+///
+/// @param  void
+///
+/// @return uint16_t pending
+///
+//=================================================================================================
+uint16_t OffloadGetPending(void)
+{
+    return offloadCpu1.commandHead - offloadCpu1.completionTail;
+}
+#endif
+
+#ifdef CPU2
+//=== Function: OffloadRegister ===================================================================
+///
+/// @brief  Function registers the function which the worker executes for a function ID
+///
+/// @param  uint16_t function, OffloadFunction handler
+///
+/// @return bool registered
+///
+//=================================================================================================
+bool OffloadRegister(uint16_t function, OffloadFunction handler)
+{
+    if (function == OFFLOAD_FUNCTION_NONE || function >= OFFLOAD_NUMBER_OF_FUNCTIONS)
+        return false;
+
+    offloadFunctions[function] = handler;
+    return true;
+}
+
+//=== Function: OffloadWorkerPoll =================================================================
+///
+/// @brief  Function executes the next job of the command queue and writes its completion. Must be
+///         called in the main loop of CPU2. Returns false if there is no job or the completion
+///         queue is full
+///
+/// @param  void
+///
+/// @return bool executed
+///
+//=================================================================================================
+bool OffloadWorkerPoll(void)
+{
+    uint16_t tail = offloadCpu2.commandTail;
+    uint16_t head = offloadCpu2.completionHead;
+    volatile OffloadJob *job;
+    volatile OffloadCompletion *entry;
+    uint32_t arg[OFFLOAD_NUMBER_OF_ARGS];
+    uint16_t numberOfArgs;
+    uint16_t function;
+    uint16_t i;
+
+    if (tail == offloadCpu1.commandHead)
+        return false;
+    if ((uint16_t)(head - offloadCpu1.completionTail) >= OFFLOAD_QUEUE_SIZE)
+        return false;
+
+    Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = OFFLOAD_IPC_FLAG;
+
+    job = &offloadCpu1.command[tail & OFFLOAD_QUEUE_MASK];
+    function = job->function;
+    numberOfArgs = job->numberOfArgs;
+    if (numberOfArgs > OFFLOAD_NUMBER_OF_ARGS)
+        numberOfArgs = OFFLOAD_NUMBER_OF_ARGS;
+    for (i = 0; i < numberOfArgs; i++)
+        arg[i] = job->arg[i];
+
+    entry = &offloadCpu2.completion[head & OFFLOAD_QUEUE_MASK];
+    entry->function = function;
+    entry->tag = job->tag;
+    if (function < OFFLOAD_NUMBER_OF_FUNCTIONS && offloadFunctions[function])
+    {
+        entry->result = offloadFunctions[function](arg, numberOfArgs);
+        entry->status = OFFLOAD_STATUS_OK;
+    }
+    else
+    {
+        entry->result = 0;
+        entry->status = OFFLOAD_STATUS_UNKNOWN_FUNCTION;
+    }
+
+    // The completion is complete before the heads are moved
+    offloadCpu2.commandTail = tail + 1;
+    offloadCpu2.completionHead = head + 1;
+    return true;
+}
+#endif
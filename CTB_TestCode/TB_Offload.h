@@ -0,0 +1,118 @@
+//=================================================================================================
+/// @file     TB_Offload.h
+///
+/// @brief    File contains a framework to offload work from CPU1 to CPU2. CPU1 writes jobs
+///           (function ID and arguments) into a command queue in RAMGS4 (master CPU1), the worker
+///           loop of CPU2 executes the registered function of each job and writes the result into
+///           a completion queue in RAMGS5 (master CPU2). Both queues have one writer and one
+///           reader, every index is written by one CPU only. The file is linked into the CPU2
+///           project (CTB_TestCode_CPU2/.project)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYOFFLOAD_H_
+#define MYOFFLOAD_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of entries of the command and of the completion queue (power of two)
+#define OFFLOAD_QUEUE_SIZE              16
+#define OFFLOAD_QUEUE_MASK              (OFFLOAD_QUEUE_SIZE - 1)
+// Maximum number of arguments of a job
+#define OFFLOAD_NUMBER_OF_ARGS          4
+// Number of function IDs which can be registered on CPU2
+#define OFFLOAD_NUMBER_OF_FUNCTIONS     16
+// Key of the ready flags of both CPUs
+#define OFFLOAD_READY_KEY               0x5AA5
+// IPC flag which is set by CPU1 for every new job (IPC2, can wake an idle worker)
+#define OFFLOAD_IPC_FLAG                0x4UL
+// Function IDs
+#define OFFLOAD_FUNCTION_NONE           0
+#define OFFLOAD_FUNCTION_ECHO           1
+// Status of a completion
+#define OFFLOAD_STATUS_OK               0
+#define OFFLOAD_STATUS_UNKNOWN_FUNCTION 1
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Function executed by CPU2 for a job, returns the result of the job
+typedef uint32_t (*OffloadFunction)(const uint32_t *arg, uint16_t numberOfArgs);
+
+// Job of the command queue
+typedef struct
+{
+    uint16_t function;                  // function ID
+    uint16_t tag;                       // number of the job, returned with the completion
+    uint16_t numberOfArgs;
+    uint32_t arg[OFFLOAD_NUMBER_OF_ARGS];
+} OffloadJob;
+
+// Entry of the completion queue
+typedef struct
+{
+    uint16_t function;
+    uint16_t tag;
+    uint16_t status;                    // OFFLOAD_STATUS_...
+    uint32_t result;
+} OffloadCompletion;
+
+// Area written by CPU1 (RAMGS4)
+typedef struct
+{
+    volatile uint16_t ready;            // OFFLOAD_READY_KEY when the queues are set up
+    volatile uint16_t commandHead;      // next job written by CPU1
+    volatile uint16_t completionTail;   // next completion read by CPU1
+    volatile OffloadJob command[OFFLOAD_QUEUE_SIZE];
+} OffloadCpu1Area;
+
+// Area written by CPU2 (RAMGS5)
+typedef struct
+{
+    volatile uint16_t ready;            // OFFLOAD_READY_KEY when the worker is running
+    volatile uint16_t commandTail;      // next job read by CPU2
+    volatile uint16_t completionHead;   // next completion written by CPU2
+    volatile OffloadCompletion completion[OFFLOAD_QUEUE_SIZE];
+} OffloadCpu2Area;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Command queue (RAMGS4, written by CPU1)
+extern OffloadCpu1Area offloadCpu1;
+// Completion queue (RAMGS5, written by CPU2)
+extern OffloadCpu2Area offloadCpu2;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function sets up the queues. CPU1: gives RAMGS5 to CPU2, CPU2: waits for CPU1
+extern void OffloadInit(void);
+// Function returns true if the worker of CPU2 is running
+extern bool OffloadWorkerReady(void);
+#ifdef CPU1
+// Function writes a job into the command queue, returns false if the queue is full
+extern bool OffloadDispatch(uint16_t function, const uint32_t *arg, uint16_t numberOfArgs,
+                            uint16_t *tag);
+// Function reads the next completion, returns false if there is none
+extern bool OffloadGetCompletion(OffloadCompletion *completion);
+// Function returns the number of dispatched jobs which are not collected yet
+extern uint16_t OffloadGetPending(void);
+#endif
+#ifdef CPU2
+// Function registers the function which is executed for a function ID
+extern bool OffloadRegister(uint16_t function, OffloadFunction handler);
+// Function executes the next job of the command queue, returns false if there is none
+extern bool OffloadWorkerPoll(void);
+#endif
+
+#endif
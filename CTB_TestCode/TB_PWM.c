@@ -15,599 +15,786 @@
 //-------------------------------------------------------------------------------------------------
 #include "TB_PWM.h"
 #include "TB_GPIO.h"
+#if PWM_HRPWM
+#include "SFO_V8.h"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Duty updates are called by the sequencer ISR (see TB_Functions.c)
+#pragma CODE_SECTION(PwmDutyStage, ".TI.ramfunc");
+#pragma CODE_SECTION(PwmDutyCommit, ".TI.ramfunc");
+#pragma CODE_SECTION(PwmSampleTrack, ".TI.ramfunc");
+#if PWM_HRPWM
+#pragma CODE_SECTION(PwmHrDutyStage, ".TI.ramfunc");
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// ePWM1 generates the SOCA of the ADCs (5 us) and runs with HRPWM (TBCLK = EPWMCLK),
+// ePWM2 to ePWM16 are used for the PWM_LEDs only. All modules are center-aligned (up-down),
+// the SOCA of ePWM1 is moved into the middle of the quiet part of the period by
+// PwmInitSamplePoint()
+const PwmConfig pwmConfigTable[PWM_NUMBER_OF_MODULES] =
+{
+    // regs      module clkDiv          hspClkDiv         ctrMode              period      aqZero      aqCompareUp   socEnable           socSelect        socPeriod      pinA pinB hrMode
+    {&EPwm1Regs,     1, PWM_CLK_DIV_1,   PWM_HSPCLKDIV_1,  PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_ENABLE,  PWM_ET_CTR_PRD,  PWM_ET_1ST,    145, 146, PWM_HR_ENABLE},
+    {&EPwm2Regs,     2, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 147, 148, PWM_HR_DISABLE},
+    {&EPwm3Regs,     3, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 149, 150, PWM_HR_DISABLE},
+    {&EPwm4Regs,     4, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 151, 152, PWM_HR_DISABLE},
+    {&EPwm5Regs,     5, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 153, 154, PWM_HR_DISABLE},
+    {&EPwm6Regs,     6, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 155, 156, PWM_HR_DISABLE},
+    {&EPwm7Regs,     7, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 157, 158, PWM_HR_DISABLE},
+    {&EPwm8Regs,     8, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 159, 160, PWM_HR_DISABLE},
+    {&EPwm9Regs,     9, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 161, 162, PWM_HR_DISABLE},
+    {&EPwm10Regs,   10, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 163, 164, PWM_HR_DISABLE},
+    {&EPwm11Regs,   11, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 165, 166, PWM_HR_DISABLE},
+    {&EPwm12Regs,   12, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 167, 168, PWM_HR_DISABLE},
+    {&EPwm13Regs,   13, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 137, 138, PWM_HR_DISABLE},
+    {&EPwm14Regs,   14, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 139, 140, PWM_HR_DISABLE},
+    {&EPwm15Regs,   15, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 141, 142, PWM_HR_DISABLE},
+    {&EPwm16Regs,   16, PWM_CLK_DIV_128, PWM_HSPCLKDIV_14, PWM_TB_COUNT_UPDOWN, PWM_PERIOD, PWM_AQ_SET, PWM_AQ_CLEAR, PWM_ET_SOC_DISABLE, PWM_ET_CTR_ZERO, PWM_ET_DISABLE, 143, 144, PWM_HR_DISABLE}
+};
+#if PWM_HRPWM
+// MEP steps per TBCLK, written by SFO() into HRMSTEP (used by AUTOCONV of all modules)
+int MEP_ScaleFactor = 0;
+// ePWM modules for the SFO library (index 0 is not used)
+volatile struct EPWM_REGS *ePWM[PWM_NUMBER_OF_MODULES + 1] =
+{
+    &EPwm1Regs,
+    &EPwm1Regs,  &EPwm2Regs,  &EPwm3Regs,  &EPwm4Regs,  &EPwm5Regs,  &EPwm6Regs,  &EPwm7Regs,  &EPwm8Regs,
+    &EPwm9Regs,  &EPwm10Regs, &EPwm11Regs, &EPwm12Regs, &EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
+int pwmHrStatus = SFO_INCOMPLETE;
+uint32_t pwmHrCalibrations = 0;
+#endif
+// Interleaved group (PwmInitInterleaved()), phase 0 is the master
+volatile struct EPWM_REGS *pwmInterleaveRegs[PWM_INTERLEAVE_MAX_PHASES];
+uint16_t pwmInterleavePhases = 0;
+uint16_t pwmInterleaveCycle = 0;
+// Period of the table entries with PWM_PERIOD (parameter store, loaded by ParamsInit())
+uint16_t pwmPeriod = PWM_PERIOD;
+uint16_t pwmPhaseTarget[PWM_INTERLEAVE_MAX_PHASES];
+uint16_t pwmPhaseActual[PWM_INTERLEAVE_MAX_PHASES];
+// Module with the sampling point (PwmInitSamplePoint()), TBCLK from the SOC to the middle of the
+// sampling window and current centre of the window (PWM_SAMPLE_AT_PRD or PWM_SAMPLE_AT_ZERO)
+volatile struct EPWM_REGS *pwmSampleRegs = 0;
+uint16_t pwmSampleOffset = 0;
+uint16_t pwmSampleCentre = PWM_SAMPLE_AT_PRD;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+#if PWM_HRPWM
+//=== Function: PwmInitHr =========================================================================
+///
+/// @brief  Function switches on the HRPWM of one ePWM module. The MEP moves the edges of CMPA
+///         and CMPB (action qualifier CAU/CBU) by CMPAHR/CMPBHR and the period by TBPRDHR.
+///         AUTOCONV scales the 8 bit fraction with HRMSTEP, so the values are independent of
+///         the MEP step size. In up-count mode only the falling edge is moved (the rising edge
+///         is at TBCTR = 0), in up-down mode both edges. Has to be called with EALLOW
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t ctrMode
+///
+/// @return void
+///
+//=================================================================================================
+static void PwmInitHr(volatile struct EPWM_REGS *regs, uint16_t ctrMode)
+{
+    uint16_t edge = (ctrMode == PWM_TB_COUNT_UPDOWN) ? PWM_HR_EDGE_BOTH : PWM_HR_EDGE_FALLING;
+
+    regs->HRCNFG.all = 0;
+    regs->HRCNFG.bit.EDGMODE = edge;    // MEP on output A ...
+    regs->HRCNFG.bit.CTLMODE = PWM_HR_CTL_COMPARE;    // ... controlled by CMPAHR
+    regs->HRCNFG.bit.HRLOAD = PWM_HR_LOAD_CTR_ZERO;
+    regs->HRCNFG.bit.EDGMODEB = edge;   // MEP on output B controlled by CMPBHR
+    regs->HRCNFG.bit.CTLMODEB = PWM_HR_CTL_COMPARE;
+    regs->HRCNFG.bit.HRLOADB = PWM_HR_LOAD_CTR_ZERO;
+    regs->HRCNFG.bit.AUTOCONV = 1;    // Fraction * HRMSTEP is computed by the hardware
+    regs->TBCTL.bit.PRDLD = PWM_TB_SHADOW;    // High-resolution period only works with the shadow register
+    regs->HRPCTL.bit.HRPE = 1;    // High-resolution period
+    regs->TBPRDHR = 0;
+}
+#endif
+
+//=== Function: PwmTablePeriod ====================================================================
+///
+/// @brief  Function returns TBPRD of a table entry. PWM_PERIOD stands for the period of the
+///         parameter store (pwmPeriod), other values are used unchanged. The period is the
+///         length of one PWM period in TBCLK, the up-down counter needs TBPRD = period / 2 for
+///         the same frequency
+///
+/// @param  const PwmConfig *config
+///
+/// @return uint16_t period
+///
+//=================================================================================================
+static uint16_t PwmTablePeriod(const PwmConfig *config)
+{
+    uint16_t period = (config->period == PWM_PERIOD) ? pwmPeriod : config->period;
+
+    return (config->ctrMode == PWM_TB_COUNT_UPDOWN) ? period / 2 : period;
+}
+
+//=== Function: PwmInverseAction ==================================================================
+///
+/// @brief  Function returns the action of the compare match counting down. In up-down mode the
+///         output is switched back at the same compare value, so the pulse is centered at
+///         TBCTR = 0 (or TBPRD) and the duty cycle is still CMPA / TBPRD. In up-count mode there
+///         is no down match
+///
+/// @param  const PwmConfig *config, uint16_t action
+///
+/// @return uint16_t action
+///
+//=================================================================================================
+static uint16_t PwmInverseAction(const PwmConfig *config, uint16_t action)
+{
+    if (config->ctrMode != PWM_TB_COUNT_UPDOWN)
+        return PWM_AQ_NO_ACTION;
+    if (action == PWM_AQ_SET)
+        return PWM_AQ_CLEAR;
+    if (action == PWM_AQ_CLEAR)
+        return PWM_AQ_SET;
+
+    return action;
+}
+
+//=== Function: PwmPhaseToTbphs ===================================================================
+///
+/// @brief  Function converts the phase delay of a module relative to the master into TBPHS.
+///         The slave counter is loaded with TBPHS when the master is at TBCTR = 0, so a delay
+///         of d TBCLK needs TBPHS = cycle - d. The counter of the slave starts
+///         PWM_SYNCHRONIZAION_DELAY TBCLK after the sync pulse, which is added
+///
+/// @param  uint16_t delay
+///
+/// @return uint16_t tbphs
+///
+//=================================================================================================
+static uint16_t PwmPhaseToTbphs(uint16_t delay)
+{
+    uint16_t tbphs = pwmInterleaveCycle - delay + PWM_SYNCHRONIZAION_DELAY;
+
+    if (tbphs >= pwmInterleaveCycle)
+        tbphs -= pwmInterleaveCycle;
+
+    return tbphs;
+}
+
+//=== Function: PwmTbClockMHz =====================================================================
+///
+/// @brief  Function computes TBCLK from the actual settings: EPWMCLK = SYSCLK / EPWMCLKDIV,
+///         TBCLK = EPWMCLK / (CLKDIV * HSPCLKDIV)
+///
+/// @param  volatile struct EPWM_REGS *regs
+///
+/// @return float32 clockMHz
+///
+//=================================================================================================
+static float32 PwmTbClockMHz(volatile struct EPWM_REGS *regs)
+{
+    uint16_t hspClkDiv = regs->TBCTL.bit.HSPCLKDIV;
+    float32 clockMHz = (float32)DEVICE_SYSCLK_MHZ / (float32)(1U << ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV);
+
+    clockMHz /= (float32)(1U << regs->TBCTL.bit.CLKDIV);    // CLKDIV = 2^x
+    if (hspClkDiv > 0)
+        clockMHz /= (float32)(2 * hspClkDiv);    // HSPCLKDIV = 2 * x, x = 0 is 1
+
+    return clockMHz;
+}
+
+//=== Function: PwmDeadBandClockMHz ===============================================================
+///
+/// @brief  Function computes the clock of the dead band counter from the actual settings:
+///         TBCLK (PwmTbClockMHz()), doubled in the half cycle mode
+///
+/// @param  volatile struct EPWM_REGS *regs
+///
+/// @return float32 clockMHz
+///
+//=================================================================================================
+static float32 PwmDeadBandClockMHz(volatile struct EPWM_REGS *regs)
+{
+    float32 clockMHz = PwmTbClockMHz(regs);
+
+    if (regs->DBCTL.bit.HALFCYCLE == PWM_DB_HALF_CYCLE)
+        clockMHz *= 2.0f;
+
+    return clockMHz;
+}
+
+//=== Function: PwmNsToCounts =====================================================================
+///
+/// @brief  Function converts a dead time in ns into counts of the dead band counter with
+///         fractionBits fractional bits. The result is rounded up, so the dead time is never
+///         shorter than requested
+///
+/// @param  uint16_t ns, float32 clockMHz, uint16_t fractionBits
+///
+/// @return uint32_t counts
+///
+//=================================================================================================
+static uint32_t PwmNsToCounts(uint16_t ns, float32 clockMHz, uint16_t fractionBits)
+{
+    float32 exact = (float32)ns * clockMHz / 1000.0f * (float32)(1UL << fractionBits);
+    uint32_t counts = (uint32_t)exact;
+
+    if ((float32)counts < exact)
+        counts++;
+
+    return counts;
+}
 
 
 //-------------------------------------------------------------------------------------------------
 // Global functions
 //-------------------------------------------------------------------------------------------------
-//=== Function: PwmInitAll =====================================================================
+//=== Function: PwmInitFromTable ==================================================================
 ///
-/// @brief  functions to configure all PWM modules
+/// @brief  Function initialises the ePWM modules of a configuration table. The time base clocks
+///         are stopped during the configuration and started together at the end (TBCLKSYNC).
+///         CMPA/CMPB are shadowed and only loaded by a one-shot global load, which is armed for
+///         all modules at once by PwmDutyCommit() (GLDCTL2 of every module is linked to ePWM1)
 ///
-/// @param  void
+/// @param  const PwmConfig *table, uint16_t numberOfModules
 ///
 /// @return void
 ///
 //=================================================================================================
-void PwmInitAll(void)
+void PwmInitFromTable(const PwmConfig *table, uint16_t numberOfModules)
 {
     EALLOW;   // Disable register write protection
     CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;   // Switch off synchronization clock during configuration
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;   // Switch on clock for the PWM1 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm1Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_1;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm1Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_1;
-    EPwm1Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM1 is the master module
-    EPwm1Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm1Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm1Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm1Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm1Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm1Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm1Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm1Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm1Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm1Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm1Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm1Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm1Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm1Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm1Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm1Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm1Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm1Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm1Regs.TBCTR = 0;    // Set timer to 0
-
-    EPwm1Regs.ETSEL.bit.SOCAEN = PWM_ET_SOC_ENABLE;
-    EPwm1Regs.ETSEL.bit.SOCASEL = PWM_ET_CTR_ZERO;
-    EPwm1Regs.ETPS.bit.SOCAPRD = PWM_ET_1ST;
-
-    // ePWM 1A
-    GpioCtrlRegs.GPELOCK.bit.GPIO145 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO145 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO145 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO145 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 1B
-    GpioCtrlRegs.GPELOCK.bit.GPIO146 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO146 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO146 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO146 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM2 = 1;   // Switch on clock for the PWM2 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm2Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm2Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm2Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM2 is the master module
-    EPwm2Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm2Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm2Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm2Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm2Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm2Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm2Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm2Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm2Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm2Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm2Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm2Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm2Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm2Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm2Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm2Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm2Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm2Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm2Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 2A
-    GpioCtrlRegs.GPELOCK.bit.GPIO147 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO147 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO147 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO147 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 2B
-    GpioCtrlRegs.GPELOCK.bit.GPIO148 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO148 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO148 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO148 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM3 = 1;   // Switch on clock for the PWM3 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm3Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm3Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm3Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM3 is the master module
-    EPwm3Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm3Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm3Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm3Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm3Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm3Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm3Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm3Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm3Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm3Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm3Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm3Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm3Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm3Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm3Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm3Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm3Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm3Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm3Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 3A
-    GpioCtrlRegs.GPELOCK.bit.GPIO149 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO149 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO149 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO149 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 3B
-    GpioCtrlRegs.GPELOCK.bit.GPIO150 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO150 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO150 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO150 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM4 = 1;   // Switch on clock for the PWM4 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm4Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm4Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm4Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM4 is the master module
-    EPwm4Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm4Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm4Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm4Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm4Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm4Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm4Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm4Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm4Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm4Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm4Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm4Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm4Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm4Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm4Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm4Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm4Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm4Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm4Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 4A
-    GpioCtrlRegs.GPELOCK.bit.GPIO151 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO151 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO151 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO151 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 4B
-    GpioCtrlRegs.GPELOCK.bit.GPIO152 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO152 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO152 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO152 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM5 = 1;   // Switch on clock for the PWM5 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm5Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm5Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm5Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM5 is the master module
-    EPwm5Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm5Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm5Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm5Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm5Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm5Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm5Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm5Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm5Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm5Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm5Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm5Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm5Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm5Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm5Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm5Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm5Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm5Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm5Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 5A
-    GpioCtrlRegs.GPELOCK.bit.GPIO153 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO153 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO153 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO153 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 5B
-    GpioCtrlRegs.GPELOCK.bit.GPIO154 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO154 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO154 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO154 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM6 = 1;   // Switch on clock for the PWM6 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm6Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm6Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm6Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM6 is the master module
-    EPwm6Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm6Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm6Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm6Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm6Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm6Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm6Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm6Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm6Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm6Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm6Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm6Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm6Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm6Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm6Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm6Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm6Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm6Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm6Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 6A
-    GpioCtrlRegs.GPELOCK.bit.GPIO155 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO155 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO155 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO155 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 6B
-    GpioCtrlRegs.GPELOCK.bit.GPIO156 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO156 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO156 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO156 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM7 = 1;   // Switch on clock for the PWM7 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm7Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm7Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm7Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM7 is the master module
-    EPwm7Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm7Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm7Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm7Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm7Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm7Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm7Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm7Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm7Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm7Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm7Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm7Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm7Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm7Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm7Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm7Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm7Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm7Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm7Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 7A
-    GpioCtrlRegs.GPELOCK.bit.GPIO157 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO157 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO157 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO157 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 7B
-    GpioCtrlRegs.GPELOCK.bit.GPIO158 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO158 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO158 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO158 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM8 = 1;   // Switch on clock for the PWM8 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm8Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm8Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm8Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM8 is the master module
-    EPwm8Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm8Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm8Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm8Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm8Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm8Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm8Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm8Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm8Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm8Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm8Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm8Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm8Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm8Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm8Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm8Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm8Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm8Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm8Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 8A
-    GpioCtrlRegs.GPELOCK.bit.GPIO159 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO159 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO159 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO159 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 8B
-    GpioCtrlRegs.GPFLOCK.bit.GPIO160 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO160 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO160 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO160 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM9 = 1;   // Switch on clock for the PWM9 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm9Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm9Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm9Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM9 is the master module
-    EPwm9Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm9Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm9Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm9Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm9Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm9Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm9Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm9Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm9Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm9Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm9Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm9Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm9Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm9Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm9Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm9Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm9Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm9Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm9Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 9A
-    GpioCtrlRegs.GPFLOCK.bit.GPIO161 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO161 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO161 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO161 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 9B
-    GpioCtrlRegs.GPFLOCK.bit.GPIO162 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO162 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO162 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO162 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM10 = 1;   // Switch on clock for the PWM10 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm10Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm10Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm10Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM10 is the master module
-    EPwm10Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm10Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm10Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm10Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm10Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm10Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm10Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm10Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm10Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm10Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm10Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm10Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm10Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm10Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm10Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm10Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm10Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm10Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm10Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 10A
-    GpioCtrlRegs.GPFLOCK.bit.GPIO163 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO163 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO163 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO163 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 10B
-    GpioCtrlRegs.GPFLOCK.bit.GPIO164 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO164 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO164 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO164 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM11 = 1;   // Switch on clock for the PWM11 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm11Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm11Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm11Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM11 is the master module
-    EPwm11Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm11Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm11Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm11Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm11Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm11Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm11Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm11Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm11Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm11Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm11Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm11Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm11Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm11Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm11Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm11Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm11Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm11Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm11Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 11A
-    GpioCtrlRegs.GPFLOCK.bit.GPIO165 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO165 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO165 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO165 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 11B
-    GpioCtrlRegs.GPFLOCK.bit.GPIO166 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO166 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO166 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO166 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM12 = 1;   // Switch on clock for the PWM12 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm12Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm12Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm12Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM12 is the master module
-    EPwm12Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm12Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm12Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm12Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm12Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm12Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm12Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm12Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm12Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm12Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm12Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm12Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm12Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm12Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm12Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm12Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm12Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm12Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm12Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 12A
-    GpioCtrlRegs.GPFLOCK.bit.GPIO167 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO167 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO167 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO167 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 12B
-    GpioCtrlRegs.GPFLOCK.bit.GPIO168 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPFGMUX1.bit.GPIO168 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPFMUX1.bit.GPIO168 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPFPUD.bit.GPIO168 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM13 = 1;   // Switch on clock for the PWM13 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm13Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm13Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm13Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM13 is the master module
-    EPwm13Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm13Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm13Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm13Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm13Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm13Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm13Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm13Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm13Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm13Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm13Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm13Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm13Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm13Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm13Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm13Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm13Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm13Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm13Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 13A
-    GpioCtrlRegs.GPELOCK.bit.GPIO137 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO137 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO137 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO137 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 13B
-    GpioCtrlRegs.GPELOCK.bit.GPIO138 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO138 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO138 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO138 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM14 = 1;   // Switch on clock for the PWM14 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm14Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm14Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm14Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM14 is the master module
-    EPwm14Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm14Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm14Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm14Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm14Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm14Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm14Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm14Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm14Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm14Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm14Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm14Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm14Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm14Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm14Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm14Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm14Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm14Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm14Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 14A
-    GpioCtrlRegs.GPELOCK.bit.GPIO139 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO139 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO139 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO139 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 14B
-    GpioCtrlRegs.GPELOCK.bit.GPIO140 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO140 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO140 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO140 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM15 = 1;   // Switch on clock for the PWM15 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm15Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm15Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm15Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM15 is the master module
-    EPwm15Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm15Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm15Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm15Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm15Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm15Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm15Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm15Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm15Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm15Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm15Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm15Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm15Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm15Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm15Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm15Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm15Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm15Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm15Regs.TBCTR = 0;    // Set timer to 0
-    // ePWM 15A
-    GpioCtrlRegs.GPELOCK.bit.GPIO141 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO141 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO141 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO141 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 15B
-    GpioCtrlRegs.GPELOCK.bit.GPIO142 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO142 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO142 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO142 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    //=================================================================================================
-    CpuSysRegs.PCLKCR2.bit.EPWM16 = 1;   // Switch on clock for the PWM16 module and wait 5 clocks
-    __asm(" RPT #4 || NOP");  // Wait for 4 NOP cycles
-    EPwm16Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
-    EPwm16Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_14;
-    EPwm16Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization because ePWM16 is the master module
-    EPwm16Regs.TBPHS.bit.TBPHS = 0;    // No phase shift
-    EPwm16Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
-    EPwm16Regs.TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
-    EPwm16Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;    // Operating mode: count updown
-    EPwm16Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
-    EPwm16Regs.TBPRD = PWM_PERIOD;    // Set period
-    EPwm16Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm16Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm16Regs.CMPA.bit.CMPA = 0;    // Set duty cycle to 0
-    EPwm16Regs.AQCTLA.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm16Regs.AQCTLA.bit.CAU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm16Regs.CMPCTL.bit.SHDWBMODE = PWM_CC_IMMEDIATE;   // Only write to the compare register when the counter reaches the value 0
-    //EPwm16Regs.CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
-    EPwm16Regs.CMPB.bit.CMPB = 0;    // Set duty cycle to 0
-    EPwm16Regs.AQCTLB.bit.ZRO = PWM_AQ_SET;    // pin to high when TBCTR reaches the value CMP
-    EPwm16Regs.AQCTLB.bit.CBU = PWM_AQ_CLEAR;    // pin to low when TBCTR reaches the value CMP
-    EPwm16Regs.DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
-    EPwm16Regs.DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
-    EPwm16Regs.TBCTR = 0;    // Set timer to 0
-
-    // ePWM 16A
-    GpioCtrlRegs.GPELOCK.bit.GPIO143 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO143 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX1.bit.GPIO143 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO143 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-    // ePWM 16B
-    GpioCtrlRegs.GPELOCK.bit.GPIO144 = GPIO_CONFIG_UNLOCK;            // Unlock configuration
-    GpioCtrlRegs.GPEGMUX2.bit.GPIO144 = (GPIO_MULTIPLEX_EPWM >> 2);    // Set to PWM functionality
-    GpioCtrlRegs.GPEMUX2.bit.GPIO144 = (GPIO_MULTIPLEX_EPWM & 0x03);
-    GpioCtrlRegs.GPEPUD.bit.GPIO144 = GPIO_DISABLE_PULLUP;             // Disable pull-up resistor
-
-    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
-
-    EDIS; // Set register write protection
+
+    for (uint16_t i = 0; i < numberOfModules; i++)
+    {
+        const PwmConfig *config = &table[i];
+        volatile struct EPWM_REGS *regs = config->regs;
+
+        if (clockReferences[CLOCK_EPWM(config->module)] == 0)
+            ClockRequest(CLOCK_EPWM(config->module));   // Clock of the PWM module (switched on by ClockInit())
+
+        regs->TBCTL.bit.CLKDIV    = config->clkDiv;    // Set the clock divider of the PWM module - PWM-CLOCK = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
+        regs->TBCTL.bit.HSPCLKDIV = config->hspClkDiv;
+        regs->TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;   // No synchronization, every module is its own master
+        regs->TBPHS.bit.TBPHS = 0;    // No phase shift
+        regs->EPWMSYNCOUTEN.bit.ZEROEN = 1;   // Generate synchronization pulse (SYNCOUT) if timer = 0
+        regs->TBCTL2.bit.OSHTSYNCMODE = 0;    // Continuous synchronization mode
+        regs->TBCTL.bit.CTRMODE = config->ctrMode;    // Operating mode
+        regs->TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;   // Apply value that is written in TBPRD immediately
+        regs->TBPRD = PwmTablePeriod(config);    // Set period
+        regs->CMPCTL.bit.SHDWAMODE = PWM_CC_SHADOW;   // Write the compare value into the shadow register
+        regs->CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
+        regs->CMPA.bit.CMPA = 0;    // Set duty cycle to 0
+        regs->AQCTLA.bit.ZRO = config->aqZero;    // pin action when TBCTR reaches the value 0
+        regs->AQCTLA.bit.CAU = config->aqCompareUp;    // pin action when TBCTR reaches the value CMPA
+        regs->AQCTLA.bit.CAD = PwmInverseAction(config, config->aqCompareUp);    // up-down: back at CMPA counting down
+        regs->CMPCTL.bit.SHDWBMODE = PWM_CC_SHADOW;   // Write the compare value into the shadow register
+        regs->CMPCTL.bit.LOADBMODE = PWM_CC_SHDW_CTR_ZERO;
+        regs->CMPB.bit.CMPB = 0;    // Set duty cycle to 0
+        regs->GLDCFG.bit.CMPA_CMPAHR = 1;   // CMPA and CMPB are loaded by the global load
+        regs->GLDCFG.bit.CMPB_CMPBHR = 1;
+        regs->GLDCTL.bit.GLDMODE = PWM_GLD_CTR_ZERO;    // Load at TBCTR = 0 ...
+        regs->GLDCTL.bit.OSHTMODE = PWM_GLD_ONE_SHOT;    // ... but only once after GLDCTL2.OSHTLD is set
+        regs->GLDCTL.bit.GLD = 1;   // Global load replaces LOADAMODE/LOADBMODE
+        regs->EPWMXLINK.bit.GLDCTL2LINK = PWM_XLINK_EPWM1;    // Writes to GLDCTL2 of ePWM1 arm all modules
+        regs->AQCTLB.bit.ZRO = config->aqZero;    // pin action when TBCTR reaches the value 0
+        regs->AQCTLB.bit.CBU = config->aqCompareUp;    // pin action when TBCTR reaches the value CMPB
+        regs->AQCTLB.bit.CBD = PwmInverseAction(config, config->aqCompareUp);
+        regs->CMPCTL2.bit.SHDWCMODE = PWM_CC_SHADOW;   // CMPC (sampling point) is loaded with CMPA/CMPB
+        regs->GLDCFG.bit.CMPC = 1;
+        regs->DBCTL.bit.OUT_MODE = PWM_DB_BOTH_BYPASSED; // p.2898
+        regs->DBCTL.bit.OUTSWAP = PWM_DB_SWAP_NONE;
+        regs->TBCTR = 0;    // Set timer to 0
+#if PWM_HRPWM
+        // The MEP works on EPWMCLK, a divided TBCLK has no high-resolution edges
+        if (config->hrMode == PWM_HR_ENABLE
+            && config->clkDiv == PWM_CLK_DIV_1 && config->hspClkDiv == PWM_HSPCLKDIV_1)
+            PwmInitHr(regs, config->ctrMode);
+#endif
+
+        regs->ETSEL.bit.SOCAEN = config->socEnable;
+        regs->ETSEL.bit.SOCASEL = config->socSelect;
+        regs->ETPS.bit.SOCAPRD = config->socPeriod;
+    }
+
+    // ePWM xA and xB of all modules (GpioSetPeripheral() ends with EDIS)
+    for (uint16_t i = 0; i < numberOfModules; i++)
+    {
+        GpioSetPeripheral(table[i].pinA, GPIO_MULTIPLEX_EPWM, GPIO_DISABLE_PULLUP);
+        GpioSetPeripheral(table[i].pinB, GPIO_MULTIPLEX_EPWM, GPIO_DISABLE_PULLUP);
+    }
+
+    PwmDutyCommit();    // Load the initial compare values at the first TBCTR = 0
+
+    EALLOW;
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;   // Start the time base clocks of all modules together
+    EDIS;
+}
+
+//=== Function: PwmDutyStage ======================================================================
+///
+/// @brief  Function writes new compare values into the shadow registers of one ePWM module.
+///         The active values do not change until PwmDutyCommit() is called, so a module never
+///         runs a period with the new CMPA and the old CMPB
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t cmpa, uint16_t cmpb
+///
+/// @return void
+///
+//=================================================================================================
+void PwmDutyStage(volatile struct EPWM_REGS *regs, uint16_t cmpa, uint16_t cmpb)
+{
+    regs->CMPA.bit.CMPA = cmpa;
+    regs->CMPB.bit.CMPB = cmpb;
+}
+
+//=== Function: PwmDutyCommit =====================================================================
+///
+/// @brief  Function arms the one-shot global load. The write to GLDCTL2 of ePWM1 is linked to
+///         all modules, so every module loads its staged CMPA/CMPB at its next TBCTR = 0.
+///         Modules with a common time base switch at the same counter-zero event. Values staged
+///         again before that event replace the previous ones
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PwmDutyCommit(void)
+{
+    PwmSampleTrack();
+    EPwm1Regs.GLDCTL2.bit.OSHTLD = 1;
+}
+
+//=== Function: PwmGetPeriodUs ====================================================================
+///
+/// @brief  Function returns the length of one period of a module from the actual settings:
+///         2 * TBPRD counts in up-down mode, TBPRD + 1 counts otherwise, at TBCLK
+///         (PwmTbClockMHz())
+///
+/// @param  volatile struct EPWM_REGS *regs
+///
+/// @return float32 periodUs
+///
+//=================================================================================================
+float32 PwmGetPeriodUs(volatile struct EPWM_REGS *regs)
+{
+    float32 counts = (float32)regs->TBPRD;
+
+    if (regs->TBCTL.bit.CTRMODE == PWM_TB_COUNT_UPDOWN)
+        counts *= 2.0f;
+    else
+        counts += 1.0f;
+
+    return counts / PwmTbClockMHz(regs);
+}
+
+//=== Function: PwmInitSamplePoint ================================================================
+///
+/// @brief  Function places the SOCA of a center-aligned module into the middle of the period
+///         part without switching edges. The edges of output A and B are at CMPA and CMPB
+///         counting up and down, so TBCTR = TBPRD and TBCTR = 0 are the points furthest away
+///         from them. The SOC is started half a sampling window before that point
+///         (CMPC = TBPRD - offset counting up or CMPC = offset counting down), so the middle of
+///         the window lies on it. The window is given in SYSCLK cycles, e.g. the acquisition
+///         and conversion time of all SOCs of the module with the most SOCs. PwmDutyCommit()
+///         keeps the point in the longer quiet part when the duty cycles change
+///         (PwmSampleTrack())
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t windowSysclk
+///
+/// @return bool initialised (false: module does not count up-down)
+///
+//=================================================================================================
+bool PwmInitSamplePoint(volatile struct EPWM_REGS *regs, uint16_t windowSysclk)
+{
+    float32 offset = (float32)windowSysclk * PwmTbClockMHz(regs) / (float32)DEVICE_SYSCLK_MHZ / 2.0f;
+
+    if (regs->TBCTL.bit.CTRMODE != PWM_TB_COUNT_UPDOWN)
+        return false;
+
+    pwmSampleOffset = (uint16_t)offset + 1;    // rounded up, at least 1 (CMPC = TBPRD is no up match)
+    if (pwmSampleOffset >= regs->TBPRD)
+        pwmSampleOffset = regs->TBPRD - 1;
+    pwmSampleCentre = PWM_SAMPLE_UNDEFINED;    // the first PwmSampleTrack() writes CMPC and SOCASEL
+    pwmSampleRegs = regs;
+
+    regs->ETSEL.bit.SOCASELCMP = PWM_ET_SEL_CMPC_CMPD;
+    PwmSampleTrack();
+    PwmDutyCommit();
+
+    return true;
 }
 
+//=== Function: PwmSampleTrack ====================================================================
+///
+/// @brief  Function moves the sampling point to TBCTR = TBPRD or TBCTR = 0, whichever has the
+///         longer distance to the staged CMPA/CMPB. The side only changes if the other one is
+///         longer by PWM_SAMPLE_HYSTERESIS TBCLK, so a duty cycle near 50 % does not toggle it.
+///         CMPC is loaded with the next global load, SOCASEL changes at once, so the period of
+///         a change can have one SOC more or less
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PwmSampleTrack(void)
+{
+    volatile struct EPWM_REGS *regs = pwmSampleRegs;
+    uint16_t period;
+    uint16_t cmpa;
+    uint16_t cmpb;
+    uint16_t quietPrd;
+    uint16_t quietZero;
+    uint16_t centre = pwmSampleCentre;
+
+    if (regs == 0)
+        return;
+
+    period = regs->TBPRD;
+    cmpa = regs->CMPA.bit.CMPA;    // shadow registers: the staged values
+    cmpb = regs->CMPB.bit.CMPB;
+    quietPrd = period - ((cmpa > cmpb) ? cmpa : cmpb);
+    quietZero = (cmpa < cmpb) ? cmpa : cmpb;
+
+    if (quietZero > quietPrd + PWM_SAMPLE_HYSTERESIS)
+        centre = PWM_SAMPLE_AT_ZERO;
+    else if (quietPrd > quietZero + PWM_SAMPLE_HYSTERESIS || centre == PWM_SAMPLE_UNDEFINED)
+        centre = PWM_SAMPLE_AT_PRD;
+
+    if (centre == pwmSampleCentre)
+        return;
+
+    pwmSampleCentre = centre;
+    if (centre == PWM_SAMPLE_AT_ZERO)
+    {
+        regs->CMPC = pwmSampleOffset;
+        regs->ETSEL.bit.SOCASEL = PWM_ET_CTRD_CMPC;
+    }
+    else
+    {
+        regs->CMPC = period - pwmSampleOffset;
+        regs->ETSEL.bit.SOCASEL = PWM_ET_CTRU_CMPC;
+    }
+}
+
+#if PWM_HRPWM
+//=== Function: PwmHrCalibrate ====================================================================
+///
+/// @brief  Function switches on the HRPWM calibration logic and runs SFO() until the MEP scale
+///         factor has been measured (takes a few ms). The result is written into HRMSTEP of
+///         ePWM1, which is used by AUTOCONV of all modules
+///
+/// @param  void
+///
+/// @return bool calibrated (false: more than 255 MEP steps per TBCLK, SFO_ERROR)
+///
+//=================================================================================================
+bool PwmHrCalibrate(void)
+{
+    EALLOW;
+    if (clockReferences[CLOCK_HRCAL] == 0)
+        ClockRequest(CLOCK_HRCAL);   // Clock of the HRPWM calibration logic, kept for PwmHrCalibrationService()
+    EDIS;
+
+    do
+    {
+        pwmHrStatus = SFO();
+    } while (pwmHrStatus == SFO_INCOMPLETE);
+
+    if (pwmHrStatus == SFO_ERROR)
+        return false;
+
+    pwmHrCalibrations++;
+    return true;
+}
+
+//=== Function: PwmHrCalibrationService ===========================================================
+///
+/// @brief  Function runs one step of the MEP calibration. The MEP step size drifts with the
+///         temperature and the supply voltage, so the scale factor is measured again and again.
+///         SFO() returns at once, a new HRMSTEP is written when a measurement has finished
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PwmHrCalibrationService(void)
+{
+    pwmHrStatus = SFO();
+
+    if (pwmHrStatus == SFO_COMPLETE)
+        pwmHrCalibrations++;
+}
+
+//=== Function: PwmHrDutyStage ====================================================================
+///
+/// @brief  Function writes fractional compare values into the shadow registers of one ePWM
+///         module (CMPA:CMPAHR and CMPB:CMPBHR, applied by PwmDutyCommit()). The values are
+///         given in TBCLK * 2^PWM_HR_FRACTION_BITS, e.g. 250.5 TBCLK = 64128. The MEP needs
+///         at least 3 TBCLK of high time, below that the edge has TBCLK resolution
+///
+/// @param  volatile struct EPWM_REGS *regs, uint32_t cmpa, uint32_t cmpb
+///
+/// @return void
+///
+//=================================================================================================
+void PwmHrDutyStage(volatile struct EPWM_REGS *regs, uint32_t cmpa, uint32_t cmpb)
+{
+    // CMPA/CMPB are the upper word, CMPAHR/CMPBHR the upper byte of the lower word
+    regs->CMPA.all = cmpa << (16 - PWM_HR_FRACTION_BITS);
+    regs->CMPB.all = cmpb << (16 - PWM_HR_FRACTION_BITS);
+}
+
+//=== Function: PwmHrSetPeriod ====================================================================
+///
+/// @brief  Function sets the fractional period TBPRD:TBPRDHR of one ePWM module in
+///         TBCLK * 2^PWM_HR_FRACTION_BITS. Both values are loaded from the shadow registers
+///         at the next TBCTR = 0
+///
+/// @param  volatile struct EPWM_REGS *regs, uint32_t period
+///
+/// @return void
+///
+//=================================================================================================
+void PwmHrSetPeriod(volatile struct EPWM_REGS *regs, uint32_t period)
+{
+    regs->TBPRDHR = (uint16_t)(period << (16 - PWM_HR_FRACTION_BITS));
+    regs->TBPRD = (uint16_t)(period >> PWM_HR_FRACTION_BITS);
+}
+#endif
+
+//=== Function: PwmInitLeg ========================================================================
+///
+/// @brief  Function configures an initialised ePWM module as half-bridge leg. Output A is
+///         the source of both dead band edges, B is the inverted A (active high complementary).
+///         The dead band counter runs in the half cycle mode, with HRPWM the MEP also places
+///         the dead band edges. New dead times are loaded at TBCTR = 0
+///
+/// @param  const PwmLegConfig *leg
+///
+/// @return bool configured (false: dead time longer than PWM_DB_MAX_COUNT)
+///
+//=================================================================================================
+bool PwmInitLeg(const PwmLegConfig *leg)
+{
+    volatile struct EPWM_REGS *regs = leg->regs;
+
+    EALLOW;
+    regs->DBCTL.bit.HALFCYCLE = PWM_DB_HALF_CYCLE;  // Counter clock 2 * TBCLK
+    regs->DBCTL.bit.IN_MODE = PWM_DB_IN_A_ALL;  // Rising and falling edge delay of A
+    regs->DBCTL.bit.POLSEL = PWM_DB_POL_B_INV;  // B = inverted A
+    regs->DBCTL.bit.OUT_MODE = PWM_DB_NONE_BYPASSED;
+    regs->DBCTL.bit.OUTSWAP = leg->swap;
+    regs->DBCTL.bit.SHDWDBREDMODE = 1;  // Write DBRED/DBFED into the shadow registers
+    regs->DBCTL.bit.LOADREDMODE = PWM_DB_SHDW_CTR_ZERO;
+    regs->DBCTL.bit.SHDWDBFEDMODE = 1;
+    regs->DBCTL.bit.LOADFEDMODE = PWM_DB_SHDW_CTR_ZERO;
+#if PWM_HRPWM
+    if (regs->HRCNFG.bit.AUTOCONV == 1)
+    {
+        regs->HRCNFG2.bit.EDGMODEDB = PWM_DB_HR_BOTH_EDGES;   // MEP on RED and FED
+        regs->HRCNFG2.bit.CTLMODEDBRED = PWM_DB_SHDW_CTR_ZERO;
+        regs->HRCNFG2.bit.CTLMODEDBFED = PWM_DB_SHDW_CTR_ZERO;
+    }
+#endif
+    EDIS;
+
+    return PwmSetDeadTime(regs, leg->risingNs, leg->fallingNs);
+}
+
+//=== Function: PwmSetDeadTime ====================================================================
+///
+/// @brief  Function sets the rising and falling edge dead time of a half-bridge leg in ns.
+///         The counts are computed from the actual TBCLK and rounded up. Modules with HRPWM
+///         also get the fraction (DBREDHR/DBFEDHR), otherwise the resolution is one counter
+///         clock (5 ns with TBCLK = 100 MHz). The values are loaded at the next TBCTR = 0
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t risingNs, uint16_t fallingNs
+///
+/// @return bool set (false: dead time longer than PWM_DB_MAX_COUNT, nothing changed)
+///
+//=================================================================================================
+bool PwmSetDeadTime(volatile struct EPWM_REGS *regs, uint16_t risingNs, uint16_t fallingNs)
+{
+    float32 clockMHz = PwmDeadBandClockMHz(regs);
+    uint16_t fractionBits = 0;
+    uint32_t red;
+    uint32_t fed;
+
+#if PWM_HRPWM
+    if (regs->HRCNFG.bit.AUTOCONV == 1)
+        fractionBits = PWM_DB_HR_FRACTION_BITS;
+#endif
+
+    red = PwmNsToCounts(risingNs, clockMHz, fractionBits);
+    fed = PwmNsToCounts(fallingNs, clockMHz, fractionBits);
+    if ((red >> fractionBits) > PWM_DB_MAX_COUNT || (fed >> fractionBits) > PWM_DB_MAX_COUNT)
+        return false;
+
+    regs->DBRED.bit.DBRED = (uint16_t)(red >> fractionBits);
+    regs->DBFED.bit.DBFED = (uint16_t)(fed >> fractionBits);
+#if PWM_HRPWM
+    if (fractionBits > 0)
+    {
+        regs->DBREDHR.bit.DBREDHR = (uint16_t)(red & ((1U << PWM_DB_HR_FRACTION_BITS) - 1));
+        regs->DBFEDHR.bit.DBFEDHR = (uint16_t)(fed & ((1U << PWM_DB_HR_FRACTION_BITS) - 1));
+    }
+#endif
+
+    return true;
+}
+
+//=== Function: PwmInitInterleaved ================================================================
+///
+/// @brief  Function initialises the first numberOfPhases modules of a table as one group of
+///         interleaved phases. table[0] is the master, the SYNCIN of every other module is the
+///         SYNCOUT (TBCTR = 0) of the master. The SYNCOUTs are not chained, so the delay of the
+///         sync pulse is the same for all phases. Phase i is delayed by i/N of the period.
+///         All modules must count up with the same period and clock dividers
+///
+/// @param  const PwmConfig *table, uint16_t numberOfPhases
+///
+/// @return bool initialised (false: invalid number of phases or table)
+///
+//=================================================================================================
+bool PwmInitInterleaved(const PwmConfig *table, uint16_t numberOfPhases)
+{
+    if (numberOfPhases < 2 || numberOfPhases > PWM_INTERLEAVE_MAX_PHASES)
+        return false;
+
+    for (uint16_t i = 0; i < numberOfPhases; i++)
+    {
+        if (table[i].ctrMode != PWM_TB_COUNT_UP
+            || table[i].period != table[0].period
+            || table[i].clkDiv != table[0].clkDiv
+            || table[i].hspClkDiv != table[0].hspClkDiv)
+            return false;
+    }
+
+    PwmInitFromTable(table, numberOfPhases);
+
+    pwmInterleavePhases = numberOfPhases;
+    pwmInterleaveCycle = PwmTablePeriod(&table[0]) + 1;   // Up-count: TBPRD + 1 TBCLK per period
+
+    EALLOW;
+    for (uint16_t i = 0; i < numberOfPhases; i++)
+    {
+        volatile struct EPWM_REGS *regs = table[i].regs;
+
+        pwmInterleaveRegs[i] = regs;
+        pwmPhaseTarget[i] = (uint16_t)((uint32_t)i * pwmInterleaveCycle / numberOfPhases);
+        pwmPhaseActual[i] = pwmPhaseTarget[i];
+
+        if (i == 0)
+            continue;   // The master keeps running without synchronization
+
+        regs->EPWMSYNCINSEL.bit.SEL = table[0].module;   // PWM_TB_SYNCIN_EPWMx_SYNCOUT = x
+        regs->TBPHS.bit.TBPHS = PwmPhaseToTbphs(pwmPhaseActual[i]);
+        regs->TBCTL.bit.PHSEN = PWM_TB_PHSEN_ENABLE;   // Load TBPHS at every sync pulse
+        regs->TBSTS.bit.SYNCI = 1;    // Clear the sync flag used by PwmPhaseService()
+    }
+    EDIS;
+
+    return true;
+}
+
+//=== Function: PwmSetPhase =======================================================================
+///
+/// @brief  Function sets the target phase delay of one module of the interleaved group. The
+///         phase is moved by PwmPhaseService() in steps of PWM_PHASE_MAX_STEP per period
+///
+/// @param  uint16_t phase (1..numberOfPhases - 1), uint16_t delay (TBCLK, 0..TBPRD)
+///
+/// @return bool accepted
+///
+//=================================================================================================
+bool PwmSetPhase(uint16_t phase, uint16_t delay)
+{
+    if (phase == 0 || phase >= pwmInterleavePhases || delay >= pwmInterleaveCycle)
+        return false;
+
+    pwmPhaseTarget[phase] = delay;
+    return true;
+}
+
+//=== Function: PwmPhaseService ===================================================================
+///
+/// @brief  Function moves the phase of every module of the interleaved group by at most
+///         PWM_PHASE_MAX_STEP TBCLK towards its target, the shorter way around the period.
+///         A new TBPHS is only written after the previous one has been loaded by a sync pulse
+///         (TBSTS.SYNCI), so the counter of a slave jumps at most PWM_PHASE_MAX_STEP TBCLK per
+///         period. Only the period with the jump is longer or shorter by the step, a compare
+///         match is only skipped if CMPA/CMPB lies within the step. Can be called as often as
+///         needed
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PwmPhaseService(void)
+{
+    for (uint16_t i = 1; i < pwmInterleavePhases; i++)
+    {
+        volatile struct EPWM_REGS *regs = pwmInterleaveRegs[i];
+        uint16_t forward;
+        uint16_t step;
+
+        if (pwmPhaseActual[i] == pwmPhaseTarget[i] || regs->TBSTS.bit.SYNCI == 0)
+            continue;
+
+        // Distance to the target with increasing delay (modulo one period)
+        forward = (pwmPhaseTarget[i] >= pwmPhaseActual[i])
+                ? pwmPhaseTarget[i] - pwmPhaseActual[i]
+                : pwmInterleaveCycle - pwmPhaseActual[i] + pwmPhaseTarget[i];
+
+        if (forward <= pwmInterleaveCycle - forward)
+        {
+            step = (forward > PWM_PHASE_MAX_STEP) ? PWM_PHASE_MAX_STEP : forward;
+            pwmPhaseActual[i] += step;
+            if (pwmPhaseActual[i] >= pwmInterleaveCycle)
+                pwmPhaseActual[i] -= pwmInterleaveCycle;
+        }
+        else
+        {
+            step = pwmInterleaveCycle - forward;
+            if (step > PWM_PHASE_MAX_STEP)
+                step = PWM_PHASE_MAX_STEP;
+            pwmPhaseActual[i] = (pwmPhaseActual[i] >= step)
+                              ? pwmPhaseActual[i] - step
+                              : pwmPhaseActual[i] + pwmInterleaveCycle - step;
+        }
+
+        // TBPHS first: a sync pulse between both writes already loads the new value
+        regs->TBPHS.bit.TBPHS = PwmPhaseToTbphs(pwmPhaseActual[i]);
+        regs->TBSTS.bit.SYNCI = 1;
+    }
+}
+
+//=== Function: PwmInitAll =====================================================================
+///
+/// @brief  functions to configure all PWM modules. With PWM_HRPWM the MEP is calibrated
+///         afterwards (HRMSTEP belongs to ePWM1, whose clock is switched on by the table)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PwmInitAll(void)
+{
+    PwmInitFromTable(pwmConfigTable, PWM_NUMBER_OF_MODULES);
+#if PWM_HRPWM
+    PwmHrCalibrate();   // Result in pwmHrStatus, all fractions are 0 until then
+#endif
+}
@@ -16,6 +16,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_Device.h"
+#include "TB_Clock.h"
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
@@ -219,12 +220,69 @@ extern uint16_t A2,A3,A4,A5,B0,B2,B3,B4,B5,C2,C3,C4,C5,D0,D1,D2,D3,D4,D5,IN14,IN
 // Periodendauer fr 16 kHz Schaltfrequenz
 // f_sw = (SYSCLK / EPWMCLK) * 1 / (CLKDIV * HSPCLKDIV) * 1 / (2 * PWM_PERIOD)
 // Faktor 2 weil Auf-/Abzhlmodus gesetzt ist
+// PwmInitFromTable(): TBCLK per period (5 us at TBCLK = 100 MHz), up-down modules use
+// TBPRD = PWM_PERIOD / 2
 #define PWM_PERIOD                                                  500
 // Kompensation der Synchronisationsverzgerung von ePWM2 und ePWM3
 // (siehe hirzu Initialisierungsfunktion PwmInitPwm123())
 // 1: CLKDIV > 1 oder HSPCLKDIV > 1
 // 2: CLKDIV = 1 und  HSPCLKDIV = 1
 #define PWM_SYNCHRONIZAION_DELAY                        2
+// Number of ePWM modules of the CTB (ePWM1 to ePWM16)
+#define PWM_NUMBER_OF_MODULES                           16
+// Global load event (GLDCTL.GLDMODE)
+#define PWM_GLD_CTR_ZERO                                    0
+#define PWM_GLD_CTR_PRD                                     1
+#define PWM_GLD_CTR_ZERO_PRD                                2
+// One-shot global load (GLDCTL.OSHTMODE)
+#define PWM_GLD_CONTINUOUS                                  0
+#define PWM_GLD_ONE_SHOT                                    1
+// Module whose GLDCTL2 writes are linked to all other modules (EPWMXLINK.GLDCTL2LINK, ePWM1)
+#define PWM_XLINK_EPWM1                                     0
+// High-resolution PWM (HRPWM)
+// 1: modules with hrMode = PWM_HR_ENABLE place the edges of CMPA, CMPB and TBPRD with the
+//    micro edge positioner (MEP), about 150 ps instead of 10 ns. Needs the SFO library of
+//    C2000Ware (SFO_v8_fpu_lib_build_c28.lib, see C2000WARE_SFO_* in the project settings)
+// 0: plain TBCLK resolution, hrMode is ignored
+#define PWM_HRPWM                                           1
+// HRPWM of one module (PwmConfig.hrMode), only possible with CLKDIV = 1 and HSPCLKDIV = 1
+#define PWM_HR_DISABLE                                      0
+#define PWM_HR_ENABLE                                       1
+// Edge controlled by the MEP (HRCNFG.EDGMODE)
+#define PWM_HR_EDGE_RISING                                  1
+#define PWM_HR_EDGE_FALLING                                 2
+#define PWM_HR_EDGE_BOTH                                    3
+// The MEP is controlled by CMPAHR/CMPBHR (HRCNFG.CTLMODE)
+#define PWM_HR_CTL_COMPARE                                  0
+// Load of CMPAHR/CMPBHR (HRCNFG.HRLOAD)
+#define PWM_HR_LOAD_CTR_ZERO                                0
+// Fractional bits of the high-resolution values (CMPAHR, CMPBHR, TBPRDHR), one TBCLK = 256
+#define PWM_HR_FRACTION_BITS                                8
+// Dead band counter is 14 bit (DBRED/DBFED), high-resolution dead band has 7 fractional bits
+// (DBREDHR/DBFEDHR, needs PWM_HRPWM and the half cycle clock)
+#define PWM_DB_MAX_COUNT                                    0x3FFF
+#define PWM_DB_HR_FRACTION_BITS                             7
+// Dead band load of the shadow registers (DBCTL.LOADREDMODE/LOADFEDMODE)
+#define PWM_DB_SHDW_CTR_ZERO                                0
+// MEP on the rising and falling dead band edge (HRCNFG2.EDGMODEDB)
+#define PWM_DB_HR_BOTH_EDGES                                3
+// Maximum number of phases of an interleaved group (PwmInitInterleaved())
+#define PWM_INTERLEAVE_MAX_PHASES                           PWM_NUMBER_OF_MODULES
+// Maximum change of the phase of one module per PWM period in TBCLK (PwmPhaseService()).
+// A larger jump of the counter at the sync event could skip the CMPA/CMPB match
+#define PWM_PHASE_MAX_STEP                                  4
+// SOCA at CMPC/CMPD instead of CMPA/CMPB (ETSEL.SOCASELCMP), with it PWM_ET_CTRU_CMPA and
+// PWM_ET_CTRD_CMPA select CMPC
+#define PWM_ET_SEL_CMPA_CMPB                                0
+#define PWM_ET_SEL_CMPC_CMPD                                1
+#define PWM_ET_CTRU_CMPC                                    4
+#define PWM_ET_CTRD_CMPC                                    5
+// Centre of the sampling window of PwmInitSamplePoint()
+#define PWM_SAMPLE_AT_PRD                                   0
+#define PWM_SAMPLE_AT_ZERO                                  1
+#define PWM_SAMPLE_UNDEFINED                                0xFFFF
+// Difference of the quiet parts in TBCLK before the sampling point changes sides
+#define PWM_SAMPLE_HYSTERESIS                               8
 
 
 //-------------------------------------------------------------------------------------------------
@@ -232,9 +290,63 @@ extern uint16_t A2,A3,A4,A5,B0,B2,B3,B4,B5,C2,C3,C4,C5,D0,D1,D2,D3,D4,D5,IN14,IN
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Configuration of one ePWM module, used by PwmInitFromTable()
+typedef struct
+{
+    volatile struct EPWM_REGS *regs;    // register set of the module
+    uint16_t module;                    // 1..16, clock enable bit in PCLKCR2
+    uint16_t clkDiv;                    // PWM_CLK_DIV_x
+    uint16_t hspClkDiv;                 // PWM_HSPCLKDIV_x
+    uint16_t ctrMode;                   // PWM_TB_COUNT_x
+    uint16_t period;                    // TBCLK per PWM period (TBPRD, up-down: 2 * TBPRD)
+    uint16_t aqZero;                    // action of output A and B at TBCTR = 0
+    uint16_t aqCompareUp;               // action of output A at CMPA and of B at CMPB (count up,
+                                        // up-down: the inverse action counting down)
+    uint16_t socEnable;                 // PWM_ET_SOC_ENABLE: SOCA for the ADCs
+    uint16_t socSelect;                 // PWM_ET_x, event of SOCA
+    uint16_t socPeriod;                 // PWM_ET_xTH, number of events per SOCA
+    uint16_t pinA;                      // GPIO of output A
+    uint16_t pinB;                      // GPIO of output B
+    uint16_t hrMode;                    // PWM_HR_ENABLE: MEP for CMPA, CMPB and TBPRD
+} PwmConfig;
+
+// Half-bridge leg: output A drives the high side, output B the complementary low side
+typedef struct
+{
+    volatile struct EPWM_REGS *regs;    // register set of the module
+    uint16_t risingNs;                  // dead time before A switches on in ns (RED)
+    uint16_t fallingNs;                 // dead time before B switches on in ns (FED)
+    uint16_t swap;                      // PWM_DB_SWAP_x, e.g. for a swapped gate driver
+} PwmLegConfig;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Configuration of ePWM1 to ePWM16 (PWM_LEDs), used by PwmInitAll()
+extern const PwmConfig pwmConfigTable[PWM_NUMBER_OF_MODULES];
+// Period of the table entries with PWM_PERIOD (PARAM_PWM_PERIOD, TB_Params.h)
+extern uint16_t pwmPeriod;
+#if PWM_HRPWM
+// Result of the last MEP calibration (SFO_INCOMPLETE, SFO_COMPLETE, SFO_ERROR) and number of
+// completed calibrations
+extern int pwmHrStatus;
+extern uint32_t pwmHrCalibrations;
+#endif
+// Interleaved group: modules, number of phases, length of one period in TBCLK
+// and target/current phase delay of each module relative to the master in TBCLK
+extern volatile struct EPWM_REGS *pwmInterleaveRegs[PWM_INTERLEAVE_MAX_PHASES];
+extern uint16_t pwmInterleavePhases;
+extern uint16_t pwmInterleaveCycle;
+extern uint16_t pwmPhaseTarget[PWM_INTERLEAVE_MAX_PHASES];
+extern uint16_t pwmPhaseActual[PWM_INTERLEAVE_MAX_PHASES];
+// Sampling point: module, TBCLK from the SOC to the middle of the window, current centre
+extern volatile struct EPWM_REGS *pwmSampleRegs;
+extern uint16_t pwmSampleOffset;
+extern uint16_t pwmSampleCentre;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -244,6 +356,38 @@ extern uint16_t A2,A3,A4,A5,B0,B2,B3,B4,B5,C2,C3,C4,C5,D0,D1,D2,D3,D4,D5,IN14,IN
 // eines 3-phasigen Wechselrichter anzusteuern. Das ePWM1-Modul ist dabei der
 // Master und synchronisiert die anderen zwei Halbbrcken mit sich
 extern void PwmInitAll(void);
+// Function initialises the ePWM modules of a configuration table
+extern void PwmInitFromTable(const PwmConfig *table, uint16_t numberOfModules);
+// Function stages new compare values of one ePWM module (applied by PwmDutyCommit())
+extern void PwmDutyStage(volatile struct EPWM_REGS *regs, uint16_t cmpa, uint16_t cmpb);
+// Function applies the staged compare values of all modules at their next counter zero
+extern void PwmDutyCommit(void);
+// Function returns the length of one period of a module in us (actual clock dividers and TBPRD)
+extern float32 PwmGetPeriodUs(volatile struct EPWM_REGS *regs);
+// Function places the SOCA of a center-aligned module in the middle of the quiet part of the period
+extern bool PwmInitSamplePoint(volatile struct EPWM_REGS *regs, uint16_t windowSysclk);
+// Function keeps the sampling point in the longer quiet part (called by PwmDutyCommit())
+extern void PwmSampleTrack(void);
+#if PWM_HRPWM
+// Function measures the MEP scale factor once, returns false if the MEP can not be calibrated
+extern bool PwmHrCalibrate(void);
+// Function continues the MEP calibration in the background (call from the main loop)
+extern void PwmHrCalibrationService(void);
+// Function stages fractional compare values (TBCLK * 2^PWM_HR_FRACTION_BITS) of one module
+extern void PwmHrDutyStage(volatile struct EPWM_REGS *regs, uint32_t cmpa, uint32_t cmpb);
+// Function sets the fractional period (TBCLK * 2^PWM_HR_FRACTION_BITS) of one module
+extern void PwmHrSetPeriod(volatile struct EPWM_REGS *regs, uint32_t period);
+#endif
+// Function configures one ePWM module as half-bridge leg with complementary outputs
+extern bool PwmInitLeg(const PwmLegConfig *leg);
+// Function sets the dead times of a half-bridge leg in ns (applied at the next counter zero)
+extern bool PwmSetDeadTime(volatile struct EPWM_REGS *regs, uint16_t risingNs, uint16_t fallingNs);
+// Function initialises the modules of a table as one group of N interleaved phases
+extern bool PwmInitInterleaved(const PwmConfig *table, uint16_t numberOfPhases);
+// Function sets the target phase delay of one module of the interleaved group
+extern bool PwmSetPhase(uint16_t phase, uint16_t delay);
+// Function moves the phases of the interleaved group towards their targets (call periodically)
+extern void PwmPhaseService(void);
 
 #endif
 
@@ -0,0 +1,488 @@
+//=================================================================================================
+/// @file     TB_Params.c
+///
+/// @brief    File contains a persistent parameter store in two flash sectors which are used as a
+///           log. The global variables of the parameters are the RAM mirror of the store.
+///           See TB_Params.h for the layout of the sectors and the protocol
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Params.h"
+#include "TB_Functions.h"
+#include "TB_PWM.h"
+#include "TB_Log.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Bank 0 cannot be read while the FSM erases or programs it, the functions which start an
+// operation and wait for its end run from LSx RAM like the Flash API and disable the
+// interrupts in this time (the ISRs and their .const data may be in the flash)
+#pragma CODE_SECTION(ParamFsmWait, ".TI.ramfunc");
+#pragma CODE_SECTION(ParamProgram, ".TI.ramfunc");
+#pragma CODE_SECTION(ParamErase, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+const ParamDefinition paramTable[PARAM_NUMBER_OF_IDS] =
+{
+    // variable             type                default           minimum           maximum
+    {&Repeat_count,         PARAM_TYPE_UINT16,  3.0f,             1.0f,             100.0f},
+    {&ADC_error_buffer,     PARAM_TYPE_FLOAT32, 0.96f,            0.5f,             1.0f},
+    {&adcSweepMode,         PARAM_TYPE_UINT16,  ADC_SWEEP_SPARSE, ADC_SWEEP_SPARSE, ADC_SWEEP_FULL},
+    {&pwmPeriod,            PARAM_TYPE_UINT16,  PWM_PERIOD,       10.0f,            65534.0f},
+    {&gpioLedCheckMode,     PARAM_TYPE_UINT16,  GPIO_LED_CHECK_VISUAL, GPIO_LED_CHECK_VISUAL, GPIO_LED_CHECK_LOOPBACK}
+};
+volatile ParamRequest paramRequest;
+uint16_t paramActiveSector = 0xFFFF;
+uint32_t paramGeneration = 0;
+uint16_t paramUsedRecords = 0;
+uint16_t paramFlashErrors = 0;
+// Start addresses of the sectors
+static const uint32_t paramSectorAddress[PARAM_NUMBER_OF_SECTORS] =
+{
+    PARAM_SECTOR0_ADDRESS, PARAM_SECTOR1_ADDRESS
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ParamFsmWait ======================================================================
+///
+/// @brief  Function waits until the FSM has finished the last operation and returns true if the
+///         operation was successful
+///
+/// @param  void
+///
+/// @return bool success
+///
+//=================================================================================================
+static bool ParamFsmWait(void)
+{
+    while (Fapi_checkFsmForReady() == Fapi_Status_FsmBusy)
+        ;
+    return Fapi_getFsmStatus() == 0;
+}
+
+//=== Function: ParamProgram ======================================================================
+///
+/// @brief  Function programs 8 words (128 bit, the FSM generates the ECC) and waits for the end
+///         with disabled interrupts, the address must be aligned to 8 words
+///
+/// @param  uint32_t address, uint16_t *data
+///
+/// @return bool success
+///
+//=================================================================================================
+static bool ParamProgram(uint32_t address, uint16_t *data)
+{
+    Fapi_StatusType status;
+    bool success;
+    uint16_t interruptState = __disable_interrupts();
+
+    EALLOW;
+    status = Fapi_issueProgrammingCommand((uint32 *)address, data, PARAM_RECORD_WORDS,
+                                          0, 0, Fapi_AutoEccGeneration);
+    EDIS;
+    success = (status == Fapi_Status_Success) && ParamFsmWait();
+    __restore_interrupts(interruptState);
+    if (!success)
+    {
+        paramFlashErrors++;
+    }
+    return success;
+}
+
+//=== Function: ParamErase ========================================================================
+///
+/// @brief  Function erases a sector and waits for the end with disabled interrupts
+///
+/// @param  uint32_t address
+///
+/// @return bool success
+///
+//=================================================================================================
+static bool ParamErase(uint32_t address)
+{
+    Fapi_StatusType status;
+    bool success;
+    uint16_t interruptState = __disable_interrupts();
+
+    EALLOW;
+    status = Fapi_issueAsyncCommandWithAddress(Fapi_EraseSector, (uint32 *)address);
+    EDIS;
+    success = (status == Fapi_Status_Success) && ParamFsmWait();
+    __restore_interrupts(interruptState);
+    if (!success)
+    {
+        paramFlashErrors++;
+    }
+    return success;
+}
+
+//=== Function: ParamToBits =======================================================================
+///
+/// @brief  Function converts a value into the bit pattern of the variable of a parameter
+///
+/// @param  uint16_t id, float32 value
+///
+/// @return uint32_t bits
+///
+//=================================================================================================
+static uint32_t ParamToBits(uint16_t id, float32 value)
+{
+    union { float32 f; uint32_t u; } bits;
+
+    if (paramTable[id].type == PARAM_TYPE_UINT16)
+        return (uint16_t)value;
+    bits.f = value;
+    return bits.u;
+}
+
+//=== Function: ParamFromBits =====================================================================
+///
+/// @brief  Function converts the bit pattern of a parameter into its value
+///
+/// @param  uint16_t id, uint32_t bits
+///
+/// @return float32 value
+///
+//=================================================================================================
+static float32 ParamFromBits(uint16_t id, uint32_t bits)
+{
+    union { float32 f; uint32_t u; } value;
+
+    if (paramTable[id].type == PARAM_TYPE_UINT16)
+        return (float32)(uint16_t)bits;
+    value.u = bits;
+    return value.f;
+}
+
+//=== Function: ParamWriteVariable ================================================================
+///
+/// @brief  Function writes a value into the variable of a parameter (one 16 or 32 bit store, an
+///         ISR never reads a half written value)
+///
+/// @param  uint16_t id, float32 value
+///
+/// @return void
+///
+//=================================================================================================
+static void ParamWriteVariable(uint16_t id, float32 value)
+{
+    if (paramTable[id].type == PARAM_TYPE_UINT16)
+        *(uint16_t *)paramTable[id].variable = (uint16_t)value;
+    else
+        *(float32 *)paramTable[id].variable = value;
+}
+
+//=== Function: ParamInRange ======================================================================
+///
+/// @brief  Function returns true if a value is in the range of a parameter
+///
+/// @param  uint16_t id, float32 value
+///
+/// @return bool inRange
+///
+//=================================================================================================
+static bool ParamInRange(uint16_t id, float32 value)
+{
+    return value >= paramTable[id].minimum && value <= paramTable[id].maximum;
+}
+
+//=== Function: ParamHeaderValid ==================================================================
+///
+/// @brief  Function returns true if the header of a sector is complete, the generation of the
+///         sector is returned in "generation"
+///
+/// @param  uint16_t sector, uint32_t *generation
+///
+/// @return bool valid
+///
+//=================================================================================================
+static bool ParamHeaderValid(uint16_t sector, uint32_t *generation)
+{
+    const ParamHeader *header = (const ParamHeader *)paramSectorAddress[sector];
+
+    if (header->key != PARAM_HEADER_KEY || header->keyInverted != (uint16_t)~PARAM_HEADER_KEY
+        || header->generationInverted != ~header->generation)
+        return false;
+    *generation = header->generation;
+    return true;
+}
+
+//=== Function: ParamSlotErased ===================================================================
+///
+/// @brief  Function returns true if all 8 words of a record slot are erased (end of the log)
+///
+/// @param  uint32_t address
+///
+/// @return bool erased
+///
+//=================================================================================================
+static bool ParamSlotErased(uint32_t address)
+{
+    const uint16_t *word = (const uint16_t *)address;
+
+    for (uint16_t i = 0; i < PARAM_RECORD_WORDS; i++)
+    {
+        if (word[i] != 0xFFFF)
+            return false;
+    }
+    return true;
+}
+
+//=== Function: ParamLoadSector ===================================================================
+///
+/// @brief  Function applies all valid records of the active sector to the variables (the last
+///         record of an ID wins) and counts the used slots. A slot which is not erased but fails
+///         the check (interrupted programming) is skipped and stays used
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ParamLoadSector(void)
+{
+    uint32_t address = paramSectorAddress[paramActiveSector] + PARAM_RECORD_WORDS;
+    const ParamRecord *record;
+    float32 value;
+
+    paramUsedRecords = 0;
+    while (paramUsedRecords < PARAM_RECORDS_PER_SECTOR && !ParamSlotErased(address))
+    {
+        record = (const ParamRecord *)address;
+        if (record->key == PARAM_RECORD_KEY && record->id < PARAM_NUMBER_OF_IDS
+            && record->idInverted == (uint16_t)~record->id
+            && record->valueInverted == ~record->value)
+        {
+            value = ParamFromBits(record->id, record->value);
+            if (ParamInRange(record->id, value))
+                ParamWriteVariable(record->id, value);
+        }
+        paramUsedRecords++;
+        address += PARAM_RECORD_WORDS;
+    }
+}
+
+//=== Function: ParamWriteRecord ==================================================================
+///
+/// @brief  Function programs the record of a value into a slot
+///
+/// @param  uint32_t address, uint16_t id, float32 value
+///
+/// @return bool success
+///
+//=================================================================================================
+static bool ParamWriteRecord(uint32_t address, uint16_t id, float32 value)
+{
+    uint32_t bits = ParamToBits(id, value);
+    uint16_t buffer[PARAM_RECORD_WORDS];
+
+    buffer[0] = PARAM_RECORD_KEY;
+    buffer[1] = id;
+    buffer[2] = bits & 0xFFFF;
+    buffer[3] = bits >> 16;
+    buffer[4] = ~id;
+    buffer[5] = 0xFFFF;
+    buffer[6] = ~bits & 0xFFFF;
+    buffer[7] = ~bits >> 16;
+    return ParamProgram(address, buffer);
+}
+
+//=== Function: ParamCompact ======================================================================
+///
+/// @brief  Function erases the other sector, writes one record with the current value of every
+///         parameter and activates the sector by writing its header with the next generation.
+///         Without an active sector (first change) sector 0 is used
+///
+/// @param  void
+///
+/// @return bool success
+///
+//=================================================================================================
+static bool ParamCompact(void)
+{
+    uint16_t target = (paramActiveSector < PARAM_NUMBER_OF_SECTORS) ? paramActiveSector ^ 1 : 0;
+    uint32_t address = paramSectorAddress[target];
+    uint32_t generation = paramGeneration + 1;
+    uint16_t buffer[PARAM_RECORD_WORDS];
+
+    if (!ParamErase(address))
+        return false;
+
+    for (uint16_t id = 0; id < PARAM_NUMBER_OF_IDS; id++)
+    {
+        address += PARAM_RECORD_WORDS;
+        if (!ParamWriteRecord(address, id, ParamGet(id)))
+            return false;
+    }
+
+    // The header is written last, until then the old sector stays active
+    buffer[0] = PARAM_HEADER_KEY;
+    buffer[1] = (uint16_t)~PARAM_HEADER_KEY;
+    buffer[2] = generation & 0xFFFF;
+    buffer[3] = generation >> 16;
+    buffer[4] = ~generation & 0xFFFF;
+    buffer[5] = ~generation >> 16;
+    buffer[6] = 0xFFFF;
+    buffer[7] = 0xFFFF;
+    if (!ParamProgram(paramSectorAddress[target], buffer))
+        return false;
+
+    paramActiveSector = target;
+    paramGeneration = generation;
+    paramUsedRecords = PARAM_NUMBER_OF_IDS;
+    return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ParamsInit ========================================================================
+///
+/// @brief  Function writes the default values into the variables of all parameters, takes the
+///         flash pump for CPU1, sets up the Flash API for bank 0 and loads the records of the
+///         active sector (the valid sector with the highest generation). Must be called after
+///         DeviceInit() and before PwmInitAll(). Returns false if the Flash API could not be set
+///         up, the defaults are used then
+///
+/// @param  void
+///
+/// @return bool success
+///
+//=================================================================================================
+bool ParamsInit(void)
+{
+    Fapi_StatusType status;
+    uint32_t generation;
+
+    for (uint16_t id = 0; id < PARAM_NUMBER_OF_IDS; id++)
+        ParamWriteVariable(id, paramTable[id].defaultValue);
+
+    paramRequest.pending = 0;
+    paramRequest.status = PARAM_STATUS_OK;
+    paramActiveSector = 0xFFFF;
+    paramGeneration = 0;
+    paramUsedRecords = 0;
+    paramFlashErrors = 0;
+
+    EALLOW;
+    // Request the flash pump for CPU1 (semaphore between CPU1 and CPU2)
+    FlashPumpSemaphoreRegs.PUMPREQUEST.all = 0x5A5A0002UL;
+    status = Fapi_initializeAPI(FlashTech_CPU0_BASE_ADDRESS, DEVICE_SYSCLK_MHZ);
+    if (status == Fapi_Status_Success)
+        status = Fapi_setActiveFlashBank(Fapi_FlashBank0);
+    EDIS;
+    if (status != Fapi_Status_Success)
+        return false;
+
+    for (uint16_t sector = 0; sector < PARAM_NUMBER_OF_SECTORS; sector++)
+    {
+        if (ParamHeaderValid(sector, &generation)
+            && (paramActiveSector == 0xFFFF || generation > paramGeneration))
+        {
+            paramActiveSector = sector;
+            paramGeneration = generation;
+        }
+    }
+    if (paramActiveSector != 0xFFFF)
+        ParamLoadSector();
+    return true;
+}
+
+//=== Function: ParamSet ==========================================================================
+///
+/// @brief  Function changes a parameter: the record is appended to the active sector (after a
+///         compaction if the sector is full) and the variable is only written when the record
+///         is in the flash. A value equal to the current one is not written again. Blocks for
+///         the programming time (and the erase time of a compaction), only the ISRs in
+///         .TI.ramfunc may run during this time
+///
+/// @param  uint16_t id, float32 value
+///
+/// @return uint16_t status (PARAM_STATUS_...)
+///
+//=================================================================================================
+uint16_t ParamSet(uint16_t id, float32 value)
+{
+    uint32_t address;
+
+    if (id >= PARAM_NUMBER_OF_IDS)
+        return PARAM_STATUS_INVALID_ID;
+    if (!ParamInRange(id, value))
+        return PARAM_STATUS_OUT_OF_RANGE;
+    if (ParamToBits(id, value) == ParamToBits(id, ParamGet(id)))
+        return PARAM_STATUS_OK;
+
+    if (paramActiveSector == 0xFFFF || paramUsedRecords >= PARAM_RECORDS_PER_SECTOR)
+    {
+        if (!ParamCompact())
+            return PARAM_STATUS_FLASH_ERROR;
+    }
+
+    // Slot after the header and the used records, it is used even if the programming fails
+    address = paramSectorAddress[paramActiveSector]
+              + (uint32_t)(paramUsedRecords + 1) * PARAM_RECORD_WORDS;
+    paramUsedRecords++;
+    if (!ParamWriteRecord(address, id, value))
+        return PARAM_STATUS_FLASH_ERROR;
+
+    ParamWriteVariable(id, value);
+    return PARAM_STATUS_OK;
+}
+
+//=== Function: ParamGet ==========================================================================
+///
+/// @brief  Function returns the current value of a parameter from its variable (0 for an
+///         invalid ID)
+///
+/// @param  uint16_t id
+///
+/// @return float32 value
+///
+//=================================================================================================
+float32 ParamGet(uint16_t id)
+{
+    if (id >= PARAM_NUMBER_OF_IDS)
+        return 0.0f;
+    if (paramTable[id].type == PARAM_TYPE_UINT16)
+        return (float32)*(const uint16_t *)paramTable[id].variable;
+    return *(const float32 *)paramTable[id].variable;
+}
+
+//=== Function: ParamService ======================================================================
+///
+/// @brief  Function executes a change requested with "paramRequest" and clears "pending". Called
+///         from the main loop when no check is running
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ParamService(void)
+{
+    if (!paramRequest.pending)
+        return;
+
+    paramRequest.status = ParamSet(paramRequest.id, paramRequest.value);
+    paramRequest.pending = 0;
+    if (paramRequest.status == PARAM_STATUS_OK)
+    {
+        float32 value = paramRequest.value;
+        uint32_t bits;
+
+        memcpy(&bits, &value, sizeof(bits));
+        LOG2(LOG_ID_PARAM_SAVED, paramRequest.id, bits);
+    }
+}
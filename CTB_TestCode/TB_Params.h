@@ -0,0 +1,152 @@
+//=================================================================================================
+/// @file     TB_Params.h
+///
+/// @brief    File contains a persistent parameter store for the configuration and calibration
+///           values of the test code (e.g. Repeat_count, ADC_error_buffer, the PWM period). The
+///           code keeps reading the values from their global variables in RAM, these variables
+///           are the RAM mirror of the store: ParamsInit() loads them once at start-up and
+///           ParamSet() changes them, so a read from an ISR never touches the flash.
+///
+///           The store is a log in two flash sectors which are used alternately (FLASH12 and
+///           FLASH13, sectors M and N of bank 0):
+///           - word 0 ... 7 of a sector: header with the generation of the sector
+///           - every further 8 words (128 bit, one programming operation with ECC): one record
+///             with the ID and the new value of a parameter, the last record of an ID is valid
+///           A change only appends a record to the active sector, so every flash word is written
+///           once per erase. When the sector is full, the current values of all parameters are
+///           compacted into the other sector and its header with the next generation is written
+///           last. The alternating sectors share the erase cycles (wear leveling).
+///           The store is safe against a loss of power:
+///           - a record carries its ID and value twice (second copy inverted), a record which
+///             was not written completely fails the check and is ignored
+///           - a sector only becomes active when its header is written, an interrupted
+///             compaction leaves the old sector active with all values
+///
+///           Erasing and programming use the Flash API (F021, C2000Ware) and block until the
+///           flash state machine (FSM) has finished. Bank 0 cannot be read in this time: the
+///           Flash API is linked to .TI.ramfunc (2838x_FLASH_lnk_cpu1.cmd) and the interrupts are
+///           disabled from the start of an operation until the FSM is ready (ParamProgram(),
+///           ParamErase()), so no ISR and no flash-resident .const data is touched. An erase
+///           holds off the ISRs for up to a few 100 ms, so main() only calls ParamService() when
+///           no check is running.
+///           Changes are requested with "paramRequest" (e.g. from the debugger) or ParamSet()
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYPARAMS_H_
+#define MYPARAMS_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "F021_F2838x_C28x.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Sectors of the log (FLASH12, FLASH13), the last 16 words of FLASH13 are not used (errata
+// advisory "Memory: Prefetching Beyond Valid Memory"), so both sectors use the same size
+#define PARAM_NUMBER_OF_SECTORS     2
+#define PARAM_SECTOR0_ADDRESS       0x0BC000UL
+#define PARAM_SECTOR1_ADDRESS       0x0BE000UL
+#define PARAM_SECTOR_SIZE           0x1FF0UL
+// Words of the header and of a record (one programming operation, 128 bit with ECC)
+#define PARAM_RECORD_WORDS          8
+// Number of records per sector (1021 changes between two compactions)
+#define PARAM_RECORDS_PER_SECTOR    ((uint16_t)(PARAM_SECTOR_SIZE / PARAM_RECORD_WORDS) - 1)
+// Keys of a valid header and of a valid record
+#define PARAM_HEADER_KEY            0xA55A
+#define PARAM_RECORD_KEY            0x5AA5
+
+// IDs of the parameters, an ID must never change its meaning (records in the flash)
+#define PARAM_REPEAT_COUNT          0       // Repeat_count, TB_Functions.h
+#define PARAM_ADC_ERROR_BUFFER      1       // ADC_error_buffer, TB_Functions.h
+#define PARAM_ADC_SWEEP_MODE        2       // adcSweepMode, TB_Functions.h
+#define PARAM_PWM_PERIOD            3       // pwmPeriod, TB_PWM.h (applied by PwmInitAll())
+#define PARAM_GPIO_LED_CHECK_MODE   4       // gpioLedCheckMode, TB_Functions.h
+#define PARAM_NUMBER_OF_IDS         5
+
+// Types of the variables
+#define PARAM_TYPE_UINT16           0
+#define PARAM_TYPE_FLOAT32          1
+
+// Results of ParamSet()
+#define PARAM_STATUS_OK             0
+#define PARAM_STATUS_INVALID_ID     1
+#define PARAM_STATUS_OUT_OF_RANGE   2
+#define PARAM_STATUS_FLASH_ERROR    3
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Definition of one parameter
+typedef struct
+{
+    void *variable;                 // RAM mirror (global variable read by the code)
+    uint16_t type;                  // PARAM_TYPE_...
+    float32 defaultValue;           // value without a record in the flash
+    float32 minimum;                // range of ParamSet() and of the loaded records
+    float32 maximum;
+} ParamDefinition;
+
+// Header of a sector (word 0 ... 7), the sector with the highest generation is active
+typedef struct
+{
+    uint16_t key;                   // PARAM_HEADER_KEY
+    uint16_t keyInverted;
+    uint32_t generation;
+    uint32_t generationInverted;
+    uint16_t reserved[2];
+} ParamHeader;
+
+// Record of a change (8 words)
+typedef struct
+{
+    uint16_t key;                   // PARAM_RECORD_KEY
+    uint16_t id;
+    uint32_t value;                 // bit pattern of the value (uint16_t or float32)
+    uint16_t idInverted;
+    uint16_t reserved;
+    uint32_t valueInverted;
+} ParamRecord;
+
+// Change requested with "paramRequest", ParamService() clears "pending" when it is done
+typedef struct
+{
+    uint16_t pending;               // set to 1 when id and value are written
+    uint16_t id;
+    float32 value;
+    uint16_t status;                // PARAM_STATUS_... of the last request
+} ParamRequest;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Definitions of all parameters (index = ID)
+extern const ParamDefinition paramTable[PARAM_NUMBER_OF_IDS];
+// Change request of the debugger or the host
+extern volatile ParamRequest paramRequest;
+// Active sector (0xFFFF: no sector written yet), its generation and the used records
+extern uint16_t paramActiveSector;
+extern uint32_t paramGeneration;
+extern uint16_t paramUsedRecords;
+// Erase and programming operations of the FSM which failed
+extern uint16_t paramFlashErrors;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function sets up the Flash API and loads all parameters into their variables
+extern bool ParamsInit(void);
+// Function changes a parameter and appends its record to the log
+extern uint16_t ParamSet(uint16_t id, float32 value);
+// Function returns the current value of a parameter (from the RAM mirror)
+extern float32 ParamGet(uint16_t id);
+// Function executes a change requested with "paramRequest"
+extern void ParamService(void);
+
+#endif
@@ -0,0 +1,212 @@
+//=================================================================================================
+/// @file     TB_ProcessImage.c
+///
+/// @brief    File contains a cyclic process image exchange between CPU1 and the Connectivity
+///           Manager (CM). Every PROCESS_IMAGE_CYCLE_FRAMES ePWM1 periods the measurements are
+///           published into a double-buffered area in MSGRAM_CPU_TO_CM and the newest setpoints
+///           are taken over from MSGRAM_CM_TO_CPU. See TB_ProcessImage.h for the protocol
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_ProcessImage.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by DmaAdcFrameDone(), runs from LSx RAM like the ISR (see TB_Sequencer.c)
+#ifdef CPU1
+#pragma CODE_SECTION(ProcessImageCycle, ".TI.ramfunc");
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Measurements (CPU1 writes, the CM only reads)
+ProcessImageCpu1Area processImageCpu1;
+#pragma DATA_SECTION(processImageCpu1,"MSGRAM_CPU_TO_CM");
+// Setpoints (the CM writes, CPU1 only reads)
+ProcessImageCmArea processImageCm;
+#pragma DATA_SECTION(processImageCm,"MSGRAM_CM_TO_CPU");
+
+#ifdef CPU1
+ProcessImageInputs processImageIn;
+ProcessImageOutputs processImageOut;
+uint32_t processImageInputMisses = 0;
+// Measurements: SOC 0 to 3 of every ADC module
+const uint16_t processImageMeasurementMap[PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS] =
+{
+    DMA_ADC_OFFSET_a + 0, DMA_ADC_OFFSET_a + 1, DMA_ADC_OFFSET_a + 2, DMA_ADC_OFFSET_a + 3,
+    DMA_ADC_OFFSET_b + 0, DMA_ADC_OFFSET_b + 1, DMA_ADC_OFFSET_b + 2, DMA_ADC_OFFSET_b + 3,
+    DMA_ADC_OFFSET_c + 0, DMA_ADC_OFFSET_c + 1, DMA_ADC_OFFSET_c + 2, DMA_ADC_OFFSET_c + 3,
+    DMA_ADC_OFFSET_d + 0, DMA_ADC_OFFSET_d + 1, DMA_ADC_OFFSET_d + 2, DMA_ADC_OFFSET_d + 3
+};
+// DMA frames since the last exchange and cycles since the last new setpoints
+static uint16_t processImageFrameCount;
+static uint16_t processImageStaleCycles;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ProcessImageReadInputs ============================================================
+///
+/// @brief  Function copies the latest setpoint bank of the CM into "processImageIn" if the bank
+///         was not written during the copy and holds a new cycle. Otherwise the local copy is
+///         kept. Returns true if new setpoints were taken over
+///
+/// @param  void
+///
+/// @return bool newInputs
+///
+//=================================================================================================
+static bool ProcessImageReadInputs(void)
+{
+    volatile ProcessImageInputBank *bank;
+    ProcessImageInputs image;
+    uint32_t sequence;
+    uint16_t i;
+
+    if (processImageCm.ready != PROCESS_IMAGE_READY_KEY)
+        return false;
+
+    bank = &processImageCm.bank[processImageCm.latestBank & 1];
+    sequence = bank->sequence;
+    if (sequence & 1)
+        return false;
+
+    image.cycle = bank->image.cycle;
+    image.command = bank->image.command;
+    image.reserved = 0;
+    for (i = 0; i < PROCESS_IMAGE_NUMBER_OF_SETPOINTS; i++)
+        image.setpoint[i] = bank->image.setpoint[i];
+
+    if (bank->sequence != sequence || image.cycle == processImageIn.cycle)
+        return false;
+
+    processImageIn = image;
+    return true;
+}
+
+//=== Function: ProcessImageWriteOutputs ==========================================================
+///
+/// @brief  Function writes "processImageOut" into the bank which is not the latest one and makes
+///         it the latest bank. The CM has a full cycle to copy the other bank
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ProcessImageWriteOutputs(void)
+{
+    uint16_t next = (processImageCpu1.latestBank ^ 1) & 1;
+    volatile ProcessImageOutputBank *bank = &processImageCpu1.bank[next];
+    uint16_t i;
+
+    // Odd: bank is written
+    bank->sequence++;
+    bank->image.cycle = processImageOut.cycle;
+    bank->image.status = processImageOut.status;
+    bank->image.reserved = 0;
+    for (i = 0; i < PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS; i++)
+        bank->image.measurement[i] = processImageOut.measurement[i];
+    // Even: bank is valid
+    bank->sequence++;
+
+    processImageCpu1.latestBank = next;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ProcessImageInit ==================================================================
+///
+/// @brief  Function clears the banks of CPU1 and the local copies and sets the ready flag of
+///         CPU1. Must be called before DmaInitAdcCapture()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ProcessImageInit(void)
+{
+    uint16_t i;
+
+    processImageCpu1.ready = 0;
+    processImageCpu1.latestBank = 0;
+    processImageCpu1.bank[0].sequence = 0;
+    processImageCpu1.bank[1].sequence = 0;
+
+    processImageIn.cycle = 0;
+    processImageIn.command = 0;
+    processImageIn.reserved = 0;
+    for (i = 0; i < PROCESS_IMAGE_NUMBER_OF_SETPOINTS; i++)
+        processImageIn.setpoint[i] = 0;
+    processImageOut.cycle = 0;
+    processImageOut.status = PROCESS_IMAGE_STATUS_INPUT_STALE;
+    processImageOut.reserved = 0;
+    for (i = 0; i < PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS; i++)
+        processImageOut.measurement[i] = 0;
+
+    processImageFrameCount = 0;
+    processImageStaleCycles = PROCESS_IMAGE_TIMEOUT_CYCLES;
+    processImageInputMisses = 0;
+
+    processImageCpu1.ready = PROCESS_IMAGE_READY_KEY;
+}
+
+//=== Function: ProcessImageCycle =================================================================
+///
+/// @brief  Function is called by DmaAdcFrameDone() for every DMA frame. Every
+///         PROCESS_IMAGE_CYCLE_FRAMES frames the mapped results of the frame are written into
+///         "processImageOut", the measurements are published, the newest setpoints are taken
+///         over into "processImageIn" and the CM is notified with PROCESS_IMAGE_IPC_FLAG.
+///         Returns true in the frame of the exchange, the control code can then use the new
+///         setpoints
+///
+/// @param  const volatile uint16_t *frame
+///
+/// @return bool exchanged
+///
+//=================================================================================================
+bool ProcessImageCycle(const volatile uint16_t *frame)
+{
+    uint16_t i;
+
+    if (++processImageFrameCount < PROCESS_IMAGE_CYCLE_FRAMES)
+        return false;
+    processImageFrameCount = 0;
+
+    // Measurements out
+    processImageOut.cycle++;
+    for (i = 0; i < PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS; i++)
+        processImageOut.measurement[i] = frame[processImageMeasurementMap[i]];
+    ProcessImageWriteOutputs();
+
+    // Setpoints in
+    if (ProcessImageReadInputs())
+    {
+        processImageStaleCycles = 0;
+    }
+    else
+    {
+        processImageInputMisses++;
+        if (processImageStaleCycles < PROCESS_IMAGE_TIMEOUT_CYCLES)
+            processImageStaleCycles++;
+    }
+    if (processImageStaleCycles >= PROCESS_IMAGE_TIMEOUT_CYCLES)
+        processImageOut.status |= PROCESS_IMAGE_STATUS_INPUT_STALE;
+    else
+        processImageOut.status &= ~PROCESS_IMAGE_STATUS_INPUT_STALE;
+
+    Cpu1toCmIpcRegs.CPU1TOCMIPCSET.all = PROCESS_IMAGE_IPC_FLAG;
+    return true;
+}
+#endif
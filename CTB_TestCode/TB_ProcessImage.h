@@ -0,0 +1,130 @@
+//=================================================================================================
+/// @file     TB_ProcessImage.h
+///
+/// @brief    File contains a cyclic process image exchange between CPU1 and the Connectivity
+///           Manager (CM) for a fieldbus (e.g. EtherCAT) running on the CM. The cycle is derived
+///           from ePWM1: every PROCESS_IMAGE_CYCLE_FRAMES DMA frames of TB_DMA (one frame per
+///           ePWM1 SOCA) DmaAdcFrameDone() calls ProcessImageCycle(), which publishes the
+///           measurements and takes over the newest setpoints.
+///           The control code only uses the local copies "processImageIn" and "processImageOut".
+///           Both directions are double-buffered in the message RAMs (measurements in
+///           MSGRAM_CPU_TO_CM, setpoints in MSGRAM_CM_TO_CPU): the writer alternates between two
+///           banks and protects each bank with a sequence counter (odd while it is written, like
+///           myMailbox of the HW_Monitor examples), then points "latestBank" to it. The reader
+///           copies the latest bank and checks that its counter did not change. Nobody waits: if
+///           no consistent new setpoints are available, CPU1 keeps the last ones.
+///           The layout only uses 16 and 32 bit members on even word offsets, so the types can
+///           be used unchanged in the CM project
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYPROCESSIMAGE_H_
+#define MYPROCESSIMAGE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_DMA.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Cycle of the process image in DMA frames (ePWM1 periods of 5 us, 200 -> 1 ms)
+#define PROCESS_IMAGE_CYCLE_FRAMES          200
+// Number of setpoints and measurements
+#define PROCESS_IMAGE_NUMBER_OF_SETPOINTS   8
+#define PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS 16
+// Number of cycles without new setpoints after which they are marked as stale
+#define PROCESS_IMAGE_TIMEOUT_CYCLES        10
+// Key of the ready flags of both cores
+#define PROCESS_IMAGE_READY_KEY             0x5AA5
+// IPC flag which is set by CPU1 at the start of every cycle (CPU1 to CM IPC2), the CM can use
+// it as sync event of the fieldbus
+#define PROCESS_IMAGE_IPC_FLAG              0x4UL
+// Bits of ProcessImageOutputs.status
+#define PROCESS_IMAGE_STATUS_INPUT_STALE    0x0001      // no new setpoints for
+                                                        // PROCESS_IMAGE_TIMEOUT_CYCLES cycles
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Setpoints written by the CM
+typedef struct
+{
+    uint32_t cycle;                     // cycle counter of the CM (starts with 1)
+    uint16_t command;
+    uint16_t reserved;
+    uint16_t setpoint[PROCESS_IMAGE_NUMBER_OF_SETPOINTS];
+} ProcessImageInputs;
+
+// Measurements written by CPU1
+typedef struct
+{
+    uint32_t cycle;                     // cycle counter of CPU1
+    uint16_t status;                    // PROCESS_IMAGE_STATUS_...
+    uint16_t reserved;
+    uint16_t measurement[PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS];
+} ProcessImageOutputs;
+
+// One bank of a direction, "sequence" is odd while the bank is written
+typedef struct
+{
+    volatile uint32_t sequence;
+    volatile ProcessImageInputs image;
+} ProcessImageInputBank;
+
+typedef struct
+{
+    volatile uint32_t sequence;
+    volatile ProcessImageOutputs image;
+} ProcessImageOutputBank;
+
+// Area written by CPU1 (MSGRAM_CPU_TO_CM)
+typedef struct
+{
+    volatile uint16_t ready;            // PROCESS_IMAGE_READY_KEY when the banks are set up
+    volatile uint16_t latestBank;       // bank with the newest measurements
+    ProcessImageOutputBank bank[2];
+} ProcessImageCpu1Area;
+
+// Area written by the CM (MSGRAM_CM_TO_CPU)
+typedef struct
+{
+    volatile uint16_t ready;            // PROCESS_IMAGE_READY_KEY when the fieldbus is running
+    volatile uint16_t latestBank;       // bank with the newest setpoints
+    ProcessImageInputBank bank[2];
+} ProcessImageCmArea;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Measurements (MSGRAM_CPU_TO_CM, written by CPU1)
+extern ProcessImageCpu1Area processImageCpu1;
+// Setpoints (MSGRAM_CM_TO_CPU, written by the CM)
+extern ProcessImageCmArea processImageCm;
+#ifdef CPU1
+// Local copies of the control code
+extern ProcessImageInputs processImageIn;
+extern ProcessImageOutputs processImageOut;
+// Number of cycles in which no consistent new setpoints were available
+extern uint32_t processImageInputMisses;
+// Index in the DMA frame of every measurement
+extern const uint16_t processImageMeasurementMap[PROCESS_IMAGE_NUMBER_OF_MEASUREMENTS];
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU1
+// Function clears the banks and the local copies and sets the ready flag of CPU1
+extern void ProcessImageInit(void);
+// Function counts the DMA frames and exchanges the process image every
+// PROCESS_IMAGE_CYCLE_FRAMES frames, returns true in the frame of the exchange
+extern bool ProcessImageCycle(const volatile uint16_t *frame);
+#endif
+
+#endif
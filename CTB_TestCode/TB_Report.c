@@ -0,0 +1,433 @@
+//=================================================================================================
+/// @file     TB_Report.c
+///
+/// @brief    File contains the phase timing of the CTB test run and the summary report over UART.
+///           See TB_Report.h for the timing of the phases
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Report.h"
+#include "TB_Functions.h"
+#include "TB_ADCCal.h"
+#include "TB_UART.h"
+#include "TB_ERAD.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the sequencer ISR, runs from LSx RAM like the step functions
+#pragma CODE_SECTION(ReportAccumulate, ".TI.ramfunc");
+#pragma CODE_SECTION(ReportFindCheck, ".TI.ramfunc");
+#pragma CODE_SECTION(ReportPhaseStart, ".TI.ramfunc");
+#pragma CODE_SECTION(ReportCheckStep, ".TI.ramfunc");
+#pragma CODE_SECTION(ReportCheckDone, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Order of the REPORT_PHASE_x defines
+const ReportPhaseDefinition reportPhaseTable[REPORT_NUMBER_OF_PHASES] =
+{
+    // name                     check
+    {"Boot",                    0},
+    {"Error_LEDs",              SeqStep_Error_LEDs},
+    {"PWM_LEDs",                SeqStep_PWM_LEDs},
+    {"GPIOLEDs",                SeqStep_GPIOLEDs},
+    {"Analog init",             0},
+    {"ADC window tuning",       0},
+    {"ADC settle time",         0},
+    {"ADC calibration",         0},
+    {"Hardware_Error_Detection", SeqStep_Hardware_Error_Detection},
+    {"ADCINs",                  SeqStep_ADCINs}
+};
+ReportPhase reportPhases[REPORT_NUMBER_OF_PHASES];
+uint32_t reportTotalUs = 0;
+uint16_t reportFailedPhases = 0;
+// Texts of the REPORT_RESULT_x defines
+static const char *const reportResultText[] = {"-", "PASS", "FAIL", "VISUAL"};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ReportAccumulate ==================================================================
+///
+/// @brief  Function adds the whole us since the last update to the duration of a running phase.
+///         The remaining ticks stay in lastTime, so no time is lost between the updates
+///
+/// @param  ReportPhase *phase
+///
+/// @return void
+///
+//=================================================================================================
+static void ReportAccumulate(ReportPhase *phase)
+{
+    uint32_t us = (DeviceGetTime() - phase->lastTime) / DEVICE_TIME_TICKS_PER_US;
+
+    phase->durationUs += us;
+    phase->lastTime += us * DEVICE_TIME_TICKS_PER_US;
+}
+
+//=== Function: ReportFindCheck ===================================================================
+///
+/// @brief  Function returns the phase of a step function of the sequencer
+///
+/// @param  SeqStepFunction check
+///
+/// @return uint16_t phase (REPORT_NUMBER_OF_PHASES if the check has no phase)
+///
+//=================================================================================================
+static uint16_t ReportFindCheck(SeqStepFunction check)
+{
+    uint16_t phase;
+
+    for (phase = 0; phase < REPORT_NUMBER_OF_PHASES; phase++)
+    {
+        if (reportPhaseTable[phase].check == check)
+            break;
+    }
+    return phase;
+}
+
+//=== Function: ReportEvaluate ====================================================================
+///
+/// @brief  Function sets result and retries of an executed phase from the results of its check
+///
+/// @param  uint16_t phase
+///
+/// @return void
+///
+//=================================================================================================
+static void ReportEvaluate(uint16_t phase)
+{
+    ReportPhase *p = &reportPhases[phase];
+
+    p->result = REPORT_RESULT_PASS;
+    p->retries = 0;
+
+    switch (phase)
+    {
+        case REPORT_PHASE_ERROR_LEDS:
+        case REPORT_PHASE_PWM_LEDS:
+            p->result = REPORT_RESULT_VISUAL;
+            break;
+        case REPORT_PHASE_GPIO_LEDS:
+            if (gpioLedCheckMode == GPIO_LED_CHECK_VISUAL)
+                p->result = REPORT_RESULT_VISUAL;
+            else if (gpioLedLoopback.numberOfErrors != 0)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        case REPORT_PHASE_ADC_ACQPS:
+            if (adcAcqpsFailed != 0)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        case REPORT_PHASE_ADC_SETTLE:
+            // The search ends at the limit if a channel does not settle
+            if (adcSettleFrames >= ADC_SETTLE_MAX_FRAMES)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        case REPORT_PHASE_ADC_CAL:
+            if (adcCal.magic != ADC_CAL_MAGIC || adcCal.calibrated != ADC_CAL_NUMBER_OF_CHANNELS)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        case REPORT_PHASE_HARDWARE_ERROR:
+            p->retries = Repeat_count - 1;
+            if (!clbCheckPassed || !tripLatencyPassed)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        case REPORT_PHASE_ADCINS:
+            p->retries = Repeat_count - 1;
+            if (ADC_GetErrorCount() != 0)
+                p->result = REPORT_RESULT_FAIL;
+            break;
+        default:
+            break;
+    }
+}
+
+//=== Function: ReportFormat ======================================================================
+///
+/// @brief  Function writes a decimal number right aligned into a field of "width" characters.
+///         With "decimals" > 0 the last digits are written after a decimal point
+///
+/// @param  char *text, uint16_t width, uint32_t value, uint16_t decimals
+///
+/// @return char *end of the field
+///
+//=================================================================================================
+static char *ReportFormat(char *text, uint16_t width, uint32_t value, uint16_t decimals)
+{
+    char *end = text + width;
+    char *digit = end;
+
+    do
+    {
+        if (decimals != 0 && (uint16_t)(end - digit) == decimals)
+            *--digit = '.';
+        *--digit = '0' + (char)(value % 10);
+        value /= 10;
+    } while ((value != 0 || (uint16_t)(end - digit) <= decimals) && digit > text);
+
+    while (digit > text)
+        *--digit = ' ';
+    return end;
+}
+
+//=== Function: ReportCopy ========================================================================
+///
+/// @brief  Function copies a text left aligned into a field of "width" characters (cut if longer)
+///
+/// @param  char *text, uint16_t width, const char *source
+///
+/// @return char *end of the field
+///
+//=================================================================================================
+static char *ReportCopy(char *text, uint16_t width, const char *source)
+{
+    for (uint16_t i = 0; i < width; i++)
+        *text++ = (*source != '\0') ? *source++ : ' ';
+    return text;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ReportInit ========================================================================
+///
+/// @brief  Function clears the timing and the results of all phases and initialises the UART.
+///         Called at the start of main() after ClockInit()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ReportInit(void)
+{
+    for (uint16_t i = 0; i < REPORT_NUMBER_OF_PHASES; i++)
+    {
+        reportPhases[i].durationUs = 0;
+        reportPhases[i].lastTime = 0;
+        reportPhases[i].running = false;
+        reportPhases[i].executed = false;
+        reportPhases[i].result = REPORT_RESULT_NOT_RUN;
+        reportPhases[i].retries = 0;
+    }
+    reportTotalUs = 0;
+    reportFailedPhases = 0;
+
+#if UART_ENABLE
+    UartInit();
+#endif
+}
+
+//=== Function: ReportPhaseStart ==================================================================
+///
+/// @brief  Function starts the timing of a phase. A phase which is started again continues
+///
+/// @param  uint16_t phase (REPORT_PHASE_x)
+///
+/// @return void
+///
+//=================================================================================================
+void ReportPhaseStart(uint16_t phase)
+{
+    reportPhases[phase].lastTime = DeviceGetTime();
+    reportPhases[phase].running = true;
+    reportPhases[phase].executed = true;
+}
+
+//=== Function: ReportPhaseUpdate =================================================================
+///
+/// @brief  Function adds the time since the last update to a running phase. Must be called at
+///         least once per overflow of the time base (21 s) while a long phase is waited for
+///
+/// @param  uint16_t phase (REPORT_PHASE_x)
+///
+/// @return void
+///
+//=================================================================================================
+void ReportPhaseUpdate(uint16_t phase)
+{
+    if (reportPhases[phase].running)
+        ReportAccumulate(&reportPhases[phase]);
+}
+
+//=== Function: ReportPhaseStop ===================================================================
+///
+/// @brief  Function stops the timing of a phase
+///
+/// @param  uint16_t phase (REPORT_PHASE_x)
+///
+/// @return void
+///
+//=================================================================================================
+void ReportPhaseStop(uint16_t phase)
+{
+    ReportPhaseUpdate(phase);
+    reportPhases[phase].running = false;
+}
+
+//=== Function: ReportPhaseSetDuration ============================================================
+///
+/// @brief  Function sets the duration of a phase which was measured by the caller
+///         (e.g. bootTimeUs, analogInitTimeUs)
+///
+/// @param  uint16_t phase (REPORT_PHASE_x), uint32_t durationUs
+///
+/// @return void
+///
+//=================================================================================================
+void ReportPhaseSetDuration(uint16_t phase, uint32_t durationUs)
+{
+    reportPhases[phase].durationUs = durationUs;
+    reportPhases[phase].running = false;
+    reportPhases[phase].executed = true;
+}
+
+//=== Function: ReportCheckStep ===================================================================
+///
+/// @brief  Function is called by the sequencer before every step of a check. The first step
+///         starts the phase of the check, every further step adds the time since the last one
+///
+/// @param  SeqStepFunction check, uint32_t step
+///
+/// @return void
+///
+//=================================================================================================
+void ReportCheckStep(SeqStepFunction check, uint32_t step)
+{
+    uint16_t phase = ReportFindCheck(check);
+
+    if (phase >= REPORT_NUMBER_OF_PHASES)
+        return;
+
+    if (step == 0)
+        ReportPhaseStart(phase);
+    else
+        ReportAccumulate(&reportPhases[phase]);
+}
+
+//=== Function: ReportCheckDone ===================================================================
+///
+/// @brief  Function is called by the sequencer when a check is finished and stops its phase
+///
+/// @param  SeqStepFunction check
+///
+/// @return void
+///
+//=================================================================================================
+void ReportCheckDone(SeqStepFunction check)
+{
+    uint16_t phase = ReportFindCheck(check);
+
+    if (phase >= REPORT_NUMBER_OF_PHASES)
+        return;
+
+    ReportAccumulate(&reportPhases[phase]);
+    reportPhases[phase].running = false;
+}
+
+//=== Function: ReportSend ========================================================================
+///
+/// @brief  Function evaluates the results of all executed phases and writes the report over
+///         UART, one line per phase (name, duration in ms, result, retries) and the total.
+///         Called once when the analog checks are finished
+///
+/// @param  void
+///
+/// @return uint16_t number of failed phases
+///
+//=================================================================================================
+uint16_t ReportSend(void)
+{
+    char line[64];
+    char *end;
+
+    reportTotalUs = 0;
+    reportFailedPhases = 0;
+    for (uint16_t i = 0; i < REPORT_NUMBER_OF_PHASES; i++)
+    {
+        if (!reportPhases[i].executed)
+            continue;
+        ReportEvaluate(i);
+        reportTotalUs += reportPhases[i].durationUs;
+        if (reportPhases[i].result == REPORT_RESULT_FAIL)
+            reportFailedPhases++;
+    }
+
+#if UART_ENABLE
+    UartWrite("\nCTB test report, " REPORT_FIRMWARE_VERSION "\n");
+    UartWrite("Phase                      Time [ms]  Result  Retries\n");
+    for (uint16_t i = 0; i < REPORT_NUMBER_OF_PHASES; i++)
+    {
+        const ReportPhase *p = &reportPhases[i];
+
+        end = ReportCopy(line, 24, reportPhaseTable[i].name);
+        end = ReportFormat(end, 12, p->durationUs, 3);
+        end = ReportCopy(end, 2, "");
+        end = ReportCopy(end, 6, reportResultText[p->result]);
+        end = ReportFormat(end, 9, p->retries, 0);
+        *end++ = '\n';
+        *end = '\0';
+        UartWrite(line);
+    }
+    end = ReportCopy(line, 24, "Total");
+    end = ReportFormat(end, 12, reportTotalUs, 3);
+    end = ReportCopy(end, 2, "");
+    end = ReportCopy(end, 6, reportFailedPhases ? "FAIL" : "PASS");
+    *end++ = '\n';
+    *end = '\0';
+    UartWrite(line);
+
+    if (reportPhases[REPORT_PHASE_HARDWARE_ERROR].executed)
+    {
+        // Detection latency of every error line in us (SYSCLK cycles * 5 ns)
+        UartWrite("Error line    Max latency [us]  Limit  Missed\n");
+        for (uint16_t i = 0; i < TRIP_NUMBER_OF_ROUTES; i++)
+        {
+            const TripLatency *latency = &tripLatency[i];
+
+            end = ReportCopy(line, 4, "GPIO");
+            end = ReportFormat(end, 3, tripRouteTable[i].pin, 0);
+            end = ReportFormat(end, 23, latency->maxCycles * (1000UL / DEVICE_SYSCLK_MHZ), 3);
+            end = ReportCopy(end, 2, "");
+            end = ReportCopy(end, 5, (latency->violations != 0) ? "FAIL" : "OK");
+            end = ReportFormat(end, 7, latency->missed, 0);
+            *end++ = '\n';
+            *end = '\0';
+            UartWrite(line);
+        }
+    }
+
+    if (eradOwned)
+    {
+        // ERAD profiles: cycles of the last and the longest run or number of calls
+        EradRead();
+        UartWrite("Profile             Last/calls   Max [cycles]\n");
+        for (uint16_t i = 0; i < ERAD_NUMBER_OF_PROFILES; i++)
+        {
+            const EradProfile *profile = &eradProfiles[i];
+
+            if (!profile->active)
+                continue;
+            end = ReportCopy(line, 18, eradProfileTable[i].name);
+            end = ReportFormat(end, 12, profile->count, 0);
+            if (eradProfileTable[i].mode == ERAD_PROFILE_CYCLES)
+                end = ReportFormat(end, 15, profile->maxCycles, 0);
+            *end++ = '\n';
+            *end = '\0';
+            UartWrite(line);
+        }
+    }
+    UartFlush();
+#endif
+
+    return reportFailedPhases;
+}
@@ -0,0 +1,98 @@
+//=================================================================================================
+/// @file     TB_Report.h
+///
+/// @brief    File contains the phase timing of the CTB test run and the summary report. Every
+///           check and every init phase of main() is a phase of reportPhaseTable. The checks of
+///           the sequencer are timed by SequencerNextStep() (ReportCheckStep(), ReportCheckDone()),
+///           the other phases by main() (ReportPhaseStart(), ReportPhaseStop()). The duration is
+///           summed from the free-running time base of DeviceGetTime() at every step or update,
+///           so phases longer than one overflow of the time base (21 s) are measured as long as
+///           the phase is updated at least once per overflow.
+///           At the end of the run ReportSend() evaluates the results (pass/fail, retries) and
+///           writes the table (phase, duration, result, retries) over UART (TB_UART)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYREPORT_H_
+#define MYREPORT_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Sequencer.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Firmware version in the header of the report
+#define REPORT_FIRMWARE_VERSION     "CTB_TestCode V1.1.0"
+// Phases of the test run (index of reportPhaseTable, order of the report)
+#define REPORT_PHASE_BOOT           0       // DeviceInit() to the first check
+#define REPORT_PHASE_ERROR_LEDS     1
+#define REPORT_PHASE_PWM_LEDS       2
+#define REPORT_PHASE_GPIO_LEDS      3
+#define REPORT_PHASE_ANALOG_INIT    4       // PWM, DAC, ADC ... initialisation
+#define REPORT_PHASE_ADC_ACQPS      5       // ADC_TuneAcqps()
+#define REPORT_PHASE_ADC_SETTLE     6       // ADC_MeasureSettleTime()
+#define REPORT_PHASE_ADC_CAL        7       // AdcCalRun()
+#define REPORT_PHASE_HARDWARE_ERROR 8
+#define REPORT_PHASE_ADCINS         9
+#define REPORT_NUMBER_OF_PHASES     10
+// Results of a phase
+#define REPORT_RESULT_NOT_RUN       0
+#define REPORT_RESULT_PASS          1
+#define REPORT_RESULT_FAIL          2
+#define REPORT_RESULT_VISUAL        3       // checked by the operator (LEDs)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Definition of one phase
+typedef struct
+{
+    const char *name;
+    SeqStepFunction check;          // step function of the sequencer, 0 for a phase of main()
+} ReportPhaseDefinition;
+
+// Timing and result of one phase
+typedef struct
+{
+    uint32_t durationUs;
+    uint32_t lastTime;              // DeviceGetTime() of the last update
+    bool running;
+    bool executed;
+    uint16_t result;                // REPORT_RESULT_x, set by ReportSend()
+    uint16_t retries;               // repeated runs of the check after the first one
+} ReportPhase;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern const ReportPhaseDefinition reportPhaseTable[REPORT_NUMBER_OF_PHASES];
+extern ReportPhase reportPhases[REPORT_NUMBER_OF_PHASES];
+// Sum of all phases in us and number of failed phases (set by ReportSend())
+extern uint32_t reportTotalUs;
+extern uint16_t reportFailedPhases;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function clears all phases and initialises the UART
+extern void ReportInit(void);
+// Function starts, updates and stops the timing of a phase of main()
+extern void ReportPhaseStart(uint16_t phase);
+extern void ReportPhaseUpdate(uint16_t phase);
+extern void ReportPhaseStop(uint16_t phase);
+// Function sets the duration of a phase which was measured without ReportPhaseStart()
+extern void ReportPhaseSetDuration(uint16_t phase, uint32_t durationUs);
+// Functions time the checks of the sequencer (called by SequencerNextStep())
+extern void ReportCheckStep(SeqStepFunction check, uint32_t step);
+extern void ReportCheckDone(SeqStepFunction check);
+// Function evaluates the results of all phases and writes the report over UART
+extern uint16_t ReportSend(void);
+
+#endif
@@ -0,0 +1,564 @@
+//=================================================================================================
+/// @file     TB_Sequencer.c
+///
+/// @brief    File contains a non-blocking test sequencer for the CTB checks. Every check is split
+///           into steps, each step returns the time until the next step. CPU-Timer 1 is reloaded
+///           with this time and its ISR executes the next step, so the main loop stays free
+///           while the checks are running.
+///           With SequencerStartFrameLocked() the steps are clocked by the ADC DMA frames
+///           instead (one frame per ePWM1 SOCA, see TB_DMA): DmaAdcFrameDone() calls
+///           SequencerFrame(), which counts the time of a step down in whole frames. Mux
+///           addresses and DAC codes then always change right after a completed frame and are
+///           measured a fixed number of SOC events later.
+///           The hardware error detection check arms the CLB monitor of the reset lines
+///           (TB_CLB) and compares the counted edges after its last step
+///
+/// @version  V1.3.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Sequencer.h"
+#include "TB_Report.h"
+#include "TB_TestPlan.h"
+#include "TB_Trace.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// The ISR and the step functions run from LSx RAM without flash wait states. In the FLASH
+// configuration DeviceInit() copies .TI.ramfunc from flash to RAM (see 2838x_FLASH_lnk_cpu1.cmd)
+#pragma CODE_SECTION(SequencerSetTimer, ".TI.ramfunc");
+#pragma CODE_SECTION(SequencerNextStep, ".TI.ramfunc");
+#pragma CODE_SECTION(SequencerISR, ".TI.ramfunc");
+#pragma CODE_SECTION(SequencerFrame, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_Error_LEDs, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_PWM_LEDs, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_GPIOLEDs, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_Hardware_Error_Detection, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_ADCINs, ".TI.ramfunc");
+#pragma CODE_SECTION(SeqStep_TestPlan, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+const SeqStepFunction seqLedChecks[SEQ_NUMBER_OF_LED_CHECKS] =
+{
+    SeqStep_Error_LEDs,
+    SeqStep_PWM_LEDs,
+    SeqStep_GPIOLEDs
+};
+
+const SeqStepFunction seqCpu1LedChecks[SEQ_NUMBER_OF_CPU1_LED_CHECKS] =
+{
+    SeqStep_Error_LEDs,
+    SeqStep_PWM_LEDs
+};
+
+const SeqStepFunction seqAnalogChecks[SEQ_NUMBER_OF_ANALOG_CHECKS] =
+{
+    SeqStep_Hardware_Error_Detection,
+    SeqStep_ADCINs
+};
+
+const SeqStepFunction seqTestPlanChecks[SEQ_NUMBER_OF_TESTPLAN_CHECKS] =
+{
+    SeqStep_TestPlan
+};
+
+// State of the running sequence
+const SeqStepFunction *seqChecks = 0;
+uint16_t seqNumberOfChecks = 0;
+volatile uint16_t seqCheck = 0;
+volatile uint32_t seqStep = 0;
+volatile bool seqFinished = true;
+// Sequence is clocked by the ADC DMA frames and frames until the next step
+volatile bool seqFrameLocked = false;
+uint32_t seqFrameCountdown = 0;
+// Next mux channel was preselected by SeqStep_ADCINs() during the last code of a channel
+bool seqMuxPreselected = false;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SequencerSetTimer =================================================================
+///
+/// @brief  Function reloads CPU-Timer 1 with the time until the next step
+///
+/// @param  uint32_t timeUs
+///
+/// @return void
+///
+//=================================================================================================
+static void SequencerSetTimer(uint32_t timeUs)
+{
+    if (timeUs == 0)
+        timeUs = 1;
+    CpuTimer1Regs.PRD.all = timeUs * SEQ_TIMER_TICKS_PER_US - 1;
+    // Load the new period into the counter
+    CpuTimer1Regs.TCR.bit.TRB = 1;
+}
+
+//=== Function: SequencerNextStep =================================================================
+///
+/// @brief  Function executes the next step of the running check. If the check is finished the
+///         first step of the next check is executed. Returns the time until the next step or
+///         SEQ_STEP_DONE if the whole sequence is finished. Every step is timed by TB_Report
+///         and recorded in the trace ring of the calling context
+///
+/// @param  uint16_t context (TRACE_CONTEXT_SEQUENCER or TRACE_CONTEXT_DMA)
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+static uint32_t SequencerNextStep(uint16_t context)
+{
+    while (seqCheck < seqNumberOfChecks)
+    {
+        uint32_t timeUs;
+
+        TRACE(context, TRACE_EVENT_SEQ_STEP, (seqCheck << 12) | ((uint16_t)seqStep & 0x0FFF));
+        ReportCheckStep(seqChecks[seqCheck], seqStep);
+        timeUs = seqChecks[seqCheck](seqStep);
+
+        if (timeUs != SEQ_STEP_DONE)
+        {
+            seqStep++;
+            return timeUs;
+        }
+        ReportCheckDone(seqChecks[seqCheck]);
+        seqCheck++;
+        seqStep = 0;
+    }
+    TRACE(context, TRACE_EVENT_SEQ_DONE, seqNumberOfChecks);
+    return SEQ_STEP_DONE;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SequencerStart ====================================================================
+///
+/// @brief  Function starts a sequence of checks. The first step is executed by the timer ISR
+///
+/// @param  const SeqStepFunction *checks, uint16_t numberOfChecks
+///
+/// @return void
+///
+//=================================================================================================
+void SequencerStart(const SeqStepFunction *checks, uint16_t numberOfChecks)
+{
+    EALLOW;
+
+    // Stop CPU-Timer 1 while the sequence is set up
+    CpuTimer1Regs.TCR.bit.TSS = 1;
+
+    seqChecks = checks;
+    seqNumberOfChecks = numberOfChecks;
+    seqCheck = 0;
+    seqStep = 0;
+    seqFinished = false;
+    seqFrameLocked = false;
+
+    // No prescaler, interrupt on every zero of the counter
+    CpuTimer1Regs.TPR.all = 0;
+    CpuTimer1Regs.TPRH.all = 0;
+    SequencerSetTimer(1);
+    CpuTimer1Regs.TCR.bit.TIF = 1;
+    CpuTimer1Regs.TCR.bit.TIE = 1;
+
+    // CPU-Timer 1 interrupt (INT13, not routed through the PIE)
+    PieVectTable.TIMER1_INT = &SequencerISR;
+    IER |= M_INT13;
+
+    CpuTimer1Regs.TCR.bit.TSS = 0;
+
+    EDIS;
+}
+
+//=== Function: SequencerStartFrameLocked =========================================================
+///
+/// @brief  Function starts a sequence of checks which is clocked by the ADC DMA frames. CPU-Timer
+///         1 is stopped, the first step is executed with the next frame by SequencerFrame().
+///         DmaInitAdcCapture() must be called before
+///
+/// @param  const SeqStepFunction *checks, uint16_t numberOfChecks
+///
+/// @return void
+///
+//=================================================================================================
+void SequencerStartFrameLocked(const SeqStepFunction *checks, uint16_t numberOfChecks)
+{
+    EALLOW;
+    CpuTimer1Regs.TCR.bit.TSS = 1;
+    CpuTimer1Regs.TCR.bit.TIE = 0;
+    EDIS;
+
+    seqChecks = checks;
+    seqNumberOfChecks = numberOfChecks;
+    seqCheck = 0;
+    seqStep = 0;
+    seqFrameCountdown = 1;
+    seqFinished = false;
+    seqFrameLocked = true;
+}
+
+//=== Function: SequencerFrame ====================================================================
+///
+/// @brief  Function is called by DmaAdcFrameDone() for every ADC DMA frame. If a frame-locked
+///         sequence is running, the frames until the next step are counted down and the step is
+///         executed when they have elapsed. The time of a step is rounded up to whole frames
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SequencerFrame(void)
+{
+    uint32_t timeUs;
+
+    if (!seqFrameLocked || --seqFrameCountdown > 0)
+        return;
+
+    EALLOW;
+    timeUs = SequencerNextStep(TRACE_CONTEXT_DMA);
+    EDIS;
+
+    if (timeUs == SEQ_STEP_DONE)
+    {
+        seqFrameLocked = false;
+        seqFinished = true;
+    }
+    else
+    {
+        seqFrameCountdown = (timeUs + SEQ_FRAME_US - 1) / SEQ_FRAME_US;
+        if (seqFrameCountdown == 0)
+            seqFrameCountdown = 1;
+    }
+}
+
+//=== Function: SequencerFinished =================================================================
+///
+/// @brief  Function returns true if the started sequence is finished
+///
+/// @param  void
+///
+/// @return bool finished
+///
+//=================================================================================================
+bool SequencerFinished(void)
+{
+    return seqFinished;
+}
+
+//=== Function: SequencerISR ======================================================================
+///
+/// @brief  ISR of CPU-Timer 1, executes the next step and reloads the timer with its time
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SequencerISR(void)
+{
+    uint32_t timeUs;
+
+    EALLOW;
+
+    timeUs = SequencerNextStep(TRACE_CONTEXT_SEQUENCER);
+
+    if (timeUs == SEQ_STEP_DONE)
+    {
+        CpuTimer1Regs.TCR.bit.TSS = 1;
+        seqFinished = true;
+    }
+    else
+    {
+        SequencerSetTimer(timeUs);
+    }
+    CpuTimer1Regs.TCR.bit.TIF = 1;
+
+    EDIS;
+}
+
+//=== Function: SeqStep_Error_LEDs ================================================================
+///
+/// @brief  Step function of Error_LEDs_Check(), two steps (on, off) per Error LED
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_Error_LEDs(uint32_t step)
+{
+    int i = 1 + (step / 2) % 29;
+
+    if (step >= (uint32_t)Repeat_count * 29 * 2)
+        return SEQ_STEP_DONE;
+
+    if ((step & 1) == 0)
+    {
+        Error_LEDs_On(i);
+        return (uint32_t)ONTIME;
+    }
+    Error_LEDs_Off(i);
+    return (uint32_t)OFFTIME;
+}
+
+//=== Function: SeqStep_PWM_LEDs ==================================================================
+///
+/// @brief  Step function of PWM_LEDs_Check(), two steps (on, off) per group of PWM LEDs.
+///         In PWM_LED_CHECK_FADE mode the first step starts the fade engine and the second one
+///         stops it after Repeat_count passes through the curve
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_PWM_LEDs(uint32_t step)
+{
+    int i = (step / 2) % 8;
+
+    if (pwmLedCheckMode == PWM_LED_CHECK_FADE)
+    {
+        uint32_t timeUs;
+
+        if (step != 0)
+        {
+            LedFadeStop();
+            return SEQ_STEP_DONE;
+        }
+        timeUs = LedFadeStartCheck(Repeat_count);
+        return (timeUs != 0) ? timeUs : SEQ_STEP_DONE;
+    }
+
+    if (step >= (uint32_t)Repeat_count * 8 * 2)
+        return SEQ_STEP_DONE;
+
+    if ((step & 1) == 0)
+    {
+        PWM_LEDs_On(i);
+        return (uint32_t)ONTIME;
+    }
+    PWM_LEDs_Off(i);
+    return (uint32_t)OFFTIME;
+}
+
+//=== Function: SeqStep_GPIOLEDs ==================================================================
+///
+/// @brief  Step function of GPIOLEDs_Check(), two steps (on, off) per row of GPIO LEDs.
+///         In GPIO_LED_CHECK_LOOPBACK mode the loopback check is the only step
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_GPIOLEDs(uint32_t step)
+{
+    int i = (step / 2) % 10;
+
+    if (gpioLedCheckMode == GPIO_LED_CHECK_LOOPBACK)
+    {
+        if (step == 0)
+            LedLoopbackCheck(&ledGpioGroup, &gpioLedLoopback);
+        return SEQ_STEP_DONE;
+    }
+
+    if (step >= 16UL * 10 * 2)
+        return SEQ_STEP_DONE;
+
+    if ((step & 1) == 0)
+    {
+        GPIOLEDs_On(i);
+        return (uint32_t)ONTIME;
+    }
+    GPIOLEDs_Off(i);
+    return (uint32_t)OFFTIME;
+}
+
+//=== Function: SeqStep_Hardware_Error_Detection ==================================================
+///
+/// @brief  Step function of Hardware_Error_Detection_Check(), ten steps per repetition. The
+///         CLB monitor is armed in the first step and checked after the last one, the hardware
+///         trip of the PWMs is disarmed for the same time. The step after every pulse reads
+///         its detection latency (TripLatencyMeasure()) before the mux is changed
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_Hardware_Error_Detection(uint32_t step)
+{
+    if (step >= (uint32_t)Repeat_count * 10)
+    {
+        //  every line must have seen all pulses, afterwards every edge is abnormal
+        ClbCheck(Repeat_count);
+        TripLatencyCheck(Repeat_count);
+        ClbArm(0);
+        TripArm();
+        return SEQ_STEP_DONE;
+    }
+
+    switch (step % 10)
+    {
+        case 0:
+            if (step == 0)
+            {
+                ClbArm(Repeat_count);
+                TripDisarm();
+                TripLatencyClear();
+            }
+            Mux_Select(0);
+            return (uint32_t)ONTIME;
+        case 1:
+            TripLatencyInject(0);
+            return (uint32_t)OFFTIME;
+        case 2:
+            TripLatencyMeasure(0);
+            Mux_Select(23);
+            Mux_Select(5);
+            return (uint32_t)ONTIME;
+        case 3:
+            TripLatencyInject(1);
+            return (uint32_t)OFFTIME;
+        case 4:
+            TripLatencyMeasure(1);
+            Mux_Select(23);
+            Mux_Select(11);
+            return (uint32_t)ONTIME;
+        case 5:
+            TripLatencyInject(2);
+            return (uint32_t)OFFTIME;
+        case 6:
+            TripLatencyMeasure(2);
+            Mux_Select(23);
+            Mux_Select(13);
+            return (uint32_t)ONTIME;
+        case 7:
+            TripLatencyInject(3);
+            return (uint32_t)OFFTIME;
+        case 8:
+            TripLatencyMeasure(3);
+            Mux_Select(23);
+            return (uint32_t)OFFTIME;
+        default:
+            GpioDataRegs.GPDSET.bit.GPIO98  = 1;
+            GpioDataRegs.GPASET.bit.GPIO10  = 1;
+            GpioDataRegs.GPASET.bit.GPIO11  = 1;
+            GpioDataRegs.GPDSET.bit.GPIO97  = 1;
+            return (uint32_t)ONTIME;
+    }
+}
+
+//=== Function: SeqStep_ADCINs ====================================================================
+///
+/// @brief  Step function of ADCINs_Check(). With adcSweepMode = ADC_SWEEP_FULL 3900 DAC steps per
+///         mux channel followed by one step which switches the PWM_LEDs off and deselects the mux.
+///         With ADC_SWEEP_SPARSE one step per check point code, each step checks the result of the
+///         previous code and sets the next one. The codes run up and down on alternate channels
+///         (serpentine), so the DAC never steps across the full range. If the next channel is on
+///         another mux its address is set together with the last code, so the mux settles while
+///         the last code is measured. ADC_MeasureSettleTime() must be called before.
+///         All results are added to the channel statistics (adcStats)
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_ADCINs(uint32_t step)
+{
+    uint32_t stepsPerChannel = (adcSweepMode == ADC_SWEEP_SPARSE)
+                             ? ADC_NUMBER_OF_CHECK_CODES + 1 : ADC_SWEEP_CODES + 1;
+    uint32_t r = step % (32 * stepsPerChannel);
+    int i = r / stepsPerChannel;
+    uint16_t j = r % stepsPerChannel;
+
+    if (step >= (uint32_t)Repeat_count * 32 * stepsPerChannel)
+        return SEQ_STEP_DONE;
+
+    if (step == 0)
+        AdcStatsReset();
+
+    if (step == 0)
+        seqMuxPreselected = false;
+
+    if (adcSweepMode == ADC_SWEEP_SPARSE)
+    {
+        if (j == 0)
+        {
+            // Mux already settled if it was preselected during the last channel
+            uint32_t timeUs = seqMuxPreselected ? 1 : SEQ_ADC_SETTLE_US;
+
+            seqMuxPreselected = false;
+            Mux_Select(i);
+            ADC_SetDACs(SEQ_ADC_CHECK_CODE(i, 0));
+            return timeUs;
+        }
+
+        ADCtoPWM(i);
+        ADC_ErrorCheck(i);
+        AdcStatsEvaluateChannel(i, SEQ_ADC_CHECK_CODE(i, j - 1));
+
+        if (j == ADC_NUMBER_OF_CHECK_CODES)
+        {
+            ADCtoPWM(32);
+            if (seqMuxPreselected)
+                Mux_Release(i);
+            else
+                Mux_Select(23);
+            return 1;
+        }
+        ADC_SetDACs(SEQ_ADC_CHECK_CODE(i, j));
+        // Last code of this channel: the next mux (if another one) settles in parallel
+        if (j == ADC_NUMBER_OF_CHECK_CODES - 1 && step / stepsPerChannel + 1 < (uint32_t)Repeat_count * 32)
+            seqMuxPreselected = Mux_Preselect((i + 1) % 32);
+        return SEQ_ADC_SETTLE_US;
+    }
+
+    // Result of the previous DAC step
+    if (j > 0)
+        AdcStatsEvaluateChannel(i, j - 1);
+
+    if (j == ADC_SWEEP_CODES)
+    {
+        ADCtoPWM(32);
+        Mux_Select(23);
+        return 1;
+    }
+
+    if (j == 0)
+        Mux_Select(i);
+
+    ADC_SetDACs(j);
+    ADCtoPWM(i);
+    if(j == 1000 || j == 2000 || j == 3000 || j>3898)
+        ADC_ErrorCheck(i);
+
+    return SEQ_ADC_STEP_US;
+}
+
+//=== Function: SeqStep_TestPlan ==================================================================
+///
+/// @brief  Step function of the downloaded test plan, one step per wait of the plan
+///         (see TestPlanExecute())
+///
+/// @param  uint32_t step
+///
+/// @return uint32_t timeUs
+///
+//=================================================================================================
+uint32_t SeqStep_TestPlan(uint32_t step)
+{
+    return TestPlanExecute(step);
+}
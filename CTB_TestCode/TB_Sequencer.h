@@ -0,0 +1,97 @@
+//=================================================================================================
+/// @file     TB_Sequencer.h
+///
+/// @brief    File contains a non-blocking test sequencer for the CTB checks. Every check is split
+///           into steps, each step returns the time until the next step. CPU-Timer 1 is reloaded
+///           with this time and its ISR executes the next step, so the main loop stays free
+///           while the checks are running.
+///           With SequencerStartFrameLocked() the steps are clocked by the ADC DMA frames
+///           instead (one frame per ePWM1 SOCA, see TB_DMA): DmaAdcFrameDone() calls
+///           SequencerFrame(), which counts the time of a step down in whole frames. Mux
+///           addresses and DAC codes then always change right after a completed frame and are
+///           measured a fixed number of SOC events later
+///
+/// @version  V1.2.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYSEQUENCER_H_
+#define MYSEQUENCER_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Functions.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Return value of a step function when the check is finished
+#define SEQ_STEP_DONE               0xFFFFFFFFUL
+// CPU-Timer 1 ticks per us (SYSCLK = 200 MHz)
+#define SEQ_TIMER_TICKS_PER_US      200UL
+// Time of one ADC DMA frame in us (ePWM1 period), time base of SequencerStartFrameLocked()
+#define SEQ_FRAME_US                5UL
+// Analog checks clocked by the ADC DMA frames (1) or by CPU-Timer 1 (0), needs ADC_CAPTURE_DMA
+#define SEQ_FRAME_LOCKED            1
+// Time between two DAC steps of the ADCIN check in us
+#if ADC_CAPTURE_DMA
+#define SEQ_ADC_STEP_US             (ADC_SETTLE_FRAMES * 5UL)
+#else
+#define SEQ_ADC_STEP_US             500UL
+#endif
+// Time between two check point codes of the sparse ADCIN check in us (measured settling time)
+#define SEQ_ADC_SETTLE_US           ((uint32_t)adcSettleFrames * 5UL)
+// Check point code n of channel i: up on even and down on odd channels (serpentine order)
+#define SEQ_ADC_CHECK_CODE(i, n)    adcCheckCodes[((i) & 1) ? ADC_NUMBER_OF_CHECK_CODES - 1 - (n) : (n)]
+// Number of checks in the LED and in the analog sequence
+#define SEQ_NUMBER_OF_LED_CHECKS        3
+#define SEQ_NUMBER_OF_CPU1_LED_CHECKS   2
+#define SEQ_NUMBER_OF_ANALOG_CHECKS     2
+#define SEQ_NUMBER_OF_TESTPLAN_CHECKS   1
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Step function of a check: executes step "step" and returns the time
+// in us until the next step or SEQ_STEP_DONE if the check is finished
+typedef uint32_t (*SeqStepFunction)(uint32_t step);
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Checks of the LED sequence (GPIO mode of all LED pins)
+extern const SeqStepFunction seqLedChecks[SEQ_NUMBER_OF_LED_CHECKS];
+// Checks of the LED sequence without the GPIO LED check (executed by CPU2)
+extern const SeqStepFunction seqCpu1LedChecks[SEQ_NUMBER_OF_CPU1_LED_CHECKS];
+// Checks of the analog sequence (after PwmInitAll(), DACInitAll() and AdcInitAll())
+extern const SeqStepFunction seqAnalogChecks[SEQ_NUMBER_OF_ANALOG_CHECKS];
+// Downloaded test plan (TB_TestPlan, after the analog checks)
+extern const SeqStepFunction seqTestPlanChecks[SEQ_NUMBER_OF_TESTPLAN_CHECKS];
+// Next mux channel is preselected (set by SeqStep_ADCINs())
+extern bool seqMuxPreselected;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function starts a sequence of checks with CPU-Timer 1
+extern void SequencerStart(const SeqStepFunction *checks, uint16_t numberOfChecks);
+// Function starts a sequence of checks clocked by the ADC DMA frames
+extern void SequencerStartFrameLocked(const SeqStepFunction *checks, uint16_t numberOfChecks);
+// Function counts one ADC DMA frame and executes the next step when it is due
+extern void SequencerFrame(void);
+// Function returns true if the started sequence is finished
+extern bool SequencerFinished(void);
+// Step functions of the checks
+extern uint32_t SeqStep_Error_LEDs(uint32_t step);
+extern uint32_t SeqStep_PWM_LEDs(uint32_t step);
+extern uint32_t SeqStep_GPIOLEDs(uint32_t step);
+extern uint32_t SeqStep_Hardware_Error_Detection(uint32_t step);
+extern uint32_t SeqStep_ADCINs(uint32_t step);
+extern uint32_t SeqStep_TestPlan(uint32_t step);
+// ISR of CPU-Timer 1, executes the next step
+__interrupt void SequencerISR(void);
+
+#endif
@@ -0,0 +1,442 @@
+//=================================================================================================
+/// @file     TB_Sfra.c
+///
+/// @brief    File contains the perturbation and correlation of the frequency response analyzer
+///           (ISR) and the sweep, evaluation and UART frames (main loop). See TB_Sfra.h for
+///           the measurement and the frames
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Sfra.h"
+#include "TB_DMA.h"
+#include "TB_Sequencer.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by DmaAdcFrameDone(), run from LSx RAM like the ISR (see TB_Sequencer.c)
+#pragma CODE_SECTION(SfraInject, ".TI.ramfunc");
+#pragma CODE_SECTION(SfraCollect, ".TI.ramfunc");
+#pragma CODE_SECTION(SfraFrame, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+SfraPoint sfraLastPoint;
+
+// Measurement of the current point. The ISR only changes the state from SETTLE to MEASURE and
+// from MEASURE to DONE, the parameters and the sums are only written by the main loop while the
+// state is IDLE or DONE
+static volatile uint16_t sfraState = SFRA_STATE_IDLE;
+static uint32_t sfraCount;
+static uint32_t sfraMeasureFrames;
+static float32 sfraAmplitude;
+// Oscillator of the perturbation (sine/cosine of the sample) and the rotation per sample
+static float32 sfraSin;
+static float32 sfraCos;
+static float32 sfraRotationSin;
+static float32 sfraRotationCos;
+// Correlation of the input and of the output with the cosine and the sine
+static float32 sfraInputCos;
+static float32 sfraInputSin;
+static float32 sfraOutputCos;
+static float32 sfraOutputSin;
+
+// Sweep (start frame of the host)
+static uint16_t sfraNumberOfPoints = 0;
+static uint16_t sfraPointIndex = 0;
+static float32 sfraStartFrequency;
+static float32 sfraFrequencyRatio;
+static float32 sfraFrequency;
+static uint16_t sfraChannel = 0;
+// DAC code written by the last SfraFrame() (input of the next sample)
+static uint16_t sfraDacCode = SFRA_DAC_OFFSET;
+
+static uint16_t sfraAnswer = SFRA_NO_ANSWER;
+static bool sfraPointPending = false;
+
+static uint16_t sfraRxBytes[SFRA_SETUP_BYTES];
+static uint16_t sfraRxIndex = 0;
+static uint16_t sfraRxChecksum;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SfraSetDacs =======================================================================
+///
+/// @brief  Function writes the same code into DAC A, B and C (like ADC_SetDACs(), without the
+///         reference of the PPB check)
+///
+/// @param  uint16_t code
+///
+/// @return void
+///
+//=================================================================================================
+static void SfraSetDacs(uint16_t code)
+{
+    DacaRegs.DACVALS.bit.DACVALS = code;
+    DacbRegs.DACVALS.bit.DACVALS = code;
+    DaccRegs.DACVALS.bit.DACVALS = code;
+    sfraDacCode = code;
+}
+
+//=== Function: SfraStartPoint ====================================================================
+///
+/// @brief  Function starts the measurement of the current point of the sweep. The frequency is
+///         rounded to an integer number of periods in about SFRA_MEASURE_FRAMES samples
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SfraStartPoint(void)
+{
+    float32 frequency = sfraStartFrequency;
+    float32 periods;
+    float32 omega;
+    uint32_t settleFrames;
+
+    if (sfraNumberOfPoints > 1)
+        frequency *= powf(sfraFrequencyRatio, (float32)sfraPointIndex / (float32)(sfraNumberOfPoints - 1));
+
+    periods = floorf((float32)SFRA_MEASURE_FRAMES * frequency / SFRA_SAMPLE_HZ + 0.5f);
+    if (periods < 1.0f)
+        periods = 1.0f;
+    sfraMeasureFrames = (uint32_t)(periods * SFRA_SAMPLE_HZ / frequency + 0.5f);
+    sfraFrequency = periods * SFRA_SAMPLE_HZ / (float32)sfraMeasureFrames;
+
+    settleFrames = (uint32_t)((float32)SFRA_SETTLE_PERIODS * SFRA_SAMPLE_HZ / sfraFrequency + 0.5f);
+    if (settleFrames < SFRA_MIN_SETTLE_FRAMES)
+        settleFrames = SFRA_MIN_SETTLE_FRAMES;
+
+    omega = 2.0f * SFRA_PI * periods / (float32)sfraMeasureFrames;
+    sfraRotationSin = sinf(omega);
+    sfraRotationCos = cosf(omega);
+    sfraSin = 0.0f;
+    sfraCos = 1.0f;
+    sfraInputCos = 0.0f;
+    sfraInputSin = 0.0f;
+    sfraOutputCos = 0.0f;
+    sfraOutputSin = 0.0f;
+    sfraCount = settleFrames;
+
+    // All parameters are written before the ISR sees the new state
+    sfraState = SFRA_STATE_SETTLE;
+}
+
+//=== Function: SfraEvaluate ======================================================================
+///
+/// @brief  Function computes the gain and the phase of output / input of the measured point.
+///         With X = Xc - jXs and Y = Yc - jYs (correlation with cosine and sine):
+///         Y / X = (Yc Xc + Ys Xs + j (Yc Xs - Ys Xc)) / |X|^2
+///
+/// @param  SfraPoint *point
+///
+/// @return void
+///
+//=================================================================================================
+static void SfraEvaluate(SfraPoint *point)
+{
+    float32 inputPower = sfraInputCos * sfraInputCos + sfraInputSin * sfraInputSin;
+    float32 real = sfraOutputCos * sfraInputCos + sfraOutputSin * sfraInputSin;
+    float32 imaginary = sfraOutputCos * sfraInputSin - sfraOutputSin * sfraInputCos;
+
+    point->index = sfraPointIndex;
+    point->frequency = sfraFrequency;
+    if (inputPower > 0.0f && (real != 0.0f || imaginary != 0.0f))
+    {
+        point->gain = 10.0f * log10f((real * real + imaginary * imaginary) / (inputPower * inputPower));
+        point->phase = atan2f(imaginary, real) * (180.0f / SFRA_PI);
+    }
+    else
+    {
+        // No response measured
+        point->gain = -1000.0f;
+        point->phase = 0.0f;
+    }
+}
+
+//=== Function: SfraSendPoint =====================================================================
+///
+/// @brief  Function sends the frame of a measured point if the transmit FIFO has room for the
+///         whole frame
+///
+/// @param  const SfraPoint *point
+///
+/// @return bool sent
+///
+//=================================================================================================
+static bool SfraSendPoint(const SfraPoint *point)
+{
+    uint16_t frame[SFRA_FRAME_BYTES];
+    const float32 *values[3] = {&point->frequency, &point->gain, &point->phase};
+    uint16_t length = 0;
+    uint16_t checksum = 0;
+
+    if (UartTxFree() < SFRA_FRAME_BYTES)
+        return false;
+
+    frame[length++] = SFRA_SYNC;
+    frame[length++] = point->index;
+    frame[length++] = sfraNumberOfPoints;
+    for (uint16_t j = 0; j < 3; j++)
+    {
+        uint32_t value = *(const uint32_t *)values[j];
+
+        for (uint16_t i = 0; i < 4; i++)
+            frame[length++] = (uint16_t)(value >> (8 * i)) & 0x00FF;
+    }
+    for (uint16_t i = 1; i < length; i++)
+        checksum += frame[i];
+    frame[length++] = checksum & 0x00FF;
+
+    UartWriteBytes(frame, length);
+    return true;
+}
+
+//=== Function: SfraStart =========================================================================
+///
+/// @brief  Function stops a running sweep and starts a new one, no sweep for 0 points
+///
+/// @param  uint16_t numberOfPoints, uint16_t startFrequency, uint16_t stopFrequency,
+///         uint16_t amplitude (DAC codes), uint16_t channel (index in the DMA frame)
+///
+/// @return void
+///
+//=================================================================================================
+static void SfraStart(uint16_t numberOfPoints, uint16_t startFrequency, uint16_t stopFrequency,
+                      uint16_t amplitude, uint16_t channel)
+{
+    sfraState = SFRA_STATE_IDLE;
+    sfraPointPending = false;
+    SfraSetDacs(SFRA_DAC_OFFSET);
+
+    sfraNumberOfPoints = numberOfPoints;
+    sfraPointIndex = 0;
+    if (numberOfPoints == 0)
+        return;
+
+    sfraStartFrequency = (float32)startFrequency;
+    sfraFrequencyRatio = (float32)stopFrequency / (float32)startFrequency;
+    sfraAmplitude = (float32)amplitude;
+    sfraChannel = channel;
+    SfraStartPoint();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SfraInit ==========================================================================
+///
+/// @brief  Function stops a sweep and clears the receiver
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SfraInit(void)
+{
+    sfraState = SFRA_STATE_IDLE;
+    sfraNumberOfPoints = 0;
+    sfraPointIndex = 0;
+    sfraPointPending = false;
+    sfraAnswer = SFRA_NO_ANSWER;
+    sfraRxIndex = 0;
+}
+
+//=== Function: SfraReceive =======================================================================
+///
+/// @brief  Function processes one byte of a start frame after SFRA_REQUEST. A complete frame
+///         with a correct checksum and valid parameters starts a new sweep (0 points: stop)
+///         and is answered with SFRA_ACK, every other frame with SFRA_NAK. The answer is sent
+///         by SfraService()
+///
+/// @param  uint16_t byte
+///
+/// @return bool done (true: the frame has ended, the next byte belongs to another frame)
+///
+//=================================================================================================
+bool SfraReceive(uint16_t byte)
+{
+    uint16_t numberOfPoints;
+    uint16_t startFrequency;
+    uint16_t stopFrequency;
+    uint16_t amplitude;
+    uint16_t channel;
+    bool valid;
+
+    if (sfraRxIndex < SFRA_SETUP_BYTES)
+    {
+        sfraRxChecksum = (sfraRxIndex == 0) ? byte : sfraRxChecksum + byte;
+        sfraRxBytes[sfraRxIndex++] = byte;
+        return false;
+    }
+    sfraRxIndex = 0;
+
+    numberOfPoints = sfraRxBytes[0];
+    startFrequency = sfraRxBytes[1] | (sfraRxBytes[2] << 8);
+    stopFrequency = sfraRxBytes[3] | (sfraRxBytes[4] << 8);
+    amplitude = sfraRxBytes[5] | (sfraRxBytes[6] << 8);
+    channel = sfraRxBytes[7];
+
+    valid = (byte == (sfraRxChecksum & 0x00FF));
+    if (numberOfPoints > 0)
+    {
+        valid = valid && numberOfPoints <= SFRA_MAX_POINTS
+                && startFrequency >= SFRA_MIN_FREQUENCY_HZ && stopFrequency <= SFRA_MAX_FREQUENCY_HZ
+                && startFrequency <= stopFrequency
+                && amplitude > 0 && amplitude <= SFRA_MAX_AMPLITUDE
+                && channel < DMA_ADC_FRAME_SIZE
+                && SequencerFinished();
+    }
+
+    if (valid)
+        SfraStart(numberOfPoints, startFrequency, stopFrequency, amplitude, channel);
+    sfraAnswer = valid ? SFRA_ACK : SFRA_NAK;
+    return true;
+}
+
+//=== Function: SfraInject ========================================================================
+///
+/// @brief  Function returns the reference with the perturbation of the current sample while a
+///         point is measured, otherwise the reference. Has to be called before SfraCollect()
+///         of the same sample
+///
+/// @param  float32 reference
+///
+/// @return float32 reference
+///
+//=================================================================================================
+float32 SfraInject(float32 reference)
+{
+    uint16_t state = sfraState;
+
+    if (state != SFRA_STATE_SETTLE && state != SFRA_STATE_MEASURE)
+        return reference;
+
+    return reference + sfraAmplitude * sfraSin;
+}
+
+//=== Function: SfraCollect =======================================================================
+///
+/// @brief  Function correlates the input and the output of the current sample with the cosine
+///         and the sine of the perturbation after the settling time and rotates the oscillator
+///         to the next sample. After SFRA_STATE_MEASURE the point is left to SfraService()
+///
+/// @param  float32 input, float32 output (without their DC values if known, less rounding)
+///
+/// @return void
+///
+//=================================================================================================
+void SfraCollect(float32 input, float32 output)
+{
+    uint16_t state = sfraState;
+    float32 s = sfraSin;
+    float32 c = sfraCos;
+
+    if (state == SFRA_STATE_MEASURE)
+    {
+        sfraInputCos += input * c;
+        sfraInputSin += input * s;
+        sfraOutputCos += output * c;
+        sfraOutputSin += output * s;
+        if (--sfraCount == 0)
+            sfraState = SFRA_STATE_DONE;
+    }
+    else if (state == SFRA_STATE_SETTLE)
+    {
+        if (--sfraCount == 0)
+        {
+            sfraCount = sfraMeasureFrames;
+            sfraState = SFRA_STATE_MEASURE;
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    sfraSin = s * sfraRotationCos + c * sfraRotationSin;
+    sfraCos = c * sfraRotationCos - s * sfraRotationSin;
+}
+
+//=== Function: SfraFrame =========================================================================
+///
+/// @brief  Function measures the analog path of the CTB: the selected ADC result of the
+///         completed DMA frame is the output to the DAC code written one frame before. Then the
+///         DACs get the offset with the perturbation of the next sample. Returns at once if no
+///         point is measured. Called from DmaAdcFrameDone()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SfraFrame(void)
+{
+    float32 code;
+
+    if (sfraState != SFRA_STATE_SETTLE && sfraState != SFRA_STATE_MEASURE)
+        return;
+
+    SfraCollect((float32)sfraDacCode - (float32)SFRA_DAC_OFFSET,
+                (float32)(dmaAdcFrame[sfraChannel] & 0x0FFF) - (float32)SFRA_DAC_OFFSET);
+
+    code = SfraInject((float32)SFRA_DAC_OFFSET) + 0.5f;
+    if (code < 0.0f)
+        code = 0.0f;
+    else if (code > (float32)SFRA_DAC_MAX)
+        code = (float32)SFRA_DAC_MAX;
+    SfraSetDacs((uint16_t)code);
+}
+
+//=== Function: SfraService =======================================================================
+///
+/// @brief  Function sends the pending answer, evaluates a measured point, sends its frame and
+///         starts the next point of the sweep. The frames are only written when the transmit
+///         FIFO has room, it never waits for the UART. Called in the main loop
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SfraService(void)
+{
+    if (sfraAnswer != SFRA_NO_ANSWER && UartTxFree() > 0)
+    {
+        UartWriteBytes(&sfraAnswer, 1);
+        sfraAnswer = SFRA_NO_ANSWER;
+    }
+
+    if (sfraState == SFRA_STATE_DONE && !sfraPointPending)
+    {
+        SfraSetDacs(SFRA_DAC_OFFSET);
+        SfraEvaluate(&sfraLastPoint);
+        sfraPointPending = true;
+    }
+
+    if (!sfraPointPending || !SfraSendPoint(&sfraLastPoint))
+        return;
+    sfraPointPending = false;
+
+    if (++sfraPointIndex < sfraNumberOfPoints)
+    {
+        SfraStartPoint();
+    }
+    else
+    {
+        sfraState = SFRA_STATE_IDLE;
+        sfraNumberOfPoints = 0;
+    }
+}
@@ -0,0 +1,116 @@
+//=================================================================================================
+/// @file     TB_Sfra.h
+///
+/// @brief    File contains a software frequency response analyzer (SFRA). A small sinusoidal
+///           perturbation is added to a reference inside of the ISR (SfraInject()) and the
+///           input and the output of the measured path are correlated with the same sine and
+///           cosine (SfraCollect()), one frequency point after the other. Per sample the ISR
+///           only rotates the oscillator and adds four products; the frequencies, the gain and
+///           the phase are computed by SfraService() in the main loop, which also sends the
+///           Bode data over the UART of TB_UART.
+///           Every point is measured over an integer number of periods of the perturbation, so
+///           the correlation contains no leakage of the DC value or of other points. Each point
+///           starts with a settling time of SFRA_SETTLE_PERIODS periods, then about
+///           SFRA_MEASURE_FRAMES samples are correlated. The response is output / input:
+///           e.g. the loop gain with input = error and output = feedback of a control loop.
+///           On the CTB DmaAdcFrameDone() calls SfraFrame() for every DMA frame of TB_DMA (200 kHz),
+///           which injects into the code of DAC A, B and C (offset SFRA_DAC_OFFSET) and measures
+///           the selected ADC result, i.e. the response of the analog path DAC -> mux -> ADC
+///
+///           Start frame (host, bytes):
+///             SFRA_REQUEST, number of points n (0: stop), start frequency (16 bit, Hz),
+///             stop frequency (16 bit, Hz), amplitude (16 bit, DAC codes),
+///             ADC result (index in the DMA frame, see TB_DMA), checksum
+///             checksum: lower 8 bits of the sum of all bytes after SFRA_REQUEST
+///           The frame is answered with SFRA_ACK or SFRA_NAK. It is rejected while the sequencer
+///           runs (analog checks, test plan), because they use the same DACs.
+///           The points are spaced logarithmically. One frame is sent per measured point:
+///             SFRA_SYNC, point index, number of points n, frequency (float32, Hz),
+///             gain (float32, dB), phase (float32, degrees), checksum
+///             checksum: lower 8 bits of the sum of all bytes after SFRA_SYNC
+///           All values are little endian. The frequency is the one actually measured (integer
+///           number of periods in an integer number of samples)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYSFRA_H_
+#define MYSFRA_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: DmaAdcFrameDone() calls SfraFrame()
+#define SFRA_ENABLE                 1
+// Sample frequency of SfraInject()/SfraCollect() (DMA frames, ePWM1 period of 5 us)
+#define SFRA_SAMPLE_HZ              200000.0f
+// Limits of the start frame
+#define SFRA_MIN_FREQUENCY_HZ       10
+#define SFRA_MAX_FREQUENCY_HZ       20000
+#define SFRA_MAX_POINTS             100
+#define SFRA_MAX_AMPLITUDE          1000
+// Correlated samples per point (0.1 s, one period at SFRA_MIN_FREQUENCY_HZ), settling time
+#define SFRA_MEASURE_FRAMES         20000UL
+#define SFRA_SETTLE_PERIODS         2UL
+#define SFRA_MIN_SETTLE_FRAMES      200UL
+// DAC code around which the perturbation is injected (SfraFrame())
+#define SFRA_DAC_OFFSET             2048
+#define SFRA_DAC_MAX                4095
+#define SFRA_PI                     3.14159265f
+// Frame bytes
+#define SFRA_REQUEST                0x46
+#define SFRA_SYNC                   0xA9
+#define SFRA_ACK                    0x06
+#define SFRA_NAK                    0x15
+#define SFRA_NO_ANSWER              0xFFFF
+// Bytes of the start frame after SFRA_REQUEST without checksum, bytes of a point frame
+#define SFRA_SETUP_BYTES            8
+#define SFRA_FRAME_BYTES            16
+// States of the measurement (SETTLE and MEASURE inject the perturbation)
+#define SFRA_STATE_IDLE             0
+#define SFRA_STATE_SETTLE           1
+#define SFRA_STATE_MEASURE          2
+#define SFRA_STATE_DONE             3
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Result of one frequency point
+typedef struct
+{
+    uint16_t index;
+    float32 frequency;              // Hz
+    float32 gain;                   // dB
+    float32 phase;                  // degrees, -180..180
+} SfraPoint;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Last measured point (also readable in CCS)
+extern SfraPoint sfraLastPoint;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function stops a sweep and clears the receiver
+extern void SfraInit(void);
+// Function processes one byte of a start frame, returns true when the frame has ended
+extern bool SfraReceive(uint16_t byte);
+// Function returns the reference with the perturbation of the current sample
+extern float32 SfraInject(float32 reference);
+// Function correlates the input and the output of the current sample and advances the sample
+extern void SfraCollect(float32 input, float32 output);
+// Function injects into the DAC codes and measures the selected ADC result (DmaAdcFrameDone())
+extern void SfraFrame(void);
+// Function evaluates a measured point, sends it and starts the next one (main loop)
+extern void SfraService(void);
+
+#endif
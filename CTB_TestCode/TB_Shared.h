@@ -0,0 +1,51 @@
+//=================================================================================================
+/// @file     TB_Shared.h
+///
+/// @brief    File contains the layout of the shared GSx RAM used by CPU1 and CPU2 of the CTB test.
+///           CPU1 is master of RAMGS3 (commands to CPU2), CPU2 is master of RAMGS2 (results of
+///           CPU2). CPU1 sets TB_SHARED_IPC_FLAG after it has given RAMGS2 to CPU2, CPU2 must
+///           not write "cpu2ToCpu1[]" before. The file is linked into the CPU2 project
+///           (CTB_TestCode_CPU2/.project)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYSHARED_H_
+#define MYSHARED_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Size of the shared buffers in words
+#define TB_SHARED_SIZE                  8
+// Index in "cpu1ToCpu2[]": start of the GPIO LED check on CPU2
+#define TB_SHARED_GPIOLEDS_START        0
+// Index in "cpu2ToCpu1[]": state and number of finished cycles of the GPIO LED check
+#define TB_SHARED_GPIOLEDS_STATE        0
+#define TB_SHARED_GPIOLEDS_CYCLES       1
+// Values of TB_SHARED_GPIOLEDS_START
+#define TB_SHARED_CMD_NONE              0
+#define TB_SHARED_CMD_START             0xA55A
+// Values of TB_SHARED_GPIOLEDS_STATE
+#define TB_SHARED_STATE_IDLE            0
+#define TB_SHARED_STATE_RUNNING         1
+#define TB_SHARED_STATE_FINISHED        2
+// IPC flag which is set by CPU1 after RAMGS2 is given to CPU2 (IPC3, writes of CPU2 before are ignored)
+#define TB_SHARED_IPC_FLAG              0x8UL
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Commands of CPU1 to CPU2 (RAMGS3, written by CPU1)
+extern volatile uint16_t cpu1ToCpu2[TB_SHARED_SIZE];
+// Results of CPU2 for CPU1 (RAMGS2, written by CPU2)
+extern volatile uint16_t cpu2ToCpu1[TB_SHARED_SIZE];
+
+#endif
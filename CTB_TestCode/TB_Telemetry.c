@@ -0,0 +1,146 @@
+//=================================================================================================
+/// @file     TB_Telemetry.c
+///
+/// @brief    File contains a telemetry channel from CPU1 to the Connectivity Manager (CM) for the
+///           bulk transfer of ADC capture data over Ethernet/UDP. CPU1 collects DMA frames of
+///           TB_DMA into slots of a ring in the CPU1 to CM message RAM and publishes full slots,
+///           the CM sends every published slot without a copy as payload of one UDP packet.
+///           See TB_Telemetry.h for the layout and the protocol
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Telemetry.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by DmaAdcFrameDone(), runs from LSx RAM like the ISR (see TB_Sequencer.c)
+#ifdef CPU1
+#pragma CODE_SECTION(TelemetryPublishFrame, ".TI.ramfunc");
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ring of slots (CPU1 writes, the CM and the EMAC DMA only read)
+TelemetryCpu1Area telemetryCpu1;
+#pragma DATA_SECTION(telemetryCpu1,"MSGRAM_CPU_TO_CM");
+// Transmit state of the CM (the CM writes, CPU1 only reads)
+TelemetryCmArea telemetryCm;
+#pragma DATA_SECTION(telemetryCm,"MSGRAM_CM_TO_CPU");
+
+#ifdef CPU1
+// Frames of the open slot, DMA frames since the last published one and dropped frames
+// since the last published slot
+static uint16_t telemetryFrameIndex;
+static uint16_t telemetryDecimationCount;
+static uint16_t telemetryDroppedFrames;
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TelemetryInit =====================================================================
+///
+/// @brief  Function clears the ring and sets the ready flag of CPU1. The CM starts sending when
+///         it has seen the flag and has set its own ready flag. Must be called before
+///         DmaInitAdcCapture()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TelemetryInit(void)
+{
+    telemetryCpu1.ready = 0;
+    telemetryCpu1.head = 0;
+    telemetryCpu1.droppedFrames = 0;
+
+    telemetryFrameIndex = 0;
+    telemetryDecimationCount = 0;
+    telemetryDroppedFrames = 0;
+
+    telemetryCpu1.ready = TELEMETRY_READY_KEY;
+}
+
+//=== Function: TelemetryEndpointReady ============================================================
+///
+/// @brief  Function returns true if the CM has set up its UDP endpoint
+///
+/// @param  void
+///
+/// @return bool ready
+///
+//=================================================================================================
+bool TelemetryEndpointReady(void)
+{
+    return telemetryCm.ready == TELEMETRY_READY_KEY;
+}
+
+//=== Function: TelemetryPublishFrame =============================================================
+///
+/// @brief  Function copies every TELEMETRY_DECIMATION-th DMA frame into the open slot. When the
+///         slot is full, its header is written and the slot is published by moving the head,
+///         then the CM is notified with TELEMETRY_IPC_FLAG. A slot is only opened if the CM has
+///         sent it, otherwise the frame is dropped and counted. Nothing is copied as long as the
+///         endpoint of the CM is not ready. Called from DmaAdcFrameDone()
+///
+/// @param  const volatile uint16_t *frame
+///
+/// @return void
+///
+//=================================================================================================
+void TelemetryPublishFrame(const volatile uint16_t *frame)
+{
+    uint16_t head = telemetryCpu1.head;
+    volatile TelemetrySlot *slot;
+    volatile uint16_t *destination;
+    uint16_t i;
+
+    if (!TelemetryEndpointReady())
+        return;
+
+    if (++telemetryDecimationCount < TELEMETRY_DECIMATION)
+        return;
+    telemetryDecimationCount = 0;
+
+    // All slots published and not sent yet, the CM is too slow
+    if ((uint16_t)(head - telemetryCm.tail) >= TELEMETRY_NUMBER_OF_SLOTS)
+    {
+        telemetryCpu1.droppedFrames++;
+        if (telemetryDroppedFrames < 0xFFFF)
+            telemetryDroppedFrames++;
+        return;
+    }
+
+    slot = &telemetryCpu1.slot[head & TELEMETRY_SLOT_MASK];
+    if (telemetryFrameIndex == 0)
+        slot->timestamp = DeviceGetTime();
+
+    destination = &slot->data[telemetryFrameIndex * DMA_ADC_FRAME_SIZE];
+    for (i = 0; i < DMA_ADC_FRAME_SIZE; i++)
+        destination[i] = frame[i];
+
+    if (++telemetryFrameIndex < TELEMETRY_FRAMES_PER_SLOT)
+        return;
+    telemetryFrameIndex = 0;
+
+    slot->sequence = head;
+    slot->numberOfFrames = TELEMETRY_FRAMES_PER_SLOT;
+    slot->frameSize = DMA_ADC_FRAME_SIZE;
+    slot->decimation = TELEMETRY_DECIMATION;
+    slot->droppedFrames = telemetryDroppedFrames;
+    telemetryDroppedFrames = 0;
+
+    // The slot is complete before the head is moved (the CM only reads up to the head)
+    telemetryCpu1.head = head + 1;
+    Cpu1toCmIpcRegs.CPU1TOCMIPCSET.all = TELEMETRY_IPC_FLAG;
+}
+#endif
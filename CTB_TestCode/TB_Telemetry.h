@@ -0,0 +1,100 @@
+//=================================================================================================
+/// @file     TB_Telemetry.h
+///
+/// @brief    File contains a telemetry channel from CPU1 to the Connectivity Manager (CM) for the
+///           bulk transfer of ADC capture data over Ethernet/UDP. CPU1 collects DMA frames of
+///           TB_DMA into slots of a ring in the CPU1 to CM message RAM (MSGRAM_CPU_TO_CM) and
+///           publishes a full slot by moving its head index and setting TELEMETRY_IPC_FLAG. The
+///           CM sends each published slot unchanged as the payload of one UDP packet (the EMAC
+///           descriptor points directly to the slot, no copy) and moves its tail index in the
+///           CM to CPU1 message RAM (MSGRAM_CM_TO_CPU) when the transmission is done. Every index
+///           is written by one core only. If the CM falls behind, CPU1 drops frames and counts
+///           them instead of waiting.
+///           The layout only uses 16 and 32 bit members on even word offsets, so the types can
+///           be used unchanged in the CM project (one C28x word = two bytes on the CM, the
+///           samples are little endian)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYTELEMETRY_H_
+#define MYTELEMETRY_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_DMA.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of slots of the ring (power of two)
+#define TELEMETRY_NUMBER_OF_SLOTS       4
+#define TELEMETRY_SLOT_MASK             (TELEMETRY_NUMBER_OF_SLOTS - 1)
+// DMA frames per slot (one UDP packet: 8 header words + 4 * 64 samples = 528 bytes)
+#define TELEMETRY_FRAMES_PER_SLOT       4
+#define TELEMETRY_SLOT_DATA_SIZE        (TELEMETRY_FRAMES_PER_SLOT * DMA_ADC_FRAME_SIZE)
+// Only every n-th DMA frame is published. One frame every 5 us would need 26 MB/s, with
+// 4 the stream needs 6.6 MB/s, which fits into a 100 Mbit/s link
+#define TELEMETRY_DECIMATION            4
+// Key of the ready flags of both cores
+#define TELEMETRY_READY_KEY             0x5AA5
+// IPC flag which is set by CPU1 for every published slot (CPU1 to CM IPC1)
+#define TELEMETRY_IPC_FLAG              0x2UL
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// One slot, sent as payload of one UDP packet (2 * sizeof(TelemetrySlot) bytes on CPU1)
+typedef struct
+{
+    uint32_t sequence;                  // number of the slot since TelemetryInit(), lets the
+                                        // receiver detect lost packets
+    uint32_t timestamp;                 // DeviceGetTime() of the first frame
+    uint16_t numberOfFrames;            // TELEMETRY_FRAMES_PER_SLOT
+    uint16_t frameSize;                 // DMA_ADC_FRAME_SIZE
+    uint16_t decimation;                // TELEMETRY_DECIMATION
+    uint16_t droppedFrames;             // frames dropped before this slot (saturated)
+    uint16_t data[TELEMETRY_SLOT_DATA_SIZE];
+} TelemetrySlot;
+
+// Area written by CPU1 (MSGRAM_CPU_TO_CM)
+typedef struct
+{
+    volatile uint16_t ready;            // TELEMETRY_READY_KEY when the ring is set up
+    volatile uint16_t head;             // number of published slots (free running)
+    volatile uint32_t droppedFrames;    // all dropped frames since TelemetryInit()
+    volatile TelemetrySlot slot[TELEMETRY_NUMBER_OF_SLOTS];
+} TelemetryCpu1Area;
+
+// Area written by the CM (MSGRAM_CM_TO_CPU)
+typedef struct
+{
+    volatile uint16_t ready;            // TELEMETRY_READY_KEY when the UDP endpoint is running
+    volatile uint16_t tail;             // number of sent slots (free running)
+} TelemetryCmArea;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ring of slots (MSGRAM_CPU_TO_CM, written by CPU1)
+extern TelemetryCpu1Area telemetryCpu1;
+// Transmit state of the CM (MSGRAM_CM_TO_CPU, written by the CM)
+extern TelemetryCmArea telemetryCm;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU1
+// Function clears the ring and sets the ready flag of CPU1
+extern void TelemetryInit(void);
+// Function returns true if the UDP endpoint of the CM is running
+extern bool TelemetryEndpointReady(void);
+// Function adds a DMA frame to the open slot and publishes the slot when it is full
+extern void TelemetryPublishFrame(const volatile uint16_t *frame);
+#endif
+
+#endif
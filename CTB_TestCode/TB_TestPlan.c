@@ -0,0 +1,365 @@
+//=================================================================================================
+/// @file     TB_TestPlan.c
+///
+/// @brief    File contains the download and the interpreter of the test plans. See TB_TestPlan.h
+///           for the frames
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_TestPlan.h"
+#include "TB_Functions.h"
+#include "TB_Sequencer.h"
+#include "TB_UART.h"
+#include "TB_Trace.h"
+#include "TB_Log.h"
+#include "TB_Datalog.h"
+#include "TB_Sfra.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// The interpreter is called by the sequencer ISR and runs from LSx RAM like the step functions
+#pragma CODE_SECTION(TestPlanExecute, ".TI.ramfunc");
+#pragma CODE_SECTION(TestPlanCompare, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+TestPlanStep testPlan[TESTPLAN_MAX_STEPS];
+uint16_t testPlanNumberOfSteps = 0;
+TestPlanResult testPlanResult;
+uint16_t testPlanRejected = 0;
+// Order of the TESTPLAN_LEDS_x defines
+static const LedGroup *const testPlanLedGroups[TESTPLAN_NUMBER_OF_LED_GROUPS] =
+{
+    &ledErrorGroup,
+    &ledPwmGroup,
+    &ledGpioGroup
+};
+// Download: received plan, state, received bytes of the frame and sum of the bytes
+static TestPlanStep testPlanRx[TESTPLAN_MAX_STEPS];
+static uint16_t testPlanRxState = TESTPLAN_RX_SYNC;
+static uint16_t testPlanRxNumberOfSteps = 0;
+static uint16_t testPlanRxBytes = 0;
+static uint16_t testPlanRxChecksum = 0;
+// Next step of the running plan, plan is waiting for the sequencer or running
+static uint16_t testPlanIndex = 0;
+static bool testPlanPending = false;
+static bool testPlanRunning = false;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TestPlanValid =====================================================================
+///
+/// @brief  Function checks opcode, argument and value of a received step
+///
+/// @param  const TestPlanStep *step
+///
+/// @return bool valid
+///
+//=================================================================================================
+static bool TestPlanValid(const TestPlanStep *step)
+{
+    switch (step->op)
+    {
+        case TESTPLAN_OP_END:
+            return true;
+        case TESTPLAN_OP_MUX:
+            return step->argument < MUX_NUMBER_OF_CHANNELS || step->argument == MUX_PARK;
+        case TESTPLAN_OP_DAC:
+            return step->value <= TESTPLAN_MAX_DAC_CODE;
+        case TESTPLAN_OP_WAIT:
+            return step->value <= TESTPLAN_MAX_WAIT_US;
+        case TESTPLAN_OP_SAMPLE:
+            return step->argument < ADC_PWM_NUMBER_OF_ROUTES;
+        case TESTPLAN_OP_COMPARE_MIN:
+        case TESTPLAN_OP_COMPARE_MAX:
+            return step->argument <= LED_NUMBER_OF_ERROR_LEDS;
+        case TESTPLAN_OP_LEDS:
+            return step->argument < TESTPLAN_NUMBER_OF_LED_GROUPS;
+        default:
+            return false;
+    }
+}
+
+//=== Function: TestPlanReceive ===================================================================
+///
+/// @brief  Function processes one received byte of a download frame. A complete frame with a
+///         correct checksum and valid steps is acknowledged and becomes the pending plan, every
+///         other frame is rejected. The plan is not accepted while a plan is pending or running.
+///         TRACE_DUMP_REQUEST outside of a frame sends the trace rings (TB_Trace), DLOG_REQUEST
+///         hands the following bytes to the datalogger (TB_Datalog) until its frame has ended,
+///         SFRA_REQUEST to the frequency response analyzer (TB_Sfra)
+///
+/// @param  uint16_t byte
+///
+/// @return void
+///
+//=================================================================================================
+static void TestPlanReceive(uint16_t byte)
+{
+    uint16_t answer = TESTPLAN_NAK;
+
+    switch (testPlanRxState)
+    {
+        case TESTPLAN_RX_SYNC:
+            if (byte == TESTPLAN_SYNC)
+                testPlanRxState = TESTPLAN_RX_COUNT;
+            else if (byte == TRACE_DUMP_REQUEST)
+                TraceDump();
+            else if (byte == DLOG_REQUEST)
+                testPlanRxState = TESTPLAN_RX_DATALOG;
+            else if (byte == SFRA_REQUEST)
+                testPlanRxState = TESTPLAN_RX_SFRA;
+            return;
+
+        case TESTPLAN_RX_DATALOG:
+            if (DlogReceive(byte))
+                testPlanRxState = TESTPLAN_RX_SYNC;
+            return;
+
+        case TESTPLAN_RX_SFRA:
+            if (SfraReceive(byte))
+                testPlanRxState = TESTPLAN_RX_SYNC;
+            return;
+
+        case TESTPLAN_RX_COUNT:
+            testPlanRxNumberOfSteps = byte;
+            testPlanRxBytes = 0;
+            testPlanRxChecksum = byte;
+            if (byte > TESTPLAN_MAX_STEPS)
+                break;
+            testPlanRxState = (byte == 0) ? TESTPLAN_RX_CHECKSUM : TESTPLAN_RX_STEPS;
+            return;
+
+        case TESTPLAN_RX_STEPS:
+        {
+            TestPlanStep *step = &testPlanRx[testPlanRxBytes / TESTPLAN_STEP_BYTES];
+            uint16_t offset = testPlanRxBytes % TESTPLAN_STEP_BYTES;
+
+            if (offset == 0)
+                step->op = byte;
+            else if (offset == 1)
+                step->argument = byte;
+            else if (offset == 2)
+                step->value = byte;
+            else
+                step->value |= (uint32_t)byte << (8 * (offset - 2));
+
+            testPlanRxChecksum += byte;
+            if (++testPlanRxBytes == testPlanRxNumberOfSteps * TESTPLAN_STEP_BYTES)
+                testPlanRxState = TESTPLAN_RX_CHECKSUM;
+            return;
+        }
+
+        default:
+            if (byte == (testPlanRxChecksum & 0x00FF) && !testPlanPending && !testPlanRunning)
+            {
+                uint16_t i;
+
+                for (i = 0; i < testPlanRxNumberOfSteps && TestPlanValid(&testPlanRx[i]); i++)
+                    ;
+                if (i == testPlanRxNumberOfSteps)
+                {
+                    for (i = 0; i < testPlanRxNumberOfSteps; i++)
+                        testPlan[i] = testPlanRx[i];
+                    testPlanNumberOfSteps = testPlanRxNumberOfSteps;
+                    testPlanPending = true;
+                    answer = TESTPLAN_ACK;
+                }
+            }
+            break;
+    }
+
+    if (answer == TESTPLAN_NAK)
+    {
+        testPlanRejected++;
+        LOG1(LOG_ID_PLAN_REJECTED, testPlanRejected);
+    }
+    testPlanRxState = TESTPLAN_RX_SYNC;
+    UartWriteBytes(&answer, 1);
+}
+
+//=== Function: TestPlanSendResult ================================================================
+///
+/// @brief  Function sends the result frame of the last run
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void TestPlanSendResult(void)
+{
+    uint16_t frame[TESTPLAN_RESULT_BYTES];
+    uint16_t checksum = 0;
+
+    frame[0] = TESTPLAN_SYNC;
+    frame[1] = testPlanResult.executedSteps & 0x00FF;
+    frame[2] = testPlanResult.failedCompares & 0x00FF;
+    frame[3] = testPlanResult.failedCompares >> 8;
+    frame[4] = testPlanResult.firstFailedStep & 0x00FF;
+    for (uint16_t i = 1; i < TESTPLAN_RESULT_BYTES - 1; i++)
+        checksum += frame[i];
+    frame[5] = checksum & 0x00FF;
+
+    UartWriteBytes(frame, TESTPLAN_RESULT_BYTES);
+}
+
+//=== Function: TestPlanCompare ===================================================================
+///
+/// @brief  Function counts a failed compare, keeps the first failed step and switches the
+///         Error_LED of the step on (argument 1..29, 0: no LED)
+///
+/// @param  const TestPlanStep *step, bool passed
+///
+/// @return void
+///
+//=================================================================================================
+static void TestPlanCompare(const TestPlanStep *step, bool passed)
+{
+    if (passed)
+        return;
+
+    if (testPlanResult.failedCompares < 0xFFFF)
+        testPlanResult.failedCompares++;
+    if (testPlanResult.firstFailedStep == TESTPLAN_NO_FAILED_STEP)
+        testPlanResult.firstFailedStep = testPlanIndex;
+    if (step->argument != 0)
+        Error_LEDs_On(step->argument);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TestPlanInit ======================================================================
+///
+/// @brief  Function clears the plan, the result and the download state. UartInit() must be
+///         called before (ReportInit())
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TestPlanInit(void)
+{
+    testPlanNumberOfSteps = 0;
+    testPlanRejected = 0;
+    testPlanRxState = TESTPLAN_RX_SYNC;
+    testPlanPending = false;
+    testPlanRunning = false;
+
+    testPlanResult.executedSteps = 0;
+    testPlanResult.failedCompares = 0;
+    testPlanResult.firstFailedStep = TESTPLAN_NO_FAILED_STEP;
+    testPlanResult.lastSample = 0;
+}
+
+//=== Function: TestPlanService ===================================================================
+///
+/// @brief  Function processes all received bytes of a download frame, starts a pending plan
+///         when the sequencer is free and sends the result frame when the plan is finished.
+///         Called in the main loop
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TestPlanService(void)
+{
+    uint16_t byte;
+
+    while (UartRead(&byte))
+        TestPlanReceive(byte);
+
+    if (testPlanRunning && SequencerFinished())
+    {
+        testPlanRunning = false;
+        TRACE(TRACE_CONTEXT_MAIN, TRACE_EVENT_PLAN_DONE, testPlanResult.failedCompares);
+        TestPlanSendResult();
+    }
+
+    if (testPlanPending && SequencerFinished())
+    {
+        testPlanPending = false;
+        testPlanRunning = true;
+        TRACE(TRACE_CONTEXT_MAIN, TRACE_EVENT_PLAN_START, testPlanNumberOfSteps);
+        SequencerStart(seqTestPlanChecks, SEQ_NUMBER_OF_TESTPLAN_CHECKS);
+    }
+}
+
+//=== Function: TestPlanExecute ===================================================================
+///
+/// @brief  Function executes the steps of the plan up to the next TESTPLAN_OP_WAIT and returns
+///         its time. Step 0 of the sequencer starts the plan with the first step and clears the
+///         result. The plan ends with TESTPLAN_OP_END or after its last step, the mux and DAC
+///         settings are kept (the host parks the muxes with TESTPLAN_OP_MUX MUX_PARK)
+///
+/// @param  uint32_t step (step of the sequencer)
+///
+/// @return uint32_t timeUs (SEQ_STEP_DONE at the end of the plan)
+///
+//=================================================================================================
+uint32_t TestPlanExecute(uint32_t step)
+{
+    if (step == 0)
+    {
+        testPlanIndex = 0;
+        testPlanResult.executedSteps = 0;
+        testPlanResult.failedCompares = 0;
+        testPlanResult.firstFailedStep = TESTPLAN_NO_FAILED_STEP;
+        testPlanResult.lastSample = 0;
+    }
+
+    EALLOW;
+    while (testPlanIndex < testPlanNumberOfSteps)
+    {
+        const TestPlanStep *s = &testPlan[testPlanIndex];
+
+        if (s->op == TESTPLAN_OP_END)
+            break;
+
+        testPlanResult.executedSteps++;
+        switch (s->op)
+        {
+            case TESTPLAN_OP_MUX:
+                Mux_Select(s->argument);
+                break;
+            case TESTPLAN_OP_DAC:
+                ADC_SetDACs((uint16_t)s->value);
+                break;
+            case TESTPLAN_OP_WAIT:
+                testPlanIndex++;
+                EDIS;
+                return s->value;
+            case TESTPLAN_OP_SAMPLE:
+                testPlanResult.lastSample = ADCtoPWM_Read(adcPwmRoute[s->argument].source);
+                break;
+            case TESTPLAN_OP_COMPARE_MIN:
+                TestPlanCompare(s, testPlanResult.lastSample >= s->value);
+                break;
+            case TESTPLAN_OP_COMPARE_MAX:
+                TestPlanCompare(s, testPlanResult.lastSample <= s->value);
+                break;
+            case TESTPLAN_OP_LEDS:
+                LedSetPattern(testPlanLedGroups[s->argument], s->value);
+                break;
+            default:
+                break;
+        }
+        testPlanIndex++;
+    }
+
+    EDIS;
+    return SEQ_STEP_DONE;
+}
@@ -0,0 +1,116 @@
+//=================================================================================================
+/// @file     TB_TestPlan.h
+///
+/// @brief    File contains an interpreter for test plans which are downloaded by the host over
+///           UART (TB_UART). A test plan is a list of steps (set mux, set DAC, wait, sample,
+///           compare, LED pattern) which is kept in RAM and executed by the sequencer (one call
+///           of SeqStep_TestPlan() runs all steps up to the next wait), so the test coverage can
+///           be changed per product variant without reflashing.
+///
+///           Download frame (bytes):
+///             TESTPLAN_SYNC, number of steps n, n * 6 bytes step, checksum
+///             step: opcode, argument, value (32 bit, little endian)
+///             checksum: lower 8 bits of the sum of all bytes after TESTPLAN_SYNC
+///           The frame is answered with TESTPLAN_ACK or TESTPLAN_NAK. An accepted plan is started
+///           when the sequencer is free, after the last step the result frame is sent:
+///             TESTPLAN_SYNC, executed steps, failed compares (16 bit, little endian),
+///             first failed step (0xFF: none), checksum
+///           The byte TRACE_DUMP_REQUEST between two frames requests the dump of the event trace
+///           (TB_Trace), the byte DLOG_REQUEST starts a select frame of the datalogger
+///           (TB_Datalog), the byte SFRA_REQUEST starts a start frame of the frequency response
+///           analyzer (TB_Sfra)
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYTESTPLAN_H_
+#define MYTESTPLAN_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Largest number of steps of a plan (the number is sent as one byte)
+#define TESTPLAN_MAX_STEPS          128
+// Bytes of one step in the download frame
+#define TESTPLAN_STEP_BYTES         6
+// Frame bytes
+#define TESTPLAN_SYNC               0xA5
+#define TESTPLAN_ACK                0x06
+#define TESTPLAN_NAK                0x15
+#define TESTPLAN_NO_FAILED_STEP     0xFF
+#define TESTPLAN_RESULT_BYTES       6
+// Opcodes of the steps
+#define TESTPLAN_OP_END             0       // end of the plan
+#define TESTPLAN_OP_MUX             1       // argument: mux channel (0..20 or MUX_PARK)
+#define TESTPLAN_OP_DAC             2       // value: code of DAC A, B and C (0..4095)
+#define TESTPLAN_OP_WAIT            3       // value: time in us until the next step
+#define TESTPLAN_OP_SAMPLE          4       // argument: route of adcPwmRoute (0..31)
+#define TESTPLAN_OP_COMPARE_MIN     5       // sample >= value, argument: Error_LED on failure
+#define TESTPLAN_OP_COMPARE_MAX     6       // sample <= value, argument: Error_LED on failure
+#define TESTPLAN_OP_LEDS            7       // argument: TESTPLAN_LEDS_x, value: LED pattern
+#define TESTPLAN_NUMBER_OF_OPS      8
+// LED groups of TESTPLAN_OP_LEDS
+#define TESTPLAN_LEDS_ERROR         0
+#define TESTPLAN_LEDS_PWM           1       // only while the PWM_LED pins are GPIOs
+#define TESTPLAN_LEDS_GPIO          2
+#define TESTPLAN_NUMBER_OF_LED_GROUPS   3
+// Limits of the steps (the time of a sequencer step must fit into CPU-Timer 1)
+#define TESTPLAN_MAX_WAIT_US        10000000UL
+#define TESTPLAN_MAX_DAC_CODE       4095
+// States of the download
+#define TESTPLAN_RX_SYNC            0
+#define TESTPLAN_RX_COUNT           1
+#define TESTPLAN_RX_STEPS           2
+#define TESTPLAN_RX_CHECKSUM        3
+#define TESTPLAN_RX_DATALOG         4       // bytes of a select frame of TB_Datalog
+#define TESTPLAN_RX_SFRA            5       // bytes of a start frame of TB_Sfra
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// One step of a plan
+typedef struct
+{
+    uint16_t op;                    // TESTPLAN_OP_x
+    uint16_t argument;
+    uint32_t value;
+} TestPlanStep;
+
+// Result of the last run
+typedef struct
+{
+    uint16_t executedSteps;
+    uint16_t failedCompares;
+    uint16_t firstFailedStep;       // TESTPLAN_NO_FAILED_STEP if all compares passed
+    uint16_t lastSample;
+} TestPlanResult;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Accepted plan (executed by the sequencer) and its number of steps
+extern TestPlanStep testPlan[TESTPLAN_MAX_STEPS];
+extern uint16_t testPlanNumberOfSteps;
+// Result of the last run
+extern TestPlanResult testPlanResult;
+// Downloaded frames which were rejected (checksum or invalid step)
+extern uint16_t testPlanRejected;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function clears the plan and the download state
+extern void TestPlanInit(void);
+// Function receives plans over UART, starts them and sends the result (called in the main loop)
+extern void TestPlanService(void);
+// Function executes the plan from step "step" up to the next wait (called by SeqStep_TestPlan())
+extern uint32_t TestPlanExecute(uint32_t step);
+
+#endif
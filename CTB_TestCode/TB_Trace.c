@@ -0,0 +1,193 @@
+//=================================================================================================
+/// @file     TB_Trace.c
+///
+/// @brief    File contains the rings of the event trace and their dump over UART. See TB_Trace.h
+///           for the records and the frame
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Trace.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the ISRs, runs from LSx RAM like them
+#pragma CODE_SECTION(TraceEvent, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Set by TraceArm() before the rings are read, therefore not zeroed by the C startup
+#pragma DATA_SECTION(traceRings, "noinitbuf");
+TraceRing traceRings[TRACE_NUMBER_OF_CONTEXTS];
+volatile uint16_t traceTriggerId = TRACE_EVENT_NONE;
+volatile bool traceFrozen = true;
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TraceSend =========================================================================
+///
+/// @brief  Function sends the lower 8 bits of "numberOfBytes" bytes of a value (little endian)
+///         and adds them to the checksum
+///
+/// @param  uint32_t value, uint16_t numberOfBytes, uint16_t *checksum
+///
+/// @return void
+///
+//=================================================================================================
+static void TraceSend(uint32_t value, uint16_t numberOfBytes, uint16_t *checksum)
+{
+    for (uint16_t i = 0; i < numberOfBytes; i++)
+    {
+        uint16_t byte = (uint16_t)(value >> (8 * i)) & 0x00FF;
+
+        *checksum += byte;
+        UartWriteBytes(&byte, 1);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TraceInit =========================================================================
+///
+/// @brief  Function clears all rings and starts the recording without a trigger
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TraceInit(void)
+{
+    TraceArm(TRACE_EVENT_NONE);
+}
+
+//=== Function: TraceArm ==========================================================================
+///
+/// @brief  Function clears all rings and starts the recording. When the event "triggerId" is
+///         recorded (as last record of its ring) all rings are frozen until TraceArm() is
+///         called again
+///
+/// @param  uint16_t triggerId (TRACE_EVENT_NONE: record until TraceFreeze())
+///
+/// @return void
+///
+//=================================================================================================
+void TraceArm(uint16_t triggerId)
+{
+    traceFrozen = true;
+    for (uint16_t i = 0; i < TRACE_NUMBER_OF_CONTEXTS; i++)
+    {
+        traceRings[i].head = 0;
+        traceRings[i].full = false;
+    }
+    traceTriggerId = triggerId;
+    traceFrozen = false;
+}
+
+//=== Function: TraceFreeze =======================================================================
+///
+/// @brief  Function stops the recording of all rings
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TraceFreeze(void)
+{
+    traceFrozen = true;
+}
+
+//=== Function: TraceEvent ========================================================================
+///
+/// @brief  Function writes one record into the ring of "context". Must only be called from that
+///         context (single writer per ring, no lock). The record at "head" is written before
+///         "head" is moved, so a reader never sees a half-written record behind "head"
+///
+/// @param  uint16_t context (TRACE_CONTEXT_x), uint16_t id (TRACE_EVENT_x), uint16_t arg
+///
+/// @return void
+///
+//=================================================================================================
+void TraceEvent(uint16_t context, uint16_t id, uint16_t arg)
+{
+    TraceRing *ring = &traceRings[context];
+    TraceRecord *record;
+    uint16_t head;
+
+    if (traceFrozen)
+        return;
+
+    head = ring->head;
+    record = &ring->records[head & TRACE_RING_MASK];
+    // Same time base as DeviceGetTime() without the call into the flash
+    record->time = 0xFFFFFFFFUL - CpuTimer2Regs.TIM.all;
+    record->id = id;
+    record->arg = arg;
+
+    head++;
+    ring->head = head;
+    if ((head & TRACE_RING_MASK) == 0)
+        ring->full = true;
+
+    if (id == traceTriggerId)
+        traceFrozen = true;
+}
+
+//=== Function: TraceDump =========================================================================
+///
+/// @brief  Function freezes the rings, sends all of them over UART (oldest record first) and
+///         continues the recording if it was running before. A record which an ISR was writing
+///         at the moment of the freeze is not sent. Called in the main loop, the dump blocks for
+///         about 0.2 s at UART_BAUD
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TraceDump(void)
+{
+    bool wasFrozen = traceFrozen;
+    uint16_t checksum = 0;
+    uint16_t sync = TRACE_SYNC;
+
+    traceFrozen = true;
+
+    UartWriteBytes(&sync, 1);
+    TraceSend(TRACE_NUMBER_OF_CONTEXTS, 1, &checksum);
+    for (uint16_t i = 0; i < TRACE_NUMBER_OF_CONTEXTS; i++)
+    {
+        const TraceRing *ring = &traceRings[i];
+        uint16_t head = ring->head;
+        uint16_t count = ring->full ? TRACE_RING_SIZE : (head & TRACE_RING_MASK);
+        uint16_t first = head - count;
+
+        TraceSend(i, 1, &checksum);
+        TraceSend(count, 2, &checksum);
+        for (uint16_t j = 0; j < count; j++)
+        {
+            const TraceRecord *record = &ring->records[(first + j) & TRACE_RING_MASK];
+
+            TraceSend(record->time, 4, &checksum);
+            TraceSend(record->id, 2, &checksum);
+            TraceSend(record->arg, 2, &checksum);
+        }
+    }
+    checksum &= 0x00FF;
+    UartWriteBytes(&checksum, 1);
+    UartFlush();
+
+    traceFrozen = wasFrozen;
+}
@@ -0,0 +1,112 @@
+//=================================================================================================
+/// @file     TB_Trace.h
+///
+/// @brief    File contains an event trace in RAM for ISRs and the main loop. TRACE() writes one
+///           record (time stamp of DeviceGetTime(), event id, 16 bit argument) into the ring of
+///           its context in a few cycles, without locks: every context (main loop, sequencer,
+///           DMA ISR ...) has its own ring and is its only writer, an ISR which interrupts
+///           another context writes into another ring. The rings keep the last TRACE_RING_SIZE
+///           records each. With TraceArm() a trigger event freezes all rings, so the history
+///           before a sporadic fault is kept until it is read.
+///
+///           Dump (the host sends TRACE_DUMP_REQUEST over the UART of TB_TestPlan), bytes:
+///             TRACE_SYNC, number of contexts, per context:
+///               context, number of records n (16 bit), n * 8 bytes record (oldest first)
+///               record: time (32 bit), event id (16 bit), argument (16 bit)
+///             checksum: lower 8 bits of the sum of all bytes after TRACE_SYNC
+///           All values are little endian, the time stamps have DEVICE_TIME_TICKS_PER_US ticks
+///           per us and wrap after about 21 s
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYTRACE_H_
+#define MYTRACE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: TRACE() writes records, 0: TRACE() is removed by the preprocessor
+#define TRACE_ENABLE                1
+// Records per ring (power of two)
+#define TRACE_RING_SIZE             64
+#define TRACE_RING_MASK             (TRACE_RING_SIZE - 1)
+// Contexts, one ring each (a context is the only writer of its ring)
+#define TRACE_CONTEXT_MAIN          0       // main loop
+#define TRACE_CONTEXT_SEQUENCER     1       // SequencerISR() and the steps of the checks
+#define TRACE_CONTEXT_DMA           2       // DmaAdcFrameDone() and the frame-locked steps
+#define TRACE_CONTEXT_ADC_EVENT     3       // AdcPpbEventISR()
+#define TRACE_CONTEXT_CLB           4       // ClbErrorLineISR()
+#define TRACE_NUMBER_OF_CONTEXTS    5
+// Event ids
+#define TRACE_EVENT_NONE            0       // no trigger
+#define TRACE_EVENT_SEQ_STEP        1       // argument: check (bits 15..12), step (bits 11..0)
+#define TRACE_EVENT_SEQ_DONE        2       // argument: number of checks of the sequence
+#define TRACE_EVENT_DMA_FRAME       3       // argument: lower 16 bits of dmaAdcFrameCount
+#define TRACE_EVENT_ADC_LIMIT       4       // argument: channel of the PPB check
+#define TRACE_EVENT_CLB_ALARM       5       // argument: reset line
+#define TRACE_EVENT_PLAN_START      6       // argument: number of steps
+#define TRACE_EVENT_PLAN_DONE       7       // argument: failed compares
+#define TRACE_EVENT_USER            0x100   // first id for temporary events
+// Frame bytes of the dump
+#define TRACE_DUMP_REQUEST          0x54
+#define TRACE_SYNC                  0xA6
+#define TRACE_RECORD_BYTES          8
+
+// Records an event in the ring of "context"
+#if TRACE_ENABLE
+#define TRACE(context, id, arg)     TraceEvent((context), (id), (uint16_t)(arg))
+#else
+#define TRACE(context, id, arg)     ((void)0)
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// One record
+typedef struct
+{
+    uint32_t time;                  // DeviceGetTime()
+    uint16_t id;                    // TRACE_EVENT_x
+    uint16_t arg;
+} TraceRecord;
+
+// Ring of one context, "head" is the number of written records (free running)
+typedef struct
+{
+    TraceRecord records[TRACE_RING_SIZE];
+    volatile uint16_t head;
+    volatile bool full;             // all records are valid
+} TraceRing;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Rings of all contexts
+extern TraceRing traceRings[TRACE_NUMBER_OF_CONTEXTS];
+// Event which freezes the rings (TRACE_EVENT_NONE: no trigger) and state of the rings
+extern volatile uint16_t traceTriggerId;
+extern volatile bool traceFrozen;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function clears all rings and starts the recording without a trigger
+extern void TraceInit(void);
+// Function clears all rings and starts the recording until "triggerId" occurs
+extern void TraceArm(uint16_t triggerId);
+// Function stops the recording of all rings
+extern void TraceFreeze(void);
+// Function writes one record into the ring of a context (use TRACE())
+extern void TraceEvent(uint16_t context, uint16_t id, uint16_t arg);
+// Function sends all rings over UART
+extern void TraceDump(void);
+
+#endif
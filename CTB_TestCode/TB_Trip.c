@@ -0,0 +1,411 @@
+//=================================================================================================
+/// @file     TB_Trip.c
+///
+/// @brief    File contains the X-BAR routing of the hardware error detection lines to the trip
+///           zone of the ePWM modules. The signal numbers follow the figures "Input X-BAR" and
+///           "ePWM X-BAR Mux Configuration Table" of the Reference Manual TMS320F2838x, SPRUII0D.
+///           See TB_Trip.h for the fault path
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Trip.h"
+#include "TB_Clock.h"
+#include "TB_ECAP.h"
+#include "TB_GPIO.h"
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Called by the hardware error detection step of the sequencer, runs from LSx RAM
+#pragma CODE_SECTION(TripArm, ".TI.ramfunc");
+#pragma CODE_SECTION(TripDisarm, ".TI.ramfunc");
+#pragma CODE_SECTION(TripClear, ".TI.ramfunc");
+#pragma CODE_SECTION(TripLatencyClear, ".TI.ramfunc");
+#pragma CODE_SECTION(TripLatencyInject, ".TI.ramfunc");
+#pragma CODE_SECTION(TripLatencyMeasure, ".TI.ramfunc");
+#pragma CODE_SECTION(TripLatencyCheck, ".TI.ramfunc");
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Output of the ePWM X-BAR and its trip input of the digital compare submodule
+typedef struct
+{
+    volatile uint32_t *config;              // TRIPxMUX0TO15CFG
+    volatile uint32_t *enable;              // TRIPxMUXENABLE
+    uint16_t tripInput;                     // PWM_DC_TRIP_TRIPINx (bit of DCAHTRIPSEL)
+} TripXbarOutput;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Reset lines in the order of Hardware_Error_Detection_Check(), same input X-BAR outputs as the
+// CLB monitor (clbXbarSelect), every line trips all PWMs
+const TripRouteConfig tripRouteTable[TRIP_NUMBER_OF_ROUTES] =
+{
+    // pin xbarInput  output              modules
+    {  98, 1,         TRIP_OUTPUT_TRIP4,  TRIP_ALL_MODULES},
+    {  10, 2,         TRIP_OUTPUT_TRIP5,  TRIP_ALL_MODULES},
+    {  11, 3,         TRIP_OUTPUT_TRIP7,  TRIP_ALL_MODULES},
+    {  97, 4,         TRIP_OUTPUT_TRIP8,  TRIP_ALL_MODULES}
+};
+uint16_t tripModules = 0;
+TripLatency tripLatency[TRIP_NUMBER_OF_ROUTES];
+bool tripLatencyPassed = false;
+// Input X-BAR outputs INPUT1 to INPUT6
+static volatile uint16_t *const tripXbarSelect[TRIP_NUMBER_OF_XBAR_INPUTS] =
+{
+    &InputXbarRegs.INPUT1SELECT,
+    &InputXbarRegs.INPUT2SELECT,
+    &InputXbarRegs.INPUT3SELECT,
+    &InputXbarRegs.INPUT4SELECT,
+    &InputXbarRegs.INPUT5SELECT,
+    &InputXbarRegs.INPUT6SELECT
+};
+// Outputs of the ePWM X-BAR (index = TRIP_OUTPUT_x = bit of TRIPOUTINV)
+static const TripXbarOutput tripXbarOutputs[TRIP_NUMBER_OF_OUTPUTS] =
+{
+    {&EPwmXbarRegs.TRIP4MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP4MUXENABLE.all,  PWM_DC_TRIP_TRIPIN4},
+    {&EPwmXbarRegs.TRIP5MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP5MUXENABLE.all,  PWM_DC_TRIP_TRIPIN5},
+    {&EPwmXbarRegs.TRIP7MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP7MUXENABLE.all,  PWM_DC_TRIP_TRIPIN7},
+    {&EPwmXbarRegs.TRIP8MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP8MUXENABLE.all,  PWM_DC_TRIP_TRIPIN8},
+    {&EPwmXbarRegs.TRIP9MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP9MUXENABLE.all,  PWM_DC_TRIP_TRIPIN9},
+    {&EPwmXbarRegs.TRIP10MUX0TO15CFG.all, &EPwmXbarRegs.TRIP10MUXENABLE.all, PWM_DC_TRIP_TRIPIN10},
+    {&EPwmXbarRegs.TRIP11MUX0TO15CFG.all, &EPwmXbarRegs.TRIP11MUXENABLE.all, PWM_DC_TRIP_TRIPIN11},
+    {&EPwmXbarRegs.TRIP12MUX0TO15CFG.all, &EPwmXbarRegs.TRIP12MUXENABLE.all, PWM_DC_TRIP_TRIPIN12}
+};
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TripInitXbar ======================================================================
+///
+/// @brief  Function connects the line of a route to its input X-BAR output and this output to
+///         the TRIPx signal of the ePWM X-BAR (input 1 of MUX(2n - 1) = INPUTXBARn). TRIPx is
+///         inverted, a LOW line becomes a HIGH trip signal. EALLOW must be set
+///
+/// @param  const TripRouteConfig *route
+///
+/// @return void
+///
+//=================================================================================================
+static void TripInitXbar(const TripRouteConfig *route)
+{
+    const TripXbarOutput *output = &tripXbarOutputs[route->output];
+    uint16_t mux = 2 * route->xbarInput - 1;
+
+    *tripXbarSelect[route->xbarInput - 1] = route->pin;
+
+    *output->config = (*output->config & ~(3UL << (2 * mux))) | (1UL << (2 * mux));
+    *output->enable |= 1UL << mux;
+    EPwmXbarRegs.TRIPOUTINV.all |= 1UL << route->output;
+}
+
+//=== Function: TripInitPwm =======================================================================
+///
+/// @brief  Function connects DCAH of a module to the OR of "tripInputs" (DCAHTRIPSEL) and sets
+///         DCAEVT1 = DCAH high as unfiltered, asynchronous one-shot source which forces output A
+///         and B LOW. The direct action of DCAEVT1 is switched off, so TripDisarm() blanks the
+///         trip completely. EALLOW must be set
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t tripInputs (bit n - 1 = TRIPINn)
+///
+/// @return void
+///
+//=================================================================================================
+static void TripInitPwm(volatile struct EPWM_REGS *regs, uint16_t tripInputs)
+{
+    regs->DCAHTRIPSEL.all = tripInputs;
+    regs->DCTRIPSEL.bit.DCAHCOMPSEL = PWM_DC_TRIP_COMBINATION;
+    regs->TZDCSEL.bit.DCAEVT1 = PWM_DC_DCXH_HIGH;
+    regs->DCACTL.bit.EVT1SRCSEL = PWM_DC_RAW_EVENT;
+    regs->DCACTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+
+    regs->TZCTL2.bit.ETZE = PWM_TZ_CONFIG_BY_TZCTL;
+    regs->TZCTL.bit.TZA = PWM_TZ_FORCE_LO;
+    regs->TZCTL.bit.TZB = PWM_TZ_FORCE_LO;
+    regs->TZCTL.bit.DCAEVT1 = PWM_TZ_NO_ACTION;
+}
+
+//=== Function: TripInitLatency ===================================================================
+///
+/// @brief  Function configures eCAP7 for the latency measurement: free running time stamp
+///         counter (absolute mode, no reset on an event), one-shot capture of one falling edge
+///         into CAP1. The input is selected per pulse by TripLatencyInject(). EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void TripInitLatency(void)
+{
+    ClockRequest(CLOCK_ECAP(TRIP_LATENCY_ECAP));
+
+    ECap7Regs.ECCTL2.bit.TSCTRSTOP = 0;
+    ECap7Regs.ECEINT.all = 0;
+    ECap7Regs.ECCLR.all = 0xFFFF;
+
+    ECap7Regs.ECCTL1.bit.CAP1POL = ECAP_FALLING_EDGE;
+    ECap7Regs.ECCTL1.bit.CTRRST1 = 0;       // Absolute mode: CAP1 holds the time stamp
+    ECap7Regs.ECCTL1.bit.PRESCALE = 0;
+    ECap7Regs.ECCTL1.bit.CAPLDEN = 1;
+    ECap7Regs.ECCTL1.bit.FREE_SOFT = 3;
+
+    ECap7Regs.ECCTL2.bit.CAP_APWM = 0;
+    ECap7Regs.ECCTL2.bit.CONT_ONESHT = 1;   // One-shot, stop after CEVT1
+    ECap7Regs.ECCTL2.bit.STOP_WRAP = 0;
+    ECap7Regs.ECCTL2.bit.SYNCI_EN = 0;
+
+    ECap7Regs.TSCTR = 0;
+    ECap7Regs.ECCTL2.bit.TSCTRSTOP = 1;
+
+    TripLatencyClear();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TripInit ==========================================================================
+///
+/// @brief  Function routes all lines of tripRouteTable to their TRIPx signals, configures the
+///         digital compare and trip zone submodules of all routed modules and arms the trip.
+///         Must be called after PwmInitAll() and ClbInit() (glitch filter of the lines)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripInit(void)
+{
+    tripModules = 0;
+
+    EALLOW;
+
+    for (uint16_t i = 0; i < TRIP_NUMBER_OF_ROUTES; i++)
+        TripInitXbar(&tripRouteTable[i]);
+
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        uint16_t bit = 1U << (pwmConfigTable[m].module - 1);
+        uint16_t tripInputs = 0;
+
+        for (uint16_t i = 0; i < TRIP_NUMBER_OF_ROUTES; i++)
+        {
+            if (tripRouteTable[i].modules & bit)
+                tripInputs |= 1U << tripXbarOutputs[tripRouteTable[i].output].tripInput;
+        }
+        if (tripInputs == 0)
+            continue;
+
+        TripInitPwm(pwmConfigTable[m].regs, tripInputs);
+        tripModules |= bit;
+    }
+
+    TripInitLatency();
+    TripArm();
+
+    EDIS;
+}
+
+//=== Function: TripArm ===========================================================================
+///
+/// @brief  Function clears the latched trips and enables DCAEVT1 as one-shot source of all
+///         routed modules. A line which is still LOW trips the module again at once. EALLOW
+///         must be set (as in the steps of the sequencer)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripArm(void)
+{
+    TripClear();
+
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        if (tripModules & (1U << (pwmConfigTable[m].module - 1)))
+            pwmConfigTable[m].regs->TZSEL.bit.DCAEVT1 = PWM_TZ_ENABLE;
+    }
+}
+
+//=== Function: TripDisarm ========================================================================
+///
+/// @brief  Function disables DCAEVT1 as one-shot source of all routed modules, a LOW line no
+///         longer trips. A trip which is already latched stays active. EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripDisarm(void)
+{
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        if (tripModules & (1U << (pwmConfigTable[m].module - 1)))
+            pwmConfigTable[m].regs->TZSEL.bit.DCAEVT1 = PWM_TZ_DISABLE;
+    }
+}
+
+//=== Function: TripClear =========================================================================
+///
+/// @brief  Function clears the one-shot trip and the DCAEVT1 flags of all routed modules.
+///         EALLOW must be set
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripClear(void)
+{
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        volatile struct EPWM_REGS *regs = pwmConfigTable[m].regs;
+
+        if ((tripModules & (1U << (pwmConfigTable[m].module - 1))) == 0)
+            continue;
+
+        regs->TZOSTCLR.bit.DCAEVT1 = 1;
+        regs->TZCLR.bit.DCAEVT1 = 1;
+        regs->TZCLR.bit.OST = 1;
+        regs->TZCLR.bit.INT = 1;
+    }
+}
+
+//=== Function: TripGetActive =====================================================================
+///
+/// @brief  Function returns the routed modules with a latched one-shot trip (TZFLG.OST)
+///
+/// @param  void
+///
+/// @return uint16_t modules (bit n - 1 = ePWMn)
+///
+//=================================================================================================
+uint16_t TripGetActive(void)
+{
+    uint16_t active = 0;
+
+    for (uint16_t m = 0; m < PWM_NUMBER_OF_MODULES; m++)
+    {
+        uint16_t bit = 1U << (pwmConfigTable[m].module - 1);
+
+        if ((tripModules & bit) && pwmConfigTable[m].regs->TZFLG.bit.OST)
+            active |= bit;
+    }
+    return active;
+}
+
+//=== Function: TripLatencyClear ==================================================================
+///
+/// @brief  Function clears the latency values of all routes and tripLatencyPassed
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripLatencyClear(void)
+{
+    for (uint16_t i = 0; i < TRIP_NUMBER_OF_ROUTES; i++)
+    {
+        tripLatency[i].startTime = 0;
+        tripLatency[i].lastCycles = 0;
+        tripLatency[i].minCycles = 0xFFFFFFFFUL;
+        tripLatency[i].maxCycles = 0;
+        tripLatency[i].measurements = 0;
+        tripLatency[i].missed = 0;
+        tripLatency[i].violations = 0;
+    }
+    tripLatencyPassed = false;
+}
+
+//=== Function: TripLatencyInject =================================================================
+///
+/// @brief  Function connects eCAP7 to the input X-BAR output of the route (INPUTSEL 0..15:
+///         INPUTXBAR1..16), re-arms the capture and pulls the line LOW directly after the time
+///         stamp is taken. The line must be HIGH before. EALLOW must be set
+///
+/// @param  uint16_t route (index of tripRouteTable)
+///
+/// @return void
+///
+//=================================================================================================
+void TripLatencyInject(uint16_t route)
+{
+    uint16_t pin = tripRouteTable[route].pin;
+    volatile uint32_t *data = (volatile uint32_t *)&GpioDataRegs.GPADAT + (pin / 32) * GPIO_PORT_DATA_REGS;
+    uint32_t mask = 1UL << (pin % 32);
+
+    ECap7Regs.ECCTL0.bit.INPUTSEL = tripRouteTable[route].xbarInput - 1;
+    ECap7Regs.ECCLR.all = 0xFFFF;
+    ECap7Regs.ECCTL2.bit.REARM = 1;
+
+    tripLatency[route].startTime = ECap7Regs.TSCTR;
+    data[GPIO_PORT_CLEAR] = mask;
+}
+
+//=== Function: TripLatencyMeasure ================================================================
+///
+/// @brief  Function reads the edge captured since TripLatencyInject() of the route. The latency
+///         is CAP1 - start time (the counter may wrap in between), a pulse without an edge is
+///         counted as missed. Must be called before the next route is injected
+///
+/// @param  uint16_t route (index of tripRouteTable)
+///
+/// @return void
+///
+//=================================================================================================
+void TripLatencyMeasure(uint16_t route)
+{
+    TripLatency *latency = &tripLatency[route];
+    uint32_t cycles;
+
+    if (ECap7Regs.ECFLG.bit.CEVT1 == 0)
+    {
+        latency->missed++;
+        return;
+    }
+
+    cycles = ECap7Regs.CAP1 - latency->startTime;
+    latency->lastCycles = cycles;
+    if (cycles < latency->minCycles)
+        latency->minCycles = cycles;
+    if (cycles > latency->maxCycles)
+        latency->maxCycles = cycles;
+    if (cycles > TRIP_LATENCY_LIMIT_CYCLES)
+        latency->violations++;
+    latency->measurements++;
+}
+
+//=== Function: TripLatencyCheck ==================================================================
+///
+/// @brief  Function checks that every route has "expected" measurements, no missed edge and no
+///         latency above TRIP_LATENCY_LIMIT_US. The result is stored in tripLatencyPassed
+///
+/// @param  uint16_t expected (pulses per line)
+///
+/// @return bool passed
+///
+//=================================================================================================
+bool TripLatencyCheck(uint16_t expected)
+{
+    tripLatencyPassed = true;
+    for (uint16_t i = 0; i < TRIP_NUMBER_OF_ROUTES; i++)
+    {
+        if (tripLatency[i].measurements != expected || tripLatency[i].missed != 0 ||
+            tripLatency[i].violations != 0)
+            tripLatencyPassed = false;
+    }
+    return tripLatencyPassed;
+}
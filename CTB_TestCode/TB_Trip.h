@@ -0,0 +1,122 @@
+//=================================================================================================
+/// @file     TB_Trip.h
+///
+/// @brief    File contains a hardware-only fault path from the reset lines of the hardware error
+///           detection (GPIO98, GPIO10, GPIO11, GPIO97) to the trip zone of the ePWM modules.
+///           The lines are idle HIGH, a fault on the board pulls a line LOW. Every route of
+///           tripRouteTable takes one line through the input X-BAR and the ePWM X-BAR to one
+///           TRIPx signal (inverted, so TRIPx is HIGH on a fault). In every ePWM module of the
+///           route DCAH is the OR of its TRIPx signals (DCAHTRIPSEL), DCAEVT1 = DCAH high is an
+///           unfiltered, asynchronous one-shot trip which forces output A and B LOW. The trip
+///           latches in TZFLG.OST and needs no ISR, TripClear() releases the outputs.
+///
+///           The reset lines share the input X-BAR outputs INPUT1 to INPUT4 and the glitch
+///           filter with the CLB monitor (TB_CLB), so a trip follows the fault after the input
+///           qualification (about 12.75 us). Hardware_Error_Detection_Check() pulses the lines
+///           itself, it blanks the trip with TripDisarm() and re-arms it with TripArm()
+///
+///           The check also measures the detection latency of every line: TripLatencyInject()
+///           pulls the line LOW and keeps the time stamp of eCAP7, which captures the falling
+///           edge of the qualified line at the input X-BAR output of the route (the signal which
+///           trips the PWMs and clocks the CLB monitor). TripLatencyMeasure() takes the difference
+///           in SYSCLK cycles and compares it with TRIP_LATENCY_LIMIT_US
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYTRIP_H_
+#define MYTRIP_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_PWM.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Number of routes in tripRouteTable
+#define TRIP_NUMBER_OF_ROUTES       4
+// Outputs of the ePWM X-BAR in the order of the bits of TRIPOUTINV (TRIP1 to TRIP3 and TRIP6
+// come directly from the input X-BAR)
+#define TRIP_OUTPUT_TRIP4           0
+#define TRIP_OUTPUT_TRIP5           1
+#define TRIP_OUTPUT_TRIP7           2
+#define TRIP_OUTPUT_TRIP8           3
+#define TRIP_OUTPUT_TRIP9           4
+#define TRIP_OUTPUT_TRIP10          5
+#define TRIP_OUTPUT_TRIP11          6
+#define TRIP_OUTPUT_TRIP12          7
+#define TRIP_NUMBER_OF_OUTPUTS      8
+// Input X-BAR outputs which reach the ePWM X-BAR (INPUTXBARn = input 1 of MUX(2n - 1))
+#define TRIP_NUMBER_OF_XBAR_INPUTS  6
+// ePWM modules of a route, bit n - 1 = ePWMn
+#define TRIP_ALL_MODULES            0xFFFF
+// eCAP module of the latency measurement (TB_ECAP uses eCAP1 to eCAP6)
+#define TRIP_LATENCY_ECAP           7
+// Budget of the detection from the injected edge to the qualified line (the glitch filter
+// alone takes about 12.75 us, see TB_CLB)
+#define TRIP_LATENCY_LIMIT_US       20UL
+#define TRIP_LATENCY_LIMIT_CYCLES   (TRIP_LATENCY_LIMIT_US * DEVICE_SYSCLK_MHZ)
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Route of one error line
+typedef struct
+{
+    uint16_t pin;                           // GPIO of the line (input path of the pin)
+    uint16_t xbarInput;                     // input X-BAR output INPUT1 ... INPUT6
+    uint16_t output;                        // TRIP_OUTPUT_x of the ePWM X-BAR
+    uint16_t modules;                       // tripped ePWM modules, bit n - 1 = ePWMn
+} TripRouteConfig;
+
+// Detection latency of one line, all times in SYSCLK cycles
+typedef struct
+{
+    uint32_t startTime;                     // TSCTR of eCAP7 when the line was pulled LOW
+    uint32_t lastCycles;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint16_t measurements;
+    uint16_t missed;                        // pulses without a captured edge
+    uint16_t violations;                    // latency > TRIP_LATENCY_LIMIT_CYCLES
+} TripLatency;
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Routes of all error lines
+extern const TripRouteConfig tripRouteTable[TRIP_NUMBER_OF_ROUTES];
+// ePWM modules with at least one route, bit n - 1 = ePWMn (set by TripInit())
+extern uint16_t tripModules;
+// Detection latency of every route and result of the last check (TripLatencyCheck())
+extern TripLatency tripLatency[TRIP_NUMBER_OF_ROUTES];
+extern bool tripLatencyPassed;
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function configures the X-BARs and the trip zone of all modules of tripRouteTable and arms it
+extern void TripInit(void);
+// Function clears the latched trips and enables the one-shot trip of all routed modules
+extern void TripArm(void);
+// Function disables the one-shot trip of all routed modules (lines pulsed by the check)
+extern void TripDisarm(void);
+// Function clears the latched trips, the outputs follow the action qualifier again
+extern void TripClear(void);
+// Function returns the modules with a latched trip, bit n - 1 = ePWMn
+extern uint16_t TripGetActive(void);
+// Function clears the latency values of all routes
+extern void TripLatencyClear(void);
+// Function pulls the line of a route LOW and starts its latency measurement
+extern void TripLatencyInject(uint16_t route);
+// Function reads the captured edge of a route and updates its latency values
+extern void TripLatencyMeasure(uint16_t route);
+// Function checks that every route has "expected" measurements within the limit
+extern bool TripLatencyCheck(uint16_t expected);
+
+#endif
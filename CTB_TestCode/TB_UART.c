@@ -0,0 +1,168 @@
+//=================================================================================================
+/// @file     TB_UART.c
+///
+/// @brief    File contains the transmit-only driver of SCI-A. The registers follow the description
+///           of the SCI in the Reference Manual TMS320F2838x, SPRUII0D
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_UART.h"
+#include "TB_GPIO.h"
+#include "TB_Clock.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UartInit ==========================================================================
+///
+/// @brief  Function assigns SCIA_TX to GPIO135 and SCIA_RX to GPIO28 and configures SCI-A:
+///         8 data bits, 1 stop bit, no parity, UART_BAUD, FIFO mode without interrupts
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void UartInit(void)
+{
+    // BRR = LSPCLK / (baud * 8) - 1
+    uint16_t divider = (uint16_t)(UART_LSPCLK_HZ / (UART_BAUD * 8UL) - 1UL);
+
+    GpioSetPeripheral(UART_TX_PIN, UART_TX_MUX, GPIO_ENABLE_PULLUP);
+    GpioSetPeripheral(UART_RX_PIN, UART_RX_MUX, GPIO_ENABLE_PULLUP);
+
+    EALLOW;
+    // The SCI samples RX itself, the input must be asynchronous (GPIO28)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 3;
+    ClockRequest(CLOCK_SCIA);
+    EDIS;
+
+    // Hold the SCI in reset while it is configured
+    SciaRegs.SCICTL1.all = 0;
+    SciaRegs.SCICCR.all = 0x0007;           // 8 data bits, 1 stop bit, no parity, idle-line mode
+    SciaRegs.SCIHBAUD.all = divider >> 8;
+    SciaRegs.SCILBAUD.all = divider & 0x00FF;
+    SciaRegs.SCICTL2.all = 0;               // no TX/RX interrupts
+
+    // FIFO mode, both FIFOs out of reset, no FIFO interrupts
+    SciaRegs.SCIFFTX.all = 0xE040;
+    SciaRegs.SCIFFRX.all = 0x2040;
+    SciaRegs.SCIFFCT.all = 0;
+
+    SciaRegs.SCICTL1.bit.TXENA = 1;
+    SciaRegs.SCICTL1.bit.RXENA = 1;
+    SciaRegs.SCICTL1.bit.SWRESET = 1;
+}
+
+//=== Function: UartWrite =========================================================================
+///
+/// @brief  Function writes a null-terminated text into the transmit FIFO and only waits while
+///         the FIFO is full. "\n" is sent as "\r\n"
+///
+/// @param  const char *text
+///
+/// @return void
+///
+//=================================================================================================
+void UartWrite(const char *text)
+{
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '\n')
+        {
+            while (SciaRegs.SCIFFTX.bit.TXFFST >= UART_TX_FIFO_SIZE)
+                ;
+            SciaRegs.SCITXBUF.all = '\r';
+        }
+        while (SciaRegs.SCIFFTX.bit.TXFFST >= UART_TX_FIFO_SIZE)
+            ;
+        SciaRegs.SCITXBUF.all = (uint16_t)*text & 0x00FF;
+    }
+}
+
+//=== Function: UartWriteBytes ====================================================================
+///
+/// @brief  Function writes binary bytes (lower 8 bits of every word) into the transmit FIFO and
+///         only waits while the FIFO is full
+///
+/// @param  const uint16_t *data, uint16_t numberOfBytes
+///
+/// @return void
+///
+//=================================================================================================
+void UartWriteBytes(const uint16_t *data, uint16_t numberOfBytes)
+{
+    for (uint16_t i = 0; i < numberOfBytes; i++)
+    {
+        while (SciaRegs.SCIFFTX.bit.TXFFST >= UART_TX_FIFO_SIZE)
+            ;
+        SciaRegs.SCITXBUF.all = data[i] & 0x00FF;
+    }
+}
+
+//=== Function: UartRead ==========================================================================
+///
+/// @brief  Function reads one byte from the receive FIFO without waiting. After an overflow of
+///         the FIFO or a receive error (framing, break) the receiver is reset, the bytes in the
+///         FIFO are lost and the caller has to resynchronise
+///
+/// @param  uint16_t *byte
+///
+/// @return bool byte read
+///
+//=================================================================================================
+bool UartRead(uint16_t *byte)
+{
+    if (SciaRegs.SCIFFRX.bit.RXFFOVF || SciaRegs.SCIRXST.bit.RXERROR)
+    {
+        SciaRegs.SCICTL1.bit.SWRESET = 0;
+        SciaRegs.SCIFFRX.bit.RXFIFORESET = 0;
+        SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+        SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;
+        SciaRegs.SCICTL1.bit.SWRESET = 1;
+        return false;
+    }
+
+    if (SciaRegs.SCIFFRX.bit.RXFFST == 0)
+        return false;
+
+    *byte = SciaRegs.SCIRXBUF.bit.SAR;
+    return true;
+}
+
+//=== Function: UartTxFree ========================================================================
+///
+/// @brief  Function returns the number of bytes which can be written into the transmit FIFO
+///         without waiting
+///
+/// @param  void
+///
+/// @return uint16_t free
+///
+//=================================================================================================
+uint16_t UartTxFree(void)
+{
+    return UART_TX_FIFO_SIZE - SciaRegs.SCIFFTX.bit.TXFFST;
+}
+
+//=== Function: UartFlush =========================================================================
+///
+/// @brief  Function waits until the transmit FIFO and the shift register are empty
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void UartFlush(void)
+{
+    while (SciaRegs.SCIFFTX.bit.TXFFST != 0 || SciaRegs.SCICTL2.bit.TXEMPTY == 0)
+        ;
+}
@@ -0,0 +1,57 @@
+//=================================================================================================
+/// @file     TB_UART.h
+///
+/// @brief    File contains a polled driver for SCI-A (UART) with TX on GPIO135 and RX on GPIO28,
+///           used for the text reports of the CTB (see TB_Report) and the download of test plans
+///           (see TB_TestPlan). UartWrite() copies the text into the 16 word transmit FIFO and
+///           only waits while the FIFO is full, UartRead() fetches one byte from the receive
+///           FIFO without waiting, no interrupt is used.
+///           The low-speed clock LSPCLK is SYSCLK / 4 = 50 MHz (DeviceInit())
+///
+/// @version  V1.0.0
+///
+/// @date     14-10-2026
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYUART_H_
+#define MYUART_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: SCI-A is used for the reports and test plans (UartInit() configures GPIO135 and GPIO28)
+#define UART_ENABLE                 1
+// Transmit pin and its multiplexer value (GPxGMUX * 4 + GPxMUX) for SCIA_TX
+#define UART_TX_PIN                 135
+#define UART_TX_MUX                 6
+// Receive pin and its multiplexer value for SCIA_RX
+#define UART_RX_PIN                 28
+#define UART_RX_MUX                 1
+// 8 data bits, 1 stop bit, no parity
+#define UART_BAUD                   115200UL
+#define UART_LSPCLK_HZ              50000000UL
+// Size of the transmit FIFO
+#define UART_TX_FIFO_SIZE           16
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function configures GPIO135, GPIO28 and SCI-A with UART_BAUD
+extern void UartInit(void);
+// Function writes a null-terminated text into the transmit FIFO
+extern void UartWrite(const char *text);
+// Function writes binary bytes (lower 8 bits of every word) into the transmit FIFO
+extern void UartWriteBytes(const uint16_t *data, uint16_t numberOfBytes);
+// Function reads one received byte without waiting, returns false if the FIFO is empty
+extern bool UartRead(uint16_t *byte);
+// Function returns the number of free words of the transmit FIFO
+extern uint16_t UartTxFree(void);
+// Function waits until all characters are sent
+extern void UartFlush(void);
+
+#endif
@@ -22,10 +22,42 @@
 #include "TB_DAC.h"
 #include "TB_Functions.h"
 #include "TB_Device.h"
+#include "TB_Sequencer.h"
+#include "TB_Offload.h"
+#include "TB_ADCCal.h"
+#include "TB_ECAP.h"
+#include "TB_CLB.h"
+#include "TB_Clock.h"
+#include "TB_Trip.h"
+#include "TB_Telemetry.h"
+#include "TB_ProcessImage.h"
+#include "TB_Params.h"
+#include "TB_Report.h"
+#include "TB_TestPlan.h"
+#include "TB_ERAD.h"
+#include "TB_Trace.h"
+#include "TB_Log.h"
+#include "TB_Datalog.h"
+#include "TB_Sfra.h"
+#include "TB_Modulator.h"
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Commands for CPU2 (master of RAMGS3 is CPU1)
+volatile uint16_t cpu1ToCpu2[TB_SHARED_SIZE];
+#pragma DATA_SECTION(cpu1ToCpu2,"SHARERAMGS3");
+// Results of CPU2 (master of RAMGS2 is CPU2, CPU1 can only read)
+volatile uint16_t cpu2ToCpu1[TB_SHARED_SIZE];
+#pragma DATA_SECTION(cpu2ToCpu1,"SHARERAMGS2");
+// Echo jobs of the offload check, completed echo jobs and wrong results
+uint32_t offloadEchoValue = 0;
+uint32_t offloadEchoCount = 0;
+uint32_t offloadEchoErrors = 0;
+// Time from the start of DeviceInit() to the first step of the checks and
+// duration of the analog bring-up (PWM, DAC, ADC) in us
+uint32_t bootTimeUs = 0;
+uint32_t analogInitTimeUs = 0;
 
 //=== Function: main ==============================================================================
 ///
@@ -38,9 +70,49 @@
 //=================================================================================================
 void main(void)
 {
+    uint32_t analogInitStart;
+    bool reportSent = false;
+
     //  initialise microcontroller (watchdog, system clock, memory, interrupts)
     DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
 
+    //  switch on the clocks of all used peripherals and off all others in one sequence
+    ClockInit();
+
+    //  clear the phase timing of the test run and initialise the UART of the report
+    ReportInit();
+
+    //  wait for test plans of the host on the same UART (executed after the analog checks)
+    TestPlanInit();
+
+    //  deferred binary log over the same UART (formatted by the host, replaces printf())
+    LogInit();
+
+    //  record the events of the ISRs and the main loop in the trace rings (dump over UART)
+    TraceInit();
+
+    //  stream the variables selected by the host PWM-synchronously over the same UART
+    DlogInit();
+
+    //  sweep the frequency response of the analog path on request of the host (Bode data over UART)
+    SfraInit();
+
+    //  profile the ISRs and count the calls of the hot paths with the ERAD (no code patching)
+    EradInit();
+
+    //  set up the offload queues (RAMGS4/RAMGS5) of the CPU2 worker
+    OffloadInit();
+
+    //  load the parameters (Repeat_count, ADC_error_buffer, PWM period ...) from the flash
+    ParamsInit();
+
+#if DEVICE_FAST_BOOT
+    //  power up the ADCs and DACs first, their settling time runs while the GPIOs are configured
+    //  and the LED checks are running. AdcInitAll() and DACInitAll() only wait for the rest
+    AdcPowerUpAll();
+    DACPowerUpAll();
+#endif
+
     //  configurs all GPIOs in Error_LEDs section on Test board
     GpioInit_Error_LEDs();
 
@@ -56,19 +128,76 @@ void main(void)
     //  configurs all GPIOs related to Hardware_Error_Detection on LEA Control Board
     GpioInit_Hardware_Error_Detection();
 
+    //  compute the port masks of all LEDs for the bitmask LED driver
+    LedInit();
+
+    //  park all muxes and initialise the level of the mux select lines for Mux_Select()
+    Mux_Init();
+
     //------------------------------------------------------------------------------
 
-    //  Lights up all LED's in Error_LEDs section
-    Error_LEDs_Check();
+#if TB_GPIOLEDS_ON_CPU2
+    cpu1ToCpu2[TB_SHARED_GPIOLEDS_START] = TB_SHARED_CMD_NONE;
+    if (gpioLedCheckMode == GPIO_LED_CHECK_LOOPBACK)
+    {
+        //  The loopback check of Group-A to Group-H takes less than 1 ms, CPU1 keeps the GPIOs
+        ReportPhaseStart(REPORT_PHASE_GPIO_LEDS);
+        GPIOLEDs_Check();
+        ReportPhaseStop(REPORT_PHASE_GPIO_LEDS);
+    }
+    else
+    {
+        //  Give RAMGS2 and the GPIOs of Group-A to Group-H to CPU2 and start the GPIO LED check on CPU2.
+        //  The state is cleared while CPU1 is still master of RAMGS2, then CPU2 may write it
+        cpu2ToCpu1[TB_SHARED_GPIOLEDS_CYCLES] = 0;
+        cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] = TB_SHARED_STATE_IDLE;
+        EALLOW;
+        MemCfgRegs.GSxMSEL.bit.MSEL_GS2 = 1;
+        EDIS;
+        Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.all = TB_SHARED_IPC_FLAG;
+        GpioSetCore_GroupAtoH(GPIO_CONTROLLED_BY_CPU2);
+        cpu1ToCpu2[TB_SHARED_GPIOLEDS_START] = TB_SHARED_CMD_START;
+        ReportPhaseStart(REPORT_PHASE_GPIO_LEDS);
+    }
 
-    //  Lights up all LED's in PWM_LEDs section
-    PWM_LEDs_Check();
+    bootTimeUs = DeviceGetTime() / DEVICE_TIME_TICKS_PER_US;
+    ReportPhaseSetDuration(REPORT_PHASE_BOOT, bootTimeUs);
+    LOG1(LOG_ID_BOOT, bootTimeUs);
 
-    //  Lights up all LED's in Group-A to Group-H
-    GPIOLEDs_Check();
+    //  Lights up all LED's in Error_LEDs section and PWM_LEDs section at the same time.
+    //  The checks are executed step by step by the CPU-Timer 1 ISR
+    SequencerStart(seqCpu1LedChecks, SEQ_NUMBER_OF_CPU1_LED_CHECKS);
+    while(!SequencerFinished() || (gpioLedCheckMode == GPIO_LED_CHECK_VISUAL
+                                   && cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] != TB_SHARED_STATE_FINISHED))
+    {
+        //  the GPIO LED check of CPU2 takes longer than one overflow of the time base
+        ReportPhaseUpdate(REPORT_PHASE_GPIO_LEDS);
+        if (cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] == TB_SHARED_STATE_FINISHED)
+            ReportPhaseStop(REPORT_PHASE_GPIO_LEDS);
+    }
+    ReportPhaseStop(REPORT_PHASE_GPIO_LEDS);
+
+    //  The mux lines of the ADCIN check are part of Group-A to Group-H, take them back
+    cpu1ToCpu2[TB_SHARED_GPIOLEDS_START] = TB_SHARED_CMD_NONE;
+    GpioSetCore_GroupAtoH(GPIO_CONTROLLED_BY_CPU1);
+#else
+    bootTimeUs = DeviceGetTime() / DEVICE_TIME_TICKS_PER_US;
+    ReportPhaseSetDuration(REPORT_PHASE_BOOT, bootTimeUs);
+    LOG1(LOG_ID_BOOT, bootTimeUs);
+
+    //  Lights up all LED's in Error_LEDs section, PWM_LEDs section and Group-A to Group-H.
+    //  The checks are executed step by step by the CPU-Timer 1 ISR
+    SequencerStart(seqLedChecks, SEQ_NUMBER_OF_LED_CHECKS);
+    while(!SequencerFinished())
+    {
+        // free for result logging and reporting
+    }
+#endif
 
     //------------------------------------------------------------------------------
 
+    analogInitStart = DeviceGetTime();
+
     //  initialise all PWMs (ePWM 1 to 16)
     PwmInitAll();
 
@@ -78,19 +207,136 @@ void main(void)
     //  initialise all ADCs (module A,B,C,D)
     AdcInitAll();
 
+#if ADC_CAPTURE_DMA
+    //  set up the UDP telemetry ring and the process image for the CM, then capture the
+    //  results of all ADCs with the DMA (CH1 to CH4)
+    TelemetryInit();
+    ProcessImageInit();
+    DmaInitAdcCapture();
+#endif
+
+    //  compute the gamma lookup table of the PWM_LEDs
+    ADCtoPWM_Init();
+
+#if CLA_ADC_ENABLE
+    //  start the CLA tasks of the ADCIN check (PWM_LED compares and error counters, ADC-A INT1)
+    ClaAdcInit();
+#endif
+
+    //  keep the ADC calibration table of the last calibration (if valid)
+    AdcCalInit();
+
+    //  capture period and duty of the PWM outputs and feedback lines (eCAP1 to eCAP6, DMA CH6)
+    EcapInitAll();
+
+    //  count and filter the pulses on the reset lines of the hardware error detection (CLB1, CLB2)
+    ClbInit();
+
+    //  trip all PWMs in hardware when a reset line is pulled LOW (input X-BAR, ePWM X-BAR)
+    TripInit();
+
+    //  list the peripherals whose clock runs without a driver (clockUnused, see in debugger)
+    ClockReport();
+
+    analogInitTimeUs = (DeviceGetTime() - analogInitStart) / DEVICE_TIME_TICKS_PER_US;
+    ReportPhaseSetDuration(REPORT_PHASE_ANALOG_INIT, analogInitTimeUs);
+    LOG1(LOG_ID_ANALOG_INIT, analogInitTimeUs);
+
     //------------------------------------------------------------------------------
 
-    //  Checks Hardware_Error_Detection section
-    Hardware_Error_Detection_Check();
+    //  tune the acquisition window of every channel to the impedance of its path
+    ReportPhaseStart(REPORT_PHASE_ADC_ACQPS);
+    ADC_TuneAcqps();
+    ReportPhaseStop(REPORT_PHASE_ADC_ACQPS);
+
+    //  measure the settling time of the DAC/mux/ADC path for the sparse ADCIN check
+    if (adcSweepMode == ADC_SWEEP_SPARSE)
+    {
+        ReportPhaseStart(REPORT_PHASE_ADC_SETTLE);
+        ADC_MeasureSettleTime();
+        ReportPhaseStop(REPORT_PHASE_ADC_SETTLE);
+    }
+
+    //  calibrate gain, offset and INL of all ADC channels with the DACs (set in the debugger)
+    if (adcCalRequest)
+    {
+        ReportPhaseStart(REPORT_PHASE_ADC_CAL);
+        AdcCalRun();
+        ReportPhaseStop(REPORT_PHASE_ADC_CAL);
+    }
 
-    //  Checks all ADCINs
-    ADCINs_Check();
+    //  Checks Hardware_Error_Detection section and all ADCINs. With the DMA capture the steps
+    //  are clocked by the ePWM1 SOC frames, so every mux/DAC change is measured a fixed number
+    //  of conversions later
+#if ADC_CAPTURE_DMA && SEQ_FRAME_LOCKED
+    SequencerStartFrameLocked(seqAnalogChecks, SEQ_NUMBER_OF_ANALOG_CHECKS);
+#else
+    SequencerStart(seqAnalogChecks, SEQ_NUMBER_OF_ANALOG_CHECKS);
+#endif
 
     //------------------------------------------------------------------------------
 
     // Continuous loop main programme
     while(1)
     {
+        OffloadCompletion completion;
+
+        //  write the phase timing and results over UART once the analog checks are finished
+        if (!reportSent && SequencerFinished())
+        {
+            LOG1(LOG_ID_REPORT_SENT, ReportSend());
+            reportSent = true;
+        }
+
+        //  send the pushed log records which fit into the UART FIFO (never waits), but not
+        //  inside a packet of the datalogger
+        if (!DlogSending())
+            LogService();
+
+        //  send the packets of the datalogger which fit into the UART FIFO (never waits)
+        DlogService();
+
+        //  evaluate and send the measured points of the frequency response analyzer
+        if (!DlogSending())
+            SfraService();
+
+        //  receive, start and answer the test plans of the host
+        if (reportSent)
+            TestPlanService();
+
+        // free for result logging and reporting while the analog checks are running
+
+#if PWM_HRPWM
+        //  track the drift of the MEP step size (temperature, supply voltage)
+        PwmHrCalibrationService();
+#endif
+
+        //  update frequency and duty of all captured signals
+        EcapService();
+
+#if DEVICE_INSTRUMENTATION
+        //  track the high-water mark of the stack (deviceStack)
+        DeviceStackService();
+#endif
+
+        //  commit a parameter change (paramRequest), the flash is only written between checks
+        if (SequencerFinished())
+            ParamService();
+
+        //  run the SVPWM/DPWM modulator on three PWM_LEDs (modCheckRequest, set in the debugger)
+        if (SequencerFinished())
+            ModCheckService();
+
+        //  check the path to the CPU2 worker with one echo job at a time
+        if (OffloadGetPending() == 0
+            && OffloadDispatch(OFFLOAD_FUNCTION_ECHO, &offloadEchoValue, 1, 0))
+            offloadEchoValue++;
 
+        while (OffloadGetCompletion(&completion))
+        {
+            offloadEchoCount++;
+            if (completion.status != OFFLOAD_STATUS_OK || completion.result != offloadEchoValue - 1)
+                offloadEchoErrors++;
+        }
     }
 }
@@ -0,0 +1,84 @@
+//=================================================================================================
+/// @file     TB_Functions_cpu2.c
+///
+/// @brief    File contains the functions of the GPIO LED check (Group-A to Group-H) which is
+///           executed by CPU2. CPU1 gives the control of the LED GPIOs to CPU2 before the check
+///           is started and runs the Error LED and PWM LED checks at the same time. The LEDs are
+///           switched with the bitmask LED driver of CPU1 (TB_LED.c, linked from CTB_TestCode)
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Functions_cpu2.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+long double OFFTIME = 10000, ONTIME = 500000;
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+
+//=== Function:GPIOLEDs_Check==========================================================================
+///
+/// @brief  Function to light-up the First LEDs of all the Group-A to Group-H and followed...
+///         by the next LEDs till the last LEDs of all groups.
+///         repeats the process for 16 times
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void GPIOLEDs_Check(void)
+{
+    EALLOW;
+    for(uint16_t j = 0; j < 16; j++)
+    {
+        for(uint16_t i = 0; i < 10; i++)
+        {
+            GPIOLEDs_On(i);
+            DELAY_US(ONTIME);
+            GPIOLEDs_Off(i);
+            DELAY_US(OFFTIME);
+        }
+    }
+    EDIS;
+}
+
+//=== Function: GPIOLEDs_On ==========================================================================
+///
+/// @brief  Function to turn-ON all fisrt LEDs in all Groups at a time, followed by second LEDs and so on
+///
+/// @param  void
+///
+/// @return void
+///
+//===========================================================================================================
+void GPIOLEDs_On(int i)
+{
+    if (i >= 0 && i < LED_NUMBER_OF_GPIO_LEDS)
+        LedOn(&ledGpioGroup, 1UL << i);
+}
+
+//=== Function: GPIOLEDs_Off ==========================================================================
+///
+/// @brief  Function to turn-OFF all fisrt LEDs in all Groups at a time, followed by second LEDs and so on
+///
+/// @param  void
+///
+/// @return void
+///
+//===========================================================================================================
+void GPIOLEDs_Off(int i)
+{
+    if (i >= 0 && i < LED_NUMBER_OF_GPIO_LEDS)
+        LedOff(&ledGpioGroup, 1UL << i);
+}
@@ -0,0 +1,36 @@
+//=================================================================================================
+/// @file     TB_Functions_cpu2.h
+///
+/// @brief    File contains the functions of the GPIO LED check (Group-A to Group-H) which is
+///           executed by CPU2
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+#ifndef MYFUNCTIONS_CPU2_H_
+#define MYFUNCTIONS_CPU2_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+#include "TB_Shared.h"
+#include "TB_LED.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// On/off times of the LED check in us
+extern long double OFFTIME, ONTIME;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+extern void GPIOLEDs_Check(void);
+extern void GPIOLEDs_On(int);
+extern void GPIOLEDs_Off(int);
+
+#endif
@@ -0,0 +1,93 @@
+//=================================================================================================
+/// @file     main.c
+///
+/// @brief    File contains the main programme of CPU2 for the CTB test. CPU2 waits for the start
+///           command of CPU1 in the shared RAM, runs the GPIO LED check (Group-A to Group-H) and
+///           reports its state in the shared RAM. In the meantime CPU1 runs the Error LED and
+///           PWM LED checks. The GPIOs and RAMGS2 are given to CPU2 by CPU1 before the start,
+///           CPU2 does not write RAMGS2 before CPU1 has set TB_SHARED_IPC_FLAG
+///
+/// @version  V1.1.0
+///
+/// @date     23-04-2024
+///
+/// @author   Vijay
+//=================================================================================================
+
+//-------------------------------------------------------------------------------------------------
+// Including
+//-------------------------------------------------------------------------------------------------
+#include "TB_Functions_cpu2.h"
+#include "TB_Device.h"
+#include "TB_Offload.h"
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Commands of CPU1 (CPU2 can only read)
+volatile uint16_t cpu1ToCpu2[TB_SHARED_SIZE];
+#pragma DATA_SECTION(cpu1ToCpu2,"SHARERAMGS3");
+// Results for CPU1 (master of RAMGS2 is CPU2)
+volatile uint16_t cpu2ToCpu1[TB_SHARED_SIZE];
+#pragma DATA_SECTION(cpu2ToCpu1,"SHARERAMGS2");
+
+//=== Function: main ==============================================================================
+///
+/// @brief main programme
+///
+/// @param void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+    bool sharedRamReady = false;
+
+    //  initialise microcontroller (CPU2)
+    DeviceInit(DEVICE_DEFAULT);
+
+    //  compute the port masks of the LEDs in Group-A to Group-H for the bitmask LED driver
+    LedInit();
+
+    //  wait for CPU1 and start the offload worker (jobs in RAMGS4, completions in RAMGS5)
+    OffloadInit();
+
+    // Continuous loop main programme
+    while(1)
+    {
+        //  execute the jobs of CPU1
+        OffloadWorkerPoll();
+
+#if DEVICE_INSTRUMENTATION
+        //  track the high-water mark of the stack (deviceStack)
+        DeviceStackService();
+#endif
+
+        if (!sharedRamReady)
+        {
+            //  RAMGS2 belongs to CPU1 until it sets the flag, writes of CPU2 would be lost
+            if (Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCSTS.all & TB_SHARED_IPC_FLAG)
+            {
+                Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = TB_SHARED_IPC_FLAG;
+                sharedRamReady = true;
+            }
+        }
+        else if (cpu1ToCpu2[TB_SHARED_GPIOLEDS_START] == TB_SHARED_CMD_START
+            && cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] != TB_SHARED_STATE_FINISHED)
+        {
+            cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] = TB_SHARED_STATE_RUNNING;
+
+            //  Lights up all LED's in Group-A to Group-H
+            GPIOLEDs_Check();
+
+            cpu2ToCpu1[TB_SHARED_GPIOLEDS_CYCLES]++;
+            cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] = TB_SHARED_STATE_FINISHED;
+        }
+        else if (cpu1ToCpu2[TB_SHARED_GPIOLEDS_START] == TB_SHARED_CMD_NONE)
+        {
+            // Ready for the next start command
+            cpu2ToCpu1[TB_SHARED_GPIOLEDS_STATE] = TB_SHARED_STATE_IDLE;
+        }
+    }
+}
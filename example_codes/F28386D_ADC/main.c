@@ -6,9 +6,17 @@
 ///						des Analog-Digital-Wandlers fr den Mikrocontroller TMS320F2838x. Erklrungen zur
 ///						genauen Funktion sind im Modul zu finden.
 ///
-/// @version	V1.1
+///						nderung in Version 1.2: Mit MAIN_INTERLEAVED_ADC = 1 wird ADCIN14 zeitversetzt von
+///						allen vier ADC-Modulen gemessen (myInterleave.c), die zusammengefhrten Blcke
+///						stehen in "interleaveStream"
 ///
-/// @date			06.09.2022
+///						nderung in Version 1.3: Mit SOGI_PLL_ENABLE = 1 (mySogiPll.h) triggert ePWM8 den
+///						ADC mit 10 kHz und AdcAInt1ISR() synchronisiert die SOGI-PLL "adcSogiPll" auf
+///						ADCIN0 (Winkel, Frequenz, Amplitude und Laufzeit in Takten)
+///
+/// @version	V1.3
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -17,11 +25,16 @@
 //-------------------------------------------------------------------------------------------------
 #include "myADC.h"
 #include "myPWM.h"
+#include "myInterleave.h"
+#include "mySogiPll.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// 1: Verschachtelte Messung von ADCIN14 mit allen Modulen (myInterleave.c)
+// 0: Messung von ADCIN0 ... 2 mit ADC-A, getriggert durch ePWM8 (myADC.c)
+#define MAIN_INTERLEAVED_ADC		0
 
 
 //-------------------------------------------------------------------------------------------------
@@ -32,6 +45,10 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+#if MAIN_INTERLEAVED_ADC
+// Im Debugger auf "true" setzen, um die Module mit dem nchsten Block aneinander anzugleichen
+volatile bool interleaveMatchRequest = false;
+#endif
 
 
 //=== Function: main ==============================================================================
@@ -47,11 +64,24 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
+#if MAIN_INTERLEAVED_ADC
+		// ADC-Module, ePWM7/8 und DMA fr die verschachtelte Messung initialisieren und den
+		// ersten Block starten
+		InterleaveInit();
+		InterleaveStartBlock();
+#else
 		// ADC initialisieren (Modul A)
 		AdcAInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
+#if SOGI_PLL_ENABLE
+		// SOGI-PLL vor dem ersten Messwert initialisieren
+		SogiPllInit(&adcSogiPll, SOGI_PLL_NOMINAL_FREQUENCY, SOGI_PLL_SAMPLE_FREQUENCY);
+#endif
 		// ePWM8-Modul initialisieren (zur PWM-getriggerten ADC-Messung)
 		PwmInitPwm8();
+#endif
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -74,6 +104,18 @@ void main(void)
 		// Dauerschleife Hauptprogramm
 		while(1)
 		{
+#if MAIN_INTERLEAVED_ADC
+				// Block auswerten (z.B. FFT des Stroms) und den nchsten Block starten
+				if (interleaveBlockReady)
+				{
+						if (interleaveMatchRequest)
+						{
+								InterleaveMatchModules();
+								interleaveMatchRequest = false;
+						}
+						InterleaveStartBlock();
+				}
+#endif
 				/*
 				// Beispiel fr eine manuell getriggerte ADC-Messung:
 				// Dazu muss zuerst ADCSOC0CTL.TRIGSEL = 0 gesetzt werden
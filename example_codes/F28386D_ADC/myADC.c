@@ -12,9 +12,13 @@
 ///							Es werden beispielhaft drei Messungen (SOC) mit der selben Triggerquelle und
 ///							unterschiedlichen Eingngen/Kanlen konfiguriert.
 ///
-/// @version    V1.3
+///							nderung in Version 1.4: Mit SOGI_PLL_ENABLE = 1 (mySogiPll.h) fhrt die ISR mit
+///							jedem Messwert von ADCIN0 die SOGI-PLL "adcSogiPll" aus, die Laufzeit eines
+///							Abtastschritts steht in "adcSogiPll.cyclesLast" und "adcSogiPll.cyclesMax"
 ///
-/// @date       13.02.2023
+/// @version    V1.4
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -31,6 +35,10 @@
 uint16_t ADCIN0 = 0;
 uint16_t ADCIN1 = 0;
 uint16_t ADCIN2 = 0;
+#if SOGI_PLL_ENABLE
+// SOGI-PLL des Messwerts von ADCIN0 (wird von SogiPllInit() in der main() gesetzt)
+SogiPll adcSogiPll;
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -407,6 +415,8 @@ void AdcAInit(uint32_t resolution,
 //=================================================================================================
 __interrupt void AdcAInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCA1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -424,10 +434,21 @@ __interrupt void AdcAInt1ISR(void)
 		ADCIN1 = AdcaResultRegs.ADCRESULT1;
 		ADCIN2 = AdcaResultRegs.ADCRESULT2;
 
+#if SOGI_PLL_ENABLE
+		// Netzsynchronisation mit dem Messwert von ADCIN0 (Mitte des Messbereichs = 0)
+		{
+				uint32_t start = PROFILE_TIMESTAMP();
+
+				SogiPllRun(&adcSogiPll, SOGI_PLL_ADC_SCALE * ((float)ADCIN0 - SOGI_PLL_ADC_OFFSET));
+				SogiPllTrace(&adcSogiPll, start);
+		}
+#endif
+
     // Interrupt-Flag im ADC-Modul lschen
 		AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCA1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCA1);
 }
 
 
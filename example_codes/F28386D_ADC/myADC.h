@@ -12,9 +12,12 @@
 ///							Es werden beispielhaft drei Messungen (SOC) mit der selben Triggerquelle und
 ///							unterschiedlichen Eingngen/Kanlen konfiguriert.
 ///
-/// @version    V1.3
+///							nderung in Version 1.4: Mit SOGI_PLL_ENABLE = 1 (mySogiPll.h) fhrt die ISR mit
+///							jedem Messwert von ADCIN0 die SOGI-PLL "adcSogiPll" zur Netzsynchronisation aus
 ///
-/// @date       13.02.2023
+/// @version    V1.4
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -25,6 +28,8 @@
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
 #include "myPWM.h"
+#include "myProfile.h"
+#include "mySogiPll.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -209,6 +214,10 @@
 extern uint16_t ADCIN0;
 extern uint16_t ADCIN1;
 extern uint16_t ADCIN2;
+#if SOGI_PLL_ENABLE
+// SOGI-PLL des Messwerts von ADCIN0 (Winkel, Frequenz, Amplitude und Laufzeit)
+extern SogiPll adcSogiPll;
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
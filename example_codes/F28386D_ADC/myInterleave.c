@@ -0,0 +1,437 @@
+//=================================================================================================
+/// @file       myInterleave.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die zeitversetzte (interleaved) Messung
+///							eines Signals mit zwei oder vier ADC-Modulen (siehe myInterleave.h)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myInterleave.h"
+#include "math.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte der Module (muss im GS-RAM liegen, da der DMA nur darauf zugreifen kann)
+#pragma DATA_SECTION(interleaveModuleBuffer, "dmabuf");
+volatile uint16_t interleaveModuleBuffer[INTERLEAVE_NUMBER_OF_MODULES][INTERLEAVE_SAMPLES_PER_MODULE];
+// Zusammengefhrter Block
+#pragma DATA_SECTION(interleaveStream, "capture");
+uint16_t interleaveStream[INTERLEAVE_STREAM_LENGTH];
+int16_t interleaveOffset[INTERLEAVE_NUMBER_OF_MODULES];
+uint16_t interleaveGain[INTERLEAVE_NUMBER_OF_MODULES];
+volatile bool interleaveBlockReady = false;
+volatile uint32_t interleaveBlocks = 0;
+// Register der Module und DMA-Kanle (Index = Modul)
+static volatile struct ADC_REGS *const interleaveAdcRegs[4] =
+{
+		&AdcaRegs, &AdcbRegs, &AdccRegs, &AdcdRegs
+};
+static volatile struct ADC_RESULT_REGS *const interleaveResultRegs[4] =
+{
+		&AdcaResultRegs, &AdcbResultRegs, &AdccResultRegs, &AdcdResultRegs
+};
+static volatile struct CH_REGS *const interleaveDmaRegs[4] =
+{
+		&DmaRegs.CH1, &DmaRegs.CH2, &DmaRegs.CH3, &DmaRegs.CH4
+};
+// SOC-Trigger und DMA-Trigger der Module (Reihenfolge = zeitliche Reihenfolge in der Periode)
+#if INTERLEAVE_NUMBER_OF_MODULES == 4
+static const uint16_t interleaveTrigger[4] =
+{
+		ADC_TRIGGER_EPWM7_SOCA, ADC_TRIGGER_EPWM8_SOCA, ADC_TRIGGER_EPWM7_SOCB, ADC_TRIGGER_EPWM8_SOCB
+};
+#else
+static const uint16_t interleaveTrigger[2] =
+{
+		ADC_TRIGGER_EPWM7_SOCA, ADC_TRIGGER_EPWM7_SOCB
+};
+#endif
+static const uint16_t interleaveDmaTrigger[4] =
+{
+		INTERLEAVE_DMA_TRIGGER_ADCAINT1, INTERLEAVE_DMA_TRIGGER_ADCBINT1,
+		INTERLEAVE_DMA_TRIGGER_ADCCINT1, INTERLEAVE_DMA_TRIGGER_ADCDINT1
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: InterleaveInitAdc =================================================================
+///
+/// @brief  Funktion initialisiert ein ADC-Modul fr die verschachtelte Messung: SOC0 wandelt
+///					INTERLEAVE_CHANNEL beim Trigger des Moduls, EOC0 lst ADCINT1 (DMA-Trigger) aus,
+///					PPB1 korrigiert den Offset von ADCRESULT0. Der Takt muss eingeschaltet sein
+///
+/// @param  uint16_t module
+///
+/// @return void
+///
+//=================================================================================================
+static void InterleaveInitAdc(uint16_t module)
+{
+		volatile struct ADC_REGS *regs = interleaveAdcRegs[module];
+
+		// ADCCLK = SYSCLK / 4 = 50 MHz, 12 Bit Single-Ended, Trimmwerte aus dem OTP
+		regs->ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
+		regs->ADCCTL2.bit.RESOLUTION = ADC_RESOLUTION_12_BIT;
+		regs->ADCCTL2.bit.SIGNALMODE = ADC_SINGLE_ENDED_MODE;
+		AdcInitTrimRegister(module, ADC_RESOLUTION_12_BIT, ADC_SINGLE_ENDED_MODE);
+		regs->ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+		regs->ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
+
+		// SOC0: gemeinsamer Eingang, Trigger des Moduls
+		regs->ADCSOC0CTL.bit.TRIGSEL = interleaveTrigger[module];
+		regs->ADCSOC0CTL.bit.CHSEL = INTERLEAVE_CHANNEL;
+		regs->ADCSOC0CTL.bit.ACQPS = INTERLEAVE_ACQPS;
+		regs->ADCINTSOCSEL1.bit.SOC0 = ADC_NO_SOC_TRIGGER;
+
+		// ADCINT1 bei jedem EOC0 (kontinuierlich, der DMA lscht das Flag nicht)
+		regs->ADCINTSEL1N2.bit.INT1SEL = ADC_EOC_NUMBER_0;
+		regs->ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+		regs->ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
+
+		// PPB1 gehrt zu SOC0, OFFCAL wird vom Ergebnis abgezogen
+		// (siehe S. 2540 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		regs->ADCPPB1CONFIG.bit.CONFIG = 0;
+		regs->ADCPPB1OFFCAL.bit.OFFCAL = interleaveOffset[module];
+}
+
+
+//=== Function: InterleaveInitDma =================================================================
+///
+/// @brief  Funktion konfiguriert den DMA-Kanal eines Moduls: pro ADCINT1 ein Wort aus ADCRESULT0
+///					in den Puffer des Moduls, nach INTERLEAVE_SAMPLES_PER_MODULE Wrtern hlt der Kanal
+///					an. Nur der Kanal des letzten Moduls lst einen Interrupt aus
+///
+/// @param  uint16_t module
+///
+/// @return void
+///
+//=================================================================================================
+static void InterleaveInitDma(uint16_t module)
+{
+		volatile struct CH_REGS *dma = interleaveDmaRegs[module];
+
+		dma->CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		dma->SRC_BEG_ADDR_SHADOW = (uint32_t)&interleaveResultRegs[module]->ADCRESULT0;
+		dma->SRC_ADDR_SHADOW     = (uint32_t)&interleaveResultRegs[module]->ADCRESULT0;
+		dma->DST_BEG_ADDR_SHADOW = (uint32_t)&interleaveModuleBuffer[module][0];
+		dma->DST_ADDR_SHADOW     = (uint32_t)&interleaveModuleBuffer[module][0];
+		// Ein Wort pro Burst, ein Burst pro Trigger
+		dma->BURST_SIZE.bit.BURSTSIZE = 0;
+		dma->SRC_BURST_STEP = 0;
+		dma->DST_BURST_STEP = 0;
+		dma->TRANSFER_SIZE = INTERLEAVE_SAMPLES_PER_MODULE - 1;
+		dma->SRC_TRANSFER_STEP = 0;
+		dma->DST_TRANSFER_STEP = 1;
+		dma->SRC_WRAP_SIZE = 0xFFFF;
+		dma->SRC_WRAP_STEP = 0;
+		dma->DST_WRAP_SIZE = 0xFFFF;
+		dma->DST_WRAP_STEP = 0;
+		dma->MODE.bit.PERINTSEL = 1;
+		dma->MODE.bit.PERINTE = 1;
+		dma->MODE.bit.OVRINTE = 0;
+		dma->MODE.bit.ONESHOT = 0;
+		// Kanal hlt nach einem Block an (InterleaveStartBlock() startet ihn neu)
+		dma->MODE.bit.CONTINUOUS = 0;
+		dma->MODE.bit.DATASIZE = 0;
+		// Interrupt am Ende des Transfers
+		dma->MODE.bit.CHINTMODE = 1;
+		dma->MODE.bit.CHINTE = (module == INTERLEAVE_NUMBER_OF_MODULES - 1) ? 1 : 0;
+		dma->CONTROL.bit.PERINTCLR = 1;
+		dma->CONTROL.bit.ERRCLR = 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: InterleaveInit ====================================================================
+///
+/// @brief  Funktion initialisiert die ADC-Module, ePWM7/8 als versetzte SOC-Trigger und die
+///					DMA-Kanle CH1 ... CH4. Die Messung eines Blocks startet "InterleaveStartBlock()".
+///					Ersetzt "AdcAInit()" und "PwmInitPwm8()"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void InterleaveInit(void)
+{
+		uint16_t module;
+
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				interleaveOffset[module] = 0;
+				interleaveGain[module] = INTERLEAVE_GAIN_ONE;
+		}
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Takte der ADC-Module einschalten (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D,
+		// Rev. D, July 2022)
+		CpuSysRegs.PCLKCR13.bit.ADC_A = 1;
+		CpuSysRegs.PCLKCR13.bit.ADC_B = 1;
+#if INTERLEAVE_NUMBER_OF_MODULES == 4
+		CpuSysRegs.PCLKCR13.bit.ADC_C = 1;
+		CpuSysRegs.PCLKCR13.bit.ADC_D = 1;
+#endif
+		__asm(" RPT #4 || NOP");
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				InterleaveInitAdc(module);
+		}
+		// Eine gemeinsame Einschwingzeit fr alle Module
+		// (siehe "Power Up Time" S. 139 Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
+		DELAY_US(500);
+
+		// ePWM7/8: gleiche Periode, TBCLK = EPWMCLK = 100 MHz, Zhler laufen ber TBCLKSYNC
+		// gemeinsam an
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+		CpuSysRegs.PCLKCR2.bit.EPWM7 = 1;
+		CpuSysRegs.PCLKCR2.bit.EPWM8 = 1;
+		__asm(" RPT #4 || NOP");
+		EPwm7Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;
+		EPwm7Regs.TBCTL.bit.CLKDIV = PWM_CLK_DIV_1;
+		EPwm7Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_1;
+		EPwm7Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;
+		EPwm7Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;
+		EPwm7Regs.TBPRD = INTERLEAVE_TRIGGER_PERIOD - 1;
+		EPwm7Regs.CMPB.bit.CMPB = INTERLEAVE_TRIGGER_PERIOD / 2;
+		// SOCA bei TBCTR = 0 (Modul A), SOCB bei CMPB = T/2 (Modul B bzw. C)
+		EPwm7Regs.ETSEL.bit.SOCASEL = PWM_ET_CTR_ZERO;
+		EPwm7Regs.ETSEL.bit.SOCBSEL = PWM_ET_CTRU_CMPB;
+		EPwm7Regs.ETPS.bit.SOCAPRD = PWM_ET_1ST;
+		EPwm7Regs.ETPS.bit.SOCBPRD = PWM_ET_1ST;
+		EPwm7Regs.ETSEL.bit.SOCAEN = PWM_ET_SOC_ENABLE;
+		EPwm7Regs.ETSEL.bit.SOCBEN = PWM_ET_SOC_ENABLE;
+#if INTERLEAVE_NUMBER_OF_MODULES == 4
+		EPwm8Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;
+		EPwm8Regs.TBCTL.bit.CLKDIV = PWM_CLK_DIV_1;
+		EPwm8Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_1;
+		EPwm8Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;
+		EPwm8Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;
+		EPwm8Regs.TBPRD = INTERLEAVE_TRIGGER_PERIOD - 1;
+		EPwm8Regs.CMPA.bit.CMPA = INTERLEAVE_TRIGGER_PERIOD / 4;
+		EPwm8Regs.CMPB.bit.CMPB = (3 * INTERLEAVE_TRIGGER_PERIOD) / 4;
+		// SOCA bei CMPA = T/4 (Modul B), SOCB bei CMPB = 3T/4 (Modul D)
+		EPwm8Regs.ETSEL.bit.SOCASEL = PWM_ET_CTRU_CMPA;
+		EPwm8Regs.ETSEL.bit.SOCBSEL = PWM_ET_CTRU_CMPB;
+		EPwm8Regs.ETPS.bit.SOCAPRD = PWM_ET_1ST;
+		EPwm8Regs.ETPS.bit.SOCBPRD = PWM_ET_1ST;
+		EPwm8Regs.ETSEL.bit.SOCAEN = PWM_ET_SOC_ENABLE;
+		EPwm8Regs.ETSEL.bit.SOCBEN = PWM_ET_SOC_ENABLE;
+#endif
+
+		// DMA einschalten, der DMA luft weiter, wenn der Debugger die CPU anhlt
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				InterleaveInitDma(module);
+		}
+		// Trigger der Kanle CH1 ... CH4 (je 8 Bit in DMACHSRCSEL1)
+		DmaClaSrcSelRegs.DMACHSRCSEL1.all = 0;
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				DmaClaSrcSelRegs.DMACHSRCSEL1.all |= (uint32_t)interleaveDmaTrigger[module] << (8 * module);
+		}
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// ISR des Kanals des letzten Moduls (INT7.2 bzw. INT7.4)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#if INTERLEAVE_NUMBER_OF_MODULES == 4
+		PieVectTable.DMA_CH4_INT = &InterleaveDmaISR;
+		PieCtrlRegs.PIEIER7.bit.INTx4 = 1;
+#else
+		PieVectTable.DMA_CH2_INT = &InterleaveDmaISR;
+		PieCtrlRegs.PIEIER7.bit.INTx2 = 1;
+#endif
+		IER |= M_INT7;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: InterleaveStartBlock ==============================================================
+///
+/// @brief  Funktion startet die Messung eines Blocks. Die Zeitbasen von ePWM7/8 werden dafr kurz
+///					angehalten (TBCLKSYNC, betrifft alle ePWM-Module) und auf TBPRD gesetzt, damit alle
+///					DMA-Kanle mit derselben Abtastperiode beginnen und Modul A den ersten Wert liefert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void InterleaveStartBlock(void)
+{
+		uint16_t module;
+
+		interleaveBlockReady = false;
+
+		EALLOW;
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+		EPwm7Regs.TBCTR = INTERLEAVE_TRIGGER_PERIOD - 1;
+#if INTERLEAVE_NUMBER_OF_MODULES == 4
+		EPwm8Regs.TBCTR = INTERLEAVE_TRIGGER_PERIOD - 1;
+#endif
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				// Offsetkorrektur bernehmen, alte Trigger verwerfen und Kanal starten
+				interleaveAdcRegs[module]->ADCPPB1OFFCAL.bit.OFFCAL = interleaveOffset[module];
+				interleaveAdcRegs[module]->ADCINTFLGCLR.bit.ADCINT1 = 1;
+				interleaveAdcRegs[module]->ADCINTOVFCLR.bit.ADCINT1 = 1;
+				interleaveDmaRegs[module]->CONTROL.bit.PERINTCLR = 1;
+				interleaveDmaRegs[module]->CONTROL.bit.ERRCLR = 1;
+				interleaveDmaRegs[module]->CONTROL.bit.RUN = 1;
+		}
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+		EDIS;
+}
+
+
+//=== Function: InterleaveSetCorrection ===========================================================
+///
+/// @brief  Funktion setzt die Korrekturwerte eines Moduls. Der Offset wird beim nchsten
+///					"InterleaveStartBlock()" in ADCPPB1OFFCAL bernommen, die Verstrkung beim nchsten
+///					Zusammenfhren
+///
+/// @param  uint16_t module, int16_t offset, uint16_t gain
+///
+/// @return void
+///
+//=================================================================================================
+void InterleaveSetCorrection(uint16_t module, int16_t offset, uint16_t gain)
+{
+		if (module >= INTERLEAVE_NUMBER_OF_MODULES)
+		{
+				return;
+		}
+		// Wertebereich von OFFCAL (10 Bit mit Vorzeichen)
+		if (offset > 511)
+		{
+				offset = 511;
+		}
+		else if (offset < -512)
+		{
+				offset = -512;
+		}
+		interleaveOffset[module] = offset;
+		interleaveGain[module] = gain;
+}
+
+
+//=== Function: InterleaveMatchModules ============================================================
+///
+/// @brief  Funktion gleicht die Module aus dem letzten Block an Modul A an. Alle Module haben
+///					dasselbe Signal gemessen, daher mssen Mittelwert und Standardabweichung nach der
+///					Korrektur bereinstimmen. Die Verstrkung von Modul B ... D wird mit dem Verhltnis
+///					der Standardabweichungen skaliert, der verbleibende Unterschied der Mittelwerte wird
+///					zum Offset addiert. Das Signal muss eine Wechselgre enthalten (z.B. Sinus) und
+///					darf die Grenzen 0 bzw. 4095 nicht erreichen. Aufruf nur, wenn ein Block vorliegt
+///					und bevor der nchste gestartet wird
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void InterleaveMatchModules(void)
+{
+		float mean[INTERLEAVE_NUMBER_OF_MODULES];
+		float deviation[INTERLEAVE_NUMBER_OF_MODULES];
+		float gain;
+		float offset;
+		uint16_t module;
+		uint16_t k;
+
+		for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				float sum = 0.0f;
+				float sumSquares = 0.0f;
+
+				for (k = 0; k < INTERLEAVE_SAMPLES_PER_MODULE; k++)
+				{
+						float value = (float)interleaveModuleBuffer[module][k];
+						sum += value;
+						sumSquares += value * value;
+				}
+				mean[module] = sum / INTERLEAVE_SAMPLES_PER_MODULE;
+				deviation[module] = sqrtf(sumSquares / INTERLEAVE_SAMPLES_PER_MODULE
+																	- mean[module] * mean[module]);
+		}
+
+		// Ohne Wechselgre ist die Verstrkung nicht bestimmbar
+		if (deviation[0] < 1.0f)
+		{
+				return;
+		}
+
+		for (module = 1; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+		{
+				if (deviation[module] < 1.0f)
+				{
+						continue;
+				}
+				// Gesamtverstrkung relativ zu den Rohwerten von Modul A
+				gain = deviation[0] / deviation[module];
+				// Offset so, dass gain * (Mittelwert - Offset) = Mittelwert von Modul A
+				offset = mean[module] - mean[0] / gain;
+				InterleaveSetCorrection(module,
+																interleaveOffset[module] + (int16_t)floorf(offset + 0.5f),
+																(uint16_t)(interleaveGain[0] * gain + 0.5f));
+		}
+}
+
+
+//=== Function: InterleaveDmaISR ==================================================================
+///
+/// @brief  ISR wird aufgerufen, wenn der DMA-Kanal des letzten Moduls seinen Block bertragen hat.
+///					Das letzte Modul wandelt in jeder Periode zuletzt, daher sind alle Puffer voll. Die
+///					Werte werden in zeitlicher Reihenfolge (A, B, C, D, A, ...) zusammengefhrt und mit
+///					der Verstrkung des Moduls (Q14) korrigiert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void InterleaveDmaISR(void)
+{
+		uint16_t *stream = interleaveStream;
+		uint32_t value;
+		uint16_t module;
+		uint16_t k;
+
+		for (k = 0; k < INTERLEAVE_SAMPLES_PER_MODULE; k++)
+		{
+				for (module = 0; module < INTERLEAVE_NUMBER_OF_MODULES; module++)
+				{
+						value = ((uint32_t)interleaveModuleBuffer[module][k] * interleaveGain[module]) >> 14;
+						*stream++ = (value > INTERLEAVE_MAX_RESULT) ? INTERLEAVE_MAX_RESULT : (uint16_t)value;
+				}
+		}
+		interleaveBlocks++;
+		interleaveBlockReady = true;
+
+    // Interrupt der Gruppe 7 besttigen (da gehrt der DMA-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+}
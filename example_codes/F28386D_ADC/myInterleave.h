@@ -0,0 +1,102 @@
+//=================================================================================================
+/// @file       myInterleave.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die zeitversetzte (interleaved) Messung
+///							eines Signals mit zwei oder vier ADC-Modulen. Alle Module wandeln denselben
+///							Eingang ADCIN14, der beim TMS320F2838x mit allen vier ADC-Modulen verbunden ist
+///							(siehe "Analog Pins and Internal Connections" im Data Sheet TMS320F2838x, SPRSP14D,
+///							Rev. D, Feb. 2021). Die SOC-Trigger der Module sind um 1/n der Abtastperiode
+///							versetzt, dadurch steigt die effektive Abtastrate auf das n-fache der Rate eines
+///							Moduls:
+///							- 2 Module: ePWM7 SOCA (TBCTR = 0) -> ADC-A, ePWM7 SOCB (CMPB = T/2) -> ADC-B
+///							- 4 Module: zustzlich ePWM8 SOCA (CMPA = T/4) -> ADC-B, ePWM7 SOCB -> ADC-C,
+///							  ePWM8 SOCB (CMPB = 3T/4) -> ADC-D
+///							Jedes Modul schreibt sein Ergebnis in ADCRESULT0, je ein DMA-Kanal (CH1 ... CH4)
+///							kopiert es beim ADCINT1 in den Puffer des Moduls. Nach einem Block von
+///							INTERLEAVE_SAMPLES_PER_MODULE Messwerten je Modul sortiert die ISR des letzten
+///							DMA-Kanals die Werte in zeitlicher Reihenfolge in "interleaveStream" ein und
+///							korrigiert dabei den Verstrkungsfehler jedes Moduls. Der Offset jedes Moduls wird
+///							in Hardware durch den Post-Processing-Block 1 (ADCPPB1OFFCAL) korrigiert.
+///							Unterschiede von Offset und Verstrkung zwischen den Modulen erzeugen
+///							Strlinien bei fs/n, "InterleaveMatchModules()" gleicht sie aus einem Block mit
+///							einem beliebigen stationren Signal an Modul A an (Mittelwert und
+///							Standardabweichung). Mit INTERLEAVE_NUMBER_OF_MODULES = 2 werden nur ADC-A und
+///							ADC-B verwendet
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYINTERLEAVE_H_
+#define MYINTERLEAVE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myADC.h"
+#include "myPWM.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der verschachtelten Module (2 oder 4)
+#define INTERLEAVE_NUMBER_OF_MODULES				4
+// Abtastperiode eines Moduls in TBCLK (TBCLK = EPWMCLK = 100 MHz): 100 -> 1 s, 1 MSPS pro
+// Modul und INTERLEAVE_NUMBER_OF_MODULES MSPS effektiv. Die Periode muss grer als die
+// Wandlungszeit eines Moduls sein (S&H-Fenster + ca. 10,5 ADCCLK = 210 ns bei 12 Bit)
+#define INTERLEAVE_TRIGGER_PERIOD						100
+// Abtastzeitfenster (SYSCLK-Taktzyklen - 1): 20 Takte = 100 ns
+#define INTERLEAVE_ACQPS										19
+// Gemeinsamer Eingang aller Module
+#define INTERLEAVE_CHANNEL									ADC_SINGLE_ENDED_ADCIN14
+// Messwerte pro Modul und Block sowie Lnge des zusammengefhrten Blocks
+#define INTERLEAVE_SAMPLES_PER_MODULE				512
+#define INTERLEAVE_STREAM_LENGTH						(INTERLEAVE_SAMPLES_PER_MODULE * INTERLEAVE_NUMBER_OF_MODULES)
+// Verstrkungskorrektur im Format Q14 (16384 = 1,0)
+#define INTERLEAVE_GAIN_ONE									16384
+// Grter 12 Bit-Messwert
+#define INTERLEAVE_MAX_RESULT								4095
+// DMA-Trigger ADCxINT1 (DMACHSRCSELx, siehe Tabelle "DMA Trigger Source Options",
+// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define INTERLEAVE_DMA_TRIGGER_ADCAINT1			1
+#define INTERLEAVE_DMA_TRIGGER_ADCBINT1			6
+#define INTERLEAVE_DMA_TRIGGER_ADCCINT1			11
+#define INTERLEAVE_DMA_TRIGGER_ADCDINT1			16
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte der Module (vom DMA geschrieben, GS-RAM)
+extern volatile uint16_t interleaveModuleBuffer[INTERLEAVE_NUMBER_OF_MODULES][INTERLEAVE_SAMPLES_PER_MODULE];
+// Zusammengefhrter und korrigierter Block in zeitlicher Reihenfolge
+extern uint16_t interleaveStream[INTERLEAVE_STREAM_LENGTH];
+// Offsetkorrektur (LSB, -512 ... 511, wird in Hardware von ADCRESULT0 abgezogen) und
+// Verstrkungskorrektur (Q14) der Module
+extern int16_t interleaveOffset[INTERLEAVE_NUMBER_OF_MODULES];
+extern uint16_t interleaveGain[INTERLEAVE_NUMBER_OF_MODULES];
+// Wird gesetzt, wenn "interleaveStream" einen neuen Block enthlt
+extern volatile bool interleaveBlockReady;
+// Anzahl der zusammengefhrten Blcke
+extern volatile uint32_t interleaveBlocks;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die ADC-Module, ePWM7/8 und die DMA-Kanle fr die verschachtelte
+// Messung
+extern void InterleaveInit(void);
+// Funktion startet die Messung eines Blocks (alle Module beginnen mit derselben Abtastperiode)
+extern void InterleaveStartBlock(void);
+// Funktion setzt die Korrekturwerte eines Moduls
+extern void InterleaveSetCorrection(uint16_t module, int16_t offset, uint16_t gain);
+// Funktion gleicht Offset und Verstrkung aller Module aus dem letzten Block an Modul A an
+extern void InterleaveMatchModules(void);
+// ISR des DMA-Kanals des letzten Moduls (Block vollstndig)
+extern __interrupt void InterleaveDmaISR(void);
+
+
+#endif
@@ -6,9 +6,12 @@
 ///							Interrupt ausgelst wird und so als Zeitgeber fr periodisch zu erledigende
 ///							Aufgaben genutzt werden kann.
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Taktteiler und Periodendauer des SOCA-Triggers aus myPWM.h
+///							(10 kHz fr die SOGI-PLL mit SOGI_PLL_ENABLE = 1)
 ///
-/// @date       06.09.2022
+/// @version    V1.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -50,18 +53,18 @@ void PwmInitPwm8(void)
     __asm(" RPT #4 || NOP");
 		// Zhlrichtung des Timers: hoch
     EPwm8Regs.TBCTL.bit.CTRMODE = PWM_TB_COUNT_UP;
-		// Taktteiler: 1280
+		// Taktteiler: 1280 (bzw. 1 mit SOGI_PLL_ENABLE = 1)
     // TBCLK = EPWMCLK / (HSPCLKDIV * CLKDIV)
     // EPWMCLK = SYSCLK / 2 = 100 MHz
     // (siehe "DeviceInit()" und S. 165 Reference Manual TMS320F2838x)
-    EPwm8Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_128;
-		EPwm8Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_10;
+    EPwm8Regs.TBCTL.bit.CLKDIV    = PWM_SOCA_TRIGGER_CLK_DIV;
+		EPwm8Regs.TBCTL.bit.HSPCLKDIV = PWM_SOCA_TRIGGER_HSPCLKDIV;
 		// TBCTR nicht mit Wert aus dem Phasenregister laden
     EPwm8Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_DISABLE;
     // Daten, welche in das TBPRD Register (Periodendauer) geschrieben
     //  werden, direkt laden (ohne Umweg ber das Shadow-Register)
     EPwm8Regs.TBCTL.bit.PRDLD = PWM_TB_IMMEDIATE;
-    // Periodendauer auf 100 ms setzen:
+    // Periodendauer auf 100 ms (bzw. 100 us mit SOGI_PLL_ENABLE = 1) setzen:
     // Periodendauer = (HSPCLKDIV * CLKDIV * (TBPRD+1)) / EPWMCLK
     // EPWMCLK = SYSCLK / 2 = 100 MHz
     // (siehe "DeviceInit()" und S. 165 Reference Manual TMS320F2838x)
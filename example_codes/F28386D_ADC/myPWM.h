@@ -6,9 +6,12 @@
 ///							Interrupt ausgelst wird und so als Zeitgeber fr periodisch zu erledigende
 ///							Aufgaben genutzt werden kann
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Mit SOGI_PLL_ENABLE = 1 (mySogiPll.h) lst ePWM8 den
+///							SOCA-Trigger mit der Abtastrate der SOGI-PLL (10 kHz) statt alle 100 ms aus
 ///
-/// @date       06.09.2022
+/// @version    V1.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -18,6 +21,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "mySogiPll.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -205,8 +209,18 @@
 #define PWM_ET_CTRU_CMPB   					 				6
 #define PWM_ET_CTRD_CMPB    								7
 
-// Periodendauer zum zyklischen Auslsen eines SOCA-Triggers (100 ms)
+#if SOGI_PLL_ENABLE
+// Taktteiler und Periodendauer zum zyklischen Auslsen eines SOCA-Triggers mit der
+// Abtastrate der SOGI-PLL (TBCLK = 100 MHz, 10 kHz)
+#define PWM_SOCA_TRIGGER_CLK_DIV						PWM_CLK_DIV_1
+#define PWM_SOCA_TRIGGER_HSPCLKDIV					PWM_HSPCLKDIV_1
+#define PWM_SOCA_TRIGGER_PERIOD							((uint16_t)(100.0e6f / SOGI_PLL_SAMPLE_FREQUENCY) - 1)
+#else
+// Taktteiler und Periodendauer zum zyklischen Auslsen eines SOCA-Triggers (100 ms)
+#define PWM_SOCA_TRIGGER_CLK_DIV						PWM_CLK_DIV_128
+#define PWM_SOCA_TRIGGER_HSPCLKDIV					PWM_HSPCLKDIV_10
 #define PWM_SOCA_TRIGGER_PERIOD							7811
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
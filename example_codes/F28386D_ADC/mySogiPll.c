@@ -0,0 +1,174 @@
+//=================================================================================================
+/// @file       mySogiPll.c
+///
+/// @brief      Datei enthlt die einphasige SOGI-PLL zur Netzsynchronisation (siehe mySogiPll.h).
+///							Ein Abtastschritt besteht aus dem SOGI (zwei Filter 2. Ordnung mit gemeinsamem
+///							Nenner), der Park-Transformation, dem Phasenfehler mit atan2 und dem PI-Regler.
+///							Ohne TMU (z.B. zum Test auf dem PC) werden die Funktionen der C-Bibliothek
+///							verwendet.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <math.h>
+#include "mySogiPll.h"
+#include "myProfile.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Winkel in Umdrehungen (1.0 = 360), atan2 gibt -0.5 ... 0.5 Umdrehungen zurck
+#if defined(__TMS320C28XX_TMU__)
+#define SOGI_PLL_SIN(anglePu)								__sinpuf32(anglePu)
+#define SOGI_PLL_COS(anglePu)								__cospuf32(anglePu)
+#define SOGI_PLL_ATAN2(y, x)								__atan2puf32((y), (x))
+#define SOGI_PLL_SQRT(x)										__sqrt(x)
+#define SOGI_PLL_DIV(a, b)									__divf32((a), (b))
+#else
+#define SOGI_PLL_SIN(anglePu)								sinf(SOGI_PLL_2PI * (anglePu))
+#define SOGI_PLL_COS(anglePu)								cosf(SOGI_PLL_2PI * (anglePu))
+#define SOGI_PLL_ATAN2(y, x)								(atan2f((y), (x)) / SOGI_PLL_2PI)
+#define SOGI_PLL_SQRT(x)										sqrtf(x)
+#define SOGI_PLL_DIV(a, b)									((a) / (b))
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SogiPllInit =======================================================================
+///
+/// @brief  Funktion setzt die Zustnde der PLL zurck und bernimmt Nennfrequenz und Abtastrate.
+///					Dmpfung und Reglerparameter werden mit SOGI_PLL_K, SOGI_PLL_KP und SOGI_PLL_KI
+///					vorbelegt und knnen danach in der Struct gendert werden
+///
+/// @param  SogiPll *pll, float nominalFrequency (Hz), float sampleFrequency (Hz)
+///
+/// @return void
+///
+//=================================================================================================
+void SogiPllInit(SogiPll *pll, float nominalFrequency, float sampleFrequency)
+{
+		pll->k = SOGI_PLL_K;
+		pll->kp = SOGI_PLL_KP;
+		pll->ki = SOGI_PLL_KI;
+		pll->omegaNominal = nominalFrequency / sampleFrequency;
+		pll->sampleFrequency = sampleFrequency;
+		pll->v1 = 0.0f;
+		pll->v2 = 0.0f;
+		pll->alpha1 = 0.0f;
+		pll->alpha2 = 0.0f;
+		pll->beta1 = 0.0f;
+		pll->beta2 = 0.0f;
+		pll->alpha = 0.0f;
+		pll->beta = 0.0f;
+		pll->integral = 0.0f;
+		pll->omega = pll->omegaNominal;
+		pll->theta = 0.0f;
+		pll->sinTheta = 0.0f;
+		pll->cosTheta = 1.0f;
+		pll->amplitude = 0.0f;
+		pll->frequency = nominalFrequency;
+		pll->count = 0;
+		pll->cyclesLast = 0;
+		pll->cyclesMax = 0;
+}
+
+
+//=== Function: SogiPllRun ========================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt der PLL aus:
+///					1. Winkel um die geschtzte Frequenz weiterdrehen (Winkel des aktuellen Messwerts)
+///					2. SOGI mit den Koeffizienten der geschtzten Frequenz (Tustin):
+///						 x = 2*k*w*Ts, y = (w*Ts)^2, a0 = x + y + 4
+///						 alpha = x/a0 * (v - v2) + a1 * alpha1 + a2 * alpha2
+///						 beta  = k*y/a0 * (v + 2*v1 + v2) + a1 * beta1 + a2 * beta2
+///						 mit a1 = 2*(4 - y)/a0 und a2 = (x - y - 4)/a0
+///					3. Park-Transformation und Phasenfehler atan2(q, d) in Umdrehungen
+///					4. PI-Regler der Frequenz fr den nchsten Abtastschritt
+///
+/// @param  SogiPll *pll, float v (Messwert)
+///
+/// @return float theta (Winkel des Kosinus der Grundschwingung in Umdrehungen)
+///
+//=================================================================================================
+float SogiPllRun(SogiPll *pll, float v)
+{
+		float wTs = SOGI_PLL_2PI * pll->omega;
+		float x = 2.0f * pll->k * wTs;
+		float y = wTs * wTs;
+		float inverse = SOGI_PLL_DIV(1.0f, x + y + 4.0f);
+		float a1 = 2.0f * (4.0f - y) * inverse;
+		float a2 = (x - y - 4.0f) * inverse;
+		float d;
+		float q;
+		float error;
+		float limit;
+
+		pll->theta += pll->omega;
+		if (pll->theta >= 1.0f)
+				pll->theta -= 1.0f;
+		else if (pll->theta < 0.0f)
+				pll->theta += 1.0f;
+		pll->sinTheta = SOGI_PLL_SIN(pll->theta);
+		pll->cosTheta = SOGI_PLL_COS(pll->theta);
+
+		pll->alpha = x * inverse * (v - pll->v2) + a1 * pll->alpha1 + a2 * pll->alpha2;
+		pll->beta = pll->k * y * inverse * (v + 2.0f * pll->v1 + pll->v2)
+							+ a1 * pll->beta1 + a2 * pll->beta2;
+		pll->v2 = pll->v1;
+		pll->v1 = v;
+		pll->alpha2 = pll->alpha1;
+		pll->alpha1 = pll->alpha;
+		pll->beta2 = pll->beta1;
+		pll->beta1 = pll->beta;
+
+		d = pll->alpha * pll->cosTheta + pll->beta * pll->sinTheta;
+		q = pll->beta * pll->cosTheta - pll->alpha * pll->sinTheta;
+		error = SOGI_PLL_ATAN2(q, d);
+		if (error > 0.5f)
+				error -= 1.0f;
+
+		// Integrator auf den Fangbereich begrenzen, damit die PLL ohne Netzspannung
+		// nicht wegluft
+		limit = SOGI_PLL_INTEGRAL_LIMIT * pll->omegaNominal;
+		pll->integral += pll->ki * error;
+		if (pll->integral > limit)
+				pll->integral = limit;
+		else if (pll->integral < -limit)
+				pll->integral = -limit;
+		pll->omega = pll->omegaNominal + pll->kp * error + pll->integral;
+
+		pll->amplitude = SOGI_PLL_SQRT(pll->alpha * pll->alpha + pll->beta * pll->beta);
+		pll->frequency = pll->omega * pll->sampleFrequency;
+
+		return pll->theta;
+}
+
+
+//=== Function: SogiPllTrace ======================================================================
+///
+/// @brief  Funktion speichert die Laufzeit eines Abtastschritts seit "start" in "cyclesLast" und
+///					"cyclesMax". Die Laufzeit der Messung selbst (profileOverhead) wird abgezogen
+///
+/// @param  SogiPll *pll, uint32_t start (PROFILE_TIMESTAMP() vor SogiPllRun())
+///
+/// @return void
+///
+//=================================================================================================
+void SogiPllTrace(SogiPll *pll, uint32_t start)
+{
+		uint32_t cycles = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		pll->count++;
+		pll->cyclesLast = cycles;
+		if (cycles > pll->cyclesMax)
+				pll->cyclesMax = cycles;
+}
@@ -0,0 +1,107 @@
+//=================================================================================================
+/// @file       mySogiPll.h
+///
+/// @brief      Datei enthlt eine einphasige PLL mit SOGI (Second Order Generalized Integrator)
+///							zur Netzsynchronisation in float32. Der SOGI bildet aus dem Messwert "v" ein
+///							Paar orthogonaler Signale: "alpha" ist der gefilterte Messwert, "beta" eilt ihm
+///							um 90 nach. Die Park-Transformation dreht den Zeiger (alpha, beta) mit dem
+///							geschtzten Winkel, der Phasenfehler atan2(q, d) ist unabhngig von der
+///							Amplitude und wird mit einem PI-Regler auf 0 geregelt. Der SOGI wird mit der
+///							Tustin-Approximation diskretisiert, seine Koeffizienten folgen in jedem
+///							Abtastschritt der geschtzten Frequenz (frequenzadaptiv, keine Phasenverschiebung
+///							bei der Resonanzfrequenz). Sinus, Kosinus, atan2, Wurzel und Division rechnet die
+///							TMU (Trigonometric Math Unit, Compiler-Option --tmu_support).
+///							Die PLL luft synchron zum ADC in "AdcAInt1ISR()" (myADC.c) mit jedem Messwert
+///							von ADCIN0, ePWM8 triggert die Messung dafr mit SOGI_PLL_SAMPLE_FREQUENCY.
+///							Die Laufzeit eines Abtastschritts in Takten steht in "cyclesLast" und
+///							"cyclesMax" der PLL ("adcSogiPll").
+///							Winkel "theta" in Umdrehungen (0 ... 1), "theta" ist der Winkel des Kosinus
+///							der Grundschwingung (v = amplitude * cos(2 * pi * theta)).
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYSOGIPLL_H_
+#define MYSOGIPLL_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 1: AdcAInt1ISR() fhrt mit jedem Messwert von ADCIN0 die SOGI-PLL aus, ePWM8 triggert den ADC
+//		mit SOGI_PLL_SAMPLE_FREQUENCY
+// 0: ePWM8 triggert den ADC alle 100 ms, keine PLL
+#define SOGI_PLL_ENABLE											1
+// Abtastrate und Nennfrequenz in Hz
+#define SOGI_PLL_SAMPLE_FREQUENCY						10000.0f
+#define SOGI_PLL_NOMINAL_FREQUENCY					50.0f
+// Dmpfung des SOGI (sqrt(2): Bandbreite etwa 0,7 * Netzfrequenz)
+#define SOGI_PLL_K													1.41421356f
+// PI-Regler der PLL pro Abtastschritt (Phasenfehler und Frequenz in Umdrehungen),
+// Bandbreite 20 Hz und Dmpfung 0,7 bei 10 kHz: kp = 2 * 0,7 * wn * Ts, ki = (wn * Ts)^2
+#define SOGI_PLL_KP													0.0176f
+#define SOGI_PLL_KI													0.000158f
+// Grenze des Integrators in Vielfachen der Nennfrequenz (Fangbereich)
+#define SOGI_PLL_INTEGRAL_LIMIT							0.5f
+// Umrechnung ADC-Wert -> Messwert (12 Bit, Mitte des Messbereichs = 0, Aussteuerung 1,0)
+#define SOGI_PLL_ADC_OFFSET									2048.0f
+#define SOGI_PLL_ADC_SCALE									(1.0f / 2048.0f)
+#define SOGI_PLL_2PI												6.28318531f
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Zustnde und Ergebnisse der SOGI-PLL. Frequenzen der Regelung in Umdrehungen pro Abtastschritt
+typedef struct
+{
+		float k;											// Dmpfung des SOGI
+		float kp;
+		float ki;
+		float omegaNominal;						// Nennfrequenz / Abtastrate
+		float sampleFrequency;				// in Hz
+		float v1;											// Messwerte der letzten zwei Abtastschritte
+		float v2;
+		float alpha1;									// Ausgangswerte des SOGI der letzten zwei Abtastschritte
+		float alpha2;
+		float beta1;
+		float beta2;
+		float alpha;									// gefilterter Messwert
+		float beta;										// um 90 nacheilender Messwert
+		float integral;								// Zustand des PI-Reglers
+		float omega;									// geschtzte Frequenz
+		float theta;									// geschtzter Winkel des aktuellen Abtastschritts
+		float sinTheta;								// Sinus und Kosinus von "theta"
+		float cosTheta;
+		float amplitude;							// Amplitude der Grundschwingung
+		float frequency;							// geschtzte Frequenz in Hz
+		uint32_t count;								// Anzahl an Abtastschritten
+		uint32_t cyclesLast;					// Laufzeit des letzten Abtastschritts in Takten
+		uint32_t cyclesMax;						// maximale Laufzeit eines Abtastschritts in Takten
+} SogiPll;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt die Zustnde der PLL zurck und bernimmt Nennfrequenz und Abtastrate
+extern void SogiPllInit(SogiPll *pll, float nominalFrequency, float sampleFrequency);
+// Funktion fhrt einen Abtastschritt der PLL aus und gibt den Winkel zurck
+extern float SogiPllRun(SogiPll *pll, float v);
+// Funktion speichert die Laufzeit eines Abtastschritts seit "start" (PROFILE_TIMESTAMP())
+extern void SogiPllTrace(SogiPll *pll, uint32_t start);
+
+
+#endif
@@ -0,0 +1,77 @@
+//=================================================================================================
+/// @file			main.c
+///
+/// @brief		Enthlt das Hauptprogramm der Regressionsmessung "myBenchmark.c". Nach dem Start
+///						werden alle Messungen einmal ausgefhrt und der Bericht ber UART-A (115200 Baud)
+///						gesendet. Erklrungen zu den Messungen und zum Berichtsformat sind im Modul zu
+///						finden.
+///
+/// @version	V1.0
+///
+/// @date			14.10.2026
+///
+/// @author		Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myBenchmark.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messung wiederholen und Bericht erneut senden (z.B. im Debugger auf 1 setzen)
+volatile uint16_t benchmarkRunRequest = 0;
+
+
+//=== Function: main ==============================================================================
+///
+/// @brief  Hauptprogramm
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
+		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+
+#ifdef _FLASH
+		// Ausfhrungsgeschwindigkeit aus dem Flash fr das gewhlte Flash-Profil sowie ohne
+		// ECC, ohne Cache/Prefetch und mit einem zustzlichen Wartezustand messen
+		// (Ergebnisse in "deviceFlashBenchmark", z.B. im Debugger ansehen)
+		DeviceBenchmarkFlash();
+#endif
+
+		// Zeitbasen starten, alle Messungen ausfhren und den Bericht senden
+		BenchmarkInit();
+		BenchmarkRun();
+		BenchmarkReport();
+
+    // Register-Schreibschutz ausschalten
+    EALLOW;
+
+		// Dauerschleife Hauptprogramm
+    while(1)
+    {
+    		if (benchmarkRunRequest)
+    		{
+    				benchmarkRunRequest = 0;
+    				BenchmarkRun();
+    				BenchmarkReport();
+    		}
+    }
+}
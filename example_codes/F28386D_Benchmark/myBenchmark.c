@@ -0,0 +1,1023 @@
+//=================================================================================================
+/// @file       myBenchmark.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Regressionsmessung der Treiber und
+///							ISRs auf dem Zielsystem. Eine Beschreibung der Messungen und des Berichtsformats
+///							ist in der Header-Datei myBenchmark.h zu finden.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "myBenchmark.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Build-Profil im Bericht
+#if defined(DEVICE_BUILD_PERFORMANCE)
+#define BENCHMARK_BUILD											"FLASH_PERF"
+#elif defined(_FLASH)
+#define BENCHMARK_BUILD											"FLASH"
+#else
+#define BENCHMARK_BUILD											"RAM"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of local functions
+//-------------------------------------------------------------------------------------------------
+static void BenchmarkAdd(const char *name, uint32_t parameter, uint32_t cycles,
+												 uint32_t count, uint32_t limit, uint16_t status);
+static uint32_t BenchmarkElapsed(uint32_t start);
+static uint32_t BenchmarkIdealCycles(uint32_t bits, uint32_t rate);
+static void BenchmarkClaInit(void);
+static void BenchmarkInitTimes(void);
+static void BenchmarkIsr(void);
+static void BenchmarkUart(uint32_t baud);
+static void BenchmarkSpi(uint32_t clock);
+static void BenchmarkI2c(uint32_t clock, uint32_t clockHz);
+static bool BenchmarkClaForce(uint16_t loops, uint32_t *start, uint32_t *task, uint32_t *isr);
+static void BenchmarkCla(void);
+static void BenchmarkCopyLoop16(void);
+static void BenchmarkCopyLoop32(void);
+static void BenchmarkCopyMemcpy(void);
+static void BenchmarkCopyDma(void);
+#ifdef _FLASH
+static void BenchmarkCopyFlash(void);
+#endif
+static void BenchmarkCopyRun(const char *name, ProfileBenchmarkFunction function,
+														 const uint16_t *source, uint32_t limit);
+static void BenchmarkCopy(void);
+#if PROFILE_ENABLE
+static void BenchmarkDriverIsr(const char *name, uint16_t slot);
+#endif
+static void BenchmarkSend(const char *text, uint16_t length);
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse der letzten Messung
+BenchmarkResult benchmarkResults[BENCHMARK_NUMBER_OF_RESULTS];
+uint16_t benchmarkNumberOfResults = 0;
+uint16_t benchmarkFailures = 0;
+// Schnittstelle zum CLA-Task 1 (werden von der Initialisierung der Message-RAMs gelscht)
+#pragma DATA_SECTION(benchmarkClaInput, "CpuToCla1MsgRAM");
+BenchmarkClaInput benchmarkClaInput;
+#pragma DATA_SECTION(benchmarkClaOutput, "Cla1ToCpuMsgRAM");
+BenchmarkClaOutput benchmarkClaOutput;
+// Quelle und Ziel der Kopiermessungen (GS-RAM, damit auch der DMA zugreifen kann)
+#pragma DATA_SECTION(benchmarkCopySource, "ramgs2");
+uint16_t benchmarkCopySource[BENCHMARK_COPY_WORDS];
+#pragma DATA_SECTION(benchmarkCopyDestination, "ramgs3");
+uint16_t benchmarkCopyDestination[BENCHMARK_COPY_WORDS];
+#ifdef _FLASH
+// Quelle der Kopiermessung aus dem Flash (.const)
+const uint16_t benchmarkFlashData[BENCHMARK_COPY_WORDS] = {0};
+#endif
+// Gemessene Baudraten bzw. Takte
+static const uint32_t benchmarkUartRates[BENCHMARK_UART_NUMBER_OF_RATES] =
+{
+		UART_BAUD_115200, UART_BAUD_230400, UART_BAUD_460800
+};
+static const uint32_t benchmarkSpiRates[BENCHMARK_SPI_NUMBER_OF_RATES] =
+{
+		SPI_CLOCK_500_KHZ, SPI_CLOCK_1_MHZ, SPI_CLOCK_2_MHZ, BENCHMARK_SPI_CLOCK_10_MHZ
+};
+// I2C: Auswahl fr "I2cInitA()" und Nennwert in Hz
+static const uint32_t benchmarkI2cRates[BENCHMARK_I2C_NUMBER_OF_RATES] =
+{
+		I2C_CLOCK_100_KHZ, I2C_CLOCK_400_KHZ
+};
+static const uint32_t benchmarkI2cRatesHz[BENCHMARK_I2C_NUMBER_OF_RATES] =
+{
+		100000UL, 400000UL
+};
+// Texte der Zustnde im Bericht
+static const char *benchmarkStatusText[] = {"PASS", "FAIL", "ERROR"};
+// Zeitstempel der ISRs
+static volatile uint32_t benchmarkTimerCounter;
+static volatile uint32_t benchmarkTimerEntry;
+static volatile uint32_t benchmarkTimerExit;
+static volatile bool benchmarkTimerFlag;
+static volatile uint32_t benchmarkClaIsrEntry;
+static volatile bool benchmarkClaIsrFlag;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: BenchmarkAdd ======================================================================
+///
+/// @brief  Funktion speichert ein Ergebnis und vergleicht es mit der Grenze. Ein Ergebnis mit
+///					BENCHMARK_STATUS_PASS ber der Grenze wird zu BENCHMARK_STATUS_FAIL
+///
+/// @param  const char *name, uint32_t parameter, uint32_t cycles, uint32_t count,
+///					uint32_t limit, uint16_t status
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkAdd(const char *name, uint32_t parameter, uint32_t cycles,
+												 uint32_t count, uint32_t limit, uint16_t status)
+{
+		BenchmarkResult *result;
+
+		if (benchmarkNumberOfResults >= BENCHMARK_NUMBER_OF_RESULTS)
+		{
+				return;
+		}
+		if ((status == BENCHMARK_STATUS_PASS) && (cycles > limit))
+		{
+				status = BENCHMARK_STATUS_FAIL;
+		}
+		if (status != BENCHMARK_STATUS_PASS)
+		{
+				benchmarkFailures++;
+		}
+
+		result = &benchmarkResults[benchmarkNumberOfResults++];
+		result->name      = name;
+		result->parameter = parameter;
+		result->cycles    = cycles;
+		result->count     = count;
+		result->limit     = limit;
+		result->status    = status;
+}
+
+
+//=== Function: BenchmarkElapsed ==================================================================
+///
+/// @brief  Funktion gibt die Takte seit einem Zeitstempel ohne die Laufzeit der Messung zurck
+///
+/// @param  uint32_t start
+///
+/// @return uint32_t cycles
+///
+//=================================================================================================
+static uint32_t BenchmarkElapsed(uint32_t start)
+{
+		uint32_t cycles = PROFILE_TIMESTAMP() - start;
+		return (cycles > profileOverhead) ? (cycles - profileOverhead) : 0;
+}
+
+
+//=== Function: BenchmarkIdealCycles ==============================================================
+///
+/// @brief  Funktion gibt die Dauer einer Anzahl an Bits bei einer Bitrate in Takten zurck
+///
+/// @param  uint32_t bits, uint32_t rate
+///
+/// @return uint32_t cycles
+///
+//=================================================================================================
+static uint32_t BenchmarkIdealCycles(uint32_t bits, uint32_t rate)
+{
+		return (uint32_t)(((uint64_t)bits * BENCHMARK_SYSCLK_HZ) / rate);
+}
+
+
+//=== Function: BenchmarkClaInit ==================================================================
+///
+/// @brief  Funktion initialisiert das CLA-Modul mit dem Task 1 (Software-Trigger) und dessen
+///					End-of-Task-Interrupt (wie ClaInit() im Beispiel F28386D_CLA)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkClaInit(void)
+{
+		// CLA-Programmcode in den RAM kopieren (Konstanten des Linkers)
+    extern uint32_t Cla1funcsRunStart, Cla1funcsLoadStart, Cla1funcsLoadSize;
+#ifdef _FLASH
+		memcpy((uint32_t *)&Cla1funcsRunStart, (uint32_t *)&Cla1funcsLoadStart, (uint32_t)&Cla1funcsLoadSize);
+#endif
+
+		// Register-Schreibschutz aufheben
+    EALLOW;
+
+    // Message-RAMs CPU-zu-CLA und CLA-zu-CPU lschen
+    MemCfgRegs.MSGxINIT.bit.INIT_CPUTOCLA1 = 1;
+    while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_CPUTOCLA1 == 0);
+    MemCfgRegs.MSGxINIT.bit.INIT_CLA1TOCPU = 1;
+    while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_CLA1TOCPU == 0);
+    // LS0 und LS1 als CLA-Datenspeicher, LS5 und LS6 als CLA-Programmspeicher (Linker-File)
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS0 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS0 = 0;
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS1 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS1 = 0;
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS5 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS5 = 1;
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS6 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS6 = 1;
+
+    // CLA-Task 1 mit Software als Triggerquelle (0) freigeben
+    Cla1Regs.MVECT1 = (uint16_t)&BenchmarkClaTask1;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 = 0;
+    Cla1Regs.MIER.bit.INT1 = 1;
+    // End-of-Task-Interrupt (CLA1_1_INT, Zeile 11, Spalte 1 der PIE-Vector Table)
+    PieVectTable.CLA1_1_INT = &BenchmarkClaISR;
+    PieCtrlRegs.PIEIER11.bit.INTx1 = 1;
+    IER |= M_INT11;
+
+		// Register-Schreibschutz setzen
+    EDIS;
+}
+
+
+//=== Function: BenchmarkInitTimes ================================================================
+///
+/// @brief  Funktion misst die einmalige Laufzeit der Initialisierung jedes Treibers. Die
+///					Treiber bleiben danach mit den Einstellungen fr den Bericht initialisiert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkInitTimes(void)
+{
+		uint32_t start;
+
+		start = PROFILE_TIMESTAMP();
+		UartInitA(BENCHMARK_REPORT_BAUD, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE);
+		BenchmarkAdd("init_uart", 0, BenchmarkElapsed(start), 1, BENCHMARK_LIMIT_INIT_UART, BENCHMARK_STATUS_PASS);
+
+		start = PROFILE_TIMESTAMP();
+		SpiInitA(SPI_CLOCK_1_MHZ);
+		BenchmarkAdd("init_spi", 0, BenchmarkElapsed(start), 1, BENCHMARK_LIMIT_INIT_SPI, BENCHMARK_STATUS_PASS);
+
+		start = PROFILE_TIMESTAMP();
+		I2cInitA(I2C_CLOCK_400_KHZ);
+		BenchmarkAdd("init_i2c", 0, BenchmarkElapsed(start), 1, BENCHMARK_LIMIT_INIT_I2C, BENCHMARK_STATUS_PASS);
+
+		start = PROFILE_TIMESTAMP();
+		BenchmarkClaInit();
+		BenchmarkAdd("init_cla", 0, BenchmarkElapsed(start), 1, BENCHMARK_LIMIT_INIT_CLA, BENCHMARK_STATUS_PASS);
+}
+
+
+//=== Function: BenchmarkIsr ======================================================================
+///
+/// @brief  Funktion misst mit BENCHMARK_LOOPS Interrupts von CPU-Timer 0 die Latenz bis zur
+///					ersten Anweisung der ISR (Zhlerstand des Timers, +-1 Takt), die Laufzeit der ISR und
+///					die Zeit vom Ende der ISR bis zurck in der Warteschleife. Gespeichert wird jeweils
+///					das Maximum. Die brigen Treiber-Interrupts sind dabei nicht aktiv
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkIsr(void)
+{
+		uint32_t latencyMax = 0;
+		uint32_t durationMax = 0;
+		uint32_t returnMax = 0;
+		uint32_t timeout = BENCHMARK_TIMEOUT(BENCHMARK_TIMER_PERIOD);
+		uint32_t start;
+		uint32_t back;
+		uint32_t cycles;
+		uint16_t count = 0;
+
+		EALLOW;
+		// Timer anhalten, kein Vorteiler, Periode BENCHMARK_TIMER_PERIOD Takte
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TPR.all = 0;
+		CpuTimer0Regs.TPRH.all = 0;
+		CpuTimer0Regs.PRD.all = BENCHMARK_TIMER_PERIOD - 1;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		CpuTimer0Regs.TCR.bit.TIF = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 1;
+		// TIMER0_INT (Zeile 1, Spalte 7 der PIE-Vector Table)
+		PieVectTable.TIMER0_INT = &BenchmarkTimerISR;
+		PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+		IER |= M_INT1;
+		EDIS;
+
+		benchmarkTimerFlag = false;
+		CpuTimer0Regs.TCR.bit.TSS = 0;
+		start = PROFILE_TIMESTAMP();
+		while ((count < BENCHMARK_LOOPS) && ((PROFILE_TIMESTAMP() - start) < timeout))
+		{
+				if (benchmarkTimerFlag)
+				{
+						back = PROFILE_TIMESTAMP();
+						benchmarkTimerFlag = false;
+						// Takte seit dem Nulldurchgang (der Zhler wird dabei mit PRD geladen)
+						cycles = (BENCHMARK_TIMER_PERIOD - 1) - benchmarkTimerCounter;
+						if (cycles > latencyMax)
+						{
+								latencyMax = cycles;
+						}
+						cycles = benchmarkTimerExit - benchmarkTimerEntry - profileOverhead;
+						if (cycles > durationMax)
+						{
+								durationMax = cycles;
+						}
+						cycles = back - benchmarkTimerExit - profileOverhead;
+						if (cycles > returnMax)
+						{
+								returnMax = cycles;
+						}
+						count++;
+						start = PROFILE_TIMESTAMP();
+				}
+		}
+
+		EALLOW;
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 0;
+		PieCtrlRegs.PIEIER1.bit.INTx7 = 0;
+		EDIS;
+
+		if (count < BENCHMARK_LOOPS)
+		{
+				BenchmarkAdd("isr_latency", 0, 0, count, BENCHMARK_LIMIT_ISR_LATENCY, BENCHMARK_STATUS_ERROR);
+				return;
+		}
+		BenchmarkAdd("isr_latency", 0, latencyMax, count, BENCHMARK_LIMIT_ISR_LATENCY, BENCHMARK_STATUS_PASS);
+		BenchmarkAdd("isr_duration", 0, durationMax, count, BENCHMARK_LIMIT_ISR_DURATION, BENCHMARK_STATUS_PASS);
+		BenchmarkAdd("isr_return", 0, returnMax, count, BENCHMARK_LIMIT_ISR_RETURN, BENCHMARK_STATUS_PASS);
+}
+
+
+//=== Function: BenchmarkUart =====================================================================
+///
+/// @brief  Funktion misst die Dauer von "UartTransmitA()" bis zum letzten gesendeten Bit von
+///					BENCHMARK_UART_BYTES Bytes mit interner Schleife (SCICCR.LOOPBKENA) und prft die
+///					mit "UartReceiveA()" empfangenen Daten. Die Prfung beginnt erst nach einer
+///					Wartezeit, da "UartGetStatusRxA()" fr den Aufruf in festen Abstnden gedacht ist
+///
+/// @param  uint32_t baud
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkUart(uint32_t baud)
+{
+		uint32_t ideal = BenchmarkIdealCycles(BENCHMARK_UART_BYTES * BENCHMARK_UART_BITS_PER_BYTE, baud);
+		uint32_t timeout = BENCHMARK_TIMEOUT(ideal);
+		uint16_t status = BENCHMARK_STATUS_PASS;
+		uint32_t start;
+		uint32_t cycles;
+
+		UartInitA(baud, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE);
+		SciaRegs.SCICCR.bit.LOOPBKENA = 1;
+		for (uint16_t i = 0; i < BENCHMARK_UART_BYTES; i++)
+		{
+				BYTE_BUFFER_SET(uartBufferTxA, i, (i * 7U + 3U) & 0x00FF);
+		}
+		UartInitBufferRxA();
+
+		UartReceiveA(BENCHMARK_UART_BYTES, UART_NO_TIMEOUT);
+		start = PROFILE_TIMESTAMP();
+		if (!UartTransmitA(BENCHMARK_UART_BYTES))
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		while (   (status == BENCHMARK_STATUS_PASS)
+					 && !UartPollTxA()
+					 && ((PROFILE_TIMESTAMP() - start) < timeout));
+		cycles = BenchmarkElapsed(start);
+		if (!UartPollTxA())
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+
+		// Empfang pruefen: erster Aufruf bernimmt den Index der ISR, der zweite beendet den Empfang
+		DELAY_US(BENCHMARK_UART_SETTLE_US);
+		UartGetStatusRxA();
+		DELAY_US(BENCHMARK_UART_SETTLE_US);
+		if (UartGetStatusRxA() != UART_STATUS_FINISHED)
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		for (uint16_t i = 0; (i < BENCHMARK_UART_BYTES) && (status == BENCHMARK_STATUS_PASS); i++)
+		{
+				if (BYTE_BUFFER_GET(uartBufferRxA, i) != BYTE_BUFFER_GET(uartBufferTxA, i))
+				{
+						status = BENCHMARK_STATUS_ERROR;
+				}
+		}
+
+		UartSetStatusIdleRxA();
+		UartSetStatusIdleTxA();
+		SciaRegs.SCICCR.bit.LOOPBKENA = 0;
+		BenchmarkAdd("uart", baud, cycles, BENCHMARK_UART_BYTES,
+								 BENCHMARK_LIMIT(ideal, BENCHMARK_UART_PERCENT), status);
+}
+
+
+//=== Function: BenchmarkSpi ======================================================================
+///
+/// @brief  Funktion misst die Dauer von "SpiSendDataA()" bis zum Ende der Kommunikation von
+///					BENCHMARK_SPI_BYTES Bytes mit interner Schleife (SPICCR.SPILBK, ohne Slave-Select)
+///					und prft die empfangenen Daten
+///
+/// @param  uint32_t clock
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkSpi(uint32_t clock)
+{
+		uint32_t ideal = BenchmarkIdealCycles(BENCHMARK_SPI_BYTES * 8UL, clock);
+		uint32_t timeout = BENCHMARK_TIMEOUT(ideal);
+		uint16_t status = BENCHMARK_STATUS_PASS;
+		uint32_t start;
+		uint32_t cycles;
+
+		SpiInitA(clock);
+		// SPICCR nur im Reset-Zustand des Moduls ndern
+		SpiaRegs.SPICCR.bit.SPISWRESET = 0;
+		SpiaRegs.SPICCR.bit.SPILBK = 1;
+		SpiaRegs.SPICCR.bit.SPISWRESET = 1;
+		for (uint16_t i = 0; i < BENCHMARK_SPI_BYTES; i++)
+		{
+				BYTE_BUFFER_SET(spiBufferTxA, i, (i * 5U + 1U) & 0x00FF);
+		}
+		SpiInitBufferRxA();
+
+		start = PROFILE_TIMESTAMP();
+		if (!SpiSendDataA(SPI_SLAVE_NONE, BENCHMARK_SPI_BYTES))
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		while (   (status == BENCHMARK_STATUS_PASS)
+					 && (SpiGetStatusA() == SPI_STATUS_IN_PROGRESS)
+					 && ((PROFILE_TIMESTAMP() - start) < timeout));
+		cycles = BenchmarkElapsed(start);
+		if (SpiGetStatusA() != SPI_STATUS_FINISHED)
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		for (uint16_t i = 0; (i < BENCHMARK_SPI_BYTES) && (status == BENCHMARK_STATUS_PASS); i++)
+		{
+				if (BYTE_BUFFER_GET(spiBufferRxA, i) != BYTE_BUFFER_GET(spiBufferTxA, i))
+				{
+						status = BENCHMARK_STATUS_ERROR;
+				}
+		}
+
+		SpiSetStatusIdleA();
+		SpiaRegs.SPICCR.bit.SPISWRESET = 0;
+		SpiaRegs.SPICCR.bit.SPILBK = 0;
+		SpiaRegs.SPICCR.bit.SPISWRESET = 1;
+		BenchmarkAdd("spi", clock, cycles, BENCHMARK_SPI_BYTES,
+								 BENCHMARK_LIMIT(ideal, BENCHMARK_SPI_PERCENT), status);
+}
+
+
+//=== Function: BenchmarkI2c ======================================================================
+///
+/// @brief  Funktion misst die Dauer von "I2cReadA()" bis zur STOP-Bedingung beim Lesen von
+///					BENCHMARK_I2C_BYTES Bytes vom Slave BENCHMARK_I2C_SLAVE. Die Zeitberwachung
+///					bernimmt "I2cTickA()", ein NACK oder Timeout ergibt BENCHMARK_STATUS_ERROR
+///
+/// @param  uint32_t clock (I2C_CLOCK_x), uint32_t clockHz
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkI2c(uint32_t clock, uint32_t clockHz)
+{
+		uint32_t ideal = BenchmarkIdealCycles(BENCHMARK_I2C_BITS, clockHz);
+		uint16_t status = BENCHMARK_STATUS_PASS;
+		uint32_t start;
+		uint32_t cycles;
+
+		I2cInitA(clock);
+
+		start = PROFILE_TIMESTAMP();
+		if (!I2cReadA(BENCHMARK_I2C_SLAVE, BENCHMARK_I2C_BYTES))
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		while (   (status == BENCHMARK_STATUS_PASS)
+					 && (   (I2cGetStatusA() == I2C_STATUS_IN_PROGRESS)
+							 || (I2cGetStatusA() == I2C_STATUS_QUEUED)))
+		{
+				I2cTickA();
+		}
+		cycles = BenchmarkElapsed(start);
+		if (I2cGetStatusA() != I2C_STATUS_FINISHED)
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+
+		I2cSetStatusIdleA();
+		BenchmarkAdd("i2c", clockHz, cycles, BENCHMARK_I2C_BYTES,
+								 BENCHMARK_LIMIT(ideal, BENCHMARK_I2C_PERCENT), status);
+}
+
+
+//=== Function: BenchmarkClaForce =================================================================
+///
+/// @brief  Funktion startet den CLA-Task 1 per Software und wartet auf das Ende des Tasks und
+///					dessen ISR. Alle Zeiten in Takten von eCAP1 ab dem Zeitstempel vor dem Start
+///
+/// @param  uint16_t loops, uint32_t *start, uint32_t *task, uint32_t *isr
+///
+/// @return bool finished
+///
+//=================================================================================================
+static bool BenchmarkClaForce(uint16_t loops, uint32_t *start, uint32_t *task, uint32_t *isr)
+{
+		uint32_t timeout = BENCHMARK_TIMEOUT(BENCHMARK_LIMIT_CLA_ISR);
+		uint16_t count = benchmarkClaOutput.count;
+		uint32_t force;
+
+		benchmarkClaInput.loops = loops;
+		benchmarkClaIsrFlag = false;
+
+		force = BENCHMARK_CLA_TIMESTAMP();
+		Cla1Regs.MIFRC.bit.INT1 = 1;
+		while (   ((benchmarkClaOutput.count == count) || !benchmarkClaIsrFlag)
+					 && ((BENCHMARK_CLA_TIMESTAMP() - force) < timeout));
+
+		if ((benchmarkClaOutput.count == count) || !benchmarkClaIsrFlag)
+		{
+				return false;
+		}
+		*start = benchmarkClaOutput.start - force;
+		*task  = benchmarkClaOutput.end - benchmarkClaOutput.start;
+		*isr   = benchmarkClaIsrEntry - force;
+		return true;
+}
+
+
+//=== Function: BenchmarkCla ======================================================================
+///
+/// @brief  Funktion misst mit dem leeren CLA-Task die Startlatenz und die Zeit bis zur End-of-
+///					Task-ISR, mit BENCHMARK_CLA_TASK_LOOPS Durchlufen die Laufzeit der Rechenlast
+///					(jeweils Maximum aus BENCHMARK_LOOPS Messungen)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCla(void)
+{
+		uint32_t startMax = 0;
+		uint32_t taskMax = 0;
+		uint32_t isrMax = 0;
+		uint32_t start;
+		uint32_t task;
+		uint32_t isr;
+		uint16_t status = BENCHMARK_STATUS_PASS;
+
+		for (uint16_t i = 0; (i < BENCHMARK_LOOPS) && (status == BENCHMARK_STATUS_PASS); i++)
+		{
+				if (!BenchmarkClaForce(0, &start, &task, &isr))
+				{
+						status = BENCHMARK_STATUS_ERROR;
+				}
+				startMax = (start > startMax) ? start : startMax;
+				isrMax = (isr > isrMax) ? isr : isrMax;
+		}
+		BenchmarkAdd("cla_start", 0, startMax, BENCHMARK_LOOPS, BENCHMARK_LIMIT_CLA_START, status);
+		BenchmarkAdd("cla_isr", 0, isrMax, BENCHMARK_LOOPS, BENCHMARK_LIMIT_CLA_ISR, status);
+
+		for (uint16_t i = 0; (i < BENCHMARK_LOOPS) && (status == BENCHMARK_STATUS_PASS); i++)
+		{
+				if (!BenchmarkClaForce(BENCHMARK_CLA_TASK_LOOPS, &start, &task, &isr))
+				{
+						status = BENCHMARK_STATUS_ERROR;
+				}
+				taskMax = (task > taskMax) ? task : taskMax;
+		}
+		BenchmarkAdd("cla_task", BENCHMARK_CLA_TASK_LOOPS, taskMax, BENCHMARK_LOOPS,
+								 BENCHMARK_LIMIT_CLA_TASK, status);
+}
+
+
+//=== Function: BenchmarkCopyLoop16 ===============================================================
+///
+/// @brief  Funktion kopiert BENCHMARK_COPY_WORDS Wrter mit einer 16-Bit-Schleife
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyLoop16(void)
+{
+		for (uint16_t i = 0; i < BENCHMARK_COPY_WORDS; i++)
+		{
+				benchmarkCopyDestination[i] = benchmarkCopySource[i];
+		}
+}
+
+
+//=== Function: BenchmarkCopyLoop32 ===============================================================
+///
+/// @brief  Funktion kopiert BENCHMARK_COPY_WORDS Wrter mit einer 32-Bit-Schleife (beide Puffer
+///					beginnen am Anfang eines GS-RAM-Blocks und sind damit 32-Bit-ausgerichtet)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyLoop32(void)
+{
+		const uint32_t *source = (const uint32_t *)benchmarkCopySource;
+		uint32_t *destination = (uint32_t *)benchmarkCopyDestination;
+
+		for (uint16_t i = 0; i < BENCHMARK_COPY_WORDS / 2; i++)
+		{
+				destination[i] = source[i];
+		}
+}
+
+
+//=== Function: BenchmarkCopyMemcpy ===============================================================
+///
+/// @brief  Funktion kopiert BENCHMARK_COPY_WORDS Wrter mit memcpy() der Laufzeitbibliothek
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyMemcpy(void)
+{
+		memcpy(benchmarkCopyDestination, benchmarkCopySource, BENCHMARK_COPY_WORDS);
+}
+
+
+//=== Function: BenchmarkCopyDma ==================================================================
+///
+/// @brief  Funktion startet die in BenchmarkCopy() vorbereitete bertragung von DMA CH1 per
+///					Software und wartet auf deren Ende
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyDma(void)
+{
+		EALLOW;
+		DmaRegs.CH1.CONTROL.bit.RUN = 1;
+		DmaRegs.CH1.CONTROL.bit.PERINTFRC = 1;
+		while (DmaRegs.CH1.CONTROL.bit.RUNSTS);
+		EDIS;
+}
+
+
+#ifdef _FLASH
+//=== Function: BenchmarkCopyFlash ================================================================
+///
+/// @brief  Funktion kopiert BENCHMARK_COPY_WORDS Wrter mit memcpy() aus dem Flash
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyFlash(void)
+{
+		memcpy(benchmarkCopyDestination, benchmarkFlashData, BENCHMARK_COPY_WORDS);
+}
+#endif
+
+
+//=== Function: BenchmarkCopyRun ==================================================================
+///
+/// @brief  Funktion misst eine Kopierfunktion mit ProfileBenchmark() (Minimum aus
+///					BENCHMARK_LOOPS Durchlufen) und prft danach das Ziel
+///
+/// @param  const char *name, ProfileBenchmarkFunction function, const uint16_t *source,
+///					uint32_t limit
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopyRun(const char *name, ProfileBenchmarkFunction function,
+														 const uint16_t *source, uint32_t limit)
+{
+		uint16_t status = BENCHMARK_STATUS_PASS;
+		uint32_t cycles;
+
+		memset(benchmarkCopyDestination, 0xFFFF, BENCHMARK_COPY_WORDS);
+		cycles = ProfileBenchmark(function, BENCHMARK_LOOPS);
+		if (memcmp(benchmarkCopyDestination, source, BENCHMARK_COPY_WORDS) != 0)
+		{
+				status = BENCHMARK_STATUS_ERROR;
+		}
+		BenchmarkAdd(name, 0, cycles, BENCHMARK_COPY_WORDS, limit, status);
+}
+
+
+//=== Function: BenchmarkCopy =====================================================================
+///
+/// @brief  Funktion misst die Kopierbandbreite von CPU und DMA. DMA CH1 kopiert mit einem
+///					Software-Trigger die ganze bertragung (ONESHOT) in Bursts von
+///					BENCHMARK_DMA_BURST_WORDS Wrtern
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkCopy(void)
+{
+		for (uint16_t i = 0; i < BENCHMARK_COPY_WORDS; i++)
+		{
+				benchmarkCopySource[i] = i ^ 0xA5C3;
+		}
+
+		BenchmarkCopyRun("copy_loop16", &BenchmarkCopyLoop16, benchmarkCopySource, BENCHMARK_LIMIT_COPY_LOOP16);
+		BenchmarkCopyRun("copy_loop32", &BenchmarkCopyLoop32, benchmarkCopySource, BENCHMARK_LIMIT_COPY_LOOP32);
+		BenchmarkCopyRun("copy_memcpy", &BenchmarkCopyMemcpy, benchmarkCopySource, BENCHMARK_LIMIT_COPY_MEMCPY);
+
+		EALLOW;
+		// DMA CH1: nur Software-Trigger (Quelle 0), 16 Bit, kein Interrupt
+		DmaRegs.CH1.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = 0;
+		DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = (uint32_t)benchmarkCopySource;
+		DmaRegs.CH1.SRC_ADDR_SHADOW     = (uint32_t)benchmarkCopySource;
+		DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (uint32_t)benchmarkCopyDestination;
+		DmaRegs.CH1.DST_ADDR_SHADOW     = (uint32_t)benchmarkCopyDestination;
+		DmaRegs.CH1.BURST_SIZE.bit.BURSTSIZE = BENCHMARK_DMA_BURST_WORDS - 1;
+		DmaRegs.CH1.SRC_BURST_STEP = 1;
+		DmaRegs.CH1.DST_BURST_STEP = 1;
+		DmaRegs.CH1.TRANSFER_SIZE = (BENCHMARK_COPY_WORDS / BENCHMARK_DMA_BURST_WORDS) - 1;
+		DmaRegs.CH1.SRC_TRANSFER_STEP = 1;
+		DmaRegs.CH1.DST_TRANSFER_STEP = 1;
+		DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.MODE.bit.DATASIZE   = 0;
+		DmaRegs.CH1.MODE.bit.ONESHOT    = 1;
+		DmaRegs.CH1.MODE.bit.CONTINUOUS = 0;
+		DmaRegs.CH1.MODE.bit.PERINTE    = 1;
+		DmaRegs.CH1.MODE.bit.CHINTE     = 0;
+		DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH1.CONTROL.bit.ERRCLR    = 1;
+		EDIS;
+		BenchmarkCopyRun("copy_dma", &BenchmarkCopyDma, benchmarkCopySource, BENCHMARK_LIMIT_COPY_DMA);
+
+#ifdef _FLASH
+		BenchmarkCopyRun("copy_flash", &BenchmarkCopyFlash, benchmarkFlashData, BENCHMARK_LIMIT_COPY_FLASH);
+#endif
+}
+
+
+#if PROFILE_ENABLE
+//=== Function: BenchmarkDriverIsr ================================================================
+///
+/// @brief  Funktion speichert die maximale Laufzeit der ISR eines Treibers whrend der
+///					Messungen (Slot von myProfile.h)
+///
+/// @param  const char *name, uint16_t slot
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkDriverIsr(const char *name, uint16_t slot)
+{
+		ProfileSlot *p = &profileSlots[slot];
+
+		BenchmarkAdd(name, 0, p->cyclesMax, p->count, BENCHMARK_LIMIT_DRIVER_ISR,
+								 (p->count > 0) ? BENCHMARK_STATUS_PASS : BENCHMARK_STATUS_ERROR);
+}
+#endif
+
+
+//=== Function: BenchmarkSend =====================================================================
+///
+/// @brief  Funktion schreibt einen Text in den Sende-Ringpuffer und wartet, solange dieser voll ist
+///
+/// @param  const char *text, uint16_t length
+///
+/// @return void
+///
+//=================================================================================================
+static void BenchmarkSend(const char *text, uint16_t length)
+{
+		uint16_t written = 0;
+
+		// "char" ist auf dem C28x 16 Bit breit, ein Zeichen pro Wort wie in "UartWriteA()"
+		while (written < length)
+		{
+				written += UartWriteA((const uint16_t *)text + written, length - written);
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: BenchmarkInit =====================================================================
+///
+/// @brief  Funktion startet CPU-Timer 2 (ProfileInit()) und eCAP1 als freilaufende Zeitbasen
+///					und schaltet die Takte von CPU-Timer 0 und DMA ein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void BenchmarkInit(void)
+{
+		ProfileInit();
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// eCAP1 im Capture-Betrieb, der Zhler luft frei mit SYSCLK durch
+		// (auch wenn der Debugger die CPU anhlt)
+		CpuSysRegs.PCLKCR3.bit.ECAP1 = 1;
+		__asm(" RPT #4 || NOP");
+		ECap1Regs.ECCTL2.bit.CAP_APWM  = 0;
+		ECap1Regs.ECCTL1.bit.FREE_SOFT = 3;
+		ECap1Regs.TSCTR                = 0;
+		ECap1Regs.ECCTL2.bit.TSCTRSTOP = 1;
+
+		// Takte fr CPU-Timer 0 und DMA, DMA luft weiter, wenn der Debugger die CPU anhlt
+		CpuSysRegs.PCLKCR0.bit.CPUTIMER0 = 1;
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: BenchmarkRun ======================================================================
+///
+/// @brief  Funktion fhrt alle Messungen nacheinander aus (siehe myBenchmark.h). Die Treiber
+///					werden dabei mehrfach initialisiert, danach ist UART-A fr den Bericht eingestellt
+///
+/// @param  void
+///
+/// @return uint16_t benchmarkFailures
+///
+//=================================================================================================
+uint16_t BenchmarkRun(void)
+{
+		benchmarkNumberOfResults = 0;
+		benchmarkFailures = 0;
+		ProfileReset(PROFILE_SLOT_UART_RX);
+		ProfileReset(PROFILE_SLOT_UART_TX);
+		ProfileReset(PROFILE_SLOT_SPI);
+		ProfileReset(PROFILE_SLOT_I2C);
+
+		BenchmarkInitTimes();
+		BenchmarkIsr();
+		for (uint16_t i = 0; i < BENCHMARK_UART_NUMBER_OF_RATES; i++)
+		{
+				BenchmarkUart(benchmarkUartRates[i]);
+		}
+		for (uint16_t i = 0; i < BENCHMARK_SPI_NUMBER_OF_RATES; i++)
+		{
+				BenchmarkSpi(benchmarkSpiRates[i]);
+		}
+		for (uint16_t i = 0; i < BENCHMARK_I2C_NUMBER_OF_RATES; i++)
+		{
+				BenchmarkI2c(benchmarkI2cRates[i], benchmarkI2cRatesHz[i]);
+		}
+		BenchmarkCla();
+		BenchmarkCopy();
+#if PROFILE_ENABLE
+		BenchmarkDriverIsr("isr_uart_rx", PROFILE_SLOT_UART_RX);
+		BenchmarkDriverIsr("isr_uart_tx", PROFILE_SLOT_UART_TX);
+		BenchmarkDriverIsr("isr_spi", PROFILE_SLOT_SPI);
+		BenchmarkDriverIsr("isr_i2c", PROFILE_SLOT_I2C);
+#endif
+
+		// UART-A fr den Bericht
+		UartInitA(BENCHMARK_REPORT_BAUD, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE);
+		return benchmarkFailures;
+}
+
+
+//=== Function: BenchmarkFormatResult =============================================================
+///
+/// @brief  Funktion schreibt ein Ergebnis als Zeile "BENCH;..." inkl. Zeilenende in einen Puffer
+///					und gibt die Lnge zurck (0: Index ungltig oder Puffer zu klein)
+///
+/// @param  uint16_t index, char *buffer, uint16_t size
+///
+/// @return uint16_t length
+///
+//=================================================================================================
+uint16_t BenchmarkFormatResult(uint16_t index, char *buffer, uint16_t size)
+{
+		BenchmarkResult *r;
+		int length;
+
+		if (index >= benchmarkNumberOfResults)
+		{
+				return 0;
+		}
+
+		r = &benchmarkResults[index];
+		length = snprintf(buffer, size, "BENCH;%s;%lu;%lu;%lu;%lu;%s\r\n",
+											r->name, r->parameter, r->cycles, r->count, r->limit,
+											benchmarkStatusText[r->status]);
+		if (length > 0 && length < size)
+		{
+				return length;
+		}
+		return 0;
+}
+
+
+//=== Function: BenchmarkReport ===================================================================
+///
+/// @brief  Funktion sendet den Bericht der letzten Messung ber UART-A im Streaming-Betrieb und
+///					wartet, bis das letzte Byte gesendet ist
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void BenchmarkReport(void)
+{
+		char line[BENCHMARK_LINE_LENGTH];
+		int length;
+
+		if (!UartStartStreamA())
+		{
+				return;
+		}
+
+		length = snprintf(line, sizeof(line), "BENCH_BEGIN;%u;%s;%u\r\n",
+											BENCHMARK_VERSION, BENCHMARK_BUILD, deviceSysclkMhz);
+		if (length > 0 && length < sizeof(line))
+		{
+				BenchmarkSend(line, length);
+		}
+		for (uint16_t i = 0; i < benchmarkNumberOfResults; i++)
+		{
+				BenchmarkSend(line, BenchmarkFormatResult(i, line, sizeof(line)));
+		}
+		length = snprintf(line, sizeof(line), "BENCH_END;%u;%u\r\n",
+											benchmarkNumberOfResults, benchmarkFailures);
+		if (length > 0 && length < sizeof(line))
+		{
+				BenchmarkSend(line, length);
+		}
+
+		// Warten, bis der Ringpuffer und das Schieberegister leer sind
+		while (uartRingTxA.tail != uartRingTxA.head);
+		while (!SciaRegs.SCICTL2.bit.TXEMPTY);
+		UartStopStreamA();
+}
+
+
+//=== Function: BenchmarkTimerISR =================================================================
+///
+/// @brief  ISR von CPU-Timer 0. Speichert den Zhlerstand des Timers und die Zeitstempel am
+///					Anfang und Ende der ISR
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void BenchmarkTimerISR(void)
+{
+		benchmarkTimerCounter = CpuTimer0Regs.TIM.all;
+		benchmarkTimerEntry = PROFILE_TIMESTAMP();
+		benchmarkTimerFlag = true;
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der TIMER0-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		benchmarkTimerExit = PROFILE_TIMESTAMP();
+}
+
+
+//=== Function: BenchmarkClaISR ===================================================================
+///
+/// @brief  ISR des CLA-Tasks 1 (End of Task). Speichert den Zeitstempel von eCAP1
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void BenchmarkClaISR(void)
+{
+		benchmarkClaIsrEntry = BENCHMARK_CLA_TIMESTAMP();
+		benchmarkClaIsrFlag = true;
+		// Interrupt-Flag der Gruppe 11 lschen (da gehren die CLA-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK11 = 1;
+}
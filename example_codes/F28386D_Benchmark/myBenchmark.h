@@ -0,0 +1,174 @@
+//=================================================================================================
+/// @file       myBenchmark.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Regressionsmessung der Treiber und
+///							ISRs auf dem Zielsystem. Das Projekt bindet die Treiber der Beispielprojekte UART,
+///							SPI und I2C unverndert ein (verlinkte Dateien), sodass jede nderung an einem
+///							Treiber hier mitgemessen wird. Alle Zeiten werden in Takten (SYSCLK, 5 ns)
+///							gemessen, auf der CPU mit CPU-Timer 2 (myProfile.h), auf dem CLA mit eCAP1.
+///							BenchmarkRun() misst nacheinander:
+///							- "init_*": einmalige Laufzeit der Initialisierung jedes Treibers
+///							- "isr_latency", "isr_duration", "isr_return": Latenz vom Ereignis (CPU-Timer 0)
+///							  bis zum ersten Befehl der ISR, Laufzeit von Eintritt bis Austritt und vom
+///							  Austritt bis zurck im unterbrochenen Code (jeweils Maximum)
+///							- "uart", "spi": Dauer von BENCHMARK_UART_BYTES bzw. BENCHMARK_SPI_BYTES Bytes
+///							  mit interner Schleife (kein externer Anschluss) bei mehreren Baudraten bzw.
+///							  Takten, die empfangenen Daten werden geprft
+///							- "i2c": Lesen von BENCHMARK_I2C_BYTES Bytes vom Slave BENCHMARK_I2C_SLAVE bei
+///							  100 und 400 kHz (ERROR ohne Slave)
+///							- "cla_start", "cla_task", "cla_isr": Start bis erster Befehl des CLA-Tasks,
+///							  Laufzeit der Rechenlast und Start bis zur End-of-Task-ISR der CPU
+///							- "copy_*": Kopieren von BENCHMARK_COPY_WORDS Wrtern im GS-RAM mit 16- und
+///							  32-Bit-Schleife, memcpy() und DMA sowie aus dem Flash (nur _FLASH)
+///							- "isr_uart_rx" ... "isr_i2c": maximale Laufzeit der Treiber-ISRs whrend der
+///							  Messungen (profileSlots, nur mit PROFILE_ENABLE)
+///							Wiederholbare Messungen ohne Interrupts geben das Minimum von BENCHMARK_LOOPS
+///							Durchlufen zurck. Jedes Ergebnis wird mit einer Grenze verglichen. Die Grenzen
+///							der Schnittstellen folgen aus der Bitzeit (Ideal plus Reserve), die festen Grenzen
+///							sind Schtzwerte mit Reserve und sollten nach einer Referenzmessung mit der
+///							freigegebenen Firmware enger gesetzt werden.
+///
+///							Bericht (BenchmarkReport(), UART-A mit BENCHMARK_REPORT_BAUD, eine Zeile pro
+///							Ergebnis, Felder mit ';' getrennt, Zeilenende "\r\n"):
+///							  BENCH_BEGIN;<Version>;<Build RAM|FLASH|FLASH_PERF>;<SYSCLK in MHz>
+///							  BENCH;<Name>;<Parameter>;<Takte>;<Anzahl>;<Grenze>;<PASS|FAIL|ERROR>
+///							  BENCH_END;<Anzahl Ergebnisse>;<Anzahl FAIL und ERROR>
+///							Parameter: Baudrate bzw. Takt in Hz, Schleifendurchlufe oder 0. Anzahl: ber-
+///							tragene Bytes bzw. Wrter (Datenrate = Anzahl * SYSCLK / Takte) oder Anzahl der
+///							Messungen. Die Zeilen vor "BENCH_BEGIN" sind zu ignorieren (interne Schleife).
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYBENCHMARK_H_
+#define MYBENCHMARK_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myUART.h"
+#include "mySPI.h"
+#include "myI2C.h"
+#include "myBenchmarkCla.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Version des Berichtsformats
+#define BENCHMARK_VERSION										1
+// Maximale Anzahl an Ergebnissen
+#define BENCHMARK_NUMBER_OF_RESULTS					40
+// Durchlufe der wiederholbaren Messungen (Minimum) bzw. der ISR-Messungen (Maximum)
+#define BENCHMARK_LOOPS											16
+// Ergebnis einer Messung
+#define BENCHMARK_STATUS_PASS								0
+#define BENCHMARK_STATUS_FAIL								1					// Grenze berschritten
+#define BENCHMARK_STATUS_ERROR							2					// Messung nicht mglich (Daten, Timeout)
+// Reserve der Schnittstellen in Prozent der idealen Dauer plus fester Anteil (Start, Ende)
+#define BENCHMARK_UART_PERCENT							110UL
+#define BENCHMARK_SPI_PERCENT								150UL
+#define BENCHMARK_I2C_PERCENT								120UL
+#define BENCHMARK_LIMIT_OFFSET							4000UL		// 20 us
+// UART: Bytes pro Messung (Software-Puffer), Bits pro Byte (Start, 8 Daten, Stopp)
+#define BENCHMARK_UART_BYTES								UART_SIZE_SOFTWARE_BUFFER_TX
+#define BENCHMARK_UART_BITS_PER_BYTE				10UL
+#define BENCHMARK_UART_NUMBER_OF_RATES			3
+// Wartezeit bis zur Prfung der empfangenen Daten (mind. ein Zeichen bei der kleinsten Baudrate)
+#define BENCHMARK_UART_SETTLE_US						200
+// Baudrate des Berichts
+#define BENCHMARK_REPORT_BAUD								UART_BAUD_115200
+// SPI: Bytes pro Messung (Software-Puffer), zustzlicher Takt ber den Treiber-Defines
+#define BENCHMARK_SPI_BYTES									SPI_SIZE_SOFTWARE_BUFFER
+#define BENCHMARK_SPI_CLOCK_10_MHZ					10000000
+#define BENCHMARK_SPI_NUMBER_OF_RATES				4
+// I2C: Slave (Sensor des Beispiels F28386D_I2C, wird nur gelesen), Bytes pro Messung
+// (Hardware-FIFO) und Bits der bertragung (Adresse und Daten mit ACK, START und STOP)
+#define BENCHMARK_I2C_SLAVE									0x48
+#define BENCHMARK_I2C_BYTES									I2C_SIZE_HARDWARE_FIFO
+#define BENCHMARK_I2C_BITS									((BENCHMARK_I2C_BYTES + 1UL) * 9UL + 2UL)
+#define BENCHMARK_I2C_NUMBER_OF_RATES				2
+// Periode von CPU-Timer 0 fr die ISR-Messung in Takten (100 us)
+#define BENCHMARK_TIMER_PERIOD							20000UL
+// Wrter der Kopiermessungen (Quelle "ramgs2", Ziel "ramgs3")
+#define BENCHMARK_COPY_WORDS								1024
+#define BENCHMARK_DMA_BURST_WORDS						32
+// Feste Grenzen in Takten
+#define BENCHMARK_LIMIT_INIT_UART						2000UL
+#define BENCHMARK_LIMIT_INIT_SPI						4000UL
+#define BENCHMARK_LIMIT_INIT_I2C						4000UL
+#define BENCHMARK_LIMIT_INIT_CLA						4000UL
+#define BENCHMARK_LIMIT_ISR_LATENCY					100UL
+#define BENCHMARK_LIMIT_ISR_DURATION				200UL
+#define BENCHMARK_LIMIT_ISR_RETURN					200UL
+#define BENCHMARK_LIMIT_CLA_START						200UL
+#define BENCHMARK_LIMIT_CLA_TASK						(20UL * BENCHMARK_CLA_TASK_LOOPS + 100UL)
+#define BENCHMARK_LIMIT_CLA_ISR							300UL
+#define BENCHMARK_LIMIT_COPY_LOOP16					(16UL * BENCHMARK_COPY_WORDS)
+#define BENCHMARK_LIMIT_COPY_LOOP32					(8UL * BENCHMARK_COPY_WORDS)
+#define BENCHMARK_LIMIT_COPY_MEMCPY					(4UL * BENCHMARK_COPY_WORDS)
+#define BENCHMARK_LIMIT_COPY_DMA						(8UL * BENCHMARK_COPY_WORDS)
+#define BENCHMARK_LIMIT_COPY_FLASH					(8UL * BENCHMARK_COPY_WORDS)
+#define BENCHMARK_LIMIT_DRIVER_ISR					2000UL
+// Textlnge einer Zeile des Berichts
+#define BENCHMARK_LINE_LENGTH								96
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Takt in Hz (DeviceInit() kann einen kleineren Takt einstellen)
+#define BENCHMARK_SYSCLK_HZ									((uint32_t)deviceSysclkMhz * 1000000UL)
+// Grenze einer Schnittstelle aus der idealen Dauer in Takten
+#define BENCHMARK_LIMIT(ideal, percent)			((ideal) / 100UL * (percent) + BENCHMARK_LIMIT_OFFSET)
+// Abbruch einer Messung nach der vierfachen idealen Dauer plus 1 ms
+#define BENCHMARK_TIMEOUT(ideal)						(4UL * (ideal) + BENCHMARK_SYSCLK_HZ / 1000UL)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ergebnis einer Messung (alle Zeiten in Takten)
+typedef struct
+{
+		const char *name;											// Name der Messung (ohne ';')
+		uint32_t parameter;										// Baudrate, Takt in Hz, Durchlufe oder 0
+		uint32_t cycles;											// gemessene Takte
+		uint32_t count;												// bertragene Bytes/Wrter oder Messungen
+		uint32_t limit;												// Grenze in Takten
+		uint16_t status;											// BENCHMARK_STATUS_x
+} BenchmarkResult;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse der letzten Messung (z.B. im Debugger ansehen)
+extern BenchmarkResult benchmarkResults[BENCHMARK_NUMBER_OF_RESULTS];
+extern uint16_t benchmarkNumberOfResults;
+// Anzahl der Ergebnisse mit FAIL oder ERROR (0: keine Regression)
+extern uint16_t benchmarkFailures;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion startet die Zeitbasen (CPU-Timer 2, eCAP1) und die Takte der gemessenen Module
+extern void BenchmarkInit(void);
+// Funktion fhrt alle Messungen aus und gibt die Anzahl der Ergebnisse mit FAIL oder ERROR zurck
+extern uint16_t BenchmarkRun(void);
+// Funktion schreibt ein Ergebnis als Zeile des Berichts in einen Puffer
+extern uint16_t BenchmarkFormatResult(uint16_t index, char *buffer, uint16_t size);
+// Funktion sendet den Bericht ber UART-A (blockiert bis zum letzten Byte)
+extern void BenchmarkReport(void);
+// ISR von CPU-Timer 0 (ISR-Latenz)
+extern __interrupt void BenchmarkTimerISR(void);
+// ISR des CLA-Tasks 1 (End of Task)
+extern __interrupt void BenchmarkClaISR(void);
+
+
+#endif
@@ -0,0 +1,73 @@
+//=================================================================================================
+/// @file       myBenchmarkCla.h
+///
+/// @brief      Datei enthlt die Schnittstelle zwischen CPU und CLA fr die Messung der CLA-Latenz
+///							(myBenchmark.c). Die CPU startet den CLA-Task 1 per Software, der Task speichert
+///							den Zeitstempel seines ersten und letzten Befehls im Struct "benchmarkClaOutput"
+///							(CLA-zu-CPU Message-RAM). Als Zeitbasis dient der freilaufende Zhler von eCAP1
+///							(SYSCLK, 5 ns pro Takt), da der CLA keinen Zugriff auf die CPU-Timer hat.
+///							Die Anzahl der Schleifendurchlufe der Rechenlast bergibt die CPU in
+///							"benchmarkClaInput" (CPU-zu-CLA Message-RAM, 0: leerer Task).
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYBENCHMARKCLA_H_
+#define MYBENCHMARKCLA_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Schleifendurchlufe der Rechenlast (eine Multiplikation und zwei Additionen pro Durchlauf)
+#define BENCHMARK_CLA_TASK_LOOPS						32
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel in Takten (Zhler von eCAP1, wird von BenchmarkInit() gestartet)
+#define BENCHMARK_CLA_TIMESTAMP()						(ECap1Regs.TSCTR)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// CPU an CLA (nur explizite Datentypen, "int" ist auf dem CLA 32 Bit breit)
+typedef struct
+{
+		uint16_t loops;												// Schleifendurchlufe der Rechenlast
+} BenchmarkClaInput;
+
+// CLA an CPU
+typedef struct
+{
+		uint32_t start;												// Zeitstempel des ersten Befehls des Tasks
+		uint32_t end;													// Zeitstempel nach der Rechenlast
+		float result;													// Ergebnis der Rechenlast
+		uint16_t count;												// Anzahl der beendeten Tasks
+} BenchmarkClaOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern BenchmarkClaInput benchmarkClaInput;
+extern BenchmarkClaOutput benchmarkClaOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Task 1. Speichert die Zeitstempel fr die Messung der Latenz und der Laufzeit
+__interrupt void BenchmarkClaTask1(void);
+
+
+#endif
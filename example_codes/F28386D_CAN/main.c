@@ -0,0 +1,149 @@
+//=================================================================================================
+/// @file			main.c
+///
+/// @brief		Enthlt das Hauptprogramm zur Demonstration des Moduls "myCAN.c". Die Funktionen
+///						dieses Moduls implementieren eine Interrupt-basierte CAN-FD Kommunikation ber das
+///						MCAN-Modul fr den Mikrocontroller TMS320F2838x. Erklrungen zur genauen Funktion
+///						sind im Modul zu finden. Das Beispiel arbeitet im internen Loopback, es wird also
+///						weder ein Transceiver noch eine zweite Platine bentigt.
+///
+/// @version	V1.0
+///
+/// @date			14.10.2026
+///
+/// @author		Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCAN.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// IDs der Beispiel-Nachrichten
+#define CAN_ID_DATA								0x120							// Messdaten (FIFO 0)
+#define CAN_ID_ALARM							0x010							// Abschaltung (FIFO 1)
+#define CAN_ID_PARAMETER					0x18DA0001UL			// 29-Bit Parameter (FIFO 0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Hardware-Filter: Messdaten 0x100 ... 0x1FF und Parameter in den FIFO 0, Abschaltung in den
+// FIFO 1 (jede Nachricht sofort in der ISR)
+const CanFilter canFilters[3] =
+{
+		// 29-Bit	Typ									Ziel									ID 1							ID 2 / Maske
+		{false,		CAN_FILTER_CLASSIC,	CAN_FILTER_TO_FIFO0,	0x100,						0x700},
+		{false,		CAN_FILTER_DUAL,		CAN_FILTER_TO_FIFO1,	CAN_ID_ALARM,			CAN_ID_ALARM},
+		{true,		CAN_FILTER_RANGE,		CAN_FILTER_TO_FIFO0,	CAN_ID_PARAMETER,	CAN_ID_PARAMETER + 0xFF}
+};
+// Zum Senden eines Blocks von Messdaten bzw. einer Abschaltung
+uint32_t startSendData = 0;
+uint32_t startSendAlarm = 0;
+// Gesendete und empfangene Nachricht
+CanMessage txMessage;
+CanMessage rxMessage;
+// Anzahl der empfangenen Nachrichten mit falschem Inhalt
+uint32_t rxErrors = 0;
+// Zhler im ersten Datenwort der Messdaten
+uint32_t txSequence = 0;
+uint32_t rxSequence = 0;
+// Anzahl der empfangenen Abschaltungen
+uint32_t rxAlarms = 0;
+
+
+//=== Function: main ==============================================================================
+///
+/// @brief  Hauptprogramm
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+		uint16_t i;
+
+		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
+		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+
+		// MCAN-Modul mit den Filtern im internen Loopback initialisieren
+		CanInitA(canFilters, 3, true);
+
+    // Register-Schreibschutz ausschalten
+    EALLOW;
+
+		// Dauerschleife Hauptprogramm
+    while(1)
+    {
+				// Block aus 8 Messdaten-Nachrichten mit je 64 Bytes senden. Der FIFO 0 lst
+				// den Interrupt erst aus, wenn alle 8 Nachrichten (Watermark) empfangen sind
+				if (startSendData == 1)
+				{
+						startSendData = 0;
+						txMessage.id = CAN_ID_DATA;
+						txMessage.extended = false;
+						txMessage.fd = true;
+						txMessage.bitRateSwitch = true;
+						txMessage.length = CAN_SIZE_PAYLOAD;
+						for (i = 0; i < CAN_RX_FIFO0_WATERMARK; i++)
+						{
+								txMessage.data[0] = txSequence;
+								for (uint16_t j = 1; j < CAN_SIZE_PAYLOAD_WORDS; j++)
+								{
+										txMessage.data[j] = txSequence + j;
+								}
+								// Ist der Sende-FIFO voll, wird der Rest des Blocks verworfen
+								if (CanSendA(&txMessage) != CAN_SEND_OK)
+								{
+										// Fehlerbehandlung:
+										// ...
+										break;
+								}
+								txSequence++;
+						}
+				}
+
+				// Abschaltung als klassische CAN-Nachricht mit 1 Byte senden
+				if (startSendAlarm == 1)
+				{
+						startSendAlarm = 0;
+						txMessage.id = CAN_ID_ALARM;
+						txMessage.extended = false;
+						txMessage.fd = false;
+						txMessage.bitRateSwitch = false;
+						txMessage.length = 1;
+						txMessage.data[0] = 0xA5;
+						CanSendA(&txMessage);
+				}
+
+				// Empfangene Nachrichten auswerten
+				while (CanReceiveA(&rxMessage))
+				{
+						if (rxMessage.id == CAN_ID_ALARM)
+						{
+								rxAlarms++;
+						}
+						else if (rxMessage.id == CAN_ID_DATA)
+						{
+								// Reihenfolge und Inhalt prfen
+								if (   (rxMessage.length != CAN_SIZE_PAYLOAD)
+										|| (rxMessage.data[0] != rxSequence)
+										|| (rxMessage.data[CAN_SIZE_PAYLOAD_WORDS - 1] != rxSequence + CAN_SIZE_PAYLOAD_WORDS - 1))
+								{
+										rxErrors++;
+								}
+								rxSequence = rxMessage.data[0] + 1;
+						}
+				}
+    }
+}
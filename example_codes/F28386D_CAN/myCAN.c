@@ -0,0 +1,536 @@
+//=================================================================================================
+/// @file       myCAN.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um das MCAN-Modul (CAN-FD) fr die schnelle
+///							Kommunikation zwischen Platinen zu benutzen. Die Aufteilung des Message-RAMs
+///							(Filter, Empfangs-FIFOs, Sende-FIFO) wird ber die Defines in "myCAN.h"
+///							festgelegt. Empfangene Nachrichten werden von Hardware-Filtern in den
+///							Empfangs-FIFO 0 (normale Nachrichten) bzw. 1 (dringende Nachrichten) einsortiert.
+///							Der Interrupt des FIFO 0 wird erst ausgelst, wenn die Fllstandsgrenze
+///							(Watermark) erreicht ist, sodass die ISR mehrere Nachrichten auf einmal in den
+///							Software-Puffer kopiert. Der FIFO 1 erzeugt bei jeder Nachricht einen Interrupt.
+///							Die Nutzdaten (bis zu 64 Bytes) liegen gepackt in 32-Bit Wrtern vor und werden
+///							ohne Umsortieren direkt in das bzw. aus dem Message-RAM kopiert.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCAN.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of local functions
+//-------------------------------------------------------------------------------------------------
+static uint16_t CanLengthToDlc(uint16_t length);
+static void CanReadFifo(uint16_t fifo);
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der empfangenen Nachrichten
+volatile uint32_t canRxCountA;
+// Anzahl der verlorenen Nachrichten (Hardware-FIFO oder Software-Puffer voll)
+volatile uint32_t canRxLostA;
+// Anzahl der in den Sende-FIFO geschriebenen und der wegen vollem FIFO abgelehnten Nachrichten
+uint32_t canTxCountA;
+uint32_t canTxFullA;
+// Anzahl der Bus-Off Zustnde
+volatile uint32_t canBusOffA;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Software-Puffer (Ringpuffer) fr empfangene Nachrichten. Die ISR schreibt an "canRxHeadA",
+// "CanReceiveA()" liest an "canRxTailA"
+static CanMessage canRxBufferA[CAN_SIZE_RX_BUFFER];
+static volatile uint16_t canRxHeadA;
+static volatile uint16_t canRxTailA;
+// Lnge der Nutzdaten in Bytes fr jeden Data-Length-Code (DLC)
+static const uint16_t canDlcToLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: CanLengthToDlc ====================================================================
+///
+/// @brief  Funktion gibt den kleinsten Data-Length-Code (DLC) zurck, dessen Lnge mindestens
+///					"length" Bytes betrgt
+///
+/// @param  uint16_t length
+///
+/// @return uint16_t dlc
+///
+//=================================================================================================
+static uint16_t CanLengthToDlc(uint16_t length)
+{
+		uint16_t dlc = 0;
+
+		while ((dlc < 15) && (canDlcToLength[dlc] < length))
+		{
+				dlc++;
+		}
+		return dlc;
+}
+
+
+//=== Function: CanReadFifo =======================================================================
+///
+/// @brief  Funktion kopiert alle Nachrichten des Empfangs-FIFO 0 bzw. 1 aus dem Message-RAM in
+///					den Software-Puffer und gibt die Elemente im Hardware-FIFO frei. Es werden nur so
+///					viele 32-Bit Wrter kopiert, wie die Nachricht Nutzdaten enthlt. Ist der
+///					Software-Puffer voll, wird die Nachricht verworfen und gezhlt. Darf nur aus der ISR
+///					oder bei gesperrtem CAN-Interrupt aufgerufen werden
+///
+/// @param  uint16_t fifo
+///
+/// @return void
+///
+//=================================================================================================
+static void CanReadFifo(uint16_t fifo)
+{
+		volatile uint32_t *status;
+		volatile uint32_t *acknowledge;
+		volatile uint32_t *element;
+		uint32_t fifoStatus;
+		uint32_t header;
+		uint16_t startAddress;
+		uint16_t getIndex;
+		uint16_t nextHead;
+		uint16_t numberOfWords;
+		uint16_t i;
+		CanMessage *message;
+
+		if (fifo == 0)
+		{
+				status = &McanRegs.MCAN_RXF0S.all;
+				acknowledge = &McanRegs.MCAN_RXF0A.all;
+				startAddress = CAN_RAM_RX_FIFO0;
+		}
+		else
+		{
+				status = &McanRegs.MCAN_RXF1S.all;
+				acknowledge = &McanRegs.MCAN_RXF1A.all;
+				startAddress = CAN_RAM_RX_FIFO1;
+		}
+
+		// Solange der Fllstand (FxFL, Bit 0 ... 6) nicht 0 ist
+		fifoStatus = *status;
+		while ((fifoStatus & 0x7F) != 0)
+		{
+				// Lese-Index (FxGI, Bit 8 ... 13)
+				getIndex = (uint16_t)(fifoStatus >> 8) & 0x3F;
+				element = CAN_RAM_WORD(startAddress + getIndex * CAN_SIZE_ELEMENT);
+				nextHead = (canRxHeadA + 1) % CAN_SIZE_RX_BUFFER;
+				if (nextHead == canRxTailA)
+				{
+						canRxLostA++;
+				}
+				else
+				{
+						message = &canRxBufferA[canRxHeadA];
+						// Header-Wort 0: ESI, XTD, RTR, ID (11-Bit ID in Bit 18 ... 28)
+						header = element[0];
+						message->extended = (header & CAN_ELEMENT_XTD) != 0;
+						if (message->extended)
+						{
+								message->id = header & 0x1FFFFFFFUL;
+						}
+						else
+						{
+								message->id = (header >> 18) & 0x07FF;
+						}
+						// Header-Wort 1: ANMF, FIDX, FDF, BRS, DLC, RXTS
+						header = element[1];
+						message->fd = (header & CAN_ELEMENT_FDF) != 0;
+						message->bitRateSwitch = (header & CAN_ELEMENT_BRS) != 0;
+						message->filterIndex = (uint16_t)(header >> 24) & 0x7F;
+						message->length = canDlcToLength[(uint16_t)(header >> 16) & 0x0F];
+						// Nutzdaten wortweise kopieren
+						numberOfWords = (message->length + 3) >> 2;
+						for (i = 0; i < numberOfWords; i++)
+						{
+								message->data[i] = element[2 + i];
+						}
+						canRxHeadA = nextHead;
+						canRxCountA++;
+				}
+				// Element freigeben, der Hardware-FIFO rckt weiter
+				*acknowledge = getIndex;
+				fifoStatus = *status;
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: CanInitA ==========================================================================
+///
+/// @brief  Funktion initialisiert GPIO 30 (MCAN RX) und GPIO 31 (MCAN TX), den CAN-Takt (40 MHz)
+///					und das MCAN-Modul mit CAN-FD (1 Mbit/s Arbitrierung, 5 Mbit/s Datenphase). Das
+///					Message-RAM wird nach den Defines CAN_RAM_... aufgeteilt und die bergebenen Filter
+///					"filters" werden in den Filterbereich geschrieben. Nachrichten, auf die kein Filter
+///					passt, werden verworfen. Mit "loopback" = true werden die gesendeten Nachrichten
+///					intern zurckgelesen, ohne dass etwas auf den Bus gesendet wird.
+///
+/// @param  const CanFilter *filters, uint16_t numberOfFilters, bool loopback
+///
+/// @return void
+///
+//=================================================================================================
+void CanInitA(const CanFilter *filters, uint16_t numberOfFilters, bool loopback)
+{
+		volatile uint32_t *element;
+		uint16_t numberOfStdFilters = 0;
+		uint16_t numberOfExtFilters = 0;
+		uint16_t i;
+		uint32_t control;
+
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+    // GPIO-Sperre fr GPIO 30 (RX) und 31 (TX) aufheben
+    GpioCtrlRegs.GPALOCK.bit.GPIO30 = 0;
+    GpioCtrlRegs.GPALOCK.bit.GPIO31 = 0;
+    // GPIO 30 auf MCAN-Funktion setzen (RX).
+    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
+    // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an
+    // (siehe S. 1647 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    GpioCtrlRegs.GPAGMUX2.bit.GPIO30 = (9 >> 2);
+    GpioCtrlRegs.GPAMUX2.bit.GPIO30  = (9 & 0x03);
+    // GPIO 30 Pull-Up-Widerstand aktivieren (rezessiver Pegel ohne Transceiver)
+    GpioCtrlRegs.GPAPUD.bit.GPIO30 = 0;
+    // GPIO 30 Asynchroner Eingang
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO30 = 0x03;
+    // GPIO 31 auf MCAN-Funktion setzen (TX)
+    GpioCtrlRegs.GPAGMUX2.bit.GPIO31 = (9 >> 2);
+    GpioCtrlRegs.GPAMUX2.bit.GPIO31  = (9 & 0x03);
+    // GPIO 31 Pull-Up-Widerstand deaktivieren
+    GpioCtrlRegs.GPAPUD.bit.GPIO31 = 1;
+
+    // CAN-Takt: PLLRAWCLK / (CAN_CLOCK_DIVIDER + 1) = 40 MHz
+    ClkCfgRegs.AUXCLKDIVSEL.bit.MCANCLKDIV = CAN_CLOCK_DIVIDER;
+    // Takt fr das MCAN-Modul einschalten und 5 Takte
+    // warten, bis der Takt zum Modul durchgestellt ist
+    // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    CpuSysRegs.PCLKCR10.bit.MCAN_A = 1;
+    __asm(" RPT #4 || NOP");
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+    // Warten, bis das Message-RAM nach dem Reset initialisiert ist
+    while ((McanssRegs.MCANSS_STAT.all & CAN_MCANSS_STAT_MEM_INIT_DONE) == 0)
+    {
+    }
+    // Modul anhalten (INIT) und Konfiguration freigeben (CCE). INIT muss zuerst
+    // gesetzt und zurckgelesen werden, bevor CCE geschrieben werden darf
+    McanRegs.MCAN_CCCR.all |= CAN_CCCR_INIT;
+    while ((McanRegs.MCAN_CCCR.all & CAN_CCCR_INIT) == 0)
+    {
+    }
+    McanRegs.MCAN_CCCR.all |= CAN_CCCR_CCE;
+    // CAN-FD und Umschalten der Bitrate in der Datenphase einschalten
+    control = CAN_CCCR_INIT | CAN_CCCR_CCE | CAN_CCCR_FDOE | CAN_CCCR_BRSE;
+    if (loopback)
+    {
+    		// Interner Loopback: Testmodus und Bus-Monitoring, TX-Pin bleibt rezessiv
+    		control |= CAN_CCCR_TEST | CAN_CCCR_MON;
+    }
+    McanRegs.MCAN_CCCR.all = control;
+    McanRegs.MCAN_TEST.all = loopback ? CAN_TEST_LBCK : 0;
+
+    // Bit-Timing der Arbitrierungsphase (NSJW, NBRP, NTSEG1, NTSEG2)
+    McanRegs.MCAN_NBTP.all = ((uint32_t)CAN_NOMINAL_SJW << 25)
+    											 | ((uint32_t)CAN_NOMINAL_PRESCALER << 16)
+    											 | ((uint32_t)CAN_NOMINAL_TSEG1 << 8)
+    											 | (uint32_t)CAN_NOMINAL_TSEG2;
+    // Bit-Timing der Datenphase (TDC, DBRP, DTSEG1, DTSEG2, DSJW). Bei 5 Mbit/s ist die
+    // Verzgerung des Transceivers lnger als ein Bit und muss kompensiert werden
+    McanRegs.MCAN_DBTP.all = CAN_DBTP_TDC
+    											 | ((uint32_t)CAN_DATA_PRESCALER << 16)
+    											 | ((uint32_t)CAN_DATA_TSEG1 << 8)
+    											 | ((uint32_t)CAN_DATA_TSEG2 << 4)
+    											 | (uint32_t)CAN_DATA_SJW;
+    McanRegs.MCAN_TDCR.all = ((uint32_t)CAN_DATA_TDC_OFFSET << 8);
+
+    // Nachrichten ohne passenden Filter (ANFS, ANFE) und Remote-Frames (RRFS, RRFE) verwerfen
+    McanRegs.MCAN_GFC.all = (2UL << 4) | (2UL << 2) | (1UL << 1) | 1UL;
+    // Hardware-Filter in das Message-RAM schreiben
+    for (i = 0; i < numberOfFilters; i++)
+    {
+    		if (filters[i].extended)
+    		{
+    				if (numberOfExtFilters < CAN_NUMBER_OF_EXT_FILTERS)
+    				{
+    						// Wort 0: EFEC, EFID1; Wort 1: EFT, EFID2
+    						element = CAN_RAM_WORD(CAN_RAM_EXT_FILTER + 8 * numberOfExtFilters);
+    						element[0] = ((uint32_t)filters[i].target << 29) | (filters[i].id1 & 0x1FFFFFFFUL);
+    						element[1] = ((uint32_t)filters[i].type << 30) | (filters[i].id2 & 0x1FFFFFFFUL);
+    						numberOfExtFilters++;
+    				}
+    		}
+    		else
+    		{
+    				if (numberOfStdFilters < CAN_NUMBER_OF_STD_FILTERS)
+    				{
+    						// SFT, SFEC, SFID1, SFID2
+    						element = CAN_RAM_WORD(CAN_RAM_STD_FILTER + 4 * numberOfStdFilters);
+    						element[0] = ((uint32_t)filters[i].type << 30)
+    											 | ((uint32_t)filters[i].target << 27)
+    											 | ((filters[i].id1 & 0x07FF) << 16)
+    											 | (filters[i].id2 & 0x07FF);
+    						numberOfStdFilters++;
+    				}
+    		}
+    }
+    // Filterbereiche (Anzahl, Startadresse)
+    McanRegs.MCAN_SIDFC.all = ((uint32_t)numberOfStdFilters << 16) | CAN_RAM_STD_FILTER;
+    McanRegs.MCAN_XIDFC.all = ((uint32_t)numberOfExtFilters << 16) | CAN_RAM_EXT_FILTER;
+    McanRegs.MCAN_XIDAM.all = 0x1FFFFFFFUL;
+
+    // Empfangs-FIFO 0 (Watermark, Gre, Startadresse) und 1 (Gre, Startadresse) im
+    // Blocking-Mode: Ist der FIFO voll, werden neue Nachrichten verworfen (RF0L, RF1L)
+    McanRegs.MCAN_RXF0C.all = ((uint32_t)CAN_RX_FIFO0_WATERMARK << 24)
+    												| ((uint32_t)CAN_SIZE_RX_FIFO0 << 16)
+    												| CAN_RAM_RX_FIFO0;
+    McanRegs.MCAN_RXF1C.all = ((uint32_t)CAN_SIZE_RX_FIFO1 << 16) | CAN_RAM_RX_FIFO1;
+    McanRegs.MCAN_RXBC.all = 0;
+    // 64 Bytes Daten pro Element fr beide FIFOs und die Empfangs-Puffer (F0DS, F1DS, RBDS)
+    McanRegs.MCAN_RXESC.all = 0x00000777UL;
+    // Sende-FIFO bzw. -Queue (TFQM, TFQS) ohne dedizierte Sende-Puffer, 64 Bytes Daten pro
+    // Element und kein Sende-Event-FIFO
+    McanRegs.MCAN_TXBC.all = ((uint32_t)CAN_TX_MODE << 30)
+    											 | ((uint32_t)CAN_SIZE_TX_FIFO << 24)
+    											 | CAN_RAM_TX_BUFFER;
+    McanRegs.MCAN_TXESC.all = 0x00000007UL;
+    McanRegs.MCAN_TXEFC.all = 0;
+
+    // Interrupts: Watermark FIFO 0, neue Nachricht FIFO 1, Nachricht verloren, Bus-Off.
+    // Alle auf Interrupt-Leitung 0
+    McanRegs.MCAN_IR.all = CAN_IR_ALL;
+    McanRegs.MCAN_IE.all = CAN_IR_RF0W | CAN_IR_RF0L | CAN_IR_RF1N | CAN_IR_RF1L | CAN_IR_BO;
+    McanRegs.MCAN_ILS.all = 0;
+    McanRegs.MCAN_ILE.all = CAN_ILE_EINT0;
+
+    // Steuervariablen initialisieren
+    canRxHeadA = 0;
+    canRxTailA = 0;
+    canRxCountA = 0;
+    canRxLostA = 0;
+    canTxCountA = 0;
+    canTxFullA = 0;
+    canBusOffA = 0;
+
+    // CPU-Interrupts whrend der Konfiguration global sperren
+    DINT;
+    // Register-Schreibschutz aufheben
+    EALLOW;
+    // Interrupt-Service-Routine fr die Interrupt-Leitung 0 an die entsprechende
+    // Stelle (MCANA_0_INT) der PIE-Vector Table speichern und freischalten
+    // (Zeile 9, Spalte 9 der Tabelle 3-2)
+    // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    PieVectTable.MCANA_0_INT = &CanISRA;
+    PieCtrlRegs.PIEIER9.bit.INTx9 = 1;
+    // CPU-Interrupt 9 einschalten
+    IER |= M_INT9;
+		// Register-Schreibschutz setzen
+		EDIS;
+    // CPU-Interrupts nach Konfiguration global wieder freigeben
+    EINT;
+
+    // Konfiguration beenden und Modul starten (CCE wird mit INIT automatisch gelscht)
+    McanRegs.MCAN_CCCR.all &= ~CAN_CCCR_INIT;
+    while ((McanRegs.MCAN_CCCR.all & CAN_CCCR_INIT) != 0)
+    {
+    }
+}
+
+
+//=== Function: CanSendA ==========================================================================
+///
+/// @brief  Funktion schreibt die Nachricht "message" an die Schreibposition des Sende-FIFOs im
+///					Message-RAM und fordert die bertragung an. Die Nutzdaten werden als 32-Bit Wrter
+///					kopiert, bei 64 Bytes also nur 16 Schreibzugriffe. Die Funktion wartet nicht auf das
+///					Ende der bertragung. Sie darf nicht gleichzeitig aus einer ISR und dem
+///					Hauptprogramm aufgerufen werden, da beide dieselbe Schreibposition nutzen wrden
+///
+/// @param  const CanMessage *message
+///
+/// @return uint16_t CAN_SEND_OK, CAN_SEND_FULL oder CAN_SEND_INVALID
+///
+//=================================================================================================
+uint16_t CanSendA(const CanMessage *message)
+{
+		volatile uint32_t *element;
+		uint32_t fifoStatus;
+		uint32_t header;
+		uint16_t putIndex;
+		uint16_t dlc;
+		uint16_t numberOfWords;
+		uint16_t i;
+
+		// Klassische CAN-Rahmen haben hchstens 8 Bytes
+		if ((message->length > CAN_SIZE_PAYLOAD) || (!message->fd && (message->length > 8)))
+		{
+				return CAN_SEND_INVALID;
+		}
+		fifoStatus = McanRegs.MCAN_TXFQS.all;
+		if ((fifoStatus & CAN_TXFQS_TFQF) != 0)
+		{
+				canTxFullA++;
+				return CAN_SEND_FULL;
+		}
+		// Schreib-Index (TFQPI, Bit 16 ... 20)
+		putIndex = (uint16_t)(fifoStatus >> 16) & 0x1F;
+		element = CAN_RAM_WORD(CAN_RAM_TX_BUFFER + putIndex * CAN_SIZE_ELEMENT);
+
+		// Header-Wort 0: XTD, ID (11-Bit ID in Bit 18 ... 28)
+		if (message->extended)
+		{
+				element[0] = CAN_ELEMENT_XTD | (message->id & 0x1FFFFFFFUL);
+		}
+		else
+		{
+				element[0] = (message->id & 0x07FF) << 18;
+		}
+		// Header-Wort 1: FDF, BRS, DLC
+		dlc = CanLengthToDlc(message->length);
+		header = (uint32_t)dlc << 16;
+		if (message->fd)
+		{
+				header |= CAN_ELEMENT_FDF;
+				if (message->bitRateSwitch)
+				{
+						header |= CAN_ELEMENT_BRS;
+				}
+		}
+		element[1] = header;
+		// Nutzdaten wortweise kopieren (aufgerundete Lnge, der Rest von "data" wird mitgesendet)
+		numberOfWords = (canDlcToLength[dlc] + 3) >> 2;
+		for (i = 0; i < numberOfWords; i++)
+		{
+				element[2 + i] = message->data[i];
+		}
+		// bertragung anfordern
+		McanRegs.MCAN_TXBAR.all = 1UL << putIndex;
+		canTxCountA++;
+		return CAN_SEND_OK;
+}
+
+
+//=== Function: CanReceiveA =======================================================================
+///
+/// @brief  Funktion kopiert die lteste empfangene Nachricht aus dem Software-Puffer nach
+///					"message"
+///
+/// @param  CanMessage *message
+///
+/// @return bool true, falls eine Nachricht kopiert wurde
+///
+//=================================================================================================
+bool CanReceiveA(CanMessage *message)
+{
+		if (canRxTailA == canRxHeadA)
+		{
+				return false;
+		}
+		*message = canRxBufferA[canRxTailA];
+		canRxTailA = (canRxTailA + 1) % CAN_SIZE_RX_BUFFER;
+		return true;
+}
+
+
+//=== Function: CanFlushRxFifoA ===================================================================
+///
+/// @brief  Funktion holt die Nachrichten aus dem Empfangs-FIFO 0, die unter der Watermark liegen
+///					und deshalb noch keinen Interrupt ausgelst haben, in den Software-Puffer (z.B. am
+///					Ende eines Datenblocks oder zyklisch aus einem Timer)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void CanFlushRxFifoA(void)
+{
+		uint16_t savedIER;
+
+		// CAN-Interrupt sperren, da die ISR ebenfalls in den Software-Puffer schreibt
+		savedIER = IER;
+		IER &= ~M_INT9;
+		CanReadFifo(0);
+		IER = savedIER;
+}
+
+
+//=== Function: CanGetRxCountA ====================================================================
+///
+/// @brief  Funktion gibt die Anzahl der Nachrichten im Software-Puffer zurck
+///
+/// @param  void
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+uint16_t CanGetRxCountA(void)
+{
+		return (canRxHeadA + CAN_SIZE_RX_BUFFER - canRxTailA) % CAN_SIZE_RX_BUFFER;
+}
+
+
+//=== Function: CanISRA ===========================================================================
+///
+/// @brief	Interrupt-Service-Routine des MCAN-Moduls (MCANA_0_INT). Bei erreichter Watermark
+///					wird der Empfangs-FIFO 0 komplett geleert, bei jeder neuen Nachricht im FIFO 1 wird
+///					dieser geleert. Verlorene Nachrichten und Bus-Off werden gezhlt. Nach einem Bus-Off
+///					wird INIT gelscht, damit das Modul nach 128 x 11 rezessiven Bits wieder am Bus
+///					teilnimmt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void CanISRA(void)
+{
+		uint32_t interruptFlags;
+
+		// Interrupt-Flags lesen und lschen, danach auftretende Ereignisse lsen
+		// einen neuen Interrupt aus
+		interruptFlags = McanRegs.MCAN_IR.all;
+		McanRegs.MCAN_IR.all = interruptFlags;
+
+		// Dringende Nachrichten zuerst
+		if ((interruptFlags & CAN_IR_RF1N) != 0)
+		{
+				CanReadFifo(1);
+		}
+		if ((interruptFlags & CAN_IR_RF0W) != 0)
+		{
+				CanReadFifo(0);
+		}
+		if ((interruptFlags & (CAN_IR_RF0L | CAN_IR_RF1L)) != 0)
+		{
+				canRxLostA++;
+		}
+		if ((interruptFlags & CAN_IR_BO) != 0)
+		{
+				canBusOffA++;
+				McanRegs.MCAN_CCCR.all &= ~CAN_CCCR_INIT;
+		}
+
+		// Interrupt-Leitung 0 im MCAN-Subsystem quittieren
+		McanssRegs.MCANSS_EOI.all = CAN_MCANSS_EOI_INT0;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der MCAN-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+}
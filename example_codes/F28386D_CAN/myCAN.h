@@ -0,0 +1,201 @@
+//=================================================================================================
+/// @file       myCAN.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um das MCAN-Modul (CAN-FD) fr die schnelle
+///							Kommunikation zwischen Platinen zu benutzen. Die Aufteilung des Message-RAMs
+///							(Filter, Empfangs-FIFOs, Sende-FIFO) wird ber die Defines in dieser Datei
+///							festgelegt. Empfangene Nachrichten werden von Hardware-Filtern in den
+///							Empfangs-FIFO 0 (normale Nachrichten) bzw. 1 (dringende Nachrichten) einsortiert.
+///							Der Interrupt des FIFO 0 wird erst ausgelst, wenn die Fllstandsgrenze
+///							(Watermark) erreicht ist, sodass die ISR mehrere Nachrichten auf einmal in den
+///							Software-Puffer kopiert. Der FIFO 1 erzeugt bei jeder Nachricht einen Interrupt.
+///							Die Nutzdaten (bis zu 64 Bytes) liegen gepackt in 32-Bit Wrtern vor und werden
+///							ohne Umsortieren direkt in das bzw. aus dem Message-RAM kopiert.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCAN_H_
+#define MYCAN_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Taktteiler fr den CAN-Takt (AUXCLKDIVSEL.MCANCLKDIV, Wert + 1 = Teiler).
+// PLLRAWCLK = 200 MHz (siehe "DeviceInit()") / 5 = 40 MHz
+#define CAN_CLOCK_DIVIDER									4
+// Bit-Timing der Arbitrierungsphase (Werte jeweils - 1, 40 MHz CAN-Takt):
+// 1 Mbit/s = 40 MHz / (1 * (1 + 31 + 8)), Abtastpunkt 80 %
+#define CAN_NOMINAL_PRESCALER							0
+#define CAN_NOMINAL_TSEG1									30
+#define CAN_NOMINAL_TSEG2									7
+#define CAN_NOMINAL_SJW										7
+// Bit-Timing der Datenphase (Werte jeweils - 1, 40 MHz CAN-Takt):
+// 5 Mbit/s = 40 MHz / (1 * (1 + 5 + 2)), Abtastpunkt 75 %
+#define CAN_DATA_PRESCALER								0
+#define CAN_DATA_TSEG1										4
+#define CAN_DATA_TSEG2										1
+#define CAN_DATA_SJW											1
+// Offset der Transmitter-Delay-Compensation in CAN-Takten (Abtastpunkt der Datenphase)
+#define CAN_DATA_TDC_OFFSET								((CAN_DATA_PRESCALER + 1) * (CAN_DATA_TSEG1 + 2))
+
+// Aufteilung des Message-RAMs: Anzahl der Elemente pro Bereich
+#define CAN_NUMBER_OF_STD_FILTERS					16						// Filter fr 11-Bit IDs
+#define CAN_NUMBER_OF_EXT_FILTERS					8							// Filter fr 29-Bit IDs
+#define CAN_SIZE_RX_FIFO0									16						// Empfangs-FIFO 0 (max. 64)
+#define CAN_SIZE_RX_FIFO1									4							// Empfangs-FIFO 1 (max. 64)
+#define CAN_SIZE_TX_FIFO									8							// Sende-FIFO bzw. -Queue (max. 32)
+// Fllstand des Empfangs-FIFO 0, ab dem der Interrupt ausgelst wird (1 ... CAN_SIZE_RX_FIFO0)
+#define CAN_RX_FIFO0_WATERMARK						8
+// Sende-Puffer als FIFO (Reihenfolge des Aufrufs) oder als Queue (niedrigste ID zuerst)
+#define CAN_TX_MODE_FIFO									0
+#define CAN_TX_MODE_QUEUE									1
+#define CAN_TX_MODE												CAN_TX_MODE_FIFO
+// Maximale Nutzdaten einer Nachricht in Bytes bzw. 32-Bit Wrtern
+#define CAN_SIZE_PAYLOAD									64
+#define CAN_SIZE_PAYLOAD_WORDS						(CAN_SIZE_PAYLOAD / 4)
+// Gre eines Elements in Bytes (Header mit 2 Wrtern + 64 Bytes Daten) und Gre des
+// Message-RAMs in Bytes
+#define CAN_SIZE_ELEMENT									(8 + CAN_SIZE_PAYLOAD)
+#define CAN_SIZE_MSG_RAM									4096
+// Startadressen der Bereiche im Message-RAM (Byte-Offset, wie in den MCAN-Registern)
+#define CAN_RAM_STD_FILTER								0
+#define CAN_RAM_EXT_FILTER								(CAN_RAM_STD_FILTER + 4 * CAN_NUMBER_OF_STD_FILTERS)
+#define CAN_RAM_RX_FIFO0									(CAN_RAM_EXT_FILTER + 8 * CAN_NUMBER_OF_EXT_FILTERS)
+#define CAN_RAM_RX_FIFO1									(CAN_RAM_RX_FIFO0 + CAN_SIZE_ELEMENT * CAN_SIZE_RX_FIFO0)
+#define CAN_RAM_TX_BUFFER									(CAN_RAM_RX_FIFO1 + CAN_SIZE_ELEMENT * CAN_SIZE_RX_FIFO1)
+#define CAN_RAM_END												(CAN_RAM_TX_BUFFER + CAN_SIZE_ELEMENT * CAN_SIZE_TX_FIFO)
+#if CAN_RAM_END > CAN_SIZE_MSG_RAM
+#error "Aufteilung des CAN Message-RAMs ist grer als das Message-RAM"
+#endif
+// Adresse des Message-RAMs im Adressraum der CPU (16-Bit Wrter)
+#define CAN_MSG_RAM_BASE									0x00058000UL
+// Gre des Software-Puffers fr empfangene Nachrichten
+#define CAN_SIZE_RX_BUFFER								32
+
+// Filtertyp (SFT bzw. EFT)
+#define CAN_FILTER_RANGE									0							// id1 <= ID <= id2
+#define CAN_FILTER_DUAL										1							// ID == id1 oder ID == id2
+#define CAN_FILTER_CLASSIC								2							// (ID & id2) == (id1 & id2)
+// Ziel einer gefilterten Nachricht (SFEC bzw. EFEC)
+#define CAN_FILTER_TO_FIFO0								1
+#define CAN_FILTER_TO_FIFO1								2
+#define CAN_FILTER_REJECT									3
+
+// Rckgabewerte von "CanSendA()"
+#define CAN_SEND_INVALID									0							// Lnge ungltig
+#define CAN_SEND_FULL											1							// Sende-FIFO voll
+#define CAN_SEND_OK												2							// In den Sende-FIFO geschrieben
+
+// Bits der MCAN-Register (siehe Kapitel MCAN, Reference Manual TMS320F2838x, SPRUII0D)
+// CCCR
+#define CAN_CCCR_INIT											0x00000001UL
+#define CAN_CCCR_CCE											0x00000002UL
+#define CAN_CCCR_MON											0x00000020UL
+#define CAN_CCCR_TEST											0x00000080UL
+#define CAN_CCCR_FDOE											0x00000100UL
+#define CAN_CCCR_BRSE											0x00000200UL
+// TEST
+#define CAN_TEST_LBCK											0x00000010UL
+// DBTP
+#define CAN_DBTP_TDC											0x00800000UL
+// IR, IE
+#define CAN_IR_RF0W												0x00000002UL
+#define CAN_IR_RF0L												0x00000008UL
+#define CAN_IR_RF1N												0x00000010UL
+#define CAN_IR_RF1L												0x00000080UL
+#define CAN_IR_BO													0x02000000UL
+#define CAN_IR_ALL												0x3FFFFFFFUL
+// ILE
+#define CAN_ILE_EINT0											0x00000001UL
+// TXFQS
+#define CAN_TXFQS_TFQF										0x00200000UL
+// MCANSS_STAT
+#define CAN_MCANSS_STAT_MEM_INIT_DONE			0x00000002UL
+// MCANSS_EOI: Interrupt-Leitung 0
+#define CAN_MCANSS_EOI_INT0								0x00000001UL
+// Element im Message-RAM (Header-Wort 0 und 1)
+#define CAN_ELEMENT_XTD										0x40000000UL
+#define CAN_ELEMENT_FDF										0x00200000UL
+#define CAN_ELEMENT_BRS										0x00100000UL
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zeiger auf ein 32-Bit Wort des Message-RAMs (Byte-Offset offset, durch 4 teilbar)
+#define CAN_RAM_WORD(offset)							((volatile uint32_t *)(CAN_MSG_RAM_BASE + ((offset) >> 1)))
+// Byte i (0 ... 63) der gepackten Nutzdaten einer Nachricht lesen
+#define CAN_GET_BYTE(message, i)					((uint16_t)((message)->data[(i) >> 2] >> (8 * ((i) & 0x03))) & 0x00FF)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Eine CAN-Nachricht. Die Nutzdaten sind gepackt: Byte 0 steht in Bit 0 ... 7 von data[0],
+// Byte 4 in Bit 0 ... 7 von data[1] usw. Gltige Lngen sind 0 ... 8 sowie bei CAN-FD 12,
+// 16, 20, 24, 32, 48 und 64 Bytes, andere Lngen werden beim Senden aufgerundet
+typedef struct
+{
+		uint32_t id;													// 11-Bit bzw. 29-Bit ID
+		bool extended;												// 29-Bit ID
+		bool fd;															// CAN-FD Rahmen (bis zu 64 Bytes)
+		bool bitRateSwitch;										// Datenphase mit CAN_DATA_... Bit-Timing
+		uint16_t length;											// Lnge der Nutzdaten in Bytes
+		uint16_t filterIndex;									// Index des passenden Filters (nur Empfang)
+		uint32_t data[CAN_SIZE_PAYLOAD_WORDS];	// Nutzdaten
+} CanMessage;
+
+// Ein Hardware-Filter. Beim Standard-Filter (11-Bit) werden nur die unteren 11 Bit von
+// id1 und id2 verwendet
+typedef struct
+{
+		bool extended;												// Filter fr 29-Bit IDs
+		uint16_t type;												// CAN_FILTER_RANGE, _DUAL oder _CLASSIC
+		uint16_t target;											// CAN_FILTER_TO_FIFO0, _TO_FIFO1 oder _REJECT
+		uint32_t id1;													// Erste ID bzw. ID
+		uint32_t id2;													// Zweite ID bzw. Maske
+} CanFilter;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der empfangenen Nachrichten
+extern volatile uint32_t canRxCountA;
+// Anzahl der verlorenen Nachrichten (Hardware-FIFO oder Software-Puffer voll)
+extern volatile uint32_t canRxLostA;
+// Anzahl der in den Sende-FIFO geschriebenen und der wegen vollem FIFO abgelehnten Nachrichten
+extern uint32_t canTxCountA;
+extern uint32_t canTxFullA;
+// Anzahl der Bus-Off Zustnde (das Modul wird danach automatisch neu gestartet)
+extern volatile uint32_t canBusOffA;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die CAN-Pins, den CAN-Takt, das Message-RAM, die Hardware-Filter
+// und den Interrupt des MCAN-Moduls
+extern void CanInitA(const CanFilter *filters, uint16_t numberOfFilters, bool loopback);
+// Funktion schreibt eine Nachricht in den Sende-FIFO und startet die bertragung
+extern uint16_t CanSendA(const CanMessage *message);
+// Funktion holt die lteste empfangene Nachricht aus dem Software-Puffer
+extern bool CanReceiveA(CanMessage *message);
+// Funktion holt die Nachrichten unter der Watermark aus dem Empfangs-FIFO 0
+extern void CanFlushRxFifoA(void);
+// Funktion gibt die Anzahl der Nachrichten im Software-Puffer zurck
+extern uint16_t CanGetRxCountA(void);
+// Interrupt-Service-Routine des MCAN-Moduls (Interrupt-Leitung 0)
+__interrupt void CanISRA(void);
+
+
+#endif
@@ -17,8 +17,8 @@ MEMORY
    RAMLS2           : origin = 0x009000, length = 0x000800
    RAMLS3           : origin = 0x009800, length = 0x000800
    RAMLS4           : origin = 0x00A000, length = 0x000800
-   RAMLS5           : origin = 0x00A800, length = 0x000800
-   RAMLS6           : origin = 0x00B000, length = 0x000800
+   /* RAMLS5 and RAMLS6 combined as CLA program memory (CLAPGM_LS5/LS6 in ClaInit()) */
+   RAMLS5_6         : origin = 0x00A800, length = 0x001000
    RAMLS7           : origin = 0x00B800, length = 0x000800
    RAMGS0           : origin = 0x00D000, length = 0x001000
    RAMGS1           : origin = 0x00E000, length = 0x001000
@@ -65,6 +65,7 @@ MEMORY
 
    CLA1_MSGRAMLOW   : origin = 0x001480,   length = 0x000080
    CLA1_MSGRAMHIGH  : origin = 0x001500,   length = 0x000080
+   DMA1_CLA1_MSGRAM : origin = 0x001700,   length = 0x000080
 }
 
 
@@ -102,13 +103,14 @@ SECTIONS
    dclfuncs           : > RAMLS3
 
     /* CLA specific sections */
-   Cla1Prog         : > RAMLS5
+   Cla1Prog         : > RAMLS5_6
 
    CLADataLS0		: > RAMLS0
    CLADataLS1		: > RAMLS1
 
    Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
    CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
+   Dma1ToCla1MsgRAM : > DMA1_CLA1_MSGRAM, type=NOINIT
    Cla1DataRam      : >> RAMLS0 | RAMLS1
 
    /* CLA C compiler sections */
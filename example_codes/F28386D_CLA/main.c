@@ -19,7 +19,39 @@
 ///										 auch wenn es im FLASH gespeichert wurde. Lediglich wenn die CPU ber den
 ///										 Debugger resettet und neu gestartet wird funktioniert es.
 ///
-/// @version	V1.2
+///						nderung in Version 1.3: Mit CLA_CONTROL_ENABLE = 1 (myClaControl.h) startet der
+///						ADC statt Task 2 den CLA-Task 4, der eine Stromregelung (Tiefpass und PI-Regler)
+///						vollstndig im CLA ausfhrt. Sollwert und Parameter stehen in "claControlInput",
+///						Messwert, Stellgre und Laufzeit des Tasks in "claControlOutput".
+///						Die Laufzeit der Signalverarbeitungs-Kernels (myDsp.h) wird beim Start auf der
+///						CPU (dspBenchmarkCycles) und mit CLA-Task 8 auf dem CLA (claDspBenchmarkCycles)
+///						gemessen.
+///
+///						nderung in Version 1.4: Mit ADC_OVERSAMPLING = 1 (myADC.h) werden ADCIN2 und
+///						ADCIN3 mit mehreren SOCs pro Kanal berabgetastet, CLA-Task 5 summiert und
+///						dezimiert die Messwerte ohne CPU-Interrupt ("adcOversampled").
+///
+///						nderung in Version 1.5: Mit CLA_BACKGROUND_ENABLE = 1 (myClaBackground.h) startet
+///						nach der Laufzeitmessung (Task 8) der Hintergrund-Task des CLA, der die Messwerte
+///						der Stromregelung zwischen den Abtastschritten auswertet ("claBackgroundOutput").
+///
+///						nderung in Version 1.6: Mit CLA_PIPELINE_ENABLE = 1 (myClaPipeline.h) luft eine
+///						Regelkette mit 100 kHz ohne die CPU: ePWM2 triggert einen Burst des ADC-B, der DMA
+///						kopiert die Messwerte in das DMA-zu-CLA Message-RAM und CLA-Task 6 schreibt die
+///						neue Stellgre in CMPA von ePWM2 (Ausgang GPIO 2, "claPipelineOutput").
+///
+///						nderung in Version 1.7: Mit CLA_FOC_ENABLE = 1 (myClaFoc.h) luft eine
+///						feldorientierte Regelung mit 20 kHz im CLA-Task 7: ePWM4 triggert ADC-C und ADC-D
+///						(Phasenstrme a und b), der Task schreibt die Tastverhltnisse der drei
+///						Halbbrcken in ePWM4 ... 6 (GPIO 6 ... 11, "claFocOutput"). RAM LS6 erweitert
+///						dazu den CLA-Programmspeicher.
+///
+///						nderung in Version 1.8: Mit ADC_REDUNDANCY_ENABLE = 1 (myAdcRedundancy.h) wandeln
+///						ADC-A und ADC-B den Eingang ADCIN14 beim selben Trigger (CPU-Timer 0), CLA-Task 2
+///						vergleicht die Messwerte und die PPBs prfen den zulssigen Bereich. Nur bei einem
+///						neuen Fehler wird die CPU unterbrochen ("adcRedundancyOutput").
+///
+/// @version	V1.8
 ///
 /// @date			08.09.2022
 ///
@@ -29,6 +61,12 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myCLA.h"
+#include "myClaControl.h"
+#include "myClaBackground.h"
+#include "myClaPipeline.h"
+#include "myClaFoc.h"
+#include "myAdcRedundancy.h"
+#include "myDsp.h"
 #include "myADC.h"
 #include "myPWM.h"
 
@@ -151,6 +189,10 @@ uint16_t claInterrupt2Counter = 0;
 uint16_t claInterrupt3Counter = 0;
 // Startet den CLA-Task 3 per Software
 uint16_t claStartTask3 = 0;
+#if ADC_REDUNDANCY_ENABLE
+// Lscht die Fehler der redundanten Messung (im Debugger auf 1 setzen)
+uint16_t adcRedundancyClearRequest = 0;
+#endif
 // Die folgenden Variablen mssen zustzlich noch in der h.Datei fr das CLA-Modul
 // deklariert werden. Es knnen dabei nur Datentypen aus der Bibliothek "stdint.h"
 // verwendet werden, da das CLA-Modul einen eingeschrnkten Befehlssatz hat. Die
@@ -162,6 +204,54 @@ unsigned int cpuToCla;
 // Variablen, die nur von CLA beschrieben und von CPU und CLA gelesen werden knnen
 #pragma DATA_SECTION(claToCpu,"Cla1ToCpuMsgRAM");
 unsigned int claToCpu;
+// Sollwert und Parameter der Stromregelung (CPU schreibt, CLA liest)
+#pragma DATA_SECTION(claControlInput,"CpuToCla1MsgRAM");
+ClaCpuToClaMsg claControlInput;
+// Messwert, Stellgre und Laufzeit der Stromregelung (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(claControlOutput,"Cla1ToCpuMsgRAM");
+ClaClaToCpuMsg claControlOutput;
+// Laufzeit der DSP-Kernels auf dem CLA (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(claDspBenchmarkCycles,"Cla1ToCpuMsgRAM");
+uint32_t claDspBenchmarkCycles[DSP_NUMBER_OF_BENCHMARKS];
+#if CLA_BACKGROUND_ENABLE
+// Ergebnisse des Hintergrund-Tasks (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(claBackgroundOutput,"Cla1ToCpuMsgRAM");
+ClaBackgroundOutput claBackgroundOutput;
+#endif
+#if ADC_OVERSAMPLING
+// Ergebnisse der berabtastung (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(adcOversampled,"Cla1ToCpuMsgRAM");
+uint32_t adcOversampled[ADC_OVERSAMPLING_NUMBER_OF_CHANNELS];
+#pragma DATA_SECTION(adcOversamplingCount,"Cla1ToCpuMsgRAM");
+uint32_t adcOversamplingCount;
+#endif
+#if CLA_PIPELINE_ENABLE
+// Sollwert und Parameter der Regelkette (CPU schreibt, CLA liest)
+#pragma DATA_SECTION(claPipelineInput,"CpuToCla1MsgRAM");
+ClaCpuToClaMsg claPipelineInput;
+// Messwert, Stellgre, Laufzeit und Latenz der Regelkette (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(claPipelineOutput,"Cla1ToCpuMsgRAM");
+ClaPipelineOutput claPipelineOutput;
+// Messwerte des ADC-B (DMA schreibt, CLA liest)
+#pragma DATA_SECTION(claPipelineSamples,"Dma1ToCla1MsgRAM");
+uint16_t claPipelineSamples[CLA_PIPELINE_NUMBER_OF_SAMPLES];
+#endif
+#if CLA_FOC_ENABLE
+// Sollwerte und Parameter der FOC (CPU schreibt, CLA liest)
+#pragma DATA_SECTION(claFocInput,"CpuToCla1MsgRAM");
+ClaFocInput claFocInput;
+// Messwerte, Stellgren, Laufzeit und Latenz der FOC (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(claFocOutput,"Cla1ToCpuMsgRAM");
+ClaFocOutput claFocOutput;
+#endif
+#if ADC_REDUNDANCY_ENABLE
+// Schwelle und Lschanforderung der redundanten Messung (CPU schreibt, CLA liest)
+#pragma DATA_SECTION(adcRedundancyInput,"CpuToCla1MsgRAM");
+AdcRedundancyInput adcRedundancyInput;
+// Messwerte, Statistik und Fehler der redundanten Messung (CLA schreibt, CPU liest)
+#pragma DATA_SECTION(adcRedundancyOutput,"Cla1ToCpuMsgRAM");
+AdcRedundancyOutput adcRedundancyOutput;
+#endif
 
 
 //=== Function: main ==============================================================================
@@ -177,6 +267,8 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
 	  // ADC initialisieren
 		AdcAInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
@@ -185,6 +277,40 @@ void main(void)
 	  PwmInitPwm8();
 	  // CLA initialisieren
 	  ClaInit();
+#if ADC_OVERSAMPLING
+	  // berabtastung starten (erst nach ClaInit(), damit CLA-Task 5 bereit ist)
+	  AdcAInitOversampling();
+#endif
+	  // Laufzeit der DSP-Kernels auf der CPU messen
+	  DspBenchmark();
+#if CLA_CONTROL_ENABLE
+	  // Zeitbasis der Laufzeitmessung starten und Regelung einschalten
+	  // (erst nach ClaInit(), da dort die Message-RAMs gelscht werden)
+	  ClaControlInit();
+	  // Laufzeit der DSP-Kernels auf dem CLA messen (bentigt die Zeitbasis eCAP1)
+	  EALLOW;
+	  Cla1Regs.MIFRC.bit.INT8 = 1;
+	  EDIS;
+#endif
+#if CLA_PIPELINE_ENABLE
+	  // Regelkette ePWM2 -> ADC-B -> DMA -> CLA-Task 6 starten
+	  // (erst nach ClaControlInit(), da die Laufzeitmessung die Zeitbasis eCAP1 verwendet)
+	  ClaPipelineInit();
+#endif
+#if CLA_FOC_ENABLE
+	  // FOC ePWM4 -> ADC-C/D -> CLA-Task 7 -> ePWM4 ... 6 starten
+	  // (erst nach ClaControlInit(), da die Laufzeitmessung die Zeitbasis eCAP1 verwendet)
+	  ClaFocInit();
+#endif
+#if ADC_REDUNDANCY_ENABLE
+	  // Redundante Messung ADC-A/ADC-B -> CLA-Task 2 starten
+	  // (erst nach ClaPipelineInit(), die ADC-B einschaltet)
+	  AdcRedundancyInit();
+#endif
+#if CLA_BACKGROUND_ENABLE
+	  // Hintergrund-Task starten (erst nach Task 8, dessen Ressourcen er verwendet)
+	  ClaBackgroundStart();
+#endif
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -217,6 +343,13 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
+#if ADC_REDUNDANCY_ENABLE
+    		if (adcRedundancyClearRequest)
+    		{
+    				AdcRedundancyClearFault();
+    				adcRedundancyClearRequest = 0;
+    		}
+#endif
     		// CLA-Task 3 ber Software starten
     		if (claStartTask3 == 0)
     		{
@@ -268,6 +401,12 @@ void ClaInit(void)
     MemCfgRegs.MSGxINIT.bit.INIT_CLA1TOCPU = 1;
     // Warten, bis die Initialisierung abgeschlossen ist
     while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_CLA1TOCPU == 0);
+#if CLA_PIPELINE_ENABLE
+    // DMA-zu-CLA Message-Register Initialisierung starten (Messwerte der Regelkette)
+    MemCfgRegs.MSGxINIT.bit.INIT_DMA1TOCLA1 = 1;
+    // Warten, bis die Initialisierung abgeschlossen ist
+    while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_DMA1TOCLA1 == 0);
+#endif
     // CLA-DATENSPEICHER:
     // Zugriffsberechtigung RAM-LSx:
     // Zugriff durch CPU und CLA auf RAM LS0 freigeben
@@ -300,6 +439,9 @@ void ClaInit(void)
     // Welche Speicherbereiche als CLA-Programmspeicher zu deklarieren sind,
     // ist dem Linker- File zu entnehmen (Abschnitt "Cla1Prog")
     MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS5 = 1;
+    // LS6 erweitert den CLA-Programmspeicher (RAMLS5_6 im Linker-File)
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS6 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS6 = 1;
 
     // CLA-TASK 1 konfigurieren:
     // CLA-Task 1 dem CLA-Prozessor bekannt geben.
@@ -323,15 +465,32 @@ void ClaInit(void)
     PieCtrlRegs.PIEIER11.bit.INTx1 = 1;
 
     // CLA-TASK 2 konfigurieren:
+#if ADC_REDUNDANCY_ENABLE
+    // Redundante Messung: ADC-B INT3 startet den Vergleich der Messwerte (Task 2 wird
+    // von der Stromregelung nicht bentigt). Der CPU-Interrupt wird nur bei einem neuen
+    // Fehler vom Task ausgelst
+    Cla1Regs.MVECT2 = (uint16_t)&ClaTask2Redundancy;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK2 = ADC_REDUNDANCY_TRIGGER;
+#else
     // CLA-Task 2 dem CLA-Prozessor bekannt geben
     Cla1Regs.MVECT2 = (uint16_t)&ClaTask2;
+#if CLA_CONTROL_ENABLE
+    // ADC-A INT1 startet die Stromregelung (Task 4), Task 2 wird nicht getriggert
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK2 = CLA_TASK_TRIGGER_SOFTWARE;
+#else
     // ADC-A INT1 als Triggerquelle fr CLA-Task 2 setzen
     DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK2 = CLA_TASK_TRIGGER_ADCA_INT1;
+#endif
+#endif
     // Task 2 freigegeben
     Cla1Regs.MIER.bit.INT2 = 1;
     // Interrupt-Service-Routinen fr den CLA-Task 2 Interrupt an die
     // entsprechende Stelle (CLA1_2_INT) der PIE-Vector Table speichern
+#if ADC_REDUNDANCY_ENABLE
+    PieVectTable.CLA1_2_INT = &AdcRedundancyFaultISR;
+#else
     PieVectTable.CLA1_2_INT = &ClaTask2Isr;
+#endif
     // INT11.2-Interrupt freischalten (Zeile 11, Spalte 2 der Tabelle 3-2)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
     PieCtrlRegs.PIEIER11.bit.INTx2 = 1;
@@ -350,6 +509,63 @@ void ClaInit(void)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
     PieCtrlRegs.PIEIER11.bit.INTx3 = 1;
 
+#if CLA_CONTROL_ENABLE
+    // CLA-TASK 4 konfigurieren (Stromregelung):
+    // CLA-Task 4 dem CLA-Prozessor bekannt geben
+    Cla1Regs.MVECT4 = (uint16_t)&ClaTask4;
+    // End of Conversion des ADC als Triggerquelle fr CLA-Task 4 setzen
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK4 = CLA_CONTROL_TRIGGER;
+    // Task 4 freigegeben
+    Cla1Regs.MIER.bit.INT4 = 1;
+    // Kein CPU-Interrupt am Ende von Task 4, die Regelung luft ohne die CPU.
+    // Das ADC-Interrupt-Flag lscht der Task selbst, daher wird auch der
+    // ADCA1-Interrupt der CPU (AdcAInt1ISR) nicht bentigt
+    PieCtrlRegs.PIEIER11.bit.INTx4 = 0;
+    PieCtrlRegs.PIEIER1.bit.INTx1 = 0;
+#endif
+
+#if ADC_OVERSAMPLING
+    // CLA-TASK 5 konfigurieren (berabtastung):
+    // CLA-Task 5 dem CLA-Prozessor bekannt geben
+    Cla1Regs.MVECT5 = (uint16_t)&ClaTask5;
+    // ADC-A INT2 (nach der letzten SOC der berabtastung) als Triggerquelle setzen
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL2.bit.TASK5 = CLA_TASK_TRIGGER_ADCA_INT2;
+    // Task 5 freigegeben, kein CPU-Interrupt am Ende des Tasks
+    Cla1Regs.MIER.bit.INT5 = 1;
+    PieCtrlRegs.PIEIER11.bit.INTx5 = 0;
+#endif
+
+#if CLA_PIPELINE_ENABLE
+    // CLA-TASK 6 konfigurieren (Regelkette):
+    // CLA-Task 6 dem CLA-Prozessor bekannt geben
+    Cla1Regs.MVECT6 = (uint16_t)&ClaTask6;
+    // ADC-B INT2 (nach der Synchronisations-SOC) als Triggerquelle setzen
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL2.bit.TASK6 = CLA_PIPELINE_TRIGGER;
+    // Task 6 freigegeben, kein CPU-Interrupt am Ende des Tasks
+    Cla1Regs.MIER.bit.INT6 = 1;
+    PieCtrlRegs.PIEIER11.bit.INTx6 = 0;
+#endif
+
+#if CLA_FOC_ENABLE
+    // CLA-TASK 7 konfigurieren (FOC):
+    // CLA-Task 7 dem CLA-Prozessor bekannt geben
+    Cla1Regs.MVECT7 = (uint16_t)&ClaTask7;
+    // ADC-D INT1 (nach der Messung von Phase b) als Triggerquelle setzen
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL2.bit.TASK7 = CLA_FOC_TRIGGER;
+    // Task 7 freigegeben, kein CPU-Interrupt am Ende des Tasks
+    Cla1Regs.MIER.bit.INT7 = 1;
+    PieCtrlRegs.PIEIER11.bit.INTx7 = 0;
+#endif
+
+    // CLA-TASK 8 konfigurieren (Laufzeitmessung der DSP-Kernels):
+    // CLA-Task 8 dem CLA-Prozessor bekannt geben
+    Cla1Regs.MVECT8 = (uint16_t)&ClaTask8;
+    // Software als Triggerquelle fr CLA-Task 8 setzen
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL2.bit.TASK8 = CLA_TASK_TRIGGER_SOFTWARE;
+    // Task 8 freigegeben, kein CPU-Interrupt am Ende des Tasks
+    Cla1Regs.MIER.bit.INT8 = 1;
+    PieCtrlRegs.PIEIER11.bit.INTx8 = 0;
+
     // CPU-Interrupt 11 einschalten (Zeile 11 der Tabelle 3-2)
     IER |= M_INT11;
 
@@ -361,6 +577,89 @@ void ClaInit(void)
 }
 
 
+//=== Function: ClaControlInit ====================================================================
+///
+/// @brief	Funktion startet den Zhler von eCAP1 als freilaufende Zeitbasis fr die
+///					Laufzeitmessung der CLA-Tasks (SYSCLK, 5 ns pro Takt) und setzt die Startwerte
+///					der Stromregelung. Muss nach ClaInit() aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaControlInit(void)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Takt fr das eCAP1-Modul einschalten und 5 Takte
+		// warten, bis der Takt zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR3.bit.ECAP1 = 1;
+		__asm(" RPT #4 || NOP");
+		// Capture-Betriebsart, der Zhler luft frei mit SYSCLK durch
+		// (auch wenn der Debugger die CPU anhlt)
+		ECap1Regs.ECCTL2.bit.CAP_APWM  = 0;
+		ECap1Regs.ECCTL1.bit.FREE_SOFT = 3;
+		ECap1Regs.TSCTR                = 0;
+		ECap1Regs.ECCTL2.bit.TSCTRSTOP = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		// Startwerte der Regelung
+		claControlInput.reference         = 0.0f;
+		claControlInput.kp                = CLA_CONTROL_KP;
+		claControlInput.ki                = CLA_CONTROL_KI;
+		claControlInput.filterCoefficient = CLA_CONTROL_FILTER_COEFFICIENT;
+		claControlInput.outputMin         = CLA_CONTROL_OUTPUT_MIN;
+		claControlInput.outputMax         = CLA_CONTROL_OUTPUT_MAX;
+		claControlInput.adcScale          = CLA_CONTROL_ADC_SCALE;
+		claControlInput.pwmScale          = CLA_CONTROL_PWM_SCALE;
+		// Zustnde des CLA zurcksetzen und die Regelung einschalten
+		claControlInput.reset++;
+		claControlInput.enable            = 1;
+}
+
+
+//=== Function: ClaBackgroundStart ================================================================
+///
+/// @brief	Funktion wartet, bis CLA-Task 8 beendet ist, und startet den Hintergrund-Task per
+///					Software. Danach kann Task 8 nicht mehr getriggert werden. Getriggerte Tasks
+///					unterbrechen den Hintergrund-Task, der anschlieend an der unterbrochenen Stelle
+///					fortgesetzt wird. Muss nach ClaInit() und ClaControlInit() aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaBackgroundStart(void)
+{
+#if CLA_BACKGROUND_ENABLE
+		// Warten, bis Task 8 (Laufzeitmessung) weder ansteht noch luft
+		while (Cla1Regs.MIFR.bit.INT8 || Cla1Regs.MIRUN.bit.INT8);
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Task 8 sperren, seine Triggerquelle wird nicht verwendet
+		Cla1Regs.MIER.bit.INT8 = 0;
+		// Hintergrund-Task dem CLA-Prozessor bekannt geben
+		Cla1Regs._MVECTBGRND = (uint16_t)&ClaBackgroundTask;
+		// Hintergrund-Task freigeben und per Software starten (kein Trigger)
+		// TRIGEN = 0: Start nur ber BGSTART
+		// BGEN = 1: Hintergrund-Task freigegeben
+		Cla1Regs._MCTLBGRND.bit.TRIGEN = 0;
+		Cla1Regs._MCTLBGRND.bit.BGEN = 1;
+		Cla1Regs._MCTLBGRND.bit.BGSTART = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+#endif
+}
+
+
 //=== Function: ClaTask1Isr =======================================================================
 ///
 /// @brief	ISR wird aufgerufen, nachdem der CLA-Task 1 beendet wurde oder das CLA-Modul manuell
@@ -373,6 +672,8 @@ void ClaInit(void)
 //=================================================================================================
 __interrupt void ClaTask1Isr(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_CLA_TASK1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -387,6 +688,7 @@ __interrupt void ClaTask1Isr(void)
 
 		// Interrupt-Flag der Gruppe 11 lschen (da gehrt der CLA1_1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK11 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_CLA_TASK1);
 }
 
 
@@ -402,6 +704,8 @@ __interrupt void ClaTask1Isr(void)
 //=================================================================================================
 __interrupt void ClaTask2Isr(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_CLA_TASK2);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -416,6 +720,7 @@ __interrupt void ClaTask2Isr(void)
 
 		// Interrupt-Flag der Gruppe 11 lschen (da gehrt der CLA1_1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK11 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_CLA_TASK2);
 }
 
 
@@ -431,6 +736,8 @@ __interrupt void ClaTask2Isr(void)
 //=================================================================================================
 __interrupt void ClaTask3Isr(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_CLA_TASK3);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -447,4 +754,5 @@ __interrupt void ClaTask3Isr(void)
 
 		// Interrupt-Flag der Gruppe 11 lschen (da gehrt der CLA1_1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK11 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_CLA_TASK3);
 }
@@ -6,7 +6,13 @@
 ///							eine Spannung gemessen wird. Die Messung wird durch ePWM8 getriggert. Nachdem
 ///							die Messung abgeschlossen ist, wird ein ADC-Interrupt ausgelst.
 ///
-/// @version    V1.3
+///							nderung in Version 1.4: Mit ADC_SIGNAL_CONDITIONING = 1 filtert die ISR jeden
+///							Messwert mit einem Biquad-Tiefpass und berechnet den Effektivwert (myDsp.h)
+///
+///							nderung in Version 1.5: berabtastung langsamer Kanle (ADC_OVERSAMPLING) mit
+///							mehreren SOCs pro Kanal, Summierung und Dezimierung im CLA-Task 5 (myAdcCla.cla)
+///
+/// @version    V1.5
 ///
 /// @date       13.02.2023
 ///
@@ -21,6 +27,16 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+#if ADC_SIGNAL_CONDITIONING
+// Gefilterter Messwert und Effektivwert von ADCINA0 (in ADC-Digits)
+float adcAFiltered = 0.0f;
+float adcARms = 0.0f;
+// Butterworth-Tiefpass 2. Ordnung, Grenzfrequenz 10 Hz bei 100 Hz Abtastrate
+static DspBiquad adcABiquad = {0.06745527f, 0.13491055f, 0.06745527f,
+															 -1.14298050f, 0.41280160f, 0.0f, 0.0f, 0.0f, 0.0f};
+// Effektivwert ber ADC_RMS_LENGTH Messwerte
+static DspRms adcARmsState = {ADC_RMS_LENGTH, 0, 0.0f, 0.0f};
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -370,6 +386,65 @@ void AdcAInit(uint32_t resolution,
 }
 
 
+#if ADC_OVERSAMPLING
+//=== Function: AdcAInitOversampling ==============================================================
+///
+/// @brief	Funktion konfiguriert ADC_OVERSAMPLING_SOCS_PER_CHANNEL SOCs pro Kanal ab
+///					ADC_OVERSAMPLING_FIRST_SOC, die reihum den Kanlen zugeordnet sind. Alle SOCs
+///					werden vom CPU-Timer 1 alle ADC_OVERSAMPLING_PERIOD_US getriggert, nach der
+///					letzten Wandlung startet ADCINT2 den CLA-Task 5. Es wird kein CPU-Interrupt
+///					ausgelst. Muss nach AdcAInit() und ClaInit() aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcAInitOversampling(void)
+{
+		const uint16_t channels[ADC_OVERSAMPLING_NUMBER_OF_CHANNELS] =
+				{ADC_OVERSAMPLING_CHANNEL_0, ADC_OVERSAMPLING_CHANNEL_1};
+		volatile union ADCSOC0CTL_REG *socCtl;
+		uint16_t lastSoc = ADC_OVERSAMPLING_FIRST_SOC + ADC_OVERSAMPLING_NUMBER_OF_SOCS - 1;
+		uint16_t i;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// SOCs reihum den Kanlen zuordnen (Kanal 0, Kanal 1, Kanal 0, ...), damit die
+		// Messwerte eines Kanals gleichmig ber den Durchlauf verteilt sind. Die
+		// ADCSOCxCTL-Register liegen im Abstand von 2 Adressen hintereinander
+		socCtl = &AdcaRegs.ADCSOC0CTL + ADC_OVERSAMPLING_FIRST_SOC;
+		for (i = 0; i < ADC_OVERSAMPLING_NUMBER_OF_SOCS; i++)
+		{
+				socCtl[i].bit.TRIGSEL = ADC_TRIGGER_CPU1_TIMER1;
+				socCtl[i].bit.CHSEL   = channels[i % ADC_OVERSAMPLING_NUMBER_OF_CHANNELS];
+				socCtl[i].bit.ACQPS   = ADC_OVERSAMPLING_ACQPS;
+		}
+
+		// ADCINT2 nach der Wandlung der letzten SOC auslsen (Trigger fr CLA-Task 5).
+		// Kontinuierliches Auslsen, damit der CLA-Task auch dann gestartet wird, wenn
+		// das Flag noch nicht gelscht wurde
+		AdcaRegs.ADCINTSEL1N2.bit.INT2SEL  = lastSoc;
+		AdcaRegs.ADCINTSEL1N2.bit.INT2CONT = ADC_INT_PULSE_CONTINOUS;
+		AdcaRegs.ADCINTSEL1N2.bit.INT2E    = ADC_INT_ENABLE;
+		AdcaRegs.ADCINTFLGCLR.bit.ADCINT2  = 1;
+
+		// CPU-Timer 1 als Trigger: Periode in SYSCLK-Takten, kein CPU-Interrupt
+		CpuTimer1Regs.TCR.bit.TSS = 1;
+		CpuTimer1Regs.TCR.bit.TIE = 0;
+		CpuTimer1Regs.PRD.all     = (uint32_t)ADC_OVERSAMPLING_PERIOD_US * DEVICE_SYSCLK_MHZ - 1UL;
+		CpuTimer1Regs.TPR.all     = 0;
+		CpuTimer1Regs.TPRH.all    = 0;
+		CpuTimer1Regs.TCR.bit.TRB = 1;
+		CpuTimer1Regs.TCR.bit.TSS = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+#endif
+
+
 //=== Function: AdcInt1ISR ========================================================================
 ///
 /// @brief	ISR wird aufgerufen, wenn ein ADCINT1-Interrupt (Modul A) ausgelst wurde
@@ -381,6 +456,8 @@ void AdcAInit(uint32_t resolution,
 //=================================================================================================
 __interrupt void AdcAInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCA1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -390,10 +467,17 @@ __interrupt void AdcAInt1ISR(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
+#if ADC_SIGNAL_CONDITIONING
+		// Signalaufbereitung mit der Abtastrate des ADC
+		adcAFiltered = DspBiquadRun(&adcABiquad, (float)AdcaResultRegs.ADCRESULT0);
+		adcARms = DspRmsRun(&adcARmsState, (float)AdcaResultRegs.ADCRESULT0);
+#endif
+
     // Interrupt-Flag im ADC-Modul lschen
 		AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCA1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCA1);
 }
 
 
@@ -6,7 +6,13 @@
 ///							eine Spannung gemessen wird. Die Messung wird durch ePWM8 getriggert. Nachdem
 ///							die Messung abgeschlossen ist, wird ein ADC-Interrupt ausgelst.
 ///
-/// @version    V1.3
+///							nderung in Version 1.4: Mit ADC_SIGNAL_CONDITIONING = 1 filtert die ISR jeden
+///							Messwert mit einem Biquad-Tiefpass und berechnet den Effektivwert (myDsp.h)
+///
+///							nderung in Version 1.5: berabtastung langsamer Kanle (ADC_OVERSAMPLING) mit
+///							mehreren SOCs pro Kanal, Summierung und Dezimierung im CLA-Task 5 (myAdcCla.cla)
+///
+/// @version    V1.5
 ///
 /// @date       13.02.2023
 ///
@@ -19,6 +25,8 @@
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
 #include "myPWM.h"
+#include "myProfile.h"
+#include "myDsp.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -194,11 +202,48 @@
 #define ADC_B_INLTRIM_OTP_ADDR_START	((uint32_t *)0x70134)
 #define ADC_C_INLTRIM_OTP_ADDR_START	((uint32_t *)0x70140)
 #define ADC_D_INLTRIM_OTP_ADDR_START	((uint32_t *)0x7014C)
+// Signalaufbereitung in der ISR ein- (1) oder ausschalten (0)
+#define ADC_SIGNAL_CONDITIONING							1
+// Effektivwert ber 100 Messwerte (1 s bei einer Messung alle 10 ms)
+#define ADC_RMS_LENGTH											100
+// berabtastung langsamer Kanle mit CLA-Task 5 ein- (1) oder ausschalten (0)
+#define ADC_OVERSAMPLING										1
+// Anzahl der berabgetasteten Kanle und ihre Eingnge (ADC-A)
+#define ADC_OVERSAMPLING_NUMBER_OF_CHANNELS	2
+#define ADC_OVERSAMPLING_CHANNEL_0					ADC_SINGLE_ENDED_ADCIN2
+#define ADC_OVERSAMPLING_CHANNEL_1					ADC_SINGLE_ENDED_ADCIN3
+// SOCs pro Kanal (2^ADC_OVERSAMPLING_SOCS_LOG2), reihum ab ADC_OVERSAMPLING_FIRST_SOC
+// (SOC0 bleibt fr die Messung an ADCIN0 durch ePWM8)
+#define ADC_OVERSAMPLING_SOCS_LOG2					2
+#define ADC_OVERSAMPLING_SOCS_PER_CHANNEL		(1U << ADC_OVERSAMPLING_SOCS_LOG2)
+#define ADC_OVERSAMPLING_NUMBER_OF_SOCS			(ADC_OVERSAMPLING_SOCS_PER_CHANNEL * ADC_OVERSAMPLING_NUMBER_OF_CHANNELS)
+#define ADC_OVERSAMPLING_FIRST_SOC					ADC_SOC_NUMBER_4
+// Dezimierungsfaktor: Anzahl der Durchlufe pro Ergebnis (2^ADC_OVERSAMPLING_RATIO_LOG2)
+#define ADC_OVERSAMPLING_RATIO_LOG2					4
+// Messwerte pro Ergebnis (2^ADC_OVERSAMPLING_SAMPLES_LOG2) und zustzliche Bits
+// (je Faktor 4 an Messwerten ein zustzliches Bit, bei weiem Rauschen)
+#define ADC_OVERSAMPLING_SAMPLES_LOG2				(ADC_OVERSAMPLING_SOCS_LOG2 + ADC_OVERSAMPLING_RATIO_LOG2)
+#define ADC_OVERSAMPLING_EXTRA_BITS					(ADC_OVERSAMPLING_SAMPLES_LOG2 / 2)
+// Abstand zweier Durchlufe in us (CPU-Timer 1) und Abtastzeitfenster in SYSCLK-Takten
+#define ADC_OVERSAMPLING_PERIOD_US					100
+#define ADC_OVERSAMPLING_ACQPS							59
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+#if ADC_SIGNAL_CONDITIONING
+// Gefilterter Messwert und Effektivwert von ADCINA0 (in ADC-Digits)
+extern float adcAFiltered;
+extern float adcARms;
+#endif
+#if ADC_OVERSAMPLING
+// Ergebnisse der berabtastung mit ADC_OVERSAMPLING_EXTRA_BITS zustzlichen Bits und
+// Anzahl der Ergebnisse. Die Variablen werden in der main.c dem CLA-zu-CPU
+// Message-RAM zugeordnet
+extern uint32_t adcOversampled[ADC_OVERSAMPLING_NUMBER_OF_CHANNELS];
+extern uint32_t adcOversamplingCount;
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -215,6 +260,15 @@ extern void AdcAInit(uint32_t resolution,
 										 uint32_t signalMode);
 // Interrupt-Service-Routine fr den ADCINT1 (Modul A)
 __interrupt void AdcAInt1ISR(void);
+#if ADC_OVERSAMPLING
+// Funktion konfiguriert die SOCs der berabtastung, ADCINT2 und den CPU-Timer 1
+extern void AdcAInitOversampling(void);
+// CLA-Funktionen (myAdcCla.cla)
+// Funktion setzt die Summen und Ergebnisse der berabtastung zurck
+extern void AdcOversamplingReset(void);
+// CLA-Task 5. Summiert und dezimiert die Messwerte der berabtastung
+__interrupt void ClaTask5(void);
+#endif
 
 
 #endif
@@ -0,0 +1,198 @@
+//=================================================================================================
+/// @file       myAdcRedundancy.c
+///
+/// @brief      Datei enthlt die Initialisierung der redundanten Messung mit ADC-A und ADC-B und
+///							die Fehlerreaktion der CPU (siehe myAdcRedundancy.h). Nach AdcRedundancyInit()
+///							ist die CPU nur noch bei einem neuen Fehler beteiligt.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myAdcRedundancy.h"
+
+
+#if ADC_REDUNDANCY_ENABLE
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile uint16_t adcRedundancyFaultInterrupts = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcRedundancyInitModule ===========================================================
+///
+/// @brief  Funktion konfiguriert die SOC "soc" eines Moduls fr die redundante Messung (Trigger
+///					CPU-Timer 0, hohe Prioritt) und PPB2 als Bereichsprfung dieser SOC. Die Flags
+///					der Bereichsprfung werden gesetzt, wenn der Messwert ber
+///					ADC_REDUNDANCY_LIMIT_HIGH oder unter ADC_REDUNDANCY_LIMIT_LOW liegt
+///
+/// @param  volatile struct ADC_REGS *adc, uint16_t soc
+///
+/// @return void
+///
+//=================================================================================================
+static void AdcRedundancyInitModule(volatile struct ADC_REGS *adc, uint16_t soc)
+{
+		// Die ADCSOCxCTL-Register liegen im Abstand von 2 Adressen hintereinander
+		volatile union ADCSOC0CTL_REG *socCtl = &adc->ADCSOC0CTL + soc;
+
+		socCtl->bit.TRIGSEL = ADC_TRIGGER_CPU1_TIMER0;
+		socCtl->bit.CHSEL   = ADC_REDUNDANCY_CHANNEL;
+		socCtl->bit.ACQPS   = ADC_REDUNDANCY_ACQPS;
+		// SOC0 ... soc haben hohe Prioritt und werden vor den SOCs im Round Robin gewandelt.
+		// Eine bereits laufende Wandlung wird nicht abgebrochen
+		// (siehe S. 2532 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		adc->ADCSOCPRICTL.bit.SOCPRIORITY = soc + 1;
+
+		// PPB2 gehrt zu "soc". Kein Offset, Referenz 0: PPB-Ergebnis = Messwert
+		adc->ADCPPB2CONFIG.bit.CONFIG  = soc;
+		adc->ADCPPB2OFFCAL.bit.OFFCAL  = 0;
+		adc->ADCPPB2OFFREF             = 0;
+		adc->ADCPPB2TRIPHI.bit.LIMITHI = ADC_REDUNDANCY_LIMIT_HIGH;
+		adc->ADCPPB2TRIPLO.bit.LIMITLO = ADC_REDUNDANCY_LIMIT_LOW;
+		// Keine Events an die ePWM-X-Bar und keine Event-Interrupts, der CLA-Task liest
+		// die Flags direkt
+		adc->ADCEVTSEL.bit.PPB2TRIPHI    = 0;
+		adc->ADCEVTSEL.bit.PPB2TRIPLO    = 0;
+		adc->ADCEVTINTSEL.bit.PPB2TRIPHI = 0;
+		adc->ADCEVTINTSEL.bit.PPB2TRIPLO = 0;
+		adc->ADCEVTCLR.bit.PPB2TRIPHI    = 1;
+		adc->ADCEVTCLR.bit.PPB2TRIPLO    = 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AdcRedundancyInit =================================================================
+///
+/// @brief  Funktion setzt die Startwerte, konfiguriert die SOCs und PPB2 von ADC-A und ADC-B,
+///					ADCINT3 des ADC-B (Trigger des CLA-Tasks 2) und startet den CPU-Timer 0 als
+///					gemeinsamen Trigger. ADC-B wird eingeschaltet, falls die Regelkette
+///					(CLA_PIPELINE_ENABLE) ausgeschaltet ist. Muss nach AdcAInit(), ClaInit() und
+///					ClaPipelineInit() aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcRedundancyInit(void)
+{
+		// Startwerte (das Message-RAM wurde von ClaInit() gelscht)
+		adcRedundancyInput.threshold = ADC_REDUNDANCY_THRESHOLD;
+		adcRedundancyInput.debounce  = ADC_REDUNDANCY_DEBOUNCE;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// ADC-B einschalten, falls er nicht schon von der Regelkette verwendet wird
+		if (AdcbRegs.ADCCTL1.bit.ADCPWDNZ == ADC_POWER_OFF)
+		{
+				CpuSysRegs.PCLKCR13.bit.ADC_B = 1;
+				__asm(" RPT #4 || NOP");
+				AdcbRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
+				AdcbRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
+				AdcbRegs.ADCCTL2.bit.RESOLUTION = ADC_RESOLUTION_12_BIT;
+				AdcbRegs.ADCCTL2.bit.SIGNALMODE = ADC_SINGLE_ENDED_MODE;
+				AdcInitTrimRegister(ADC_MODULE_B,
+														ADC_RESOLUTION_12_BIT,
+														ADC_SINGLE_ENDED_MODE);
+				AdcbRegs.ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+				// (siehe "Power Up Time" S. 139 Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
+				DELAY_US(500);
+		}
+
+		AdcRedundancyInitModule(&AdcaRegs, ADC_REDUNDANCY_SOC_A);
+		AdcRedundancyInitModule(&AdcbRegs, ADC_REDUNDANCY_SOC_B);
+
+		// ADCINT3 des ADC-B nach der Wandlung der redundanten SOC (Trigger fr CLA-Task 2),
+		// kontinuierlich, damit der Task auch bei noch nicht gelschtem Flag gestartet wird
+		AdcbRegs.ADCINTSEL3N4.bit.INT3SEL  = ADC_REDUNDANCY_SOC_B;
+		AdcbRegs.ADCINTSEL3N4.bit.INT3CONT = ADC_INT_PULSE_CONTINOUS;
+		AdcbRegs.ADCINTSEL3N4.bit.INT3E    = ADC_INT_ENABLE;
+		AdcbRegs.ADCINTFLGCLR.bit.ADCINT3  = 1;
+
+#if ADC_REDUNDANCY_TRIP_PWM1
+		// Beide Ausgnge von ePWM1 beim One-Shot-Trip auf low setzen (AdcRedundancyFaultISR())
+		EPwm1Regs.TZCTL.bit.TZA = PWM_TZ_FORCE_LO;
+		EPwm1Regs.TZCTL.bit.TZB = PWM_TZ_FORCE_LO;
+#endif
+
+		// CPU-Timer 0 als gemeinsamer Trigger: Periode in SYSCLK-Takten, kein CPU-Interrupt
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 0;
+		CpuTimer0Regs.PRD.all     = (uint32_t)ADC_REDUNDANCY_PERIOD_US * DEVICE_SYSCLK_MHZ - 1UL;
+		CpuTimer0Regs.TPR.all     = 0;
+		CpuTimer0Regs.TPRH.all    = 0;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		CpuTimer0Regs.TCR.bit.TSS = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: AdcRedundancyClearFault ===========================================================
+///
+/// @brief  Funktion fordert das Lschen der gespeicherten Fehler an (wird vom nchsten Durchlauf
+///					des CLA-Tasks 2 ausgefhrt) und gibt ePWM1 wieder frei. Besteht der Fehler weiter,
+///					wird er mit dem nchsten Messwertpaar erneut gemeldet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AdcRedundancyClearFault(void)
+{
+		adcRedundancyInput.clear++;
+
+#if ADC_REDUNDANCY_TRIP_PWM1
+		// Warten, bis der CLA die Anforderung bernommen hat (hchstens eine Abtastperiode)
+		while (adcRedundancyOutput.clear != adcRedundancyInput.clear);
+		EALLOW;
+		EPwm1Regs.TZCLR.bit.OST = 1;
+		EPwm1Regs.TZCLR.bit.INT = 1;
+		EDIS;
+#endif
+}
+
+
+//=== Function: AdcRedundancyFaultISR =============================================================
+///
+/// @brief	ISR wird aufgerufen, wenn der CLA-Task 2 ein neues Fehlerbit gesetzt hat
+///					(Cla1OnlyRegs.SOFTINTFRC.bit.TASK2 = 1). Schaltet ePWM1 ab
+///					(ADC_REDUNDANCY_TRIP_PWM1), die Fehlerursache steht in "adcRedundancyOutput"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void AdcRedundancyFaultISR(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_CLA_TASK2);
+
+#if ADC_REDUNDANCY_TRIP_PWM1
+		// Sicherer Zustand: Ausgnge von ePWM1 ber einen One-Shot-Trip abschalten
+		EALLOW;
+		EPwm1Regs.TZFRC.bit.OST = 1;
+		EDIS;
+#endif
+		// Interrupt zhlen
+		adcRedundancyFaultInterrupts++;
+
+		// Interrupt-Flag der Gruppe 11 lschen (da gehrt der CLA1_2_INT-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK11 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_CLA_TASK2);
+}
+#endif
@@ -0,0 +1,135 @@
+//=================================================================================================
+/// @file       myAdcRedundancy.h
+///
+/// @brief      Datei enthlt eine redundante Messung fr sicherheitsrelevante Signale. Der Eingang
+///							ADC_REDUNDANCY_CHANNEL (ADCIN14, beim TMS320F2838x mit allen vier ADC-Modulen
+///							verbunden) wird von ADC-A (SOC ADC_REDUNDANCY_SOC_A) und ADC-B (SOC
+///							ADC_REDUNDANCY_SOC_B) beim selben Trigger (CPU-Timer 0) gleichzeitig gewandelt.
+///							Die Prfung luft ohne einen Befehl der CPU pro Messwert:
+///							- Der Post-Processing-Block 2 jedes Moduls vergleicht seinen Messwert in Hardware
+///							  mit dem zulssigen Bereich ADC_REDUNDANCY_LIMIT_LOW ... ADC_REDUNDANCY_LIMIT_HIGH
+///							  (z.B. Kurzschluss auf VREFLO/VREFHI) und speichert eine Verletzung in ADCEVTSTAT
+///							- Das EOC des ADC-B lst ADCINT3 aus, der CLA-Task 2 startet. Der Task vergleicht
+///							  die beiden Messwerte und zhlt, wie oft ihre Differenz die Schwelle aus
+///							  "adcRedundancyInput.threshold" berschreitet. Nach "debounce" aufeinander
+///							  folgenden berschreitungen oder bei einer Bereichsverletzung eines PPB wird der
+///							  Fehler in "adcRedundancyOutput.fault" gespeichert
+///							- Nur beim Setzen eines neuen Fehlerbits lst der Task den CPU-Interrupt CLA1_2_INT
+///							  aus (SOFTINTEN/SOFTINTFRC), AdcRedundancyFaultISR() schaltet optional ePWM1 ab
+///							Die Module sind nicht exakt gleichzeitig, wenn ein Modul beim Trigger bereits eine
+///							andere SOC wandelt. Die SOCs der redundanten Messung haben daher hohe Prioritt
+///							(ADCSOCPRICTL), der Versatz ist hchstens eine Wandlung (ca. 0,5 s). Die Schwelle
+///							muss die Signalnderung in dieser Zeit sowie die Offset- und Verstrkungsfehler
+///							beider Module enthalten.
+///							Benutzt den CLA-Task 2, der bei eingeschalteter Stromregelung (CLA_CONTROL_ENABLE)
+///							frei ist.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYADCREDUNDANCY_H_
+#define MYADCREDUNDANCY_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCLA.h"
+#include "myClaControl.h"
+#include "myADC.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Redundante Messung mit ADC-A und ADC-B im CLA-Task 2 ein- (1) oder ausschalten (0)
+#define ADC_REDUNDANCY_ENABLE								1
+// Gemeinsamer Eingang und SOCs der Module (ADC-A: SOC0 Stromregelung, SOC4 ... 11
+// berabtastung; ADC-B: SOC0 ... 4 Regelkette)
+#define ADC_REDUNDANCY_CHANNEL							ADC_SINGLE_ENDED_ADCIN14
+#define ADC_REDUNDANCY_SOC_A								ADC_SOC_NUMBER_1
+#define ADC_REDUNDANCY_SOC_B								ADC_SOC_NUMBER_5
+// Abtastzeitfenster 60 (SYSCLK-)Taktzyklen = 300 ns (in beiden Modulen gleich)
+#define ADC_REDUNDANCY_ACQPS								59
+// Abtastperiode in us (CPU-Timer 0)
+#define ADC_REDUNDANCY_PERIOD_US						50
+// Triggerquelle des CLA-Tasks 2 (EOC der SOC des ADC-B)
+#define ADC_REDUNDANCY_TRIGGER							CLA_TASK_TRIGGER_ADCB_INT3
+// Startwerte: max. Differenz in LSB und Anzahl aufeinander folgender berschreitungen
+#define ADC_REDUNDANCY_THRESHOLD						40
+#define ADC_REDUNDANCY_DEBOUNCE							3
+// Zulssiger Bereich der Messwerte (Prfung in Hardware durch PPB2, 12 Bit)
+#define ADC_REDUNDANCY_LIMIT_LOW						16
+#define ADC_REDUNDANCY_LIMIT_HIGH						4079
+// ePWM1-Ausgang bei einem Fehler abschalten (One-Shot-Trip, 1) oder nur melden (0)
+#define ADC_REDUNDANCY_TRIP_PWM1						1
+// Fehlerbits in "adcRedundancyOutput.fault"
+#define ADC_REDUNDANCY_FAULT_DIVERGENCE			0x0001
+#define ADC_REDUNDANCY_FAULT_RANGE_A				0x0002
+#define ADC_REDUNDANCY_FAULT_RANGE_B				0x0004
+
+#if ADC_REDUNDANCY_ENABLE && !CLA_CONTROL_ENABLE
+#error "ADC_REDUNDANCY_ENABLE bentigt CLA_CONTROL_ENABLE (CLA-Task 2 ist sonst belegt)"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Daten von der CPU an den CLA (CPU-zu-CLA Message-RAM)
+typedef struct
+{
+		uint16_t threshold;						// max. Differenz der Messwerte in LSB
+		uint16_t debounce;						// berschreitungen in Folge bis zum Fehler (mind. 1)
+		uint16_t clear;								// nderung lscht die Fehler und Min./Max.-Werte
+} AdcRedundancyInput;
+
+// Daten vom CLA an die CPU (CLA-zu-CPU Message-RAM)
+typedef struct
+{
+		uint32_t samples;							// Anzahl der verglichenen Messwertpaare
+		uint32_t divergences;					// Anzahl der Paare mit Differenz > threshold
+		uint16_t resultA;							// letzte Messwerte
+		uint16_t resultB;
+		uint16_t differenceLast;			// Betrag der letzten Differenz in LSB
+		uint16_t differenceMax;				// grter Betrag seit dem letzten Lschen
+		uint16_t fault;								// ADC_REDUNDANCY_FAULT_x (bis zum Lschen gespeichert)
+		uint16_t faultResultA;				// Messwerte beim ersten Fehler
+		uint16_t faultResultB;
+		uint16_t clear;								// zuletzt bernommener Wert von "clear"
+} AdcRedundancyOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Die folgenden Variablen werden in der main.c mit einem #pragma-Befehl dem
+// entsprechenden Message-RAM zugeordnet
+// Schwelle und Lschanforderung (CPU-zu-CLA Message-RAM)
+extern AdcRedundancyInput adcRedundancyInput;
+// Messwerte, Statistik und Fehler (CLA-zu-CPU Message-RAM)
+extern AdcRedundancyOutput adcRedundancyOutput;
+// Anzahl der Fehler-Interrupts (CPU)
+extern volatile uint16_t adcRedundancyFaultInterrupts;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Funktionen (myAdcRedundancy.cla)
+// Funktion setzt die Zustnde der redundanten Messung zurck (wird von CLA-Task 1 aufgerufen)
+extern void AdcRedundancyReset(void);
+// CLA-Task 2. Vergleicht die Messwerte von ADC-A und ADC-B
+__interrupt void ClaTask2Redundancy(void);
+
+// CPU-Funktionen (myAdcRedundancy.c)
+// Funktion konfiguriert die SOCs, PPB2 beider Module und den CPU-Timer 0 und startet die Messung
+extern void AdcRedundancyInit(void);
+// Funktion lscht die gespeicherten Fehler (und gibt ePWM1 wieder frei)
+extern void AdcRedundancyClearFault(void);
+// Interrupt-Service-Routine fr den CLA-Task 2 (nur bei einem neuen Fehler)
+__interrupt void AdcRedundancyFaultISR(void);
+
+
+#endif
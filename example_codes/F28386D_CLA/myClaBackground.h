@@ -0,0 +1,79 @@
+//=================================================================================================
+/// @file       myClaBackground.h
+///
+/// @brief      Datei enthlt den Hintergrund-Task des CLA-Moduls (CLA Typ 2). Der Hintergrund-Task
+///							ist eine Dauerschleife mit der niedrigsten Prioritt, die von jedem getriggerten
+///							Task (z.B. der Stromregelung in Task 4 oder der berabtastung in Task 5)
+///							unterbrochen und danach fortgesetzt wird. Er wertet die Messwerte der
+///							Stromregelung aus, ohne die CPU zu belasten: Mittelwert, Minimum und Maximum des
+///							gefilterten Messwerts sowie der quadratische Mittelwert der Regelabweichung ber
+///							jeweils 2^CLA_BACKGROUND_WINDOW_LOG2 Abtastschritte. Die Ergebnisse stehen in
+///							"claBackgroundOutput" (CLA-zu-CPU Message-RAM). Der Hintergrund-Task verwendet
+///							die Ressourcen von Task 8 und wird daher erst nach der Laufzeitmessung der
+///							DSP-Kernels (Task 8) mit ClaBackgroundStart() gestartet. Die Compiler-Option
+///							--cla_background_task muss eingeschaltet sein.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCLABACKGROUND_H_
+#define MYCLABACKGROUND_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myClaControl.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Hintergrund-Task ein- (1) oder ausschalten (0). Bentigt die Stromregelung und deren
+// Laufzeitmessung (CLA_CONTROL_ENABLE, CLA_CONTROL_TRACE_ENABLE)
+#define CLA_BACKGROUND_ENABLE								1
+// Anzahl der Abtastschritte pro Auswertung (2^CLA_BACKGROUND_WINDOW_LOG2)
+#define CLA_BACKGROUND_WINDOW_LOG2					10
+#define CLA_BACKGROUND_WINDOW								(1UL << CLA_BACKGROUND_WINDOW_LOG2)
+
+#if CLA_BACKGROUND_ENABLE && !(CLA_CONTROL_ENABLE && CLA_CONTROL_TRACE_ENABLE)
+#error "CLA_BACKGROUND_ENABLE bentigt CLA_CONTROL_ENABLE und CLA_CONTROL_TRACE_ENABLE"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse des Hintergrund-Tasks (CLA-zu-CPU Message-RAM)
+typedef struct
+{
+		float measurementMean;				// Mittelwert des gefilterten Messwerts
+		float measurementMin;					// Minimum des gefilterten Messwerts
+		float measurementMax;					// Maximum des gefilterten Messwerts
+		float errorMeanSquare;				// quadratischer Mittelwert der Regelabweichung
+		uint32_t windows;							// Anzahl der Auswertungen (wird zuletzt geschrieben)
+		uint32_t missed;							// Abtastschritte, die der Hintergrund-Task verpasst hat
+		uint32_t loops;								// Durchlufe der Schleife (Lebenszeichen)
+} ClaBackgroundOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Wird in der main.c mit einem #pragma-Befehl dem CLA-zu-CPU Message-RAM zugeordnet
+extern ClaBackgroundOutput claBackgroundOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Hintergrund-Task (myClaBackground.cla), Dauerschleife mit der niedrigsten Prioritt
+__attribute__((interrupt("background"))) void ClaBackgroundTask(void);
+
+// CPU-Funktion (main.c)
+// Funktion startet den Hintergrund-Task nach dem Ende von Task 8
+extern void ClaBackgroundStart(void);
+
+
+#endif
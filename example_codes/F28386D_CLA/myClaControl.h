@@ -0,0 +1,188 @@
+//=================================================================================================
+/// @file       myClaControl.h
+///
+/// @brief      Datei enthlt ein Rahmenwerk fr Regelungen, die vollstndig im CLA-Modul eines
+///							TMS320F2838x laufen. Ein CLA-Task wird direkt vom ADC (End of Conversion,
+///							CLA_TASK_TRIGGER_ADCx_INTy) gestartet, liest den Messwert, filtert ihn, fhrt
+///							den Regler aus und schreibt das Ergebnis in das ePWM-Modul, ohne dass die CPU
+///							(C28-Kern) beteiligt ist. Sollwert und Parameter bergibt die CPU ber das
+///							Struct "ClaControlInput" (CPU-zu-CLA Message-RAM), Messwert, Stellgre und
+///							Laufzeit gibt der CLA ber das Struct "ClaControlOutput" (CLA-zu-CPU Message-
+///							RAM) zurck. Als Bausteine stehen ein PI- und ein PID-Regler mit Begrenzung
+///							(Anti-Windup) sowie ein Tiefpass 1. Ordnung und ein Biquad-Filter zur
+///							Verfgung (myClaControl.cla). Die Laufzeit jedes Tasks wird mit dem
+///							freilaufenden Zhler von eCAP1 (SYSCLK, 5 ns pro Takt) gemessen, da der CLA
+///							keinen Zugriff auf die CPU-Timer hat.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCLACONTROL_H_
+#define MYCLACONTROL_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCLA.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Stromregelung im CLA-Task 4 ein- (1) oder ausschalten (0). Ist die Regelung eingeschaltet,
+// bernimmt Task 4 den ADC-Trigger und das ePWM1-Modul von Task 2
+#define CLA_CONTROL_ENABLE									1
+// Triggerquelle des Regel-Tasks (End of Conversion von SOC0 des ADC-A, siehe myADC.c)
+#define CLA_CONTROL_TRIGGER									CLA_TASK_TRIGGER_ADCA_INT1
+// Laufzeitmessung der Regel-Tasks ein- (1) oder ausschalten (0)
+#define CLA_CONTROL_TRACE_ENABLE						1
+// Startwerte der Regelung (Messwert und Sollwert in A, Stellgre als Tastverhltnis 0 ... 1)
+#define CLA_CONTROL_ADC_SCALE								(10.0f / 4096.0f)
+#define CLA_CONTROL_PWM_SCALE								500.0f
+#define CLA_CONTROL_KP											0.05f
+#define CLA_CONTROL_KI											0.005f
+#define CLA_CONTROL_FILTER_COEFFICIENT			0.5f
+#define CLA_CONTROL_OUTPUT_MIN							0.0f
+#define CLA_CONTROL_OUTPUT_MAX							0.95f
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel in Takten (Zhler von eCAP1, wird von ClaControlInit() gestartet)
+#define CLA_CONTROL_TIMESTAMP()							(ECap1Regs.TSCTR)
+#if CLA_CONTROL_TRACE_ENABLE
+// Am Anfang des CLA-Tasks aufrufen (legt die lokale Variable "traceStart" an)
+#define CLA_CONTROL_TRACE_START()						uint32_t traceStart = CLA_CONTROL_TIMESTAMP()
+// Am Ende des CLA-Tasks aufrufen, schreibt die Laufzeit in "trace"
+#define CLA_CONTROL_TRACE_STOP(trace)				ClaTraceStop(&(trace), traceStart)
+#else
+#define CLA_CONTROL_TRACE_START()
+#define CLA_CONTROL_TRACE_STOP(trace)
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Es drfen nur Datentypen mit fester Breite verwendet werden, damit CPU und CLA
+// den gleichen Aufbau der Structs sehen (CPU und CLA haben unterschiedliche Compiler)
+// PI-Regler mit Begrenzung der Stellgre
+typedef struct
+{
+		float kp;											// Proportionalbeiwert
+		float ki;											// Integralbeiwert (pro Abtastschritt)
+		float outputMin;							// untere Grenze der Stellgre
+		float outputMax;							// obere Grenze der Stellgre
+		float integral;								// Zustand des Integrators
+} ClaPi;
+
+// PID-Regler mit Begrenzung der Stellgre
+typedef struct
+{
+		float kp;											// Proportionalbeiwert
+		float ki;											// Integralbeiwert (pro Abtastschritt)
+		float kd;											// Differenzialbeiwert (pro Abtastschritt)
+		float outputMin;							// untere Grenze der Stellgre
+		float outputMax;							// obere Grenze der Stellgre
+		float integral;								// Zustand des Integrators
+		float lastError;							// Regelabweichung des letzten Abtastschritts
+} ClaPid;
+
+// Tiefpass 1. Ordnung: y = y + coefficient * (x - y)
+typedef struct
+{
+		float coefficient;						// 0 ... 1 (1: keine Filterung)
+		float state;									// letzter Ausgangswert
+} ClaLowPass;
+
+// Biquad-Filter (IIR 2. Ordnung, Direktform I, a0 = 1)
+typedef struct
+{
+		float b0;
+		float b1;
+		float b2;
+		float a1;
+		float a2;
+		float x1;											// Eingangswerte der letzten zwei Abtastschritte
+		float x2;
+		float y1;											// Ausgangswerte der letzten zwei Abtastschritte
+		float y2;
+} ClaBiquad;
+
+// Laufzeitmessung eines CLA-Tasks (alle Zeiten in Takten)
+typedef struct
+{
+		uint32_t count;								// Anzahl an Durchlufen
+		uint32_t cyclesLast;					// Laufzeit des letzten Durchlaufs
+		uint32_t cyclesMax;						// maximale Laufzeit
+} ClaTrace;
+
+// Daten von der CPU an den CLA (CPU-zu-CLA Message-RAM)
+typedef struct
+{
+		float reference;							// Sollwert
+		float kp;
+		float ki;
+		float filterCoefficient;
+		float outputMin;
+		float outputMax;
+		float adcScale;								// Umrechnung ADC-Wert -> Messwert
+		float pwmScale;								// Umrechnung Stellgre -> CMPA
+		uint16_t enable;							// 0: Regelung aus (Tastverhltnis 0), 1: Regelung ein
+		uint16_t reset;								// Zustnde zurcksetzen, wenn sich der Wert ndert
+} ClaCpuToClaMsg;
+
+// Daten vom CLA an die CPU (CLA-zu-CPU Message-RAM)
+typedef struct
+{
+		float measurement;						// gefilterter Messwert
+		float error;									// Regelabweichung
+		float output;									// Stellgre
+		uint16_t reset;								// zuletzt bernommener Wert von "reset"
+		ClaTrace trace;								// Laufzeit des Regel-Tasks
+} ClaClaToCpuMsg;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Die folgenden Variablen werden in der main.c mit einem #pragma-Befehl dem
+// entsprechenden Message-RAM zugeordnet (siehe "cpuToCla" und "claToCpu")
+extern ClaCpuToClaMsg claControlInput;
+extern ClaClaToCpuMsg claControlOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Funktionen (myClaControl.cla), knnen nur von CLA-Tasks aufgerufen werden
+// Funktion setzt den Zustand eines PI-Reglers zurck
+extern void ClaPiReset(ClaPi *pi);
+// Funktion fhrt einen Abtastschritt des PI-Reglers aus und gibt die Stellgre zurck
+extern float ClaPiRun(ClaPi *pi, float error);
+// Funktion setzt den Zustand eines PID-Reglers zurck
+extern void ClaPidReset(ClaPid *pid);
+// Funktion fhrt einen Abtastschritt des PID-Reglers aus und gibt die Stellgre zurck
+extern float ClaPidRun(ClaPid *pid, float error);
+// Funktion fhrt einen Abtastschritt des Tiefpasses aus und gibt den Ausgangswert zurck
+extern float ClaLowPassRun(ClaLowPass *filter, float input);
+// Funktion setzt den Zustand eines Biquad-Filters zurck
+extern void ClaBiquadReset(ClaBiquad *filter);
+// Funktion fhrt einen Abtastschritt des Biquad-Filters aus und gibt den Ausgangswert zurck
+extern float ClaBiquadRun(ClaBiquad *filter, float input);
+// Funktion wird von CLA_CONTROL_TRACE_STOP() aufgerufen
+extern void ClaTraceStop(ClaTrace *trace, uint32_t start);
+// Funktion setzt die Zustnde der Stromregelung zurck (wird von CLA-Task 1 aufgerufen)
+extern void ClaControlReset(void);
+// CLA-Task 4. Stromregelung, wird bei jedem Messwert vom ADC gestartet
+__interrupt void ClaTask4(void);
+
+// CPU-Funktion (main.c)
+// Funktion startet die Zeitbasis der Laufzeitmessung und setzt die Startwerte der Regelung
+extern void ClaControlInit(void);
+
+
+#endif
@@ -0,0 +1,234 @@
+//=================================================================================================
+/// @file       myClaFoc.c
+///
+/// @brief      Datei enthlt die Initialisierung der feldorientierten Regelung ePWM4 -> ADC-C/D
+///							-> CLA-Task 7 -> ePWM4 ... 6 (siehe myClaFoc.h). Nach ClaFocInit() luft jeder
+///							Abtastschritt ohne CPU-Interrupt und ohne einen Befehl der CPU ab.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myClaFoc.h"
+
+
+#if CLA_FOC_ENABLE
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaFocInitPwmModule ===============================================================
+///
+/// @brief  Funktion initialisiert ein ePWM-Modul einer Halbbrcke: hoch-runter zhlen mit
+///					CLA_FOC_PWM_PERIOD, CMPA wird beim Zhlerstand 0 aus dem Schattenregister bernommen.
+///					EPWMxA (High-Side) ist eingeschaltet, solange TBCTR > CMPA, EPWMxB (Low-Side) ist
+///					komplementr dazu mit CLA_FOC_DEAD_BAND an beiden Flanken
+///
+/// @param  volatile struct EPWM_REGS *pwm
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaFocInitPwmModule(volatile struct EPWM_REGS *pwm)
+{
+		// TBCLK = EPWMCLK = 100 MHz
+		pwm->TBCTL.bit.CLKDIV    = PWM_CLK_DIV_1;
+		pwm->TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_1;
+		pwm->TBCTL.bit.CTRMODE   = PWM_TB_COUNT_UPDOWN;
+		pwm->TBCTL.bit.PRDLD     = PWM_TB_IMMEDIATE;
+		pwm->TBPRD               = CLA_FOC_PWM_PERIOD;
+		// CLA-Task 7 schreibt in das Schattenregister, bernahme beim Zhlerstand 0
+		// (gleichzeitig mit dem nchsten SOCA). Startwert: High-Side aus
+		pwm->CMPCTL.bit.SHDWAMODE = PWM_CC_SHADOW;
+		pwm->CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
+		pwm->CMPA.bit.CMPA        = CLA_FOC_PWM_PERIOD;
+		pwm->AQCTLA.bit.CAU       = PWM_AQ_SET;
+		pwm->AQCTLA.bit.CAD       = PWM_AQ_CLEAR;
+		// Komplementre Ausgnge mit Totzeit (Active High Complementary)
+		pwm->DBCTL.bit.IN_MODE  = PWM_DB_IN_A_ALL;
+		pwm->DBCTL.bit.POLSEL   = PWM_DB_POL_B_INV;
+		pwm->DBCTL.bit.OUT_MODE = PWM_DB_NONE_BYPASSED;
+		pwm->DBRED.bit.DBRED    = CLA_FOC_DEAD_BAND;
+		pwm->DBFED.bit.DBFED    = CLA_FOC_DEAD_BAND;
+		pwm->TBCTR = 0;
+}
+
+
+//=== Function: ClaFocInitPwm =====================================================================
+///
+/// @brief  Funktion initialisiert ePWM4 ... 6 fr die drei Halbbrcken. ePWM4 gibt beim
+///					Zhlerstand 0 den Synchronisationsimpuls fr ePWM5 und ePWM6 aus und lst SOCA aus
+///					(Mitte des Nullzeigers, alle Low-Side-Schalter ein). GPIO 6 ... 11 geben die
+///					Signale aus
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaFocInitPwm(void)
+{
+		// Synchronisierungstakt whrend der Konfiguration ausschalten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+		// Takt fr die PWM-Module 4 ... 6 einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR2.bit.EPWM4 = 1;
+		CpuSysRegs.PCLKCR2.bit.EPWM5 = 1;
+		CpuSysRegs.PCLKCR2.bit.EPWM6 = 1;
+		__asm(" RPT #4 || NOP");
+
+		ClaFocInitPwmModule(&EPwm4Regs);
+		ClaFocInitPwmModule(&EPwm5Regs);
+		ClaFocInitPwmModule(&EPwm6Regs);
+
+		// ePWM4 ist Zeitgeber: Synchronisationsimpuls und SOCA bei jedem Zhlerstand 0
+		EPwm4Regs.TBCTL.bit.PHSEN        = PWM_TB_PHSEN_DISABLE;
+		EPwm4Regs.EPWMSYNCOUTEN.bit.ZEROEN = 1;
+		EPwm4Regs.ETSEL.bit.SOCASEL = PWM_ET_CTR_ZERO;
+		EPwm4Regs.ETPS.bit.SOCAPRD  = PWM_ET_1ST;
+		EPwm4Regs.ETSEL.bit.SOCAEN  = PWM_ET_SOC_ENABLE;
+		// ePWM5 und ePWM6 laden beim Synchronisationsimpuls den Zhlerstand 0 und zhlen hoch
+		EPwm5Regs.EPWMSYNCINSEL.bit.SEL = PWM_TB_SYNCIN_EPWM4_SYNCOUT;
+		EPwm5Regs.TBCTL.bit.PHSEN       = PWM_TB_PHSEN_ENABLE;
+		EPwm5Regs.TBCTL.bit.PHSDIR      = 1;
+		EPwm5Regs.TBPHS.bit.TBPHS       = 0;
+		EPwm6Regs.EPWMSYNCINSEL.bit.SEL = PWM_TB_SYNCIN_EPWM4_SYNCOUT;
+		EPwm6Regs.TBCTL.bit.PHSEN       = PWM_TB_PHSEN_ENABLE;
+		EPwm6Regs.TBCTL.bit.PHSDIR      = 1;
+		EPwm6Regs.TBPHS.bit.TBPHS       = 0;
+
+		// GPIO 6 ... 11 auf PWM-Funktionalitt (EPWM4A/B ... EPWM6A/B) setzen,
+		// Pull-Up-Widerstnde deaktivieren
+		// (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		GpioCtrlRegs.GPALOCK.bit.GPIO6   = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO7   = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO8   = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO9   = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO10  = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO11  = 0;
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO6  = (0x01 >> 2);
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO7  = (0x01 >> 2);
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO8  = (0x01 >> 2);
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO9  = (0x01 >> 2);
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO10 = (0x01 >> 2);
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO11 = (0x01 >> 2);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO6   = (0x01 & 0x03);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO7   = (0x01 & 0x03);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO8   = (0x01 & 0x03);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO9   = (0x01 & 0x03);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO10  = (0x01 & 0x03);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO11  = (0x01 & 0x03);
+		GpioCtrlRegs.GPAPUD.bit.GPIO6    = 1;
+		GpioCtrlRegs.GPAPUD.bit.GPIO7    = 1;
+		GpioCtrlRegs.GPAPUD.bit.GPIO8    = 1;
+		GpioCtrlRegs.GPAPUD.bit.GPIO9    = 1;
+		GpioCtrlRegs.GPAPUD.bit.GPIO10   = 1;
+		GpioCtrlRegs.GPAPUD.bit.GPIO11   = 1;
+}
+
+
+//=== Function: ClaFocInitAdcModule ===============================================================
+///
+/// @brief  Funktion initialisiert einen ADC fr die Strommessung: SOC0 wandelt "channel" beim
+///					SOCA von ePWM4, ADCINT1 (EOC0) kontinuierlich und ohne CPU-Interrupt
+///
+/// @param  volatile struct ADC_REGS *adc, uint16_t module (ADC_MODULE_x), uint16_t channel
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaFocInitAdcModule(volatile struct ADC_REGS *adc, uint16_t module, uint16_t channel)
+{
+		// ADCCLK = SYSCLK / 4 = 50 MHz, einschalten
+		adc->ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
+		adc->ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
+		// 12 Bit Single-Ended, Trimmwerte aus dem OTP
+		adc->ADCCTL2.bit.RESOLUTION = ADC_RESOLUTION_12_BIT;
+		adc->ADCCTL2.bit.SIGNALMODE = ADC_SINGLE_ENDED_MODE;
+		AdcInitTrimRegister(module,
+												ADC_RESOLUTION_12_BIT,
+												ADC_SINGLE_ENDED_MODE);
+		adc->ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+
+		adc->ADCSOC0CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM4_SOCA;
+		adc->ADCSOC0CTL.bit.CHSEL   = channel;
+		adc->ADCSOC0CTL.bit.ACQPS   = CLA_FOC_ACQPS;
+
+		adc->ADCINTSEL1N2.bit.INT1SEL  = 0;
+		adc->ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+		adc->ADCINTSEL1N2.bit.INT1E    = ADC_INT_ENABLE;
+		adc->ADCINTFLGCLR.bit.ADCINT1  = 1;
+}
+
+
+//=== Function: ClaFocInitAdc =====================================================================
+///
+/// @brief  Funktion initialisiert ADC-C (Phase a) und ADC-D (Phase b). Beide wandeln beim
+///					selben SOCA, ADCINT1 des ADC-D startet den CLA-Task 7
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaFocInitAdc(void)
+{
+		// Takt fr ADC-C und ADC-D einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR13.bit.ADC_C = 1;
+		CpuSysRegs.PCLKCR13.bit.ADC_D = 1;
+		__asm(" RPT #4 || NOP");
+
+		ClaFocInitAdcModule(&AdccRegs, ADC_MODULE_C, CLA_FOC_CHANNEL_A);
+		ClaFocInitAdcModule(&AdcdRegs, ADC_MODULE_D, CLA_FOC_CHANNEL_B);
+		// 500 s warten, bis beide ADCs eingeschaltet sind
+		// (siehe "Power Up Time" S. 139 Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
+		DELAY_US(500);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaFocInit ========================================================================
+///
+/// @brief  Funktion setzt die Startwerte der FOC, initialisiert ADC-C, ADC-D und ePWM4 ... 6 und
+///					startet die Zeitbasis zuletzt, damit der erste SOCA eine vollstndig konfigurierte
+///					Regelung vorfindet. Muss nach ClaInit() (Message-RAMs, CLA-Task 7) und
+///					ClaControlInit() (Zeitbasis eCAP1) aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaFocInit(void)
+{
+		// Startwerte der Regelung
+		claFocInput.idReference  = 0.0f;
+		claFocInput.iqReference  = 0.0f;
+		claFocInput.kp           = CLA_FOC_KP;
+		claFocInput.ki           = CLA_FOC_KI;
+		claFocInput.voltageLimit = CLA_FOC_VOLTAGE_LIMIT;
+		claFocInput.omega        = 0.0f;
+		claFocInput.adcScale     = CLA_FOC_ADC_SCALE;
+		claFocInput.adcOffsetA   = CLA_FOC_ADC_OFFSET;
+		claFocInput.adcOffsetB   = CLA_FOC_ADC_OFFSET;
+		// Zustnde des CLA zurcksetzen und die Regelung einschalten
+		claFocInput.reset++;
+		claFocInput.enable       = 1;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		ClaFocInitAdc();
+		ClaFocInitPwm();
+		// Synchronisierungstakt einschalten, ePWM4 ... 6 starten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+#endif
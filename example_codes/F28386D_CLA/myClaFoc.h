@@ -0,0 +1,149 @@
+//=================================================================================================
+/// @file       myClaFoc.h
+///
+/// @brief      Datei enthlt eine feldorientierte Regelung (FOC) der Phasenstrme eines
+///							dreiphasigen Wechselrichters im CLA-Task 7:
+///							ePWM4 SOCA -> ADC-C und ADC-D (gleichzeitige Abtastung von Phase a und b)
+///							-> CLA-Task 7 -> Schattenregister CMPA von ePWM4, ePWM5 und ePWM6.
+///							ePWM4 ist Zeitgeber (CLA_FOC_FREQUENCY_HZ, hoch-runter zhlen), ePWM5 und
+///							ePWM6 werden beim Zhlerstand 0 mit ePWM4 synchronisiert. Jede Halbbrcke
+///							wird komplementr mit Totzeit angesteuert (GPIO 6 ... 11). Beim Zhlerstand 0
+///							sind alle Low-Side-Schalter eingeschaltet, die Strme werden in der Mitte
+///							dieses Nullzeigers gemessen. Das EOC des ADC-D startet den Task.
+///							Der Task besteht aus vier Stufen, deren Laufzeit einzeln gemessen wird
+///							(CLA_FOC_STAGE_x): Messung, Winkel, Regelung (Clarke, Park, PI-Regler,
+///							inverse Park-Transformation und Raumzeigermodulation aus myDsp.h) und
+///							Ausgabe an die ePWM-Module. Die Kernels sind dieselben wie im
+///							CPU-Benchmark (DspBenchmark()), ihre Laufzeit auf CPU und CLA steht in
+///							"dspBenchmarkCycles" und "claDspBenchmarkCycles".
+///							Ohne Drehgeber wird der Winkel mit der Frequenz "omega" gesteuert
+///							(Umdrehungen pro Abtastschritt, open loop). Die Latenz vom SOCA bis zum
+///							Schreiben der Tastverhltnisse wird mit dem Zhlerstand von ePWM4 gemessen
+///							und mit CLA_FOC_BUDGET_TBCLK verglichen.
+///							Sollwerte und Parameter stehen in "claFocInput", Messwerte, Stellgren,
+///							Laufzeit und Latenz in "claFocOutput".
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCLAFOC_H_
+#define MYCLAFOC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myClaControl.h"
+#include "myADC.h"
+#include "myDsp.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// FOC ePWM4 -> ADC-C/D -> CLA-Task 7 -> ePWM4 ... 6 ein- (1) oder ausschalten (0).
+// Die Laufzeitmessung der Stufen verwendet die Zeitbasis eCAP1 aus ClaControlInit()
+#define CLA_FOC_ENABLE											1
+// Abtast- und Schaltfrequenz (ePWM4, hoch-runter zhlen, TBCLK = EPWMCLK = 100 MHz)
+#define CLA_FOC_FREQUENCY_HZ								20000UL
+#define CLA_FOC_TBCLK_HZ										100000000UL
+#define CLA_FOC_PWM_PERIOD									(CLA_FOC_TBCLK_HZ / (2UL * CLA_FOC_FREQUENCY_HZ))
+// Totzeit der Halbbrcken in TBCLK-Takten (200 ns)
+#define CLA_FOC_DEAD_BAND										20
+// Strommessung Phase a (ADC-C) und Phase b (ADC-D), jeweils SOC0
+#define CLA_FOC_CHANNEL_A										ADC_SINGLE_ENDED_ADCIN2
+#define CLA_FOC_CHANNEL_B										ADC_SINGLE_ENDED_ADCIN2
+// Abtastzeitfenster 15 (SYSCLK-)Takte = 75 ns
+#define CLA_FOC_ACQPS												14
+// Triggerquelle des CLA-Tasks 7 (EOC des ADC-D, beide ADCs wandeln gleichzeitig)
+#define CLA_FOC_TRIGGER											CLA_TASK_TRIGGER_ADCD_INT1
+// Startwerte der Regelung (Strme in A, Spannungen bezogen auf die Zwischenkreisspannung)
+#define CLA_FOC_ADC_OFFSET									2048.0f
+#define CLA_FOC_ADC_SCALE										(20.0f / 4096.0f)
+#define CLA_FOC_KP													0.02f
+#define CLA_FOC_KI													0.002f
+#define CLA_FOC_VOLTAGE_LIMIT								0.5f
+// Zeitbudget vom SOCA bis zum Schreiben der Tastverhltnisse: 5 s
+// (1000 SYSCLK-Takte bzw. 500 TBCLK-Takte)
+#define CLA_FOC_BUDGET_CYCLES								1000UL
+#define CLA_FOC_BUDGET_TBCLK								500
+// Stufen des Tasks (Index in "stageCycles")
+#define CLA_FOC_STAGE_MEASUREMENT						0
+#define CLA_FOC_STAGE_ANGLE									1
+#define CLA_FOC_STAGE_CONTROL								2
+#define CLA_FOC_STAGE_PWM										3
+#define CLA_FOC_NUMBER_OF_STAGES						4
+
+#if CLA_FOC_ENABLE && !CLA_CONTROL_ENABLE
+#error "CLA_FOC_ENABLE bentigt CLA_CONTROL_ENABLE (Zeitbasis eCAP1)"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Daten von der CPU an den CLA (CPU-zu-CLA Message-RAM)
+typedef struct
+{
+		float idReference;						// Sollwerte der Strme in A
+		float iqReference;
+		float kp;											// Parameter der Stromregler
+		float ki;
+		float voltageLimit;						// Begrenzung der Stellgren
+		float omega;									// Frequenz des Winkels in Umdrehungen pro Abtastschritt
+		float adcScale;								// Umrechnung ADC-Wert -> Strom
+		float adcOffsetA;							// ADC-Wert bei 0 A
+		float adcOffsetB;
+		uint16_t enable;							// 1: Regelung ein, 0: Tastverhltnisse 0
+		uint16_t reset;								// nderung setzt die Zustnde zurck
+} ClaFocInput;
+
+// Daten vom CLA an die CPU (CLA-zu-CPU Message-RAM)
+typedef struct
+{
+		float ia;											// Phasenstrme
+		float ib;
+		float id;											// Strme nach Park
+		float iq;
+		float vd;											// Stellgren der Stromregler
+		float vq;
+		float theta;									// Winkel in Umdrehungen
+		float dutyA;									// Tastverhltnisse der Halbbrcken
+		float dutyB;
+		float dutyC;
+		uint16_t reset;								// zuletzt bernommener Wert von "reset"
+		uint16_t latencyLast;					// TBCTR von ePWM4 nach dem Schreiben von CMPA (TBCLK-Takte
+		uint16_t latencyMax;					// seit SOCA), Maximalwert
+		uint16_t stageCycles[CLA_FOC_NUMBER_OF_STAGES];	// Laufzeit der Stufen in Takten
+		uint32_t overBudget;					// Anzahl an Abtastschritten ber CLA_FOC_BUDGET_TBCLK
+		ClaTrace trace;								// Laufzeit des CLA-Tasks 7
+} ClaFocOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Die folgenden Variablen werden in der main.c mit einem #pragma-Befehl dem
+// entsprechenden Message-RAM zugeordnet
+// Sollwerte und Parameter (CPU-zu-CLA Message-RAM)
+extern ClaFocInput claFocInput;
+// Messwerte, Stellgren, Laufzeit und Latenz (CLA-zu-CPU Message-RAM)
+extern ClaFocOutput claFocOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Funktionen (myClaFoc.cla)
+// Funktion setzt die Zustnde der FOC zurck (wird von CLA-Task 1 aufgerufen)
+extern void ClaFocReset(void);
+// CLA-Task 7. FOC, wird nach jeder Messung von ADC-C und ADC-D gestartet
+__interrupt void ClaTask7(void);
+
+// CPU-Funktion (myClaFoc.c)
+// Funktion initialisiert ePWM4 ... 6, ADC-C und ADC-D und startet die FOC
+extern void ClaFocInit(void);
+
+
+#endif
@@ -0,0 +1,219 @@
+//=================================================================================================
+/// @file       myClaPipeline.c
+///
+/// @brief      Datei enthlt die Initialisierung der Regelkette ePWM2 -> ADC-B -> DMA -> CLA-Task 6
+///							-> ePWM2 (siehe myClaPipeline.h). Nach ClaPipelineInit() luft jeder Abtastschritt
+///							ohne CPU-Interrupt und ohne einen Befehl der CPU ab.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myClaPipeline.h"
+
+
+#if CLA_PIPELINE_ENABLE
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaPipelineInitPwm ================================================================
+///
+/// @brief  Funktion initialisiert das ePWM2-Modul mit CLA_PIPELINE_FREQUENCY_HZ (hoch-runter
+///					zhlen). SOCA wird bei jedem Zhlerstand 0 ausgelst, CMPA wird beim Zhlerstand 0
+///					aus dem Schattenregister bernommen. GPIO 2 gibt das Signal aus
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaPipelineInitPwm(void)
+{
+		// Synchronisierungstakt whrend der Konfiguration ausschalten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+		// Takt fr das PWM2-Modul einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR2.bit.EPWM2 = 1;
+		__asm(" RPT #4 || NOP");
+		// TBCLK = EPWMCLK = 100 MHz
+		EPwm2Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_1;
+		EPwm2Regs.TBCTL.bit.HSPCLKDIV = PWM_HSPCLKDIV_1;
+		EPwm2Regs.TBCTL.bit.PHSEN     = PWM_TB_PHSEN_DISABLE;
+		EPwm2Regs.TBCTL.bit.CTRMODE   = PWM_TB_COUNT_UPDOWN;
+		EPwm2Regs.TBCTL.bit.PRDLD     = PWM_TB_IMMEDIATE;
+		EPwm2Regs.TBPRD               = CLA_PIPELINE_PWM_PERIOD;
+		// CLA-Task 6 schreibt in das Schattenregister, bernahme beim Zhlerstand 0
+		// (gleichzeitig mit dem nchsten SOCA)
+		EPwm2Regs.CMPCTL.bit.SHDWAMODE = PWM_CC_SHADOW;
+		EPwm2Regs.CMPCTL.bit.LOADAMODE = PWM_CC_SHDW_CTR_ZERO;
+		EPwm2Regs.CMPA.bit.CMPA        = 0;
+		EPwm2Regs.AQCTLA.bit.CAU       = PWM_AQ_SET;
+		EPwm2Regs.AQCTLA.bit.CAD       = PWM_AQ_CLEAR;
+		EPwm2Regs.DBCTL.bit.OUT_MODE   = PWM_DB_BOTH_BYPASSED;
+		// SOCA bei jedem Zhlerstand 0 (Mitte der Ausschaltzeit)
+		EPwm2Regs.ETSEL.bit.SOCASEL = PWM_ET_CTR_ZERO;
+		EPwm2Regs.ETPS.bit.SOCAPRD  = PWM_ET_1ST;
+		EPwm2Regs.ETSEL.bit.SOCAEN  = PWM_ET_SOC_ENABLE;
+		EPwm2Regs.TBCTR = 0;
+
+		// GPIO 2 auf PWM-Funktionalitt (EPWM2A) setzen, Pull-Up-Widerstand deaktivieren
+		// (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		GpioCtrlRegs.GPALOCK.bit.GPIO2  = 0;
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO2 = (0x01 >> 2);
+		GpioCtrlRegs.GPAMUX1.bit.GPIO2  = (0x01 & 0x03);
+		GpioCtrlRegs.GPAPUD.bit.GPIO2   = 1;
+}
+
+
+//=== Function: ClaPipelineInitAdc ================================================================
+///
+/// @brief  Funktion initialisiert den ADC-B: SOC0 ... SOC(N-1) und die Synchronisations-SOC N
+///					wandeln CLA_PIPELINE_CHANNEL beim SOCA von ePWM2. ADCINT1 (EOC N-1) triggert den DMA,
+///					ADCINT2 (EOC N) den CLA-Task 6, beide kontinuierlich und ohne CPU-Interrupt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaPipelineInitAdc(void)
+{
+		volatile union ADCSOC0CTL_REG *socCtl = &AdcbRegs.ADCSOC0CTL;
+		uint16_t i;
+
+		// Takt fr das ADC-B-Modul einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR13.bit.ADC_B = 1;
+		__asm(" RPT #4 || NOP");
+		// ADCCLK = SYSCLK / 4 = 50 MHz, einschalten und 500 s warten
+		// (siehe "Power Up Time" S. 139 Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
+		AdcbRegs.ADCCTL2.bit.PRESCALE = ADC_CLK_DIV_4_0;
+		AdcbRegs.ADCCTL1.bit.ADCPWDNZ = ADC_POWER_ON;
+		DELAY_US(500);
+		// 12 Bit Single-Ended, Trimmwerte aus dem OTP
+		AdcbRegs.ADCCTL2.bit.RESOLUTION = ADC_RESOLUTION_12_BIT;
+		AdcbRegs.ADCCTL2.bit.SIGNALMODE = ADC_SINGLE_ENDED_MODE;
+		AdcInitTrimRegister(ADC_MODULE_B,
+												ADC_RESOLUTION_12_BIT,
+												ADC_SINGLE_ENDED_MODE);
+		AdcbRegs.ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+
+		// Burst und Synchronisations-SOC: gleicher Trigger und Kanal, die SOCs werden
+		// aufsteigend gewandelt (Round Robin, siehe AdcAInit()). Das Ergebnis der
+		// Synchronisations-SOC wird nicht verwendet
+		for (i = 0; i <= CLA_PIPELINE_SYNC_SOC; i++)
+		{
+				socCtl[i].bit.TRIGSEL = ADC_TRIGGER_EPWM2_SOCA;
+				socCtl[i].bit.CHSEL   = CLA_PIPELINE_CHANNEL;
+				socCtl[i].bit.ACQPS   = CLA_PIPELINE_ACQPS;
+		}
+
+		// ADCINT1 nach der letzten SOC des Bursts (DMA-Trigger)
+		AdcbRegs.ADCINTSEL1N2.bit.INT1SEL  = CLA_PIPELINE_NUMBER_OF_SAMPLES - 1;
+		AdcbRegs.ADCINTSEL1N2.bit.INT1CONT = ADC_INT_PULSE_CONTINOUS;
+		AdcbRegs.ADCINTSEL1N2.bit.INT1E    = ADC_INT_ENABLE;
+		// ADCINT2 nach der Synchronisations-SOC (Trigger fr CLA-Task 6)
+		AdcbRegs.ADCINTSEL1N2.bit.INT2SEL  = CLA_PIPELINE_SYNC_SOC;
+		AdcbRegs.ADCINTSEL1N2.bit.INT2CONT = ADC_INT_PULSE_CONTINOUS;
+		AdcbRegs.ADCINTSEL1N2.bit.INT2E    = ADC_INT_ENABLE;
+		AdcbRegs.ADCINTFLGCLR.bit.ADCINT1  = 1;
+		AdcbRegs.ADCINTFLGCLR.bit.ADCINT2  = 1;
+}
+
+
+//=== Function: ClaPipelineInitDma ================================================================
+///
+/// @brief  Funktion konfiguriert den DMA-Kanal CH6: pro ADCINT1 ein Burst von
+///					CLA_PIPELINE_NUMBER_OF_SAMPLES Wrtern aus ADCRESULT0 ... in "claPipelineSamples".
+///					Jeder Transfer besteht aus einem Burst, danach werden die Adressen neu geladen
+///					(kontinuierlich, kein Interrupt)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void ClaPipelineInitDma(void)
+{
+		// DMA einschalten, der DMA luft weiter, wenn der Debugger die CPU anhlt
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		DmaRegs.CH6.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH6.SRC_BEG_ADDR_SHADOW = (uint32_t)&AdcbResultRegs.ADCRESULT0;
+		DmaRegs.CH6.SRC_ADDR_SHADOW     = (uint32_t)&AdcbResultRegs.ADCRESULT0;
+		DmaRegs.CH6.DST_BEG_ADDR_SHADOW = (uint32_t)&claPipelineSamples[0];
+		DmaRegs.CH6.DST_ADDR_SHADOW     = (uint32_t)&claPipelineSamples[0];
+		// Alle Messwerte eines Abtastschritts in einem Burst, ein Burst pro Transfer
+		DmaRegs.CH6.BURST_SIZE.bit.BURSTSIZE = CLA_PIPELINE_NUMBER_OF_SAMPLES - 1;
+		DmaRegs.CH6.SRC_BURST_STEP = 1;
+		DmaRegs.CH6.DST_BURST_STEP = 1;
+		DmaRegs.CH6.TRANSFER_SIZE = 0;
+		DmaRegs.CH6.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH6.DST_TRANSFER_STEP = 0;
+		DmaRegs.CH6.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.SRC_WRAP_STEP = 0;
+		DmaRegs.CH6.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6 = CLA_PIPELINE_DMA_TRIGGER_ADCBINT1;
+		DmaRegs.CH6.MODE.bit.PERINTSEL = 6;
+		DmaRegs.CH6.MODE.bit.PERINTE = 1;
+		DmaRegs.CH6.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH6.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH6.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH6.MODE.bit.DATASIZE = 0;
+		DmaRegs.CH6.MODE.bit.CHINTE = 0;
+		DmaRegs.CH6.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH6.CONTROL.bit.ERRCLR = 1;
+		DmaRegs.CH6.CONTROL.bit.RUN = 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClaPipelineInit ===================================================================
+///
+/// @brief  Funktion setzt die Startwerte der Regelkette, initialisiert ADC-B, DMA-Kanal CH6 und
+///					ePWM2 und startet die Zeitbasis von ePWM2 zuletzt, damit der erste SOCA eine
+///					vollstndig konfigurierte Kette vorfindet. Muss nach ClaInit() (Message-RAMs,
+///					CLA-Task 6) und ClaControlInit() (Zeitbasis eCAP1) aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ClaPipelineInit(void)
+{
+		// Startwerte der Regelung
+		claPipelineInput.reference         = 0.0f;
+		claPipelineInput.kp                = CLA_PIPELINE_KP;
+		claPipelineInput.ki                = CLA_PIPELINE_KI;
+		claPipelineInput.filterCoefficient = CLA_PIPELINE_FILTER_COEFFICIENT;
+		claPipelineInput.outputMin         = CLA_PIPELINE_OUTPUT_MIN;
+		claPipelineInput.outputMax         = CLA_PIPELINE_OUTPUT_MAX;
+		claPipelineInput.adcScale          = CLA_PIPELINE_ADC_SCALE;
+		claPipelineInput.pwmScale          = CLA_PIPELINE_PWM_SCALE;
+		// Zustnde des CLA zurcksetzen und die Regelung einschalten
+		claPipelineInput.reset++;
+		claPipelineInput.enable            = 1;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		ClaPipelineInitAdc();
+		ClaPipelineInitDma();
+		ClaPipelineInitPwm();
+		// Synchronisierungstakt einschalten, ePWM2 startet
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+#endif
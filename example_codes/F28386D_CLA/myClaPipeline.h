@@ -0,0 +1,121 @@
+//=================================================================================================
+/// @file       myClaPipeline.h
+///
+/// @brief      Datei enthlt eine Regelkette, die ohne einen Befehl der CPU (C28-Kern) vom
+///							ePWM-Trigger bis zur neuen Stellgre durchluft:
+///							ePWM2 SOCA -> ADC-B Burst -> DMA in das DMA-zu-CLA Message-RAM -> CLA-Task 6
+///							-> Schattenregister CMPA von ePWM2.
+///							ePWM2 ist Zeitgeber und Stellglied zugleich (CLA_PIPELINE_FREQUENCY_HZ,
+///							Ausgang GPIO 2). Beim Zhlerstand 0 startet SOCA die SOCs 0 ... N-1 des ADC-B
+///							(N = CLA_PIPELINE_NUMBER_OF_SAMPLES, alle auf CLA_PIPELINE_CHANNEL) und eine
+///							weitere SOC N (Synchronisations-SOC). Das EOC der SOC N-1 lst ADCINT1 aus,
+///							mit dem der DMA-Kanal CH6 die N Messwerte in einem Burst
+///							nach "claPipelineSamples" kopiert. Das EOC der SOC N lst ADCINT2 aus, der
+///							CLA-Task 6 startet. Da die Wandlung der SOC N lnger dauert als der Burst des
+///							DMA (ca. 60 gegen ca. 4 + N Takte), liegen die Messwerte beim Start des Tasks
+///							vollstndig vor. Der Task mittelt die Messwerte, filtert sie, fhrt den
+///							PI-Regler aus (Bausteine aus myClaControl.h) und schreibt CMPA, das beim
+///							nchsten Zhlerstand 0 bernommen wird.
+///							Hinweis: Der DMA kann nicht auf den CLA-Datenspeicher (RAMLSx) zugreifen, daher
+///							wird das DMA-zu-CLA Message-RAM verwendet (nur DMA schreibt, nur CLA liest).
+///							Sollwert und Parameter stehen in "claPipelineInput", Messwert, Stellgre,
+///							Laufzeit und Latenz in "claPipelineOutput".
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCLAPIPELINE_H_
+#define MYCLAPIPELINE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myClaControl.h"
+#include "myADC.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Regelkette ePWM2 -> ADC-B -> DMA -> CLA-Task 6 -> ePWM2 ein- (1) oder ausschalten (0).
+// Die Laufzeitmessung verwendet die Zeitbasis eCAP1 aus ClaControlInit()
+#define CLA_PIPELINE_ENABLE									1
+// Abtast- und Schaltfrequenz (ePWM2, hoch-runter zhlen, TBCLK = EPWMCLK = 100 MHz)
+#define CLA_PIPELINE_FREQUENCY_HZ						100000UL
+#define CLA_PIPELINE_TBCLK_HZ								100000000UL
+#define CLA_PIPELINE_PWM_PERIOD							(CLA_PIPELINE_TBCLK_HZ / (2UL * CLA_PIPELINE_FREQUENCY_HZ))
+// Messwerte pro Abtastschritt (SOC0 ... SOC(N-1) des ADC-B), die Synchronisations-SOC ist SOC N.
+// Hchstens 8 Messwerte, damit der Burst des DMA sicher vor dem Ende der SOC N abgeschlossen ist
+#define CLA_PIPELINE_NUMBER_OF_SAMPLES			4
+#define CLA_PIPELINE_SYNC_SOC								CLA_PIPELINE_NUMBER_OF_SAMPLES
+#define CLA_PIPELINE_CHANNEL								ADC_SINGLE_ENDED_ADCIN2
+// Abtastzeitfenster 15 (SYSCLK-)Takte = 75 ns
+#define CLA_PIPELINE_ACQPS									14
+// Trigger ADCBINT1 des DMA-Kanals CH6 (DMACHSRCSELx, siehe Tabelle "DMA Trigger Source Options",
+// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define CLA_PIPELINE_DMA_TRIGGER_ADCBINT1		6
+// Triggerquelle des CLA-Tasks 6 (EOC der Synchronisations-SOC)
+#define CLA_PIPELINE_TRIGGER								CLA_TASK_TRIGGER_ADCB_INT2
+// Startwerte der Regelung (Messwert und Sollwert in A, Stellgre als Tastverhltnis 0 ... 1)
+#define CLA_PIPELINE_ADC_SCALE							(10.0f / 4096.0f / CLA_PIPELINE_NUMBER_OF_SAMPLES)
+#define CLA_PIPELINE_PWM_SCALE							((float)CLA_PIPELINE_PWM_PERIOD)
+#define CLA_PIPELINE_KP											0.05f
+#define CLA_PIPELINE_KI											0.005f
+#define CLA_PIPELINE_FILTER_COEFFICIENT			1.0f
+#define CLA_PIPELINE_OUTPUT_MIN							0.0f
+#define CLA_PIPELINE_OUTPUT_MAX							0.95f
+
+#if CLA_PIPELINE_ENABLE && CLA_CONTROL_TRACE_ENABLE && !CLA_CONTROL_ENABLE
+#error "CLA_PIPELINE_ENABLE mit CLA_CONTROL_TRACE_ENABLE bentigt CLA_CONTROL_ENABLE (Zeitbasis eCAP1)"
+#endif
+#if CLA_PIPELINE_NUMBER_OF_SAMPLES > 8
+#error "CLA_PIPELINE_NUMBER_OF_SAMPLES darf hchstens 8 sein"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Daten vom CLA an die CPU (CLA-zu-CPU Message-RAM)
+typedef struct
+{
+		float measurement;						// gefilterter Messwert
+		float error;									// Regelabweichung
+		float output;									// Stellgre
+		uint16_t reset;								// zuletzt bernommener Wert von "reset"
+		uint16_t latencyLast;					// TBCTR von ePWM2 nach dem Schreiben von CMPA (TBCLK-Takte
+		uint16_t latencyMax;					// seit SOCA), Maximalwert
+		ClaTrace trace;								// Laufzeit des CLA-Tasks 6
+} ClaPipelineOutput;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Die folgenden Variablen werden in der main.c mit einem #pragma-Befehl dem
+// entsprechenden Message-RAM zugeordnet
+// Sollwert und Parameter (CPU-zu-CLA Message-RAM, gleicher Aufbau wie bei Task 4)
+extern ClaCpuToClaMsg claPipelineInput;
+// Messwert, Stellgre, Laufzeit und Latenz (CLA-zu-CPU Message-RAM)
+extern ClaPipelineOutput claPipelineOutput;
+// Messwerte des ADC-B (DMA-zu-CLA Message-RAM, vom DMA geschrieben)
+extern uint16_t claPipelineSamples[CLA_PIPELINE_NUMBER_OF_SAMPLES];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// CLA-Funktionen (myClaPipeline.cla)
+// Funktion setzt die Zustnde der Regelkette zurck (wird von CLA-Task 1 aufgerufen)
+extern void ClaPipelineReset(void);
+// CLA-Task 6. Regelkette, wird nach jedem Burst des ADC-B gestartet
+__interrupt void ClaTask6(void);
+
+// CPU-Funktion (myClaPipeline.c)
+// Funktion initialisiert ePWM2, ADC-B und den DMA-Kanal und startet die Regelkette
+extern void ClaPipelineInit(void);
+
+
+#endif
@@ -0,0 +1,128 @@
+//=================================================================================================
+/// @file       myDsp.c
+///
+/// @brief      Datei enthlt die Laufzeitmessung der Signalverarbeitungs-Kernels (myDsp.h) auf der
+///							CPU (C28-Kern). Jeder Kernel wird einmal mit Testdaten aufgerufen, die Laufzeit
+///							wird mit dem CPU-Timer 2 (myProfile.h, 5 ns pro Takt) gemessen und in Takten in
+///							"dspBenchmarkCycles" abgelegt. Die Laufzeit auf dem CLA misst CLA-Task 8
+///							(myDspCla.cla).
+///
+///							nderung in Version 1.1: Laufzeit von PI-Regler, inverser Park-Transformation,
+///							Raumzeigermodulation und der ganzen FOC (Stufen aus myDsp.h)
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDsp.h"
+#include "myProfile.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Laufzeit der Kernels auf der CPU in Takten
+uint32_t dspBenchmarkCycles[DSP_NUMBER_OF_BENCHMARKS];
+// Ergebnis der Kernels (volatile, damit der Compiler die Aufrufe nicht entfernt)
+static volatile float dspBenchmarkResult;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DspBenchmark ======================================================================
+///
+/// @brief  Funktion misst die Laufzeit jedes Kernels auf der CPU. Der CPU-Timer 2 muss mit
+///					ProfileInit() gestartet worden sein. Die Laufzeit der Messung selbst
+///					(profileOverhead) wird abgezogen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DspBenchmark(void)
+{
+		static float firCoefficients[DSP_BENCHMARK_FIR_LENGTH];
+		static float firDelay[DSP_BENCHMARK_FIR_LENGTH];
+		static float averageBuffer[DSP_BENCHMARK_AVERAGE_LENGTH];
+		DspBiquad biquad = {0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f, 0.0f, 0.0f, 0.0f, 0.0f};
+		DspFir fir;
+		DspMovingAverage average;
+		DspRms rms;
+		DspPll pll;
+		DspPi pi = {0.5f, 0.05f, -0.5f, 0.5f, 0.0f};
+		DspFoc foc;
+		DspAlphaBeta alphaBeta;
+		DspDq dq;
+		DspAbc duty;
+		uint32_t start;
+		uint16_t i;
+
+		for (i = 0; i < DSP_BENCHMARK_FIR_LENGTH; i++)
+				firCoefficients[i] = 1.0f / DSP_BENCHMARK_FIR_LENGTH;
+		DspFirInit(&fir, firCoefficients, firDelay, DSP_BENCHMARK_FIR_LENGTH);
+		DspMovingAverageInit(&average, averageBuffer, DSP_BENCHMARK_AVERAGE_LENGTH);
+		// Lnge 1, damit bei jedem Aufruf die Wurzel berechnet wird (lngster Pfad)
+		DspRmsInit(&rms, 1);
+		DspPllInit(&pll, 0.01f, 0.0001f, 0.001f);
+		DspFocInit(&foc, 0.5f, 0.05f, 0.5f);
+		foc.iqReference = 1.0f;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspBiquadRun(&biquad, 1.0f);
+		dspBenchmarkCycles[DSP_BENCHMARK_BIQUAD] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspFirRun(&fir, 1.0f);
+		dspBenchmarkCycles[DSP_BENCHMARK_FIR] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspMovingAverageRun(&average, 1.0f);
+		dspBenchmarkCycles[DSP_BENCHMARK_MOVING_AVERAGE] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspRmsRun(&rms, 1.0f);
+		dspBenchmarkCycles[DSP_BENCHMARK_RMS] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		DspClarke(1.0f, -0.5f, &alphaBeta);
+		dspBenchmarkCycles[DSP_BENCHMARK_CLARKE] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		DspPark(&alphaBeta, 0.5f, 0.866f, &dq);
+		dspBenchmarkCycles[DSP_BENCHMARK_PARK] = PROFILE_TIMESTAMP() - start - profileOverhead;
+		dspBenchmarkResult = dq.d;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspSinPu(0.1f) + DspCosPu(0.1f);
+		dspBenchmarkCycles[DSP_BENCHMARK_SINCOS] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspPllRun(&pll, &alphaBeta);
+		dspBenchmarkCycles[DSP_BENCHMARK_PLL] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		dspBenchmarkResult = DspPiRun(&pi, 0.1f);
+		dspBenchmarkCycles[DSP_BENCHMARK_PI] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		DspInversePark(&dq, 0.5f, 0.866f, &alphaBeta);
+		dspBenchmarkCycles[DSP_BENCHMARK_INVERSE_PARK] = PROFILE_TIMESTAMP() - start - profileOverhead;
+
+		start = PROFILE_TIMESTAMP();
+		DspSvm(&alphaBeta, &duty);
+		dspBenchmarkCycles[DSP_BENCHMARK_SVM] = PROFILE_TIMESTAMP() - start - profileOverhead;
+		dspBenchmarkResult = duty.a;
+
+		// Alle Stufen der FOC (ohne Messwerte, Winkel und Ausgabe an das ePWM-Modul)
+		start = PROFILE_TIMESTAMP();
+		DspFocRun(&foc, 1.0f, -0.5f, 0.5f, 0.866f);
+		dspBenchmarkCycles[DSP_BENCHMARK_FOC] = PROFILE_TIMESTAMP() - start - profileOverhead;
+		dspBenchmarkResult = foc.duty.a;
+}
@@ -0,0 +1,723 @@
+//=================================================================================================
+/// @file       myDsp.h
+///
+/// @brief      Datei enthlt eine kleine Bibliothek mit Signalverarbeitungs-Kernels (float32) fr
+///							die CPU (C28-Kern) und das CLA-Modul des TMS320F2838x: Biquad-Filter (IIR
+///							2. Ordnung), FIR-Filter, gleitender Mittelwert, Effektivwert (RMS), Clarke- und
+///							Park-Transformation, Sinus/Kosinus, eine PLL (SRF-PLL fr Drehstrom) sowie
+///							PI-Regler, Raumzeigermodulation und die feldorientierte Regelung (FOC).
+///							Alle Kernels sind als "static inline"-Funktionen in dieser Datei umgesetzt,
+///							damit CPU (.c-Dateien) und CLA (.cla-Dateien) die gleiche Schnittstelle nutzen
+///							und jeder Compiler eine eigene Version erzeugt. Auf der CPU werden fr Sinus,
+///							Kosinus und Wurzel die Befehle der TMU (Trigonometric Math Unit, Compiler-
+///							Option --tmu_support) genutzt, der CLA rechnet mit einer Reihenentwicklung.
+///							Die Laufzeit jedes Kernels wird mit DspBenchmark() (CPU, myDsp.c) und dem
+///							CLA-Task 8 (CLA, myDspCla.cla) gemessen.
+///
+///							HINWEIS: Die Structs der Kernels enthalten Zeiger auf Puffer. Da CPU und CLA
+///											 unterschiedlich breite Zeiger haben, darf ein Struct nur von dem Kern
+///											 genutzt werden, der es angelegt hat (nicht im Message-RAM ablegen).
+///
+///							nderung in Version 1.1: PI-Regler (DspPiRun()), Raumzeigermodulation (DspSvm())
+///							und feldorientierte Regelung der Phasenstrme (DspFocRun()), die Laufzeit jeder Stufe
+///							und der ganzen FOC wird mit DspBenchmark() und CLA-Task 8 gemessen
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYDSP_H_
+#define MYDSP_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+#define DSP_PI															3.14159265f
+#define DSP_2PI															6.28318531f
+#define DSP_1_SQRT3													0.57735027f
+#define DSP_SQRT3_2													0.86602540f
+// Kernels der Laufzeitmessung (Index in dspBenchmarkCycles und claDspBenchmarkCycles)
+#define DSP_BENCHMARK_BIQUAD								0
+#define DSP_BENCHMARK_FIR										1
+#define DSP_BENCHMARK_MOVING_AVERAGE				2
+#define DSP_BENCHMARK_RMS										3
+#define DSP_BENCHMARK_CLARKE								4
+#define DSP_BENCHMARK_PARK									5
+#define DSP_BENCHMARK_SINCOS								6
+#define DSP_BENCHMARK_PLL										7
+#define DSP_BENCHMARK_PI										8
+#define DSP_BENCHMARK_INVERSE_PARK					9
+#define DSP_BENCHMARK_SVM										10
+#define DSP_BENCHMARK_FOC										11
+#define DSP_NUMBER_OF_BENCHMARKS						12
+// Lnge der Filter der Laufzeitmessung
+#define DSP_BENCHMARK_FIR_LENGTH						16
+#define DSP_BENCHMARK_AVERAGE_LENGTH				16
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Biquad-Filter (IIR 2. Ordnung, Direktform I, a0 = 1)
+typedef struct
+{
+		float b0;
+		float b1;
+		float b2;
+		float a1;
+		float a2;
+		float x1;											// Eingangswerte der letzten zwei Abtastschritte
+		float x2;
+		float y1;											// Ausgangswerte der letzten zwei Abtastschritte
+		float y2;
+} DspBiquad;
+
+// FIR-Filter mit Ringpuffer (Puffer mit "length" Werten wird vom Aufrufer angelegt)
+typedef struct
+{
+		const float *coefficients;		// Koeffizienten h[0] ... h[length-1]
+		float *delay;									// Ringpuffer der letzten Eingangswerte
+		uint16_t length;
+		uint16_t index;								// Position des neuesten Werts im Ringpuffer
+} DspFir;
+
+// Gleitender Mittelwert ber "length" Werte (Puffer wird vom Aufrufer angelegt)
+typedef struct
+{
+		float *buffer;
+		uint16_t length;
+		uint16_t index;
+		float sum;
+} DspMovingAverage;
+
+// Effektivwert ber "length" Abtastschritte (z.B. eine Netzperiode)
+typedef struct
+{
+		uint16_t length;
+		uint16_t count;
+		float sumOfSquares;
+		float rms;										// Effektivwert der letzten vollstndigen Periode
+} DspRms;
+
+// Zeiger in ruhenden (alpha/beta) und drehenden (d/q) Koordinaten
+typedef struct
+{
+		float alpha;
+		float beta;
+} DspAlphaBeta;
+
+typedef struct
+{
+		float d;
+		float q;
+} DspDq;
+
+// PLL (SRF-PLL): regelt die q-Komponente der Park-Transformation auf 0.
+// Winkel "theta" in Umdrehungen (0 ... 1), Frequenzen in Umdrehungen pro Abtastschritt
+typedef struct
+{
+		float kp;
+		float ki;
+		float omegaNominal;						// Nennfrequenz (z.B. 50 Hz / Abtastrate)
+		float integral;								// Zustand des PI-Reglers
+		float omega;									// geschtzte Frequenz
+		float theta;									// geschtzter Winkel
+		float sinTheta;								// Sinus und Kosinus von "theta"
+		float cosTheta;
+} DspPll;
+
+// Drei Phasen (z.B. Tastverhltnisse der Halbbrcken)
+typedef struct
+{
+		float a;
+		float b;
+		float c;
+} DspAbc;
+
+// PI-Regler mit Begrenzung der Stellgre (Anti-Windup)
+typedef struct
+{
+		float kp;
+		float ki;											// pro Abtastschritt
+		float outputMin;
+		float outputMax;
+		float integral;
+} DspPi;
+
+// Feldorientierte Regelung (FOC) der Phasenstrme. Spannungen bezogen auf die
+// Zwischenkreisspannung (linearer Bereich der Raumzeigermodulation: Betrag <= 1/sqrt(3))
+typedef struct
+{
+		DspPi piD;										// Stromregler der d- und q-Achse
+		DspPi piQ;
+		float idReference;						// Sollwerte der Strme
+		float iqReference;
+		DspAlphaBeta current;					// Strme nach Clarke
+		DspDq currentDq;							// Strme nach Park
+		DspDq voltageDq;							// Stellgren der Stromregler
+		DspAlphaBeta voltage;					// Spannung nach inverser Park-Transformation
+		DspAbc duty;									// Tastverhltnisse der Halbbrcken (0 ... 1)
+} DspFoc;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Laufzeit der Kernels auf der CPU in Takten (DspBenchmark(), myDsp.c)
+extern uint32_t dspBenchmarkCycles[DSP_NUMBER_OF_BENCHMARKS];
+// Laufzeit der Kernels auf dem CLA in Takten (CLA-Task 8, myDspCla.cla). Die Variable
+// wird in der main.c dem CLA-zu-CPU Message-RAM zugeordnet
+extern uint32_t claDspBenchmarkCycles[DSP_NUMBER_OF_BENCHMARKS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Inline functions (CPU und CLA)
+//-------------------------------------------------------------------------------------------------
+//=== Function: DspSqrt ===========================================================================
+///
+/// @brief  Funktion gibt die Quadratwurzel von "x" zurck (CPU: TMU, CLA: Schtzwert des Kehrwerts
+///					mit zwei Newton-Schritten)
+///
+/// @param  float x
+///
+/// @return float root
+///
+//=================================================================================================
+static inline float DspSqrt(float x)
+{
+#if defined(__TMS320C28XX_CLA__)
+		float estimate;
+
+		if (x <= 0.0f)
+				return 0.0f;
+		estimate = __meisqrtf32(x);
+		estimate = estimate * (1.5f - 0.5f * x * estimate * estimate);
+		estimate = estimate * (1.5f - 0.5f * x * estimate * estimate);
+		return x * estimate;
+#elif defined(__TMS320C28XX_TMU__)
+		return __sqrt(x);
+#else
+		return sqrtf(x);
+#endif
+}
+
+
+//=== Function: DspSinPu ==========================================================================
+///
+/// @brief  Funktion gibt den Sinus des Winkels "anglePu" in Umdrehungen (1.0 = 360) zurck
+///					(CPU: TMU, CLA: Reihenentwicklung bis x^9, Fehler < 4e-6)
+///
+/// @param  float anglePu
+///
+/// @return float sin
+///
+//=================================================================================================
+static inline float DspSinPu(float anglePu)
+{
+#if defined(__TMS320C28XX_TMU__) && !defined(__TMS320C28XX_CLA__)
+		return __sinpuf32(anglePu);
+#else
+		float x;
+		float x2;
+
+		// Winkel auf -0.5 ... 0.5 Umdrehungen reduzieren
+		x = anglePu - (float)(int32_t)anglePu;
+		if (x >= 0.5f)
+				x -= 1.0f;
+		else if (x < -0.5f)
+				x += 1.0f;
+		// In Bogenma umrechnen und auf -pi/2 ... pi/2 spiegeln
+		x *= DSP_2PI;
+		if (x > 0.5f * DSP_PI)
+				x = DSP_PI - x;
+		else if (x < -0.5f * DSP_PI)
+				x = -DSP_PI - x;
+
+		x2 = x * x;
+		return x * (1.0f - x2 * (1.0f / 6.0f - x2 * (1.0f / 120.0f - x2 * (1.0f / 5040.0f
+							 - x2 * (1.0f / 362880.0f)))));
+#endif
+}
+
+
+//=== Function: DspCosPu ==========================================================================
+///
+/// @brief  Funktion gibt den Kosinus des Winkels "anglePu" in Umdrehungen (1.0 = 360) zurck
+///
+/// @param  float anglePu
+///
+/// @return float cos
+///
+//=================================================================================================
+static inline float DspCosPu(float anglePu)
+{
+#if defined(__TMS320C28XX_TMU__) && !defined(__TMS320C28XX_CLA__)
+		return __cospuf32(anglePu);
+#else
+		return DspSinPu(anglePu + 0.25f);
+#endif
+}
+
+
+//=== Function: DspBiquadReset ====================================================================
+///
+/// @brief  Funktion setzt den Zustand eines Biquad-Filters zurck
+///
+/// @param  DspBiquad *filter
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspBiquadReset(DspBiquad *filter)
+{
+		filter->x1 = 0.0f;
+		filter->x2 = 0.0f;
+		filter->y1 = 0.0f;
+		filter->y2 = 0.0f;
+}
+
+
+//=== Function: DspBiquadRun ======================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt des Biquad-Filters aus
+///					(y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2)
+///
+/// @param  DspBiquad *filter, float input
+///
+/// @return float output
+///
+//=================================================================================================
+static inline float DspBiquadRun(DspBiquad *filter, float input)
+{
+		float output = filter->b0 * input + filter->b1 * filter->x1 + filter->b2 * filter->x2
+								 - filter->a1 * filter->y1 - filter->a2 * filter->y2;
+
+		filter->x2 = filter->x1;
+		filter->x1 = input;
+		filter->y2 = filter->y1;
+		filter->y1 = output;
+
+		return output;
+}
+
+
+//=== Function: DspFirInit ========================================================================
+///
+/// @brief  Funktion initialisiert ein FIR-Filter und lscht den Ringpuffer
+///
+/// @param  DspFir *filter, const float *coefficients, float *delay, uint16_t length
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspFirInit(DspFir *filter, const float *coefficients, float *delay,
+															uint16_t length)
+{
+		uint16_t i;
+
+		filter->coefficients = coefficients;
+		filter->delay = delay;
+		filter->length = length;
+		filter->index = 0;
+		for (i = 0; i < length; i++)
+				delay[i] = 0.0f;
+}
+
+
+//=== Function: DspFirRun =========================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt des FIR-Filters aus
+///					(y = h[0]*x[n] + h[1]*x[n-1] + ... + h[length-1]*x[n-length+1])
+///
+/// @param  DspFir *filter, float input
+///
+/// @return float output
+///
+//=================================================================================================
+static inline float DspFirRun(DspFir *filter, float input)
+{
+		uint16_t index = filter->index;
+		float output = 0.0f;
+		uint16_t i;
+
+		filter->delay[index] = input;
+
+		// Koeffizienten vom neuesten zum ltesten Wert durchlaufen (zwei Schleifen statt
+		// Modulo-Rechnung im Ringpuffer)
+		for (i = 0; i <= index; i++)
+				output += filter->coefficients[i] * filter->delay[index - i];
+		for (; i < filter->length; i++)
+				output += filter->coefficients[i] * filter->delay[filter->length + index - i];
+
+		filter->index = (index + 1 < filter->length) ? index + 1 : 0;
+
+		return output;
+}
+
+
+//=== Function: DspMovingAverageInit ==============================================================
+///
+/// @brief  Funktion initialisiert einen gleitenden Mittelwert und lscht den Puffer
+///
+/// @param  DspMovingAverage *average, float *buffer, uint16_t length
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspMovingAverageInit(DspMovingAverage *average, float *buffer, uint16_t length)
+{
+		uint16_t i;
+
+		average->buffer = buffer;
+		average->length = length;
+		average->index = 0;
+		average->sum = 0.0f;
+		for (i = 0; i < length; i++)
+				buffer[i] = 0.0f;
+}
+
+
+//=== Function: DspMovingAverageRun ===============================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt des gleitenden Mittelwerts aus. Die Summe wird
+///					laufend nachgefhrt (Laufzeit unabhngig von "length")
+///
+/// @param  DspMovingAverage *average, float input
+///
+/// @return float mean
+///
+//=================================================================================================
+static inline float DspMovingAverageRun(DspMovingAverage *average, float input)
+{
+		uint16_t index = average->index;
+
+		average->sum += input - average->buffer[index];
+		average->buffer[index] = input;
+		average->index = (index + 1 < average->length) ? index + 1 : 0;
+
+		return average->sum / (float)average->length;
+}
+
+
+//=== Function: DspRmsInit ========================================================================
+///
+/// @brief  Funktion initialisiert die Berechnung des Effektivwerts ber "length" Abtastschritte
+///
+/// @param  DspRms *rms, uint16_t length
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspRmsInit(DspRms *rms, uint16_t length)
+{
+		rms->length = length;
+		rms->count = 0;
+		rms->sumOfSquares = 0.0f;
+		rms->rms = 0.0f;
+}
+
+
+//=== Function: DspRmsRun =========================================================================
+///
+/// @brief  Funktion summiert das Quadrat von "input" und berechnet nach "length" Abtastschritten
+///					den neuen Effektivwert
+///
+/// @param  DspRms *rms, float input
+///
+/// @return float rms (Effektivwert der letzten vollstndigen Periode)
+///
+//=================================================================================================
+static inline float DspRmsRun(DspRms *rms, float input)
+{
+		rms->sumOfSquares += input * input;
+		if (++rms->count >= rms->length)
+		{
+				rms->rms = DspSqrt(rms->sumOfSquares / (float)rms->length);
+				rms->sumOfSquares = 0.0f;
+				rms->count = 0;
+		}
+
+		return rms->rms;
+}
+
+
+//=== Function: DspClarke =========================================================================
+///
+/// @brief  Funktion fhrt die Clarke-Transformation zweier Phasen eines symmetrischen
+///					Drehstromsystems aus (a + b + c = 0)
+///
+/// @param  float a, float b, DspAlphaBeta *out
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspClarke(float a, float b, DspAlphaBeta *out)
+{
+		out->alpha = a;
+		out->beta = DSP_1_SQRT3 * (a + 2.0f * b);
+}
+
+
+//=== Function: DspPark ===========================================================================
+///
+/// @brief  Funktion fhrt die Park-Transformation mit Sinus und Kosinus des Drehwinkels aus
+///
+/// @param  const DspAlphaBeta *in, float sinTheta, float cosTheta, DspDq *out
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspPark(const DspAlphaBeta *in, float sinTheta, float cosTheta, DspDq *out)
+{
+		out->d = in->alpha * cosTheta + in->beta * sinTheta;
+		out->q = in->beta * cosTheta - in->alpha * sinTheta;
+}
+
+
+//=== Function: DspInversePark ====================================================================
+///
+/// @brief  Funktion fhrt die inverse Park-Transformation mit Sinus und Kosinus des
+///					Drehwinkels aus
+///
+/// @param  const DspDq *in, float sinTheta, float cosTheta, DspAlphaBeta *out
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspInversePark(const DspDq *in, float sinTheta, float cosTheta,
+																	DspAlphaBeta *out)
+{
+		out->alpha = in->d * cosTheta - in->q * sinTheta;
+		out->beta = in->d * sinTheta + in->q * cosTheta;
+}
+
+
+//=== Function: DspPllInit ========================================================================
+///
+/// @brief  Funktion initialisiert die PLL mit Reglerparametern und Nennfrequenz
+///					(in Umdrehungen pro Abtastschritt)
+///
+/// @param  DspPll *pll, float kp, float ki, float omegaNominal
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspPllInit(DspPll *pll, float kp, float ki, float omegaNominal)
+{
+		pll->kp = kp;
+		pll->ki = ki;
+		pll->omegaNominal = omegaNominal;
+		pll->integral = 0.0f;
+		pll->omega = omegaNominal;
+		pll->theta = 0.0f;
+		pll->sinTheta = 0.0f;
+		pll->cosTheta = 1.0f;
+}
+
+
+//=== Function: DspPllRun =========================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt der PLL aus. Die q-Komponente des Zeigers wird mit
+///					dem PI-Regler auf 0 geregelt, der Winkel folgt damit dem Zeiger. Der Zeiger sollte
+///					normiert sein (Betrag 1), damit die Reglerparameter unabhngig von der Amplitude
+///					sind
+///
+/// @param  DspPll *pll, const DspAlphaBeta *in
+///
+/// @return float theta
+///
+//=================================================================================================
+static inline float DspPllRun(DspPll *pll, const DspAlphaBeta *in)
+{
+		DspDq dq;
+
+		DspPark(in, pll->sinTheta, pll->cosTheta, &dq);
+
+		pll->integral += pll->ki * dq.q;
+		pll->omega = pll->omegaNominal + pll->kp * dq.q + pll->integral;
+
+		pll->theta += pll->omega;
+		if (pll->theta >= 1.0f)
+				pll->theta -= 1.0f;
+		else if (pll->theta < 0.0f)
+				pll->theta += 1.0f;
+
+		pll->sinTheta = DspSinPu(pll->theta);
+		pll->cosTheta = DspCosPu(pll->theta);
+
+		return pll->theta;
+}
+
+
+//=== Function: DspSaturate =======================================================================
+///
+/// @brief  Funktion begrenzt "x" auf min ... max
+///
+/// @param  float x, float min, float max
+///
+/// @return float limited
+///
+//=================================================================================================
+static inline float DspSaturate(float x, float min, float max)
+{
+		if (x > max)
+				return max;
+		if (x < min)
+				return min;
+		return x;
+}
+
+
+//=== Function: DspPiReset ========================================================================
+///
+/// @brief  Funktion setzt den Zustand eines PI-Reglers zurck
+///
+/// @param  DspPi *pi
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspPiReset(DspPi *pi)
+{
+		pi->integral = 0.0f;
+}
+
+
+//=== Function: DspPiRun ==========================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt des PI-Reglers aus. Die Stellgre wird auf
+///					outputMin ... outputMax begrenzt, der Integrator luft dabei nicht weiter ber die
+///					Grenze hinaus (Anti-Windup, wie ClaPiRun())
+///
+/// @param  DspPi *pi, float error
+///
+/// @return float output
+///
+//=================================================================================================
+static inline float DspPiRun(DspPi *pi, float error)
+{
+		float integral = pi->integral + pi->ki * error;
+		float output = pi->kp * error + integral;
+
+		if (output > pi->outputMax)
+		{
+				output = pi->outputMax;
+				if (integral < pi->integral)
+						pi->integral = integral;
+		}
+		else if (output < pi->outputMin)
+		{
+				output = pi->outputMin;
+				if (integral > pi->integral)
+						pi->integral = integral;
+		}
+		else
+		{
+				pi->integral = integral;
+		}
+
+		return output;
+}
+
+
+//=== Function: DspSvm ============================================================================
+///
+/// @brief  Funktion berechnet die Tastverhltnisse einer Raumzeigermodulation (SVPWM) aus dem
+///					Spannungszeiger. Zu den Phasenspannungen wird das Nullsystem
+///					-(max + min) / 2 addiert (gleichwertig zur Verteilung der Nullzeiger auf beide
+///					Seiten), die Tastverhltnisse werden auf 0 ... 1 begrenzt
+///
+/// @param  const DspAlphaBeta *voltage (bezogen auf die Zwischenkreisspannung), DspAbc *duty
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspSvm(const DspAlphaBeta *voltage, DspAbc *duty)
+{
+		float a = voltage->alpha;
+		float b = -0.5f * voltage->alpha + DSP_SQRT3_2 * voltage->beta;
+		float c = -0.5f * voltage->alpha - DSP_SQRT3_2 * voltage->beta;
+		float max = (a > b) ? a : b;
+		float min = (a < b) ? a : b;
+		float offset;
+
+		if (c > max)
+				max = c;
+		if (c < min)
+				min = c;
+		offset = 0.5f - 0.5f * (max + min);
+
+		duty->a = DspSaturate(a + offset, 0.0f, 1.0f);
+		duty->b = DspSaturate(b + offset, 0.0f, 1.0f);
+		duty->c = DspSaturate(c + offset, 0.0f, 1.0f);
+}
+
+
+//=== Function: DspFocInit ========================================================================
+///
+/// @brief  Funktion initialisiert die Stromregler der FOC. Die Stellgren beider Achsen werden
+///					auf +-voltageLimit begrenzt (bezogen auf die Zwischenkreisspannung)
+///
+/// @param  DspFoc *foc, float kp, float ki, float voltageLimit
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspFocInit(DspFoc *foc, float kp, float ki, float voltageLimit)
+{
+		foc->piD.kp = kp;
+		foc->piD.ki = ki;
+		foc->piD.outputMin = -voltageLimit;
+		foc->piD.outputMax = voltageLimit;
+		foc->piQ.kp = kp;
+		foc->piQ.ki = ki;
+		foc->piQ.outputMin = -voltageLimit;
+		foc->piQ.outputMax = voltageLimit;
+		DspPiReset(&foc->piD);
+		DspPiReset(&foc->piQ);
+		foc->idReference = 0.0f;
+		foc->iqReference = 0.0f;
+}
+
+
+//=== Function: DspFocRun =========================================================================
+///
+/// @brief  Funktion fhrt einen Abtastschritt der FOC aus: Clarke- und Park-Transformation der
+///					Phasenstrme a und b, PI-Regler der d- und q-Achse, inverse Park-Transformation und
+///					Raumzeigermodulation. Die Tastverhltnisse stehen danach in foc->duty
+///
+/// @param  DspFoc *foc, float ia, float ib, float sinTheta, float cosTheta
+///
+/// @return void
+///
+//=================================================================================================
+static inline void DspFocRun(DspFoc *foc, float ia, float ib, float sinTheta, float cosTheta)
+{
+		DspClarke(ia, ib, &foc->current);
+		DspPark(&foc->current, sinTheta, cosTheta, &foc->currentDq);
+
+		foc->voltageDq.d = DspPiRun(&foc->piD, foc->idReference - foc->currentDq.d);
+		foc->voltageDq.q = DspPiRun(&foc->piQ, foc->iqReference - foc->currentDq.q);
+
+		DspInversePark(&foc->voltageDq, sinTheta, cosTheta, &foc->voltage);
+		DspSvm(&foc->voltage, &foc->duty);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion misst die Laufzeit jedes Kernels auf der CPU (dspBenchmarkCycles)
+extern void DspBenchmark(void);
+// CLA-Task 8. Misst die Laufzeit jedes Kernels auf dem CLA (claDspBenchmarkCycles)
+__interrupt void ClaTask8(void);
+
+
+#endif
@@ -9,9 +9,14 @@
 ///						ist GPIO 2. Hinweis: Dieses Projekt ist Driverlib-basiert, weil die .syscfg-Datei
 ///						Header- und Source-Dateien erzeugt, welche auf die Driverlib zugreift.
 ///
-/// @version	V1.1
+///						nderung in Version 1.2: Die Datei "empty.syscfg" enthlt zwei Tile-Konfigurationen
+///						(TILE1: UND-Gatter, TILE2: ODER-Gatter). Beide liegen in der Tabelle
+///						"clbConfigurations" und werden ber myCLB zur Laufzeit auf CLB1 geladen, je
+///						nachdem welcher Wert in "clbMode" steht (z.B. im Debugger ndern).
 ///
-/// @date			08.09.2022
+/// @version	V1.2
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -20,6 +25,7 @@
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
 #include "clb_config.h"
+#include "myCLB.h"
 
 
 // Grundlagen CLB:
@@ -94,15 +100,10 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
-// Aus hw_memmap.h
-#define CLB1_BASE                 0x00003000U
-#define CLB2_BASE                 0x00003200U
-#define CLB3_BASE                 0x00003400U
-#define CLB4_BASE                 0x00003600U
-#define CLB5_BASE                 0x00003800U
-#define CLB6_BASE                 0x00003A00U
-#define CLB7_BASE                 0x00003C00U
-#define CLB8_BASE                 0x00003E00U
+// Index der Tile-Konfigurationen in "clbConfigurations"
+#define CLB_CONFIG_AND            0
+#define CLB_CONFIG_OR             1
+#define CLB_NUMBER_OF_CONFIGS     2
 
 
 //-------------------------------------------------------------------------------------------------
@@ -113,6 +114,14 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Vorkompilierte Tile-Konfigurationen des CLB-Tools (Flash)
+const ClbTileConfiguration clbConfigurations[CLB_NUMBER_OF_CONFIGS] =
+{
+		{"AND", initTILE1},
+		{"OR",  initTILE2}
+};
+// Gewnschte Konfiguration von CLB1 (CLB_CONFIG_AND oder CLB_CONFIG_OR)
+volatile uint16_t clbMode = CLB_CONFIG_AND;
 
 
 //=== Function: main ==============================================================================
@@ -160,13 +169,13 @@ void main(void)
     // 8: Teiler = 8
     ClkCfgRegs.CLBCLKCTL.bit.TILECLKDIV = 0;
     */
-    // CLB-Block initialisieren
-    initTILE1(CLB1_BASE);
+    // Tabelle der Tile-Konfigurationen bernehmen, die erste
+    // Konfiguration auf CLB1 laden und das CLB-Modul einschalten
+    ClbInit(clbConfigurations, CLB_NUMBER_OF_CONFIGS);
+    ClbLoadConfiguration(1, clbMode);
     // Nach dem Funktionsaufruf muss der
     // Schreibschutz erneut aufgehoben werden
     EALLOW;
-    // CLB-Modul einschalten
-    Clb1LogicCtrlRegs.CLB_LOAD_EN.bit.GLOBAL_EN = 1;
     // Alle CLB_LOGIC_CONFIG_REGS- und einige der
     // CLB_LOGIC_CONTROL_REGS-Register knnen nur
     // mit deaktiviertem Schreibschutz bearbeitet
@@ -359,7 +368,9 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-
+    		// Konfiguration von CLB1 bei einer nderung von "clbMode" austauschen,
+    		// die Ein- und Ausgnge bleiben dabei erhalten
+    		ClbLoadConfiguration(1, clbMode);
     }
 }
 
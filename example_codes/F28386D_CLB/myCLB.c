@@ -0,0 +1,372 @@
+//=================================================================================================
+/// @file       myCLB.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen zur Verwaltung der CLB-Instanzen CLB1 bis
+///							CLB8 des TMS320F2838x. Tile-Konfigurationen des CLB-Tools werden zur Laufzeit
+///							ein- und ausgetauscht, HLC-Programme nachgeladen und die FIFOs gelesen bzw.
+///							beschrieben. Die Ein- und Ausgnge der Instanzen (globale/lokale Multiplexer,
+///							CLB X-Bar, Output X-Bar) sind nicht Teil der Tile-Konfiguration und bleiben
+///							beim Austausch erhalten
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCLB.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Adressen der Ladeschnittstelle (CLB_LOAD_ADDR), siehe Reference Manual TMS320F2838x,
+// SPRUII0D, Rev. D, July 2022, Abschnitt "CLB Register Access"
+#define CLB_ADDR_HLC_R0						0x0C
+#define CLB_ADDR_HLC_BASE					0x20
+// Zeiger der FIFOs im Register CLB_BUF_PTR
+#define CLB_BUF_PTR_PULL_MASK			0x000000FFUL
+#define CLB_BUF_PTR_PUSH_SHIFT		16
+#define CLB_BUF_PTR_PUSH_MASK			0x000000FFUL
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+uint16_t clbActiveConfiguration[CLB_NUMBER_OF_INSTANCES];
+// Tabelle der Tile-Konfigurationen (liegt als const-Tabelle im Flash)
+static const ClbTileConfiguration *clbConfigurationTable = 0;
+static uint16_t clbNumberOfConfigurations = 0;
+// Register und Basisadressen der Instanzen CLB1 bis CLB8
+static volatile struct CLB_LOGIC_CONTROL_REGS *const clbCtrlRegs[CLB_NUMBER_OF_INSTANCES] =
+{
+		&Clb1LogicCtrlRegs, &Clb2LogicCtrlRegs, &Clb3LogicCtrlRegs, &Clb4LogicCtrlRegs,
+		&Clb5LogicCtrlRegs, &Clb6LogicCtrlRegs, &Clb7LogicCtrlRegs, &Clb8LogicCtrlRegs
+};
+static volatile struct CLB_DATA_EXCHANGE_REGS *const clbDataRegs[CLB_NUMBER_OF_INSTANCES] =
+{
+		&Clb1DataExchRegs, &Clb2DataExchRegs, &Clb3DataExchRegs, &Clb4DataExchRegs,
+		&Clb5DataExchRegs, &Clb6DataExchRegs, &Clb7DataExchRegs, &Clb8DataExchRegs
+};
+static const uint32_t clbBase[CLB_NUMBER_OF_INSTANCES] =
+{
+		CLB1_BASE, CLB2_BASE, CLB3_BASE, CLB4_BASE, CLB5_BASE, CLB6_BASE, CLB7_BASE, CLB8_BASE
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClbWriteInterface =================================================================
+///
+/// @brief	Funktion schreibt einen Wert ber die Ladeschnittstelle in das HLC-Register bzw. den
+///					HLC-Befehl "address" einer Instanz. Der Schreibschutz muss aufgehoben sein
+///
+/// @param  volatile struct CLB_LOGIC_CONTROL_REGS *regs, uint16_t address, uint32_t value
+///
+/// @return void
+///
+//=================================================================================================
+static void ClbWriteInterface(volatile struct CLB_LOGIC_CONTROL_REGS *regs, uint16_t address,
+							  uint32_t value)
+{
+		regs->CLB_LOAD_ADDR.all = address;
+		regs->CLB_LOAD_DATA = value;
+		regs->CLB_LOAD_EN.bit.LOAD_EN = 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ClbInit ===========================================================================
+///
+/// @brief	Funktion bernimmt die Tabelle der Tile-Konfigurationen. Der Index einer Konfiguration
+///					in der Tabelle wird an ClbLoadConfiguration() bergeben. Zu Beginn ist keine
+///					Konfiguration geladen
+///
+/// @param  const ClbTileConfiguration *table, uint16_t numberOfConfigurations
+///
+/// @return void
+///
+//=================================================================================================
+void ClbInit(const ClbTileConfiguration *table, uint16_t numberOfConfigurations)
+{
+		clbConfigurationTable = table;
+		clbNumberOfConfigurations = numberOfConfigurations;
+		for (uint16_t i = 0; i < CLB_NUMBER_OF_INSTANCES; i++)
+				clbActiveConfiguration[i] = CLB_NO_CONFIGURATION;
+}
+
+//=== Function: ClbLoadConfiguration ==============================================================
+///
+/// @brief	Funktion ldt die Konfiguration "configuration" der Tabelle auf die Instanz "instance"
+///					(1 ... 8): Takt einschalten, Logik anhalten, FIFOs und Interrupt-Tag lschen,
+///					Initialisierungsfunktion des CLB-Tools aufrufen und Logik wieder einschalten.
+///					Ist die Konfiguration bereits geladen, wird nichts verndert
+///
+/// @param  uint16_t instance, uint16_t configuration
+///
+/// @return bool loaded (false: ungltige Instanz oder Konfiguration, Instanz gesperrt)
+///
+//=================================================================================================
+bool ClbLoadConfiguration(uint16_t instance, uint16_t configuration)
+{
+		volatile struct CLB_LOGIC_CONTROL_REGS *regs;
+
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES
+				|| configuration >= clbNumberOfConfigurations)
+				return false;
+		if (clbActiveConfiguration[instance - 1] == configuration)
+				return true;
+		if (ClbIsLocked(instance))
+				return false;
+
+		regs = clbCtrlRegs[instance - 1];
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+		// Takt fr das CLB-Modul einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR17.all |= 1UL << (instance - 1);
+		__asm(" RPT #4 || NOP");
+		// Logik anhalten, solange die Konfiguration geschrieben wird
+		regs->CLB_LOAD_EN.bit.GLOBAL_EN = 0;
+		regs->CLB_INTR_TAG_REG.all = 0;
+		ClbClearFifo(instance);
+
+		// Die Funktion des CLB-Tools setzt am Ende den Schreibschutz
+		clbConfigurationTable[configuration].init(clbBase[instance - 1]);
+
+		EALLOW;
+		regs->CLB_LOAD_EN.bit.GLOBAL_EN = 1;
+		EDIS;
+
+		clbActiveConfiguration[instance - 1] = configuration;
+		return true;
+}
+
+//=== Function: ClbUnloadConfiguration ============================================================
+///
+/// @brief	Funktion hlt die Logik einer Instanz an. Die Ausgnge der Instanz bleiben auf dem
+///					zuletzt ausgegebenen Zustand
+///
+/// @param  uint16_t instance
+///
+/// @return bool unloaded (false: ungltige Instanz oder Instanz gesperrt)
+///
+//=================================================================================================
+bool ClbUnloadConfiguration(uint16_t instance)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES || ClbIsLocked(instance))
+				return false;
+
+		EALLOW;
+		clbCtrlRegs[instance - 1]->CLB_LOAD_EN.bit.GLOBAL_EN = 0;
+		EDIS;
+
+		clbActiveConfiguration[instance - 1] = CLB_NO_CONFIGURATION;
+		return true;
+}
+
+//=== Function: ClbLoadHlcProgram =================================================================
+///
+/// @brief	Funktion ldt bis zu 8 Befehle in das HLC-Programm "program" (0 ... 3, ausgelst durch
+///					HLC-Event 0 ... 3) einer Instanz. Die Befehle haben das Format des CLB-Tools
+///					(z.B. TILE1_HLCINSTR_0 aus clb_config.h). Die Logik wird whrenddessen angehalten
+///
+/// @param  uint16_t instance, uint16_t program, const uint16_t *instructions,
+///					uint16_t numberOfInstructions
+///
+/// @return bool loaded (false: ungltige Parameter oder Instanz gesperrt)
+///
+//=================================================================================================
+bool ClbLoadHlcProgram(uint16_t instance, uint16_t program, const uint16_t *instructions,
+					   uint16_t numberOfInstructions)
+{
+		volatile struct CLB_LOGIC_CONTROL_REGS *regs;
+		uint16_t enabled;
+
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES
+				|| program >= CLB_NUMBER_OF_HLC_PROGRAMS
+				|| numberOfInstructions > CLB_HLC_PROGRAM_SIZE
+				|| ClbIsLocked(instance))
+				return false;
+
+		regs = clbCtrlRegs[instance - 1];
+
+		EALLOW;
+		enabled = regs->CLB_LOAD_EN.bit.GLOBAL_EN;
+		regs->CLB_LOAD_EN.bit.GLOBAL_EN = 0;
+		for (uint16_t i = 0; i < numberOfInstructions; i++)
+				ClbWriteInterface(regs, CLB_ADDR_HLC_BASE + program * CLB_HLC_PROGRAM_SIZE + i,
+								  instructions[i]);
+		regs->CLB_LOAD_EN.bit.GLOBAL_EN = enabled;
+		EDIS;
+
+		return true;
+}
+
+//=== Function: ClbWriteHlcRegister ===============================================================
+///
+/// @brief	Funktion schreibt den Startwert eines HLC-Registers (0 ... 3 = R0 ... R3)
+///
+/// @param  uint16_t instance, uint16_t hlcRegister, uint32_t value
+///
+/// @return bool written (false: ungltige Parameter oder Instanz gesperrt)
+///
+//=================================================================================================
+bool ClbWriteHlcRegister(uint16_t instance, uint16_t hlcRegister, uint32_t value)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES
+				|| hlcRegister >= CLB_NUMBER_OF_HLC_REGISTERS || ClbIsLocked(instance))
+				return false;
+
+		EALLOW;
+		ClbWriteInterface(clbCtrlRegs[instance - 1], CLB_ADDR_HLC_R0 + hlcRegister, value);
+		EDIS;
+
+		return true;
+}
+
+//=== Function: ClbClearFifo ======================================================================
+///
+/// @brief	Funktion setzt die Zeiger der PUSH- und PULL-FIFO zurck und lscht deren Inhalt
+///
+/// @param  uint16_t instance
+///
+/// @return void
+///
+//=================================================================================================
+void ClbClearFifo(uint16_t instance)
+{
+		volatile struct CLB_DATA_EXCHANGE_REGS *data;
+
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return;
+
+		data = clbDataRegs[instance - 1];
+
+		EALLOW;
+		clbCtrlRegs[instance - 1]->CLB_BUF_PTR.all = 0;
+		for (uint16_t i = 0; i < CLB_FIFO_DEPTH; i++)
+		{
+				data->CLB_PUSH[i] = 0;
+				data->CLB_PULL[i] = 0;
+		}
+		EDIS;
+}
+
+//=== Function: ClbWriteFifo ======================================================================
+///
+/// @brief	Funktion lscht die FIFOs und schreibt 4 Werte in die PULL-FIFO, welche das HLC-
+///					Programm mit dem Befehl PULL nacheinander liest
+///
+/// @param  uint16_t instance, const uint32_t data[CLB_FIFO_DEPTH]
+///
+/// @return void
+///
+//=================================================================================================
+void ClbWriteFifo(uint16_t instance, const uint32_t data[CLB_FIFO_DEPTH])
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return;
+
+		ClbClearFifo(instance);
+		for (uint16_t i = 0; i < CLB_FIFO_DEPTH; i++)
+				clbDataRegs[instance - 1]->CLB_PULL[i] = data[i];
+}
+
+//=== Function: ClbReadFifo =======================================================================
+///
+/// @brief	Funktion liest die 4 Werte der PUSH-FIFO, welche das HLC-Programm mit dem Befehl PUSH
+///					geschrieben hat. Die Anzahl der gltigen Werte liefert ClbGetPushCount()
+///
+/// @param  uint16_t instance, uint32_t data[CLB_FIFO_DEPTH]
+///
+/// @return void
+///
+//=================================================================================================
+void ClbReadFifo(uint16_t instance, uint32_t data[CLB_FIFO_DEPTH])
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return;
+
+		for (uint16_t i = 0; i < CLB_FIFO_DEPTH; i++)
+				data[i] = clbDataRegs[instance - 1]->CLB_PUSH[i];
+}
+
+//=== Function: ClbGetPushCount ===================================================================
+///
+/// @brief	Funktion liefert die Anzahl der vom HLC geschriebenen Werte der PUSH-FIFO
+///
+/// @param  uint16_t instance
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+uint16_t ClbGetPushCount(uint16_t instance)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return 0;
+
+		return (clbCtrlRegs[instance - 1]->CLB_BUF_PTR.all >> CLB_BUF_PTR_PUSH_SHIFT)
+				& CLB_BUF_PTR_PUSH_MASK;
+}
+
+//=== Function: ClbGetPullCount ===================================================================
+///
+/// @brief	Funktion liefert die Anzahl der vom HLC gelesenen Werte der PULL-FIFO
+///
+/// @param  uint16_t instance
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+uint16_t ClbGetPullCount(uint16_t instance)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return 0;
+
+		return clbCtrlRegs[instance - 1]->CLB_BUF_PTR.all & CLB_BUF_PTR_PULL_MASK;
+}
+
+//=== Function: ClbLock ===========================================================================
+///
+/// @brief	Funktion sperrt die Konfigurationsregister einer Instanz. Das Bit kann nur einmal
+///					gesetzt werden und wird erst durch einen Reset gelscht, danach kann keine andere
+///					Konfiguration mehr geladen werden
+///
+/// @param  uint16_t instance
+///
+/// @return void
+///
+//=================================================================================================
+void ClbLock(uint16_t instance)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return;
+
+		EALLOW;
+		clbCtrlRegs[instance - 1]->CLB_LOCK.bit.LOCK = 1;
+		EDIS;
+}
+
+//=== Function: ClbIsLocked =======================================================================
+///
+/// @brief	Funktion liefert true, wenn die Konfigurationsregister einer Instanz gesperrt sind
+///
+/// @param  uint16_t instance
+///
+/// @return bool locked (ungltige Instanz: true)
+///
+//=================================================================================================
+bool ClbIsLocked(uint16_t instance)
+{
+		if (instance < 1 || instance > CLB_NUMBER_OF_INSTANCES)
+				return true;
+
+		return clbCtrlRegs[instance - 1]->CLB_LOCK.bit.LOCK == 1;
+}
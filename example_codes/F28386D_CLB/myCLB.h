@@ -0,0 +1,98 @@
+//=================================================================================================
+/// @file       myCLB.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen zur Verwaltung der CLB-Instanzen CLB1 bis
+///							CLB8 des TMS320F2838x. Die mit dem CLB-Tool erzeugten Initialisierungsfunktionen
+///							(initTILE1(), initTILE2(), ...) beschreiben jeweils eine vollstndige Tile-
+///							Konfiguration und knnen auf jede Instanz geladen werden. Mehrere dieser
+///							Konfigurationen werden in einer Tabelle im Flash abgelegt und zur Laufzeit je
+///							nach Betriebsart ein- und ausgetauscht, solange die Instanz nicht gesperrt ist
+///							(CLB_LOCK kann nur einmal gesetzt werden). Zustzlich knnen HLC-Programme
+///							nachgeladen und Daten ber die FIFOs (PUSH/PULL) ausgetauscht werden
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCLB_H_
+#define MYCLB_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Basisadressen der CLB-Instanzen fr die Initialisierungsfunktionen des CLB-Tools
+// (aus hw_memmap.h)
+#define CLB1_BASE									0x00003000U
+#define CLB2_BASE									0x00003200U
+#define CLB3_BASE									0x00003400U
+#define CLB4_BASE									0x00003600U
+#define CLB5_BASE									0x00003800U
+#define CLB6_BASE									0x00003A00U
+#define CLB7_BASE									0x00003C00U
+#define CLB8_BASE									0x00003E00U
+// Anzahl der CLB-Instanzen (CLB1 bis CLB8)
+#define CLB_NUMBER_OF_INSTANCES		8
+// HLC: 4 Programme mit je 8 Befehlen, 4 Register (R0 bis R3)
+#define CLB_NUMBER_OF_HLC_PROGRAMS	4
+#define CLB_HLC_PROGRAM_SIZE			8
+#define CLB_NUMBER_OF_HLC_REGISTERS	4
+// Tiefe der PUSH- und PULL-FIFO
+#define CLB_FIFO_DEPTH						4
+// Keine Konfiguration geladen
+#define CLB_NO_CONFIGURATION			0xFFFF
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Initialisierungsfunktion des CLB-Tools (z.B. initTILE1), Parameter ist die Basisadresse
+typedef void (*ClbTileInitFunction)(uint32_t base);
+
+// Eine vorkompilierte Tile-Konfiguration
+typedef struct
+{
+		const char *name;
+		ClbTileInitFunction init;
+} ClbTileConfiguration;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Geladene Konfiguration jeder Instanz (CLB_NO_CONFIGURATION: keine)
+extern uint16_t clbActiveConfiguration[CLB_NUMBER_OF_INSTANCES];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion bernimmt die Tabelle der Tile-Konfigurationen
+extern void ClbInit(const ClbTileConfiguration *table, uint16_t numberOfConfigurations);
+// Funktion ldt eine Konfiguration der Tabelle auf eine Instanz und schaltet sie ein
+extern bool ClbLoadConfiguration(uint16_t instance, uint16_t configuration);
+// Funktion schaltet eine Instanz aus
+extern bool ClbUnloadConfiguration(uint16_t instance);
+// Funktion ldt ein HLC-Programm auf eine Instanz
+extern bool ClbLoadHlcProgram(uint16_t instance, uint16_t program, const uint16_t *instructions,
+							  uint16_t numberOfInstructions);
+// Funktion schreibt ein HLC-Register (R0 bis R3) einer Instanz
+extern bool ClbWriteHlcRegister(uint16_t instance, uint16_t hlcRegister, uint32_t value);
+// Funktionen fr den Datenaustausch ber die FIFOs
+extern void ClbClearFifo(uint16_t instance);
+extern void ClbWriteFifo(uint16_t instance, const uint32_t data[CLB_FIFO_DEPTH]);
+extern void ClbReadFifo(uint16_t instance, uint32_t data[CLB_FIFO_DEPTH]);
+extern uint16_t ClbGetPushCount(uint16_t instance);
+extern uint16_t ClbGetPullCount(uint16_t instance);
+// Funktion sperrt die Konfiguration einer Instanz bis zum nchsten Reset
+extern void ClbLock(uint16_t instance);
+extern bool ClbIsLocked(uint16_t instance);
+
+
+#endif
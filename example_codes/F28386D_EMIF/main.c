@@ -0,0 +1,99 @@
+//=================================================================================================
+/// @file			main.c
+///
+/// @brief		Enthlt das Hauptprogramm zur Demonstration des Moduls "myEMIF.c". EMIF1 betreibt
+///						einen SDRAM an CS0 und einen SRAM an CS2, beide werden nach dem Start geprft.
+///						Danach zeichnet der DMA vier Kanle des ADC-A ohne CPU in einen Ringpuffer im
+///						SDRAM auf. Ein Trigger (z.B. im Debugger) beendet die Aufzeichnung, die Messwerte
+///						vor und nach dem Trigger liest EmifCaptureRead(). Erklrungen zur genauen
+///						Funktion sind im Modul zu finden.
+///
+/// @version	V1.0
+///
+/// @date			14.10.2026
+///
+/// @author		Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myEMIF.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Geprfte Wrter am Anfang des SDRAM (der ganze SDRAM dauert einige Sekunden)
+#define SDRAM_TEST_WORDS			0x00100000UL
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Fehler des Speichertests (0: in Ordnung)
+uint32_t emifSdramErrors = 0;
+uint32_t emifSramErrors = 0;
+// Aufzeichnung beenden bzw. neu starten (z.B. im Debugger auf 1 setzen)
+volatile uint16_t emifTriggerRequest = 0;
+volatile uint16_t emifRestartRequest = 0;
+
+
+//=== Function: main ==============================================================================
+///
+/// @brief  Hauptprogramm
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
+		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+
+#ifdef _FLASH
+		// Ausfhrungsgeschwindigkeit aus dem Flash fr das gewhlte Flash-Profil sowie ohne
+		// ECC, ohne Cache/Prefetch und mit einem zustzlichen Wartezustand messen
+		// (Ergebnisse in "deviceFlashBenchmark", z.B. im Debugger ansehen)
+		DeviceBenchmarkFlash();
+#endif
+
+		// EMIF1 mit SDRAM und SRAM initialisieren und den Speicher prfen
+		// (der Test berschreibt den Inhalt, daher vor dem Start der Aufzeichnung)
+		EmifInit();
+		emifSdramErrors = EmifMemoryTest(EMIF_SDRAM_ADDRESS, SDRAM_TEST_WORDS);
+		emifSramErrors = EmifMemoryTest(EMIF_SRAM_ADDRESS, EMIF_SRAM_WORDS);
+
+		// ePWM1, ADC-A und DMA initialisieren, die Aufzeichnung luft danach ohne CPU
+		EmifCaptureStart();
+
+    // Register-Schreibschutz ausschalten
+    EALLOW;
+
+		// Dauerschleife Hauptprogramm
+    while(1)
+    {
+    		// Anhalten des DMA nach dem Trigger erkennen
+    		EmifCaptureService();
+
+    		if (emifTriggerRequest)
+    		{
+    				emifTriggerRequest = 0;
+    				EmifCaptureTrigger();
+    		}
+
+    		// Neue Aufzeichnung erst nach dem Ende der laufenden starten
+    		if (emifRestartRequest && (emifCapture.state == EMIF_CAPTURE_DONE))
+    		{
+    				emifRestartRequest = 0;
+    				EmifCaptureStart();
+    		}
+    }
+}
+
@@ -0,0 +1,494 @@
+//=================================================================================================
+/// @file       myEMIF.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um SDRAM und SRAM am EMIF1-Modul zu betreiben
+///							und ADC-Messwerte mit dem DMA in den SDRAM aufzuzeichnen (siehe myEMIF.h)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myEMIF.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Register eines GPIO-Ports in GpioCtrlRegs (32-Bit-Register, ein Port belegt 0x40 Worte),
+// Abstand in 32-Bit-Registern zum Beginn des Ports (siehe f2838x_gpio.h)
+#define EMIF_GPIO_PORT_REGS									0x20U
+#define EMIF_GPIO_QSEL1											1U
+#define EMIF_GPIO_MUX1											3U
+#define EMIF_GPIO_PUD												6U
+#define EMIF_GPIO_GMUX1											0x10U
+// Eingangsqualifizierung asynchron (GPxQSELy)
+#define EMIF_GPIO_QSEL_ASYNC								3UL
+// Anzahl der EMIF1-Pins der 16-Bit-Schnittstelle
+#define EMIF_NUMBER_OF_PINS									45
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer im SDRAM (NOLOAD, Zugriff der CPU nur mit __addr32_read_uint16())
+EMIF_SDRAM_DATA(emifCaptureBuffer)
+uint16_t emifCaptureBuffer[EMIF_CAPTURE_WORDS];
+volatile EmifCapture emifCapture;
+
+// GPIOs und Mux-Auswahl der 16-Bit-Schnittstelle (siehe myEMIF.h)
+static const uint16_t emifPins[EMIF_NUMBER_OF_PINS][2] =
+{
+		{29, 2}, {30, 2}, {31, 2}, {32, 2}, {33, 2}, {34, 2}, {37, 2},					// Steuersignale
+		{38, 2}, {39, 2}, {40, 2}, {41, 2},																			// EM1A0 ... 3
+		{44, 2}, {45, 2}, {46, 2}, {47, 2}, {48, 2}, {49, 2}, {50, 2}, {51, 2},	// EM1A4 ... 11
+		{52, 2}, {86, 2}, {87, 2},																							// EM1A12 ... 14
+		{69, 2}, {70, 2}, {71, 2}, {72, 2}, {73, 2}, {74, 2}, {75, 2}, {76, 2},	// EM1D15 ... 8
+		{77, 2}, {78, 2}, {79, 2}, {80, 2}, {81, 2}, {82, 2}, {83, 2}, {85, 2},	// EM1D7 ... 0
+		{88, 3}, {89, 3},																												// EM1DQM0/1
+		{92, 3}, {93, 3},																												// EM1BA1/0
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EmifSetupPin ======================================================================
+///
+/// @brief  Funktion schaltet einen GPIO auf eine Funktion des EMIF1 (Mux 0 ... 15), mit Pull-up
+///					und asynchroner Eingangsqualifizierung (wie GPIO_SetupPinMux() und
+///					GPIO_SetupPinOptions() aus C2000Ware). Der Register-Schreibschutz muss aufgehoben
+///					sein
+///
+/// @param  uint16_t pin, uint16_t mux
+///
+/// @return void
+///
+//=================================================================================================
+static void EmifSetupPin(uint16_t pin, uint16_t mux)
+{
+		volatile uint32_t *port = (volatile uint32_t *)&GpioCtrlRegs + (pin / 32U) * EMIF_GPIO_PORT_REGS;
+		uint16_t half = (pin % 32U) / 16U;
+		uint16_t shift = (pin % 16U) * 2U;
+		uint32_t mask = 3UL << shift;
+
+		// Erst auf GPIO schalten, dann Gruppe und Mux setzen (keine kurzen Fehlfunktionen am Pin)
+		port[EMIF_GPIO_MUX1 + half] &= ~mask;
+		port[EMIF_GPIO_GMUX1 + half] = (port[EMIF_GPIO_GMUX1 + half] & ~mask)
+				| ((uint32_t)(mux >> 2) << shift);
+		port[EMIF_GPIO_MUX1 + half] |= (uint32_t)(mux & 3U) << shift;
+
+		port[EMIF_GPIO_QSEL1 + half] |= EMIF_GPIO_QSEL_ASYNC << shift;
+		port[EMIF_GPIO_PUD] &= ~(1UL << (pin % 32U));
+}
+
+
+//=== Function: EmifCaptureInitAdc ================================================================
+///
+/// @brief  Funktion initialisiert ePWM1 (SOCA mit EMIF_CAPTURE_FREQUENCY_HZ) und die SOCs
+///					0 ... 3 des ADC-A (ADCIN0 ... 3). Das EOC von SOC3 setzt ADCINT1 (kontinuierlich,
+///					Trigger des DMA). Der Register-Schreibschutz muss aufgehoben sein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void EmifCaptureInitAdc(void)
+{
+		// ePWM1 anhalten, hochzhlen, SOCA beim Zhlerstand 0
+		CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+		__asm(" RPT #4 || NOP");
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+		EPwm1Regs.TBCTL.bit.CTRMODE = 0;
+		EPwm1Regs.TBCTL.bit.HSPCLKDIV = 0;
+		EPwm1Regs.TBCTL.bit.CLKDIV = 0;
+		EPwm1Regs.TBPRD = EMIF_CAPTURE_PWM_PERIOD;
+		EPwm1Regs.TBCTR = 0;
+		EPwm1Regs.ETSEL.bit.SOCASEL = 1;
+		EPwm1Regs.ETPS.bit.SOCAPRD = 1;
+		EPwm1Regs.ETSEL.bit.SOCAEN = 1;
+
+		// ADC-A einschalten (ADCCLK = SYSCLK / 4), 12 Bit, single-ended, 1 ms warten
+		CpuSysRegs.PCLKCR13.bit.ADC_A = 1;
+		__asm(" RPT #4 || NOP");
+		AdcaRegs.ADCCTL2.bit.PRESCALE = 6;
+		AdcaRegs.ADCCTL2.bit.RESOLUTION = 0;
+		AdcaRegs.ADCCTL2.bit.SIGNALMODE = 0;
+		AdcaRegs.ADCCTL1.bit.INTPULSEPOS = 1;
+		AdcaRegs.ADCCTL1.bit.ADCPWDNZ = 1;
+		DELAY_US(1000);
+
+		// SOC0 ... 3: ADCIN0 ... 3, Trigger ePWM1 SOCA
+		AdcaRegs.ADCSOC0CTL.bit.CHSEL = 0;
+		AdcaRegs.ADCSOC0CTL.bit.ACQPS = EMIF_CAPTURE_ACQPS;
+		AdcaRegs.ADCSOC0CTL.bit.TRIGSEL = EMIF_CAPTURE_ADC_TRIGGER_EPWM1_SOCA;
+		AdcaRegs.ADCSOC1CTL.bit.CHSEL = 1;
+		AdcaRegs.ADCSOC1CTL.bit.ACQPS = EMIF_CAPTURE_ACQPS;
+		AdcaRegs.ADCSOC1CTL.bit.TRIGSEL = EMIF_CAPTURE_ADC_TRIGGER_EPWM1_SOCA;
+		AdcaRegs.ADCSOC2CTL.bit.CHSEL = 2;
+		AdcaRegs.ADCSOC2CTL.bit.ACQPS = EMIF_CAPTURE_ACQPS;
+		AdcaRegs.ADCSOC2CTL.bit.TRIGSEL = EMIF_CAPTURE_ADC_TRIGGER_EPWM1_SOCA;
+		AdcaRegs.ADCSOC3CTL.bit.CHSEL = 3;
+		AdcaRegs.ADCSOC3CTL.bit.ACQPS = EMIF_CAPTURE_ACQPS;
+		AdcaRegs.ADCSOC3CTL.bit.TRIGSEL = EMIF_CAPTURE_ADC_TRIGGER_EPWM1_SOCA;
+
+		// ADCINT1 nach dem letzten SOC, kontinuierlich (das Flag muss nicht gelscht werden)
+		AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = EMIF_CAPTURE_CHANNELS - 1;
+		AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1;
+		AdcaRegs.ADCINTSEL1N2.bit.INT1E = 1;
+		AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EmifInit ==========================================================================
+///
+/// @brief  Funktion initialisiert EMIF1 (siehe Kapitel "External Memory Interface (EMIF)" im
+///					Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+///					1. Takt EMIF1CLK = 100 MHz, CPU1 als Master, Zugriff von CPU und DMA erlaubt
+///					2. GPIOs der 16-Bit-Schnittstelle
+///					3. SDRAM an CS0: Zeiten und Refresh, das Schreiben von SDRAM_CR startet die
+///					   Initialisierungssequenz des SDRAMs (Precharge, Refresh, Mode-Register)
+///					4. SRAM an CS2: Setup-, Strobe- und Hold-Zeiten
+///					Danach sind die Sektionen "emifsdram" und "emifsram" nutzbar
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EmifInit(void)
+{
+		union SDRAM_CR_REG sdramControl;
+		uint16_t i;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// 1. Takt des EMIF1 einschalten (PLLSYSCLK / 2), CPU1 als Master, CPU-Schreib-, CPU-Fetch-
+		// und DMA-Schreibzugriffe erlauben
+		ClkCfgRegs.PERCLKDIVSEL.bit.EMIF1CLKDIV = EMIF_CLOCK_DIV_2;
+		CpuSysRegs.PCLKCR1.bit.EMIF1 = 1;
+		__asm(" RPT #4 || NOP");
+		Emif1ConfigRegs.EMIF1MSEL.all = EMIF_MSEL_KEY_CPU1;
+		Emif1ConfigRegs.EMIF1ACCPROT0.all = 0;
+
+		// 2. GPIOs
+		for (i = 0; i < EMIF_NUMBER_OF_PINS; i++)
+		{
+				EmifSetupPin(emifPins[i][0], emifPins[i][1]);
+		}
+
+		// 3. SDRAM: Einschaltzeit mit stabilem Takt abwarten, Zeiten vor SDRAM_CR setzen
+		DELAY_US(EMIF_SDRAM_POWER_UP_US);
+		Emif1Regs.SDRAM_TR.bit.T_RFC = EMIF_SDRAM_T_RFC;
+		Emif1Regs.SDRAM_TR.bit.T_RP = EMIF_SDRAM_T_RP;
+		Emif1Regs.SDRAM_TR.bit.T_RCD = EMIF_SDRAM_T_RCD;
+		Emif1Regs.SDRAM_TR.bit.T_WR = EMIF_SDRAM_T_WR;
+		Emif1Regs.SDRAM_TR.bit.T_RAS = EMIF_SDRAM_T_RAS;
+		Emif1Regs.SDRAM_TR.bit.T_RC = EMIF_SDRAM_T_RC;
+		Emif1Regs.SDRAM_TR.bit.T_RRD = EMIF_SDRAM_T_RRD;
+		Emif1Regs.SDR_EXT_TMNG.bit.T_XS = EMIF_SDRAM_T_XS;
+		Emif1Regs.SDRAM_RCR.bit.REFRESH_RATE = EMIF_SDRAM_REFRESH_RATE;
+		// Jeder Schreibzugriff auf SDRAM_CR startet die Sequenz, daher in einem Zugriff schreiben.
+		// CL wird nur mit BIT_11_9_LOCK = 1 bernommen, kein Self-Refresh, kein Power-Down
+		sdramControl.all = 0;
+		sdramControl.bit.NM = EMIF_SDRAM_NARROW_16BIT;
+		sdramControl.bit.BIT_11_9_LOCK = 1;
+		sdramControl.bit.CL = EMIF_SDRAM_CAS_LATENCY;
+		sdramControl.bit.IBANK = EMIF_SDRAM_BANKS_4;
+		sdramControl.bit.PAGESIGE = EMIF_SDRAM_PAGE_512;
+		Emif1Regs.SDRAM_CR.all = sdramControl.all;
+		// Initialisierungssequenz abwarten
+		DELAY_US(EMIF_SDRAM_POWER_UP_US);
+
+		// 4. SRAM an CS2: normaler Modus (kein Select-Strobe), kein Wait-Pin
+		Emif1Regs.ASYNC_CS2_CR.bit.SS = 0;
+		Emif1Regs.ASYNC_CS2_CR.bit.EW = 0;
+		Emif1Regs.ASYNC_CS2_CR.bit.ASIZE = EMIF_SRAM_ASIZE_16BIT;
+		Emif1Regs.ASYNC_CS2_CR.bit.W_SETUP = EMIF_SRAM_W_SETUP;
+		Emif1Regs.ASYNC_CS2_CR.bit.W_STROBE = EMIF_SRAM_W_STROBE;
+		Emif1Regs.ASYNC_CS2_CR.bit.W_HOLD = EMIF_SRAM_W_HOLD;
+		Emif1Regs.ASYNC_CS2_CR.bit.R_SETUP = EMIF_SRAM_R_SETUP;
+		Emif1Regs.ASYNC_CS2_CR.bit.R_STROBE = EMIF_SRAM_R_STROBE;
+		Emif1Regs.ASYNC_CS2_CR.bit.R_HOLD = EMIF_SRAM_R_HOLD;
+		Emif1Regs.ASYNC_CS2_CR.bit.TA = EMIF_SRAM_TA;
+
+		EDIS;
+
+		emifCapture.state = EMIF_CAPTURE_STOPPED;
+}
+
+
+//=== Function: EmifMemoryTest ====================================================================
+///
+/// @brief  Funktion prft einen Bereich des externen Speichers mit 32-Bit-Adressen (SDRAM und
+///					SRAM): erst wird jedes Wort mit einem Muster aus seiner Adresse beschrieben und
+///					geprft (Adress- und Datenleitungen), dann mit dem invertierten Muster (jedes Bit
+///					einmal 0 und 1). Der Inhalt des Bereichs geht verloren
+///
+/// @param  uint32_t address, uint32_t numberOfWords
+///
+/// @return uint32_t errors (Anzahl fehlerhafter Lesezugriffe)
+///
+//=================================================================================================
+uint32_t EmifMemoryTest(uint32_t address, uint32_t numberOfWords)
+{
+		uint32_t errors = 0;
+		uint32_t i;
+		uint16_t pass;
+		uint16_t pattern;
+
+		for (pass = 0; pass < 2; pass++)
+		{
+				uint16_t invert = (pass == 0) ? 0x0000 : 0xFFFF;
+
+				for (i = 0; i < numberOfWords; i++)
+				{
+						pattern = (uint16_t)i ^ (uint16_t)(i >> 16) ^ invert;
+						__addr32_write_uint16(address + i, pattern);
+				}
+				for (i = 0; i < numberOfWords; i++)
+				{
+						pattern = (uint16_t)i ^ (uint16_t)(i >> 16) ^ invert;
+						if (__addr32_read_uint16(address + i) != pattern)
+						{
+								errors++;
+						}
+				}
+		}
+
+		return errors;
+}
+
+
+//=== Function: EmifCaptureStart ==================================================================
+///
+/// @brief  Funktion initialisiert ePWM1, ADC-A und DMA CH1 und startet die Aufzeichnung in den
+///					Ringpuffer "emifCaptureBuffer". Pro ADCINT1 schreibt der DMA einen Burst aus
+///					ADCRESULT0 ... 3, nach EMIF_CAPTURE_SEGMENT_FRAMES Bursts beginnt die nchste
+///					bertragung (Dauerbetrieb) an der Adresse aus den Schattenregistern. Der
+///					Interrupt kommt zu Beginn jeder bertragung, die ISR hat damit ein ganzes Segment
+///					Zeit, die Adresse des folgenden Segments einzustellen. Eine laufende Aufzeichnung
+///					wird verworfen. EmifInit() muss vorher aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EmifCaptureStart(void)
+{
+		uint32_t buffer = (uint32_t)emifCaptureBuffer;
+
+		emifCapture.state = EMIF_CAPTURE_STOPPED;
+		emifCapture.segments = 0;
+		emifCapture.triggerFrame = 0;
+		emifCapture.stopSegment = 0;
+		emifCapture.preFrames = 0;
+		emifCapture.postFrames = 0;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		EmifCaptureInitAdc();
+
+		// Takt fr den DMA einschalten, DMA luft weiter, wenn der Debugger die CPU anhlt
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// DMA CH1: ein Burst ADCRESULT0 ... 3 pro Trigger, ein Segment pro bertragung
+		DmaRegs.CH1.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = (uint32_t)&AdcaResultRegs.ADCRESULT0;
+		DmaRegs.CH1.SRC_ADDR_SHADOW     = (uint32_t)&AdcaResultRegs.ADCRESULT0;
+		DmaRegs.CH1.DST_BEG_ADDR_SHADOW = buffer;
+		DmaRegs.CH1.DST_ADDR_SHADOW     = buffer;
+		DmaRegs.CH1.BURST_SIZE.bit.BURSTSIZE = EMIF_CAPTURE_CHANNELS - 1;
+		DmaRegs.CH1.SRC_BURST_STEP = 1;
+		DmaRegs.CH1.DST_BURST_STEP = 1;
+		DmaRegs.CH1.TRANSFER_SIZE = EMIF_CAPTURE_SEGMENT_FRAMES - 1;
+		// Nach einem Burst zurck auf ADCRESULT0, im Ziel direkt weiter
+		DmaRegs.CH1.SRC_TRANSFER_STEP = -(int16_t)(EMIF_CAPTURE_CHANNELS - 1);
+		DmaRegs.CH1.DST_TRANSFER_STEP = 1;
+		DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.SRC_WRAP_STEP = 0;
+		DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = EMIF_CAPTURE_DMA_TRIGGER_ADCAINT1;
+		DmaRegs.CH1.MODE.bit.PERINTSEL = 1;
+		DmaRegs.CH1.MODE.bit.PERINTE = 1;
+		DmaRegs.CH1.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH1.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH1.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH1.MODE.bit.DATASIZE = 0;
+		// Interrupt zu Beginn der bertragung
+		DmaRegs.CH1.MODE.bit.CHINTMODE = 0;
+		DmaRegs.CH1.MODE.bit.CHINTE = 1;
+		DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH1.CONTROL.bit.ERRCLR = 1;
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// ISR des DMA (DMA_CH1_INT, INT7.1)
+		PieVectTable.DMA_CH1_INT = &EmifCaptureISR;
+		PieCtrlRegs.PIEIER7.bit.INTx1 = 1;
+		IER |= M_INT7;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		emifCapture.state = EMIF_CAPTURE_RUNNING;
+		DmaRegs.CH1.CONTROL.bit.RUN = 1;
+
+		// ePWM1 starten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+
+		EDIS;
+}
+
+
+//=== Function: EmifCaptureTrigger ================================================================
+///
+/// @brief  Funktion merkt sich die aktuelle Abtastung als Trigger (z.B. bei einem Fehler). Die
+///					Aufzeichnung luft danach bis zum Ende des Segments stopSegment weiter. Kann aus
+///					jeder ISR aufgerufen werden, weitere Aufrufe werden ignoriert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EmifCaptureTrigger(void)
+{
+		uint16_t interruptState;
+		uint32_t address;
+		uint32_t segment;
+
+		interruptState = __disable_interrupts();
+
+		if (emifCapture.state == EMIF_CAPTURE_RUNNING)
+		{
+				// Nchste Zieladresse des DMA im Ring und zuletzt begonnenes Segment. Liegt die Adresse
+				// schon im folgenden Segment (bertragung begonnen, ISR noch nicht ausgefhrt, oder
+				// das Segment ist gerade voll), zhlt die Abtastung zum folgenden Segment
+				address = DmaRegs.CH1.DST_ADDR_ACTIVE - (uint32_t)emifCaptureBuffer;
+				segment = emifCapture.segments - 1;
+				if (address / EMIF_CAPTURE_SEGMENT_WORDS != segment % EMIF_CAPTURE_NUMBER_OF_SEGMENTS)
+				{
+						segment++;
+				}
+
+				emifCapture.triggerFrame = segment * EMIF_CAPTURE_SEGMENT_FRAMES
+						+ (address % EMIF_CAPTURE_SEGMENT_WORDS) / EMIF_CAPTURE_CHANNELS;
+				emifCapture.stopSegment = segment + EMIF_CAPTURE_POST_SEGMENTS;
+				emifCapture.state = EMIF_CAPTURE_TRIGGERED;
+		}
+
+		__restore_interrupts(interruptState);
+}
+
+
+//=== Function: EmifCaptureService ================================================================
+///
+/// @brief  Funktion erkennt das Anhalten des DMA nach dem letzten Segment und berechnet die
+///					Anzahl der Abtastungen vor und nach dem Trigger im Ring. Wird in der Hauptschleife
+///					aufgerufen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EmifCaptureService(void)
+{
+		uint32_t lastFrame;
+
+		if (emifCapture.state != EMIF_CAPTURE_STOPPING || DmaRegs.CH1.CONTROL.bit.RUNSTS)
+		{
+				return;
+		}
+
+		// ePWM1 liefert weiter SOCA, der DMA schreibt nicht mehr
+		lastFrame = (emifCapture.stopSegment + 1) * EMIF_CAPTURE_SEGMENT_FRAMES;
+		emifCapture.postFrames = lastFrame - emifCapture.triggerFrame;
+		emifCapture.preFrames = EMIF_CAPTURE_FRAMES - emifCapture.postFrames;
+		if (emifCapture.preFrames > emifCapture.triggerFrame)
+		{
+				// Ring noch nicht einmal vollstndig beschrieben
+				emifCapture.preFrames = emifCapture.triggerFrame;
+		}
+		emifCapture.state = EMIF_CAPTURE_DONE;
+}
+
+
+//=== Function: EmifCaptureRead ===================================================================
+///
+/// @brief  Funktion liest einen Messwert der beendeten Aufzeichnung aus dem SDRAM. Die Abtastung
+///					wird relativ zum Trigger angegeben (0: Trigger, negativ: davor)
+///
+/// @param  int32_t frame (-preFrames ... postFrames - 1), uint16_t channel (ADCIN0 ... 3)
+///
+/// @return uint16_t result (0xFFFF: keine Aufzeichnung oder auerhalb des Rings)
+///
+//=================================================================================================
+uint16_t EmifCaptureRead(int32_t frame, uint16_t channel)
+{
+		uint32_t index;
+
+		if (emifCapture.state != EMIF_CAPTURE_DONE || channel >= EMIF_CAPTURE_CHANNELS
+				|| frame < -(int32_t)emifCapture.preFrames || frame >= (int32_t)emifCapture.postFrames)
+		{
+				return 0xFFFF;
+		}
+
+		// EMIF_CAPTURE_FRAMES ist eine Zweierpotenz, der berlauf von uint32_t strt nicht
+		index = (emifCapture.triggerFrame + (uint32_t)frame) % EMIF_CAPTURE_FRAMES;
+		return __addr32_read_uint16((uint32_t)emifCaptureBuffer + index * EMIF_CAPTURE_CHANNELS + channel);
+}
+
+
+//=== Function: EmifCaptureISR ====================================================================
+///
+/// @brief  ISR wird zu Beginn jeder bertragung von DMA CH1 aufgerufen (Schattenregister sind
+///					gerade bernommen). Sie stellt die Zieladresse des folgenden Segments im Ring ein.
+///					Hat nach dem Trigger das Segment stopSegment begonnen, wird der Dauerbetrieb
+///					beendet und der DMA hlt nach diesem Segment an
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void EmifCaptureISR(void)
+{
+		uint32_t segment = emifCapture.segments;
+		uint32_t next;
+
+		emifCapture.segments = segment + 1;
+
+		EALLOW;
+		if (emifCapture.state == EMIF_CAPTURE_TRIGGERED && segment == emifCapture.stopSegment)
+		{
+				DmaRegs.CH1.MODE.bit.CONTINUOUS = 0;
+				emifCapture.state = EMIF_CAPTURE_STOPPING;
+		}
+		else
+		{
+				next = (uint32_t)emifCaptureBuffer
+						+ ((segment + 1) % EMIF_CAPTURE_NUMBER_OF_SEGMENTS) * EMIF_CAPTURE_SEGMENT_WORDS;
+				DmaRegs.CH1.DST_BEG_ADDR_SHADOW = next;
+				DmaRegs.CH1.DST_ADDR_SHADOW = next;
+		}
+		EDIS;
+
+    // Interrupt der Gruppe 7 besttigen (da gehrt der DMA-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+}
@@ -0,0 +1,180 @@
+//=================================================================================================
+/// @file       myEMIF.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um externen Speicher am EMIF1-Modul des
+///							TMS320F2838x zu betreiben und ADC-Messwerte ohne CPU dorthin aufzuzeichnen. Der
+///							GS-RAM begrenzt eine Aufzeichnung auf einige 10 KW, der externe Speicher reicht
+///							fr mehrere Sekunden mit voller Abtastrate:
+///							- CS0: SDRAM 16M x 16 Bit (z.B. 256 MBit, 4 Bnke, 8192 Zeilen, 512 Spalten),
+///							  Adresse 0x80000000 (Far-Speicher). Die CPU greift nur mit den Intrinsics
+///							  __addr32_read_uint16()/__addr32_write_uint16() zu, der DMA direkt
+///							- CS2: asynchroner SRAM 64K x 16 Bit, Adresse 0x00100000 (normale Zeiger)
+///							Die Linker-Skripte enthalten dafr die Speicherbereiche EMIF1_CS0n und EMIF1_CS2n
+///							mit den NOLOAD-Sektionen "emifsdram" und "emifsram" (EMIF_SDRAM_DATA(),
+///							EMIF_SRAM_DATA()). Der Inhalt ist nach dem Start undefiniert.
+///
+///							Aufzeichnung (EmifCaptureStart()): ePWM1 startet mit EMIF_CAPTURE_FREQUENCY_HZ
+///							die SOCs 0 ... 3 des ADC-A (ADCIN0 ... 3). Das EOC von SOC3 (ADCINT1) triggert
+///							DMA CH1, der die vier Ergebnisse als ein Burst in einen Ringpuffer im SDRAM
+///							schreibt. Der Ring besteht aus EMIF_CAPTURE_NUMBER_OF_SEGMENTS Segmenten (eine
+///							DMA-bertragung je Segment), der DMA-Interrupt zu Beginn jedes Segments stellt
+///							die Zieladresse des nchsten ein. Nach einem Fehler (EmifCaptureTrigger(), z.B.
+///							aus einer Trip-ISR) luft die Aufzeichnung noch EMIF_CAPTURE_POST_SEGMENTS
+///							Segmente weiter, dann hlt der DMA an. Im Ring stehen danach die Messwerte vor
+///							und nach dem Fehler, EmifCaptureRead() liest sie relativ zum Trigger.
+///
+///							Verkabelung (16-Bit-Schnittstelle, Mux 2 bzw. 3, siehe Tabelle "GPIO Muxed Pins"
+///							im Datenblatt TMS320F2838x, mit dem Schaltplan prfen):
+///							- GPIO 29 EM1SDCKE, 30 EM1CLK, 31 EM1WEn, 32 EM1CS0n, 33 EM1RNW, 34 EM1CS2n,
+///							  37 EM1OEn
+///							- GPIO 38 ... 41 EM1A0 ... 3, 44 ... 52 EM1A4 ... 12, 86/87 EM1A13/14
+///							- GPIO 69 ... 83 EM1D15 ... 1, 85 EM1D0
+///							- GPIO 88/89 EM1DQM0/1, 92/93 EM1BA1/0 (Mux 3)
+///							- SRAM: EM1BA1 an A0 des SRAM, EM1A0 ... 14 an A1 ... 15
+///							- ADCINA0 ... 3: Messsignale
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYEMIF_H_
+#define MYEMIF_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Speicherbereiche (siehe Linker-Skripte 2838x_..._lnk_cpu1.cmd)
+#define EMIF_SDRAM_ADDRESS									0x80000000UL
+#define EMIF_SDRAM_WORDS										0x01000000UL
+#define EMIF_SRAM_ADDRESS										0x00100000UL
+#define EMIF_SRAM_WORDS											0x00010000UL
+// EMIF1CLK = PLLSYSCLK / 2 = 100 MHz (PERCLKDIVSEL.EMIF1CLKDIV, max. 100 MHz)
+#define EMIF_CLOCK_DIV_2										1
+// Schlssel und Master CPU1 fr EMIF1MSEL
+#define EMIF_MSEL_KEY_CPU1									0x93A5CE71UL
+// SDRAM: Taktzyklen des EMIF1CLK (10 ns) minus 1 aus den Datenblattwerten des SDRAMs
+// (tRFC 70 ns, tRP 20 ns, tRCD 20 ns, tWR 2 Takte, tRAS 42 ns, tRC 70 ns, tRRD 14 ns, tXS 70 ns)
+#define EMIF_SDRAM_T_RFC										6
+#define EMIF_SDRAM_T_RP											1
+#define EMIF_SDRAM_T_RCD										1
+#define EMIF_SDRAM_T_WR											1
+#define EMIF_SDRAM_T_RAS										4
+#define EMIF_SDRAM_T_RC											6
+#define EMIF_SDRAM_T_RRD										1
+#define EMIF_SDRAM_T_XS											6
+// Refresh: 8192 Zeilen in 64 ms, alle 7,81 us (in EMIF1CLK-Takten)
+#define EMIF_SDRAM_REFRESH_RATE							781
+// SDRAM_CR: CAS-Latenz 3, 4 Bnke (IBANK), 512 Spalten (PAGESIGE), 16 Bit (NM)
+#define EMIF_SDRAM_CAS_LATENCY							3
+#define EMIF_SDRAM_BANKS_4									2
+#define EMIF_SDRAM_PAGE_512									1
+#define EMIF_SDRAM_NARROW_16BIT							1
+// Einschaltzeit des SDRAMs mit stabilem Takt vor der Initialisierungssequenz
+#define EMIF_SDRAM_POWER_UP_US							200
+// Asynchroner SRAM an CS2 (10 ns Zugriffszeit): Setup-, Strobe- und Hold-Zeiten in EMIF1CLK-
+// Takten minus 1, 16 Bit (ASIZE), eine Umschaltzeit (TA) zwischen Lesen und Schreiben
+#define EMIF_SRAM_ASIZE_16BIT								1
+#define EMIF_SRAM_W_SETUP									0
+#define EMIF_SRAM_W_STROBE									1
+#define EMIF_SRAM_W_HOLD										0
+#define EMIF_SRAM_R_SETUP										0
+#define EMIF_SRAM_R_STROBE									2
+#define EMIF_SRAM_R_HOLD										0
+#define EMIF_SRAM_TA												1
+// Aufzeichnung: 4 Kanle des ADC-A mit 100 kHz
+#define EMIF_CAPTURE_CHANNELS								4
+#define EMIF_CAPTURE_FREQUENCY_HZ						100000UL
+// ePWM1 zhlt hoch (TBCLK = EPWMCLK = 100 MHz), SOCA beim Zhlerstand 0
+#define EMIF_CAPTURE_PWM_PERIOD							(DEVICE_SYSCLK_MHZ * 1000000UL / 2 / EMIF_CAPTURE_FREQUENCY_HZ - 1)
+// ADC-Trigger ePWM1 SOCA (ADCSOCxCTL.TRIGSEL), Abtastzeitfenster 15 Takte = 75 ns
+#define EMIF_CAPTURE_ADC_TRIGGER_EPWM1_SOCA	5
+#define EMIF_CAPTURE_ACQPS									14
+// DMA-Trigger ADCAINT1 (DMACHSRCSELx, siehe Tabelle "DMA Trigger Source Options" im
+// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define EMIF_CAPTURE_DMA_TRIGGER_ADCAINT1		1
+// Ein Segment (eine DMA-bertragung, max. 65536 Bursts) = 4096 Abtastungen = 40,96 ms
+#define EMIF_CAPTURE_SEGMENT_FRAMES					4096UL
+#define EMIF_CAPTURE_SEGMENT_WORDS					(EMIF_CAPTURE_SEGMENT_FRAMES * EMIF_CAPTURE_CHANNELS)
+// Ring aus 1024 Segmenten = 16M Worte (gesamter SDRAM) = 41,9 s, davon nach dem Trigger
+// 256 Segmente = 10,5 s. Die Anzahl der Abtastungen im Ring muss eine Zweierpotenz sein
+#define EMIF_CAPTURE_NUMBER_OF_SEGMENTS			1024UL
+#define EMIF_CAPTURE_POST_SEGMENTS					256UL
+#define EMIF_CAPTURE_FRAMES									(EMIF_CAPTURE_NUMBER_OF_SEGMENTS * EMIF_CAPTURE_SEGMENT_FRAMES)
+#define EMIF_CAPTURE_WORDS									(EMIF_CAPTURE_FRAMES * EMIF_CAPTURE_CHANNELS)
+// Zustnde der Aufzeichnung
+#define EMIF_CAPTURE_STOPPED								0
+#define EMIF_CAPTURE_RUNNING								1
+#define EMIF_CAPTURE_TRIGGERED							2
+#define EMIF_CAPTURE_STOPPING								3
+#define EMIF_CAPTURE_DONE										4
+
+#if EMIF_CAPTURE_WORDS > EMIF_SDRAM_WORDS
+#error "Ringpuffer der Aufzeichnung grer als der SDRAM"
+#endif
+#if EMIF_CAPTURE_POST_SEGMENTS + 1 >= EMIF_CAPTURE_NUMBER_OF_SEGMENTS
+#error "EMIF_CAPTURE_POST_SEGMENTS lsst keine Messwerte vor dem Trigger brig"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Platzierung von Variablen im externen Speicher (wie DEVICE_CAPTURE_DATA() in myDevice.h), z.B.:
+//		EMIF_SRAM_DATA(logBuffer)
+//		Uint16 logBuffer[...];
+// SDRAM: nur ber die Adresse (uint32_t)symbol mit __addr32_... oder dem DMA ansprechen
+#define EMIF_SDRAM_DATA(symbol)							DEVICE_PRAGMA(DATA_SECTION(symbol, "emifsdram"))
+#define EMIF_SRAM_DATA(symbol)							DEVICE_PRAGMA(DATA_SECTION(symbol, "emifsram"))
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Zustand der Aufzeichnung
+typedef struct
+{
+		uint16_t state;								// EMIF_CAPTURE_x
+		uint32_t segments;						// Anzahl der begonnenen Segmente seit dem Start
+		uint32_t triggerFrame;				// Abtastung beim Trigger (seit dem Start)
+		uint32_t stopSegment;					// letztes Segment nach dem Trigger
+		uint32_t preFrames;						// Abtastungen vor dem Trigger im Ring (EMIF_CAPTURE_DONE)
+		uint32_t postFrames;					// Abtastungen ab dem Trigger im Ring (EMIF_CAPTURE_DONE)
+} EmifCapture;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer der Aufzeichnung im SDRAM (nur ber die Adresse ansprechen, siehe oben)
+extern uint16_t emifCaptureBuffer[EMIF_CAPTURE_WORDS];
+// Zustand der Aufzeichnung
+extern volatile EmifCapture emifCapture;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert EMIF1, die GPIOs, den SDRAM an CS0 und den SRAM an CS2
+extern void EmifInit(void);
+// Funktion prft einen Bereich des externen Speichers, gibt die Anzahl der Fehler zurck
+extern uint32_t EmifMemoryTest(uint32_t address, uint32_t numberOfWords);
+// Funktion initialisiert ePWM1, ADC-A und DMA CH1 und startet die Aufzeichnung
+extern void EmifCaptureStart(void);
+// Funktion lst das Ende der Aufzeichnung aus (auch aus einer ISR)
+extern void EmifCaptureTrigger(void);
+// Funktion erkennt das Anhalten des DMA nach dem Trigger (Hauptschleife)
+extern void EmifCaptureService(void);
+// Funktion liest einen Messwert relativ zum Trigger (-preFrames ... postFrames - 1)
+extern uint16_t EmifCaptureRead(int32_t frame, uint16_t channel);
+// ISR von DMA CH1 (Beginn eines Segments)
+extern __interrupt void EmifCaptureISR(void);
+
+
+#endif
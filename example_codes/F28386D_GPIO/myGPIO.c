@@ -5,7 +5,12 @@
 ///						  TMS320F2838x als Ausgnge, Eingnge oder Eingnge fr externe interrupts
 ///							zu konfigurieren.
 ///
-/// @version    V1.2
+///							nderung in Version 1.3: Ereigniserfassung mit allen fnf externen Interrupts
+///							(XINT1 ... 5). Die Eingnge werden in Hardware qualifiziert (entprellt), die
+///							Flanke wird vom XINT-Zhler bzw. einem eCAP-Modul in Hardware erfasst. Die ISRs
+///							laufen aus dem RAM und legen nur Zeitstempel und Latenz im Ringpuffer ab
+///
+/// @version    V1.3
 ///
 /// @date       13.02.2023
 ///
@@ -20,6 +25,87 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Konfiguration der externen Interrupts (XINT1 an GPIO 90 wie in Version 1.2, XINT2 ... 5
+// als Beispiel fr Encoder- bzw. Fehlersignale mit Qualifizierung, standardmig aus)
+GpioXintConfig gpioXintConfig[GPIO_NUMBER_OF_XINTS] =
+{
+		// enable	pin	polarity						pullup							qualification					qualPeriod
+		{true,		90,	GPIO_XINT_FALLING,	GPIO_ENABLE_PULLUP,	GPIO_QUAL_SYNC,				0},		// XINT1
+		{false,		91,	GPIO_XINT_BOTH,			GPIO_ENABLE_PULLUP,	GPIO_QUAL_3_SAMPLES,	10},	// XINT2 (Encoder, 3 x 100 ns)
+		{false,		92,	GPIO_XINT_BOTH,			GPIO_ENABLE_PULLUP,	GPIO_QUAL_3_SAMPLES,	10},	// XINT3 (Encoder, 3 x 100 ns)
+		{false,		93,	GPIO_XINT_FALLING,	GPIO_ENABLE_PULLUP,	GPIO_QUAL_6_SAMPLES,	10},	// XINT4 (Fehler, 6 x 100 ns)
+		{false,		94,	GPIO_XINT_FALLING,	GPIO_ENABLE_PULLUP,	GPIO_QUAL_6_SAMPLES,	10}		// XINT5 (Fehler, 6 x 100 ns)
+};
+// Letzte Ereignisse und Anzahl aller Ereignisse pro Interrupt
+GpioXintEvent gpioXintEvents[GPIO_NUMBER_OF_XINTS][GPIO_XINT_BUFFER_SIZE];
+volatile uint32_t gpioXintCount[GPIO_NUMBER_OF_XINTS] = {0, 0, 0, 0, 0};
+// Register der externen Interrupts (XINT4 und 5 haben keinen Zhler)
+static volatile uint16_t *const gpioXintCr[GPIO_NUMBER_OF_XINTS] =
+{
+		&XintRegs.XINT1CR.all, &XintRegs.XINT2CR.all, &XintRegs.XINT3CR.all,
+		&XintRegs.XINT4CR.all, &XintRegs.XINT5CR.all
+};
+static volatile uint16_t *const gpioXintCounter[GPIO_NUMBER_OF_XINTS] =
+{
+		&XintRegs.XINT1CTR, &XintRegs.XINT2CTR, &XintRegs.XINT3CTR, 0, 0
+};
+// Ausgnge der Input-X-Bar, an denen XINT1 ... 5 angeschlossen sind (INPUT4, 5, 6, 13, 14)
+static volatile uint16_t *const gpioXintXbar[GPIO_NUMBER_OF_XINTS] =
+{
+		&InputXbarRegs.INPUT4SELECT, &InputXbarRegs.INPUT5SELECT, &InputXbarRegs.INPUT6SELECT,
+		&InputXbarRegs.INPUT13SELECT, &InputXbarRegs.INPUT14SELECT
+};
+static const uint16_t gpioXintXbarInput[GPIO_NUMBER_OF_XINTS] = {4, 5, 6, 13, 14};
+#if GPIO_XINT_TIMESTAMP == GPIO_XINT_TIMESTAMP_ECAP
+// eCAP-Module, die die Flanken von XINT1 ... 5 erfassen
+static volatile struct ECAP_REGS *const gpioXintEcap[GPIO_NUMBER_OF_XINTS] =
+{
+		&ECap1Regs, &ECap2Regs, &ECap3Regs, &ECap4Regs, &ECap5Regs
+};
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: GpioXintCapture ===================================================================
+///
+/// @brief  Funktion legt ein Ereignis eines externen Interrupts im Ringpuffer ab. Der Zeitpunkt
+///					der Flanke ergibt sich aus der aktuellen Zeit abzglich der Takte seit der Flanke,
+///					die der XINT-Zhler bzw. das eCAP-Modul in Hardware gezhlt hat. Die Latenz bis zum
+///					Eintritt in die ISR geht damit nicht in den Zeitstempel ein
+///
+/// @param  uint16_t xint
+///
+/// @return void
+///
+//=================================================================================================
+static inline void GpioXintCapture(uint16_t xint)
+{
+		uint32_t now = GPIO_XINT_TIME();
+		uint32_t latency;
+		GpioXintEvent *event;
+
+#if GPIO_XINT_TIMESTAMP == GPIO_XINT_TIMESTAMP_ECAP
+		volatile struct ECAP_REGS *ecap = gpioXintEcap[xint];
+		uint32_t counter = ecap->TSCTR;
+
+		// Bei beiden Flanken erfasst CAP1 die steigende und CAP2 die fallende Flanke,
+		// die jngere Erfassung gehrt zu diesem Interrupt
+		latency = counter - ecap->CAP1;
+		if (gpioXintConfig[xint].polarity == GPIO_XINT_BOTH && counter - ecap->CAP2 < latency)
+				latency = counter - ecap->CAP2;
+#else
+		// Zhler luft ab der Flanke mit dem Systemtakt (nur XINT1 ... 3)
+		latency = (gpioXintCounter[xint] != 0) ? *gpioXintCounter[xint] : 0;
+#endif
+
+		event = &gpioXintEvents[xint][gpioXintCount[xint] & (GPIO_XINT_BUFFER_SIZE - 1)];
+		event->timestamp = now - latency;
+		event->latency = latency;
+		gpioXintCount[xint]++;
+}
+
 
 
 //-------------------------------------------------------------------------------------------------
@@ -207,46 +293,156 @@ void GpioInit(void)
     // GPFDIR: GPIO 160 ... 168
     GpioCtrlRegs.GPCDIR.bit.GPIO80 = GPIO_INPUT;
 
-    // GPIO als EINGANG fr einen externen Interrupt konfigurieren:
-    // Konfigurationssperre fr GPIO 90 aufheben
-    GpioCtrlRegs.GPCLOCK.bit.GPIO90 = GPIO_CONFIG_UNLOCK;
-    // GPIO 90 auf GPIO-Funktionalitt setzen
-    GpioCtrlRegs.GPCGMUX2.bit.GPIO90 = (GPIO_MULTIPLEX_GPIO >> 2);
-    GpioCtrlRegs.GPCMUX2.bit.GPIO90  = (GPIO_MULTIPLEX_GPIO & 0x03);
-    // Pull-Up-Widerstand von GPIO 90 aktivieren
-    GpioCtrlRegs.GPCPUD.bit.GPIO90 = GPIO_ENABLE_PULLUP;
-    // GPIO 90 als Eingang setzen
-    GpioCtrlRegs.GPCDIR.bit.GPIO90 = GPIO_INPUT;
-    // GPIO 90 als Pin fr den externen Interrupt XINT1 setzen.
+    // Register-Schreibschutz setzen
+    EDIS;
+
+    // GPIOs als EINGNGE fr die externen Interrupts konfigurieren (GPIO 90 fr XINT1)
+    GpioXintInitAll();
+}
+
+
+//=== Function: GpioXintInit ======================================================================
+///
+/// @brief  Funktion konfiguriert einen GPIO als Eingang fr einen externen Interrupt: Pull-Up,
+///					Qualifizierung, Input-X-Bar, Flanke, Zeitstempel (eCAP) und PIE. Die Sample-Dauer
+///					(qualPeriod) gilt fr den ganzen Block aus acht GPIOs des Eingangs
+///
+/// @param  uint16_t xint (GPIO_XINT1 ... GPIO_XINT5), const GpioXintConfig *config
+///
+/// @return void
+///
+//=================================================================================================
+void GpioXintInit(uint16_t xint, const GpioXintConfig *config)
+{
+		// Register eines Ports belegen 0x40 Worte (0x20 32-Bit-Register)
+		volatile uint32_t *port = (volatile uint32_t *)&GpioCtrlRegs.GPACTRL
+															+ (config->pin / 32) * (GPIO_PORT_REGS_SIZE / 2);
+		uint16_t bit = config->pin % 32;
+		// GPxMUX1/2, GPxGMUX1/2 und GPxQSEL1/2 enthalten 16 GPIOs mit je zwei Bits,
+		// GPxCTRL enthlt vier Sample-Dauern (QUALPRD0 ... 3) fr je acht GPIOs
+		uint16_t shift2 = (bit % 16) * 2;
+		uint16_t shift8 = (bit / 8) * 8;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Externen Interrupt whrend der Konfiguration ausschalten
+		*gpioXintCr[xint] = 0;
+
+		// GPIO als Eingang mit GPIO-Funktionalitt konfigurieren
+		port[GPIO_REG_LOCK] &= ~(1UL << bit);
+		port[GPIO_REG_MUX1 + bit / 16] &= ~(3UL << shift2);
+		port[GPIO_REG_GMUX1 + bit / 16] = (port[GPIO_REG_GMUX1 + bit / 16] & ~(3UL << shift2))
+																			| ((uint32_t)(GPIO_MULTIPLEX_GPIO >> 2) << shift2);
+		port[GPIO_REG_MUX1 + bit / 16] |= (uint32_t)(GPIO_MULTIPLEX_GPIO & 0x03) << shift2;
+		if (config->pullup == GPIO_DISABLE_PULLUP)
+				port[GPIO_REG_PUD] |= 1UL << bit;
+		else
+				port[GPIO_REG_PUD] &= ~(1UL << bit);
+		port[GPIO_REG_DIR] &= ~(1UL << bit);
+
+		// Qualifizierung in Hardware (Entprellung ohne CPU): Der Eingang wird erst als
+		// High/Low gewertet, wenn 3 bzw. 6 Samples im Abstand von 2*SYSCLK*qualPeriod
+		// identisch sind. Die Input-X-Bar und damit XINT und eCAP erhalten das
+		// qualifizierte Signal
+		port[GPIO_REG_CTRL] = (port[GPIO_REG_CTRL] & ~(0xFFUL << shift8))
+													| ((uint32_t)(config->qualPeriod & 0xFF) << shift8);
+		port[GPIO_REG_QSEL1 + bit / 16] = (port[GPIO_REG_QSEL1 + bit / 16] & ~(3UL << shift2))
+																			| ((uint32_t)(config->qualification & 0x03) << shift2);
+
+    // GPIO als Pin fr den externen Interrupt setzen.
     // Jeder der fnf externen Interrupts (XINT1 ... 5) ist an einem Ausgang der
     // Input-X-Bar angeschlossen (siehe S. 2142 Reference Manual TMS320F2838x,
-    // SPRUII0D, Rev. D, July 2022).
-    // Fr jeden Interrupt muss ein GPIO ausgewhlt werden.
-    // 0: GPIO 0
-    // 1: GPIO 1
-    // 2: GPIO 2
-    // ...
-    InputXbarRegs.INPUT4SELECT = 90;
-    // Interrupt durch fallende Flanke tiggern
-    // 0: Fallende Flanke triggert Interrupt
-    // 1: Steigende Flanke triggert Interrupt
-    // 2: Fallende Flanke triggert Interrupt
-    // 3: Steigende und fallende Flanke triggern Interrupt
-    XintRegs.XINT1CR.bit.POLARITY = 0;
-    // Externen Interrupt freischalten
-    // 0: Interrupt deaktiviert
-    // 1: Interrupt aktiviert
-    XintRegs.XINT1CR.bit.ENABLE = 1;
+    // SPRUII0D, Rev. D, July 2022)
+		*gpioXintXbar[xint] = config->pin;
+
+#if GPIO_XINT_TIMESTAMP == GPIO_XINT_TIMESTAMP_ECAP
+		// eCAP-Modul erfasst den Zhlerstand bei jeder Flanke am selben Ausgang der Input-X-Bar
+		// (kontinuierlich, absolute Zeitstempel). Bei beiden Flanken erfasst CAP1 die steigende
+		// und CAP2 die fallende Flanke, sonst nur CAP1
+		{
+				volatile struct ECAP_REGS *ecap = gpioXintEcap[xint];
+
+				switch (xint)
+				{
+						case GPIO_XINT1: CpuSysRegs.PCLKCR3.bit.ECAP1 = 1; break;
+						case GPIO_XINT2: CpuSysRegs.PCLKCR3.bit.ECAP2 = 1; break;
+						case GPIO_XINT3: CpuSysRegs.PCLKCR3.bit.ECAP3 = 1; break;
+						case GPIO_XINT4: CpuSysRegs.PCLKCR3.bit.ECAP4 = 1; break;
+						default:         CpuSysRegs.PCLKCR3.bit.ECAP5 = 1; break;
+				}
+
+				ecap->ECCTL2.bit.TSCTRSTOP = 0;
+				ecap->ECEINT.all = 0;
+				ecap->ECCLR.all = 0xFFFF;
+				// INPUTSEL 0 ... 15: INPUTXBAR1 ... 16
+				ecap->ECCTL0.bit.INPUTSEL = gpioXintXbarInput[xint] - 1;
+				ecap->ECCTL1.bit.PRESCALE = 0;
+				ecap->ECCTL1.bit.CAPLDEN = 1;
+				ecap->ECCTL1.bit.CTRRST1 = 0;
+				ecap->ECCTL1.bit.CTRRST2 = 0;
+				if (config->polarity == GPIO_XINT_BOTH)
+				{
+						ecap->ECCTL1.bit.CAP1POL = 0;
+						ecap->ECCTL1.bit.CAP2POL = 1;
+						ecap->ECCTL2.bit.STOP_WRAP = 1;
+				}
+				else
+				{
+						// CAPxPOL 0: steigende Flanke, 1: fallende Flanke
+						ecap->ECCTL1.bit.CAP1POL = (config->polarity == GPIO_XINT_RISING) ? 0 : 1;
+						ecap->ECCTL2.bit.STOP_WRAP = 0;
+				}
+				ecap->ECCTL2.bit.CAP_APWM = 0;
+				ecap->ECCTL2.bit.CONT_ONESHT = 0;
+				ecap->ECCTL2.bit.SYNCI_EN = 0;
+				ecap->TSCTR = 0;
+				ecap->ECCTL2.bit.TSCTRSTOP = 1;
+		}
+#endif
+
     // CPU-Interrupts whrend der Konfiguration global sperren
     DINT;
-    // Interrupt-Service-Routinen fr den GPIO-Interrupt an die
-    // entsprechende Stelle (XINT1_INT) der PIE-Vector Table speichern
-    PieVectTable.XINT1_INT = &XINT1ISR;
-    // INT1.4-Interrupt freischalten (Zeile 1, Spalte 4 der Tabelle 3-2)
+    // Interrupt-Service-Routine an die entsprechende Stelle der PIE-Vector Table speichern
+    // und freischalten: XINT1 INT1.4, XINT2 INT1.5, XINT3 INT12.1, XINT4 INT12.2, XINT5 INT12.3
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    PieCtrlRegs.PIEIER1.bit.INTx4 = 1;
-    // CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
-    IER |= M_INT1;
+		switch (xint)
+		{
+				case GPIO_XINT1:
+						PieVectTable.XINT1_INT = &XINT1ISR;
+						PieCtrlRegs.PIEIER1.bit.INTx4 = 1;
+						IER |= M_INT1;
+						break;
+				case GPIO_XINT2:
+						PieVectTable.XINT2_INT = &XINT2ISR;
+						PieCtrlRegs.PIEIER1.bit.INTx5 = 1;
+						IER |= M_INT1;
+						break;
+				case GPIO_XINT3:
+						PieVectTable.XINT3_INT = &XINT3ISR;
+						PieCtrlRegs.PIEIER12.bit.INTx1 = 1;
+						IER |= M_INT12;
+						break;
+				case GPIO_XINT4:
+						PieVectTable.XINT4_INT = &XINT4ISR;
+						PieCtrlRegs.PIEIER12.bit.INTx2 = 1;
+						IER |= M_INT12;
+						break;
+				default:
+						PieVectTable.XINT5_INT = &XINT5ISR;
+						PieCtrlRegs.PIEIER12.bit.INTx3 = 1;
+						IER |= M_INT12;
+						break;
+		}
+
+		gpioXintCount[xint] = 0;
+
+    // Flanke setzen und externen Interrupt freischalten
+    // POLARITY 0: Fallende Flanke, 1: Steigende Flanke, 2: Fallende Flanke,
+    //          3: Steigende und fallende Flanke
+    // ENABLE   0: Interrupt deaktiviert, 1: Interrupt aktiviert
+		*gpioXintCr[xint] = (config->polarity << 2) | 1;
+
     // CPU-Interrupts nach Konfiguration global wieder freigeben
     EINT;
 
@@ -255,17 +451,57 @@ void GpioInit(void)
 }
 
 
+//=== Function: GpioXintInitAll ===================================================================
+///
+/// @brief  Funktion startet CPU-Timer 1 als Zeitbasis der Zeitstempel (frei laufend mit dem
+///					Systemtakt) und konfiguriert alle freigeschalteten externen Interrupts nach
+///					gpioXintConfig
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void GpioXintInitAll(void)
+{
+		EALLOW;
+		CpuSysRegs.PCLKCR0.bit.CPUTIMER1 = 1;
+		EDIS;
+
+		// CPU-Timer 1 mit dem Systemtakt frei laufen lassen (GPIO_XINT_TIME())
+		CpuTimer1Regs.TCR.bit.TSS = 1;
+		CpuTimer1Regs.TCR.bit.TIE = 0;
+		CpuTimer1Regs.PRD.all     = 0xFFFFFFFFUL;
+		CpuTimer1Regs.TPR.all     = 0;
+		CpuTimer1Regs.TPRH.all    = 0;
+		CpuTimer1Regs.TCR.bit.TRB = 1;
+		CpuTimer1Regs.TCR.bit.TSS = 0;
+
+		for (uint16_t xint = 0; xint < GPIO_NUMBER_OF_XINTS; xint++)
+		{
+				if (gpioXintConfig[xint].enable)
+						GpioXintInit(xint, &gpioXintConfig[xint]);
+		}
+}
+
+
 //=== Function: XINT1ISR ==========================================================================
 ///
-/// @brief  ISR wird aufgerufen, sobald eine fallende Flanke an GPIO 90 auftritt
+/// @brief  ISR wird aufgerufen, sobald die eingestellte Flanke an dem Eingang von XINT1 auftritt
+///					(standardmig fallende Flanke an GPIO 90). Wie alle XINT-ISRs aus dem RAM
+///					ausgefhrt (keine Wartezustnde des Flash-Speichers)
 ///
 /// @param  void
 ///
 /// @return void
 ///
 //=================================================================================================
+#pragma CODE_SECTION(XINT1ISR, ".TI.ramfunc");
 __interrupt void XINT1ISR(void)
 {
+		// Zeitstempel als Erstes erfassen
+		GpioXintCapture(GPIO_XINT1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -280,3 +516,79 @@ __interrupt void XINT1ISR(void)
 }
 
 
+//=== Function: XINT2ISR ==========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald die eingestellte Flanke an dem Eingang von XINT2 auftritt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(XINT2ISR, ".TI.ramfunc");
+__interrupt void XINT2ISR(void)
+{
+		GpioXintCapture(GPIO_XINT2);
+
+    // Interrupt-Flag der Gruppe 1 lschen (da gehrt der GPIO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
+
+
+//=== Function: XINT3ISR ==========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald die eingestellte Flanke an dem Eingang von XINT3 auftritt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(XINT3ISR, ".TI.ramfunc");
+__interrupt void XINT3ISR(void)
+{
+		GpioXintCapture(GPIO_XINT3);
+
+    // Interrupt-Flag der Gruppe 12 lschen (da gehrt der GPIO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK12 = 1;
+}
+
+
+//=== Function: XINT4ISR ==========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald die eingestellte Flanke an dem Eingang von XINT4 auftritt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(XINT4ISR, ".TI.ramfunc");
+__interrupt void XINT4ISR(void)
+{
+		GpioXintCapture(GPIO_XINT4);
+
+    // Interrupt-Flag der Gruppe 12 lschen (da gehrt der GPIO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK12 = 1;
+}
+
+
+//=== Function: XINT5ISR ==========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald die eingestellte Flanke an dem Eingang von XINT5 auftritt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(XINT5ISR, ".TI.ramfunc");
+__interrupt void XINT5ISR(void)
+{
+		GpioXintCapture(GPIO_XINT5);
+
+    // Interrupt-Flag der Gruppe 12 lschen (da gehrt der GPIO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK12 = 1;
+}
+
+
@@ -5,7 +5,11 @@
 ///						  TMS320F2838x als Ausgnge, Eingnge oder Eingnge fr externe interrupts
 ///							zu konfigurieren.
 ///
-/// @version    V1.2
+///							nderung in Version 1.3: Ereigniserfassung mit allen fnf externen Interrupts
+///							(XINT1 ... 5), einstellbarer Eingangsqualifizierung und Zeitstempel jedes
+///							Ereignisses aus dem XINT-Zhler oder einem eCAP-Modul
+///
+/// @version    V1.3
 ///
 /// @date       13.02.2023
 ///
@@ -39,16 +43,81 @@
 #define GPIO_CONTROLLED_BY_CPU2 							2
 #define GPIO_CONTROLLED_BY_CLA_CPU2						3
 #define GPIO_CONTROLLED_BY_CM									4
+// Qualifizierung eines Eingangs (GPxQSEL)
+#define GPIO_QUAL_SYNC												0
+#define GPIO_QUAL_3_SAMPLES										1
+#define GPIO_QUAL_6_SAMPLES										2
+#define GPIO_QUAL_ASYNC												3
+// Gre der Register eines GPIO-Ports in Worten (GPACTRL ... GPBCTRL)
+#define GPIO_PORT_REGS_SIZE										0x40
+// Lage der Register innerhalb eines Ports in 32-Bit-Registern (ab GPxCTRL)
+#define GPIO_REG_CTRL													0x00
+#define GPIO_REG_QSEL1												0x01
+#define GPIO_REG_MUX1													0x03
+#define GPIO_REG_DIR													0x05
+#define GPIO_REG_PUD													0x06
+#define GPIO_REG_GMUX1												0x10
+#define GPIO_REG_LOCK													0x1E
+// Externe Interrupts
+#define GPIO_NUMBER_OF_XINTS									5
+#define GPIO_XINT1														0
+#define GPIO_XINT2														1
+#define GPIO_XINT3														2
+#define GPIO_XINT4														3
+#define GPIO_XINT5														4
+// Flanke, die einen externen Interrupt auslst (XINTxCR.POLARITY)
+#define GPIO_XINT_FALLING											0
+#define GPIO_XINT_RISING											1
+#define GPIO_XINT_BOTH												3
+// Quelle des Zeitstempels
+// 0: XINT-Zhler (nur XINT1 ... 3, XINT4 und 5 erhalten den Zeitpunkt des ISR-Eintritts)
+// 1: eCAP-Modul (eCAP1 ... 5 fr XINT1 ... 5, erfasst die Flanke in Hardware)
+#define GPIO_XINT_TIMESTAMP_COUNTER						0
+#define GPIO_XINT_TIMESTAMP_ECAP							1
+#define GPIO_XINT_TIMESTAMP										GPIO_XINT_TIMESTAMP_ECAP
+// Anzahl der gespeicherten Ereignisse pro Interrupt (Zweierpotenz)
+#define GPIO_XINT_BUFFER_SIZE									16
 
 
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
+// Zeitbasis der Zeitstempel in Systemtakten (CPU-Timer 1 zhlt abwrts)
+#define GPIO_XINT_TIME()		(0xFFFFFFFFUL - CpuTimer1Regs.TIM.all)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Konfiguration eines externen Interrupts
+typedef struct
+{
+		bool     enable;				// Interrupt verwenden
+		uint16_t pin;						// GPIO 0 ... 168
+		uint16_t polarity;			// GPIO_XINT_FALLING, GPIO_XINT_RISING oder GPIO_XINT_BOTH
+		uint16_t pullup;				// GPIO_ENABLE_PULLUP oder GPIO_DISABLE_PULLUP
+		uint16_t qualification;	// GPIO_QUAL_SYNC, GPIO_QUAL_3_SAMPLES oder GPIO_QUAL_6_SAMPLES
+		uint16_t qualPeriod;		// Abstand der Samples 2*SYSCLK*qualPeriod (0: SYSCLK, gilt
+														// fr alle acht GPIOs eines Blocks, z.B. GPIO 88 ... 95)
+} GpioXintConfig;
+
+// Erfasstes Ereignis
+typedef struct
+{
+		uint32_t timestamp;			// Zeitpunkt der Flanke in Systemtakten (GPIO_XINT_TIME())
+		uint32_t latency;				// Systemtakte von der Flanke bis zum Eintritt in die ISR
+} GpioXintEvent;
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Konfiguration der externen Interrupts
+extern GpioXintConfig gpioXintConfig[GPIO_NUMBER_OF_XINTS];
+// Letzte GPIO_XINT_BUFFER_SIZE Ereignisse und Anzahl aller Ereignisse pro Interrupt
+// (das neueste Ereignis steht bei (gpioXintCount - 1) % GPIO_XINT_BUFFER_SIZE)
+extern GpioXintEvent gpioXintEvents[GPIO_NUMBER_OF_XINTS][GPIO_XINT_BUFFER_SIZE];
+extern volatile uint32_t gpioXintCount[GPIO_NUMBER_OF_XINTS];
 
 
 //-------------------------------------------------------------------------------------------------
@@ -56,8 +125,16 @@
 //-------------------------------------------------------------------------------------------------
 // Funktion initialisiert GPIOs als Ein- bzw. Ausgnge
 extern void GpioInit(void);
-// Interrupt-Service-Routine fr den externen (GPIO-)Interrupt 1
+// Funktion konfiguriert einen Eingang als Quelle eines externen Interrupts
+extern void GpioXintInit(uint16_t xint, const GpioXintConfig *config);
+// Funktion konfiguriert alle externen Interrupts nach gpioXintConfig
+extern void GpioXintInitAll(void);
+// Interrupt-Service-Routinen fr die externen (GPIO-)Interrupts 1 ... 5
 __interrupt void XINT1ISR(void);
+__interrupt void XINT2ISR(void);
+__interrupt void XINT3ISR(void);
+__interrupt void XINT4ISR(void);
+__interrupt void XINT5ISR(void);
 
 
 #endif
@@ -4,9 +4,17 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Mit "AD5664SetAllChannels()" werden alle vier Kanle
+///							mit einem Aufruf aktualisiert. Die ISR sendet die Kanle nacheinander (jeder
+///							Kanal ein eigener SPI-Rahmen mit SS), der Status wird erst nach dem letzten Kanal
+///							auf "bereit" gesetzt. Das Warten auf jeden einzelnen Kanal entfllt.
+///							Mit "AD5664SetAllChannelsSync()" werden die Kanle zunchst nur in die Eingangs-
+///							register geschrieben und mit dem letzten Rahmen gemeinsam bernommen (Software-
+///							LDAC), sodass alle Ausgnge gleichzeitig umschalten.
 ///
-/// @date       13.02.2023
+/// @version    V1.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +29,79 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation  (bereit/Kommunikation aktiv)
 uint32_t ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
+// Anzahl vollstndig gesendeter Aktualisierungen aller Kanle
+uint32_t ad5664UpdateCount = 0;
+// Warteschlange der zu sendenden Kanle
+uint16_t ad5664QueueCommand[AD5664_NUMBER_OF_CHANNELS];
+uint16_t ad5664QueueValue[AD5664_NUMBER_OF_CHANNELS];
+uint16_t ad5664QueueLength = 0;
+uint16_t ad5664QueueIndex = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: AD5664SendFrame ===================================================================
+///
+/// @brief  Funktion kopiert einen 24 Bit-Rahmen (Steuer-Byte, Daten MSB, Daten LSB) in den
+///					SPI-Hardware-Puffer. SS ist whrend der drei Bytes aktiv und wird danach wieder
+///					inaktiv, sodass der DAC den Rahmen bernimmt.
+///
+/// @param  uint16_t command, uint16_t value
+///
+/// @return void
+///
+//=================================================================================================
+static void AD5664SendFrame(uint16_t command,
+														uint16_t value)
+{
+		// Daten in den SPI-Hardware-Puffer kopieren (16 Byte, Daten mssen links-bnig sein,
+		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+		// Steuer-Byte
+		SpidRegs.SPITXBUF = ( command << 8 );
+		// Daten MSB
+		SpidRegs.SPITXBUF = ( ((value >> 8) & 0xFF) << 8 );
+		// Daten LSB
+		SpidRegs.SPITXBUF = ( (value & 0xFF) << 8 );
+}
+
+
+//=== Function: AD5664QueueAllChannels ============================================================
+///
+/// @brief  Funktion schreibt die Werte aller vier Kanle mit den Steuer-Bytes in die Warteschlange
+///					und sendet den ersten Kanal. Bei "simultaneous" werden die Kanle A bis C nur in die
+///					Eingangsregister geschrieben und Kanal D mit "AD5664_WRITE_REG_SET_ALL" gesendet,
+///					wodurch alle vier DAC-Register gleichzeitig aktualisiert werden (Software-LDAC).
+///					Andernfalls wird jeder Kanal sofort bernommen.
+///
+/// @param  const uint16_t *values, bool simultaneous
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+static bool AD5664QueueAllChannels(const uint16_t *values,
+																	 bool simultaneous)
+{
+		if (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS)
+		{
+				return false;
+		}
+		for (uint16_t i=0; i<AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+				ad5664QueueCommand[i] = (simultaneous ? AD5664_WRITE_REG : AD5664_WRITE_REG_SET_DAC)
+															| (AD5664_CHANNEL_A + i);
+				ad5664QueueValue[i]   = values[i];
+		}
+		if (simultaneous)
+		{
+				ad5664QueueCommand[AD5664_NUMBER_OF_CHANNELS - 1] = AD5664_WRITE_REG_SET_ALL | AD5664_CHANNEL_D;
+		}
+		ad5664QueueLength = AD5664_NUMBER_OF_CHANNELS;
+		ad5664QueueIndex  = 0;
+		ad5664StatusFlag  = AD5664_STATUS_IN_PROGRESS;
+		AD5664SendFrame(ad5664QueueCommand[0], ad5664QueueValue[0]);
+		return true;
+}
 
 
 //-------------------------------------------------------------------------------------------------
@@ -156,14 +237,48 @@ void AD566SetChannel(uint16_t channel,
 		// Flag setzen um der aufrufenden Stelle zu signalisieren,
 		// dass eine SPI-Kommunikation gestartet wurde
 		ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
-		// Daten in den SPI-Hardware-Puffer kopieren (16 Byte, Daten mssen links-bnig sein,
-		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+		// Kein weiterer Kanal in der Warteschlange
+		ad5664QueueLength = 0;
+		ad5664QueueIndex  = 0;
 		// Steuer-Byte (neuen DAC-Wert sofort setzen)
-		SpidRegs.SPITXBUF = ( (AD5664_WRITE_REG_SET_DAC | channel) << 8 );
-		// Daten MSB
-		SpidRegs.SPITXBUF = ( ((value >> 8) & 0xFF) << 8 );
-		// Daten LSB
-		SpidRegs.SPITXBUF = ( (value & 0xFF) << 8 );
+		AD5664SendFrame(AD5664_WRITE_REG_SET_DAC | channel, value);
+}
+
+
+//=== Function: AD5664SetAllChannels ==============================================================
+///
+/// @brief  Funktion setzt die Werte aller vier Kanle (values[0] = A ... values[3] = D) des DAC.
+///					Der erste Kanal wird sofort gesendet, die restlichen Kanle sendet die ISR jeweils
+///					nach Empfang der drei Bytes des vorherigen Kanals. Die Funktion blockiert nicht,
+///					"ad5664StatusFlag" wird erst nach dem letzten Kanal auf "bereit" gesetzt. Ist noch
+///					eine Kommunikation aktiv, wird "false" zurckgegeben und nichts gesendet.
+///
+/// @param  const uint16_t *values
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool AD5664SetAllChannels(const uint16_t *values)
+{
+		return AD5664QueueAllChannels(values, false);
+}
+
+
+//=== Function: AD5664SetAllChannelsSync ==========================================================
+///
+/// @brief  Funktion setzt die Werte aller vier Kanle (values[0] = A ... values[3] = D) des DAC
+///					wie "AD5664SetAllChannels()", die Ausgnge werden jedoch erst mit dem letzten Rahmen
+///					gemeinsam bernommen (Software-LDAC). Dadurch zeigen die vier Ausgnge immer Werte
+///					desselben Zeitpunkts.
+///
+/// @param  const uint16_t *values
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool AD5664SetAllChannelsSync(const uint16_t *values)
+{
+		return AD5664QueueAllChannels(values, true);
 }
 
 
@@ -194,13 +309,26 @@ __interrupt void AD5664SpiISR(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Status auf "bereit" setzen
-		ad5664StatusFlag = AD5664_STATUS_IDLE;
 		// Empfangene Bytes auslesen
 		uint16_t dummy = SpidRegs.SPIRXBUF;
 		dummy = SpidRegs.SPIRXBUF;
 		dummy = SpidRegs.SPIRXBUF;
 
+		// Nchsten Kanal aus der Warteschlange senden
+		ad5664QueueIndex++;
+		if (ad5664QueueIndex < ad5664QueueLength)
+		{
+				AD5664SendFrame(ad5664QueueCommand[ad5664QueueIndex],
+												ad5664QueueValue[ad5664QueueIndex]);
+		}
+		// Alle Kanle gesendet -> Status auf "bereit" setzen
+		else
+		{
+				ad5664QueueLength = 0;
+				ad5664UpdateCount++;
+				ad5664StatusFlag = AD5664_STATUS_IDLE;
+		}
+
     // RX-FIFO Interupt-Flag lschen
     SpidRegs.SPIFFRX.bit.RXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
@@ -4,9 +4,17 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Mit "AD5664SetAllChannels()" werden alle vier Kanle
+///							mit einem Aufruf aktualisiert. Die ISR sendet die Kanle nacheinander (jeder
+///							Kanal ein eigener SPI-Rahmen mit SS), der Status wird erst nach dem letzten Kanal
+///							auf "bereit" gesetzt. Das Warten auf jeden einzelnen Kanal entfllt.
+///							Mit "AD5664SetAllChannelsSync()" werden die Kanle zunchst nur in die Eingangs-
+///							register geschrieben und mit dem letzten Rahmen gemeinsam bernommen (Software-
+///							LDAC), sodass alle Ausgnge gleichzeitig umschalten.
 ///
-/// @date       13.02.2023
+/// @version    V1.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -48,6 +56,8 @@
 #define AD5664_CHANNEL_B								0x01
 #define AD5664_CHANNEL_C								0x02
 #define AD5664_CHANNEL_D								0x03
+// Anzahl der Kanle
+#define AD5664_NUMBER_OF_CHANNELS				4
 
 
 //-------------------------------------------------------------------------------------------------
@@ -60,6 +70,8 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation (bereit/Kommunikation aktiv)
 extern uint32_t ad5664StatusFlag;
+// Anzahl vollstndig gesendeter Aktualisierungen aller Kanle
+extern uint32_t ad5664UpdateCount;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -70,6 +82,10 @@ extern void AD5664Init(uint32_t clock);
 // Funktion sendet einen Wert fr einen Kanal des DAC
 extern void AD566SetChannel(uint16_t channel,
 														uint16_t value);
+// Funktion sendet die Werte aller vier Kanle des DAC (ohne zu blockieren)
+extern bool AD5664SetAllChannels(const uint16_t *values);
+// Funktion sendet die Werte aller vier Kanle des DAC, die Ausgnge werden gemeinsam bernommen
+extern bool AD5664SetAllChannelsSync(const uint16_t *values);
 // SPI-Interrupt-Routine zur Kommunikation mit dem DAC
 __interrupt void AD5664SpiISR(void);
 
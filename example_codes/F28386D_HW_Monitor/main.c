@@ -31,10 +31,8 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-uint16_t dataDacA = 0;
-uint16_t dataDacB = 0;
-uint16_t dataDacC = 0;
-uint16_t dataDacD = 0;
+// Werte der Kanle A bis D
+uint16_t dataDac[AD5664_NUMBER_OF_CHANNELS] = {0, 0, 0, 0};
 
 
 //=== Function: main ==============================================================================
@@ -60,24 +58,9 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_A,
-												dataDacA);
-
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_B,
-												dataDacB);
-
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_C,
-												dataDacC);
-
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_D,
-												dataDacD);
+    		// Alle vier Kanle senden, sobald die vorherige Aktualisierung
+    		// abgeschlossen ist (kehrt sofort zurck, falls noch aktiv)
+    		AD5664SetAllChannels(dataDac);
     }
 }
 
@@ -4,9 +4,15 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: SPI-D und GPIO91 bis GPIO94 werden ber die
+///							Zuordnungstabelle des Projekts (DeviceSetOwnership()) an CPU 2 bergeben
 ///
-/// @date       13.02.2023
+///							nderung in Version 1.3: Vor dem Setzen von IPC0 wird mit DeviceJoinCPU2() auf das
+///							Ende des Boot-Prozesses von CPU 2 gewartet (asynchroner Boot)
+///
+/// @version    V1.3
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -82,10 +88,11 @@ void AD5664Init(void)
     // Asynchroner Eingang (muss fr SPI gesetzt sein)
     GpioCtrlRegs.GPCQSEL2.bit.GPIO94 = 0x03;
 
-    // Steuerung ber SPI-D an CPU 2 bergeben
-    DevCfgRegs.CPUSEL6.bit.SPI_D = 1;
-    // CPU 2 signalisieren, dass Sie nun die
-    // Kontrolle ber das SPI-D Modul hat
+    // SPI-D wurde von DeviceInit() an CPU 2 bergeben (Zuordnungstabelle
+    // in main.c). CPU 2 signalisieren, dass die GPIOs eingestellt sind
+    // und sie nun die Kontrolle ber das SPI-D Modul hat. Vorher auf das
+    // Ende des Boot-Prozesses warten, da dieser die IPC-Flags lscht
+    DeviceJoinCPU2();
     Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.bit.IPC0 = 1;
 
 
@@ -28,6 +28,17 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Nutzdaten des Datenkanals von CPU 1 zu CPU 2 (muss in AD5664_cpu1.h
+// und AD5664_cpu2.h identisch sein). Kann um weitere Werte erweitert werden
+typedef struct
+{
+		uint16_t channel[4];										// Werte der DAC-Kanle A bis D
+} HwMonitorData;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
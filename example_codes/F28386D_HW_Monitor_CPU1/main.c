@@ -11,9 +11,24 @@
 ///
 ///					  https://software-dl.ti.com/C2000/docs/C2000_Multicore_Development_User_Guide/debug.html
 ///
-/// @version	V1.0
+///						nderung in Version 1.1: Die Zuordnung von SPI-D und GPIO91 bis GPIO94 zu CPU 2
+///						steht in der Tabelle "hwMonitorOwnership" und wird von DeviceInit() vor dem
+///						Booten von CPU 2 geschrieben
 ///
-/// @date			15.09.2022
+///						nderung in Version 1.2: Pool aus den Blcken GS6 bis GS9, die zur Laufzeit ohne
+///						Kopieren an CPU 2 bergeben werden (myBufferPool.h). Zurckgegebene Blcke werden
+///						in der Hauptschleife bernommen
+///
+///						nderung in Version 1.3: Befehls-/Antwort-Kanal zu CPU 2 ber die Message-RAMs
+///						(myIpc.h, z.B. IpcCall(IPC_COMMAND_PING, ...) zur Messung der Umlaufzeit)
+///
+///						nderung in Version 1.4: Gemeinsame PWM-Zeitbasis beider CPUs (myPwmSync.h). ePWM1
+///						bis 3 (CPU 1) und ePWM4 bis 6 (CPU 2) schalten synchron zum Master ePWM1 und
+///						bernehmen neue Vergleichswerte im selben PWM-Takt
+///
+/// @version	V1.4
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -22,6 +37,10 @@
 //-------------------------------------------------------------------------------------------------
 #include "AD5664_cpu1.h"
 #include "myDevice.h"
+#include "myMailbox.h"
+#include "myBufferPool.h"
+#include "myIpc.h"
+#include "myPwmSync.h"
 
 
 // Dual-Core Debugging:
@@ -56,11 +75,36 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Daten im gemeinsamen RAM von CPU 1 und CPU 2.
+// Datenkanal im gemeinsamen RAM von CPU 1 und CPU 2.
 // CPU 1 kann diese Daten lesen und schreiben,
 // CPU 2 kann sie nur lesen
-uint16_t toCpu2[4];
-#pragma DATA_SECTION(toCpu2,"SHARERAMGS1");
+Mailbox hwMonitorMailbox;
+#pragma DATA_SECTION(hwMonitorMailbox,"SHARERAMGS1");
+// Auszugebende Werte (knnen z.B. im Debugger gendert werden)
+HwMonitorData hwMonitorData;
+// Zuordnung zu CPU 2: SPI-D und dessen GPIOs (MISO, MOSI, CLK, SS) sowie ePWM4 bis 6
+// (Module von CPU 2 in "pwmSyncChain")
+static const DevicePeripheralOwner hwMonitorPeripherals[] =
+{
+		{DEVICE_SPI(3), DEVICE_OWNER_CPU2},
+		{DEVICE_EPWM(4), DEVICE_OWNER_CPU2},
+		{DEVICE_EPWM(5), DEVICE_OWNER_CPU2},
+		{DEVICE_EPWM(6), DEVICE_OWNER_CPU2}
+};
+static const DevicePinOwner hwMonitorPins[] =
+{
+		{91, DEVICE_OWNER_CPU2},
+		{92, DEVICE_OWNER_CPU2},
+		{93, DEVICE_OWNER_CPU2},
+		{94, DEVICE_OWNER_CPU2}
+};
+const DeviceOwnership hwMonitorOwnership =
+{
+		hwMonitorPeripherals, sizeof(hwMonitorPeripherals) / sizeof(hwMonitorPeripherals[0]),
+		hwMonitorPins, sizeof(hwMonitorPins) / sizeof(hwMonitorPins[0])
+};
+// Zuletzt verffentlichte Werte (zur Erkennung von nderungen)
+HwMonitorData hwMonitorPublished;
 
 
 //=== Function: main ==============================================================================
@@ -74,10 +118,14 @@ uint16_t toCpu2[4];
 //=================================================================================================
 void main(void)
 {
+		// Zuordnung der Peripherie und GPIOs zu CPU 2 (wird vor dem Booten von CPU2 geschrieben)
+		DeviceSetOwnership(&hwMonitorOwnership);
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts, CPU2 booten)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
 		// SPI fr Kommunikation mit DAC initialisieren
 		AD5664Init();
+		// Module von CPU 1 der gemeinsamen PWM-Zeitbasis initialisieren (Zeitbasis angehalten)
+		PwmSyncInit(&pwmSyncChain);
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -88,13 +136,36 @@ void main(void)
     MemCfgRegs.GSxMSEL.bit.MSEL_GS1 = 0;
 
 
-    // Einmal referenzieren damit die Variable im Debugger sichtbar ist
-    toCpu2[0] = 0;
+    // Datenkanal initialisieren
+    MailboxInit(&hwMonitorMailbox);
+    // Pool fr die bergabe ganzer GSx-Blcke an CPU 2 initialisieren
+    BufferPoolInit();
+    // Befehls-/Antwort-Kanal zu CPU 2 initialisieren
+    IpcInit();
+    // Auf die Module von CPU 2 warten und alle Module gemeinsam starten
+    PwmSyncStart(&pwmSyncChain, PWMSYNC_TIMEOUT_US);
 
 
     while(1)
     {
-
+    		// Von CPU 2 zurckgegebene Blcke wieder CPU 1 zuweisen
+    		BufferPoolCollect();
+
+    		// Nur genderte Werte verffentlichen und CPU 2 mit IPC1 wecken.
+    		// CPU 2 liest nie einen halb geschriebenen Datensatz
+    		bool changed = false;
+    		for (uint16_t i=0; i<4; i++)
+    		{
+    				if (hwMonitorData.channel[i] != hwMonitorPublished.channel[i])
+    				{
+    						changed = true;
+    				}
+    		}
+    		if (changed)
+    		{
+    				hwMonitorPublished = hwMonitorData;
+    				MAILBOX_WRITE(hwMonitorMailbox, hwMonitorPublished, MAILBOX_IPC_FLAG1);
+    		}
     }
 }
 
@@ -4,9 +4,24 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Mit "AD5664SetAllChannels()" werden alle vier Kanle
+///							mit einem Aufruf aktualisiert. Die ISR sendet die Kanle nacheinander (jeder
+///							Kanal ein eigener SPI-Rahmen mit SS), der Status wird erst nach dem letzten Kanal
+///							auf "bereit" gesetzt. Das Warten auf jeden einzelnen Kanal entfllt.
+///							Mit "AD5664SetAllChannelsSync()" werden die Kanle zunchst nur in die Eingangs-
+///							register geschrieben und mit dem letzten Rahmen gemeinsam bernommen (Software-
+///							LDAC), sodass alle Ausgnge gleichzeitig umschalten.
 ///
-/// @date       13.02.2023
+///							nderung in Version 1.3: Mit "AD5664SetChangedChannels()" werden nur die Kanle
+///							gesendet, deren Wert sich seit der letzten bertragung um mehr als ihr Totband ge-
+///							ndert hat. Jeder Kanal hat in "ad5664ChannelConfig" eine Prioritt und einen Teiler
+///							seiner Aktualisierungsrate, pro Aufruf werden hchstens AD5664_MAX_CHANNELS_PER_FRAME
+///							Kanle nach ihrer Prioritt gesendet. Die SPI-Bandbreite geht so nur an Kanle, die
+///							sich bewegen, und schnelle Signale werden fter aktualisiert.
+///
+/// @version    V1.3
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -48,6 +63,17 @@
 #define AD5664_CHANNEL_B								0x01
 #define AD5664_CHANNEL_C								0x02
 #define AD5664_CHANNEL_D								0x03
+// Anzahl der Kanle
+#define AD5664_NUMBER_OF_CHANNELS				4
+
+// nderungserkennung und Priorisierung ("AD5664SetChangedChannels()"):
+// Hchstens so viele Kanle pro Aufruf senden (ein Kanal dauert bei 16 MHz SPI-Clock ca. 2,5 us)
+#define AD5664_MAX_CHANNELS_PER_FRAME		2
+// Anzahl der Prioritten (0 = hchste Prioritt)
+#define AD5664_NUMBER_OF_PRIORITIES			3
+// Ein Kanal, der so oft wegen anderer Kanle zurckgestellt wurde, bekommt die hchste
+// Prioritt (kein Kanal wird dauerhaft verdrngt)
+#define AD5664_MAX_DEFERRED							4
 
 
 //-------------------------------------------------------------------------------------------------
@@ -55,11 +81,39 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Nutzdaten des Datenkanals von CPU 1 zu CPU 2 (muss in AD5664_cpu1.h
+// und AD5664_cpu2.h identisch sein). Kann um weitere Werte erweitert werden
+typedef struct
+{
+		uint16_t channel[4];										// Werte der DAC-Kanle A bis D
+} HwMonitorData;
+
+// Einstellung eines Kanals fr "AD5664SetChangedChannels()"
+typedef struct
+{
+		uint16_t priority;											// 0 ... AD5664_NUMBER_OF_PRIORITIES - 1
+		uint16_t rateDivider;										// Kanal nur bei jedem n-ten Aufruf prfen (1 = immer)
+		uint16_t deadband;											// nderungen bis zu diesem Betrag werden nicht gesendet
+} AD5664ChannelConfig;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation (bereit/Kommunikation aktiv)
 extern uint32_t ad5664StatusFlag;
+// Anzahl vollstndig gesendeter Aktualisierungen aller Kanle
+extern uint32_t ad5664UpdateCount;
+// Prioritt, Rate und Totband der Kanle A bis D
+extern const AD5664ChannelConfig ad5664ChannelConfig[AD5664_NUMBER_OF_CHANNELS];
+// Gesendete Werte je Kanal und Anzahl der Aufrufe, in denen nichts gesendet werden musste
+extern uint32_t ad5664ChannelUpdates[AD5664_NUMBER_OF_CHANNELS];
+extern uint32_t ad5664SuppressedFrames;
+// Genderte Kanle, die wegen AD5664_MAX_CHANNELS_PER_FRAME noch nicht gesendet wurden (Bit i = Kanal i)
+extern uint16_t ad5664PendingMask;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -70,6 +124,13 @@ extern void AD5664Init(uint32_t clock);
 // Funktion sendet einen Wert fr einen Kanal des DAC
 extern void AD566SetChannel(uint16_t channel,
 														uint16_t value);
+// Funktion sendet die Werte aller vier Kanle des DAC (ohne zu blockieren)
+extern bool AD5664SetAllChannels(const uint16_t *values);
+// Funktion sendet die Werte aller vier Kanle des DAC, die Ausgnge werden gemeinsam bernommen
+extern bool AD5664SetAllChannelsSync(const uint16_t *values);
+// Funktion sendet nur die genderten Kanle des DAC nach ihrer Prioritt (ohne zu blockieren)
+extern bool AD5664SetChangedChannels(const uint16_t *values,
+																		 bool simultaneous);
 // SPI-Interrupt-Routine zur Kommunikation mit dem DAC
 __interrupt void AD5664SpiISR(void);
 
@@ -11,9 +11,24 @@
 ///
 ///					  https://software-dl.ti.com/C2000/docs/C2000_Multicore_Development_User_Guide/debug.html
 ///
-/// @version	V1.0
+///						nderung in Version 1.1: In allen Betriebsarten schlft CPU 2 im Low-Power-Modus
+///						IDLE (myLowPower.h), solange nichts zu tun ist, statt auf "ad5664StatusFlag" zu
+///						warten. Schlafzeit und Weck-Latenz stehen in "lowPowerStats"
 ///
-/// @date			15.09.2022
+///						nderung in Version 1.2: Befehls-/Antwort-Kanal ber die Message-RAMs (myIpc.h).
+///						Die Befehle von CPU 1 werden im IPC3-Interrupt ausgefhrt, auch whrend CPU 2
+///						schlft
+///
+///						nderung in Version 1.3: In allen Betriebsarten werden mit "AD5664SetChangedChannels()"
+///						nur die genderten Kanle nach Prioritt und Rate gesendet (ad5664ChannelConfig).
+///						Unvernderte Kanle belegen kein SPI mehr
+///
+///						nderung in Version 1.4: Module von CPU 2 der gemeinsamen PWM-Zeitbasis (ePWM4 bis 6,
+///						myPwmSync.h). Sie laufen synchron zum Master ePWM1 von CPU 1
+///
+/// @version	V1.4
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +36,10 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "AD5664_cpu2.h"
+#include "myMailbox.h"
+#include "myLowPower.h"
+#include "myIpc.h"
+#include "myPwmSync.h"
 
 
 // Dual-Core Debugging:
@@ -45,21 +64,55 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Betriebsarten des Hardware-Monitors:
+// Kontinuierlich so schnell wie mglich senden (Ausgaberate abhngig vom SPI)
+#define HW_MONITOR_MODE_CONTINUOUS				0
+// Getaktet mit CPU-Timer 0 von CPU 2, alle Kanle gleichzeitig bernehmen (Sample & Hold)
+#define HW_MONITOR_MODE_PACED							1
+// Nur senden, wenn CPU 1 neue Daten verffentlicht (IPC-Interrupt), sonst schlft CPU 2 (IDLE)
+#define HW_MONITOR_MODE_EVENT							2
+// Gewhlte Betriebsart (in allen Betriebsarten schlft CPU 2, solange nichts zu tun ist)
+#define HW_MONITOR_MODE										HW_MONITOR_MODE_EVENT
+// IPC-Flag, mit dem CPU 1 neue Daten signalisiert
+#define HW_MONITOR_IPC_FLAG								MAILBOX_IPC_FLAG1
+// Ausgaberate im getakteten Betrieb in Hz (ein Rahmen mit vier Kanlen
+// dauert bei 16 MHz SPI-Clock ca. 10 us inkl. ISR)
+#define HW_MONITOR_RATE_HZ								10000UL
+// Systemtakt von CPU 2 in Hz
+#define HW_MONITOR_SYSCLK_HZ							200000000UL
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Funktion startet CPU-Timer 0 als Zeitbasis fr den Hardware-Monitor
+void HwMonitorTimerInit(uint32_t rateHz);
+// ISR von CPU-Timer 0, gibt einen Rahmen an den Hardware-Monitor aus
+__interrupt void HwMonitorTimerISR(void);
+// Funktion schaltet den IPC-Interrupt fr neue Daten von CPU 1 ein
+void HwMonitorIpcInit(void);
+// ISR des IPC-Interrupts, wird aufgerufen, wenn CPU 1 neue Daten verffentlicht hat
+__interrupt void HwMonitorIpcISR(void);
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Daten im gemeinsamen RAM von CPU 1 und CPU 2.
+// Datenkanal im gemeinsamen RAM von CPU 1 und CPU 2.
 // CPU 1 kann diese Daten lesen und schreiben,
 // CPU 2 kann sie nur lesen
-uint16_t fromCpu1[4];
-#pragma DATA_SECTION(fromCpu1,"SHARERAMGS1");
+Mailbox hwMonitorMailbox;
+#pragma DATA_SECTION(hwMonitorMailbox,"SHARERAMGS1");
+// Zum Zeitpunkt des Timer-Interrupts gehaltene Werte (Sample & Hold)
+HwMonitorData hwMonitorSample;
+// Sequenzzhler des zuletzt gelesenen Datensatzes
+uint32_t hwMonitorSequence = 0;
+// Anzahl der Leseversuche, bei denen CPU 1 gerade geschrieben hat (alter Wert wird gehalten)
+uint32_t hwMonitorReadRetries = 0;
+// Anzahl der Timer-Interrupts, bei denen die vorherige Ausgabe noch nicht abgeschlossen war
+uint32_t hwMonitorOverruns = 0;
+// Wird von der IPC-ISR gesetzt, sobald CPU 1 neue Daten verffentlicht hat
+volatile bool hwMonitorNewData = false;
 
 
 //=== Function: main ==============================================================================
@@ -77,37 +130,240 @@ void main(void)
 		DeviceInit(DEVICE_DEFAULT);
 		// SPI fr die Kommunikation mit dem DAC mit 16 MHz SPI-Clock initialisieren
 		AD5664Init(AD5664_SPI_CLOCK_16MHZ);
+		// Low-Power-Modus IDLE whlen (wird mit dem IDLE-Befehl in LowPowerSleep() aktiviert)
+		LowPowerInit(LOWPOWER_MODE_IDLE);
+		// Befehls-/Antwort-Kanal von CPU 1 initialisieren (IPC3-Interrupt)
+		IpcInit();
+		// Module von CPU 2 der gemeinsamen PWM-Zeitbasis initialisieren und Bereitschaft melden
+		PwmSyncInit(&pwmSyncChain);
 
     // Register-Schreibschutz ausschalten
     EALLOW;
 
 
-		// Einmal referenzieren damit die Variable im Debugger sichtbar ist
-    // (der Schreibbefehl hat keine Auswirkung auf den Wert, da CPU 2
-    // nur lesen kann)
-		fromCpu1[0] = 0;
-
+#if HW_MONITOR_MODE == HW_MONITOR_MODE_PACED
+		// Ausgabe mit fester Rate durch CPU-Timer 0
+		HwMonitorTimerInit(HW_MONITOR_RATE_HZ);
+#elif HW_MONITOR_MODE == HW_MONITOR_MODE_EVENT
+		// Ausgabe nur nach Benachrichtigung durch CPU 1
+		HwMonitorIpcInit();
+#endif
 
     while(1)
     {
-    		// Kontinuierlich die Daten an den hardware-Monitor senden
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_A,
-												fromCpu1[0]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_B,
-												fromCpu1[1]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_C,
-												fromCpu1[2]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_D,
-												fromCpu1[3]);
+#if HW_MONITOR_MODE == HW_MONITOR_MODE_CONTINUOUS
+    		// Kontinuierlich die Daten an den hardware-Monitor senden. Die ISR sendet
+    		// die vier Kanle nacheinander, CPU 2 muss nicht auf jeden Kanal warten
+    		if (   (ad5664StatusFlag == AD5664_STATUS_IDLE)
+    				&& MAILBOX_READ(hwMonitorMailbox, hwMonitorSample, &hwMonitorSequence))
+    		{
+    				AD5664SetChangedChannels(hwMonitorSample.channel, false);
+    		}
+    		// Whrend der bertragung bis zum nchsten SPI-Interrupt schlafen. Interrupts
+    		// sperren, damit das Ende der bertragung nicht vor dem IDLE-Befehl verloren geht
+    		DINT;
+    		if (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS)
+    				LowPowerSleep();
+    		EINT;
+#elif HW_MONITOR_MODE == HW_MONITOR_MODE_EVENT
+    		// Interrupts sperren, damit zwischen der Abfrage und dem IDLE-Befehl
+    		// keine Benachrichtigung verloren geht
+    		DINT;
+    		if (   (hwMonitorNewData || ad5664PendingMask)
+    				&& (ad5664StatusFlag == AD5664_STATUS_IDLE))
+    		{
+    				hwMonitorNewData = false;
+    				EINT;
+    				// Nur genderte Daten lesen. Schlgt das Lesen fehl (CPU 1 schreibt
+    				// gerade), folgt nach dem Schreiben eine neue Benachrichtigung
+    				if (MailboxHasNewData(&hwMonitorMailbox, hwMonitorSequence))
+    				{
+    						MAILBOX_READ(hwMonitorMailbox, hwMonitorSample, &hwMonitorSequence);
+    				}
+    				// Nur genderte Kanle senden. Zurckgestellte Kanle (AD5664_MAX_CHANNELS_PER_FRAME)
+    				// folgen nach dem Ende der bertragung ohne neue Benachrichtigung
+    				AD5664SetChangedChannels(hwMonitorSample.channel, true);
+    		}
+    		else
+    		{
+    				// CPU 2 schlafen legen bis zum nchsten Interrupt (IPC oder Ende der SPI-
+    				// bertragung). Der IDLE-Befehl gibt die Interrupts selbst wieder frei
+    				LowPowerSleep();
+    				EINT;
+    		}
+#else
+    		// Die Ausgabe luft in der Timer-ISR, bis zum nchsten Interrupt schlafen
+    		DINT;
+    		LowPowerSleep();
+    		EINT;
+#endif
     }
 }
 
 
+//=== Function: HwMonitorIpcInit ==================================================================
+///
+/// @brief  Funktion schaltet den IPC-Interrupt ein, mit dem CPU 1 neue Daten im Datenkanal
+///					signalisiert (HW_MONITOR_IPC_FLAG = IPC1). Den Low-Power-Modus "IDLE", in dem CPU 2
+///					bis zum nchsten Interrupt schlft, whlt LowPowerInit().
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void HwMonitorIpcInit(void)
+{
+		EALLOW;
+
+		// Evtl. bereits gesetztes Flag quittieren
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = HW_MONITOR_IPC_FLAG;
+
+    // CPU-Interrupts whrend der Konfiguration global sperren
+    DINT;
+		// ISR an die entsprechende Stelle (CIPC1_INT) der PIE-Vector Table speichern
+		PieVectTable.CIPC1_INT = &HwMonitorIpcISR;
+		// IPC1-Interrupt freischalten (Zeile 1, Spalte 14 der Tabelle)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER1.bit.INTx14 = 1;
+		// CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+		IER |= M_INT1;
+    // CPU-Interrupts nach Konfiguration global wieder freigeben
+    EINT;
+
+		EDIS;
+
+		// Beim Start einmal die aktuellen Daten ausgeben
+		hwMonitorNewData = true;
+}
+
+
+//=== Function: HwMonitorIpcISR ===================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald CPU 1 neue Daten im Datenkanal verffentlicht und das
+///					IPC-Flag gesetzt hat. Das Flag wird quittiert und das Hauptprogramm geweckt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void HwMonitorIpcISR(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		// Schlafzeit beenden (die Verzgerung seit dem Setzen des Flags durch CPU 1 ist nicht
+		// bekannt)
+		LowPowerWake(0);
+
+		// IPC-Flag quittieren und Hauptprogramm benachrichtigen
+		MailboxTakeIpcFlag(HW_MONITOR_IPC_FLAG);
+		hwMonitorNewData = true;
+
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der IPC1-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
+
+
+//=== Function: HwMonitorTimerInit ================================================================
+///
+/// @brief  Funktion initialisiert CPU-Timer 0 von CPU 2 so, dass mit der Rate "rateHz" ein
+///					Interrupt ausgelst wird. In jedem Interrupt wird ein Rahmen (alle vier Kanle)
+///					an den Hardware-Monitor ausgegeben. Die Ausgnge haben damit eine feste Zeitbasis.
+///
+/// @param  uint32_t rateHz
+///
+/// @return void
+///
+//=================================================================================================
+void HwMonitorTimerInit(uint32_t rateHz)
+{
+		EALLOW;
+
+		// Timer anhalten, kein Vorteiler
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TPR.all  = 0;
+		CpuTimer0Regs.TPRH.all = 0;
+		// Periode setzen und in den Zhler laden
+		CpuTimer0Regs.PRD.all = (HW_MONITOR_SYSCLK_HZ / rateHz) - 1;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		// Interrupt einschalten, Flag lschen
+		CpuTimer0Regs.TCR.bit.TIF = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 1;
+
+    // CPU-Interrupts whrend der Konfiguration global sperren
+    DINT;
+		// ISR an die entsprechende Stelle (TIMER0_INT) der PIE-Vector Table speichern
+		PieVectTable.TIMER0_INT = &HwMonitorTimerISR;
+		// TIMER0-Interrupt freischalten (Zeile 1, Spalte 7 der Tabelle)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+		// CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+		IER |= M_INT1;
+    // CPU-Interrupts nach Konfiguration global wieder freigeben
+    EINT;
+
+		// Timer starten
+		CpuTimer0Regs.TCR.bit.TSS = 0;
+
+		EDIS;
+}
+
+
+//=== Function: HwMonitorTimerISR =================================================================
+///
+/// @brief  ISR wird mit der Rate HW_MONITOR_RATE_HZ aufgerufen. Die aktuellen Werte von CPU 1
+///					werden gemeinsam bernommen (Sample & Hold) und an den DAC gesendet. Die vier
+///					Ausgnge werden mit dem letzten Rahmen gleichzeitig aktualisiert. Ist die vorherige
+///					Ausgabe noch nicht abgeschlossen, wird der Rahmen ausgelassen und gezhlt. Schreibt
+///					CPU 1 whrend aller Leseversuche, werden die zuletzt gehaltenen Werte ausgegeben.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void HwMonitorTimerISR(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		// Weck-Latenz seit dem Nulldurchgang des Timers
+		LowPowerWake(LOWPOWER_TIMER_LATENCY(CpuTimer0Regs));
+
+		if (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS)
+		{
+				hwMonitorOverruns++;
+		}
+		else
+		{
+				// Werte aller Kanle zum selben Zeitpunkt halten (vollstndiger Datensatz)
+				if (!MAILBOX_READ(hwMonitorMailbox, hwMonitorSample, &hwMonitorSequence))
+				{
+						hwMonitorReadRetries++;
+				}
+				// Nur genderte Kanle senden, die brigen Ausgnge behalten ihren Wert
+				AD5664SetChangedChannels(hwMonitorSample.channel, true);
+		}
+
+		// Interrupt-Flag im Timer lschen
+		CpuTimer0Regs.TCR.bit.TIF = 1;
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der TIMER0-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
+
+
 
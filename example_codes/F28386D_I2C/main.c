@@ -8,7 +8,16 @@
 ///
 ///						nderung myI2C.c V2.0: Verwendung der Hardware-FIFOs zum Senden und Empfangen
 ///
-/// @version	V1.3
+///						nderung in Version 1.4: Beispiel fr die Warteschlange ("I2cSubmitA()"), die
+///						zwei Slaves reihum abfragt, ohne das Hauptprogramm zu blockieren
+///
+///						nderung in Version 1.5: Beispiel fr eine Transaktion, die grer als die
+///						Hardware-FIFOs ist (256 Bytes aus einem EEPROM lesen)
+///
+///						nderung in Version 1.6: "I2cTickA()" beim Warten und in der Hauptschleife
+///						aufrufen, damit ein blockierter Bus erkannt und freigegeben wird
+///
+/// @version	V1.6
 ///
 /// @date			27.03.2023
 ///
@@ -28,11 +37,55 @@
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Callback-Funktion der Transaktionen der Warteschlange
+void SensorCallback(I2cTransaction *transaction);
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Registeradresse und Messwerte von zwei Sensoren, die ber die Warteschlange gelesen werden.
+// Alle Puffer der Transaktionen sind gepackt (zwei Bytes pro Wort, myByteBuffer.h)
+const uint16_t sensorRegister[BYTE_BUFFER_WORDS(1)] = {0x00};
+uint16_t sensorData[2][BYTE_BUFFER_WORDS(2)];
+// Transaktionen der beiden Sensoren (Register schreiben, wiederholte START-Bedingung, lesen)
+I2cTransaction sensorTransaction[2] =
+{
+		{0x48, sensorRegister, 1, sensorData[0], 2, &SensorCallback, I2C_STATUS_IDLE},
+		{0x49, sensorRegister, 1, sensorData[1], 2, &SensorCallback, I2C_STATUS_IDLE}
+};
+// Anzahl der fehlerfrei gelesenen Messwerte
+uint32_t sensorReadings;
+// 256 Bytes ab Speicheradresse 0x0000 aus einem EEPROM (Slave-Adresse 0x50) lesen.
+// Der FIFO-Interrupt leert den Empfangs-FIFO whrend der bertragung
+const uint16_t eepromAddress[BYTE_BUFFER_WORDS(2)] = {0x0000};
+uint16_t eepromData[BYTE_BUFFER_WORDS(256)];
+I2cTransaction eepromTransaction =
+{
+		0x50, eepromAddress, 2, eepromData, 256, 0, I2C_STATUS_IDLE
+};
+
+
+//=== Function: SensorCallback ====================================================================
+///
+/// @brief  Wird in der I2C-ISR nach dem Ende einer Sensor-Transaktion aufgerufen und reiht die
+///					Transaktion sofort wieder ein. Die Sensoren werden so dauerhaft reihum gelesen,
+///					ohne dass das Hauptprogramm warten muss
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+void SensorCallback(I2cTransaction *transaction)
+{
+		if (transaction->status == I2C_STATUS_FINISHED)
+		{
+				sensorReadings++;
+		}
+		// Rckgabewert wird hier nicht gebraucht (die Warteschlange kann nicht voll sein)
+		I2cSubmitA(transaction);
+}
 
 
 //=== Function: main ==============================================================================
@@ -48,6 +101,8 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
 
 		// I2C initialisieren mit 400 kHz SCL-Takt
 		I2cInitA(I2C_CLOCK_400_KHZ);
@@ -71,10 +126,10 @@ void main(void)
 		// geschrieben werden. Dabei mssen die Daten am Anfang des Puffers geschrieben werden (beginnend
 		// vom Element 0 an). Es ist darauf zu achten, dass nicht mehr Daten geschrieben, als der Puffer
 		// gro ist (I2C_SIZE_BUFFER_WRITE).
-		i2cBufferWriteA[0] = 0xAA;
-		i2cBufferWriteA[1] = 0xFF;
-		i2cBufferWriteA[2] = 0x0F;
-		i2cBufferWriteA[3] = 0xF0;
+		BYTE_BUFFER_SET(i2cBufferWriteA, 0, 0xAA);
+		BYTE_BUFFER_SET(i2cBufferWriteA, 1, 0xFF);
+		BYTE_BUFFER_SET(i2cBufferWriteA, 2, 0x0F);
+		BYTE_BUFFER_SET(i2cBufferWriteA, 3, 0xF0);
 
 
 		// Vor jeder einer Kommunikation prfen, ob ggf. noch eine vorherige Kommunikation aktiv ist
@@ -103,7 +158,11 @@ void main(void)
 				*/
 		}
 		// Warten bis die Kommunikation beendet ist
-		while (I2cGetStatusA() == I2C_STATUS_IN_PROGRESS);
+		// (hlt ein Slave den Bus fest, bricht "I2cTickA()" die bertragung ab)
+		while (I2cGetStatusA() == I2C_STATUS_IN_PROGRESS)
+		{
+				I2cTickA();
+		}
 
 		// Vorangegangene Operation ist abgeschlossen
 		if (I2cGetStatusA() == I2C_STATUS_FINISHED)
@@ -125,10 +184,20 @@ void main(void)
     // Register-Schreibschutz ausschalten
     EALLOW;
 
+		// Beide Sensoren ber die Warteschlange lesen. Die ISR startet jede Transaktion
+		// direkt nach der STOP-Bedingung der vorherigen, die Callback-Funktion reiht sie
+		// wieder ein. Die aktuellen Messwerte stehen in "sensorData[][]"
+		I2cSubmitA(&sensorTransaction[0]);
+		I2cSubmitA(&sensorTransaction[1]);
+		// EEPROM einmalig zwischen den Sensor-Transaktionen lesen. Die Daten sind gltig,
+		// sobald "eepromTransaction.status" gleich I2C_STATUS_FINISHED ist
+		I2cSubmitA(&eepromTransaction);
+
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-
+    		// Zeitgrenzen der I2C-Transaktionen berwachen und den Bus ggf. freigeben
+    		I2cTickA();
     }
 }
 
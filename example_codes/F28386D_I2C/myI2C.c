@@ -9,9 +9,35 @@
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V1.4
+///							nderung in Version 1.5: Warteschlange fr I2C-Transaktionen. Jede Transaktion
+///							bringt eigene Puffer und eine Callback-Funktion mit und wird mit
+///							"I2cSubmitA()" eingereiht. Die ISR startet die nchste Transaktion direkt nach
+///							der STOP-Bedingung der vorherigen, sodass mehrere Slaves ohne Warten im
+///							Hauptprogramm nacheinander abgefragt werden. Die Funktionen "I2cWriteA()",
+///							"I2cReadA()" und "I2cWriteReadA()" reihen eine Transaktion mit den globalen
+///							Puffern ein und setzen weiterhin "i2cStatusFlagA".
 ///
-/// @date       27.03.2023
+///							nderung in Version 1.6: Transaktionen der Warteschlange sind nicht mehr auf
+///							die Gre der Hardware-FIFOs begrenzt. Der FIFO-Interrupt (I2CA_FIFO_INT)
+///							fllt den Sende-FIFO whrend der bertragung nach und leert den Empfangs-FIFO,
+///							sobald die Schwellen I2C_FIFO_LEVEL_TX bzw. I2C_FIFO_LEVEL_RX erreicht sind.
+///
+///							nderung in Version 1.7: Zeitberwachung jeder Transaktion und Wiederherstellung
+///							des Busses. "I2cTickA()" muss regelmig aufgerufen werden. berschreitet die
+///							aktive Transaktion ihre Zeitgrenze, wird sie mit Fehler beendet, SCL ber GPIO
+///							bis zu 9-mal getaktet, eine STOP-Bedingung erzeugt und das Modul zurckgesetzt.
+///							Jeder Schritt wartet nicht, sondern wird beim nchsten Aufruf fortgesetzt.
+///							Die Statistik steht in "i2cStatisticsA".
+///
+///							nderung in Version 1.8: Die Software-Puffer "i2cBufferWriteA[]" und "i2cBufferReadA[]"
+///							sowie die Puffer der Transaktionen sind gepackt (zwei Bytes pro Wort, myByteBuffer.h)
+///							und belegen nur noch die Hlfte des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET()
+///							und BYTE_BUFFER_SET(), die FIFO-Kopierschleifen der ISR lesen und schreiben die Bytes
+///							direkt im gepackten Puffer.
+///
+/// @version    V1.8
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -24,15 +50,429 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die I2C-Kommunikation
-uint16_t i2cBufferWriteA[I2C_SIZE_HARDWARE_FIFO];
-uint16_t i2cBufferReadA[I2C_SIZE_HARDWARE_FIFO];
-// bernimmt die Anzahl der zu lesenden Bytes beim Aufruf der Funktion "I2cWriteReadA()"
-// und bergibt sie dem Register I2CCNT nach einer wiederholten START-Bedingung um die
-// gewnschte Anzahl von Bytes vom Slave zu lesen
-uint16_t i2cBytesToReadAfterRSA;
+// Software-Puffer fr die I2C-Kommunikation (gepackt, zwei Bytes pro Wort)
+uint16_t i2cBufferWriteA[BYTE_BUFFER_WORDS(I2C_SIZE_HARDWARE_FIFO)];
+uint16_t i2cBufferReadA[BYTE_BUFFER_WORDS(I2C_SIZE_HARDWARE_FIFO)];
 // Flag speichert den aktuellen Zustand der I2C-Kommunikation
+// ("I2cWriteA()", "I2cReadA()" und "I2cWriteReadA()")
 uint16_t i2cStatusFlagA;
+// Statistik der Transaktionen der Warteschlange
+I2cStatistics i2cStatisticsA;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Warteschlange der Transaktionen. "i2cQueueTailA" zeigt auf die aktive bzw. nchste
+// Transaktion, "i2cQueueHeadA" auf den nchsten freien Platz
+static I2cTransaction *i2cQueueA[I2C_SIZE_QUEUE];
+static volatile uint16_t i2cQueueHeadA;
+static volatile uint16_t i2cQueueTailA;
+// Eine Transaktion der Warteschlange ist auf dem Bus aktiv
+static volatile bool i2cQueueActiveA;
+// Bei einer Schreib-Lese-Transaktion steht nach dem Schreiben noch
+// die wiederholte START-Bedingung mit dem Lesen aus
+static volatile bool i2cRepeatedStartPendingA;
+// Transaktion fr "I2cWriteA()", "I2cReadA()" und "I2cWriteReadA()"
+static I2cTransaction i2cTransactionA;
+// Anzahl der Bytes der aktiven Transaktion, die bereits in den Sende-FIFO geschrieben
+// bzw. aus dem Empfangs-FIFO gelesen wurden
+static uint16_t i2cIndexWriteA;
+static uint16_t i2cIndexReadA;
+// Zeitstempel (CPU-Timer 2) des Starts der aktiven Transaktion
+static uint32_t i2cTimestampStartA;
+// Zustand der Wiederherstellung des Busses (I2C_RECOVERY_...), aktueller Schritt
+// und Zeitstempel des letzten Schritts
+static uint16_t i2cRecoveryStateA;
+static uint16_t i2cRecoveryStepA;
+static uint32_t i2cRecoveryTimestampA;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: I2cFillFifoTxA ====================================================================
+///
+/// @brief  Funktion schreibt so viele der noch nicht gesendeten Bytes der Transaktion in den
+///					Sende-FIFO, wie darin Platz ist
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static inline void I2cFillFifoTxA(I2cTransaction *transaction)
+{
+		while ((i2cIndexWriteA < transaction->numberOfBytesWrite)
+					 && (I2caRegs.I2CFFTX.bit.TXFFST < I2C_SIZE_HARDWARE_FIFO))
+		{
+				I2caRegs.I2CDXR.bit.DATA = BYTE_BUFFER_GET(transaction->bufferWrite, i2cIndexWriteA);
+				i2cIndexWriteA++;
+		}
+}
+
+
+//=== Function: I2cDrainFifoRxA ===================================================================
+///
+/// @brief  Funktion liest alle Bytes aus dem Empfangs-FIFO in den Puffer der Transaktion
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static inline void I2cDrainFifoRxA(I2cTransaction *transaction)
+{
+		while (I2caRegs.I2CFFRX.bit.RXFFST
+					 && (i2cIndexReadA < transaction->numberOfBytesRead))
+		{
+				BYTE_BUFFER_SET(transaction->bufferRead, i2cIndexReadA, I2caRegs.I2CDRR.bit.DATA);
+				i2cIndexReadA++;
+		}
+}
+
+
+//=== Function: I2cStartReadA =====================================================================
+///
+/// @brief  Funktion setzt den Master-Receiver Mode und schaltet den Empfangs-FIFO-Interrupt ein,
+///					damit der FIFO whrend des Lesens geleert wird. Der Rest unterhalb der Schwelle
+///					I2C_FIFO_LEVEL_RX wird nach der STOP-Bedingung gelesen
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cStartReadA(I2cTransaction *transaction)
+{
+		// Master-Receiver Mode setzen
+		I2caRegs.I2CMDR.bit.MST = 1;
+		I2caRegs.I2CMDR.bit.TRX = 0;
+		// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
+		I2caRegs.I2CCNT = transaction->numberOfBytesRead;
+		if (transaction->numberOfBytesRead > I2C_FIFO_LEVEL_RX)
+		{
+				I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+				I2caRegs.I2CFFRX.bit.RXFFIENA = 1;
+		}
+}
+
+
+//=== Function: I2cStartTransactionA ==============================================================
+///
+/// @brief  Funktion startet eine Transaktion auf dem Bus. Bei einer Schreib-Lese-Transaktion
+///					wird nach dem Schreiben keine STOP-Bedingung gesendet, sondern der ARDY-Interrupt
+///					eingeschaltet, in dem die ISR die wiederholte START-Bedingung zum Lesen sendet
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cStartTransactionA(I2cTransaction *transaction)
+{
+		transaction->status = I2C_STATUS_IN_PROGRESS;
+		i2cQueueActiveA = true;
+		i2cTimestampStartA = PROFILE_TIMESTAMP();
+		i2cIndexWriteA = 0;
+		i2cIndexReadA = 0;
+		// Slave-Adresse setzen
+		I2caRegs.I2CMDR.bit.MST = 1;
+		I2caRegs.I2CSAR.bit.SAR = transaction->slaveAddress;
+		if (transaction->numberOfBytesWrite)
+		{
+				// Master-Transmitter Mode setzen
+				I2caRegs.I2CMDR.bit.TRX = 1;
+				// Zu sendene Daten in den Sende-FIFO kopieren. Passen nicht alle Bytes
+				// hinein, fllt der FIFO-Interrupt den Rest whrend der bertragung nach.
+				// Bis dahin hlt das I2C-Modul SCL auf 0 (Clock Stretching)
+				I2cFillFifoTxA(transaction);
+				if (i2cIndexWriteA < transaction->numberOfBytesWrite)
+				{
+						I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+						I2caRegs.I2CFFTX.bit.TXFFIENA = 1;
+				}
+				// Anzahl der zu schreibenden Bytes setzen (Adress-Byte zhlt nicht dazu)
+				I2caRegs.I2CCNT = transaction->numberOfBytesWrite;
+				if (transaction->numberOfBytesRead)
+				{
+						// ARDY-Interrupt einschalten damit das Ende der
+						// Schreib-Operation detektiert werden kann
+						i2cRepeatedStartPendingA = true;
+						I2caRegs.I2CIER.bit.ARDY = 1;
+						// bertragung starten (ohne STOP-Bedingung)
+						I2caRegs.I2CMDR.bit.STT = 1;
+						return;
+				}
+		}
+		else
+		{
+				I2cStartReadA(transaction);
+		}
+		// bertragung starten
+		I2caRegs.I2CMDR.bit.STT = 1;
+		// STOP-Bedingung senden, nachdem alle Bytes bertragen wurden
+		I2caRegs.I2CMDR.bit.STP = 1;
+}
+
+
+//=== Function: I2cFinishTransactionA =============================================================
+///
+/// @brief  Funktion wird in der ISR nach der STOP-Bedingung aufgerufen. Sie liest die empfangenen
+///					Daten in den Puffer der aktiven Transaktion, entfernt die Transaktion aus der
+///					Warteschlange, ruft die Callback-Funktion auf und startet die nchste Transaktion
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cFinishTransactionA(void)
+{
+		I2cTransaction *transaction = i2cQueueA[i2cQueueTailA];
+		uint32_t timestamp = PROFILE_TIMESTAMP();
+		uint32_t latency = timestamp - transaction->timestampSubmit;
+		uint32_t duration = timestamp - i2cTimestampStartA;
+
+		// Dauer vom Einreihen bzw. vom Start bis zum Ende der Transaktion
+		i2cStatisticsA.latencyLast = latency;
+		i2cStatisticsA.durationLast = duration;
+		if (latency > i2cStatisticsA.latencyMax)
+		{
+				i2cStatisticsA.latencyMax = latency;
+		}
+		if (duration > i2cStatisticsA.durationMax)
+		{
+				i2cStatisticsA.durationMax = duration;
+		}
+
+		// FIFO-Interrupts ausschalten (werden beim Start der nchsten Transaktion bei Bedarf
+		// wieder eingeschaltet)
+		I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+		I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+
+		if (transaction->status == I2C_STATUS_IN_PROGRESS)
+		{
+				// Restliche empfangene Daten auslesen, falls Receiver-Mode aktiv
+				I2cDrainFifoRxA(transaction);
+				transaction->status = I2C_STATUS_FINISHED;
+				i2cStatisticsA.finished++;
+		}
+		else
+		{
+				// Nach einem NACK knnen noch nicht gesendete Bytes im Sende-FIFO
+				// stehen, die sonst mit der nchsten Transaktion gesendet wrden
+				I2caRegs.I2CFFTX.bit.TXFFRST = 0;
+				I2caRegs.I2CFFRX.bit.RXFFRST = 0;
+				I2caRegs.I2CFFTX.bit.TXFFRST = 1;
+				I2caRegs.I2CFFRX.bit.RXFFRST = 1;
+		}
+
+		// Transaktion aus der Warteschlange entfernen, bevor die Callback-Funktion
+		// aufgerufen wird, damit diese eine neue Transaktion einreihen kann
+		if (++i2cQueueTailA >= I2C_SIZE_QUEUE)
+		{
+				i2cQueueTailA = 0;
+		}
+		i2cQueueActiveA = false;
+		if (transaction->callback)
+		{
+				transaction->callback(transaction);
+		}
+		// Nchste Transaktion starten, falls die Callback-Funktion
+		// dies nicht bereits ber "I2cSubmitA()" getan hat
+		if (!i2cQueueActiveA && (i2cQueueHeadA != i2cQueueTailA))
+		{
+				I2cStartTransactionA(i2cQueueA[i2cQueueTailA]);
+		}
+}
+
+
+//=== Function: I2cSetPinsGpioA ===================================================================
+///
+/// @brief  Funktion schaltet GPIO 0 (SDA) und GPIO 1 (SCL) zwischen I2C-Funktion und GPIO-Funktion
+///					um. Als GPIO sind beide Pins Eingnge mit Ausgangswert 0, sodass sie ber das
+///					Richtungsbit wie ein Open-Drain-Ausgang auf 0 gezogen oder freigegeben werden
+///					(der Pull-Up-Widerstand zieht sie auf 1). Bei der Umschaltung wird zuerst
+///					GPAMUX1 auf 0 gesetzt, damit beim ndern von GPAGMUX1 keine andere Funktion
+///					aktiv wird
+///
+/// @param  bool gpio
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cSetPinsGpioA(bool gpio)
+{
+		EALLOW;
+		GpioCtrlRegs.GPAMUX1.bit.GPIO0 = 0;
+		GpioCtrlRegs.GPAMUX1.bit.GPIO1 = 0;
+		if (gpio)
+		{
+				GpioCtrlRegs.GPADIR.bit.GPIO0 = 0;
+				GpioCtrlRegs.GPADIR.bit.GPIO1 = 0;
+				GpioDataRegs.GPACLEAR.bit.GPIO0 = 1;
+				GpioDataRegs.GPACLEAR.bit.GPIO1 = 1;
+				GpioCtrlRegs.GPAGMUX1.bit.GPIO0 = 0;
+				GpioCtrlRegs.GPAGMUX1.bit.GPIO1 = 0;
+		}
+		else
+		{
+				GpioCtrlRegs.GPADIR.bit.GPIO0 = 0;
+				GpioCtrlRegs.GPADIR.bit.GPIO1 = 0;
+				GpioCtrlRegs.GPAGMUX1.bit.GPIO0 = (6 >> 2);
+				GpioCtrlRegs.GPAGMUX1.bit.GPIO1 = (6 >> 2);
+				GpioCtrlRegs.GPAMUX1.bit.GPIO0  = (6 & 0x03);
+				GpioCtrlRegs.GPAMUX1.bit.GPIO1  = (6 & 0x03);
+		}
+		EDIS;
+}
+
+
+//=== Function: I2cRecoveryStepA ==================================================================
+///
+/// @brief  Funktion fhrt einen Schritt der Wiederherstellung des Busses aus, sobald seit dem
+///					letzten Schritt I2C_RECOVERY_HALF_PERIOD_US vergangen sind. Zuerst wird SCL bis zu
+///					9-mal getaktet, bis der Slave SDA freigibt (er beendet damit das angefangene Byte),
+///					danach wird eine STOP-Bedingung erzeugt (SDA 0 -> 1 bei SCL = 1). Zum Schluss
+///					werden die Pins wieder auf I2C geschaltet, das Modul aus dem Reset geholt und
+///					die abgebrochene Transaktion beendet. Der I2C-Interrupt muss gesperrt sein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cRecoveryStepA(void)
+{
+		uint32_t timestamp = PROFILE_TIMESTAMP();
+
+		if ((timestamp - i2cRecoveryTimestampA)
+				< ((uint32_t)I2C_RECOVERY_HALF_PERIOD_US * DEVICE_SYSCLK_MHZ))
+		{
+				return;
+		}
+		i2cRecoveryTimestampA = timestamp;
+
+		EALLOW;
+		if (i2cRecoveryStateA == I2C_RECOVERY_CLOCK)
+		{
+				// Gerade Schritte: SCL auf 0 ziehen, ungerade Schritte: SCL freigeben
+				if (!(i2cRecoveryStepA & 1))
+				{
+						GpioCtrlRegs.GPADIR.bit.GPIO1 = 1;
+				}
+				else
+				{
+						GpioCtrlRegs.GPADIR.bit.GPIO1 = 0;
+				}
+				i2cRecoveryStepA++;
+				// SDA wieder frei (nach einem vollstndigen Takt) oder 9 Takte gesendet
+				if ((!(i2cRecoveryStepA & 1) && GpioDataRegs.GPADAT.bit.GPIO0)
+						|| (i2cRecoveryStepA >= (2 * I2C_RECOVERY_CLOCK_PULSES)))
+				{
+						i2cRecoveryStateA = I2C_RECOVERY_STOP;
+						i2cRecoveryStepA = 0;
+				}
+		}
+		else if (i2cRecoveryStateA == I2C_RECOVERY_STOP)
+		{
+				switch (i2cRecoveryStepA++)
+				{
+						// SCL auf 0
+						case 0:
+								GpioCtrlRegs.GPADIR.bit.GPIO1 = 1;
+								break;
+						// SDA bei SCL = 0 auf 0 ziehen
+						case 1:
+								GpioCtrlRegs.GPADIR.bit.GPIO0 = 1;
+								break;
+						// SCL freigeben
+						case 2:
+								GpioCtrlRegs.GPADIR.bit.GPIO1 = 0;
+								break;
+						// SDA bei SCL = 1 freigeben (STOP-Bedingung)
+						case 3:
+								GpioCtrlRegs.GPADIR.bit.GPIO0 = 0;
+								break;
+						// Busleitungen prfen und I2C-Modul wieder einschalten
+						default:
+								if (!GpioDataRegs.GPADAT.bit.GPIO0
+										|| !GpioDataRegs.GPADAT.bit.GPIO1)
+								{
+										i2cStatisticsA.recoveriesFailed++;
+								}
+								i2cRecoveryStateA = I2C_RECOVERY_IDLE;
+								break;
+				}
+		}
+		EDIS;
+
+		if (i2cRecoveryStateA == I2C_RECOVERY_IDLE)
+		{
+				I2cSetPinsGpioA(false);
+				// Modul aus dem Reset holen. Die Konfiguration (Takt, Adressformat,
+				// FIFOs, Interrupts) bleibt beim Reset ber IRS erhalten
+				I2caRegs.I2CMDR.bit.IRS = 1;
+				I2cFinishTransactionA();
+		}
+}
+
+
+//=== Function: I2cStatusCallbackA ================================================================
+///
+/// @brief  Callback-Funktion der Transaktion von "I2cWriteA()", "I2cReadA()" und
+///					"I2cWriteReadA()". bertrgt den Zustand der Transaktion auf "i2cStatusFlagA"
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static void I2cStatusCallbackA(I2cTransaction *transaction)
+{
+		i2cStatusFlagA = transaction->status;
+}
+
+
+//=== Function: I2cSubmitStatusA ==================================================================
+///
+/// @brief  Funktion reiht die Transaktion von "I2cWriteA()", "I2cReadA()" und "I2cWriteReadA()"
+///					mit den globalen Puffern ein, falls keine vorherige dieser Transaktionen aktiv ist
+///
+/// @param  uint16_t slaveAddress, uint16_t numberOfBytesWrite, uint16_t numberOfBytesRead
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+static bool I2cSubmitStatusA(uint16_t slaveAddress,
+														 uint16_t numberOfBytesWrite,
+														 uint16_t numberOfBytesRead)
+{
+		bool operationPerformed = false;
+
+		// Die globalen Puffer haben die Gre der Hardware-FIFOs
+		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
+				&& (numberOfBytesWrite <= I2C_SIZE_HARDWARE_FIFO)
+				&& (numberOfBytesRead  <= I2C_SIZE_HARDWARE_FIFO))
+		{
+				i2cTransactionA.slaveAddress       = slaveAddress;
+				i2cTransactionA.bufferWrite        = i2cBufferWriteA;
+				i2cTransactionA.numberOfBytesWrite = numberOfBytesWrite;
+				i2cTransactionA.bufferRead         = i2cBufferReadA;
+				i2cTransactionA.numberOfBytesRead  = numberOfBytesRead;
+				i2cTransactionA.callback           = &I2cStatusCallbackA;
+				// Status-Flag setzen um der aufrufenden Stelle zu signalisieren,
+				// dass eine I2C-Kommunikation gestartet wurde
+				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
+				operationPerformed = I2cSubmitA(&i2cTransactionA);
+				if (!operationPerformed)
+				{
+						i2cStatusFlagA = I2C_STATUS_IDLE;
+				}
+		}
+		return operationPerformed;
+}
 
 
 //-------------------------------------------------------------------------------------------------
@@ -129,14 +569,17 @@ void I2cInitA(uint32_t clock)
 		// die Anzahl der vollstndig gesendeten Bytes wieder, da sich das ent-
 		// sprechende Byte noch im Sende-Shift-Register befindet und Bit fr Bit
 		// ausgesendet wird, whrend der Wert bereits um 1 reduziert wurde. Somit
-		// wird auch der Interrupt ausgelst, bevor das Byte vollstndig gesendet wurde
-		I2caRegs.I2CFFTX.bit.TXFFIL = 0;
+		// wird auch der Interrupt ausgelst, bevor das Byte vollstndig gesendet wurde.
+		// Der Interrupt wird nur bei Transaktionen eingeschaltet, die nicht vollstndig
+		// in den FIFO passen
+		I2caRegs.I2CFFTX.bit.TXFFIL = I2C_FIFO_LEVEL_TX;
 		// Wenn der Wert im Feld I2CFFRX.RXFFST gleich oder grer als der Wert in
 		// I2CFFRX.RXFFIL ist, wird ein Interrupt ausgelst. Der Wert I2CFFRX.RXFFST
 		// speichert die Zahl an Bytes, die im Empfangs-FIFO stehen. Anders als beim
 		// Sendevorgang wird der Interrupt also genau zu dem Zeitpunkt ausgelst,
-		// wenn das letzte Byte vollstndig empfangen wurde
-		I2caRegs.I2CFFRX.bit.RXFFIL = 0;
+		// wenn das letzte Byte vollstndig empfangen wurde. Der Interrupt wird nur
+		// bei Transaktionen eingeschaltet, die mehr als I2C_FIFO_LEVEL_RX Bytes lesen
+		I2caRegs.I2CFFRX.bit.RXFFIL = I2C_FIFO_LEVEL_RX;
 		// Sende- und Empfangs-FIFO-Interrupt ausschalten
 		I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
 		I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
@@ -159,6 +602,9 @@ void I2cInitA(uint32_t clock)
     // I2CA-Interrupt freischalten (Zeile 8, Spalte 1 der Tabelle 3-2)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
     PieCtrlRegs.PIEIER8.bit.INTx1 = 1;
+    // ISR fr den I2C-FIFO-Interrupt setzen und freischalten (Zeile 8, Spalte 2)
+    PieVectTable.I2CA_FIFO_INT = &I2cFifoISRA;
+    PieCtrlRegs.PIEIER8.bit.INTx2 = 1;
     // CPU-Interrupt 8 einschalten (Zeile 8 der Tabelle)
     IER |= M_INT8;
     // Interrupts global einschalten
@@ -170,8 +616,32 @@ void I2cInitA(uint32_t clock)
     // Software-Puffer inititalisieren
     I2cInitBufferReadA();
     I2cInitBufferWriteA();
-    // Steuervariable fr die Puffer-Verwaltung initialisieren
-    i2cBytesToReadAfterRSA = 0;
+    // Noch eingereihte Transaktionen werden durch den Reset des Moduls
+    // abgebrochen und als fehlerhaft markiert (ohne Callback-Funktion)
+    while (i2cQueueTailA != i2cQueueHeadA)
+    {
+    		i2cQueueA[i2cQueueTailA]->status = I2C_STATUS_ERROR;
+    		if (++i2cQueueTailA >= I2C_SIZE_QUEUE)
+    		{
+    				i2cQueueTailA = 0;
+    		}
+    }
+    // Warteschlange initialisieren
+    i2cQueueHeadA = 0;
+    i2cQueueTailA = 0;
+    i2cQueueActiveA = false;
+    i2cRepeatedStartPendingA = false;
+    i2cRecoveryStateA = I2C_RECOVERY_IDLE;
+    // Statistik zurcksetzen
+    i2cStatisticsA.finished = 0;
+    i2cStatisticsA.nacks = 0;
+    i2cStatisticsA.timeouts = 0;
+    i2cStatisticsA.recoveries = 0;
+    i2cStatisticsA.recoveriesFailed = 0;
+    i2cStatisticsA.latencyLast = 0;
+    i2cStatisticsA.latencyMax = 0;
+    i2cStatisticsA.durationLast = 0;
+    i2cStatisticsA.durationMax = 0;
     // Status-Flag fr die I2C-Kommunikation auf "idle" setzen
     i2cStatusFlagA = I2C_STATUS_IDLE;
 }
@@ -188,10 +658,7 @@ void I2cInitA(uint32_t clock)
 //=================================================================================================
 void I2cInitBufferReadA(void)
 {
-    for(uint16_t i=0; i<I2C_SIZE_HARDWARE_FIFO; i++)
-    {
-        i2cBufferReadA[i] = 0;
-    }
+    ByteBufferClear(i2cBufferReadA, I2C_SIZE_HARDWARE_FIFO);
 }
 
 
@@ -206,10 +673,7 @@ void I2cInitBufferReadA(void)
 //=================================================================================================
 void I2cInitBufferWriteA(void)
 {
-    for(uint16_t i=0; i<I2C_SIZE_HARDWARE_FIFO; i++)
-    {
-    		i2cBufferWriteA[i] = 0;
-    }
+    ByteBufferClear(i2cBufferWriteA, I2C_SIZE_HARDWARE_FIFO);
 }
 
 
@@ -272,6 +736,138 @@ extern bool I2cSetStatusIdleA(void)
 }
 
 
+//=== Function: I2cSubmitA ========================================================================
+///
+/// @brief  Funktion reiht eine Transaktion in die Warteschlange ein. Ist keine andere Transaktion
+///					aktiv, wird sie sofort gestartet, andernfalls startet sie die ISR direkt nach der
+///					STOP-Bedingung der vorherigen Transaktion. Die Anzahl der zu schreibenden und zu
+///					lesenden Bytes ist nicht durch die Hardware-FIFOs begrenzt (maximal 65535, Register
+///					I2CCNT), mindestens eine der beiden muss grer 0 sein. Sind beide grer 0, wird
+///					nach dem Schreiben mit einer wiederholten START-Bedingung gelesen. Der
+///					Rckgabewert ist "true", falls die Transaktion eingereiht
+///					wurde, und "false", falls die Parameter ungltig sind oder die Warteschlange voll
+///					ist. Die Funktion darf auch aus einer Callback-Funktion aufgerufen werden.
+///
+/// @param  I2cTransaction *transaction
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool I2cSubmitA(I2cTransaction *transaction)
+{
+		bool operationPerformed = false;
+		uint16_t head;
+		uint16_t savedIER;
+
+		if (transaction->numberOfBytesWrite || transaction->numberOfBytesRead)
+		{
+				// I2C-Interrupt sperren, da die ISR die Warteschlange ebenfalls verndert
+				// und ggf. selbst die nchste Transaktion startet
+				savedIER = IER;
+				IER &= ~M_INT8;
+
+				head = i2cQueueHeadA + 1;
+				if (head >= I2C_SIZE_QUEUE)
+				{
+						head = 0;
+				}
+				// Warteschlange nicht voll
+				if (head != i2cQueueTailA)
+				{
+						transaction->status = I2C_STATUS_QUEUED;
+						transaction->timestampSubmit = PROFILE_TIMESTAMP();
+						i2cQueueA[i2cQueueHeadA] = transaction;
+						i2cQueueHeadA = head;
+						// Bus ist frei: Transaktion sofort starten
+						if (!i2cQueueActiveA)
+						{
+								I2cStartTransactionA(i2cQueueA[i2cQueueTailA]);
+						}
+						operationPerformed = true;
+				}
+
+				IER = savedIER;
+		}
+		return operationPerformed;
+}
+
+
+//=== Function: I2cGetQueueCountA =================================================================
+///
+/// @brief  Funktion gibt die Anzahl der Transaktionen in der Warteschlange zurck (inkl. der
+///					gerade aktiven Transaktion)
+///
+/// @param  void
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+uint16_t I2cGetQueueCountA(void)
+{
+		uint16_t head = i2cQueueHeadA;
+		uint16_t tail = i2cQueueTailA;
+
+		return (head >= tail) ? (head - tail) : (head + I2C_SIZE_QUEUE - tail);
+}
+
+
+//=== Function: I2cTickA ==========================================================================
+///
+/// @brief  Funktion berwacht die Zeitgrenze der aktiven Transaktion und fhrt die
+///					Wiederherstellung des Busses aus. Sie muss regelmig aufgerufen werden (z.B. in der
+///					Hauptschleife oder einer Timer-ISR), wartet aber selbst nie. berschreitet die
+///					Transaktion "timeoutUs" (0: I2C_TIMEOUT_DEFAULT_US), wird sie als fehlerhaft
+///					markiert, das Modul in den Reset gesetzt und die Wiederherstellung gestartet. Nach
+///					der Wiederherstellung wird die Transaktion beendet und die nchste gestartet. Die
+///					Callback-Funktion wird in diesem Fall aus "I2cTickA()" aufgerufen. Die Funktion
+///					gibt "true" zurck, solange die Wiederherstellung luft.
+///
+/// @param  void
+///
+/// @return bool recoveryActive
+///
+//=================================================================================================
+bool I2cTickA(void)
+{
+		I2cTransaction *transaction;
+		uint32_t timeout;
+		uint16_t savedIER;
+
+		// I2C-Interrupt sperren, damit die ISR die Transaktion nicht gleichzeitig beendet
+		savedIER = IER;
+		IER &= ~M_INT8;
+
+		if (i2cRecoveryStateA != I2C_RECOVERY_IDLE)
+		{
+				I2cRecoveryStepA();
+		}
+		else if (i2cQueueActiveA)
+		{
+				transaction = i2cQueueA[i2cQueueTailA];
+				timeout = transaction->timeoutUs ? transaction->timeoutUs : I2C_TIMEOUT_DEFAULT_US;
+				if ((transaction->status == I2C_STATUS_IN_PROGRESS)
+						&& ((PROFILE_TIMESTAMP() - i2cTimestampStartA) > (timeout * DEVICE_SYSCLK_MHZ)))
+				{
+						transaction->status = I2C_STATUS_ERROR;
+						i2cStatisticsA.timeouts++;
+						i2cStatisticsA.recoveries++;
+						i2cRepeatedStartPendingA = false;
+						// Modul in den Reset setzen (gibt SDA und SCL frei und lscht die
+						// Statusbits) und die Pins fr die Wiederherstellung auf GPIO schalten
+						I2caRegs.I2CIER.bit.ARDY = 0;
+						I2caRegs.I2CMDR.bit.IRS = 0;
+						I2cSetPinsGpioA(true);
+						i2cRecoveryStateA = I2C_RECOVERY_CLOCK;
+						i2cRecoveryStepA = 0;
+						i2cRecoveryTimestampA = PROFILE_TIMESTAMP();
+				}
+		}
+
+		IER = savedIER;
+		return (i2cRecoveryStateA != I2C_RECOVERY_IDLE);
+}
+
+
 //=== Function: I2cWriteA =========================================================================
 ///
 /// @brief  Funktion schreibt Daten ber IC auf einen Slave (Master Transmitter Mode). Der erste
@@ -279,8 +875,10 @@ extern bool I2cSetStatusIdleA(void)
 ///					Der zweite Parameter gibt die Anzahl der zu sendenen Bytes (ohne die Slave-Adresse)
 ///					an. Die zu schreibenden Daten mssen von der aufrufenden Stelle in das globale Array
 ///					"i2cBufferWrite" kopiert werden. Es knnen maximal 16 Bytes geschrieben werden. Der
-///					Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine vorangegegangene
-///					Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er "false".
+///					Rckgabwert ist "true" falls die Kommunikation eingereiht wurde (keine vorangegegangene
+///					Kommunikation dieser Funktionen ist aktiv und die Warteschlange ist nicht voll),
+///					andernfalls ist er "false". Sind noch andere Transaktionen in der Warteschlange,
+///					werden die Daten erst beim Start aus "i2cBufferWrite" gelesen.
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytes
 ///
@@ -290,41 +888,12 @@ extern bool I2cSetStatusIdleA(void)
 bool I2cWriteA(uint16_t slaveAddress,
 						   uint16_t numberOfBytes)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet / nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu schreibenden Bytes die Gre des Software-Puffers nicht
-		// berschreitet und mindestens 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytes <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytes)
+		// Mindestens 1 Byte schreiben
+		if (!numberOfBytes)
 		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Status-Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
-				// Master-Transmitter Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 1;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Zu sendene Daten in den Sende-FIFO kopieren
-				for (uint16_t i=0; i<numberOfBytes; i++)
-				{
-						I2caRegs.I2CDXR.bit.DATA = i2cBufferWriteA[i];
-				}
-				// Anzahl der zu schreibenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = numberOfBytes;
-				// bertragung starten
-				I2caRegs.I2CMDR.bit.STT = 1;
-				// STOP-Bedingung senden, nachdem alle Bytes an den Slave gesendet wurden
-				I2caRegs.I2CMDR.bit.STP = 1;
+				return false;
 		}
-		return operationPerformed;
+		return I2cSubmitStatusA(slaveAddress, numberOfBytes, 0);
 }
 
 
@@ -335,8 +904,9 @@ bool I2cWriteA(uint16_t slaveAddress,
 ///					Der zweite Parameter gibt die Anzahl der zu lesenden Bytes (ohne die Slave-Adresse).
 ///					an. Die gelesenen Daten knnen von der aufrufenden Stelle aus dem globale Array
 ///					"i2cBufferRead" gelesen werden. Es knnen maximal 16 Bytes gelesen werden. Der
-///					Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine vorangegegangene
-///					Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er "false".
+///					Rckgabwert ist "true" falls die Kommunikation eingereiht wurde (keine vorangegegangene
+///					Kommunikation dieser Funktionen ist aktiv und die Warteschlange ist nicht voll),
+///					andernfalls ist er "false".
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytes
 ///
@@ -346,36 +916,12 @@ bool I2cWriteA(uint16_t slaveAddress,
 bool I2cReadA(uint16_t slaveAddress,
 						  uint16_t numberOfBytes)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet/nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu lesenden Bytes die Gre des Software-Puffers nicht
-		// berschreitet und mindestens 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytes <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytes)
-		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
-				// Master-Receiver Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 0;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = numberOfBytes;
-				// bertragung starten
-				I2caRegs.I2CMDR.bit.STT = 1;
-				// STOP-Bedingung senden, nachdem alle Bytes vom Slave gelesen wurden
-				I2caRegs.I2CMDR.bit.STP = 1;
+		// Mindestens 1 Byte lesen
+		if (!numberOfBytes)
+		{
+				return false;
 		}
-		return operationPerformed;
+		return I2cSubmitStatusA(slaveAddress, 0, numberOfBytes);
 }
 
 
@@ -386,10 +932,11 @@ bool I2cReadA(uint16_t slaveAddress,
 ///					mit dem kommuniziert werden soll. Der zweite Parameter gibt die Anzahl der zu
 ///					schreibenden Bytes an, der dritte Parameter die Anzahl der zu lesenden Bytes (beides
 ///					jeweils ohne die Slave-Adresse). Es knnen maximal 16 Bytes geschreiben bzw. gelesen
-///					werden. Der Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine
-///					vorangegangene Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er
-///					"false". Die zu schreibenen Daten werden aus dem Software-Puffer "i2cBufferWriteA[]"
-///					kopiert. Die gelesenen Daten werden in den Software-Puffer "i2cBufferReadA[]" kopiert.
+///					werden. Der Rckgabwert ist "true" falls die Kommunikation eingereiht wurde (keine
+///					vorangegangene Kommunikation dieser Funktionen ist aktiv und die Warteschlange ist
+///					nicht voll), andernfalls ist er "false". Die zu schreibenen Daten werden aus dem
+///					Software-Puffer "i2cBufferWriteA[]" kopiert. Die gelesenen Daten werden in den
+///					Software-Puffer "i2cBufferReadA[]" kopiert.
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytesWrite, uint16_t numberOfBytesRead
 ///
@@ -400,58 +947,21 @@ bool I2cWriteReadA(uint16_t slaveAddress,
 						       uint16_t numberOfBytesWrite,
 									 uint16_t numberOfBytesRead)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet / nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu schreibenden und lesenden Bytes die Gre der Software-
-		// Puffer nicht berschreitet und mindesten 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytesWrite <= I2C_SIZE_HARDWARE_FIFO)
-				&& (numberOfBytesRead  <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytesWrite
-				&& numberOfBytesRead)
+		// Mindestens 1 Byte schreiben und 1 Byte lesen
+		if (!numberOfBytesWrite || !numberOfBytesRead)
 		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
-				// Master-Transmitter Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 1;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Zu sendene Daten in den TX-FIFO kopieren
-				for (uint16_t i=0; i<numberOfBytesWrite; i++)
-				{
-						I2caRegs.I2CDXR.bit.DATA = i2cBufferWriteA[i];
-				}
-				// Anzahl der zu schreibenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = numberOfBytesWrite;
-				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu).
-				// Dieser Wert wird nach Ende der Schreib-Operation in der ISR in das
-				// Register I2CCNT geschrieben
-				i2cBytesToReadAfterRSA = numberOfBytesRead;
-				// ARDY-Interrupt einschalten damit das Ende der
-				// Schreib-Operation detektiert werden kann
-				I2caRegs.I2CIER.bit.ARDY = 1;
-				// bertragung starten
-				I2caRegs.I2CMDR.bit.STT = 1;
+				return false;
 		}
-		return operationPerformed;
+		return I2cSubmitStatusA(slaveAddress, numberOfBytesWrite, numberOfBytesRead);
 }
 
 
 //=== Function: I2cISRA ===========================================================================
 ///
 /// @brief	Funktion wird aufgerufen, wenn eine STOP-Benung auf dem Bus gesendet, ein NACK
-///					empfangen, ein Byte vom Empfangs-Register in den (Hardware) Empfangs-Puffer geshiftet,
-///					ein Byte vom (Hardware) Sende-Puffer in das Sende-Register geshiftet oder der interne
-///					Zhler des I2C-Moduls, welcher die Bytes zhlt, auf 0 gegangen ist und keine STOP-
-///					Bedingung gesendet wurde.
+///					empfangen oder bei einer Schreib-Lese-Transaktion das Schreiben beendet wurde (ARDY).
+///					Nach der STOP-Bedingung wird die aktive Transaktion abgeschlossen und die nchste
+///					Transaktion der Warteschlange gestartet.
 ///
 /// @param  void
 ///
@@ -460,6 +970,8 @@ bool I2cWriteReadA(uint16_t slaveAddress,
 //=================================================================================================
 __interrupt void I2cISRA(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_I2C);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -469,64 +981,115 @@ __interrupt void I2cISRA(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Es wurde eine STOP-Bedingung erkannt
-		if (I2caRegs.I2CSTR.bit.SCD)
-		{
-				// STOP-Flag lschen
-				I2caRegs.I2CSTR.bit.SCD = 1;
-				// Daten auslesen, fallsReceiver-Mode aktiv
-				if (!I2caRegs.I2CMDR.bit.TRX)
-				{
-						// Empfangene Daten auslesen
-						for (uint16_t i=0; i<I2caRegs.I2CCNT; i++)
-						{
-								i2cBufferReadA[i] = I2caRegs.I2CDRR.bit.DATA;
-						}
-				}
-				// Status-Flag setzen um das Ende der bertragung zu
-				// signalisieren, falls kein Fehler aufgetreten ist
-				if (i2cStatusFlagA == I2C_STATUS_IN_PROGRESS)
-				{
-						i2cStatusFlagA = I2C_STATUS_FINISHED;
-				}
-		}
 		// Ein NACK wurde empfangen. Im Master-Receiver-Mode
 		// nur mglich nach dem Senden der Slave-Adresse
-		else if (I2caRegs.I2CSTR.bit.NACK)
+		if (I2caRegs.I2CSTR.bit.NACK)
 		{
 				// NACK-Flag lschen
 				I2caRegs.I2CSTR.bit.NACK = 1;
+				// Ausstehende wiederholte START-Bedingung verwerfen
+				i2cRepeatedStartPendingA = false;
+				I2caRegs.I2CIER.bit.ARDY = 0;
 				// STOP-Bedingung senden
 				I2caRegs.I2CMDR.bit.STP = 1;
-				// Status-Flag setzen um ein Fehler in der bertragung zu signalisieren
-				i2cStatusFlagA = I2C_STATUS_ERROR;
+				// Transaktion als fehlerhaft markieren. Sie wird nach der
+				// STOP-Bedingung aus der Warteschlange entfernt
+				if (i2cQueueActiveA)
+				{
+						i2cQueueA[i2cQueueTailA]->status = I2C_STATUS_ERROR;
+						i2cStatisticsA.nacks++;
+				}
 		}
 		// Write-Read-Modus:
 		// Im Non-Repeat Mode (RM in I2CMDR ist nicht gesetzt) wird ARDY gesetzt, sobald
 		// die Anzahl von Bytes, die in I2CCNT steht, geschrieben bzw. gelesen wurde und keine
 		// STOP-Bedingung abgesendet wurde (STP in I2CMDR wurde nach dem Start nicht gesetzt)
-		// oder wenn ein NACK empfangen wurde. Damit letztgenannte Bedingung im Fehlerfall
-		// (z.B. ungltige Slave-Adresse) nicht dazu fhrt, dass stndig eine wiederholte
-		// START-Bedingung getriggert wird, wird zustzlich abgefragt, ob ein NACK empfangen
-		// wurde
-		if (I2caRegs.I2CSTR.bit.ARDY
-				&& !I2caRegs.I2CSTR.bit.NACK)
+		// oder wenn ein NACK empfangen wurde. Letzteres wird oben behandelt und setzt
+		// "i2cRepeatedStartPendingA" zurck, damit im Fehlerfall (z.B. ungltige Slave-
+		// Adresse) nicht stndig eine wiederholte START-Bedingung getriggert wird
+		else if (I2caRegs.I2CSTR.bit.ARDY
+						 && i2cRepeatedStartPendingA)
 		{
+				i2cRepeatedStartPendingA = false;
 				// ARDY-Interrupt ausschalten (dieser wird nur einmalig
 				// bei einer Schreib-Lese-Operation bentigt um das Ende
 				// des Schreib-Datenpakets zu detektieren)
 				I2caRegs.I2CIER.bit.ARDY = 0;
-				// Master-Receiver Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 0;
-				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = i2cBytesToReadAfterRSA;
+				I2cStartReadA(i2cQueueA[i2cQueueTailA]);
 				// Wiederholte START-Bedingung senden
 				I2caRegs.I2CMDR.bit.STT = 1;
 				// STOP-Bedingung senden, nachdem alle Bytes vom Slave gelesen wurden
 				I2caRegs.I2CMDR.bit.STP = 1;
 		}
 
+		// Es wurde eine STOP-Bedingung erkannt
+		if (I2caRegs.I2CSTR.bit.SCD)
+		{
+				// STOP-Flag lschen
+				I2caRegs.I2CSTR.bit.SCD = 1;
+				// Aktive Transaktion abschlieen und die nchste starten
+				if (i2cQueueActiveA)
+				{
+						I2cFinishTransactionA();
+				}
+		}
+
 		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_I2CA-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_I2C);
+}
+
+
+//=== Function: I2cFifoISRA =======================================================================
+///
+/// @brief	Funktion wird aufgerufen, wenn im Sende-FIFO hchstens I2C_FIFO_LEVEL_TX Bytes oder im
+///					Empfangs-FIFO mindestens I2C_FIFO_LEVEL_RX Bytes stehen. Sie fllt den Sende-FIFO
+///					mit den nchsten Bytes der aktiven Transaktion bzw. leert den Empfangs-FIFO in deren
+///					Puffer. Die Laufzeit wird im selben Profiling-Slot wie I2cISRA() erfasst.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void I2cFifoISRA(void)
+{
+		I2cTransaction *transaction = i2cQueueA[i2cQueueTailA];
+
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_I2C);
+
+		// Sende-FIFO nachfllen
+		if (I2caRegs.I2CFFTX.bit.TXFFINT)
+		{
+				if (i2cQueueActiveA)
+				{
+						I2cFillFifoTxA(transaction);
+				}
+				// Alle Bytes stehen im FIFO: Interrupt nicht mehr bentigt
+				if (!i2cQueueActiveA || (i2cIndexWriteA >= transaction->numberOfBytesWrite))
+				{
+						I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+				}
+				I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+		}
+		// Empfangs-FIFO leeren
+		if (I2caRegs.I2CFFRX.bit.RXFFINT)
+		{
+				if (i2cQueueActiveA)
+				{
+						I2cDrainFifoRxA(transaction);
+				}
+				// Restliche Bytes bleiben unter der Schwelle und
+				// werden nach der STOP-Bedingung gelesen
+				if (!i2cQueueActiveA
+						|| ((transaction->numberOfBytesRead - i2cIndexReadA) < I2C_FIFO_LEVEL_RX))
+				{
+						I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+				}
+				I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+		}
+
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der I2CA_FIFO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_I2C);
 }
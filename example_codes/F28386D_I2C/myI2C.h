@@ -9,9 +9,28 @@
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V1.4
+///							nderung in Version 1.5: Warteschlange fr I2C-Transaktionen. Jede Transaktion
+///							bringt eigene Puffer und eine Callback-Funktion mit und wird mit
+///							"I2cSubmitA()" eingereiht. Die ISR startet die nchste Transaktion direkt nach
+///							der STOP-Bedingung der vorherigen, sodass mehrere Slaves ohne Warten im
+///							Hauptprogramm nacheinander abgefragt werden.
 ///
-/// @date       27.03.2023
+///							nderung in Version 1.6: Transaktionen der Warteschlange sind nicht mehr auf
+///							die Gre der Hardware-FIFOs begrenzt. Der FIFO-Interrupt (I2CA_FIFO_INT)
+///							fllt den Sende-FIFO whrend der bertragung nach und leert den Empfangs-FIFO.
+///
+///							nderung in Version 1.7: Zeitberwachung jeder Transaktion und Wiederherstellung
+///							des Busses ohne zu warten ("I2cTickA()"), Statistik in "i2cStatisticsA".
+///
+///							nderung in Version 1.8: Die Software-Puffer "i2cBufferWriteA[]" und "i2cBufferReadA[]"
+///							sowie die Puffer der Transaktionen sind gepackt (zwei Bytes pro Wort, myByteBuffer.h)
+///							und belegen nur noch die Hlfte des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET()
+///							und BYTE_BUFFER_SET(), die FIFO-Kopierschleifen der ISR lesen und schreiben die Bytes
+///							direkt im gepackten Puffer.
+///
+/// @version    V1.8
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +40,8 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
+#include "myByteBuffer.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -41,11 +62,32 @@
 // Gre der Software-Puffer fr I2C-Kommunikation. Darf nicht grer
 // als die Hardware-Puffer (16 Byte) des I2C-Moduls gewhlt werden
 #define I2C_SIZE_HARDWARE_FIFO					16
+// Schwellen der FIFO-Interrupts. Der Sende-FIFO wird nachgefllt, sobald hchstens
+// I2C_FIFO_LEVEL_TX Bytes darin stehen, der Empfangs-FIFO geleert, sobald mindestens
+// I2C_FIFO_LEVEL_RX Bytes darin stehen. Die restlichen 8 Bytes berbrcken bei 400 kHz
+// eine Interrupt-Latenz von ca. 180 s, bevor das Modul SCL anhalten muss
+#define I2C_FIFO_LEVEL_TX								8
+#define I2C_FIFO_LEVEL_RX								8
 // Zustnde der I2C-Kommunikation (i2cStatusFlag)
 #define I2C_STATUS_IDLE									0
 #define I2C_STATUS_IN_PROGRESS					1
 #define I2C_STATUS_FINISHED							2
 #define I2C_STATUS_ERROR 								3
+#define I2C_STATUS_QUEUED								4
+// Anzahl der Pltze der Warteschlange. Ein Platz bleibt frei, um eine volle von einer
+// leeren Warteschlange zu unterscheiden, es knnen also I2C_SIZE_QUEUE - 1 Transaktionen
+// (inkl. der gerade aktiven Transaktion) gleichzeitig eingereiht sein
+#define I2C_SIZE_QUEUE									8
+// Zeitgrenze einer Transaktion in s, falls in der Transaktion "timeoutUs" 0 ist
+// (maximal ca. 21 s, berlauf von CPU-Timer 2)
+#define I2C_TIMEOUT_DEFAULT_US					10000
+// Wiederherstellung des Busses: Anzahl der SCL-Takte und halbe Taktperiode (100 kHz)
+#define I2C_RECOVERY_CLOCK_PULSES				9
+#define I2C_RECOVERY_HALF_PERIOD_US			5
+// Zustnde der Wiederherstellung des Busses
+#define I2C_RECOVERY_IDLE								0
+#define I2C_RECOVERY_CLOCK							1
+#define I2C_RECOVERY_STOP								2
 
 
 //-------------------------------------------------------------------------------------------------
@@ -53,12 +95,55 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Eine I2C-Transaktion: Schreiben, Lesen oder Schreiben mit anschlieender wiederholter
+// START-Bedingung und Lesen (beides > 0). Die Struktur und die Puffer gehren der
+// aufrufenden Stelle und drfen bis zum Aufruf der Callback-Funktion bzw. bis "status"
+// nicht mehr I2C_STATUS_QUEUED oder I2C_STATUS_IN_PROGRESS ist nicht verndert werden
+typedef struct I2cTransaction
+{
+		uint16_t slaveAddress;
+		const uint16_t *bufferWrite;						// gepackt (BYTE_BUFFER_WORDS(numberOfBytesWrite))
+		uint16_t numberOfBytesWrite;
+		uint16_t *bufferRead;										// gepackt (BYTE_BUFFER_WORDS(numberOfBytesRead))
+		uint16_t numberOfBytesRead;
+		// Wird in der ISR nach dem Ende der Transaktion aufgerufen (darf 0 sein).
+		// In der Callback-Funktion darf "I2cSubmitA()" aufgerufen werden
+		void (*callback)(struct I2cTransaction *transaction);
+		// Zustand der Transaktion (I2C_STATUS_QUEUED ... I2C_STATUS_ERROR)
+		volatile uint16_t status;
+		// Zeitgrenze ab dem Start der Transaktion in s (0: I2C_TIMEOUT_DEFAULT_US)
+		uint32_t timeoutUs;
+		// Zeitstempel des Einreihens (wird von "I2cSubmitA()" gesetzt)
+		uint32_t timestampSubmit;
+} I2cTransaction;
+
+// Statistik der Transaktionen (Zeiten in Takten von CPU-Timer 2, 5 ns)
+typedef struct
+{
+		uint32_t finished;										// fehlerfrei beendete Transaktionen
+		uint32_t nacks;												// mit NACK abgebrochene Transaktionen
+		uint32_t timeouts;										// wegen Zeitberschreitung abgebrochene Transaktionen
+		uint32_t recoveries;									// gestartete Wiederherstellungen des Busses
+		uint32_t recoveriesFailed;						// SDA oder SCL nach der Wiederherstellung weiter 0
+		uint32_t latencyLast;									// Einreihen bis Ende der letzten Transaktion
+		uint32_t latencyMax;									// maximale Zeit vom Einreihen bis zum Ende
+		uint32_t durationLast;								// Start bis Ende der letzten Transaktion
+		uint32_t durationMax;									// maximale Zeit vom Start bis zum Ende
+} I2cStatistics;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die I2C-Kommunikation
-extern uint16_t i2cBufferWriteA[I2C_SIZE_HARDWARE_FIFO];
-extern uint16_t i2cBufferReadA[I2C_SIZE_HARDWARE_FIFO];
+// Software-Puffer fr die I2C-Kommunikation, gepackt: Zugriff mit
+// BYTE_BUFFER_GET(i2cBufferReadA, i) bzw. BYTE_BUFFER_SET(i2cBufferWriteA, i, byte)
+extern uint16_t i2cBufferWriteA[BYTE_BUFFER_WORDS(I2C_SIZE_HARDWARE_FIFO)];
+extern uint16_t i2cBufferReadA[BYTE_BUFFER_WORDS(I2C_SIZE_HARDWARE_FIFO)];
+// Statistik der Transaktionen der Warteschlange
+extern I2cStatistics i2cStatisticsA;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -94,8 +179,18 @@ extern bool I2cReadA(uint16_t slaveAddress,
 extern bool I2cWriteReadA(uint16_t slaveAddress,
 													uint16_t numberOfBytesWrite,
 													uint16_t numberOfBytesRead);
+// Funktion reiht eine Transaktion in die Warteschlange ein und startet sie sofort,
+// falls der Bus frei ist
+extern bool I2cSubmitA(I2cTransaction *transaction);
+// Funktion gibt die Anzahl der Transaktionen in der Warteschlange zurck (inkl. der aktiven)
+extern uint16_t I2cGetQueueCountA(void);
+// Funktion berwacht die Zeitgrenze der aktiven Transaktion und fhrt die
+// Wiederherstellung des Busses aus (regelmig aufrufen, wartet nicht)
+extern bool I2cTickA(void);
 // Interrupt-Service-Routine fr die I2C-Kommunikation
 __interrupt void I2cISRA(void);
+// Interrupt-Service-Routine fr die I2C-FIFOs (Nachfllen und Leeren whrend der bertragung)
+__interrupt void I2cFifoISRA(void);
 
 
 #endif
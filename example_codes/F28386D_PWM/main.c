@@ -7,9 +7,16 @@
 ///						Mikrocontroller TMS320F2838x. Erklrungen zur genauen Funktion sind im Modul
 ///						zu finden.
 ///
-/// @version	V1.1
+///						nderung in Version 1.2: Das Hauptprogramm bearbeitet die langsame Aufgabe, die
+///						Pwm1ISR() mit "pwmFlagSlowTask" anfordert
 ///
-/// @date			05.09.2022
+///						nderung in Version 1.3: Synchronisation mehrerer Platinen ber EXTSYNCOUT und
+///						EXTSYNCIN (myBoardSync.h). Rolle und Position der Platine stehen in den Defines,
+///						der Phasenfehler eines Followers in "boardSyncStats"
+///
+/// @version	V1.3
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -17,11 +24,17 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myPWM.h"
+#include "myBoardSync.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Rolle dieser Platine (BOARDSYNC_ROLE_MASTER oder BOARDSYNC_ROLE_FOLLOWER)
+#define MAIN_BOARD_ROLE										BOARDSYNC_ROLE_MASTER
+// Position dieser Platine (0: Master) und Anzahl der Platinen fr das Interleaving
+#define MAIN_BOARD_INDEX									0
+#define MAIN_NUMBER_OF_BOARDS								1
 
 
 //-------------------------------------------------------------------------------------------------
@@ -47,9 +60,14 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
 	  // ePWM1, ePWM2 und ePWM3-Modul zur Ansteuerung eines
 	  // 3-phasigen Wechselrichters initialisieren
 	  PwmInitPwm123();
+	  // Zeitbasis mit den anderen Platinen synchronisieren und um die Position versetzen
+	  BoardSyncInit(MAIN_BOARD_ROLE);
+	  BoardSyncSetPhase(MAIN_BOARD_INDEX, MAIN_NUMBER_OF_BOARDS);
 	  // ePWM8-Modul als 100 ms-Zeitgeber initialisieren
 	  PwmInitPwm8();
 
@@ -59,7 +77,12 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-
+				// Langsame Aufgabe (alle PWM_SLOW_TASK_DECIMATION Aufrufe von Pwm1ISR(), 100 Hz)
+				if (pwmFlagSlowTask)
+				{
+						pwmFlagSlowTask = false;
+						// Hier knnen z.B. Sollwerte oder Grenzwerte der Regelung aktualisiert werden
+				}
     }
 }
 
@@ -0,0 +1,227 @@
+//=================================================================================================
+/// @file       myBoardSync.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen zur Synchronisation der PWM-Zeitbasis mehrerer
+///							Steuerplatinen ber EXTSYNCOUT und EXTSYNCIN. Eine Beschreibung ist in der
+///							Header-Datei myBoardSync.h zu finden.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myBoardSync.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile BoardSyncStats boardSyncStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: BoardSyncInit =====================================================================
+///
+/// @brief  Funktion stellt die Rolle der Platine ein. Master: SYNCOUT von ePWM1 wird als
+///					EXTSYNCOUT an BOARDSYNC_GPIO_SYNCOUT ausgegeben. Follower: ePWM1 ldt seine Phase beim
+///					Impuls an BOARDSYNC_GPIO_SYNCIN (Input X-Bar INPUT5), eCAP1 misst den Phasenfehler.
+///					Muss nach PwmInitPwm123() aufgerufen werden. Die Phase ist 0 bis zum Aufruf von
+///					BoardSyncSetPhase()
+///
+/// @param  uint16_t role (BOARDSYNC_ROLE_MASTER oder BOARDSYNC_ROLE_FOLLOWER)
+///
+/// @return void
+///
+//=================================================================================================
+void BoardSyncInit(uint16_t role)
+{
+		BoardSyncResetStats();
+		boardSyncStats.expectedCycles = 0;
+		// Der Master misst keinen Phasenfehler und gilt immer als eingerastet
+		boardSyncStats.locked = (role == BOARDSYNC_ROLE_MASTER);
+
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+		if (role == BOARDSYNC_ROLE_MASTER)
+		{
+				// SYNCOUT von ePWM1 (Nulldurchgang, siehe PwmInitPwm123()) auf EXTSYNCOUT legen
+				// 0: EPWM1SYNCOUT
+				SyncSocRegs.SYNCSELECT.bit.SYNCOUT = 0;
+		    // EXTSYNCOUT auf GPIO6 legen (Mux 3)
+				GpioCtrlRegs.GPALOCK.bit.GPIO6 = 0;
+				GpioCtrlRegs.GPAGMUX1.bit.GPIO6 = (3 >> 2);
+				GpioCtrlRegs.GPAMUX1.bit.GPIO6  = (3 & 0x03);
+				GpioCtrlRegs.GPAPUD.bit.GPIO6 = 1;
+				EDIS;
+				return;
+		}
+
+		// EXTSYNCIN: GPIO7 als asynchronen Eingang (keine Eingangsqualifizierung, damit der
+		// Impuls nicht verzgert wird) auf INPUT5 der Input X-Bar legen
+		GpioCtrlRegs.GPALOCK.bit.GPIO7 = 0;
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO7 = 0;
+		GpioCtrlRegs.GPAMUX1.bit.GPIO7  = 0;
+		GpioCtrlRegs.GPADIR.bit.GPIO7 = 0;
+		GpioCtrlRegs.GPAQSEL1.bit.GPIO7 = 3;
+		GpioCtrlRegs.GPAPUD.bit.GPIO7 = 1;
+		InputXbarRegs.INPUT5SELECT = BOARDSYNC_GPIO_SYNCIN;
+
+		// ePWM1 mit dem externen Impuls synchronisieren. SYNCOUT beim eigenen Nulldurchgang
+		// bleibt fr ePWM2, ePWM3 und eCAP1 eingeschaltet
+		EPwm1Regs.EPWMSYNCINSEL.bit.SEL = PWM_TB_SYNCIN_XBAR_INPUT5;
+		EPwm1Regs.TBPHS.bit.TBPHS = 0;
+		EPwm1Regs.TBCTL.bit.PHSDIR = 1;
+		EPwm1Regs.TBCTL.bit.PHSEN = PWM_TB_PHSEN_ENABLE;
+
+		// eCAP1: Takt einschalten und 5 Takte warten, bis der Takt zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR3.bit.ECAP1 = 1;
+		__asm(" RPT #4 || NOP");
+		ECap1Regs.ECEINT.all = 0;
+		ECap1Regs.ECCLR.all = 0xFFFF;
+		ECap1Regs.ECCTL2.bit.TSCTRSTOP = 0;
+		// Eingang: INPUT5 der Input X-Bar (INPUTSEL = Nummer - 1)
+		ECap1Regs.ECCTL0.bit.INPUTSEL = 4;
+		// Capture-Betrieb, steigende Flanke in CAP1, Zhler nicht durch das Ereignis zurcksetzen
+		ECap1Regs.ECCTL2.bit.CAP_APWM = 0;
+		ECap1Regs.ECCTL1.bit.CAP1POL = 0;
+		ECap1Regs.ECCTL1.bit.CTRRST1 = 0;
+		ECap1Regs.ECCTL1.bit.PRESCALE = 0;
+		ECap1Regs.ECCTL1.bit.CAPLDEN = 1;
+		ECap1Regs.ECCTL1.bit.FREE_SOFT = 3;
+		// Kontinuierlich, nach CAP1 wieder bei CAP1 beginnen
+		ECap1Regs.ECCTL2.bit.CONT_ONESHT = 0;
+		ECap1Regs.ECCTL2.bit.STOP_WRAP = 0;
+		// Zhler beim SYNCOUT von ePWM1 (eigener Nulldurchgang) auf 0 setzen, kein SYNCOUT
+		ECap1Regs.ECAPSYNCINSEL.bit.SEL = PWM_TB_SYNCIN_EPWM1_SYNCOUT;
+		ECap1Regs.CTRPHS = 0;
+		ECap1Regs.ECCTL2.bit.SYNCI_EN = 1;
+		ECap1Regs.ECCTL2.bit.SYNCO_SEL = 2;
+		ECap1Regs.TSCTR = 0;
+		ECap1Regs.ECCTL2.bit.TSCTRSTOP = 1;
+		// Interrupt bei jedem erfassten Impuls
+		ECap1Regs.ECEINT.bit.CEVT1 = 1;
+
+    // Interrupt-Service-Routine fr den eCAP1-Interrupt an die
+    // entsprechende Stelle (ECAP1_INT) der PIE-Vector Table speichern
+    PieVectTable.ECAP1_INT = &BoardSyncCaptureISR;
+    // INT4.1-Interrupt freischalten (Zeile 4, Spalte 1 der Tabelle 3-2)
+    PieCtrlRegs.PIEIER4.bit.INTx1 = 1;
+    // CPU-Interrupt 4 einschalten (Zeile 4 der Tabelle)
+    IER |= M_INT4;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: BoardSyncSetPhase =================================================================
+///
+/// @brief  Funktion versetzt die Platine "board" (0 ... numberOfBoards - 1, 0 ist der Master) um
+///					board / numberOfBoards einer PWM-Periode gegenber dem Master. Im Auf-/Abzhlmodus
+///					wird eine Position in der ersten Hlfte der Periode beim Hochzhlen geladen, in der
+///					zweiten Hlfte beim Runterzhlen (TBCTL.PHSDIR). In beiden Fllen folgt der externe
+///					Impuls dem eigenen Nulldurchgang nach der eingestellten Position
+///
+/// @param  uint16_t board, uint16_t numberOfBoards
+///
+/// @return void
+///
+//=================================================================================================
+void BoardSyncSetPhase(uint16_t board, uint16_t numberOfBoards)
+{
+		uint32_t position;
+
+		if ((numberOfBoards == 0) || (board >= numberOfBoards))
+		{
+				return;
+		}
+
+		// Position in Takten von TBCLK innerhalb einer Periode (0 ... 2 * PWM_PERIOD - 1)
+		position = (uint32_t)board * BOARDSYNC_PERIOD_TBCLK / numberOfBoards;
+		if (position <= PWM_PERIOD)
+		{
+				EPwm1Regs.TBPHS.bit.TBPHS = (uint16_t)position;
+				EPwm1Regs.TBCTL.bit.PHSDIR = 1;
+		}
+		else
+		{
+				EPwm1Regs.TBPHS.bit.TBPHS = (uint16_t)(BOARDSYNC_PERIOD_TBCLK - position);
+				EPwm1Regs.TBCTL.bit.PHSDIR = 0;
+		}
+		boardSyncStats.expectedCycles = position * BOARDSYNC_SYSCLK_PER_TBCLK;
+		BoardSyncResetStats();
+}
+
+
+//=== Function: BoardSyncResetStats ===============================================================
+///
+/// @brief  Funktion setzt Minimum, Maximum und Anzahl der Messungen des Phasenfehlers zurck.
+///					"locked" bleibt bis zur nchsten Messung unverndert
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void BoardSyncResetStats(void)
+{
+		DINT;
+		boardSyncStats.phaseErrorMin = INT32_MAX;
+		boardSyncStats.phaseErrorMax = INT32_MIN;
+		boardSyncStats.captures = 0;
+		EINT;
+}
+
+
+//=== Function: BoardSyncCaptureISR ===============================================================
+///
+/// @brief  ISR wird bei jedem erfassten externen Impuls aufgerufen. Berechnet den Phasenfehler
+///					aus dem Abstand zum eigenen Nulldurchgang (CAP1), begrenzt auf eine halbe Periode
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void BoardSyncCaptureISR(void)
+{
+		const int32_t period = (int32_t)(BOARDSYNC_PERIOD_TBCLK * BOARDSYNC_SYSCLK_PER_TBCLK);
+		int32_t error;
+
+		error = (int32_t)ECap1Regs.CAP1 - (int32_t)boardSyncStats.expectedCycles
+					- BOARDSYNC_OFFSET_CYCLES;
+		// Fehler auf -Periode/2 ... +Periode/2 abbilden
+		if (error > period / 2)
+		{
+				error -= period;
+		}
+		else if (error < -period / 2)
+		{
+				error += period;
+		}
+
+		boardSyncStats.phaseErrorLast = error;
+		if (error < boardSyncStats.phaseErrorMin)
+		{
+				boardSyncStats.phaseErrorMin = error;
+		}
+		if (error > boardSyncStats.phaseErrorMax)
+		{
+				boardSyncStats.phaseErrorMax = error;
+		}
+		boardSyncStats.captures++;
+		boardSyncStats.locked = (error <= BOARDSYNC_LOCK_CYCLES) && (error >= -BOARDSYNC_LOCK_CYCLES);
+
+		// Interrupt-Flags im eCAP1-Modul lschen
+		ECap1Regs.ECCLR.bit.CEVT1 = 1;
+		ECap1Regs.ECCLR.bit.INT = 1;
+    // Interrupt der Gruppe 4 besttigen (da gehrt der eCAP1-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK4 = 1;
+}
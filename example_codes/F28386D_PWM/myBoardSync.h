@@ -0,0 +1,89 @@
+//=================================================================================================
+/// @file       myBoardSync.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen zur Synchronisation der PWM-Zeitbasis mehrerer
+///							Steuerplatinen (parallele Leistungsteile). Eine Platine ist Master und gibt den
+///							Synchronisationsimpuls von ePWM1 (Nulldurchgang) als EXTSYNCOUT an
+///							BOARDSYNC_GPIO_SYNCOUT aus. Alle anderen Platinen (Follower) empfangen ihn an
+///							BOARDSYNC_GPIO_SYNCIN ber die Input X-Bar (INPUT5 = EXTSYNCIN1) und laden damit
+///							den Zhler von ePWM1 mit ihrer Phase. ePWM2 und ePWM3 folgen weiterhin ePWM1
+///							(PwmInitPwm123()). Mit BoardSyncSetPhase() werden die Platinen gleichmig ber
+///							eine PWM-Periode versetzt (Interleaving, z.B. 4 Platinen um je 90).
+///							Auf den Followern misst eCAP1 den Phasenfehler: Der Zhler von eCAP1 wird vom
+///							SYNCOUT von ePWM1 (eigener Nulldurchgang) zurckgesetzt und erfasst die steigende
+///							Flanke des externen Impulses. Bei richtiger Phase folgt der Impuls dem eigenen
+///							Nulldurchgang genau um die eingestellte Phase. Die Abweichung steht in
+///							"boardSyncStats" in Takten von SYSCLK (5 ns). Sie enthlt einen konstanten Anteil
+///							aus Eingangssynchronisation und Ladeverzgerung (wenige Takte), der mit
+///							BOARDSYNC_OFFSET_CYCLES abgeglichen werden kann. Die Laufzeit der Leitung zwischen
+///							den Platinen geht ebenfalls ein.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYBOARDSYNC_H_
+#define MYBOARDSYNC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myPWM.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Rolle der Platine
+#define BOARDSYNC_ROLE_MASTER								0
+#define BOARDSYNC_ROLE_FOLLOWER							1
+// GPIO des Ausgangs EXTSYNCOUT (Master, GPIO6 Mux 3) und des Eingangs EXTSYNCIN (Follower)
+#define BOARDSYNC_GPIO_SYNCOUT							6
+#define BOARDSYNC_GPIO_SYNCIN								7
+// Takte von SYSCLK pro Takt von TBCLK (SYSCLK = 200 MHz, TBCLK = EPWMCLK = 100 MHz)
+#define BOARDSYNC_SYSCLK_PER_TBCLK					2
+// Lnge einer PWM-Periode im Auf-/Abzhlmodus in Takten von TBCLK
+#define BOARDSYNC_PERIOD_TBCLK							(2UL * PWM_PERIOD)
+// Konstanter Anteil des gemessenen Phasenfehlers in Takten von SYSCLK (nach Messung abgleichen)
+#define BOARDSYNC_OFFSET_CYCLES							0
+// Max. Betrag des Phasenfehlers in Takten von SYSCLK, bis zu dem die Platine als eingerastet gilt
+#define BOARDSYNC_LOCK_CYCLES								20
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Phasenfehler des Followers in Takten von SYSCLK (positiv: externer Impuls kommt zu spt)
+typedef struct
+{
+		int32_t phaseErrorLast;
+		int32_t phaseErrorMin;
+		int32_t phaseErrorMax;
+		uint32_t captures;											// Anzahl der erfassten Impulse
+		uint32_t expectedCycles;								// erwarteter Abstand zum eigenen Nulldurchgang
+		bool locked;														// letzter Fehler innerhalb BOARDSYNC_LOCK_CYCLES
+} BoardSyncStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Phasenfehler (im Debugger anzeigen, BoardSyncResetStats() setzt Min./Max. zurck)
+extern volatile BoardSyncStats boardSyncStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion stellt die Rolle der Platine ein (nach PwmInitPwm123() aufrufen)
+extern void BoardSyncInit(uint16_t role);
+// Funktion versetzt die Platine "board" von "numberOfBoards" gleichmig ber eine Periode
+extern void BoardSyncSetPhase(uint16_t board, uint16_t numberOfBoards);
+// Funktion setzt die Statistik des Phasenfehlers zurck
+extern void BoardSyncResetStats(void);
+// Interrupt-Service-Routine von eCAP1 (externer Impuls erfasst)
+__interrupt void BoardSyncCaptureISR(void);
+
+
+#endif
@@ -7,9 +7,15 @@
 ///							so initialisiert, dass alle 100 ms ein Interrupt ausgelst wird und so als
 ///							Zeitgeber fr periodisch zu erledigende Aufgaben genutzt werden kann.
 ///
-/// @version    V1.2
+///							nderung in Version 1.3: Mehrratige Ereignis-Vorteiler ("PwmSetEventPrescale()").
+///							ePWM1 lst den ADC-Trigger SOCA in jeder Periode aus, die ISR aber nur bei jeder
+///							PWM_CONTROL_ISR_PRESCALE-ten Periode (Regeltakt). Jeder PWM_SLOW_TASK_DECIMATION-te
+///							ISR-Aufruf setzt "pwmFlagSlowTask" fr langsame Aufgaben im Hauptprogramm.
+///							Damit entspricht die Interruptrate dem, was die jeweilige Aufgabe bentigt
 ///
-/// @date       13.02.2023
+/// @version    V1.3
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -22,6 +28,8 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Wird von Pwm1ISR() alle PWM_SLOW_TASK_DECIMATION Aufrufe gesetzt und vom Hauptprogramm gelscht
+volatile bool pwmFlagSlowTask = false;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -113,8 +121,11 @@ void PwmInitPwm123(void)
     EPwm1Regs.ETSEL.bit.INTEN = PWM_ET_INT_ENABLE;
     // PWM1-Interrupt auslsen, wenn der Zhler den Wert 0 erreicht
     EPwm1Regs.ETSEL.bit.INTSEL = PWM_ET_CTR_ZERO;
-    // PWM1-Interrupt beim ersten Auftreten des Events auslsen
-    EPwm1Regs.ETPS.bit.INTPRD = PWM_ET_1ST;
+    // ADC-Trigger SOCA ebenfalls beim Zhlerwert 0 auslsen
+    EPwm1Regs.ETSEL.bit.SOCASEL = PWM_ET_CTR_ZERO;
+    EPwm1Regs.ETSEL.bit.SOCAEN = PWM_ET_SOC_ENABLE;
+    // SOCA bei jedem Event, PWM1-Interrupt nur bei jedem PWM_CONTROL_ISR_PRESCALE-ten Event
+    PwmSetEventPrescale(&EPwm1Regs, PWM_SOC_PRESCALE, PWM_CONTROL_ISR_PRESCALE);
 		// CPU2 steuert das ePWM1-Modul
 		// 0: CPU1 steuert das Modul
 		// 1: CPU2 steuert das Modul
@@ -377,7 +388,9 @@ void PwmInitPwm123(void)
 
 //=== Function: Pwm1ISR ===========================================================================
 ///
-/// @brief  ISR wird aufgerufen wenn der Zhler des ePMW1-Moduls den Wert 0 erreicht
+/// @brief  ISR wird bei jedem PWM_CONTROL_ISR_PRESCALE-ten Mal aufgerufen, wenn der Zhler des
+///					ePMW1-Moduls den Wert 0 erreicht. Jeder PWM_SLOW_TASK_DECIMATION-te Aufruf setzt
+///					"pwmFlagSlowTask"
 ///
 /// @param  void
 ///
@@ -386,6 +399,11 @@ void PwmInitPwm123(void)
 //=================================================================================================
 __interrupt void Pwm1ISR(void)
 {
+		// Zhler fr die langsame Aufgabe
+		static uint16_t counterSlowTask = 0;
+
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_PWM1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -405,10 +423,62 @@ __interrupt void Pwm1ISR(void)
 		EPwm3Regs.CMPA.bit.CMPA = 800 - PWM_SYNCHRONIZAION_DELAY;
 		EPwm3Regs.CMPB.bit.CMPB = 800 - PWM_SYNCHRONIZAION_DELAY;
 
+		// Langsame Aufgabe an das Hauptprogramm weitergeben
+		if (++counterSlowTask >= PWM_SLOW_TASK_DECIMATION)
+		{
+				counterSlowTask = 0;
+				pwmFlagSlowTask = true;
+		}
+
     // Interrupt-Flag im ePWM1-Modul lschen
 		EPwm1Regs.ETCLR.bit.INT = 1;
     // Interrupt der Gruppe 3 besttigen (da gehrt der ePWM1-Interrupt zu)
     PieCtrlRegs.PIEACK.bit.ACK3 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_PWM1);
+}
+
+
+//=== Function: PwmSetEventPrescale ===============================================================
+///
+/// @brief  Funktion setzt die Vorteiler fr die SOC-Trigger (SOCA und SOCB) und den Interrupt eines
+///					ePWM-Moduls. Die Quellen der Events (ETSEL) und das Einschalten bleiben unverndert. Es
+///					werden die 4 Bit-Vorteiler in ETSOCPS und ETINTPS verwendet, damit sind Teiler bis 15
+///					mglich (siehe "Event-Trigger (ET) Submodule", Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+///					Die Ereigniszhler werden auf 0 gesetzt, der erste Trigger folgt also nach genau
+///					"socPrescale" bzw. "intPrescale" Events
+///
+/// @param  *epwm					Register des ePWM-Moduls (z.B. &EPwm1Regs)
+/// @param  socPrescale		Anzahl an Events pro SOC-Trigger (PWM_ET_DISABLE, PWM_ET_1ST ... PWM_ET_15TH)
+/// @param  intPrescale		Anzahl an Events pro Interrupt (PWM_ET_DISABLE, PWM_ET_1ST ... PWM_ET_15TH)
+///
+/// @return void
+///
+//=================================================================================================
+void PwmSetEventPrescale(volatile struct EPWM_REGS *epwm, uint16_t socPrescale,
+																uint16_t intPrescale)
+{
+		// Werte auf den Bereich der 4 Bit-Vorteiler begrenzen
+		if (socPrescale > PWM_ET_PRESCALE_MAX)
+		{
+				socPrescale = PWM_ET_PRESCALE_MAX;
+		}
+		if (intPrescale > PWM_ET_PRESCALE_MAX)
+		{
+				intPrescale = PWM_ET_PRESCALE_MAX;
+		}
+		// 4 Bit-Vorteiler in ETSOCPS und ETINTPS anstelle der 2 Bit-Felder in ETPS verwenden
+		epwm->ETPS.bit.SOCPSSEL = 1;
+		epwm->ETPS.bit.INTPSSEL = 1;
+		epwm->ETSOCPS.bit.SOCAPRD2 = socPrescale;
+		epwm->ETSOCPS.bit.SOCBPRD2 = socPrescale;
+		epwm->ETINTPS.bit.INTPRD2 = intPrescale;
+		// Ereigniszhler mit 0 laden
+		epwm->ETCNTINIT.bit.SOCAINIT = 0;
+		epwm->ETCNTINIT.bit.SOCBINIT = 0;
+		epwm->ETCNTINIT.bit.INTINIT = 0;
+		epwm->ETCNTINITCTL.bit.SOCAINITFRC = 1;
+		epwm->ETCNTINITCTL.bit.SOCBINITFRC = 1;
+		epwm->ETCNTINITCTL.bit.INTINITFRC = 1;
 }
 
 
@@ -457,8 +527,8 @@ void PwmInitPwm8(void)
 		EPwm8Regs.ETSEL.bit.INTEN = PWM_ET_INT_ENABLE;
     // Interrupt auslsen, wenn der Timer den Endwert (TBPRD) erreicht hat
 		EPwm8Regs.ETSEL.bit.INTSEL = PWM_ET_CTR_PRD;
-    // ISR aufrufen, sobald 1 Interrupt ausgelst wurde
-		EPwm8Regs.ETPS.bit.INTPRD = PWM_ET_1ST;
+    // ISR bei jedem Event aufrufen, keine SOC-Trigger
+		PwmSetEventPrescale(&EPwm8Regs, PWM_ET_DISABLE, PWM_ET_1ST);
 
     // Interrupt-Service-Routinen fr den ePWM8-Interrupt an die
     // entsprechende Stelle (ePWM8_INT) der PIE-Vector Table speichern
@@ -488,6 +558,8 @@ void PwmInitPwm8(void)
 //=================================================================================================
 __interrupt void Pwm8ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_PWM8);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -501,6 +573,7 @@ __interrupt void Pwm8ISR(void)
 		EPwm8Regs.ETCLR.bit.INT = 1;
     // Interrupt-Flag der Gruppe 3 lschen (da gehrt der ePMW8-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK3 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_PWM8);
 }
 
 
@@ -7,9 +7,15 @@
 ///							so initialisiert, dass alle 100 ms ein Interrupt ausgelst wird und so als
 ///							Zeitgeber fr periodisch zu erledigende Aufgaben genutzt werden kann.
 ///
-/// @version		V1.2
+///							nderung in Version 1.3: Mehrratige Ereignis-Vorteiler ("PwmSetEventPrescale()").
+///							ePWM1 lst den ADC-Trigger SOCA in jeder Periode aus, die ISR aber nur bei jeder
+///							PWM_CONTROL_ISR_PRESCALE-ten Periode (Regeltakt). Jeder PWM_SLOW_TASK_DECIMATION-te
+///							ISR-Aufruf setzt "pwmFlagSlowTask" fr langsame Aufgaben im Hauptprogramm.
+///							Damit entspricht die Interruptrate dem, was die jeweilige Aufgabe bentigt
 ///
-/// @date				13.02.2023
+/// @version		V1.3
+///
+/// @date				14.10.2026
 ///
 /// @author			Daniel Urbaneck
 //=================================================================================================
@@ -19,6 +25,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -193,6 +200,15 @@
 #define PWM_ET_8TH      										8
 #define PWM_ET_9TH      										9
 #define PWM_ET_10TH      									  10
+#define PWM_ET_11TH      									  11
+#define PWM_ET_12TH      									  12
+#define PWM_ET_13TH      									  13
+#define PWM_ET_14TH      									  14
+#define PWM_ET_15TH      									  15
+// Die 2 Bit-Felder in ETPS (INTPRD, SOCAPRD, SOCBPRD) reichen nur bis PWM_ET_3RD, die 4 Bit-
+// Felder in ETINTPS und ETSOCPS (nach Umschaltung mit INTPSSEL bzw. SOCPSSEL) bis PWM_ET_15TH
+// (siehe "Event-Trigger (ET) Submodule", Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define PWM_ET_PRESCALE_MAX									15
 // SOC-Eventtrigger ein-/ausschalten
 #define PWM_ET_SOC_DISABLE									0
 #define PWM_ET_SOC_ENABLE										1
@@ -224,6 +240,13 @@
 // 1: CLKDIV > 1 oder HSPCLKDIV > 1
 // 2: CLKDIV = 1 und  HSPCLKDIV = 1
 #define PWM_SYNCHRONIZAION_DELAY						2
+// Mehrratige Ereignisse des ePWM1-Moduls (Ereignis: TBCTR = 0, 16 kHz):
+// ADC-Trigger SOCA bei jeder Periode (16 kHz Abtastung)
+#define PWM_SOC_PRESCALE										PWM_ET_1ST
+// Pwm1ISR() bei jeder 2. Periode (8 kHz Regeltakt)
+#define PWM_CONTROL_ISR_PRESCALE						PWM_ET_2ND
+// Langsame Aufgabe bei jedem 80. Aufruf von Pwm1ISR() (100 Hz)
+#define PWM_SLOW_TASK_DECIMATION						80
 
 
 //-------------------------------------------------------------------------------------------------
@@ -234,6 +257,8 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Wird von Pwm1ISR() alle PWM_SLOW_TASK_DECIMATION Aufrufe gesetzt und vom Hauptprogramm gelscht
+extern volatile bool pwmFlagSlowTask;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -245,6 +270,9 @@
 extern void PwmInitPwm123(void);
 // Interrupt-Service-Routine des ePWM1-Moduls
 __interrupt void Pwm1ISR(void);
+// Funktion setzt die Vorteiler fr die SOC-Trigger und den Interrupt eines ePWM-Moduls
+extern void PwmSetEventPrescale(volatile struct EPWM_REGS *epwm, uint16_t socPrescale,
+																uint16_t intPrescale);
 // Funktion initialisiert das ePWM8-Modul um alle 100 ms einen Interrupt auszulsen
 extern void PwmInitPwm8(void);
 // Interrupt-Service-Routine des ePWM8-Moduls
@@ -46,6 +46,13 @@ void main(void)
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
 
+#ifdef _FLASH
+		// Ausfhrungsgeschwindigkeit aus dem Flash fr das gewhlte Flash-Profil sowie ohne
+		// ECC, ohne Cache/Prefetch und mit einem zustzlichen Wartezustand messen
+		// (Ergebnisse in "deviceFlashBenchmark", z.B. im Debugger ansehen)
+		DeviceBenchmarkFlash();
+#endif
+
     // Register-Schreibschutz ausschalten
     EALLOW;
 
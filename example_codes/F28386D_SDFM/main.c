@@ -0,0 +1,76 @@
+//=================================================================================================
+/// @file			main.c
+///
+/// @brief		Enthlt das Hauptprogramm zur Demonstration des Moduls "mySDFM.c". Vier isolierte
+///						Sigma-Delta-Modulatoren werden mit dem SDFM1-Modul ausgewertet. Die Strme stehen
+///						nach jeder PWM-Periode von ePWM1 in "sdfmMeasurement" (vom DMA bertragen),
+///						ein berstrom schaltet ePWM1 ohne CPU ab. Erklrungen zur genauen Funktion sind im
+///						Modul zu finden.
+///
+/// @version	V1.0
+///
+/// @date			14.10.2026
+///
+/// @author		Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "mySDFM.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// berstromabschaltung aufheben (z.B. im Debugger auf 1 setzen)
+volatile uint16_t sdfmResetRequest = 0;
+
+
+//=== Function: main ==============================================================================
+///
+/// @brief  Hauptprogramm
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
+		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+
+#ifdef _FLASH
+		// Ausfhrungsgeschwindigkeit aus dem Flash fr das gewhlte Flash-Profil sowie ohne
+		// ECC, ohne Cache/Prefetch und mit einem zustzlichen Wartezustand messen
+		// (Ergebnisse in "deviceFlashBenchmark", z.B. im Debugger ansehen)
+		DeviceBenchmarkFlash();
+#endif
+
+		// SDFM1, ePWM1 und DMA initialisieren, die Strommessung luft danach ohne CPU
+		SdfmInit();
+
+    // Register-Schreibschutz ausschalten
+    EALLOW;
+
+		// Dauerschleife Hauptprogramm
+    while(1)
+    {
+    		if (sdfmResetRequest)
+    		{
+    				sdfmResetRequest = 0;
+    				SdfmResetTrip();
+    		}
+    }
+}
+
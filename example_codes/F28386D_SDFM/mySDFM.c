@@ -0,0 +1,419 @@
+//=================================================================================================
+/// @file       mySDFM.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um Strme mit isolierten Sigma-Delta-
+///							Modulatoren und dem SDFM1-Modul des TMS320F2838x zu messen und bei berstrom
+///							das ePWM1-Modul ohne CPU abzuschalten (siehe mySDFM.h)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "mySDFM.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Umrechnung Rohwert (+/- 2^15) in Ampere
+#define SDFM_AMPERE_PER_LSB									(SDFM_CURRENT_FULL_SCALE_A / 32768.0f)
+// Abstand der Ergebnisregister SDDATAx zweier Kanle (16 Register pro Filterkanal)
+#define SDFM_DATA_REGISTER_STEP							16
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Rohwerte der Datenfilter (muss im GS-RAM liegen, da der DMA nur darauf zugreifen kann)
+#pragma DATA_SECTION(sdfmDmaBuffer, "ramgs0");
+volatile int16_t sdfmDmaBuffer[SDFM_NUMBER_OF_CHANNELS];
+volatile SdfmMeasurement sdfmMeasurement;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SdfmInitPwm1 ======================================================================
+///
+/// @brief  Funktion initialisiert das ePWM1-Modul (GPIO 0 und 1) als Brckenzweig mit
+///					SDFM_PWM_FREQUENCY_HZ (Up-Down-Zhler, 50 % Tastverhltnis). Das SOCA-Event in der
+///					Periodenmitte (CTR = PRD, Mitte des Low-Side-Pulses) synchronisiert die Datenfilter.
+///					TRIP4 (Komparatorereignisse der SDFM-Kanle) lst ber DCAEVT1 einen One-Shot-Trip
+///					aus, beide Pins werden Low. Der Register-Schreibschutz muss aufgehoben sein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SdfmInitPwm1(void)
+{
+		// GPIO 0 und 1 auf EPWM1A und EPWM1B setzen
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO0 = 0;
+		GpioCtrlRegs.GPAMUX1.bit.GPIO0 = 1;
+		GpioCtrlRegs.GPAGMUX1.bit.GPIO1 = 0;
+		GpioCtrlRegs.GPAMUX1.bit.GPIO1 = 1;
+
+		// Takt fr das ePWM1-Modul einschalten und Zeitbasen anhalten
+		CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+		__asm(" RPT #4 || NOP");
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+
+		// Zeitbasis: Up-Down-Zhler, TBCLK = EPWMCLK
+		EPwm1Regs.TBCTL.bit.CTRMODE = 2;
+		EPwm1Regs.TBCTL.bit.CLKDIV = 0;
+		EPwm1Regs.TBCTL.bit.HSPCLKDIV = 0;
+		EPwm1Regs.TBCTL.bit.PHSEN = 0;
+		EPwm1Regs.TBPRD = SDFM_PWM_PERIOD;
+		EPwm1Regs.TBCTR = 0;
+		EPwm1Regs.CMPA.bit.CMPA = SDFM_PWM_PERIOD / 2;
+		// EPWM1A: Set bei CMPA aufwrts, Clear bei CMPA abwrts, EPWM1B invertiert
+		EPwm1Regs.AQCTLA.bit.CAU = 2;
+		EPwm1Regs.AQCTLA.bit.CAD = 1;
+		EPwm1Regs.AQCTLB.bit.CAU = 1;
+		EPwm1Regs.AQCTLB.bit.CAD = 2;
+
+		// SOCA bei CTR = PRD in jeder Periode (Synchronisation der Datenfilter)
+		EPwm1Regs.ETSEL.bit.SOCASEL = 2;
+		EPwm1Regs.ETPS.bit.SOCPSSEL = 1;
+		EPwm1Regs.ETSOCPS.bit.SOCAPRD2 = 1;
+		EPwm1Regs.ETSEL.bit.SOCAEN = 1;
+
+		// Digital Compare: DCAH = TRIPIN4, DCAEVT1 bei DCAH = High, ungefiltert und asynchron
+		EPwm1Regs.DCTRIPSEL.bit.DCAHCOMPSEL = 3;
+		EPwm1Regs.TZDCSEL.bit.DCAEVT1 = 2;
+		EPwm1Regs.DCACTL.bit.EVT1SRCSEL = 0;
+		EPwm1Regs.DCACTL.bit.EVT1FRCSYNCSEL = 1;
+		// Tripzone: DCAEVT1 als One-Shot-Quelle, beide Pins Low
+		EPwm1Regs.TZSEL.bit.DCAEVT1 = 1;
+		EPwm1Regs.TZCTL.bit.TZA = 2;
+		EPwm1Regs.TZCTL.bit.TZB = 2;
+		EPwm1Regs.TZCLR.bit.OST = 1;
+		EPwm1Regs.TZCLR.bit.INT = 1;
+
+		// Zeitbasen starten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+}
+
+
+//=== Function: SdfmInitXbar ======================================================================
+///
+/// @brief  Funktion legt die Komparatorereignisse (COMPH_OR_COMPL) aller vier Kanle von SDFM1
+///					auf den Ausgang TRIP4 der ePWM X-Bar (veroderte Eingnge MUX16, 18, 20 und 22, siehe
+///					S. 2142 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Der Register-
+///					Schreibschutz muss aufgehoben sein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SdfmInitXbar(void)
+{
+		uint16_t channel;
+		uint16_t mux;
+
+		for (channel = 0; channel < SDFM_NUMBER_OF_CHANNELS; channel++)
+		{
+				mux = SDFM_XBAR_FIRST_MUX + 2 * channel;
+				EPwmXbarRegs.TRIP4MUX16TO31CFG.all =
+						(EPwmXbarRegs.TRIP4MUX16TO31CFG.all & ~(3UL << (2 * (mux - 16))))
+						| ((uint32_t)SDFM_XBAR_COMPH_OR_COMPL << (2 * (mux - 16)));
+				EPwmXbarRegs.TRIP4MUXENABLE.all |= 1UL << mux;
+		}
+		EPwmXbarRegs.TRIPOUTINV.bit.TRIP4 = 0;
+}
+
+
+//=== Function: SdfmEnableTripInterrupts ==========================================================
+///
+/// @brief  Funktion schaltet die Komparatorinterrupts (obere und untere Schwelle) aller Kanle
+///					ein oder aus. Die Komparatorflags bleiben gesetzt, solange der Strom auerhalb der
+///					Schwellen liegt, daher werden die Interrupts nach einer Abschaltung bis zum Aufruf
+///					von "SdfmResetTrip()" gesperrt. Die Ereignisse zur ePWM X-Bar sind davon unabhngig
+///
+/// @param  uint16_t enable
+///
+/// @return void
+///
+//=================================================================================================
+static void SdfmEnableTripInterrupts(uint16_t enable)
+{
+		Sdfm1Regs.SDCPARM1.bit.IEH = enable;
+		Sdfm1Regs.SDCPARM1.bit.IEL = enable;
+		Sdfm1Regs.SDCPARM2.bit.IEH = enable;
+		Sdfm1Regs.SDCPARM2.bit.IEL = enable;
+		Sdfm1Regs.SDCPARM3.bit.IEH = enable;
+		Sdfm1Regs.SDCPARM3.bit.IEL = enable;
+		Sdfm1Regs.SDCPARM4.bit.IEH = enable;
+		Sdfm1Regs.SDCPARM4.bit.IEL = enable;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SdfmInit ==========================================================================
+///
+/// @brief  Funktion initialisiert ePWM1, GPIO 48 bis 55 (SD1_D1 ... 4, SD1_C1 ... 4), die vier
+///					Kanle von SDFM1, die ePWM X-Bar und DMA CH1. Der DMA liest nach jedem SOCA-Event
+///					von ePWM1 die vier Datenfilter (ein Burst), danach wird "SdfmDmaISR()" aufgerufen
+///					(INT7.1). Komparatorereignisse lsen zustzlich "SdfmTripISR()" aus (INT5.9)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SdfmInit(void)
+{
+		uint16_t i;
+
+		for (i = 0; i < SDFM_NUMBER_OF_CHANNELS; i++)
+		{
+				sdfmDmaBuffer[i] = 0;
+				sdfmMeasurement.current[i] = 0.0f;
+		}
+		sdfmMeasurement.frames = 0;
+		sdfmMeasurement.tripFlags = 0;
+		sdfmMeasurement.trips = 0;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// GPIO 48 bis 55 auf SD1_D1, SD1_C1, ... SD1_D4, SD1_C4 setzen (Mux 7) und
+		// asynchron einlesen (der Modulatortakt darf nicht gefiltert werden)
+		GpioCtrlRegs.GPBGMUX2.all = (GpioCtrlRegs.GPBGMUX2.all & 0xFFFF0000UL) | 0x00005555UL;
+		GpioCtrlRegs.GPBMUX2.all  = (GpioCtrlRegs.GPBMUX2.all & 0xFFFF0000UL) | 0x0000FFFFUL;
+		GpioCtrlRegs.GPBQSEL2.all = (GpioCtrlRegs.GPBQSEL2.all & 0xFFFF0000UL) | 0x0000FFFFUL;
+
+		SdfmInitPwm1();
+		SdfmInitXbar();
+
+		// Takt fr das SDFM1-Modul einschalten und 5 Takte warten, bis der Takt
+		// zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR6.bit.SD1 = 1;
+		__asm(" RPT #4 || NOP");
+
+		// Daten- und Komparatorfilter aller Kanle (siehe Kapitel "Sigma Delta Filter Module"
+		// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		// - Datenfilter: Start mit jedem SOCA-Event von ePWM1 (SDSYNCEN), 16-Bit-Ergebnis
+		// - Komparatorfilter: obere/untere Schwelle symmetrisch um SDFM_COMPARATOR_ZERO
+		// Kanal 1
+		Sdfm1Regs.SDCTLPARM1.bit.MOD = SDFM_MODULATOR_MODE_0;
+		Sdfm1Regs.SDDFPARM1.bit.SST = SDFM_DATA_FILTER;
+		Sdfm1Regs.SDDFPARM1.bit.DOSR = SDFM_DATA_OSR - 1;
+		Sdfm1Regs.SDDFPARM1.bit.SDSYNCEN = 1;
+		Sdfm1Regs.SDDFPARM1.bit.AE = 1;
+		Sdfm1Regs.SDDPARM1.bit.DR = 0;
+		Sdfm1Regs.SDDPARM1.bit.SH = SDFM_DATA_SHIFT;
+		Sdfm1Regs.SDSYNC1.bit.SYNCSEL = SDFM_SYNC_EPWM1_SOCA;
+		Sdfm1Regs.SDCPARM1.bit.CS1_CS0 = SDFM_COMPARATOR_FILTER;
+		Sdfm1Regs.SDCPARM1.bit.COSR = SDFM_COMPARATOR_OSR - 1;
+		Sdfm1Regs.SDFLT1CMPH1.bit.HLT = SDFM_COMPARATOR_ZERO + SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDFLT1CMPL1.bit.LLT = SDFM_COMPARATOR_ZERO - SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDCPARM1.bit.IEH = 1;
+		Sdfm1Regs.SDCPARM1.bit.IEL = 1;
+		Sdfm1Regs.SDCPARM1.bit.CEN = 1;
+		Sdfm1Regs.SDDFPARM1.bit.FEN = 1;
+
+		// Kanal 2
+		Sdfm1Regs.SDCTLPARM2.bit.MOD = SDFM_MODULATOR_MODE_0;
+		Sdfm1Regs.SDDFPARM2.bit.SST = SDFM_DATA_FILTER;
+		Sdfm1Regs.SDDFPARM2.bit.DOSR = SDFM_DATA_OSR - 1;
+		Sdfm1Regs.SDDFPARM2.bit.SDSYNCEN = 1;
+		Sdfm1Regs.SDDFPARM2.bit.AE = 1;
+		Sdfm1Regs.SDDPARM2.bit.DR = 0;
+		Sdfm1Regs.SDDPARM2.bit.SH = SDFM_DATA_SHIFT;
+		Sdfm1Regs.SDSYNC2.bit.SYNCSEL = SDFM_SYNC_EPWM1_SOCA;
+		Sdfm1Regs.SDCPARM2.bit.CS1_CS0 = SDFM_COMPARATOR_FILTER;
+		Sdfm1Regs.SDCPARM2.bit.COSR = SDFM_COMPARATOR_OSR - 1;
+		Sdfm1Regs.SDFLT2CMPH1.bit.HLT = SDFM_COMPARATOR_ZERO + SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDFLT2CMPL1.bit.LLT = SDFM_COMPARATOR_ZERO - SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDCPARM2.bit.IEH = 1;
+		Sdfm1Regs.SDCPARM2.bit.IEL = 1;
+		Sdfm1Regs.SDCPARM2.bit.CEN = 1;
+		Sdfm1Regs.SDDFPARM2.bit.FEN = 1;
+
+		// Kanal 3
+		Sdfm1Regs.SDCTLPARM3.bit.MOD = SDFM_MODULATOR_MODE_0;
+		Sdfm1Regs.SDDFPARM3.bit.SST = SDFM_DATA_FILTER;
+		Sdfm1Regs.SDDFPARM3.bit.DOSR = SDFM_DATA_OSR - 1;
+		Sdfm1Regs.SDDFPARM3.bit.SDSYNCEN = 1;
+		Sdfm1Regs.SDDFPARM3.bit.AE = 1;
+		Sdfm1Regs.SDDPARM3.bit.DR = 0;
+		Sdfm1Regs.SDDPARM3.bit.SH = SDFM_DATA_SHIFT;
+		Sdfm1Regs.SDSYNC3.bit.SYNCSEL = SDFM_SYNC_EPWM1_SOCA;
+		Sdfm1Regs.SDCPARM3.bit.CS1_CS0 = SDFM_COMPARATOR_FILTER;
+		Sdfm1Regs.SDCPARM3.bit.COSR = SDFM_COMPARATOR_OSR - 1;
+		Sdfm1Regs.SDFLT3CMPH1.bit.HLT = SDFM_COMPARATOR_ZERO + SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDFLT3CMPL1.bit.LLT = SDFM_COMPARATOR_ZERO - SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDCPARM3.bit.IEH = 1;
+		Sdfm1Regs.SDCPARM3.bit.IEL = 1;
+		Sdfm1Regs.SDCPARM3.bit.CEN = 1;
+		Sdfm1Regs.SDDFPARM3.bit.FEN = 1;
+
+		// Kanal 4
+		Sdfm1Regs.SDCTLPARM4.bit.MOD = SDFM_MODULATOR_MODE_0;
+		Sdfm1Regs.SDDFPARM4.bit.SST = SDFM_DATA_FILTER;
+		Sdfm1Regs.SDDFPARM4.bit.DOSR = SDFM_DATA_OSR - 1;
+		Sdfm1Regs.SDDFPARM4.bit.SDSYNCEN = 1;
+		Sdfm1Regs.SDDFPARM4.bit.AE = 1;
+		Sdfm1Regs.SDDPARM4.bit.DR = 0;
+		Sdfm1Regs.SDDPARM4.bit.SH = SDFM_DATA_SHIFT;
+		Sdfm1Regs.SDSYNC4.bit.SYNCSEL = SDFM_SYNC_EPWM1_SOCA;
+		Sdfm1Regs.SDCPARM4.bit.CS1_CS0 = SDFM_COMPARATOR_FILTER;
+		Sdfm1Regs.SDCPARM4.bit.COSR = SDFM_COMPARATOR_OSR - 1;
+		Sdfm1Regs.SDFLT4CMPH1.bit.HLT = SDFM_COMPARATOR_ZERO + SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDFLT4CMPL1.bit.LLT = SDFM_COMPARATOR_ZERO - SDFM_TRIP_COUNTS;
+		Sdfm1Regs.SDCPARM4.bit.IEH = 1;
+		Sdfm1Regs.SDCPARM4.bit.IEL = 1;
+		Sdfm1Regs.SDCPARM4.bit.CEN = 1;
+		Sdfm1Regs.SDDFPARM4.bit.FEN = 1;
+
+		// Komparatorinterrupts zusammenfassen, alle Filter gemeinsam freigeben
+		Sdfm1Regs.SDIFLGCLR.all = 0xFFFFFFFFUL;
+		Sdfm1Regs.SDCTL.bit.MIE = 1;
+		Sdfm1Regs.SDMFILEN.bit.MFE = 1;
+
+		// Takt fr den DMA einschalten und den DMA als zweiten Master der Peripherie-
+		// Frame 1 (SDFM) auswhlen (sonst ist es der CLA)
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		CpuSysRegs.SECMSEL.bit.PF1SEL = 1;
+		// DMA luft weiter, wenn der Debugger die CPU anhlt
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// DMA CH1: pro Trigger (Kanal 4 fertig, alle Kanle sind synchron) ein Burst aus den
+		// 16-Bit-Ergebnissen SDDATA1 ... 4 nach "sdfmDmaBuffer[]"
+		DmaRegs.CH1.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = (uint32_t)&Sdfm1Regs.SDDATA1;
+		DmaRegs.CH1.SRC_ADDR_SHADOW     = (uint32_t)&Sdfm1Regs.SDDATA1;
+		DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (uint32_t)&sdfmDmaBuffer[0];
+		DmaRegs.CH1.DST_ADDR_SHADOW     = (uint32_t)&sdfmDmaBuffer[0];
+		DmaRegs.CH1.BURST_SIZE.bit.BURSTSIZE = SDFM_NUMBER_OF_CHANNELS - 1;
+		DmaRegs.CH1.SRC_BURST_STEP = SDFM_DATA_REGISTER_STEP;
+		DmaRegs.CH1.DST_BURST_STEP = 1;
+		DmaRegs.CH1.TRANSFER_SIZE = 0;
+		DmaRegs.CH1.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH1.DST_TRANSFER_STEP = 0;
+		DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.SRC_WRAP_STEP = 0;
+		DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = SDFM_DMA_TRIGGER_SD1FLT4;
+		DmaRegs.CH1.MODE.bit.PERINTSEL = 1;
+		DmaRegs.CH1.MODE.bit.PERINTE = 1;
+		DmaRegs.CH1.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH1.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH1.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH1.MODE.bit.DATASIZE = 0;
+		// Interrupt am Ende des Transfers (ein Burst = eine PWM-Periode)
+		DmaRegs.CH1.MODE.bit.CHINTMODE = 1;
+		DmaRegs.CH1.MODE.bit.CHINTE = 1;
+		DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH1.CONTROL.bit.ERRCLR = 1;
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// ISR des DMA (DMA_CH1_INT, INT7.1) und von SDFM1 (SDFM1_INT, INT5.9)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieVectTable.DMA_CH1_INT = &SdfmDmaISR;
+		PieVectTable.SDFM1_INT = &SdfmTripISR;
+		PieCtrlRegs.PIEIER7.bit.INTx1 = 1;
+		PieCtrlRegs.PIEIER5.bit.INTx9 = 1;
+		IER |= M_INT7 | M_INT5;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		DmaRegs.CH1.CONTROL.bit.RUN = 1;
+
+		EDIS;
+}
+
+
+//=== Function: SdfmResetTrip =====================================================================
+///
+/// @brief  Funktion hebt die berstromabschaltung von ePWM1 auf und gibt die Komparator-
+///					interrupts wieder frei. Liegt der Strom noch auerhalb der Schwellen, schaltet die
+///					Hardware sofort wieder ab
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SdfmResetTrip(void)
+{
+		EALLOW;
+		Sdfm1Regs.SDIFLGCLR.all = 0xFFFFFFFFUL;
+		EPwm1Regs.TZCLR.bit.DCAEVT1 = 1;
+		EPwm1Regs.TZCLR.bit.OST = 1;
+		EPwm1Regs.TZCLR.bit.INT = 1;
+		SdfmEnableTripInterrupts(1);
+		EDIS;
+}
+
+
+//=== Function: SdfmDmaISR ========================================================================
+///
+/// @brief  ISR wird aufgerufen, wenn DMA CH1 die Datenfilter aller Kanle bertragen hat (einmal
+///					pro PWM-Periode, synchron zum SOCA-Event von ePWM1). Die Rohwerte werden in Ampere
+///					umgerechnet. An dieser Stelle kann die Stromregelung aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SdfmDmaISR(void)
+{
+		uint16_t i;
+
+		for (i = 0; i < SDFM_NUMBER_OF_CHANNELS; i++)
+		{
+				sdfmMeasurement.current[i] = (float)sdfmDmaBuffer[i] * SDFM_AMPERE_PER_LSB;
+		}
+		sdfmMeasurement.frames++;
+
+    // Interrupt der Gruppe 7 besttigen (da gehrt der DMA-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+}
+
+
+//=== Function: SdfmTripISR =======================================================================
+///
+/// @brief  ISR wird bei einem Komparatorereignis von SDFM1 aufgerufen. Die Abschaltung von ePWM1
+///					ist zu diesem Zeitpunkt bereits durch die Hardware erfolgt, die ISR protokolliert nur
+///					die auslsenden Kanle (SDIFLG.IFHx/IFLx) und sperrt die Komparatorinterrupts bis zum
+///					Aufruf von "SdfmResetTrip()"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SdfmTripISR(void)
+{
+		uint32_t flags = Sdfm1Regs.SDIFLG.all;
+
+		EALLOW;
+		SdfmEnableTripInterrupts(0);
+
+		// Bit 0 ... 7: IFH1, IFL1, ... IFH4, IFL4
+		sdfmMeasurement.tripFlags = (uint16_t)(flags & 0x00FF);
+		sdfmMeasurement.trips++;
+
+		// Flags und Master-Interrupt-Flag lschen
+		Sdfm1Regs.SDIFLGCLR.all = flags;
+		EDIS;
+
+    // Interrupt der Gruppe 5 besttigen (da gehrt der SDFM1-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK5 = 1;
+}
@@ -0,0 +1,113 @@
+//=================================================================================================
+/// @file       mySDFM.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um Strme mit isolierten Sigma-Delta-
+///							Modulatoren (z.B. AMC1306) und dem SDFM1-Modul des TMS320F2838x zu messen. Jeder
+///							der vier Filterkanle hat zwei Filter:
+///							- Datenfilter (Sinc3, OSR 128): Messwert, wird mit dem SOCA-Event des ePWM1-Moduls
+///							  (Periodenmitte der Brcke) synchronisiert. Sobald alle vier Kanle fertig sind,
+///							  kopiert DMA CH1 die 16-Bit-Ergebnisse in "sdfmDmaBuffer", der DMA-Interrupt
+///							  (einmal pro PWM-Periode) rechnet sie in Ampere um
+///							- Komparatorfilter (Sinc3, OSR 32): berwacht den Strom mit einer oberen und einer
+///							  unteren Schwelle. Die Komparatorereignisse aller Kanle liegen ber die ePWM X-Bar
+///							  (TRIP4) auf dem Digital-Compare-Modul des ePWM1-Moduls und lsen ohne CPU einen
+///							  One-Shot-Trip aus (beide Pins Low). Die Reaktionszeit ist nur durch die
+///							  Filterlaufzeit bestimmt (ca. 3 * 32 Takte des Modulators, bei 20 MHz ca. 5 us)
+///
+///							Verkabelung:
+///							- Modulator 1 ... 4: Daten an GPIO 48/50/52/54 (SD1_D1 ... 4),
+///							  Takt an GPIO 49/51/53/55 (SD1_C1 ... 4)
+///							- GPIO 0 und 1 (EPWM1A/B) an Oszilloskop
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYSDFM_H_
+#define MYSDFM_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Filterkanle eines SDFM-Moduls
+#define SDFM_NUMBER_OF_CHANNELS							4
+// Filtertyp (SDDFPARMx.SST und SDCPARMx.CS1_CS0)
+#define SDFM_FILTER_SINCFAST								0
+#define SDFM_FILTER_SINC1										1
+#define SDFM_FILTER_SINC2										2
+#define SDFM_FILTER_SINC3										3
+// Modulator-Modus (SDCTLPARMx.MOD), 0: Daten und Takt mit gleicher Frequenz
+#define SDFM_MODULATOR_MODE_0								0
+// Datenfilter: Sinc3 mit OSR 128 ergibt max. +/- 128^3 = 2^21, rechts um 6 Bit
+// geschoben passt der Wert in 16 Bit (Vorzeichen)
+#define SDFM_DATA_FILTER										SDFM_FILTER_SINC3
+#define SDFM_DATA_OSR												128
+#define SDFM_DATA_SHIFT											6
+// Komparatorfilter: Sinc3 mit OSR 32 ergibt 0 ... 32^3 = 32768
+#define SDFM_COMPARATOR_FILTER							SDFM_FILTER_SINC3
+#define SDFM_COMPARATOR_OSR									32
+#define SDFM_COMPARATOR_ZERO								16384
+// Strom bei Vollaussteuerung des Modulators (+/- 320 mV am Shunt), Messwert +/- 2^15
+#define SDFM_CURRENT_FULL_SCALE_A						50.0f
+// berstromschwellen des Komparatorfilters (Ampere, symmetrisch um 0 A)
+#define SDFM_TRIP_CURRENT_A									40.0f
+#define SDFM_TRIP_COUNTS										((uint16_t)(SDFM_COMPARATOR_ZERO * SDFM_TRIP_CURRENT_A	\
+																						/ SDFM_CURRENT_FULL_SCALE_A))
+// PWM-Frequenz der Brcke (ePWM1, Up-Down-Zhler mit EPWMCLK = 100 MHz)
+#define SDFM_PWM_FREQUENCY_HZ								10000UL
+#define SDFM_PWM_PERIOD											(DEVICE_SYSCLK_MHZ * 1000000UL / 2 / SDFM_PWM_FREQUENCY_HZ / 2)
+// Synchronisationsquelle des Datenfilters (SDSYNCx.SYNCSEL), 0: ePWM1 SOCA
+#define SDFM_SYNC_EPWM1_SOCA								0
+// DMA-Trigger "Datenfilter 4 von SDFM1 fertig" (DMACHSRCSELx, siehe Tabelle "DMA Trigger Source
+// Options" im Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define SDFM_DMA_TRIGGER_SD1FLT4						98
+// Ausgang der ePWM X-Bar fr die Komparatorereignisse (TRIP4). Die Ereignisse von Filter n
+// liegen auf MUX(16 + 2 * (n - 1)), Auswahl 1 ist COMPH_OR_COMPL
+#define SDFM_XBAR_FIRST_MUX									16
+#define SDFM_XBAR_COMPH_OR_COMPL						1
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Messwerte und Zustand der Strommessung
+typedef struct
+{
+		float current[SDFM_NUMBER_OF_CHANNELS];				// Ampere, aktualisiert in jeder PWM-Periode
+		uint32_t frames;															// Anzahl der DMA-Frames (PWM-Perioden)
+		uint16_t tripFlags;														// SDIFLG der letzten berstromabschaltung
+		uint16_t trips;																// Anzahl berstromabschaltungen
+} SdfmMeasurement;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Rohwerte der Datenfilter (vom DMA geschrieben, GS-RAM)
+extern volatile int16_t sdfmDmaBuffer[SDFM_NUMBER_OF_CHANNELS];
+// Messwerte
+extern volatile SdfmMeasurement sdfmMeasurement;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert ePWM1, die GPIOs, SDFM1 (Daten- und Komparatorfilter), die ePWM X-Bar
+// und DMA CH1
+extern void SdfmInit(void);
+// Funktion hebt die berstromabschaltung von ePWM1 auf und gibt die Komparatorinterrupts frei
+extern void SdfmResetTrip(void);
+// ISR von DMA CH1 (Datenfilter aller Kanle bertragen, einmal pro PWM-Periode)
+extern __interrupt void SdfmDmaISR(void);
+// ISR von SDFM1 (Komparatorereignis eines Kanals)
+extern __interrupt void SdfmTripISR(void);
+
+
+#endif
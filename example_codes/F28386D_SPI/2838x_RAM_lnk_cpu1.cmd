@@ -18,14 +18,7 @@ MEMORY
    RAMLS7           : origin = 0x00B800, length = 0x000800
    RAMGS0           : origin = 0x00D000, length = 0x001000
    RAMGS1           : origin = 0x00E000, length = 0x001000
-   RAMGS2           : origin = 0x00F000, length = 0x001000
-   RAMGS3           : origin = 0x010000, length = 0x001000
-   RAMGS4           : origin = 0x011000, length = 0x001000
-   RAMGS5           : origin = 0x012000, length = 0x001000
-   RAMGS6           : origin = 0x013000, length = 0x001000
-   RAMGS7           : origin = 0x014000, length = 0x001000
-   RAMGS8           : origin = 0x015000, length = 0x001000
-   RAMGS9           : origin = 0x016000, length = 0x001000
+   RAMGS2_9         : origin = 0x00F000, length = 0x008000     /* RAMGS2 to RAMGS9 as one block for large capture buffers */
    RAMGS10          : origin = 0x017000, length = 0x001000
    RAMGS11          : origin = 0x018000, length = 0x001000
    RAMGS12          : origin = 0x019000, length = 0x001000
@@ -71,17 +64,17 @@ SECTIONS
 
    .stack           : > RAMM1
 #if defined(__TI_EABI__)
-   .bss             : > RAMLS5
-   .bss:output      : > RAMLS3
+   .bss             : >> RAMLS5 | RAMLS6 | RAMLS7
+   .bss:output      : > RAMGS13
    .init_array      : > RAMM0
-   .const           : > RAMLS5 | RAMLS6
-   .data            : > RAMLS5
-   .sysmem          : > RAMLS4
+   .const           : >> RAMLS6 | RAMLS7 | RAMGS13
+   .data            : >> RAMLS5 | RAMLS6 | RAMLS7
+   .sysmem          : > RAMGS12
 #else
    .pinit           : > RAMM0
-   .ebss            : >> RAMLS5 | RAMLS6
-   .econst          : > RAMLS5
-   .esysmem         : > RAMLS5
+   .ebss            : >> RAMLS5 | RAMLS6 | RAMLS7
+   .econst          : >> RAMLS6 | RAMLS7 | RAMGS13
+   .esysmem         : > RAMGS12
 #endif
 
    ramgs0 : > RAMGS0, type=NOINIT
@@ -92,13 +85,17 @@ SECTIONS
    MSGRAM_CPU_TO_CM   > CPUTOCMRAM, type=NOINIT
    MSGRAM_CM_TO_CPU   > CMTOCPURAM, type=NOINIT
 
-   /* The following section definition are for SDFM examples */
-   Filter_RegsFile  : > RAMGS0
-   Filter1_RegsFile : > RAMGS1, fill=0x1111
-   Filter2_RegsFile : > RAMGS2, fill=0x2222
-   Filter3_RegsFile : > RAMGS3, fill=0x3333
-   Filter4_RegsFile : > RAMGS4, fill=0x4444
-   Difference_RegsFile : >RAMGS5, fill=0x3333
+   /* Named data sections, see the DEVICE_..._DATA() macros in myDevice.h:
+      hotdata  - hot control state in LSx RAM (single cycle, can be given to the CLA)
+      capture  - bulk capture and log buffers in RAMGS2 to RAMGS9 (32 KW, not initialised)
+      dmabuf   - further DMA buffers in RAMGS10/RAMGS11 (ramgs0/ramgs1 are DMA buffers too)
+      SHARERAMGS14/15 - data shared with CPU2 (CPU1 must give the master role of the
+                 block, which CPU2 writes, to CPU2 with MemCfgRegs.GSxMSEL) */
+   hotdata      : > RAMLS4
+   capture      : > RAMGS2_9, type=NOINIT
+   dmabuf       : >> RAMGS10 | RAMGS11, type=NOINIT
+   SHARERAMGS14 : > RAMGS14, type=NOINIT
+   SHARERAMGS15 : > RAMGS15, type=NOINIT
 
     .TI.ramfunc : {} > RAMM0
 
@@ -8,7 +8,21 @@
 ///
 ///						nderung mySPI.c V2.0: Verwendung der Hardware-Puffer zum Senden und Empfangen
 ///
-/// @version	V1.3
+///						nderung in Version 1.4: Beispiel fr die Warteschlange, die DAC, ADC und EEPROM
+///						mit ihren eigenen Einstellungen direkt nacheinander anspricht
+///
+///						nderung in Version 1.5: Beispiel fr das DMA-Streaming, das den ADC mit 10 kHz
+///						(CPU-Timer 1) ohne CPU-Last abtastet
+///
+///						nderung in Version 1.6: DAC-Rampe mit zwei abwechselnd eingereihten Transaktionen
+///						und Callback-Funktion. Der nchste Wert wird vorbereitet, whrend der vorherige
+///						noch gesendet wird
+///
+///						nderung in Version 1.7: Beispiel fr den Slave-Betrieb an SPI-B. Ein externer
+///						Master liest Frames aus 64 Wrtern, jeder Frame enthlt Frame-Zhler, Anzahl der
+///						Neusynchronisationen und die vor zwei Frames empfangenen Wrter
+///
+/// @version	V1.7
 ///
 /// @date			24.03.2023
 ///
@@ -28,6 +42,8 @@
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+void DacRampCallback(SpiTransaction *transaction);
+void SlaveFrameCallback(const uint16_t *rxFrame, uint16_t *txFrame);
 
 
 //-------------------------------------------------------------------------------------------------
@@ -35,6 +51,35 @@
 //-------------------------------------------------------------------------------------------------
 // Zum Starten der Kommunikation
 uint32_t startSPI = 0;
+// Daten der Transaktionen der Warteschlange (rechtsbndig)
+const uint16_t dacData[1] = {0x8000};
+uint16_t adcData[1];
+const uint16_t eepromCommand[4] = {0x03, 0x00, 0x00, 0x00};
+uint16_t eepromData[4];
+// DAC schreiben, ADC lesen und EEPROM lesen (Befehl READ ab Adresse 0)
+SpiTransaction dacTransaction    = {SPI_DEVICE_DAC,    dacData,       0,          1, 0, SPI_STATUS_IDLE};
+SpiTransaction adcTransaction    = {SPI_DEVICE_ADC,    0,             adcData,    1, 0, SPI_STATUS_IDLE};
+SpiTransaction eepromTransaction = {SPI_DEVICE_EEPROM, eepromCommand, eepromData, 4, 0, SPI_STATUS_IDLE};
+// DAC-Rampe: zwei Transaktionen, von denen eine gesendet wird, whrend
+// die andere mit dem nchsten Wert vorbereitet und eingereiht wird
+uint32_t startDacRamp = 0;
+uint16_t dacRampValue = 0;
+uint16_t dacRampData[2][1];
+SpiTransaction dacRampTransaction[2] =
+{
+		{SPI_DEVICE_DAC, dacRampData[0], 0, 1, DacRampCallback, SPI_STATUS_IDLE},
+		{SPI_DEVICE_DAC, dacRampData[1], 0, 1, DacRampCallback, SPI_STATUS_IDLE}
+};
+// Anzahl der gesendeten Werte der Rampe (wird in der Callback-Funktion erhht)
+volatile uint32_t dacRampCount = 0;
+// Zum Starten und Beenden des DMA-Streamings
+uint32_t startStream = 0;
+uint32_t stopStream = 0;
+// Befehlswrter des ADC fr 4 Kanle (ein Frame pro Abtastung, rechtsbndig)
+uint16_t adcCommands[SPI_STREAM_SIZE_BUFFER];
+// Zum Starten und Beenden des Slave-Betriebs an SPI-B (Frames aus 64 Wrtern)
+uint32_t startSlave = 0;
+uint32_t stopSlave = 0;
 
 
 //=== Function: main ==============================================================================
@@ -50,8 +95,12 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
     // SPI als Master mit 1 MHz CLK-Takt initialisieren
     SpiInitA(SPI_CLOCK_1_MHZ);
+    // SPI-B fr den Slave-Betrieb initialisieren (GPIO 63 bis 66)
+    SpiSlaveInitB();
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -67,9 +116,30 @@ void main(void)
     // 5) Rckgabewert prfen, ob die Kommunikation gestartet wurde
     // 6) Warten bis die Kommunikation abgeschlossen ist durch Aufruf von "SpiGetStatusA()"
     // 7) Slave abwhlen z.B. durch Aufruf des Makros "SPI_DISABLE_SLAVE_1"
-    // 8) Empfangene Daten aus "spiBufferRxA[]" lesen
+    // 8) Empfangene Daten aus "spiBufferRxA[]" lesen (gepackt, mit BYTE_BUFFER_GET())
     // 9) SPI-Status auf "idle" setzen durch Aufruf von "SpiSetStatusIdleA()"
 
+    // Alternativ Transaktionen ber die Warteschlange: die ISR konfiguriert das
+    // SPI-Modul fr jedes Gert um und startet die Transaktionen direkt nacheinander
+    SpiSubmitA(&dacTransaction);
+    SpiSubmitA(&adcTransaction);
+    SpiSubmitA(&eepromTransaction);
+
+    // CPU-Timer 1 als Trigger des DMA-Streamings (10 kHz). Der DMA-Trigger wird
+    // vom Timer-Interrupt-Flag ausgelst, der CPU-Interrupt 13 bleibt ausgeschaltet
+    CpuTimer1Regs.TCR.bit.TSS = 1;
+    CpuTimer1Regs.PRD.all = (DEVICE_SYSCLK_MHZ * 100) - 1;
+    CpuTimer1Regs.TPR.all = 0;
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TRB = 1;
+    CpuTimer1Regs.TCR.bit.TIE = 1;
+    // 256 Frames aus je 4 Befehlswrtern (Kanal 0 bis 3) vorbereiten
+    for (uint16_t i=0; i<(256 * 4); i++)
+    {
+    		adcCommands[i] = (i & 0x03) << 12;
+    }
+    SpiStreamPrepareTxA(SPI_DEVICE_ADC, adcCommands, 256 * 4);
+
 
 		// Dauerschleife Hauptprogramm
     while(1)
@@ -85,13 +155,13 @@ void main(void)
 						// geschrieben werden. Dabei mssen die Daten am Anfang des Puffers geschrieben werden (beginnend
 						// vom Element 0 an). Es ist darauf zu achten, dass nicht mehr Daten geschrieben, als der Puffer
 						// gro ist (SPI_SIZE_BUFFER)
-						spiBufferTxA[0] = 1;
-						spiBufferTxA[1] = 2;
-						spiBufferTxA[2] = 3;
+						BYTE_BUFFER_SET(spiBufferTxA, 0, 1);
+						BYTE_BUFFER_SET(spiBufferTxA, 1, 2);
+						BYTE_BUFFER_SET(spiBufferTxA, 2, 3);
 
 						for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
 						{
-								spiBufferTxA[i] = 1;
+								BYTE_BUFFER_SET(spiBufferTxA, i, 1);
 						}
 
 						// Sende-Vorgang starten. Falls der Rckgabewert "false" ist, wurde der Vorgang
@@ -103,6 +173,59 @@ void main(void)
 						}
 				}
 
+				// DAC-Rampe: jede freie Transaktion mit dem nchsten Wert wieder einreihen.
+				// Sie startet direkt nach der gerade laufenden, ohne auf deren Ende zu warten
+				if (startDacRamp == 1)
+				{
+						for (uint16_t i=0; i<2; i++)
+						{
+								if (   (dacRampTransaction[i].status != SPI_STATUS_QUEUED)
+										&& (dacRampTransaction[i].status != SPI_STATUS_IN_PROGRESS))
+								{
+										dacRampData[i][0] = dacRampValue;
+										if (SpiSubmitA(&dacRampTransaction[i]) >= SPI_SUBMIT_QUEUED)
+										{
+												dacRampValue += 0x0100;
+										}
+								}
+						}
+				}
+
+				// DMA-Streaming starten. Alle 4 Wrter liest der DMA aus dem Empfangs-FIFO,
+				// nach 256 Frames ist "spiStreamRxA[]" voll und "spiStreamBufferCountA" wird erhht
+				if (startStream == 1)
+				{
+						startStream = 0;
+						if (SpiStreamStartA(SPI_DEVICE_ADC, SPI_STREAM_TRIGGER_TINT1, 4, 256))
+						{
+								CpuTimer1Regs.TCR.bit.TSS = 0;
+						}
+				}
+				if (stopStream == 1)
+				{
+						stopStream = 0;
+						CpuTimer1Regs.TCR.bit.TSS = 1;
+						SpiStreamStopA();
+				}
+
+				// Slave-Betrieb starten. Der Master (Modus 0, 16 Bit, bis SPI_SLAVE_MAX_CLOCK) taktet
+				// pro Anwahl 64 Wrter, die Callback-Funktion bereitet den bernchsten Frame vor
+				if (startSlave == 1)
+				{
+						startSlave = 0;
+						for (uint16_t i=0; i<SPI_SLAVE_MAX_FRAME_WORDS; i++)
+						{
+								spiSlaveTxB[0][i] = 0;
+								spiSlaveTxB[1][i] = 0;
+						}
+						SpiSlaveStartB(0, 0, 64, SlaveFrameCallback);
+				}
+				if (stopSlave == 1)
+				{
+						stopSlave = 0;
+						SpiSlaveStopB();
+				}
+
 				// Warten, bis die Kommunikation beendet ist
 				while (SpiGetStatusA() == SPI_STATUS_IN_PROGRESS);
 
@@ -115,3 +238,41 @@ void main(void)
 				SpiSetStatusIdleA();
     }
 }
+
+
+//=== Function: DacRampCallback ===================================================================
+///
+/// @brief  Callback-Funktion der DAC-Rampe. Wird in der SPI-ISR nach dem Senden eines Wertes
+///					aufgerufen und zhlt die gesendeten Werte
+///
+/// @param  SpiTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+void DacRampCallback(SpiTransaction *transaction)
+{
+		dacRampCount++;
+}
+
+
+//=== Function: SlaveFrameCallback ================================================================
+///
+/// @brief  Callback-Funktion des Slave-Betriebs. Wird in "SpiSlaveFrameISRB()" am Ende jedes
+///					Frames aufgerufen und schreibt den Frame, den der Master zwei Frames spter liest:
+///					Frame-Zhler, Anzahl der Neusynchronisationen und die gerade empfangenen Wrter
+///
+/// @param  const uint16_t *rxFrame, uint16_t *txFrame
+///
+/// @return void
+///
+//=================================================================================================
+void SlaveFrameCallback(const uint16_t *rxFrame, uint16_t *txFrame)
+{
+		txFrame[0] = (uint16_t)spiSlaveFrameCountB;
+		txFrame[1] = (uint16_t)spiSlaveResyncCountB;
+		for (uint16_t i=2; i<64; i++)
+		{
+				txFrame[i] = rxFrame[i];
+		}
+}
@@ -12,9 +12,49 @@
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V2.0
+///							nderung in Version 2.1: Gerteliste "spiDevices[]" mit Takt, Polaritt, Phase,
+///							Datenlnge und Slave-Select pro Gert sowie eine Warteschlange fr
+///							Transaktionen ("SpiSubmitA()"). Die ISR konfiguriert das Modul zwischen zwei
+///							Transaktionen fr das nchste Gert um und startet die nchste Transaktion
+///							direkt nach dem Ende der vorherigen. "SpiSendDataA()" nutzt weiterhin die
+///							Einstellungen aus "SpiInitA()" und wartet nicht in der Warteschlange.
 ///
-/// @date       24.03.2023
+///							nderung in Version 2.2: DMA-Streaming (Vollduplex). Ein Trigger (ePWM-SOC
+///							oder CPU-Timer) startet je einen Frame: DMA CH5 kopiert die vorbereiteten,
+///							linksbndigen Wrter aus "spiStreamTxA[]" in den Sende-FIFO, DMA CH6 kopiert
+///							die empfangenen Wrter nach "spiStreamRxA[]". Beide Kanle laufen zyklisch
+///							ber alle Frames des Puffers, die CPU wird nur einmal pro Puffer unterbrochen.
+///							Der ADC nutzt den Hardware-Slave-Select SPISTEA (GPIO 57), damit jeder Frame
+///							ohne CPU eingerahmt wird.
+///
+///							nderung in Version 2.3: "SpiSendDataA()" gibt "true" zurck, wenn die
+///							Kommunikation gestartet wurde. Die ISR ruft am Ende einer Transaktion deren
+///							Callback-Funktion auf, sodass die aufrufende Stelle die nchste Transaktion
+///							vorbereiten kann, whrend die aktuelle noch luft, statt den Status abzufragen.
+///							"SpiSubmitA()" meldet SPI_SUBMIT_STARTED, _QUEUED, _BUSY oder _INVALID.
+///
+///							nderung in Version 3.0: Die Funktionen arbeiten auf einem Objekt der Struktur
+///							"SpiInstance" ("spiA" ... "spiD"), das einen Zeiger auf die Register des Moduls
+///							und den kompletten Zustand der Kommunikation enthlt. Der Code liegt damit nur
+///							einmal im Speicher und mehrere SPI-Module knnen parallel betrieben werden. Die
+///							bisherigen Funktionen fr SPI-A (z.B. "SpiSubmitA()") sind als Makros in
+///							"mySPI.h" erhalten. Das DMA-Streaming ist weiterhin nur fr SPI-A vorhanden.
+///
+///							nderung in Version 3.1: Die Software-Puffer fr "SpiSendData()" ("spiBufferTxA[]"
+///							usw.) sind gepackt (zwei Bytes pro Wort, myByteBuffer.h) und belegen nur noch die
+///							Hlfte des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET() und BYTE_BUFFER_SET().
+///							Die Puffer der Transaktionen bleiben ein Wort pro Zeichen (Datenlnge bis 16 Bit).
+///
+///							nderung in Version 3.2: Slave-Betrieb an SPI-B ("SpiSlaveStartB()") fr einen
+///							externen Master (z.B. Datenkonzentrator). DMA CH3 und CH4 senden und empfangen
+///							Frames fester Lnge abwechselnd aus zwei Puffern ("spiSlaveTxB[]", "spiSlaveRxB[]")
+///							ohne CPU-Beteiligung pro Wort. Am Ende jedes Frames (steigende Flanke von SPISTEB)
+///							prft "SpiSlaveFrameISRB()" die Frame-Grenze, synchronisiert bei Bedarf neu und
+///							bergibt den empfangenen und den freien Sendepuffer an eine Callback-Funktion.
+///
+/// @version    V3.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -24,18 +64,419 @@
 #include "mySPI.h"
 
 
+//-------------------------------------------------------------------------------------------------
+// Prototypes of local functions
+//-------------------------------------------------------------------------------------------------
+static void SpiSelectSlaveA(uint16_t slave);
+static void SpiSelectSlaveNone(uint16_t slave);
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die SPI-Kommunikation
-uint16_t spiBufferTxA[SPI_SIZE_SOFTWARE_BUFFER];
-uint16_t spiBufferRxA[SPI_SIZE_SOFTWARE_BUFFER];
-// Steuern das Kopieren in und aus den Software-Puffern whrend der SPI-Kommunikation
-uint16_t spiBufferIndexTxA;
-uint16_t spiBufferIndexRxA;
-uint16_t spiBytesToTransferA;
-// Flag speichert den aktuellen Zustand der SPI-Kommunikation
-uint16_t spiStatusFlagA;
+// Software-Puffer fr die SPI-Kommunikation (gepackt, zwei Bytes pro Wort)
+uint16_t spiBufferTxA[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferRxA[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferTxB[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferRxB[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferTxC[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferRxC[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferTxD[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+uint16_t spiBufferRxD[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+// Einstellungen der Gerte am SPI-A Bus. Die Phase ist wie im Reference Manual
+// angegeben: Polaritt 0 und Phase 1 entspricht dem SPI-Mode 0 (bernahme bei
+// der steigenden Flanke, erstes Bit eine halbe Periode vor der ersten Flanke)
+const SpiDevice spiDevices[SPI_NUMBER_OF_DEVICES] =
+{
+		// Takt						Polaritt	Phase	Datenlnge	Slave-Select
+		{SPI_CLOCK_2_MHZ,	0,				1,		16,					SPI_SLAVE_1},					// DAC
+		{SPI_CLOCK_1_MHZ,	1,				0,		16,					SPI_SLAVE_STE},				// ADC
+		{SPI_CLOCK_2_MHZ,	0,				1,		8,					SPI_SLAVE_3}					// EEPROM
+};
+// Objekte der SPI-Module. Die Busse B, C und D haben noch keine Gerte, diese werden
+// mit "SpiAttachDevices()" zugeordnet. Der brige Zustand wird in "SpiInit()" gesetzt
+//							Register		Gerte				Anzahl									Slave-Select					Software-Puffer
+SpiInstance spiA = {&SpiaRegs,	spiDevices,	SPI_NUMBER_OF_DEVICES,	SpiSelectSlaveA,		spiBufferTxA, spiBufferRxA};
+SpiInstance spiB = {&SpibRegs,	0,					0,											SpiSelectSlaveNone,	spiBufferTxB, spiBufferRxB};
+SpiInstance spiC = {&SpicRegs,	0,					0,											SpiSelectSlaveNone,	spiBufferTxC, spiBufferRxC};
+SpiInstance spiD = {&SpidRegs,	0,					0,											SpiSelectSlaveNone,	spiBufferTxD, spiBufferRxD};
+// Puffer des DMA-Streamings (mssen im GS-RAM liegen, da der DMA nur darauf zugreifen kann)
+#pragma DATA_SECTION(spiStreamTxA, "ramgs0");
+uint16_t spiStreamTxA[SPI_STREAM_SIZE_BUFFER];
+#pragma DATA_SECTION(spiStreamRxA, "ramgs1");
+uint16_t spiStreamRxA[SPI_STREAM_SIZE_BUFFER];
+// Anzahl der vollstndig empfangenen Streaming-Puffer
+volatile uint32_t spiStreamBufferCountA;
+// Anzahl der erkannten berlufe des Empfangs-FIFOs whrend des Streamings
+uint32_t spiStreamOverflowA;
+// Puffer des Slave-Betriebs (GS-RAM, fr den DMA erreichbar)
+#pragma DATA_SECTION(spiSlaveTxB, "dmabuf");
+uint16_t spiSlaveTxB[2][SPI_SLAVE_MAX_FRAME_WORDS];
+#pragma DATA_SECTION(spiSlaveRxB, "dmabuf");
+uint16_t spiSlaveRxB[2][SPI_SLAVE_MAX_FRAME_WORDS];
+// Anzahl der vollstndig empfangenen Frames seit dem Start bzw. der letzten Synchronisation
+volatile uint32_t spiSlaveFrameCountB;
+// Anzahl der Neusynchronisationen
+uint32_t spiSlaveResyncCountB;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Lnge eines Frames und Callback-Funktion des Slave-Betriebs ("SpiSlaveStartB()")
+static uint16_t spiSlaveWordsPerFrameB;
+static void (*spiSlaveCallbackB)(const uint16_t *rxFrame, uint16_t *txFrame);
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SpiSelectSlaveA ===================================================================
+///
+/// @brief  Funktion whlt alle Slaves ab und anschlieend den bergebenen Slave an. Bei
+///					SPI_SLAVE_STE aktiviert das SPI-Modul den Slave-Select selbst
+///
+/// @param  uint16_t slave
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiSelectSlaveA(uint16_t slave)
+{
+		SPI_DISABLE_SLAVE_1;
+		SPI_DISABLE_SLAVE_2;
+		SPI_DISABLE_SLAVE_3;
+		if (slave == SPI_SLAVE_1)
+		{
+				SPI_ENABLE_SLAVE_1;
+		}
+		else if (slave == SPI_SLAVE_2)
+		{
+				SPI_ENABLE_SLAVE_2;
+		}
+		else if (slave == SPI_SLAVE_3)
+		{
+				SPI_ENABLE_SLAVE_3;
+		}
+}
+
+
+//=== Function: SpiSelectSlaveNone ================================================================
+///
+/// @brief  Slave-Select der Busse ohne eigene Funktion (nur Hardware-Slave-Select SPISTE)
+///
+/// @param  uint16_t slave
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiSelectSlaveNone(uint16_t slave)
+{
+}
+
+
+//=== Function: SpiConfigure ======================================================================
+///
+/// @brief  Funktion konfiguriert das SPI-Modul fr ein Gert aus der Gerteliste des Busses bzw.
+///					mit den Einstellungen aus "SpiInit()" (SPI_DEVICE_INIT). Ist das Modul bereits fr
+///					dieses Gert konfiguriert, wird nichts verndert. Die Konfiguration darf nur
+///					gendert werden, whrend keine bertragung aktiv ist
+///
+/// @param  SpiInstance *spi, uint16_t device
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiConfigure(SpiInstance *spi, uint16_t device)
+{
+		volatile struct SPI_REGS *regs = spi->regs;
+		const SpiDevice *config;
+
+		if (device == spi->configuredDevice)
+		{
+				return;
+		}
+		spi->configuredDevice = device;
+
+		// SPI-Modul zum Konfigurieren ausschalten (FIFOs bleiben erhalten)
+		regs->SPICCR.bit.SPISWRESET = 0;
+		if (device == SPI_DEVICE_INIT)
+		{
+				regs->SPICCR.bit.CLKPOLARITY = 0;
+				regs->SPICTL.bit.CLK_PHASE = 0;
+				regs->SPICCR.bit.SPICHAR = 7;
+				regs->SPIBRR.bit.SPI_BIT_RATE = spi->bitRateInit;
+				spi->shiftTx = 8;
+				spi->maskRx = 0x00FF;
+		}
+		else
+		{
+				config = &spi->devices[device];
+				regs->SPICCR.bit.CLKPOLARITY = config->polarity;
+				regs->SPICTL.bit.CLK_PHASE = config->phase;
+				regs->SPICCR.bit.SPICHAR = config->charLength - 1;
+				// (Low-Speed CLK / clock) - 1, Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
+				regs->SPIBRR.bit.SPI_BIT_RATE = (50000000 / config->clock) - 1;
+				spi->shiftTx = 16 - config->charLength;
+				spi->maskRx = 0xFFFF >> spi->shiftTx;
+		}
+		regs->SPICCR.bit.SPISWRESET = 1;
+}
+
+
+//=== Function: SpiFillFifoTx =====================================================================
+///
+/// @brief  Funktion kopiert die nchsten Daten der Transaktion linksbndig in den Sende-FIFO, bis
+///					dieser voll ist oder alle Daten kopiert wurden, und setzt die Schwelle des
+///					Empfangs-Interrupts auf die Anzahl der gesendeten, noch nicht gelesenen Wrter
+///
+/// @param  SpiInstance *spi, SpiTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiFillFifoTx(SpiInstance *spi, SpiTransaction *transaction)
+{
+		volatile struct SPI_REGS *regs = spi->regs;
+		uint16_t remaining;
+
+		while (   (spi->bufferIndexTx < spi->bytesToTransfer)
+					 &&	(regs->SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
+		{
+				regs->SPITXBUF = transaction->bufferTx
+											 ? (transaction->bufferTx[spi->bufferIndexTx] << spi->shiftTx) : 0;
+				spi->bufferIndexTx++;
+		}
+		// Interrupt auslsen, wenn die restlichen Wrter oder die maximale Anzahl an
+		// Wrtern des FIFO-Empfangspuffers empfangen wurden, je nach dem was kleiner ist
+		remaining = spi->bytesToTransfer - spi->bufferIndexRx;
+		regs->SPIFFRX.bit.RXFFIL = (remaining > SPI_SIZE_HARDWARE_FIFO)
+														 ? SPI_SIZE_HARDWARE_FIFO : remaining;
+}
+
+
+//=== Function: SpiStartTransaction ===============================================================
+///
+/// @brief  Funktion konfiguriert das SPI-Modul fr das Gert der Transaktion, whlt den Slave an
+///					und startet die bertragung
+///
+/// @param  SpiInstance *spi, SpiTransaction *transaction
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiStartTransaction(SpiInstance *spi, SpiTransaction *transaction)
+{
+		spi->queueActive = true;
+		transaction->status = SPI_STATUS_IN_PROGRESS;
+		SpiConfigure(spi, transaction->device);
+		spi->selectSlave(spi->devices[transaction->device].slave);
+		spi->bytesToTransfer = transaction->numberOfWords;
+		spi->bufferIndexTx = 0;
+		spi->bufferIndexRx = 0;
+		SpiFillFifoTx(spi, transaction);
+		spi->regs->SPIFFRX.bit.RXFFINTCLR = 1;
+		spi->regs->SPIFFRX.bit.RXFFIENA = 1;
+}
+
+
+//=== Function: SpiServiceTransaction =============================================================
+///
+/// @brief  Funktion wird von der ISR aufgerufen, solange eine Transaktion der Warteschlange aktiv
+///					ist. Sie liest den Empfangs-FIFO, fllt den Sende-FIFO nach, ruft am Ende der
+///					Transaktion deren Callback-Funktion auf und startet die nchste
+///
+/// @param  SpiInstance *spi
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiServiceTransaction(SpiInstance *spi)
+{
+		volatile struct SPI_REGS *regs = spi->regs;
+		SpiTransaction *transaction = spi->queue[spi->queueTail];
+		uint16_t data;
+
+		while (   (spi->bufferIndexRx < spi->bytesToTransfer)
+					 && (regs->SPIFFRX.bit.RXFFST > 0))
+		{
+				data = regs->SPIRXBUF & spi->maskRx;
+				if (transaction->bufferRx)
+				{
+						transaction->bufferRx[spi->bufferIndexRx] = data;
+				}
+				spi->bufferIndexRx++;
+		}
+
+		if (spi->bufferIndexRx < spi->bytesToTransfer)
+		{
+				SpiFillFifoTx(spi, transaction);
+				return;
+		}
+
+		// Transaktion beendet: Slave abwhlen und aus der Warteschlange entfernen
+		regs->SPIFFRX.bit.RXFFIENA = 0;
+		spi->selectSlave(SPI_SLAVE_NONE);
+		transaction->status = SPI_STATUS_FINISHED;
+		if (++spi->queueTail >= SPI_SIZE_QUEUE)
+		{
+				spi->queueTail = 0;
+		}
+		spi->queueActive = false;
+		if (transaction->callback)
+		{
+				transaction->callback(transaction);
+		}
+		// Nchste Transaktion sofort starten, falls die Callback-Funktion nicht
+		// bereits eine Transaktion (ber "SpiSubmit()") oder das Streaming gestartet hat
+		if (   !spi->queueActive
+				&& !spi->streamActive
+				&& (spi->queueHead != spi->queueTail))
+		{
+				SpiStartTransaction(spi, spi->queue[spi->queueTail]);
+		}
+}
+
+
+//=== Function: SpiServiceISR =====================================================================
+///
+/// @brief	Funktion enthlt den Ablauf der SPI-ISR fr ein Modul und wird von "SpiISRA()" ...
+///					"SpiISRD()" aufgerufen. Sie wird ausgefhrt, sobald die im Register SPIFFRX.bit.RXFFIL
+///					stehende Anzahl an Bytes ber SPI empfangen wurde. Fr den reinen Sendebetrieb knnte
+///					zwar der SPI_TX_INT verwendet werden, aber die Konfiguration des Sende-Interrupts
+///					ist komplizierter als die des Emfangs-Interrupts. Zudem wird der Sende-Interrupt
+///					ausgelst, sobald der TX-Puffer leer ist. Zu diesem Zeitpunkt befindet sich das
+///					letzte zu sendene Byte jedoch noch im Ausgangsregister. Der Interrupt kommt also
+///					zu frh. Aus diesem  Grund und weil beim Senden auch automatisch Daten empfangen
+///					werden, wurde hier die Kommunikation ausschlielich mithilfe des Empfangs-Interrupts
+///					umgesetzt.
+///
+/// @param  SpiInstance *spi
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiServiceISR(SpiInstance *spi)
+{
+		volatile struct SPI_REGS *regs = spi->regs;
+		bool startQueue = false;
+
+		// Transaktion der Warteschlange aktiv. Das Interrupt-Flag wird vor dem Leeren
+		// des FIFOs gelscht, damit es fr die nchste Schwelle bzw. die nchste
+		// Transaktion wieder gesetzt werden kann
+		if (spi->queueActive)
+		{
+		    regs->SPIFFRX.bit.RXFFINTCLR = 1;
+				SpiServiceTransaction(spi);
+				return;
+		}
+
+		// Daten aus dem Empfangs-FIFO in den Software-Puffer kopieren bis die
+		// komplette Anzahl an Bytes empfangen wurde oder der Empfangs-FIFO leer ist
+		while (   (spi->bufferIndexRx < spi->bytesToTransfer)
+					 && (regs->SPIFFRX.bit.RXFFST > 0))
+		{
+				BYTE_BUFFER_SET(spi->bufferRx, spi->bufferIndexRx, regs->SPIRXBUF);
+				spi->bufferIndexRx++;
+		}
+		// Komplette Anzahl an Bytes wurde gesendet/empfangen
+		if (spi->bufferIndexRx == spi->bytesToTransfer)
+		{
+				// Empfangs-FIFO-Interrupt ausschalten
+		    regs->SPIFFRX.bit.RXFFIENA = 0;
+				// Slaves abwhlen
+				spi->selectSlave(SPI_SLAVE_NONE);
+				// Flag setzen um das Ende der bertragung zu signalisieren
+				spi->statusFlag = SPI_STATUS_FINISHED;
+				// Whrend der bertragung eingereihte Transaktionen starten
+				// (erst nach dem Lschen des Interrupt-Flags, siehe unten)
+				startQueue = (spi->queueHead != spi->queueTail);
+		}
+		// Es sollen noch weitere Bytes gesendet/empfangen werden
+		else
+		{
+				// Die nchsten Daten in den Sende-FIO kopieren. Dieser ist Datenbreite*16 Bit gro.
+				// Die Datenbreite kann zwischen 1 und 16 eingestellt werden (siehe S. 3904 Reference
+				// Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die Reihenfolge, in der die Daten
+				// ausgesendet werden ist:
+				// MSB: i = 0
+				// LSB: i = numberOfBytes-1
+				while (   (spi->bufferIndexTx < spi->bytesToTransfer)
+							 &&	(regs->SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
+				{
+						// Daten in den SPI-Hardware-Puffer kopieren. Daten mssen dabei linksbnig sein (S. 3915
+						// Reference Manual TTMS320F2838x, SPRUII0D, Rev. D, July 2022), da nur die Anzahl an Bits
+						// ausgesendet werden, die als Datenlnge festgelegt wurden (SPICHAR + 1). Sobald das erste
+						// Element in den FIFO-Puffer geschrieben wurde, beginnt der Sendevorgang
+						regs->SPITXBUF = (BYTE_BUFFER_GET(spi->bufferTx, spi->bufferIndexTx) << 8);
+						spi->bufferIndexTx++;
+				}
+				// Interrupt auslsen, wenn "bytesToTransfer - bufferIndexRx" Bytes oder
+				// die maximale Anzahl an Bytes des FIFO-Empfangspuffers empfangen wurden, je nach
+				// dem was kleiner ist
+				regs->SPIFFRX.bit.RXFFIL = spi->bytesToTransfer - spi->bufferIndexRx;
+				if ((spi->bytesToTransfer - spi->bufferIndexRx) > SPI_SIZE_HARDWARE_FIFO)
+				{
+						regs->SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
+				}
+		}
+
+    // RX-FIFO Interupt-Flag lschen
+    regs->SPIFFRX.bit.RXFFINTCLR = 1;
+    if (startQueue)
+    {
+    		SpiStartTransaction(spi, spi->queue[spi->queueTail]);
+    }
+}
+
+
+//=== Function: SpiSlaveRestartB ==================================================================
+///
+/// @brief  Funktion startet den Slave-Betrieb am Anfang des ersten Puffers: beide DMA-Kanle
+///					werden angehalten, die FIFOs und das Schieberegister (Soft-Reset) verworfen und die
+///					Kanle neu gestartet. Der Sendekanal wird einmal per Software ausgelst und fllt
+///					den Sende-FIFO mit dem ersten Burst. Nur aufrufen, whrend SPISTEB high ist (zwischen
+///					zwei Frames) oder der Master nicht taktet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SpiSlaveRestartB(void)
+{
+		EALLOW;
+		DmaRegs.CH3.CONTROL.bit.HALT = 1;
+		DmaRegs.CH4.CONTROL.bit.HALT = 1;
+		EDIS;
+
+		// FIFOs und ein evtl. nur teilweise empfangenes Wort verwerfen
+		SpibRegs.SPICCR.bit.SPISWRESET = 0;
+		SpibRegs.SPIFFTX.bit.TXFIFO = 0;
+		SpibRegs.SPIFFRX.bit.RXFIFORESET = 0;
+		SpibRegs.SPIFFTX.bit.TXFIFO = 1;
+		SpibRegs.SPIFFRX.bit.RXFIFORESET = 1;
+		SpibRegs.SPIFFRX.bit.RXFFOVFCLR = 1;
+		SpibRegs.SPICCR.bit.SPISWRESET = 1;
+		spiSlaveFrameCountB = 0;
+
+		EALLOW;
+		// Kanle zurcksetzen, die Adressen werden beim Start aus den Shadow-Registern geladen
+		DmaRegs.CH3.CONTROL.bit.SOFTRESET = 1;
+		DmaRegs.CH4.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH3.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH3.CONTROL.bit.ERRCLR = 1;
+		DmaRegs.CH4.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH4.CONTROL.bit.ERRCLR = 1;
+		// Zuerst den Empfangskanal starten, damit kein Burst verloren geht
+		DmaRegs.CH4.CONTROL.bit.RUN = 1;
+		DmaRegs.CH3.CONTROL.bit.RUN = 1;
+		// Der Trigger des leeren Sende-FIFOs wurde oben gelscht, den ersten Burst
+		// daher per Software auslsen
+		DmaRegs.CH3.CONTROL.bit.PERINTFRC = 1;
+		EDIS;
+}
 
 
 //-------------------------------------------------------------------------------------------------
@@ -43,11 +484,11 @@ uint16_t spiStatusFlagA;
 //-------------------------------------------------------------------------------------------------
 //=== Function: SpiInitA ==========================================================================
 ///
-/// @brief  Funktion initialisiert GPIO 54 (MOSI), GPIO 55 (MISO), GPIO 56 (CLK) und GPIO 58 (SS)
-/// 				als SPI-Pins und das SPI-A Modul als Master mit Taktrate nach bergebenen Funktions-
-///					parameter "clock" und 8 Bit Datenlnge. Der SPI-Interrupt wird eingeschaltet und die
-///					ISR auf die PIE-Vector-Tabelle gesetzt. Die Konfiguration der SPI Module B, C und D
-///					sind analog zu dem hier gezeigten Modul A.
+/// @brief  Funktion initialisiert GPIO 54 (MOSI), GPIO 55 (MISO), GPIO 56 (CLK), GPIO 57 (STE)
+/// 				und GPIO 58 bis 60 (SS) als SPI-Pins und das SPI-A Modul ber "SpiInit()" als Master
+///					mit Taktrate nach bergebenen Funktionsparameter "clock" und 8 Bit Datenlnge. Fr
+///					die SPI Module B, C und D mssen die Pins analog gesetzt und anschlieend "SpiInit()"
+///					mit "spiB", "spiC" bzw. "spiD" aufgerufen werden.
 ///
 /// @param  uint32_t clock
 ///
@@ -63,6 +504,7 @@ void SpiInitA(uint32_t clock)
     GpioCtrlRegs.GPBLOCK.bit.GPIO54  = 0;
     GpioCtrlRegs.GPBLOCK.bit.GPIO55 = 0;
     GpioCtrlRegs.GPBLOCK.bit.GPIO56 = 0;
+    GpioCtrlRegs.GPBLOCK.bit.GPIO57 = 0;
     GpioCtrlRegs.GPBLOCK.bit.GPIO58 = 0;
     // GPIO 54 auf SPI-Funktion setzen (MOSI).
     // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
@@ -88,6 +530,13 @@ void SpiInitA(uint32_t clock)
     GpioCtrlRegs.GPBPUD.bit.GPIO56 = 1;
     // GPIO 56 Asynchroner Eingang (muss fr SPI gesetzt sein)
     GpioCtrlRegs.GPBQSEL2.bit.GPIO56 = 0x03;
+    // GPIO 57 auf SPI-Funktion setzen (SPISTEA, Hardware-Slave-Select)
+    GpioCtrlRegs.GPBGMUX2.bit.GPIO57 = (1 >> 2);
+    GpioCtrlRegs.GPBMUX2.bit.GPIO57  = (1 & 0x03);
+    // GPIO 57 Pull-Up-Widerstand aktivieren (Slave im Ruhezustand abgewhlt)
+    GpioCtrlRegs.GPBPUD.bit.GPIO57 = 0;
+    // GPIO 57 Asynchroner Eingang (muss fr SPI gesetzt sein)
+    GpioCtrlRegs.GPBQSEL2.bit.GPIO57 = 0x03;
     // GPIO 58 auf GPIO-Funktionalitt setzen (SS Slave 1)
     GpioCtrlRegs.GPBGMUX2.bit.GPIO58 = (0 >> 2);
     GpioCtrlRegs.GPBMUX2.bit.GPIO58  = (0 & 0x03);
@@ -106,51 +555,129 @@ void SpiInitA(uint32_t clock)
     GpioDataRegs.GPBSET.bit.GPIO59 = 1;
     // GPIO 59 als Ausgang setzen
     GpioCtrlRegs.GPBDIR.bit.GPIO59 = 1;
+    // GPIO 60 auf GPIO-Funktionalitt setzen (SS Slave 3)
+    GpioCtrlRegs.GPBGMUX2.bit.GPIO60 = (0 >> 2);
+    GpioCtrlRegs.GPBMUX2.bit.GPIO60  = (0 & 0x03);
+    // GPIO 60 Pull-Up-Widerstand deaktivieren
+    GpioCtrlRegs.GPBPUD.bit.GPIO60 = 1;
+    // Zustand von GPIO 60 auf high setzen
+    GpioDataRegs.GPBSET.bit.GPIO60 = 1;
+    // GPIO 60 als Ausgang setzen
+    GpioCtrlRegs.GPBDIR.bit.GPIO60 = 1;
 
+    // ISR des DMA-Streamings (DMA_CH6_INT, Zeile 7, Spalte 6 der Tabelle 3-2). Die
+    // PIE-Freigabe erfolgt erst in "SpiStreamStartA()"
+    DINT;
+    PieVectTable.DMA_CH6_INT = &SpiStreamISRA;
+    IER |= M_INT7;
+    EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+    // SPI-A Modul initialisieren
+    SpiInit(&spiA, clock);
+    spiStreamBufferCountA = 0;
+    spiStreamOverflowA = 0;
+}
+
+
+//=== Function: SpiInit ===========================================================================
+///
+/// @brief  Funktion initialisiert ein SPI-Modul als Master mit Taktrate nach bergebenen
+///					Funktionsparameter "clock" und 8 Bit Datenlnge, schaltet den SPI-Interrupt ein,
+///					setzt die ISR ("SpiISRA()" ... "SpiISRD()") auf die PIE-Vector-Tabelle und setzt den
+///					Zustand des Objekts zurck. Die GPIOs werden nicht verndert, fr SPI-A bernimmt
+///					das "SpiInitA()", fr die brigen Module muss das die aufrufende Stelle tun.
+///
+/// @param  SpiInstance *spi, uint32_t clock
+///
+/// @return void
+///
+//=================================================================================================
+void SpiInit(SpiInstance *spi, uint32_t clock)
+{
+		volatile struct SPI_REGS *regs = spi->regs;
+
+    // Register-Schreibschutz aufheben
+    EALLOW;
 
     // Takt fr das SPI-Modul einschalten und 5 Takte
     // warten, bis der Takt zum Modul durchgestellt ist
     // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    CpuSysRegs.PCLKCR8.bit.SPI_A = 1;
+    if (regs == &SpiaRegs)
+    {
+    		CpuSysRegs.PCLKCR8.bit.SPI_A = 1;
+    }
+    else if (regs == &SpibRegs)
+    {
+    		CpuSysRegs.PCLKCR8.bit.SPI_B = 1;
+    }
+    else if (regs == &SpicRegs)
+    {
+    		CpuSysRegs.PCLKCR8.bit.SPI_C = 1;
+    }
+    else
+    {
+    		CpuSysRegs.PCLKCR8.bit.SPI_D = 1;
+    }
     __asm(" RPT #4 || NOP");
 		// SPI-Modul zum konfigurieren ausschalten
-    SpiaRegs.SPICCR.bit.SPISWRESET = 0;
+    regs->SPICCR.bit.SPISWRESET = 0;
     // Polaritt = 0 (Ruhepegel: CLK = 0)
-    SpiaRegs.SPICCR.bit.CLKPOLARITY = 0;
+    regs->SPICCR.bit.CLKPOLARITY = 0;
     // Phase = 0 (Daten bei der ersten (mit POL = 0 also einer steigenden) Flanke bernehmen)
-    SpiaRegs.SPICTL.bit.CLK_PHASE = 0;
+    regs->SPICTL.bit.CLK_PHASE = 0;
     // 8-Bit Datenlnge
-    SpiaRegs.SPICCR.bit.SPICHAR = 7;
+    regs->SPICCR.bit.SPICHAR = 7;
     // Master-Mode setzen
-    SpiaRegs.SPICTL.bit.MASTER_SLAVE = 1;
+    regs->SPICTL.bit.MASTER_SLAVE = 1;
     // bertragung aktivieren
-    SpiaRegs.SPICTL.bit.TALK = 1;
+    regs->SPICTL.bit.TALK = 1;
     // Taktrate setzen
     // (Low-Speed CLK / clock) - 1
     // Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
-    SpiaRegs.SPIBRR.bit.SPI_BIT_RATE = (50000000 / clock) - 1;
+    regs->SPIBRR.bit.SPI_BIT_RATE = (50000000 / clock) - 1;
     // FIFO-Reset whrend der Konfiguration setzen
-    SpiaRegs.SPIFFTX.bit.TXFIFO = 0;
+    regs->SPIFFTX.bit.TXFIFO = 0;
     // FIFO-Modus einschalten
-    SpiaRegs.SPIFFTX.bit.SPIFFENA = 1;
+    regs->SPIFFTX.bit.SPIFFENA = 1;
     // RX-FIFO Interrupt ausschalten
-    SpiaRegs.SPIFFRX.bit.RXFFIENA = 0;
+    regs->SPIFFRX.bit.RXFFIENA = 0;
     // RX-FIFO Interupt-Flag lschen
-    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1;
+    regs->SPIFFRX.bit.RXFFINTCLR = 1;
     // FIFO-Reset aufheben
-    SpiaRegs.SPIFFTX.bit.TXFIFO = 1;
+    regs->SPIFFTX.bit.TXFIFO = 1;
     // SPI-Modul wieder einschalten
-    SpiaRegs.SPICCR.bit.SPISWRESET = 1;
+    regs->SPICCR.bit.SPISWRESET = 1;
 
     // CPU-Interrupts whrend der Konfiguration global sperren
     DINT;
-    // Interrupt-Service-Routinen fr den SPI-Interrupt an die
-    // entsprechende Stelle (SPIA_RX_INT) der PIE-Vector Table speichern
-    PieVectTable.SPIA_RX_INT = &SpiISRA;
-    // SPIA_RX-Interrupt freischalten (Zeile 6, Spalte 1 der Tabelle 3-2)
+    // Interrupt-Service-Routinen fr den SPI-Interrupt an die entsprechende
+    // Stelle (SPIx_RX_INT) der PIE-Vector Table speichern und freischalten
+    // (Zeile 6, Spalte 1, 3, 9 und 11 der Tabelle 3-2)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    PieCtrlRegs.PIEIER6.bit.INTx1 = 1;
-    // CPU-Interrupt 6 einschalten (Zeile 6 der Tabelle)
+    if (regs == &SpiaRegs)
+    {
+    		PieVectTable.SPIA_RX_INT = &SpiISRA;
+    		PieCtrlRegs.PIEIER6.bit.INTx1 = 1;
+    }
+    else if (regs == &SpibRegs)
+    {
+    		PieVectTable.SPIB_RX_INT = &SpiISRB;
+    		PieCtrlRegs.PIEIER6.bit.INTx3 = 1;
+    }
+    else if (regs == &SpicRegs)
+    {
+    		PieVectTable.SPIC_RX_INT = &SpiISRC;
+    		PieCtrlRegs.PIEIER6.bit.INTx9 = 1;
+    }
+    else
+    {
+    		PieVectTable.SPID_RX_INT = &SpiISRD;
+    		PieCtrlRegs.PIEIER6.bit.INTx11 = 1;
+    }
+    // CPU-Interrupt 6 einschalten (Zeile 6 der Tabelle, alle SPI-Module)
     IER |= M_INT6;
     // CPU-Interrupts nach Konfiguration global wieder freigeben
     EINT;
@@ -159,54 +686,84 @@ void SpiInitA(uint32_t clock)
 		EDIS;
 
     // Steuervariablen initialisieren
-    SpiInitBufferRxA();
-    SpiInitBufferTxA();
-    spiBufferIndexTxA = 0;
-    spiBufferIndexRxA = 0;
-    spiBytesToTransferA = 0;
-    spiStatusFlagA = SPI_STATUS_IDLE;
+    SpiInitBufferRx(spi);
+    SpiInitBufferTx(spi);
+    spi->bufferIndexTx = 0;
+    spi->bufferIndexRx = 0;
+    spi->bytesToTransfer = 0;
+    spi->statusFlag = SPI_STATUS_IDLE;
+    // Warteschlange initialisieren. Die Einstellungen aus "SpiInit()" gelten
+    // bis zur ersten Transaktion der Warteschlange
+    spi->queueHead = 0;
+    spi->queueTail = 0;
+    spi->queueActive = false;
+    spi->streamActive = false;
+    spi->bitRateInit = regs->SPIBRR.bit.SPI_BIT_RATE;
+    spi->configuredDevice = SPI_DEVICE_INIT;
+    spi->shiftTx = 8;
+    spi->maskRx = 0x00FF;
 }
 
 
-//=== Function: SpiInitBufferTxA ==================================================================
+//=== Function: SpiAttachDevices ==================================================================
 ///
-/// @brief	Funktion setzte alle Elemente des Sende-Software-Puffers "spiBufferTxA[]" zu 0
+/// @brief  Funktion ordnet einem SPI-Bus seine Gerteliste und die Funktion fr den Slave-Select zu
+///					(z.B. fr SPI-B bis SPI-D, SPI-A nutzt "spiDevices[]"). Die Funktion "selectSlave"
+///					muss alle Slaves abwhlen und anschlieend den bergebenen Slave anwhlen
+///					(SPI_SLAVE_NONE: nur abwhlen). Sie darf nur aufgerufen werden, whrend auf dem Bus
+///					keine Kommunikation aktiv ist.
 ///
-/// @param	void
+/// @param  SpiInstance *spi, const SpiDevice *devices, uint16_t numberOfDevices,
+///					void (*selectSlave)(uint16_t slave)
 ///
 /// @return void
 ///
 //=================================================================================================
-void SpiInitBufferTxA(void)
+void SpiAttachDevices(SpiInstance *spi,
+											const SpiDevice *devices,
+											uint16_t numberOfDevices,
+											void (*selectSlave)(uint16_t slave))
+{
+		spi->devices = devices;
+		spi->numberOfDevices = numberOfDevices;
+		spi->selectSlave = selectSlave ? selectSlave : SpiSelectSlaveNone;
+		spi->configuredDevice = SPI_DEVICE_INIT;
+}
+
+
+//=== Function: SpiInitBufferTx ===================================================================
+///
+/// @brief	Funktion setzte alle Elemente des Sende-Software-Puffers eines Moduls zu 0
+///
+/// @param	SpiInstance *spi
+///
+/// @return void
+///
+//=================================================================================================
+void SpiInitBufferTx(SpiInstance *spi)
 {
 		// Alle Elemente zu 0 setzen
-		for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
-		{
-				spiBufferTxA[i] = 0;
-		}
+		ByteBufferClear(spi->bufferTx, SPI_SIZE_SOFTWARE_BUFFER);
 }
 
 
-//=== Function: SpiInitBufferRxA ==================================================================
+//=== Function: SpiInitBufferRx ===================================================================
 ///
-/// @brief	Funktion setzte alle Elemente des Empfangs-Software-Puffers "spiBufferRxA[]" zu 0
+/// @brief	Funktion setzte alle Elemente des Empfangs-Software-Puffers eines Moduls zu 0
 ///
-/// @param	void
+/// @param	SpiInstance *spi
 ///
 /// @return void
 ///
 //=================================================================================================
-void SpiInitBufferRxA(void)
+void SpiInitBufferRx(SpiInstance *spi)
 {
 		// Alle Elemente zu 0 setzen
-		for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
-		{
-				spiBufferRxA[i] = 0;
-		}
+		ByteBufferClear(spi->bufferRx, SPI_SIZE_SOFTWARE_BUFFER);
 }
 
 
-//=== Function: SpiGetStatusA =====================================================================
+//=== Function: SpiGetStatus ======================================================================
 ///
 /// @brief	Funktion gibt den aktuellen Status der SPI-Kommunikation zurck. Die SPI-
 ///					Kommunikation ist Interrupt-basiert und kann folgende Zustnde annehmen:
@@ -215,95 +772,94 @@ void SpiInitBufferRxA(void)
 ///					- SPI_STATUS_IN_PROGRESS: Es wurde eine Kommunikation gestartet
 ///					- SPI_STATUS_FINISHED   : Eine Kommunikation ist abgeschlossen
 ///
-///					Zum starten einer Kommunikation muss die Funktion "SpiSendDataA()"
+///					Zum starten einer Kommunikation muss die Funktion "SpiSendData()"
 ///					aufgerufen werden
 ///
-/// @param 	uint16_t spiStatusFlag
+/// @param 	SpiInstance *spi
 ///
-/// @return void
+/// @return uint16_t statusFlag
 ///
 //=================================================================================================
-extern uint16_t SpiGetStatusA(void)
+uint16_t SpiGetStatus(SpiInstance *spi)
 {
-		return spiStatusFlagA;
+		return spi->statusFlag;
 }
 
 
-//=== Function: SpiSetStatusIdleA =================================================================
+//=== Function: SpiSetStatusIdle ==================================================================
 ///
 /// @brief	Funktion setzt das Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
 ///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
 ///					verndert und es wird "false" zurck gegeben.
 ///
-/// @param	void
+/// @param	SpiInstance *spi
 ///
 /// @return bool flagSetToIdle
 ///
 //=================================================================================================
-extern bool SpiSetStatusIdleA(void)
+bool SpiSetStatusIdle(SpiInstance *spi)
 {
 		bool flagSetToIdle = false;
 		// Staus-Flag nur auf "idle" setzen, falls eine
 		// vorherige Kommunikation abgeschlossen ist
-		if (spiStatusFlagA == SPI_STATUS_FINISHED)
+		if (spi->statusFlag == SPI_STATUS_FINISHED)
 		{
-				spiStatusFlagA = SPI_STATUS_IDLE;
+				spi->statusFlag = SPI_STATUS_IDLE;
 				flagSetToIdle = true;
 		}
 		return flagSetToIdle;
 }
 
 
-//=== Function: SpiSendDataA ======================================================================
+//=== Function: SpiSendData =======================================================================
 ///
 /// @brief  Funktion sendet Daten ber SPI. Der Parameter "slave" gibt an, welche SS-Leitung
 ///					aktiviert werden soll. Nach dem letzten gesendeten Byte (numberOfBytes), wird ein
 ///					Interrupt ausgelst um die empfangenen Daten auslesen zu knnen. Sollen Bytes nur
 ///				  empfangen werden (Slave abfragen), so wird die Byte-Anzahl ber den Parameter
-///					"numberOfBytes" bergeben und das Array "spiBufferTxA" mit Dummy-Daten gefllt.
+///					"numberOfBytes" bergeben und der Sende-Puffer des Moduls (z.B. "spiBufferTxA[]") mit
+///					Dummy-Daten gefllt.
 ///
-/// @param  uint16_t slave, uint16_t numberOfBytes
+/// @param  SpiInstance *spi, uint16_t slave, uint16_t numberOfBytes
 ///
 /// @return bool operationPerformed
 ///
 //=================================================================================================
-bool SpiSendDataA(uint16_t slave,
-									uint16_t numberOfBytes)
+bool SpiSendData(SpiInstance *spi,
+								 uint16_t slave,
+								 uint16_t numberOfBytes)
 {
 		// Ergebnis des Funktionsaufrufes (Kommunikation gestartet / nicht gestartet)
 		bool operationPerformed = false;
+		volatile struct SPI_REGS *regs = spi->regs;
 		// Vorgang nur starten falls keine vorherige Kommunikation aktiv
 		// ist und die Anzahl der zu sendenen / empfangenen Bytes die
 		// Gre der Software-Puffer nicht berschreitet und mindestens 1 ist
-		if (   (spiStatusFlagA != SPI_STATUS_IN_PROGRESS)
+		if (   (spi->statusFlag != SPI_STATUS_IN_PROGRESS)
+				&& !spi->queueActive
+				&& !spi->streamActive
 				&& (numberOfBytes <= SPI_SIZE_SOFTWARE_BUFFER)
 				&&  numberOfBytes)
 		{
+				// Einstellungen aus "SpiInit()" wiederherstellen, falls die
+				// Warteschlange das Modul fr ein anderes Gert konfiguriert hat
+				SpiConfigure(spi, SPI_DEVICE_INIT);
 				// Slave auswhlen
-				if (slave == SPI_SLAVE_1)
-				{
-						SPI_DISABLE_SLAVE_2;
-						SPI_ENABLE_SLAVE_1;
-				}
-				else if (slave == SPI_SLAVE_2)
-				{
-						SPI_DISABLE_SLAVE_1;
-						SPI_ENABLE_SLAVE_2;
-				}
+				spi->selectSlave(slave);
 				// Ggf. kurz warten, bis der Slave bereit ist
 				//DELAY_US(1);
 				// Flag setzen um der aufrufenden Stelle zu signalisieren,
 				// dass die SPI-Kommunikation gestartet wurde
-				spiStatusFlagA = SPI_STATUS_IN_PROGRESS;
+				spi->statusFlag = SPI_STATUS_IN_PROGRESS;
 				// Anzahl der zu sendenen Bytes an die Steuervariable bergeben.
 				// Diese koordiniert die restliche Kommunikation in der ISR
-				spiBytesToTransferA = numberOfBytes;
+				spi->bytesToTransfer = numberOfBytes;
 				// Indexe zur Verwaltung der Software-Puffer auf das erste Element
 				// setzen, damit die zu sendenen Daten vom Anfang des Sende-Puffers
 				// kopiert bzw. die empfangenen Daten an den Anfang des Empfangs-
 				// Puffers geschrieben werden
-				spiBufferIndexTxA = 0;
-				spiBufferIndexRxA = 0;
+				spi->bufferIndexTx = 0;
+				spi->bufferIndexRx = 0;
 				// Zu sendene Daten von dem Software-Puffer in den SPI Sende-FIFO kopieren bis dieser
 				// gefllt ist oder der Software-Puffer leer ist. Dieser ist Datenbreite*16 Bit gro.
 				// Die Datenbreite kann zwischen 1 und 16 eingestellt werden (siehe S. 3904 Reference
@@ -311,42 +867,578 @@ bool SpiSendDataA(uint16_t slave,
 		    // ausgesendet werden ist:
 				// MSB: i = 0
 				// LSB: i = numberOfBytes-1
-				while (   (spiBufferIndexTxA < spiBytesToTransferA)
-							 &&	(SpiaRegs.SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
+				while (   (spi->bufferIndexTx < spi->bytesToTransfer)
+							 &&	(regs->SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
 				{
 						// Daten in den SPI-Hardware-Puffer kopieren. Daten mssen dabei linksbnig sein (S. 3915
 						// Reference Manual TTMS320F2838x, SPRUII0D, Rev. D, July 2022), da nur die Anzahl an Bits
 						// ausgesendet werden, die als Datenlnge festgelegt wurden (SPICHAR + 1). Sobald das erste
 						// Element in den FIFO-Puffer geschrieben wurde, beginnt der Sendevorgang
-						SpiaRegs.SPITXBUF = (spiBufferTxA[spiBufferIndexTxA] << 8);
-						spiBufferIndexTxA++;
+						regs->SPITXBUF = (BYTE_BUFFER_GET(spi->bufferTx, spi->bufferIndexTx) << 8);
+						spi->bufferIndexTx++;
 				}
 				// Interrupt auslsen, wenn "numberOfBytes" Bytes oder die maximale
 				// Anzahl an Bytes des FIFO-Empfangspuffers empfangen wurden, je nach
 				// dem was kleiner ist
-				SpiaRegs.SPIFFRX.bit.RXFFIL = spiBytesToTransferA;
-				if (spiBytesToTransferA > SPI_SIZE_HARDWARE_FIFO)
+				regs->SPIFFRX.bit.RXFFIL = spi->bytesToTransfer;
+				if (spi->bytesToTransfer > SPI_SIZE_HARDWARE_FIFO)
 				{
-						SpiaRegs.SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
+						regs->SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
 				}
 				// RX-FIFO Interrupt einschalten
-				SpiaRegs.SPIFFRX.bit.RXFFIENA = 1;
+				regs->SPIFFRX.bit.RXFFIENA = 1;
+				operationPerformed = true;
 		}
 		return operationPerformed;
 }
 
 
+//=== Function: SpiSubmit =========================================================================
+///
+/// @brief  Funktion reiht eine Transaktion in die Warteschlange ein. Ist keine andere
+///					Kommunikation aktiv, wird sie sofort gestartet, andernfalls startet sie die ISR
+///					direkt nach dem Ende der vorherigen Kommunikation. Der Rckgabewert ist
+///					SPI_SUBMIT_STARTED bzw. SPI_SUBMIT_QUEUED, falls die Transaktion angenommen wurde,
+///					SPI_SUBMIT_BUSY, falls die Warteschlange voll ist, und SPI_SUBMIT_INVALID, falls
+///					das Gert auf diesem Bus unbekannt oder die Anzahl der Wrter 0 ist. Alle SPI-
+///					Interrupts liegen in der PIE-Gruppe 6, das Sperren von M_INT6 schtzt also jedes
+///					Modul.
+///
+/// @param  SpiInstance *spi, SpiTransaction *transaction
+///
+/// @return uint16_t result
+///
+//=================================================================================================
+uint16_t SpiSubmit(SpiInstance *spi, SpiTransaction *transaction)
+{
+		uint16_t result = SPI_SUBMIT_INVALID;
+		uint16_t head;
+		uint16_t savedIER;
+
+		if (   (transaction->device < spi->numberOfDevices)
+				&&  transaction->numberOfWords)
+		{
+				// SPI-Interrupt sperren, da die ISR die Warteschlange ebenfalls verndert
+				savedIER = IER;
+				IER &= ~M_INT6;
+
+				head = spi->queueHead + 1;
+				if (head >= SPI_SIZE_QUEUE)
+				{
+						head = 0;
+				}
+				// Warteschlange nicht voll
+				if (head != spi->queueTail)
+				{
+						transaction->status = SPI_STATUS_QUEUED;
+						spi->queue[spi->queueHead] = transaction;
+						spi->queueHead = head;
+						result = SPI_SUBMIT_QUEUED;
+						// Keine Kommunikation aktiv: Transaktion sofort starten
+						if (   !spi->queueActive
+								&& !spi->streamActive
+								&& (spi->statusFlag != SPI_STATUS_IN_PROGRESS))
+						{
+								SpiStartTransaction(spi, spi->queue[spi->queueTail]);
+								result = SPI_SUBMIT_STARTED;
+						}
+				}
+				else
+				{
+						result = SPI_SUBMIT_BUSY;
+				}
+
+				IER = savedIER;
+		}
+		return result;
+}
+
+
+//=== Function: SpiGetQueueCount ==================================================================
+///
+/// @brief  Funktion gibt die Anzahl der eingereihten Transaktionen inkl. der gerade aktiven
+///					zurck (maximal SPI_SIZE_QUEUE - 1)
+///
+/// @param  SpiInstance *spi
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+uint16_t SpiGetQueueCount(SpiInstance *spi)
+{
+		uint16_t head = spi->queueHead;
+		uint16_t tail = spi->queueTail;
+
+		return (head >= tail) ? (head - tail) : (head + SPI_SIZE_QUEUE - tail);
+}
+
+
+//=== Function: SpiStreamPrepareTxA ===============================================================
+///
+/// @brief  Funktion schreibt die rechtsbndigen Sendedaten des Streamings fr ein Gert
+///					linksbndig in "spiStreamTxA[]", sodass der DMA sie ohne weitere Bearbeitung in den
+///					Sende-FIFO kopieren kann. Die Daten sind Frame fr Frame hintereinander abgelegt.
+///					Der Rckgabewert ist "false", falls das Gert unbekannt ist oder die Daten nicht in
+///					den Puffer passen. Whrend des Streamings darf der Puffer verndert werden, der
+///					nchste Durchlauf des DMA sendet dann die neuen Daten.
+///
+/// @param  uint16_t device, const uint16_t *data, uint16_t numberOfWords
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool SpiStreamPrepareTxA(uint16_t device,
+												 const uint16_t *data,
+												 uint16_t numberOfWords)
+{
+		uint16_t shift;
+
+		if (   (device >= SPI_NUMBER_OF_DEVICES)
+				|| (numberOfWords > SPI_STREAM_SIZE_BUFFER))
+		{
+				return false;
+		}
+		shift = 16 - spiDevices[device].charLength;
+		for (uint16_t i=0; i<numberOfWords; i++)
+		{
+				spiStreamTxA[i] = data[i] << shift;
+		}
+		return true;
+}
+
+
+//=== Function: SpiStreamStartA ===================================================================
+///
+/// @brief  Funktion startet das DMA-Streaming mit einem Gert. Jeder Trigger (ePWM-SOC oder
+///					CPU-Timer, SPI_STREAM_TRIGGER_...) sendet einen Frame aus "wordsPerFrame" Wrtern
+///					aus "spiStreamTxA[]" (DMA CH5). Sobald der Frame vollstndig empfangen wurde, kopiert
+///					DMA CH6 ihn nach "spiStreamRxA[]". Nach "numberOfFrames" Frames beginnen beide Kanle
+///					wieder am Anfang der Puffer und "SpiStreamISRA()" erhht "spiStreamBufferCountA".
+///					Die Trigger-Quelle (z.B. ETSEL.SOCAEN oder TCR.TIE) muss von der aufrufenden Stelle
+///					konfiguriert werden, der Abstand zweier Trigger muss lnger als ein Frame sein.
+///					Der Rckgabewert ist "false", falls eine andere Kommunikation aktiv ist oder die
+///					Parameter ungltig sind (maximal 16 Wrter pro Frame, Puffergre).
+///
+/// @param  uint16_t device, uint16_t trigger, uint16_t wordsPerFrame, uint16_t numberOfFrames
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool SpiStreamStartA(uint16_t device,
+										 uint16_t trigger,
+										 uint16_t wordsPerFrame,
+										 uint16_t numberOfFrames)
+{
+		uint16_t savedIER;
+
+		if (   (device >= SPI_NUMBER_OF_DEVICES)
+				|| !wordsPerFrame
+				|| (wordsPerFrame > SPI_SIZE_HARDWARE_FIFO)
+				|| !numberOfFrames
+				|| ((uint32_t)wordsPerFrame * numberOfFrames > SPI_STREAM_SIZE_BUFFER))
+		{
+				return false;
+		}
+
+		// SPI-Interrupt sperren, damit die ISR keine Transaktion der Warteschlange startet
+		savedIER = IER;
+		IER &= ~M_INT6;
+		if (   spiA.queueActive
+				|| spiA.streamActive
+				|| (spiA.statusFlag == SPI_STATUS_IN_PROGRESS))
+		{
+				IER = savedIER;
+				return false;
+		}
+		spiA.streamActive = true;
+		IER = savedIER;
+
+		SpiConfigure(&spiA, device);
+		spiA.selectSlave(spiDevices[device].slave);
+		// Der DMA liest einen Frame, sobald er vollstndig im Empfangs-FIFO steht.
+		// Der SPI-Interrupt bleibt ausgeschaltet, der DMA-Trigger ist davon unabhngig
+		SpiaRegs.SPIFFRX.bit.RXFFIENA = 0;
+		SpiaRegs.SPIFFRX.bit.RXFFIL = wordsPerFrame;
+		SpiaRegs.SPIFFRX.bit.RXFFOVFCLR = 1;
+		spiStreamBufferCountA = 0;
+
+		EALLOW;
+		// Takt fr den DMA einschalten und den DMA als zweiten Master der Peripherie-
+		// Frame 2 (SPI) auswhlen (sonst ist es der CLA)
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		CpuSysRegs.SECMSEL.bit.PF2SEL = 1;
+		// DMA luft weiter, wenn der Debugger die CPU anhlt
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// DMA CH5: pro Trigger ein Frame (Burst) aus "spiStreamTxA[]" in den Sende-FIFO,
+		// nach "numberOfFrames" Frames (Transfer) wieder von vorn
+		DmaRegs.CH5.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH5.SRC_BEG_ADDR_SHADOW = (uint32_t)&spiStreamTxA[0];
+		DmaRegs.CH5.SRC_ADDR_SHADOW     = (uint32_t)&spiStreamTxA[0];
+		DmaRegs.CH5.DST_BEG_ADDR_SHADOW = (uint32_t)&SpiaRegs.SPITXBUF;
+		DmaRegs.CH5.DST_ADDR_SHADOW     = (uint32_t)&SpiaRegs.SPITXBUF;
+		DmaRegs.CH5.BURST_SIZE.bit.BURSTSIZE = wordsPerFrame - 1;
+		DmaRegs.CH5.SRC_BURST_STEP = 1;
+		DmaRegs.CH5.DST_BURST_STEP = 0;
+		DmaRegs.CH5.TRANSFER_SIZE = numberOfFrames - 1;
+		DmaRegs.CH5.SRC_TRANSFER_STEP = 1;
+		DmaRegs.CH5.DST_TRANSFER_STEP = 0;
+		// Kein Wrap (Wrap-Gre grer als jeder mgliche Transfer)
+		DmaRegs.CH5.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH5.SRC_WRAP_STEP = 0;
+		DmaRegs.CH5.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH5.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5 = trigger;
+		DmaRegs.CH5.MODE.bit.PERINTSEL = 5;
+		DmaRegs.CH5.MODE.bit.PERINTE = 1;
+		DmaRegs.CH5.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH5.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH5.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH5.MODE.bit.DATASIZE = 0;
+		DmaRegs.CH5.MODE.bit.CHINTE = 0;
+		DmaRegs.CH5.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH5.CONTROL.bit.ERRCLR = 1;
+
+		// DMA CH6: pro vollstndig empfangenem Frame (SPIARX) ein Burst aus dem
+		// Empfangs-FIFO nach "spiStreamRxA[]", Interrupt am Ende jedes Transfers
+		DmaRegs.CH6.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH6.SRC_BEG_ADDR_SHADOW = (uint32_t)&SpiaRegs.SPIRXBUF;
+		DmaRegs.CH6.SRC_ADDR_SHADOW     = (uint32_t)&SpiaRegs.SPIRXBUF;
+		DmaRegs.CH6.DST_BEG_ADDR_SHADOW = (uint32_t)&spiStreamRxA[0];
+		DmaRegs.CH6.DST_ADDR_SHADOW     = (uint32_t)&spiStreamRxA[0];
+		DmaRegs.CH6.BURST_SIZE.bit.BURSTSIZE = wordsPerFrame - 1;
+		DmaRegs.CH6.SRC_BURST_STEP = 0;
+		DmaRegs.CH6.DST_BURST_STEP = 1;
+		DmaRegs.CH6.TRANSFER_SIZE = numberOfFrames - 1;
+		DmaRegs.CH6.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH6.DST_TRANSFER_STEP = 1;
+		DmaRegs.CH6.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.SRC_WRAP_STEP = 0;
+		DmaRegs.CH6.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6 = SPI_STREAM_TRIGGER_SPIARX;
+		DmaRegs.CH6.MODE.bit.PERINTSEL = 6;
+		DmaRegs.CH6.MODE.bit.PERINTE = 1;
+		DmaRegs.CH6.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH6.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH6.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH6.MODE.bit.DATASIZE = 0;
+		// Interrupt am Ende des Transfers (ein vollstndiger Puffer)
+		DmaRegs.CH6.MODE.bit.CHINTMODE = 1;
+		DmaRegs.CH6.MODE.bit.CHINTE = 1;
+		DmaRegs.CH6.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH6.CONTROL.bit.ERRCLR = 1;
+
+		// Interrupt am Ende jedes Puffers freischalten (Vektor siehe "SpiInitA()")
+		PieCtrlRegs.PIEIER7.bit.INTx6 = 1;
+
+		// Zuerst den Empfangskanal starten, damit kein Frame verloren geht
+		DmaRegs.CH6.CONTROL.bit.RUN = 1;
+		DmaRegs.CH5.CONTROL.bit.RUN = 1;
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: SpiStreamStopA ====================================================================
+///
+/// @brief  Funktion hlt beide DMA-Kanle an, verwirft einen evtl. nur teilweise bertragenen
+///					Frame (FIFO-Reset) und startet ggf. die whrend des Streamings eingereihten
+///					Transaktionen der Warteschlange. Die Trigger-Quelle wird nicht verndert.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiStreamStopA(void)
+{
+		uint16_t savedIER;
+
+		if (!spiA.streamActive)
+		{
+				return;
+		}
+
+		EALLOW;
+		DmaRegs.CH5.CONTROL.bit.HALT = 1;
+		DmaRegs.CH6.CONTROL.bit.HALT = 1;
+		PieCtrlRegs.PIEIER7.bit.INTx6 = 0;
+		EDIS;
+
+		// Auf das Ende des gerade gesendeten Wortes warten und beide FIFOs leeren
+		while (SpiaRegs.SPIFFTX.bit.TXFFST > 0);
+		DELAY_US(20);
+		SpiaRegs.SPIFFTX.bit.TXFIFO = 0;
+		SpiaRegs.SPIFFRX.bit.RXFIFORESET = 0;
+		SpiaRegs.SPIFFTX.bit.TXFIFO = 1;
+		SpiaRegs.SPIFFRX.bit.RXFIFORESET = 1;
+		spiA.selectSlave(SPI_SLAVE_NONE);
+
+		savedIER = IER;
+		IER &= ~M_INT6;
+		spiA.streamActive = false;
+		if (spiA.queueHead != spiA.queueTail)
+		{
+				SpiStartTransaction(&spiA, spiA.queue[spiA.queueTail]);
+		}
+		IER = savedIER;
+}
+
+
+//=== Function: SpiSlaveInitB =====================================================================
+///
+/// @brief  Funktion initialisiert GPIO 63 (SIMO), GPIO 64 (SOMI), GPIO 65 (CLK) und GPIO 66 (STE)
+///					als SPI-B Pins fr den Slave-Betrieb, schaltet den Takt von SPI-B und des DMA ein und
+///					trgt "SpiSlaveFrameISRB()" fr XINT2 ein. SPISTEB wird zustzlich ber die
+///					Input-X-Bar an XINT2 gefhrt (steigende Flanke = Ende eines Frames). Der Interrupt
+///					wird erst in "SpiSlaveStartB()" freigeschaltet. SPI-B kann danach nicht mehr als
+///					Master verwendet werden.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiSlaveInitB(void)
+{
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+    // GPIO-Sperre fr GPIO 63 bis 66 aufheben
+    GpioCtrlRegs.GPBLOCK.bit.GPIO63 = 0;
+    GpioCtrlRegs.GPCLOCK.bit.GPIO64 = 0;
+    GpioCtrlRegs.GPCLOCK.bit.GPIO65 = 0;
+    GpioCtrlRegs.GPCLOCK.bit.GPIO66 = 0;
+    // GPIO 63 auf SPI-Funktion setzen (SIMO, Eingang im Slave-Betrieb).
+    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
+    // GPxGMUX (MSB, 2 Bit) + GPxMUX (LSB, 2 Bit) als Dezimalzahl an
+    // (siehe S. 1647 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    GpioCtrlRegs.GPBGMUX2.bit.GPIO63 = (15 >> 2);
+    GpioCtrlRegs.GPBMUX2.bit.GPIO63  = (15 & 0x03);
+    GpioCtrlRegs.GPBPUD.bit.GPIO63 = 1;
+    GpioCtrlRegs.GPBQSEL2.bit.GPIO63 = 0x03;
+    // GPIO 64 auf SPI-Funktion setzen (SOMI, hochohmig solange SPISTEB high ist)
+    GpioCtrlRegs.GPCGMUX1.bit.GPIO64 = (15 >> 2);
+    GpioCtrlRegs.GPCMUX1.bit.GPIO64  = (15 & 0x03);
+    GpioCtrlRegs.GPCPUD.bit.GPIO64 = 1;
+    GpioCtrlRegs.GPCQSEL1.bit.GPIO64 = 0x03;
+    // GPIO 65 auf SPI-Funktion setzen (CLK vom Master)
+    GpioCtrlRegs.GPCGMUX1.bit.GPIO65 = (15 >> 2);
+    GpioCtrlRegs.GPCMUX1.bit.GPIO65  = (15 & 0x03);
+    GpioCtrlRegs.GPCPUD.bit.GPIO65 = 1;
+    GpioCtrlRegs.GPCQSEL1.bit.GPIO65 = 0x03;
+    // GPIO 66 auf SPI-Funktion setzen (SPISTEB vom Master)
+    // Pull-Up-Widerstand aktivieren (ohne Master abgewhlt)
+    GpioCtrlRegs.GPCGMUX1.bit.GPIO66 = (15 >> 2);
+    GpioCtrlRegs.GPCMUX1.bit.GPIO66  = (15 & 0x03);
+    GpioCtrlRegs.GPCPUD.bit.GPIO66 = 0;
+    GpioCtrlRegs.GPCQSEL1.bit.GPIO66 = 0x03;
+    // GPIO 66 zustzlich als Pin fr den externen Interrupt XINT2 setzen
+    // (Input-X-Bar INPUT5, siehe S. 2142 Reference Manual TMS320F2838x, SPRUII0D, Rev. D,
+    // July 2022). Steigende Flanke: der Master hat den Slave abgewhlt
+    InputXbarRegs.INPUT5SELECT = 66;
+    XintRegs.XINT2CR.bit.POLARITY = 1;
+    XintRegs.XINT2CR.bit.ENABLE = 0;
+
+    // Takt fr SPI-B und den DMA einschalten
+    CpuSysRegs.PCLKCR8.bit.SPI_B = 1;
+    CpuSysRegs.PCLKCR0.bit.DMA = 1;
+    __asm(" RPT #4 || NOP");
+    // SPI-Modul als Slave konfigurieren, bleibt bis "SpiSlaveStartB()" im Soft-Reset
+    SpibRegs.SPICCR.bit.SPISWRESET = 0;
+    SpibRegs.SPICTL.bit.MASTER_SLAVE = 0;
+    SpibRegs.SPICTL.bit.SPIINTENA = 0;
+    SpibRegs.SPIFFTX.bit.SPIFFENA = 1;
+    SpibRegs.SPIFFTX.bit.TXFFIENA = 0;
+    SpibRegs.SPIFFRX.bit.RXFFIENA = 0;
+
+    // ISR am Ende jedes Frames (XINT2_INT, Zeile 1, Spalte 5 der Tabelle 3-2)
+    DINT;
+    PieVectTable.XINT2_INT = &SpiSlaveFrameISRB;
+    IER |= M_INT1;
+    EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		spiSlaveFrameCountB = 0;
+		spiSlaveResyncCountB = 0;
+}
+
+
+//=== Function: SpiSlaveStartB ====================================================================
+///
+/// @brief  Funktion startet den Slave-Betrieb von SPI-B. Der Master whlt den Slave pro Frame
+///					einmal an (SPISTEB low) und taktet genau "wordsPerFrame" 16-Bit-Wrter (Vielfaches von
+///					SPI_SLAVE_BURST_WORDS, SPI_SLAVE_MIN_FRAME_WORDS ... SPI_SLAVE_MAX_FRAME_WORDS) mit
+///					hchstens SPI_SLAVE_MAX_CLOCK. Zwischen zwei Frames muss SPISTEB high sein.
+///					DMA CH3 kopiert die Wrter von Frame k aus "spiSlaveTxB[k % 2]" in den Sende-FIFO und
+///					DMA CH4 die empfangenen Wrter nach "spiSlaveRxB[k % 2]", beide Kanle wechseln ohne
+///					CPU zwischen den beiden Puffern. Am Ende jedes Frames ruft "SpiSlaveFrameISRB()" die
+///					Callback-Funktion (darf 0 sein) mit dem empfangenen Frame und dem nun freien
+///					Sendepuffer auf, dessen Inhalt zwei Frames spter gesendet wird. Beide Sendepuffer
+///					mssen vor dem Start beschrieben sein. Der Rckgabewert ist "false", falls SPI-B als
+///					Master verwendet wird oder die Parameter ungltig sind.
+///
+/// @param  uint16_t polarity, uint16_t phase, uint16_t wordsPerFrame,
+///					void (*callback)(const uint16_t *rxFrame, uint16_t *txFrame)
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool SpiSlaveStartB(uint16_t polarity,
+										uint16_t phase,
+										uint16_t wordsPerFrame,
+										void (*callback)(const uint16_t *rxFrame, uint16_t *txFrame))
+{
+		uint16_t burstsPerFrame = wordsPerFrame / SPI_SLAVE_BURST_WORDS;
+
+		if (   (wordsPerFrame < SPI_SLAVE_MIN_FRAME_WORDS)
+				|| (wordsPerFrame > SPI_SLAVE_MAX_FRAME_WORDS)
+				|| (wordsPerFrame % SPI_SLAVE_BURST_WORDS)
+				|| spiB.streamActive
+				|| spiB.queueActive
+				|| (spiB.statusFlag == SPI_STATUS_IN_PROGRESS))
+		{
+				return false;
+		}
+		spiB.streamActive = true;
+		spiSlaveWordsPerFrameB = wordsPerFrame;
+		spiSlaveCallbackB = callback;
+		spiSlaveResyncCountB = 0;
+
+		// SPI-Modul fr das Format des Masters konfigurieren. High-Speed-Modus
+		// (nur an den High-Speed-Pins GPIO 63 bis 66 zulssig)
+		SpibRegs.SPICCR.bit.SPISWRESET = 0;
+		SpibRegs.SPICCR.bit.CLKPOLARITY = polarity;
+		SpibRegs.SPICTL.bit.CLK_PHASE = phase;
+		SpibRegs.SPICCR.bit.SPICHAR = SPI_SLAVE_CHAR_LENGTH - 1;
+		SpibRegs.SPICCR.bit.HS_MODE = 1;
+		SpibRegs.SPICTL.bit.MASTER_SLAVE = 0;
+		SpibRegs.SPICTL.bit.TALK = 1;
+		// DMA-Trigger der FIFOs (der CPU-Interrupt bleibt ausgeschaltet)
+		SpibRegs.SPIFFTX.bit.TXFFIL = SPI_SLAVE_TX_FIFO_LEVEL;
+		SpibRegs.SPIFFRX.bit.RXFFIL = SPI_SLAVE_BURST_WORDS;
+		SpibRegs.SPIFFTX.bit.TXFFIENA = 0;
+		SpibRegs.SPIFFRX.bit.RXFFIENA = 0;
+
+		EALLOW;
+		// DMA als zweiten Master der Peripherie-Frame 2 (SPI) auswhlen
+		CpuSysRegs.SECMSEL.bit.PF2SEL = 1;
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// DMA CH3: pro Trigger ein Burst aus dem aktuellen Sendepuffer in den Sende-FIFO. Nach
+		// "burstsPerFrame" Bursts springt die Quelle auf den zweiten Puffer (Wrap), nach zwei
+		// Frames (Transfer) wieder auf den ersten
+		DmaRegs.CH3.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH3.SRC_BEG_ADDR_SHADOW = (uint32_t)&spiSlaveTxB[0][0];
+		DmaRegs.CH3.SRC_ADDR_SHADOW     = (uint32_t)&spiSlaveTxB[0][0];
+		DmaRegs.CH3.DST_BEG_ADDR_SHADOW = (uint32_t)&SpibRegs.SPITXBUF;
+		DmaRegs.CH3.DST_ADDR_SHADOW     = (uint32_t)&SpibRegs.SPITXBUF;
+		DmaRegs.CH3.BURST_SIZE.bit.BURSTSIZE = SPI_SLAVE_BURST_WORDS - 1;
+		DmaRegs.CH3.SRC_BURST_STEP = 1;
+		DmaRegs.CH3.DST_BURST_STEP = 0;
+		DmaRegs.CH3.TRANSFER_SIZE = 2 * burstsPerFrame - 1;
+		DmaRegs.CH3.SRC_TRANSFER_STEP = 1;
+		DmaRegs.CH3.DST_TRANSFER_STEP = 0;
+		DmaRegs.CH3.SRC_WRAP_SIZE = burstsPerFrame - 1;
+		DmaRegs.CH3.SRC_WRAP_STEP = SPI_SLAVE_MAX_FRAME_WORDS;
+		DmaRegs.CH3.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH3.DST_WRAP_STEP = 0;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3 = SPI_STREAM_TRIGGER_SPIBTX;
+		DmaRegs.CH3.MODE.bit.PERINTSEL = 3;
+		DmaRegs.CH3.MODE.bit.PERINTE = 1;
+		DmaRegs.CH3.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH3.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH3.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH3.MODE.bit.DATASIZE = 0;
+		DmaRegs.CH3.MODE.bit.CHINTE = 0;
+
+		// DMA CH4: pro SPI_SLAVE_BURST_WORDS empfangenen Wrtern (SPIBRX) ein Burst aus dem
+		// Empfangs-FIFO in den aktuellen Empfangspuffer, Wechsel der Puffer wie bei CH3
+		DmaRegs.CH4.CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		DmaRegs.CH4.SRC_BEG_ADDR_SHADOW = (uint32_t)&SpibRegs.SPIRXBUF;
+		DmaRegs.CH4.SRC_ADDR_SHADOW     = (uint32_t)&SpibRegs.SPIRXBUF;
+		DmaRegs.CH4.DST_BEG_ADDR_SHADOW = (uint32_t)&spiSlaveRxB[0][0];
+		DmaRegs.CH4.DST_ADDR_SHADOW     = (uint32_t)&spiSlaveRxB[0][0];
+		DmaRegs.CH4.BURST_SIZE.bit.BURSTSIZE = SPI_SLAVE_BURST_WORDS - 1;
+		DmaRegs.CH4.SRC_BURST_STEP = 0;
+		DmaRegs.CH4.DST_BURST_STEP = 1;
+		DmaRegs.CH4.TRANSFER_SIZE = 2 * burstsPerFrame - 1;
+		DmaRegs.CH4.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH4.DST_TRANSFER_STEP = 1;
+		DmaRegs.CH4.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH4.SRC_WRAP_STEP = 0;
+		DmaRegs.CH4.DST_WRAP_SIZE = burstsPerFrame - 1;
+		DmaRegs.CH4.DST_WRAP_STEP = SPI_SLAVE_MAX_FRAME_WORDS;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH4 = SPI_STREAM_TRIGGER_SPIBRX;
+		DmaRegs.CH4.MODE.bit.PERINTSEL = 4;
+		DmaRegs.CH4.MODE.bit.PERINTE = 1;
+		DmaRegs.CH4.MODE.bit.OVRINTE = 0;
+		DmaRegs.CH4.MODE.bit.ONESHOT = 0;
+		DmaRegs.CH4.MODE.bit.CONTINUOUS = 1;
+		DmaRegs.CH4.MODE.bit.DATASIZE = 0;
+		DmaRegs.CH4.MODE.bit.CHINTE = 0;
+		EDIS;
+
+		SpiSlaveRestartB();
+
+		// Ende jedes Frames melden (Vektor siehe "SpiSlaveInitB()")
+		EALLOW;
+		XintRegs.XINT2CR.bit.ENABLE = 1;
+		PieCtrlRegs.PIEIER1.bit.INTx5 = 1;
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: SpiSlaveStopB =====================================================================
+///
+/// @brief  Funktion beendet den Slave-Betrieb: der Interrupt am Ende der Frames wird gesperrt,
+///					beide DMA-Kanle angehalten und die FIFOs geleert. SPI-B bleibt im Soft-Reset
+///					(SOMI hochohmig), ein gerade laufender Frame wird abgebrochen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiSlaveStopB(void)
+{
+		if (!spiB.streamActive)
+		{
+				return;
+		}
+
+		EALLOW;
+		XintRegs.XINT2CR.bit.ENABLE = 0;
+		PieCtrlRegs.PIEIER1.bit.INTx5 = 0;
+		DmaRegs.CH3.CONTROL.bit.HALT = 1;
+		DmaRegs.CH4.CONTROL.bit.HALT = 1;
+		EDIS;
+
+		SpibRegs.SPICCR.bit.SPISWRESET = 0;
+		SpibRegs.SPIFFTX.bit.TXFIFO = 0;
+		SpibRegs.SPIFFRX.bit.RXFIFORESET = 0;
+		SpibRegs.SPIFFTX.bit.TXFIFO = 1;
+		SpibRegs.SPIFFRX.bit.RXFIFORESET = 1;
+		spiB.streamActive = false;
+}
+
+
 //=== Function: SpiISRA ===========================================================================
 ///
-/// @brief	Funktion wird aufgerufen, sobald die im Register SPIFFRX.bit.RXFFIL stehende
-///					Anzahl an Bytes ber SPI empfangen wurde. Fr den reinen Sendebetrieb knnte
-///					zwar der SPI_TX_INT verwendet werden, aber die Konfiguration des Sende-Interrupts
-///					ist komplizierter als die des Emfangs-Interrupts. Zudem wird der Sende-Interrupt
-///					ausgelst, sobald der TX-Puffer leer ist. Zu diesem Zeitpunkt befindet sich das
-///					letzte zu sendene Byte jedoch noch im Ausgangsregister. Der Interrupt kommt also
-///					zu frh. Aus diesem  Grund und weil beim Senden auch automatisch Daten empfangen
-///					werden, wurde hier die Kommunikation ausschlielich mithilfe des Empfangs-Interrupts
-///					umgesetzt.
+/// @brief	Interrupt-Service-Routine von SPI-A (SPIA_RX_INT). Der Ablauf ist fr alle Module
+///					gleich und steht in "SpiServiceISR()". Die Laufzeit wird im Profiling-Slot
+///					PROFILE_SLOT_SPI erfasst
 ///
 /// @param  void
 ///
@@ -355,6 +1447,8 @@ bool SpiSendDataA(uint16_t slave,
 //=================================================================================================
 __interrupt void SpiISRA(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_SPI);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -364,58 +1458,145 @@ __interrupt void SpiISRA(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Daten aus dem Empfangs-FIFO in den Software-Puffer kopieren bis die
-		// komplette Anzahl an Bytes empfangen wurde oder der Empfangs-FIFO leer ist
-		while (   (spiBufferIndexRxA < spiBytesToTransferA)
-					 && (SpiaRegs.SPIFFRX.bit.RXFFST > 0))
+		SpiServiceISR(&spiA);
+
+		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_SPI);
+}
+
+
+//=== Function: SpiISRB ===========================================================================
+///
+/// @brief	Interrupt-Service-Routine von SPI-B (SPIB_RX_INT), siehe "SpiISRA()"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiISRB(void)
+{
+		SpiServiceISR(&spiB);
+    PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+}
+
+
+//=== Function: SpiISRC ===========================================================================
+///
+/// @brief	Interrupt-Service-Routine von SPI-C (SPIC_RX_INT), siehe "SpiISRA()"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiISRC(void)
+{
+		SpiServiceISR(&spiC);
+    PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+}
+
+
+//=== Function: SpiISRD ===========================================================================
+///
+/// @brief	Interrupt-Service-Routine von SPI-D (SPID_RX_INT), siehe "SpiISRA()"
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiISRD(void)
+{
+		SpiServiceISR(&spiD);
+    PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+}
+
+
+//=== Function: SpiStreamISRA =====================================================================
+///
+/// @brief	Funktion wird von DMA CH6 aufgerufen, sobald "spiStreamRxA[]" vollstndig beschrieben
+///					wurde (einmal pro Puffer, nicht pro Frame). Sie zhlt die Puffer und prft, ob der
+///					Empfangs-FIFO bergelaufen ist (der DMA hat einen Frame nicht rechtzeitig gelesen).
+///					Die Laufzeit wird im selben Profiling-Slot wie SpiISRA() erfasst.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiStreamISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_SPI);
+
+		spiStreamBufferCountA++;
+		if (SpiaRegs.SPIFFRX.bit.RXFFOVF)
 		{
-				spiBufferRxA[spiBufferIndexRxA] = SpiaRegs.SPIRXBUF;
-				spiBufferIndexRxA++;
+				SpiaRegs.SPIFFRX.bit.RXFFOVFCLR = 1;
+				spiStreamOverflowA++;
 		}
-		// Komplette Anzahl an Bytes wurde gesendet/empfangen
-		if (spiBufferIndexRxA == spiBytesToTransferA)
+
+		// Interrupt-Flag der Gruppe 7 lschen (da gehrt der DMA-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_SPI);
+}
+
+
+//=== Function: SpiSlaveFrameISRB =================================================================
+///
+/// @brief	Interrupt-Service-Routine am Ende jedes Frames des Slave-Betriebs (XINT2, steigende
+///					Flanke von SPISTEB). Sie wartet kurz auf den letzten Burst von DMA CH4 und prft die
+///					Frame-Grenze: nach Frame k muss der Empfangskanal am Anfang von "spiSlaveRxB[1]"
+///					(k gerade, Wrap) bzw. auf dem letzten Wort von "spiSlaveRxB[1]" (k ungerade, Ende
+///					des Transfers) stehen und der Empfangs-FIFO leer sein. Ist das der Fall, wird
+///					"spiSlaveFrameCountB" erhht und die Callback-Funktion aufgerufen. Andernfalls
+///					(Frame mit falscher Lnge, berlauf) werden beide Kanle neu gestartet und der
+///					nchste Frame beginnt wieder mit dem ersten Puffer. Die Laufzeit wird im selben
+///					Profiling-Slot wie SpiISRA() erfasst.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiSlaveFrameISRB(void)
+{
+		uint16_t frame = (uint16_t)spiSlaveFrameCountB & 1;
+		uint32_t expected = (uint32_t)&spiSlaveRxB[0][0] + SPI_SLAVE_MAX_FRAME_WORDS;
+		uint16_t loops = 0;
+
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_SPI);
+
+		if (frame)
 		{
-				// Empfangs-FIFO-Interrupt ausschalten
-		    SpiaRegs.SPIFFRX.bit.RXFFIENA = 0;
-				// Slaves abwhlen
-				SPI_DISABLE_SLAVE_1;
-				SPI_DISABLE_SLAVE_2;
-				// Flag setzen um das Ende der bertragung zu signalisieren
-				spiStatusFlagA = SPI_STATUS_FINISHED;
+				expected += spiSlaveWordsPerFrameB - 1;
 		}
-		// Es sollen noch weitere Bytes gesendet/empfangen werden
-		else
+		// Der letzte Burst kann noch laufen, wenn der Master direkt nach dem
+		// letzten Bit abwhlt
+		while (   (DmaRegs.CH4.DST_ADDR_ACTIVE != expected)
+					 && (loops < SPI_SLAVE_DRAIN_LOOPS))
 		{
-				// Die nchsten Daten in den Sende-FIO kopieren. Dieser ist Datenbreite*16 Bit gro.
-				// Die Datenbreite kann zwischen 1 und 16 eingestellt werden (siehe S. 3904 Reference
-				// Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die Reihenfolge, in der die Daten
-				// ausgesendet werden ist:
-				// MSB: i = 0
-				// LSB: i = numberOfBytes-1
-				while (   (spiBufferIndexTxA < spiBytesToTransferA)
-							 &&	(SpiaRegs.SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
-				{
-						// Daten in den SPI-Hardware-Puffer kopieren. Daten mssen dabei linksbnig sein (S. 3915
-						// Reference Manual TTMS320F2838x, SPRUII0D, Rev. D, July 2022), da nur die Anzahl an Bits
-						// ausgesendet werden, die als Datenlnge festgelegt wurden (SPICHAR + 1). Sobald das erste
-						// Element in den FIFO-Puffer geschrieben wurde, beginnt der Sendevorgang
-						SpiaRegs.SPITXBUF = (spiBufferTxA[spiBufferIndexTxA] << 8);
-						spiBufferIndexTxA++;
-				}
-				// Interrupt auslsen, wenn "spiBytesToTransferA - spiBufferIndexRxA" Bytes oder
-				// die maximale Anzahl an Bytes des FIFO-Empfangspuffers empfangen wurden, je nach
-				// dem was kleiner ist
-				SpiaRegs.SPIFFRX.bit.RXFFIL = spiBytesToTransferA - spiBufferIndexRxA;
-				if ((spiBytesToTransferA - spiBufferIndexRxA) > SPI_SIZE_HARDWARE_FIFO)
+				loops++;
+		}
+
+		if (   (DmaRegs.CH4.DST_ADDR_ACTIVE == expected)
+				&& (SpibRegs.SPIFFRX.bit.RXFFST == 0)
+				&& !SpibRegs.SPIFFRX.bit.RXFFOVF)
+		{
+				spiSlaveFrameCountB++;
+				if (spiSlaveCallbackB)
 				{
-						SpiaRegs.SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
+						spiSlaveCallbackB(spiSlaveRxB[frame], spiSlaveTxB[frame]);
 				}
 		}
+		else
+		{
+				spiSlaveResyncCountB++;
+				SpiSlaveRestartB();
+		}
 
-    // RX-FIFO Interupt-Flag lschen
-    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1;
-		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
-    PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt XINT2 zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_SPI);
 }
-
-
@@ -12,9 +12,44 @@
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V2.0
+///							nderung in Version 2.1: Gerteliste "spiDevices[]" mit Takt, Polaritt, Phase,
+///							Datenlnge und Slave-Select pro Gert sowie eine Warteschlange fr
+///							Transaktionen ("SpiSubmitA()"). Die ISR konfiguriert das Modul zwischen zwei
+///							Transaktionen fr das nchste Gert um und startet die nchste Transaktion
+///							direkt nach dem Ende der vorherigen.
 ///
-/// @date       24.03.2023
+///							nderung in Version 2.2: DMA-Streaming (Vollduplex). Ein Trigger (ePWM-SOC
+///							oder CPU-Timer) startet je einen Frame: DMA CH5 kopiert die vorbereiteten,
+///							linksbndigen Wrter aus "spiStreamTxA[]" in den Sende-FIFO, DMA CH6 kopiert
+///							die empfangenen Wrter nach "spiStreamRxA[]". Beide Kanle laufen zyklisch
+///							ber alle Frames des Puffers, die CPU wird nur einmal pro Puffer unterbrochen.
+///
+///							nderung in Version 2.3: "SpiSendDataA()" meldet den Start der Kommunikation
+///							korrekt zurck. Transaktionen knnen eine Callback-Funktion angeben, die am Ende
+///							der Transaktion in der ISR aufgerufen wird. "SpiSubmitA()" gibt zurck, ob die
+///							Transaktion sofort gestartet, eingereiht oder abgelehnt wurde, und
+///							"SpiGetQueueCountA()" die Anzahl der eingereihten Transaktionen.
+///
+///							nderung in Version 3.0: Alle Funktionen arbeiten auf einem Objekt "SpiInstance"
+///							("spiA" ... "spiD") mit Zeiger auf die Register des Moduls und eigenem Zustand,
+///							sodass mehrere SPI-Module ohne doppelten Code parallel laufen. Die Funktionen
+///							fr SPI-A mit Buchstaben am Ende bleiben als Makros erhalten.
+///
+///							nderung in Version 3.1: Die Software-Puffer fr "SpiSendData()" ("spiBufferTxA[]"
+///							usw.) sind gepackt (zwei Bytes pro Wort, myByteBuffer.h) und belegen nur noch die
+///							Hlfte des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET() und BYTE_BUFFER_SET().
+///							Die Puffer der Transaktionen bleiben ein Wort pro Zeichen (Datenlnge bis 16 Bit).
+///
+///							nderung in Version 3.2: Slave-Betrieb an SPI-B ("SpiSlaveStartB()") fr einen
+///							externen Master (z.B. Datenkonzentrator). DMA CH3 und CH4 senden und empfangen
+///							Frames fester Lnge abwechselnd aus zwei Puffern ("spiSlaveTxB[]", "spiSlaveRxB[]")
+///							ohne CPU-Beteiligung pro Wort. Am Ende jedes Frames (steigende Flanke von SPISTEB)
+///							prft "SpiSlaveFrameISRB()" die Frame-Grenze, synchronisiert bei Bedarf neu und
+///							bergibt den empfangenen und den freien Sendepuffer an eine Callback-Funktion.
+///
+/// @version    V3.2
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -24,6 +59,8 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
+#include "myByteBuffer.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -45,6 +82,59 @@
 // Slave-Select
 #define SPI_SLAVE_1												0
 #define SPI_SLAVE_2												1
+#define SPI_SLAVE_3												2
+// Hardware-Slave-Select SPISTEA (GPIO 57). Wird vom SPI-Modul bei jeder bertragung
+// aktiviert und bleibt aktiv, solange Wrter im Sende-FIFO stehen
+#define SPI_SLAVE_STE											3
+#define SPI_SLAVE_NONE										0xFFFF
+// Gerte am SPI-A Bus (Index in "spiDevices[]")
+#define SPI_DEVICE_DAC										0
+#define SPI_DEVICE_ADC										1
+#define SPI_DEVICE_EEPROM									2
+#define SPI_NUMBER_OF_DEVICES							3
+// Einstellungen aus "SpiInitA()" (fr "SpiSendDataA()", kein Gert aus "spiDevices[]")
+#define SPI_DEVICE_INIT										0xFFFF
+// Anzahl der Pltze der Warteschlange. Ein Platz bleibt frei, um eine volle von einer
+// leeren Warteschlange zu unterscheiden, es knnen also SPI_SIZE_QUEUE - 1 Transaktionen
+// (inkl. der gerade aktiven Transaktion) gleichzeitig eingereiht sein
+#define SPI_SIZE_QUEUE										8
+// Zustand einer eingereihten, noch nicht gestarteten Transaktion
+#define SPI_STATUS_QUEUED									3
+// Rckgabewerte von "SpiSubmitA()"
+#define SPI_SUBMIT_INVALID								0							// Gert unbekannt oder 0 Wrter
+#define SPI_SUBMIT_BUSY										1							// Warteschlange voll
+#define SPI_SUBMIT_QUEUED									2							// Eingereiht, startet nach der aktiven Kommunikation
+#define SPI_SUBMIT_STARTED								3							// Sofort gestartet
+// DMA-Trigger fr das Streaming (Tabelle DMA-Trigger-Quellen, DMACHSRCSELx).
+// ePWMx SOCA: SPI_STREAM_TRIGGER_EPWM1_SOCA + 2 * (x - 1)
+#define SPI_STREAM_TRIGGER_EPWM1_SOCA			36
+#define SPI_STREAM_TRIGGER_TINT0					68
+#define SPI_STREAM_TRIGGER_TINT1					69
+#define SPI_STREAM_TRIGGER_TINT2					70
+#define SPI_STREAM_TRIGGER_SPIARX					110
+#define SPI_STREAM_TRIGGER_SPIBTX					111
+#define SPI_STREAM_TRIGGER_SPIBRX					112
+// Gre der Streaming-Puffer in Wrtern (Frames * Wrter pro Frame)
+#define SPI_STREAM_SIZE_BUFFER						1024
+// Slave-Betrieb an SPI-B (GPIO 63 SIMO, 64 SOMI, 65 CLK, 66 STE, High-Speed-Pins des Moduls).
+// Die Datenlnge ist fest 16 Bit, die Wrter stehen unverndert in den Puffern. Ein Frame ist
+// eine Anwahl des Slaves (SPISTEB low) mit genau "wordsPerFrame" Wrtern
+#define SPI_SLAVE_CHAR_LENGTH							16
+// Wrter pro DMA-Burst. Der DMA fllt den Sende-FIFO nach, sobald hchstens
+// SPI_SLAVE_TX_FIFO_LEVEL Wrter darin stehen, und leert den Empfangs-FIFO bei
+// SPI_SLAVE_BURST_WORDS Wrtern. Die Lnge eines Frames muss ein Vielfaches davon sein
+#define SPI_SLAVE_BURST_WORDS							8
+#define SPI_SLAVE_TX_FIFO_LEVEL						(SPI_SIZE_HARDWARE_FIFO - SPI_SLAVE_BURST_WORDS - 1)
+// Kleinste und grte Lnge eines Frames in Wrtern. Der DMA liest bis zu 16 Wrter des
+// nchsten Frames im Voraus, die Callback-Funktion hat also (wordsPerFrame - 16) Wortzeiten
+// nach dem Beginn des nchsten Frames Zeit, den freien Sendepuffer zu beschreiben
+#define SPI_SLAVE_MIN_FRAME_WORDS					32
+#define SPI_SLAVE_MAX_FRAME_WORDS					512
+// Hchster Takt des Masters (ein Bit dauert mindestens 4 Takte des Low-Speed Peripheral Clock,
+// 12,5 MHz bei 200 MHz Systemtakt)
+#define SPI_SLAVE_MAX_CLOCK								(DEVICE_LSPCLK_HZ / 4)
+// Durchlufe, die "SpiSlaveFrameISRB()" auf den letzten Burst des Empfangskanals wartet
+#define SPI_SLAVE_DRAIN_LOOPS							64
 
 
 //-------------------------------------------------------------------------------------------------
@@ -59,35 +149,181 @@
 #define SPI_DISABLE_SLAVE_1								GpioDataRegs.GPBSET.bit.GPIO58   = 1
 #define SPI_ENABLE_SLAVE_2								GpioDataRegs.GPBCLEAR.bit.GPIO59 = 1
 #define SPI_DISABLE_SLAVE_2								GpioDataRegs.GPBSET.bit.GPIO59   = 1
+#define SPI_ENABLE_SLAVE_3								GpioDataRegs.GPBCLEAR.bit.GPIO60 = 1
+#define SPI_DISABLE_SLAVE_3								GpioDataRegs.GPBSET.bit.GPIO60   = 1
+// Funktionen fr SPI-A aus Version 2.x
+#define SpiInitBufferTxA()								SpiInitBufferTx(&spiA)
+#define SpiInitBufferRxA()								SpiInitBufferRx(&spiA)
+#define SpiGetStatusA()										SpiGetStatus(&spiA)
+#define SpiSetStatusIdleA()								SpiSetStatusIdle(&spiA)
+#define SpiSendDataA(slave, numberOfBytes)	SpiSendData(&spiA, (slave), (numberOfBytes))
+#define SpiSubmitA(transaction)						SpiSubmit(&spiA, (transaction))
+#define SpiGetQueueCountA()								SpiGetQueueCount(&spiA)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Einstellungen eines Gerts am SPI-Bus
+typedef struct
+{
+		uint32_t clock;												// SPI-Takt in Hz (SPI_CLOCK_...)
+		uint16_t polarity;										// Ruhepegel von CLK (SPICCR.CLKPOLARITY)
+		uint16_t phase;												// Phase (SPICTL.CLK_PHASE)
+		uint16_t charLength;									// Datenlnge in Bit (1 ... 16)
+		uint16_t slave;												// Slave-Select (SPI_SLAVE_...)
+} SpiDevice;
+
+// Eine SPI-Transaktion: "numberOfWords" Wrter an ein Gert senden und gleichzeitig
+// empfangen. Ist "bufferTx" 0, wird 0 gesendet, ist "bufferRx" 0, werden die
+// empfangenen Daten verworfen. Die Daten stehen rechtsbndig in den Puffern. Die
+// Struktur und die Puffer gehren der aufrufenden Stelle und drfen bis zum Ende der
+// Transaktion (status == SPI_STATUS_FINISHED) nicht verndert werden
+typedef struct SpiTransaction
+{
+		uint16_t device;
+		const uint16_t *bufferTx;
+		uint16_t *bufferRx;
+		uint16_t numberOfWords;
+		// Wird in der ISR nach dem Ende der Transaktion aufgerufen (darf 0 sein).
+		// In der Callback-Funktion darf "SpiSubmitA()" aufgerufen werden
+		void (*callback)(struct SpiTransaction *transaction);
+		volatile uint16_t status;
+} SpiTransaction;
+
+// Zustand eines SPI-Moduls. Fr jedes Modul gibt es ein Objekt ("spiA" ... "spiD"), das
+// allen Funktionen ohne Buchstaben am Ende (z.B. "SpiSubmit()") bergeben wird. Die ersten
+// fnf Elemente werden beim Anlegen gesetzt, die brigen verwaltet der Treiber
+typedef struct
+{
+		volatile struct SPI_REGS *regs;				// Register des Moduls (SpiaRegs ... SpidRegs)
+		const SpiDevice *devices;							// Gerteliste des Busses ("SpiAttachDevices()")
+		uint16_t numberOfDevices;
+		void (*selectSlave)(uint16_t slave);	// Slave-Select des Busses (SPI_SLAVE_NONE: abwhlen)
+		uint16_t *bufferTx;										// Software-Puffer fr "SpiSendData()" (gepackt)
+		uint16_t *bufferRx;
+		// Kopieren in und aus den Software-Puffern bzw. Transaktionen
+		uint16_t bufferIndexTx;
+		uint16_t bufferIndexRx;
+		uint16_t bytesToTransfer;
+		// Zustand der Kommunikation ber "SpiSendData()" (SPI_STATUS_...)
+		volatile uint16_t statusFlag;
+		// Warteschlange der Transaktionen. "queueTail" zeigt auf die aktive bzw. nchste
+		// Transaktion, "queueHead" auf den nchsten freien Platz
+		SpiTransaction *queue[SPI_SIZE_QUEUE];
+		volatile uint16_t queueHead;
+		volatile uint16_t queueTail;
+		volatile bool queueActive;
+		// DMA-Streaming (nur SPI-A) bzw. Slave-Betrieb (nur SPI-B) ist aktiv
+		volatile bool streamActive;
+		// Gert, fr das das Modul gerade konfiguriert ist, die daraus folgende Verschiebung
+		// (linksbndig senden) und Maske (empfangen) sowie die Baudrate aus "SpiInit()"
+		uint16_t configuredDevice;
+		uint16_t shiftTx;
+		uint16_t maskRx;
+		uint16_t bitRateInit;
+} SpiInstance;
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die SPI-Kommunikation
-extern uint16_t spiBufferTxA[SPI_SIZE_SOFTWARE_BUFFER];
-extern uint16_t spiBufferRxA[SPI_SIZE_SOFTWARE_BUFFER];
+// Software-Puffer fr die SPI-Kommunikation, gepackt: Zugriff mit
+// BYTE_BUFFER_GET(spiBufferRxA, i) bzw. BYTE_BUFFER_SET(spiBufferTxA, i, byte)
+extern uint16_t spiBufferTxA[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferRxA[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferTxB[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferRxB[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferTxC[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferRxC[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferTxD[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+extern uint16_t spiBufferRxD[BYTE_BUFFER_WORDS(SPI_SIZE_SOFTWARE_BUFFER)];
+// Einstellungen der Gerte am SPI-A Bus
+extern const SpiDevice spiDevices[SPI_NUMBER_OF_DEVICES];
+// Objekte der SPI-Module A bis D
+extern SpiInstance spiA;
+extern SpiInstance spiB;
+extern SpiInstance spiC;
+extern SpiInstance spiD;
+// Puffer des DMA-Streamings (GS-RAM, fr den DMA erreichbar). "spiStreamTxA[]" enthlt die
+// zu sendenen Wrter bereits linksbndig ("SpiStreamPrepareTxA()"), "spiStreamRxA[]" die
+// empfangenen Wrter rechtsbndig. Bei einer Datenlnge < 16 Bit stehen in den oberen Bits
+// die zuletzt gesendeten Bits und mssen von der auswertenden Stelle maskiert werden
+extern uint16_t spiStreamTxA[SPI_STREAM_SIZE_BUFFER];
+extern uint16_t spiStreamRxA[SPI_STREAM_SIZE_BUFFER];
+// Anzahl der vollstndig empfangenen Streaming-Puffer (wird in der DMA-ISR erhht)
+extern volatile uint32_t spiStreamBufferCountA;
+// Anzahl der erkannten berlufe des Empfangs-FIFOs whrend des Streamings
+extern uint32_t spiStreamOverflowA;
+// Puffer des Slave-Betriebs (GS-RAM, fr den DMA erreichbar). Frame k wird aus
+// "spiSlaveTxB[k % 2]" gesendet und nach "spiSlaveRxB[k % 2]" empfangen
+extern uint16_t spiSlaveTxB[2][SPI_SLAVE_MAX_FRAME_WORDS];
+extern uint16_t spiSlaveRxB[2][SPI_SLAVE_MAX_FRAME_WORDS];
+// Anzahl der vollstndig empfangenen Frames seit dem Start bzw. der letzten Synchronisation
+extern volatile uint32_t spiSlaveFrameCountB;
+// Anzahl der Neusynchronisationen (Frame mit falscher Lnge oder berlauf des Empfangs-FIFOs)
+extern uint32_t spiSlaveResyncCountB;
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
-// Funktion setzt GPIOs auf SPI-Funktionalitt, initialisiert das SPI-Modul
-// als Master und aktiviert den SPI-Interrupt inkl. Registrierung der ISR
+// Funktion setzt die GPIOs von SPI-A auf SPI-Funktionalitt und initialisiert SPI-A
 extern void SpiInitA(uint32_t clock);
+// Funktion initialisiert ein SPI-Modul als Master und aktiviert den SPI-Interrupt
+// inkl. Registrierung der ISR (ohne GPIOs)
+extern void SpiInit(SpiInstance *spi, uint32_t clock);
+// Funktion ordnet einem Bus seine Gerteliste und seinen Slave-Select zu
+extern void SpiAttachDevices(SpiInstance *spi,
+														 const SpiDevice *devices,
+														 uint16_t numberOfDevices,
+														 void (*selectSlave)(uint16_t slave));
 // Funktion initialisiert den SPI Software Sende-Puffer (alle Elemente zu 0)
-extern void SpiInitBufferTxA(void);
+extern void SpiInitBufferTx(SpiInstance *spi);
 // Funktion initialisiert den SPI Software Empfangs-Puffer (alle Elemente zu 0)
-extern void SpiInitBufferRxA(void);
+extern void SpiInitBufferRx(SpiInstance *spi);
 // Funktion gibt den aktuellen Status der SPI-Kommunikation zurck
-extern uint16_t SpiGetStatusA(void);
+extern uint16_t SpiGetStatus(SpiInstance *spi);
 // Funktion setzt das Status-Flag auf "idle", falls die vorherige Kommunikation abgeschlossen ist
-extern bool SpiSetStatusIdleA(void);
+extern bool SpiSetStatusIdle(SpiInstance *spi);
 // Funktion zum Senden und Empfangen von Daten ber SPI
-extern bool SpiSendDataA(uint16_t slave,
-												 uint16_t numberOfBytes);
-// Interrupt-Service-Routine fr die SPI-Kommunikation
+extern bool SpiSendData(SpiInstance *spi,
+												uint16_t slave,
+												uint16_t numberOfBytes);
+// Funktion reiht eine Transaktion in die Warteschlange ein und startet sie sofort,
+// falls keine andere Kommunikation aktiv ist
+extern uint16_t SpiSubmit(SpiInstance *spi, SpiTransaction *transaction);
+// Funktion gibt die Anzahl der eingereihten Transaktionen (inkl. der aktiven) zurck
+extern uint16_t SpiGetQueueCount(SpiInstance *spi);
+// Funktion schreibt die Sendedaten des Streamings linksbndig in "spiStreamTxA[]"
+extern bool SpiStreamPrepareTxA(uint16_t device,
+																const uint16_t *data,
+																uint16_t numberOfWords);
+// Funktion startet das DMA-Streaming mit einem ePWM- oder CPU-Timer-Trigger
+extern bool SpiStreamStartA(uint16_t device,
+														uint16_t trigger,
+														uint16_t wordsPerFrame,
+														uint16_t numberOfFrames);
+// Funktion beendet das DMA-Streaming
+extern void SpiStreamStopA(void);
+// Funktion setzt die GPIOs von SPI-B auf SPI-Funktionalitt und trgt die ISR des Slave-Betriebs ein
+extern void SpiSlaveInitB(void);
+// Funktion startet den Slave-Betrieb von SPI-B mit Frames aus "wordsPerFrame" Wrtern
+extern bool SpiSlaveStartB(uint16_t polarity,
+													 uint16_t phase,
+													 uint16_t wordsPerFrame,
+													 void (*callback)(const uint16_t *rxFrame, uint16_t *txFrame));
+// Funktion beendet den Slave-Betrieb
+extern void SpiSlaveStopB(void);
+// Interrupt-Service-Routinen fr die SPI-Kommunikation
 __interrupt void SpiISRA(void);
+__interrupt void SpiISRB(void);
+__interrupt void SpiISRC(void);
+__interrupt void SpiISRD(void);
+// Interrupt-Service-Routine am Ende jedes Streaming-Puffers (DMA CH6)
+__interrupt void SpiStreamISRA(void);
+// Interrupt-Service-Routine am Ende jedes Frames des Slave-Betriebs (XINT2, SPISTEB)
+__interrupt void SpiSlaveFrameISRB(void);
 
 
 #endif
@@ -18,9 +18,58 @@
 ///												(LED yellow)
 ///												(LED red)
 ///
-/// @version	V1.0
+///						nderung in Version 1.1: Lauflicht, Dimmen der LEDs und Neustart der
+///						Aufzeichnung laufen als Tasks mit fester Rate im Scheduler (myScheduler.h, CPU-Timer
+///						0) statt in der Dauerschleife. Laufzeit und CPU-Last jeder Task knnen im Debugger
+///						ber "schedulerTaskStats" und "schedulerLoad" angezeigt werden
 ///
-/// @date			09.03.2023
+///						nderung in Version 1.2: Die ADC-ISRs unterbrechen die ISRs der Kommunikation, des
+///						ePWM8 und des Schedulers (Prioritten siehe "interruptPriorityTable", myInterrupt.c)
+///
+///						nderung in Version 1.3: CPU-Last aus einem kalibrierten Leerlaufzhler und den
+///						Laufzeiten der ISRs (myLoad.h). Das Ergebnis steht in "loadReport" und wird bei
+///						loadReportEnable = 1 jede Sekunde als Telemetrie-Rahmen gesendet
+///
+///						nderung in Version 1.4: Build-Konfiguration CPU1_FLASH_PERF (-O4, ohne
+///						Prfungen und Messungen), die Tasks des Schedulers werden mit DEVICE_ASSERT()
+///						geprft
+///
+///						nderung in Version 1.5: Dauer der Initialisierungen (profileMarks[], MAIN_MARK_...)
+///						und Mikro-Benchmarks der 1 kHz-Task und eines Leerlauf-Durchlaufs
+///						(mainBenchmarkCycles[]) als Vergleichswerte zwischen zwei Software-Stnden
+///
+///						nderung in Version 1.6: Watchdog im Fenster-Betrieb, bedient vom Scheduler, solange
+///						alle Tasks laufen. Die Ursache des letzten Resets steht in "watchdogLastReset"
+///						(myWatchdog.h)
+///
+///						nderung in Version 1.7: Ist im Hintergrund nichts zu tun, schlft die CPU im
+///						Low-Power-Modus IDLE bis zum nchsten Interrupt (sptestens der nchste Grundtakt
+///						des Schedulers). Schlafzeit und Weck-Latenz stehen in "lowPowerStats"
+///						(myLowPower.h)
+///
+///						nderung in Version 1.8: Ist die CPU-Last gering, wird der Systemtakt auf
+///						MAIN_SYSCLK_IDLE_MHZ gesenkt und bei steigender Last wieder auf DEVICE_SYSCLK_MHZ
+///						erhht (DeviceSetSysclk(), myDevice.h). Scheduler, PWMs und UART rechnen ihre
+///						Perioden selbst um, die Helligkeit der LEDs bleibt gleich
+///
+///						nderung in Version 1.9: Jede neue Aufzeichnung wird im Hintergrund spektral
+///						analysiert (mySpectrum.h, MAIN_SPECTRUM_SIZE Punkte von MAIN_SPECTRUM_CHANNEL).
+///						Harmonische und Klirrfaktor stehen in "spectrumResult", die Takte einer Analyse
+///						je Lnge in "spectrumBenchmarkCycles"
+///
+///						nderung in Version 1.10: Bei synchroner Abtastung dimmt MainTaskDimming() mit
+///						einem zusammengehrigen Satz aller Messwerte (AdcSnapshotRead(), myADC.h)
+///
+///						nderung in Version 1.11: Das Lauflicht ist eine Tabelle von Schritten
+///						("mainLedPattern"), PatternTick() (myPattern.h) schaltet sie als 10 Hz-Task weiter
+///						und schreibt die GPIOs nur beim Wechsel der LED
+///
+///						nderung in Version 1.12: Export der Aufzeichnung mit MAIN_UART_BAUD (1562500 Baud,
+///						bei 200 MHz und MAIN_SYSCLK_IDLE_MHZ exakt einstellbar, siehe myUART.h)
+///
+/// @version	V1.12
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -30,12 +79,51 @@
 #include "myGPIO.h"
 #include "myPWM.h"
 #include "myADC.h"
+#include "myScope.h"
+#include "mySpectrum.h"
+#include "myScheduler.h"
+#include "myLoad.h"
+#include "myWatchdog.h"
+#include "myPattern.h"
 #include <math.h>
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Anzahl der LEDs des Lauflichts und Aufrufe von PatternTick() (10 Hz) pro LED (500 ms)
+#define MAIN_NUMBER_OF_LEDS							5
+#define MAIN_LED_STEPS									5
+// Aufrufe der 10 Hz-Task zwischen zwei Berichten der CPU-Last (1 s)
+#define MAIN_LOAD_REPORT_STEPS					10
+// Zwischenzeiten der Initialisierung (Index in profileMarks[])
+#define MAIN_MARK_GPIO									0
+#define MAIN_MARK_PWM										1
+#define MAIN_MARK_ADC										2
+#define MAIN_MARK_UART									3
+#define MAIN_MARK_SCOPE									4
+#define MAIN_MARK_SCHEDULER							5
+// Mikro-Benchmarks (Index in mainBenchmarkCycles[]) und Aufrufe pro Benchmark
+#define MAIN_BENCHMARK_DIMMING					0
+#define MAIN_BENCHMARK_BACKGROUND				1
+#define MAIN_NUMBER_OF_BENCHMARKS				2
+#define MAIN_BENCHMARK_LOOPS						16
+// Im Leerlauf schlafen (1) oder die Dauerschleife weiterlaufen lassen (0)
+#define MAIN_LOW_POWER									1
+// Systemtakt abhngig von der CPU-Last umschalten (1) oder fest DEVICE_SYSCLK_MHZ (0)
+#define MAIN_CLOCK_SCALING							1
+// Systemtakt bei geringer Last in MHz
+#define MAIN_SYSCLK_IDLE_MHZ						100
+// CPU-Last der Tasks (schedulerLoad in 0,01 %), unter der der Takt gesenkt und ber der er
+// wieder erhht wird. Bei halbem Takt verdoppelt sich die Last, daher der Abstand (Hysterese)
+#define MAIN_CLOCK_LOAD_LOW							2000
+#define MAIN_CLOCK_LOAD_HIGH						6000
+// Kanal und Lnge der Spektralanalyse jeder Aufzeichnung (ADCINA3, 1024 von 1024 Abtastungen)
+#define MAIN_SPECTRUM_CHANNEL						0
+#define MAIN_SPECTRUM_SIZE							1024
+// Baudrate des Exports (SCI-A). Der LSPCLK muss ein Vielfaches von 8 * MAIN_UART_BAUD sein, auch
+// beim Takt MAIN_SYSCLK_IDLE_MHZ, sonst weicht die Baudrate nach der Umschaltung ab
+#define MAIN_UART_BAUD									UART_BAUD_1562500
 
 
 //-------------------------------------------------------------------------------------------------
@@ -46,6 +134,208 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Aufzeichnung der vier Potentiometer-Spannungen: Trigger bei steigender Flanke von ADCINA3
+// ber die halbe Referenzspannung, 256 Abtastungen vor und 768 Abtastungen ab dem Trigger
+const ScopeConfig scopePotentiometers =
+{
+		4,
+		{&ADCINA3, &ADCINB3, &ADCINC3, &ADCIND3},
+		SCOPE_TRIGGER_RISING,
+		0,
+		2048,
+		256,
+		768
+};
+// Zum Starten einer neuen Aufzeichnung (im Debugger auf 1 setzen)
+uint16_t scopeStart = 0;
+// Zum Senden der CPU-Last ber UART (im Debugger auf 1 setzen)
+uint16_t loadReportEnable = 0;
+// Minimale Laufzeit der Mikro-Benchmarks in Takten (im Debugger oder per Skript auslesen)
+uint32_t mainBenchmarkCycles[MAIN_NUMBER_OF_BENCHMARKS];
+// Lauflicht der LEDs D1002 bis D1006 auf dem Control-Board (GPIO5, 3, 2, 6 und 7)
+const PatternStep mainLedPattern[MAIN_NUMBER_OF_LEDS] =
+{
+		{MAIN_LED_STEPS, {1UL << 5, 0}},
+		{MAIN_LED_STEPS, {1UL << 3, 0}},
+		{MAIN_LED_STEPS, {1UL << 2, 0}},
+		{MAIN_LED_STEPS, {1UL << 6, 0}},
+		{MAIN_LED_STEPS, {1UL << 7, 0}}
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Aufrufe der 10 Hz-Task seit dem letzten Bericht der CPU-Last
+static uint16_t mainLoadReportStep = 0;
+// Anzahl der Aufzeichnungen bei der letzten gestarteten Spektralanalyse
+static uint32_t mainSpectrumCapture = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: MainDimValue ======================================================================
+///
+/// @brief  Funktion berechnet aus einem ADC-Messwert den Vergleichswert (CMPA) eines PWM-Moduls.
+///					Exponentialfunktion und lineares Dimmen am Anfang, damit es frs menschliche Auge
+///					halbwegs linear wirkt
+///
+/// @param  uint16_t adcValue
+///
+/// @return uint16_t compareValue
+///
+//=================================================================================================
+static uint16_t MainDimValue(uint16_t adcValue)
+{
+		// Bei gesenktem Systemtakt ist die Periode krzer (DeviceScaleEpwm())
+		if (adcValue < 2000)
+		{
+				return (uint32_t)(adcValue/30) * deviceSysclkMhz / DEVICE_SYSCLK_MHZ;
+		}
+		else
+		{
+				return pow(5000.0, (adcValue/4095.0)) * deviceSysclkMhz / DEVICE_SYSCLK_MHZ;
+		}
+}
+
+//=== Function: MainTaskDimming ===================================================================
+///
+/// @brief  Task (1 kHz) dimmt die GPIOs 145, 147, 149 und 151 (PWM1 bis PWM4) in Abhngigkeit
+///					der ADC-Messwerte INA3, INB3, INC3 und IND3
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MainTaskDimming(void)
+{
+#if ADC_SYNCHRONOUS_SAMPLING
+		AdcSnapshot snapshot;
+
+		// Alle Messwerte stammen aus derselben Abtastung
+		AdcSnapshotRead(&snapshot);
+		EPwm1Regs.CMPA.bit.CMPA = MainDimValue(snapshot.result[ADC_SNAPSHOT_CHANNEL_INA3]);
+		EPwm2Regs.CMPA.bit.CMPA = MainDimValue(snapshot.result[ADC_SNAPSHOT_CHANNEL_INB3]);
+		EPwm3Regs.CMPA.bit.CMPA = MainDimValue(snapshot.result[ADC_SNAPSHOT_CHANNEL_INC3]);
+		EPwm4Regs.CMPA.bit.CMPA = MainDimValue(snapshot.result[ADC_SNAPSHOT_CHANNEL_IND3]);
+#else
+		EPwm1Regs.CMPA.bit.CMPA = MainDimValue(ADCINA3);
+		EPwm2Regs.CMPA.bit.CMPA = MainDimValue(ADCINB3);
+		EPwm3Regs.CMPA.bit.CMPA = MainDimValue(ADCINC3);
+		EPwm4Regs.CMPA.bit.CMPA = MainDimValue(ADCIND3);
+#endif
+}
+
+//=== Function: MainTaskScope =====================================================================
+///
+/// @brief  Task (100 Hz) startet die Spektralanalyse einer neuen Aufzeichnung und auf Wunsch
+///					(scopeStart = 1) eine neue Aufzeichnung, sobald die letzte exportiert und analysiert
+///					wurde
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MainTaskScope(void)
+{
+		if ((scopeCaptureCount != mainSpectrumCapture)
+				&& SpectrumStart(MAIN_SPECTRUM_CHANNEL, MAIN_SPECTRUM_SIZE))
+		{
+				mainSpectrumCapture = scopeCaptureCount;
+		}
+
+		if ((scopeStart == 1) && (scopeState == SCOPE_STATE_IDLE)
+				&& (spectrumState == SPECTRUM_STATE_IDLE))
+		{
+				scopeStart = 0;
+				ScopeArm(&scopePotentiometers);
+		}
+}
+
+//=== Function: MainScaleClock ====================================================================
+///
+/// @brief  Funktion senkt den Systemtakt bei geringer CPU-Last der Tasks auf MAIN_SYSCLK_IDLE_MHZ
+///					und erhht ihn bei hoher Last wieder auf DEVICE_SYSCLK_MHZ. Whrend des Exports einer
+///					Aufzeichnung ber UART wird nicht umgeschaltet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MainScaleClock(void)
+{
+		if (scopeState == SCOPE_STATE_EXPORTING)
+				return;
+
+		if ((deviceSysclkMhz == DEVICE_SYSCLK_MHZ) && (schedulerLoad < MAIN_CLOCK_LOAD_LOW))
+				DeviceSetSysclk(MAIN_SYSCLK_IDLE_MHZ);
+		else if ((deviceSysclkMhz != DEVICE_SYSCLK_MHZ) && (schedulerLoad > MAIN_CLOCK_LOAD_HIGH))
+				DeviceSetSysclk(DEVICE_SYSCLK_MHZ);
+}
+
+//=== Function: MainTaskLoad ======================================================================
+///
+/// @brief  Task (10 Hz) beendet das Messfenster der CPU-Last, passt den Systemtakt an
+///					(MAIN_CLOCK_SCALING) und sendet bei loadReportEnable = 1 jede Sekunde "loadReport"
+///					als Telemetrie-Rahmen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MainTaskLoad(void)
+{
+		LoadUpdate();
+#if MAIN_CLOCK_SCALING
+		MainScaleClock();
+#endif
+
+		if (++mainLoadReportStep < MAIN_LOAD_REPORT_STEPS)
+				return;
+		mainLoadReportStep = 0;
+		if (loadReportEnable == 1)
+				LoadSendReport();
+}
+
+//=== Function: MainBackground ====================================================================
+///
+/// @brief  Funktion fhrt einen Durchlauf des Hintergrunds aus: fllige Tasks (schnellste Rate
+///					zuerst), sonst ein Schritt der Spektralanalyse oder der Export einer eingefrorenen
+///					Aufzeichnung ber UART. Gibt false zurck, falls nichts zu tun war (Leerlauf)
+///
+/// @param  void
+///
+/// @return bool busy
+///
+//=================================================================================================
+static bool MainBackground(void)
+{
+		if (SchedulerRun())
+				return true;
+		if (SpectrumService())
+				return true;
+		return ScopeExportService();
+}
+
+//=== Function: MainBenchmarkBackground ===========================================================
+///
+/// @brief  Funktion fhrt einen Durchlauf des Hintergrunds fr ProfileBenchmark() aus. Vor
+///					SchedulerStart() ist keine Task fllig, gemessen wird also ein Leerlauf-Durchlauf
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void MainBenchmarkBackground(void)
+{
+		(void)MainBackground();
+}
 
 
 //=== Function: main ==============================================================================
@@ -59,14 +349,27 @@
 //=================================================================================================
 void main(void)
 {
+		// Veroderte Rckgabewerte von SchedulerAddTask()
+		uint16_t schedulerAddResult;
+
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Ursache des letzten Resets auswerten (Reset-Protokoll des Watchdogs)
+		WatchdogInit();
+		// Masken fr die Verschachtelung der ISRs nach Prioritt berechnen
+		InterruptInitPriorities();
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
+		// Low-Power-Modus IDLE fr den Leerlauf der Dauerschleife whlen
+		LowPowerInit(LOWPOWER_MODE_IDLE);
     // GPIOs initialisierenz
     GpioInit();
+    ProfileMark(MAIN_MARK_GPIO);
     // PWM 1 bis 4 initialisieren
     PwmInitPWM1To4();
     // PWM 8 initialisieren
     PwmInitPwm8();
+    ProfileMark(MAIN_MARK_PWM);
     // ADC-A initialisieren
     AdcAInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
@@ -79,6 +382,47 @@ void main(void)
     // ADC-D initialisieren
     AdcDInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
+    ProfileMark(MAIN_MARK_ADC);
+    // UART (SCI-A) im Streaming-Betrieb fr den Export der Aufzeichnung initialisieren
+    UartInitA(MAIN_UART_BAUD,
+						  UART_DATA_8_BIT,
+						  UART_STOP_1_BIT,
+						  UART_PARITY_NONE);
+    UartStartStreamA();
+    TelemetryInit();
+    ProfileMark(MAIN_MARK_UART);
+    // Aufzeichnung der ADC-Messwerte starten
+    ScopeInit();
+    ScopeArm(&scopePotentiometers);
+    // Drehfaktoren der Spektralanalyse berechnen (TMU)
+    SpectrumInit();
+    ProfileMark(MAIN_MARK_SCOPE);
+    // Lauflicht mit der ersten LED starten (weitergeschaltet von der 10 Hz-Task PatternTick())
+    PatternStart(mainLedPattern, MAIN_NUMBER_OF_LEDS);
+    // Scheduler mit den Tasks initialisieren und starten (CPU-Timer 0)
+    SchedulerInit();
+    // Rckgabewerte werden verodert (SCHEDULER_ADD_OK = 0), in CPU1_FLASH_PERF nicht geprft
+    schedulerAddResult  = SchedulerAddTask(SCHEDULER_RATE_1KHZ, MainTaskDimming);
+    schedulerAddResult |= SchedulerAddTask(SCHEDULER_RATE_100HZ, MainTaskScope);
+    schedulerAddResult |= SchedulerAddTask(SCHEDULER_RATE_10HZ, PatternTick);
+    schedulerAddResult |= SchedulerAddTask(SCHEDULER_RATE_10HZ, MainTaskLoad);
+    DEVICE_ASSERT(schedulerAddResult == SCHEDULER_ADD_OK);
+    ProfileMark(MAIN_MARK_SCHEDULER);
+#if DEVICE_INSTRUMENTATION
+    // Mikro-Benchmarks (vor dem Start des Schedulers, mit gesperrten Interrupts)
+    mainBenchmarkCycles[MAIN_BENCHMARK_DIMMING] = ProfileBenchmark(MainTaskDimming,
+																																	 MAIN_BENCHMARK_LOOPS);
+    mainBenchmarkCycles[MAIN_BENCHMARK_BACKGROUND] = ProfileBenchmark(MainBenchmarkBackground,
+																																		 MAIN_BENCHMARK_LOOPS);
+    // Takte einer Spektralanalyse fr 256 bis 2048 Punkte
+    SpectrumBenchmark();
+#endif
+    // Dauer eines Leerlauf-Durchlaufs messen (vor dem Start des Schedulers, damit keine Task
+    // fllig ist)
+    LoadCalibrate(MainBackground);
+    // Watchdog im Fenster-Betrieb einschalten, ab jetzt bedient ihn der Scheduler
+    WatchdogStart();
+    SchedulerStart();
 
 
     // Register-Schreibschutz ausschalten
@@ -88,104 +432,19 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-
-    		/*
-    		// LED D1003 auf der ControlCard abhngig vom Pegel an GPIO 80 ein- bzw. ausschalten
-    		if (GpioDataRegs.GPCDAT.bit.GPIO80 == 1)
+    		// Hintergrund ausfhren, Leerlauf-Durchlufe fr die CPU-Last zhlen
+    		if (!MainBackground())
     		{
-    				GpioDataRegs.GPASET.bit.GPIO3 = 1;
+    				LoadIdle();
+#if MAIN_LOW_POWER
+    				// Interrupts sperren, damit zwischen der Abfrage und dem IDLE-Befehl keine
+    				// Auslsung des Schedulers verloren geht
+    				DINT;
+    				if (!SchedulerPending())
+    						LowPowerSleep();
+    				EINT;
+#endif
     		}
-    		else
-    		{
-    				GpioDataRegs.GPACLEAR.bit.GPIO3 = 1;
-    		}
-    		*/
-
-    		// LEDs D1002 bis D1006 auf dem Control-Board blinken
-    		if (counterToggleLeds <= 50)
-    		{
-        		GpioDataRegs.GPASET.bit.GPIO5   = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO3 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO2 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO6 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO7 = 1;
-    		}
-    		else if (counterToggleLeds <= 100)
-    		{
-        		GpioDataRegs.GPACLEAR.bit.GPIO5 = 1;
-        		GpioDataRegs.GPASET.bit.GPIO3   = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO2 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO6 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO7 = 1;
-    		}
-    		else if (counterToggleLeds <= 150)
-    		{
-        		GpioDataRegs.GPACLEAR.bit.GPIO5 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO3 = 1;
-        		GpioDataRegs.GPASET.bit.GPIO2   = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO6 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO7 = 1;
-    		}
-    		else if (counterToggleLeds <= 200)
-    		{
-        		GpioDataRegs.GPACLEAR.bit.GPIO5 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO3 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO2 = 1;
-        		GpioDataRegs.GPASET.bit.GPIO6   = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO7 = 1;
-    		}
-    		else if (counterToggleLeds <= 250)
-    		{
-        		GpioDataRegs.GPACLEAR.bit.GPIO5 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO3 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO2 = 1;
-        		GpioDataRegs.GPACLEAR.bit.GPIO6 = 1;
-        		GpioDataRegs.GPASET.bit.GPIO7   = 1;
-    		}
-
-    		// GPIOs 145, 147, 149 und 151 in Abhngigkeit
-    		// der ADC-Messwerte INA3, INB3, INC3 und IND3
-    		// dimmen. Exponentialfunktion und lineares
-    		// Dimmen am Anfang, damit es frs menschliche
-    		// Auge halbwegs linear wirkt.
-    		// PWM1
-    		if (ADCINA3 < 2000)
-    		{
-    				EPwm1Regs.CMPA.bit.CMPA = ADCINA3/30;
-    		}
-    		else
-    		{
-    				EPwm1Regs.CMPA.bit.CMPA = pow(5000.0, (ADCINA3/4095.0));
-    		}
-    		// PWM2
-    		if (ADCINB3 < 2000)
-    		{
-    				EPwm2Regs.CMPA.bit.CMPA = ADCINB3/30;
-    		}
-    		else
-    		{
-    				EPwm2Regs.CMPA.bit.CMPA = pow(5000.0, (ADCINB3/4095.0));
-    		}
-    		// PWM3
-    		if (ADCINC3 < 2000)
-    		{
-    				EPwm3Regs.CMPA.bit.CMPA = ADCINC3/30;
-    		}
-    		else
-    		{
-    				EPwm3Regs.CMPA.bit.CMPA = pow(5000.0, (ADCINC3/4095.0));
-    		}
-    		// PWM4
-    		if (ADCIND3 < 2000)
-    		{
-    				EPwm4Regs.CMPA.bit.CMPA = ADCIND3/30;
-    		}
-    		else
-    		{
-    				EPwm4Regs.CMPA.bit.CMPA = pow(5000.0, (ADCIND3/4095.0));
-    		}
-
-
     }
 }
 
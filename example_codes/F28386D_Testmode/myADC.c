@@ -9,9 +9,21 @@
 ///						  Ende einer Messung wird ein Interrupt ausgelst und dort der Messwert in eine
 ///							globale Variable kopiert.
 ///
-/// @version    V1.0
+///							nderung in Version 1.1: Synchrone Abtastung (ADC_SYNCHRONOUS_SAMPLING), alle
+///							Module wandeln gleichzeitig und nur eine ISR (AdcSyncISR()) liest alle Messwerte
 ///
-/// @date       09.03.2023
+///							nderung in Version 1.2: Nach dem Lesen aller Messwerte wird eine Abtastung der
+///							Oszilloskop-Aufzeichnung geschrieben (ScopeSample(), myScope.h)
+///
+///							nderung in Version 1.3: Messwerte liegen im LSx-RAM (DEVICE_HOT_DATA())
+///
+///							nderung in Version 1.4: AdcSyncISR() kopiert alle Messwerte in einem Durchlauf
+///							ber die Tabelle "adcSnapshotSource" in das Abbild "adcSnapshot" (LSx-RAM) und
+///							erhht danach dessen Folgenummer. AdcSnapshotRead() liest das Abbild konsistent
+///
+/// @version    V1.4
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -24,11 +36,30 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Messwerte der ADC-Eingnge
+// Messwerte der ADC-Eingnge (werden in jeder ADC-ISR geschrieben, daher im LSx-RAM)
+DEVICE_HOT_DATA(ADCINA3)
 uint16_t ADCINA3 = 0;
+DEVICE_HOT_DATA(ADCINB3)
 uint16_t ADCINB3 = 0;
+DEVICE_HOT_DATA(ADCINC3)
 uint16_t ADCINC3 = 0;
+DEVICE_HOT_DATA(ADCIND3)
 uint16_t ADCIND3 = 0;
+#if ADC_SYNCHRONOUS_SAMPLING
+// Anzahl der synchronen Abtastungen (wird nach dem Lesen aller Messwerte erhht)
+volatile uint32_t adcSyncCount = 0;
+// Abbild der letzten synchronen Abtastung. Der DMA kann nicht auf den LSx-RAM zugreifen,
+// daher kopiert die CPU in der ISR
+DEVICE_HOT_DATA(adcSnapshot)
+volatile AdcSnapshot adcSnapshot = {0};
+// Ergebnisregister der Kanle des Abbilds (Index = ADC_SNAPSHOT_CHANNEL_x). Weitere Kanle
+// werden hier und in myADC.h ergnzt
+static volatile uint16_t * const adcSnapshotSource[ADC_SNAPSHOT_NUMBER_OF_CHANNELS] =
+{
+		&AdcaResultRegs.ADCRESULT0, &AdcbResultRegs.ADCRESULT0,
+		&AdccResultRegs.ADCRESULT0, &AdcdResultRegs.ADCRESULT0
+};
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -304,6 +335,7 @@ void AdcAInit(uint32_t resolution,
     // ADC-Interrupt auslsen, nachdem der Wert
     // in das Result-Register geschrieben wurde
     AdcaRegs.ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+#if !ADC_SYNCHRONOUS_SAMPLING
     // ADCINT1-Interrupt einschalten
     AdcaRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
 		// EOC0 als Trigger fr ADCINT1 setzen
@@ -325,6 +357,11 @@ void AdcAInit(uint32_t resolution,
     IER |= M_INT1;
     // Interrupts global einschalten
     EINT;
+#else
+    // Synchrone Abtastung: Modul A lst keinen Interrupt aus, der Messwert
+    // wird von AdcSyncISR() nach dem Ende der Wandlung von Modul D gelesen
+    AdcaRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_DISABLE;
+#endif
 
 		// Register-Schreibschutz setzen
 		EDIS;
@@ -400,6 +437,7 @@ void AdcBInit(uint32_t resolution,
     // ADC-Interrupt auslsen, nachdem der Wert
     // in das Result-Register geschrieben wurde
     AdcbRegs.ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+#if !ADC_SYNCHRONOUS_SAMPLING
     // ADCINT1-Interrupt einschalten
     AdcbRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
 		// EOC0 als Trigger fr ADCINT1 setzen
@@ -421,6 +459,11 @@ void AdcBInit(uint32_t resolution,
     IER |= M_INT1;
     // Interrupts global einschalten
     EINT;
+#else
+    // Synchrone Abtastung: Modul B lst keinen Interrupt aus, der Messwert
+    // wird von AdcSyncISR() nach dem Ende der Wandlung von Modul D gelesen
+    AdcbRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_DISABLE;
+#endif
 
 		// Register-Schreibschutz setzen
 		EDIS;
@@ -496,6 +539,7 @@ void AdcCInit(uint32_t resolution,
     // ADC-Interrupt auslsen, nachdem der Wert
     // in das Result-Register geschrieben wurde
     AdccRegs.ADCCTL1.bit.INTPULSEPOS = ADC_PULSE_END_OF_CONV;
+#if !ADC_SYNCHRONOUS_SAMPLING
     // ADCINT1-Interrupt einschalten
     AdccRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_ENABLE;
 		// EOC0 als Trigger fr ADCINT1 setzen
@@ -517,6 +561,11 @@ void AdcCInit(uint32_t resolution,
     IER |= M_INT1;
     // Interrupts global einschalten
     EINT;
+#else
+    // Synchrone Abtastung: Modul C lst keinen Interrupt aus, der Messwert
+    // wird von AdcSyncISR() nach dem Ende der Wandlung von Modul D gelesen
+    AdccRegs.ADCINTSEL1N2.bit.INT1E = ADC_INT_DISABLE;
+#endif
 
 		// Register-Schreibschutz setzen
 		EDIS;
@@ -605,7 +654,14 @@ void AdcDInit(uint32_t resolution,
     DINT;
 		// Interrupt-Service-Routinen fr den ADCD1-Interrupt an die
     // entsprechende Stelle (Interrupt) der PIE-Vector Table speichern
+#if ADC_SYNCHRONOUS_SAMPLING
+    // Synchrone Abtastung: Alle Module wandeln mit demselben Trigger und demselben
+    // Abtastzeitfenster, die Wandlungen enden im selben Takt. Nur Modul D lst einen
+    // Interrupt aus, die ISR liest die Messwerte aller vier Module
+    PieVectTable.ADCD1_INT = &AdcSyncISR;
+#else
     PieVectTable.ADCD1_INT = &AdcDInt1ISR;
+#endif
     // ADCD1-Interrupt freischalten (Zeile 1, Spalte 6 der Tabelle 3-2)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
     PieCtrlRegs.PIEIER1.bit.INTx6 = 1;
@@ -630,6 +686,8 @@ void AdcDInit(uint32_t resolution,
 //=================================================================================================
 __interrupt void AdcAInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCA1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -645,6 +703,7 @@ __interrupt void AdcAInt1ISR(void)
 		AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCA1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCA1);
 }
 
 
@@ -659,6 +718,8 @@ __interrupt void AdcAInt1ISR(void)
 //=================================================================================================
 __interrupt void AdcBInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCB1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -674,6 +735,7 @@ __interrupt void AdcBInt1ISR(void)
 		AdcbRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCB1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCB1);
 }
 
 
@@ -688,6 +750,8 @@ __interrupt void AdcBInt1ISR(void)
 //=================================================================================================
 __interrupt void AdcCInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCC1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -703,6 +767,7 @@ __interrupt void AdcCInt1ISR(void)
 		AdccRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCC1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCC1);
 }
 
 
@@ -717,6 +782,8 @@ __interrupt void AdcCInt1ISR(void)
 //=================================================================================================
 __interrupt void AdcDInt1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCD1);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -727,13 +794,88 @@ __interrupt void AdcDInt1ISR(void)
 		//EALLOW;
 		// Messwert auslesen
 		ADCIND3 = AdcdResultRegs.ADCRESULT0;
+		// Abtastung der Aufzeichnung schreiben (Modul D wird als letztes Modul ausgewertet)
+		ScopeSample();
 
     // Interrupt-Flag im ADC-Modul lschen
 		AdcdRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
 		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCD1_INT-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCD1);
+}
+
+
+#if ADC_SYNCHRONOUS_SAMPLING
+//=== Function: AdcSyncISR ========================================================================
+///
+/// @brief	ISR wird aufgerufen, wenn ein ADCINT1-Interrupt (Modul D) bei synchroner Abtastung
+///					ausgelst wurde. Die Messwerte aller vier Module stammen aus demselben Trigger
+///					(ePWM8 SOCA) und werden gemeinsam gelesen. Ersetzt AdcAInt1ISR() bis AdcDInt1ISR()
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void AdcSyncISR(void)
+{
+		uint16_t channel;
+
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_ADCD1);
+
+		// Messwerte aller Module in einem Durchlauf in das Abbild kopieren. Die Folgenummer
+		// wird erst danach erhht, damit AdcSnapshotRead() einen unterbrochenen Lesevorgang
+		// erkennt
+		for (channel = 0; channel < ADC_SNAPSHOT_NUMBER_OF_CHANNELS; channel++)
+		{
+				adcSnapshot.result[channel] = *adcSnapshotSource[channel];
+		}
+		adcSnapshot.sequence++;
+		// Einzelne Messwerte (z.B. fr die Aufzeichnung) aus dem Abbild bernehmen
+		ADCINA3 = adcSnapshot.result[ADC_SNAPSHOT_CHANNEL_INA3];
+		ADCINB3 = adcSnapshot.result[ADC_SNAPSHOT_CHANNEL_INB3];
+		ADCINC3 = adcSnapshot.result[ADC_SNAPSHOT_CHANNEL_INC3];
+		ADCIND3 = adcSnapshot.result[ADC_SNAPSHOT_CHANNEL_IND3];
+		adcSyncCount++;
+		// Abtastung der Aufzeichnung schreiben
+		ScopeSample();
+
+    // Interrupt-Flag im ADC-Modul D lschen (die Module A bis C lsen keinen Interrupt aus)
+		AdcdRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der ADCD1_INT-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_ADCD1);
 }
 
 
+//=== Function: AdcSnapshotRead ===================================================================
+///
+/// @brief	Funktion kopiert das Abbild der letzten synchronen Abtastung nach "copy". Wird der
+///					Lesevorgang von AdcSyncISR() unterbrochen, ndert sich die Folgenummer und das Abbild
+///					wird erneut gelesen. Alle Messwerte in "copy" stammen daher aus derselben Abtastung.
+///					Darf nicht in einer ISR mit hherer Prioritt als AdcSyncISR() aufgerufen werden
+///
+/// @param  AdcSnapshot *copy
+///
+/// @return uint32_t Folgenummer der kopierten Abtastung
+///
+//=================================================================================================
+uint32_t AdcSnapshotRead(AdcSnapshot *copy)
+{
+		uint32_t sequence;
+		uint16_t channel;
 
+		do
+		{
+				sequence = adcSnapshot.sequence;
+				for (channel = 0; channel < ADC_SNAPSHOT_NUMBER_OF_CHANNELS; channel++)
+				{
+						copy->result[channel] = adcSnapshot.result[channel];
+				}
+		} while (sequence != adcSnapshot.sequence);
+		copy->sequence = sequence;
+
+		return sequence;
+}
 
+#endif
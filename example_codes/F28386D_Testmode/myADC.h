@@ -9,7 +9,18 @@
 ///						  Ende einer Messung wird ein Interrupt ausgelst und dort der Messwert in eine
 ///							globale Variable kopiert.
 ///
-/// @version    V1.0
+///							nderung in Version 1.1: Synchrone Abtastung (ADC_SYNCHRONOUS_SAMPLING), alle
+///							Module wandeln gleichzeitig und nur eine ISR (AdcSyncISR()) liest alle Messwerte
+///
+///							nderung in Version 1.2: Nach dem Lesen aller Messwerte wird eine Abtastung der
+///							Oszilloskop-Aufzeichnung geschrieben (ScopeSample(), myScope.h)
+///
+///							nderung in Version 1.3: Bei synchroner Abtastung kopiert AdcSyncISR() alle
+///							Messwerte in einem Durchlauf in das Abbild "adcSnapshot" im LSx-RAM (nach Kanal
+///							sortiert, mit Folgenummer). AdcSnapshotRead() liefert der Regelung einen
+///							zusammengehrigen Satz aller Messwerte ohne Zugriff auf die ADC-Register
+///
+/// @version    V1.3
 ///
 /// @date       09.03.2023
 ///
@@ -22,6 +33,7 @@
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
 #include "myPWM.h"
+#include "myScope.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -172,6 +184,18 @@
 // Interrupt-Impulserzeugung
 #define ADC_INT_PULSE_ONE_SHOT							0
 #define ADC_INT_PULSE_CONTINOUS							1
+// Synchrone Abtastung
+// 1: Alle Module wandeln mit demselben ePWM8-Trigger, nur Modul D lst einen Interrupt
+//    aus und AdcSyncISR() liest die Messwerte aller Module (ein PIE-Interrupt pro Periode)
+// 0: Jedes Modul lst einen eigenen Interrupt aus (AdcAInt1ISR() bis AdcDInt1ISR())
+#define ADC_SYNCHRONOUS_SAMPLING						1
+// Kanle des Abbilds "adcSnapshot" (Index in AdcSnapshot.result, Quelle siehe
+// "adcSnapshotSource" in myADC.c)
+#define ADC_SNAPSHOT_CHANNEL_INA3						0
+#define ADC_SNAPSHOT_CHANNEL_INB3						1
+#define ADC_SNAPSHOT_CHANNEL_INC3						2
+#define ADC_SNAPSHOT_CHANNEL_IND3						3
+#define ADC_SNAPSHOT_NUMBER_OF_CHANNELS			4
 
 
 //-------------------------------------------------------------------------------------------------
@@ -199,6 +223,17 @@
 #define ADC_D_INLTRIM_OTP_ADDR_START	((uint32_t *)0x7014C)
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Abbild aller Messwerte einer synchronen Abtastung
+typedef struct
+{
+		uint32_t sequence;																	// Folgenummer (wird nach den Messwerten erhht)
+		uint16_t result[ADC_SNAPSHOT_NUMBER_OF_CHANNELS];		// Messwerte, Index ADC_SNAPSHOT_CHANNEL_x
+} AdcSnapshot;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
@@ -207,6 +242,12 @@ extern uint16_t ADCINA3;
 extern uint16_t ADCINB3;
 extern uint16_t ADCINC3;
 extern uint16_t ADCIND3;
+// Anzahl der synchronen Abtastungen
+extern volatile uint32_t adcSyncCount;
+#if ADC_SYNCHRONOUS_SAMPLING
+// Abbild der letzten synchronen Abtastung (LSx-RAM, wird von AdcSyncISR() geschrieben)
+extern volatile AdcSnapshot adcSnapshot;
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -239,6 +280,12 @@ __interrupt void AdcBInt1ISR(void);
 __interrupt void AdcCInt1ISR(void);
 // Interrupt-Service-Routine fr den ADCINT1 (Modul D)
 __interrupt void AdcDInt1ISR(void);
+// Interrupt-Service-Routine fr die synchrone Abtastung (ADCINT1 Modul D, alle Module)
+__interrupt void AdcSyncISR(void);
+#if ADC_SYNCHRONOUS_SAMPLING
+// Funktion kopiert einen zusammengehrigen Satz aller Messwerte aus "adcSnapshot"
+extern uint32_t AdcSnapshotRead(AdcSnapshot *copy);
+#endif
 
 
 #endif
@@ -0,0 +1,140 @@
+//=================================================================================================
+/// @file       myInterrupt.c
+///
+/// @brief      Datei enthlt Funktionen und Makros um Interrupt-Service-Routinen (ISR) nach
+///							Prioritt zu verschachteln. Die Prioritten werden in der Tabelle
+///							"interruptPriorityTable" festgelegt, siehe myInterrupt.h
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myInterrupt.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// PIEIER-Register einer Gruppe (PIEIERx und PIEIFRx folgen abwechselnd auf PIEIER1)
+#define INTERRUPT_PIEIER(group)					((&PieCtrlRegs.PIEIER1.all)[2 * ((group) - 1)])
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Prioritten aller Interrupts (Zeile und Spalte siehe Tabelle 3-2, S. 150 Reference Manual
+// TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die ADC-Interrupts der Regelung haben die
+// hchste Prioritt, die Kommunikation die niedrigste
+const InterruptPriority interruptPriorityTable[INTERRUPT_NUMBER_OF_IDS] =
+{
+		{1,  1, INTERRUPT_PRIORITY_CONTROL},	// INTERRUPT_ID_ADCA1
+		{1,  2, INTERRUPT_PRIORITY_CONTROL},	// INTERRUPT_ID_ADCB1
+		{1,  3, INTERRUPT_PRIORITY_CONTROL},	// INTERRUPT_ID_ADCC1
+		{1,  6, INTERRUPT_PRIORITY_CONTROL},	// INTERRUPT_ID_ADCD1
+		{1,  4, INTERRUPT_PRIORITY_HIGH},			// INTERRUPT_ID_XINT1
+		{3,  8, INTERRUPT_PRIORITY_MEDIUM},		// INTERRUPT_ID_PWM8
+		{1,  7, INTERRUPT_PRIORITY_MEDIUM},		// INTERRUPT_ID_TIMER0
+		{9,  1, INTERRUPT_PRIORITY_LOW},			// INTERRUPT_ID_UART_RX
+		{9,  2, INTERRUPT_PRIORITY_LOW}				// INTERRUPT_ID_UART_TX
+};
+// Berechnete Masken aller Interrupts
+InterruptMask interruptMasks[INTERRUPT_NUMBER_OF_IDS];
+// Aktuelle und maximale Verschachtelungstiefe
+volatile uint16_t interruptNestingDepth = 0;
+uint16_t interruptNestingMax = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: InterruptInitPriorities ===========================================================
+///
+/// @brief	Funktion berechnet fr jeden Interrupt der Tabelle die Masken, die whrend seiner ISR
+///					gelten: in IER die CPU-Gruppen und in PIEIER der eigenen Gruppe die Spalten aller
+///					Interrupts mit hherer Prioritt. Interrupts mit gleicher oder niedrigerer Prioritt
+///					bleiben gesperrt. Muss vor dem Freischalten der Interrupts (EINT) aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void InterruptInitPriorities(void)
+{
+		for (uint16_t id = 0; id < INTERRUPT_NUMBER_OF_IDS; id++)
+		{
+				const InterruptPriority *self = &interruptPriorityTable[id];
+
+				interruptMasks[id].ier = 0;
+				interruptMasks[id].pieier = 0;
+				for (uint16_t other = 0; other < INTERRUPT_NUMBER_OF_IDS; other++)
+				{
+						const InterruptPriority *p = &interruptPriorityTable[other];
+
+						if (p->priority <= self->priority)
+								continue;
+						interruptMasks[id].ier |= 1U << (p->group - 1);
+						if (p->group == self->group)
+								interruptMasks[id].pieier |= 1U << (p->column - 1);
+				}
+		}
+		interruptNestingDepth = 0;
+		interruptNestingMax = 0;
+}
+
+//=== Function: InterruptNestEnter ================================================================
+///
+/// @brief	Funktion sperrt in der eigenen PIE-Gruppe alle Spalten ohne hhere Prioritt, sperrt
+///					in IER alle CPU-Gruppen ohne hhere Prioritt, quittiert die eigene Gruppe und gibt
+///					die Interrupts frei (EINT). Wird von INTERRUPT_NEST_ENTRY() aufgerufen und gibt den
+///					vorherigen Wert des PIEIER-Registers zurck. IER muss nicht gesichert werden, es
+///					wird beim Verlassen der ISR automatisch wiederhergestellt
+///
+/// @param  uint16_t id
+///
+/// @return uint16_t savedPieIer
+///
+//=================================================================================================
+#pragma CODE_SECTION(InterruptNestEnter, ".TI.ramfunc");
+uint16_t InterruptNestEnter(uint16_t id)
+{
+		uint16_t group = interruptPriorityTable[id].group;
+		uint16_t saved = INTERRUPT_PIEIER(group);
+
+		// Interrupts sind beim Eintritt in die ISR gesperrt (INTM = 1)
+		INTERRUPT_PIEIER(group) = saved & interruptMasks[id].pieier;
+		IER &= interruptMasks[id].ier;
+		// Warten, bis ein bereits weitergeleiteter Interrupt der Gruppe die PIE verlassen hat
+		__asm(" RPT #5 || NOP");
+		PieCtrlRegs.PIEACK.all = 1U << (group - 1);
+
+		if (++interruptNestingDepth > interruptNestingMax)
+				interruptNestingMax = interruptNestingDepth;
+		EINT;
+
+		return saved;
+}
+
+//=== Function: InterruptNestExit =================================================================
+///
+/// @brief	Funktion sperrt die Interrupts wieder (DINT) und stellt den PIEIER-Wert vor
+///					INTERRUPT_NEST_ENTRY() wieder her. Wird von INTERRUPT_NEST_EXIT() vor dem Quittieren
+///					der ISR aufgerufen
+///
+/// @param  uint16_t id, uint16_t savedPieIer
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(InterruptNestExit, ".TI.ramfunc");
+void InterruptNestExit(uint16_t id, uint16_t savedPieIer)
+{
+		DINT;
+		interruptNestingDepth--;
+		INTERRUPT_PIEIER(interruptPriorityTable[id].group) = savedPieIer;
+}
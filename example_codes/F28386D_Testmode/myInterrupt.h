@@ -0,0 +1,119 @@
+//=================================================================================================
+/// @file       myInterrupt.h
+///
+/// @brief      Datei enthlt Funktionen und Makros um Interrupt-Service-Routinen (ISR) nach
+///							Prioritt zu verschachteln. Ohne Verschachtelung sperrt jede ISR alle anderen
+///							Interrupts bis zu ihrem Ende, eine lange Kommunikations-ISR (z.B. UART) verzgert
+///							so die ADC-Interrupts. In der Tabelle "interruptPriorityTable" (myInterrupt.c)
+///							wird jedem Interrupt eine Prioritt zugeordnet. InterruptInitPriorities()
+///							berechnet daraus fr jeden Interrupt die Masken fr IER (CPU-Gruppen) und PIEIER
+///							(Spalten der eigenen Gruppe), die whrend seiner ISR freigegeben bleiben: nur
+///							Interrupts mit hherer Prioritt. Eine ISR, die unterbrochen werden darf, ruft
+///							am Anfang INTERRUPT_NEST_ENTRY() und vor dem Quittieren INTERRUPT_NEST_EXIT() mit
+///							ihrer ID auf. ISRs der hchsten Prioritt brauchen die Makros nicht.
+///							Die maximale Verzgerung eines Interrupts der hchsten Prioritt ist damit die
+///							lngste Zeit, in der Interrupts gesperrt sind (Kontextsicherung einer ISR bis
+///							INTERRUPT_NEST_ENTRY() bzw. kurze DINT-Abschnitte), nicht mehr die Laufzeit der
+///							lngsten ISR. Die maximale Verschachtelungstiefe kann im Debugger ber
+///							"interruptNestingMax" angezeigt werden. Die mit myProfile.h gemessene Laufzeit
+///							einer unterbrechbaren ISR enthlt die Laufzeit der ISRs, die sie unterbrochen
+///							haben.
+///							Mit INTERRUPT_NESTING_ENABLE = 0 werden die Makros leer und alle ISRs laufen
+///							wieder ohne Verschachtelung.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYINTERRUPT_H_
+#define MYINTERRUPT_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Verschachtelung ein- (1) oder ausschalten (0)
+#define INTERRUPT_NESTING_ENABLE				1
+// IDs der Interrupts (Index in "interruptPriorityTable")
+#define INTERRUPT_ID_ADCA1							0
+#define INTERRUPT_ID_ADCB1							1
+#define INTERRUPT_ID_ADCC1							2
+#define INTERRUPT_ID_ADCD1							3
+#define INTERRUPT_ID_XINT1							4
+#define INTERRUPT_ID_PWM8								5
+#define INTERRUPT_ID_TIMER0							6
+#define INTERRUPT_ID_UART_RX						7
+#define INTERRUPT_ID_UART_TX						8
+// Anzahl an Interrupts in der Tabelle
+#define INTERRUPT_NUMBER_OF_IDS					9
+// Prioritten (je grer, desto wichtiger)
+#define INTERRUPT_PRIORITY_LOW					1
+#define INTERRUPT_PRIORITY_MEDIUM				2
+#define INTERRUPT_PRIORITY_HIGH					3
+#define INTERRUPT_PRIORITY_CONTROL			4
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#if INTERRUPT_NESTING_ENABLE
+// Am Anfang der ISR aufrufen (legt die lokale Variable "interruptSavedPieIer" an) und
+// Interrupts mit hherer Prioritt freigeben
+#define INTERRUPT_NEST_ENTRY(id)				uint16_t interruptSavedPieIer = InterruptNestEnter(id)
+// Vor dem Quittieren der ISR aufrufen (sperrt die Interrupts wieder)
+#define INTERRUPT_NEST_EXIT(id)					InterruptNestExit((id), interruptSavedPieIer)
+#else
+#define INTERRUPT_NEST_ENTRY(id)
+#define INTERRUPT_NEST_EXIT(id)
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Eintrag der Priorittentabelle
+typedef struct
+{
+		uint16_t group;												// PIE-Gruppe (1 bis 12)
+		uint16_t column;											// Spalte in der Gruppe (1 bis 16)
+		uint16_t priority;										// INTERRUPT_PRIORITY_...
+} InterruptPriority;
+
+// Berechnete Masken eines Interrupts
+typedef struct
+{
+		uint16_t ier;													// whrend der ISR freigegebene CPU-Gruppen
+		uint16_t pieier;											// freigegebene Spalten der eigenen Gruppe
+} InterruptMask;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Prioritten aller Interrupts
+extern const InterruptPriority interruptPriorityTable[INTERRUPT_NUMBER_OF_IDS];
+// Berechnete Masken aller Interrupts
+extern InterruptMask interruptMasks[INTERRUPT_NUMBER_OF_IDS];
+// Aktuelle und maximale Verschachtelungstiefe
+extern volatile uint16_t interruptNestingDepth;
+extern uint16_t interruptNestingMax;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion berechnet die Masken aller Interrupts aus der Priorittentabelle
+extern void InterruptInitPriorities(void);
+// Funktion wird von INTERRUPT_NEST_ENTRY() aufgerufen
+extern uint16_t InterruptNestEnter(uint16_t id);
+// Funktion wird von INTERRUPT_NEST_EXIT() aufgerufen
+extern void InterruptNestExit(uint16_t id, uint16_t savedPieIer);
+
+
+#endif
@@ -0,0 +1,174 @@
+//=================================================================================================
+/// @file       myLoad.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die CPU-Last aus einem kalibrierten
+///							Leerlaufzhler und den Laufzeiten der ISRs (myProfile.h) zu bestimmen, siehe
+///							myLoad.h
+///
+///							nderung in Version 1.1: Schlafzeit im Low-Power-Modus als Leerlauf
+///
+///							nderung in Version 1.2: Die Lnge des Messfensters wird mit dem aktuellen
+///							Systemtakt (DeviceSetSysclk()) in ms umgerechnet
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myLoad.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnis des letzten Messfensters
+LoadReport loadReport;
+// Leerlauf-Durchlufe im laufenden Messfenster
+volatile uint32_t loadIdleCount = 0;
+// Takte fr LOAD_CALIBRATION_LOOPS Leerlauf-Durchlufe
+uint32_t loadCalibrationCycles = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel (CPU-Timer 2) vom Beginn des Messfensters
+static uint32_t loadWindowStart = 0;
+// Summe der ISR-Laufzeiten jedes Slots zu Beginn des Messfensters
+static uint64_t loadIsrCyclesStart[PROFILE_NUMBER_OF_SLOTS];
+// Summe der Schlafzeiten (myLowPower.h) zu Beginn des Messfensters
+static uint64_t loadSleepCyclesStart = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LoadShare =========================================================================
+///
+/// @brief	Funktion gibt den Anteil von "cycles" an "windowCycles" in 0,01 % zurck (begrenzt
+///					auf 100 %)
+///
+/// @param  uint64_t cycles, uint32_t windowCycles
+///
+/// @return uint16_t share
+///
+//=================================================================================================
+static uint16_t LoadShare(uint64_t cycles, uint32_t windowCycles)
+{
+		uint64_t share;
+
+		if (windowCycles == 0)
+				return 0;
+		share = (cycles * LOAD_FULL_SCALE) / windowCycles;
+		return (share > LOAD_FULL_SCALE) ? LOAD_FULL_SCALE : (uint16_t)share;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LoadCalibrate =====================================================================
+///
+/// @brief	Funktion fhrt LOAD_CALIBRATION_LOOPS Durchlufe der Dauerschleife mit gesperrten
+///					Interrupts aus und misst deren Dauer. "background" muss denselben Code ausfhren wie
+///					die Dauerschleife vor LoadIdle() und sollte dabei nichts zu tun haben (z.B. vor
+///					SchedulerStart() aufrufen). Anschlieend beginnt das erste Messfenster
+///
+/// @param  LoadBackgroundFunction background
+///
+/// @return void
+///
+//=================================================================================================
+void LoadCalibrate(LoadBackgroundFunction background)
+{
+		uint16_t interruptState;
+		uint32_t start;
+
+		interruptState = __disable_interrupts();
+		loadIdleCount = 0;
+		start = PROFILE_TIMESTAMP();
+		for (uint32_t i = 0; i < LOAD_CALIBRATION_LOOPS; i++)
+		{
+				if (!background())
+						LoadIdle();
+		}
+		loadCalibrationCycles = PROFILE_TIMESTAMP() - start;
+		__restore_interrupts(interruptState);
+
+		for (uint16_t slot = 0; slot < PROFILE_NUMBER_OF_SLOTS; slot++)
+				loadIsrCyclesStart[slot] = profileSlots[slot].cyclesSum;
+		loadSleepCyclesStart = lowPowerStats.sleepCycles;
+		loadIdleCount = 0;
+		loadWindowStart = PROFILE_TIMESTAMP();
+}
+
+//=== Function: LoadUpdate ========================================================================
+///
+/// @brief	Funktion beendet das laufende Messfenster und berechnet "loadReport": Leerlauf aus
+///					der Anzahl der Leerlauf-Durchlufe und der Kalibrierung zuzglich der Schlafzeit im
+///					Low-Power-Modus, CPU-Last, Anteil jeder ISR
+///					und der CLA. Sollte zyklisch (z.B. von einer 10 Hz-Task des Schedulers) aufgerufen
+///					werden, das Messfenster darf hchstens 21 s (32 Bit-Zeitstempel) lang sein
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void LoadUpdate(void)
+{
+		uint32_t now = PROFILE_TIMESTAMP();
+		uint32_t windowCycles = now - loadWindowStart;
+		uint32_t idleCount = loadIdleCount;
+		uint64_t sleepCycles = lowPowerStats.sleepCycles;
+		uint64_t idleCycles;
+		uint32_t isrTotal = 0;
+
+		loadIdleCount = 0;
+		loadWindowStart = now;
+
+		idleCycles = ((uint64_t)idleCount * loadCalibrationCycles) / LOAD_CALIBRATION_LOOPS;
+		idleCycles += sleepCycles - loadSleepCyclesStart;
+		loadSleepCyclesStart = sleepCycles;
+		loadReport.idle = LoadShare(idleCycles, windowCycles);
+		loadReport.cpu = LOAD_FULL_SCALE - loadReport.idle;
+		loadReport.windowMs = windowCycles / (deviceSysclkMhz * 1000UL);
+
+		for (uint16_t slot = 0; slot < PROFILE_NUMBER_OF_SLOTS; slot++)
+		{
+				uint64_t cyclesSum = profileSlots[slot].cyclesSum;
+
+				loadReport.isr[slot] = LoadShare(cyclesSum - loadIsrCyclesStart[slot], windowCycles);
+				loadIsrCyclesStart[slot] = cyclesSum;
+				isrTotal += loadReport.isr[slot];
+		}
+		loadReport.cla = loadReport.isr[PROFILE_SLOT_CLA_TASK1]
+									 + loadReport.isr[PROFILE_SLOT_CLA_TASK2]
+									 + loadReport.isr[PROFILE_SLOT_CLA_TASK3];
+		// Die CLA luft parallel zur CPU und zhlt nicht zur CPU-Last
+		isrTotal -= loadReport.cla;
+		loadReport.isrTotal = (isrTotal > LOAD_FULL_SCALE) ? LOAD_FULL_SCALE : isrTotal;
+		loadReport.background = (loadReport.cpu > loadReport.isrTotal)
+													? (loadReport.cpu - loadReport.isrTotal) : 0;
+}
+
+//=== Function: LoadSendReport ====================================================================
+///
+/// @brief	Funktion sendet "loadReport" als Telemetrie-Rahmen vom Typ LOAD_TELEMETRY_TYPE (alle
+///					Werte als 16 Bit-Werte Little-Endian in der Reihenfolge der Struktur). Gibt false
+///					zurck, falls der Sende-Ringpuffer zu voll ist
+///
+/// @param  void
+///
+/// @return bool sent
+///
+//=================================================================================================
+bool LoadSendReport(void)
+{
+		return TelemetrySendWords(LOAD_TELEMETRY_TYPE, (const uint16_t *)&loadReport,
+															sizeof(LoadReport));
+}
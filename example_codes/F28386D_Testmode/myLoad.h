@@ -0,0 +1,105 @@
+//=================================================================================================
+/// @file       myLoad.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die CPU-Last zu bestimmen. In der
+///							Dauerschleife des Hauptprogramms wird LoadIdle() immer dann aufgerufen, wenn im
+///							Hintergrund nichts zu tun war. LoadCalibrate() misst beim Start mit gesperrten
+///							Interrupts, wie viele Takte ein solcher Leerlauf-Durchlauf dauert. Aus der Anzahl
+///							der Leerlauf-Durchlufe in einem Messfenster ergibt sich damit die Leerlaufzeit
+///							und die CPU-Last (100 % - Leerlauf). Zustzlich wird die Laufzeit jeder ISR aus
+///							den Messwerten von myProfile.h ("profileSlots[].cyclesSum") dem Messfenster
+///							zugeordnet, die Summe der CLA-Slots ergibt die Last der CLA. Das Messfenster
+///							endet mit jedem Aufruf von LoadUpdate(). Alle Werte stehen in 0,01 % in der
+///							Struktur "loadReport" (im Debugger sichtbar) und knnen mit LoadSendReport() als
+///							Telemetrie-Rahmen ber die UART-Schnittstelle gesendet werden.
+///							Fr CPU2 wird dieselbe Datei im Projekt von CPU2 eingebunden, die Werte gelten
+///							jeweils fr den Kern, auf dem sie laufen.
+///							Hinweis: Bei verschachtelten ISRs (myInterrupt.h) enthlt die Laufzeit einer
+///							unterbrochenen ISR die Laufzeit der unterbrechenden ISR, die Summe "isrTotal"
+///							ist dann zu gro. Die CPU-Last aus dem Leerlaufzhler ist davon nicht betroffen.
+///
+///							nderung in Version 1.1: Die Schlafzeit im Low-Power-Modus (myLowPower.h,
+///							"lowPowerStats.sleepCycles") zhlt zum Leerlauf
+///
+///							nderung in Version 1.2: Die Lnge des Messfensters wird mit dem aktuellen
+///							Systemtakt (DeviceSetSysclk()) in ms umgerechnet
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYLOAD_H_
+#define MYLOAD_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myTelemetry.h"
+#include "myLowPower.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Leerlauf-Durchlufe bei der Kalibrierung
+#define LOAD_CALIBRATION_LOOPS					1000UL
+// 100 % in der Einheit 0,01 %
+#define LOAD_FULL_SCALE									10000U
+// Rahmen-Typ des Telemetrie-Rahmens mit "loadReport"
+#define LOAD_TELEMETRY_TYPE							TELEMETRY_TYPE_CPU_LOAD
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// In der Dauerschleife aufrufen, wenn im Hintergrund nichts zu tun war
+#define LoadIdle()											(loadIdleCount++)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Funktion fr einen Durchlauf des Hintergrunds, gibt true zurck, falls etwas zu tun war
+typedef bool (*LoadBackgroundFunction)(void);
+
+// Ergebnis eines Messfensters (alle Anteile in 0,01 %, nur 16 Bit-Werte, damit die Struktur
+// direkt als Telemetrie-Rahmen gesendet werden kann)
+typedef struct
+{
+		uint16_t cpu;													// CPU-Last (100 % - Leerlauf)
+		uint16_t idle;												// Leerlauf
+		uint16_t isrTotal;										// Summe aller ISRs
+		uint16_t background;									// Hintergrund ohne Leerlauf (cpu - isrTotal)
+		uint16_t cla;													// Summe der CLA-Slots
+		uint16_t windowMs;										// Lnge des Messfensters in ms
+		uint16_t isr[PROFILE_NUMBER_OF_SLOTS];// Anteil jeder ISR (Slots siehe myProfile.h)
+} LoadReport;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnis des letzten Messfensters
+extern LoadReport loadReport;
+// Leerlauf-Durchlufe im laufenden Messfenster
+extern volatile uint32_t loadIdleCount;
+// Takte fr LOAD_CALIBRATION_LOOPS Leerlauf-Durchlufe
+extern uint32_t loadCalibrationCycles;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion misst die Dauer eines Leerlauf-Durchlaufs und startet das erste Messfenster
+// (ProfileInit() muss vorher aufgerufen worden sein)
+extern void LoadCalibrate(LoadBackgroundFunction background);
+// Funktion beendet das Messfenster, berechnet "loadReport" und startet ein neues Messfenster
+extern void LoadUpdate(void);
+// Funktion sendet "loadReport" als Telemetrie-Rahmen
+extern bool LoadSendReport(void);
+
+
+#endif
@@ -7,9 +7,18 @@
 ///							= 50 kHz) jeweils am Kanal A augeben. Das PWM-Modul 8 erzeugt alle 10 ms einen
 ///							Interrupt sowie einen ADC-Trigger zum Starten einer Messung.
 ///
-/// @version    V1.2
+///							nderung in Version 1.3: Der Zhler "counterToggleLeds" fr das Lauflicht
+///							entfllt, das Lauflicht luft als Task im Scheduler (myScheduler.h)
 ///
-/// @date       09.03.2023
+///							nderung in Version 1.4: "Pwm8ISR()" kann von Interrupts mit hherer Prioritt
+///							(ADC) unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 1.5: Periode und Vergleichswerte von ePWM1 bis ePWM4 und ePWM8
+///							werden nach einer nderung des Systemtakts (DeviceSetSysclk()) umgerechnet
+///
+/// @version    V1.5
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -20,10 +29,41 @@
 
 
 //-------------------------------------------------------------------------------------------------
-// Global variables
+// Local functions
 //-------------------------------------------------------------------------------------------------
-// Zhler zum Blinken der LEDs auf dem Control-Board
-uint16_t counterToggleLeds = 0;
+//=== Function: PwmClockChangedPWM1To4 ============================================================
+///
+/// @brief  Funktion wird von DeviceSetSysclk() nach einer nderung des Systemtakts aufgerufen und
+///					rechnet Periode und Vergleichswerte von ePWM1 bis ePWM4 um (gleiche Frequenz und
+///					gleicher Tastgrad)
+///
+/// @param  uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+static void PwmClockChangedPWM1To4(uint16_t oldMhz, uint16_t newMhz)
+{
+		DeviceScaleEpwm(&EPwm1Regs, oldMhz, newMhz);
+		DeviceScaleEpwm(&EPwm2Regs, oldMhz, newMhz);
+		DeviceScaleEpwm(&EPwm3Regs, oldMhz, newMhz);
+		DeviceScaleEpwm(&EPwm4Regs, oldMhz, newMhz);
+}
+
+//=== Function: PwmClockChangedPwm8 ===============================================================
+///
+/// @brief  Funktion wird von DeviceSetSysclk() nach einer nderung des Systemtakts aufgerufen und
+///					rechnet die Periode von ePWM8 um, damit Interrupt und ADC-Trigger alle 10 ms bleiben
+///
+/// @param  uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+static void PwmClockChangedPwm8(uint16_t oldMhz, uint16_t newMhz)
+{
+		DeviceScaleEpwm(&EPwm8Regs, oldMhz, newMhz);
+}
 
 
 //-------------------------------------------------------------------------------------------------
@@ -295,6 +335,9 @@ void PwmInitPWM1To4(void)
 
 		// Register-Schreibschutz setzen
 		EDIS;
+
+		// Periode bei einer nderung des Systemtakts anpassen
+		DeviceRegisterClockCallback(&PwmClockChangedPWM1To4);
 }
 
 
@@ -381,12 +424,15 @@ void PwmInitPwm8(void)
     CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
 		// Register-Schreibschutz setzen
 		EDIS;
+
+		// Periode bei einer nderung des Systemtakts anpassen
+		DeviceRegisterClockCallback(&PwmClockChangedPwm8);
 }
 
 
 //=== Function: Pwm8ISR ===========================================================================
 ///
-/// @brief  ISR wird alle 100 ms aufgerufen. Wird als ADC-Trigger und Zeitgeber verwendet
+/// @brief  ISR wird alle 10 ms aufgerufen. Das ePWM8-Modul wird als ADC-Trigger verwendet
 ///
 /// @param  void
 ///
@@ -395,6 +441,9 @@ void PwmInitPwm8(void)
 //=================================================================================================
 __interrupt void Pwm8ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_PWM8);
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_PWM8);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -403,20 +452,14 @@ __interrupt void Pwm8ISR(void)
 		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
-		// Zhler zum Blinken der LEDs auf dem Control-Board hochzhlen
-		if (counterToggleLeds < PWM_FINAL_COUNTER_LEDS)
-		{
-				counterToggleLeds++;
-		}
-		else
-		{
-				counterToggleLeds = 1;
-		}
 
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_PWM8);
     // Interrupt-Flag im ePWM8-Modul lschen
 		EPwm8Regs.ETCLR.bit.INT = 1;
     // Interrupt-Flag der Gruppe 3 lschen (da gehrt der ePMW8-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK3 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_PWM8);
 }
 
 
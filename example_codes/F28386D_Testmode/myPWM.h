@@ -7,9 +7,18 @@
 ///							= 50 kHz) jeweils am Kanal A augeben. Das PWM-Modul 8 erzeugt alle 10 ms einen
 ///							Interrupt sowie einen ADC-Trigger zum Starten einer Messung.
 ///
-/// @version    V1.2
+///							nderung in Version 1.3: Der Zhler "counterToggleLeds" fr das Lauflicht
+///							entfllt, das Lauflicht luft als Task im Scheduler (myScheduler.h)
 ///
-/// @date       09.03.2023
+///							nderung in Version 1.4: "Pwm8ISR()" kann von Interrupts mit hherer Prioritt
+///							(ADC) unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 1.5: Periode und Vergleichswerte von ePWM1 bis ePWM4 und ePWM8
+///							werden nach einer nderung des Systemtakts (DeviceSetSysclk()) umgerechnet
+///
+/// @version    V1.5
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -19,6 +28,8 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
+#include "myInterrupt.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -206,9 +217,6 @@
 #define PWM_ET_CTRU_CMPB   					 				6
 #define PWM_ET_CTRD_CMPB    								7
 
-// Endwert des Zhlers zum Blinken der LEDs auf dem Control-Board
-#define PWM_FINAL_COUNTER_LEDS							250
-
 
 //-------------------------------------------------------------------------------------------------
 // Macros
@@ -218,8 +226,6 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Zhler zum Blinken der LEDs auf dem Control-Board
-extern uint16_t counterToggleLeds;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,159 @@
+//=================================================================================================
+/// @file       myPattern.c
+///
+/// @brief      Datei enthlt den tabellengesteuerten Ablauf fr LED-Muster, siehe myPattern.h.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myPattern.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile uint32_t patternPortWrites = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Set- und Clear-Register der Ports (Index PATTERN_PORT_x)
+static volatile uint32_t * const patternSetRegs[PATTERN_NUMBER_OF_PORTS] =
+{
+		&GpioDataRegs.GPASET.all, &GpioDataRegs.GPBSET.all
+};
+static volatile uint32_t * const patternClearRegs[PATTERN_NUMBER_OF_PORTS] =
+{
+		&GpioDataRegs.GPACLEAR.all, &GpioDataRegs.GPBCLEAR.all
+};
+// Aktuelles Muster, Schritt und verbleibende Aufrufe bis zum nchsten Schritt
+static const PatternStep *patternSteps = 0;
+static uint16_t patternNumberOfSteps = 0;
+static uint16_t patternIndex = 0;
+static uint16_t patternRemaining = 0;
+// Zuletzt geschriebener Zustand der GPIOs je Port
+static uint32_t patternState[PATTERN_NUMBER_OF_PORTS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: PatternApply ======================================================================
+///
+/// @brief  Funktion schaltet die GPIOs aller Ports vom Zustand "patternState" auf "mask". Nur die
+///					Bits, die sich ndern, werden geschrieben, ein Port ohne nderung wird nicht
+///					angesprochen
+///
+/// @param  const uint32_t *mask
+///
+/// @return void
+///
+//=================================================================================================
+static void PatternApply(const uint32_t *mask)
+{
+		uint16_t port;
+
+		for (port = 0; port < PATTERN_NUMBER_OF_PORTS; port++)
+		{
+				uint32_t clear = patternState[port] & ~mask[port];
+				uint32_t set   = mask[port] & ~patternState[port];
+
+				if (clear != 0)
+				{
+						*patternClearRegs[port] = clear;
+						patternPortWrites++;
+				}
+				if (set != 0)
+				{
+						*patternSetRegs[port] = set;
+						patternPortWrites++;
+				}
+				patternState[port] = mask[port];
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: PatternStart ======================================================================
+///
+/// @brief  Funktion startet das Muster "steps" mit "numberOfSteps" Schritten. Alle GPIOs, die in
+///					einem der Schritte vorkommen, werden ausgeschaltet und die GPIOs des ersten Schritts
+///					eingeschaltet. Die GPIOs mssen als Ausgnge konfiguriert sein (GpioInit()). Vor dem
+///					Start des Schedulers oder aus derselben Task wie PatternTick() aufrufen
+///
+/// @param  const PatternStep *steps, uint16_t numberOfSteps
+///
+/// @return void
+///
+//=================================================================================================
+void PatternStart(const PatternStep *steps, uint16_t numberOfSteps)
+{
+		uint16_t port;
+		uint16_t step;
+
+		patternSteps = 0;
+		if ((steps == 0) || (numberOfSteps == 0))
+		{
+				return;
+		}
+
+		// Zustand unbekannt: alle GPIOs des Musters gelten als eingeschaltet, PatternApply()
+		// schaltet die nicht bentigten aus
+		for (port = 0; port < PATTERN_NUMBER_OF_PORTS; port++)
+		{
+				patternState[port] = 0;
+				for (step = 0; step < numberOfSteps; step++)
+				{
+						patternState[port] |= steps[step].mask[port];
+				}
+		}
+		patternPortWrites = 0;
+		PatternApply(steps[0].mask);
+
+		patternIndex = 0;
+		patternRemaining = steps[0].duration;
+		patternNumberOfSteps = numberOfSteps;
+		patternSteps = steps;
+}
+
+
+//=== Function: PatternTick =======================================================================
+///
+/// @brief  Funktion zhlt die Dauer des aktuellen Schritts herunter und schaltet danach auf den
+///					nchsten Schritt (nach dem letzten wieder auf den ersten). Ohne Wechsel wird kein
+///					GPIO-Register geschrieben
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void PatternTick(void)
+{
+		if (patternSteps == 0)
+		{
+				return;
+		}
+
+		if (patternRemaining > 1)
+		{
+				patternRemaining--;
+				return;
+		}
+
+		if (++patternIndex >= patternNumberOfSteps)
+		{
+				patternIndex = 0;
+		}
+		PatternApply(patternSteps[patternIndex].mask);
+		patternRemaining = patternSteps[patternIndex].duration;
+}
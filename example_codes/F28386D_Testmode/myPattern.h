@@ -0,0 +1,62 @@
+//=================================================================================================
+/// @file       myPattern.h
+///
+/// @brief      Datei enthlt einen tabellengesteuerten Ablauf fr LED-Muster (z.B. Lauflicht).
+///							Ein Muster ist eine konstante Tabelle von Schritten, jeder Schritt enthlt seine
+///							Dauer in Aufrufen von PatternTick() und die Bitmasken der eingeschalteten GPIOs
+///							je Port. PatternTick() wird als Task im Scheduler (myScheduler.h) aufgerufen und
+///							schreibt nur beim Wechsel des Schritts in die GPIO-Register, und zwar nur die
+///							Bits, die sich ndern (GPxCLEAR/GPxSET, ein 32-Bit-Zugriff je Port und Richtung).
+///							Die Anzahl der Registerzugriffe steht in "patternPortWrites".
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYPATTERN_H_
+#define MYPATTERN_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Ports, deren GPIOs ein Muster schalten kann (Index in PatternStep.mask)
+#define PATTERN_PORT_A									0
+#define PATTERN_PORT_B									1
+#define PATTERN_NUMBER_OF_PORTS					2
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ein Schritt eines Musters
+typedef struct
+{
+		uint16_t duration;																// Aufrufe von PatternTick() (mind. 1)
+		uint32_t mask[PATTERN_NUMBER_OF_PORTS];						// eingeschaltete GPIOs je Port
+} PatternStep;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Schreibzugriffe auf GPxSET/GPxCLEAR seit PatternStart() (im Debugger anzeigen)
+extern volatile uint32_t patternPortWrites;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion startet ein Muster mit seinem ersten Schritt
+extern void PatternStart(const PatternStep *steps, uint16_t numberOfSteps);
+// Funktion schaltet das Muster weiter (als Task im Scheduler aufrufen)
+extern void PatternTick(void);
+
+
+#endif
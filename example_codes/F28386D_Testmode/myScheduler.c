@@ -0,0 +1,358 @@
+//=================================================================================================
+/// @file       myScheduler.c
+///
+/// @brief      Datei enthlt einen kooperativen Scheduler mit festen Taskraten. Der CPU-Timer 0
+///							erzeugt einen Grundtakt von 10 kHz. In dessen Interrupt werden nur die Aufrufe
+///							(Releases) der vier Raten 10 kHz, 1 kHz, 100 Hz und 10 Hz gezhlt, die Tasks
+///							selbst werden in der Dauerschleife von SchedulerRun() ausgefhrt. Pro Aufruf
+///							von SchedulerRun() wird nur die schnellste fllige Rate abgearbeitet
+///							(ratenmonoton: schnellere Raten haben Vorrang). Wurde eine Rate erneut
+///							ausgelst, bevor ihre Tasks fertig waren, wird ein berlauf (Overrun) gezhlt.
+///							Fr jede Task werden Anzahl der Aufrufe, letzte und maximale Laufzeit in Takten
+///							(Zeitbasis CPU-Timer 2, siehe myProfile.h) und die CPU-Last im letzten
+///							Messfenster (SCHEDULER_LOAD_WINDOW_TICKS) gespeichert. Die Werte knnen im
+///							Debugger ber "schedulerTaskStats", "schedulerRateStats" und "schedulerLoad"
+///							angezeigt werden.
+///
+///							nderung in Version 1.1: Die ISR des CPU-Timer 0 kann von Interrupts mit
+///							hherer Prioritt unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 1.2: Die ISR des CPU-Timer 0 bedient den Watchdog, solange
+///							die Anzahl der Aufrufe jeder Task (Lebenszhler) weiterzhlt (myWatchdog.h)
+///
+///							nderung in Version 1.3: SchedulerPending() fr den Low-Power-Modus der
+///							Dauerschleife, die ISR des CPU-Timer 0 meldet ihre Weck-Latenz (myLowPower.h)
+///
+///							nderung in Version 1.4: Die Periode des CPU-Timer 0 und die Takte pro Grundtakt
+///							folgen dem Systemtakt von DeviceSetSysclk() (myDevice.h)
+///
+/// @version    V1.4
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myScheduler.h"
+#include "myWatchdog.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Takte pro Messfenster und Takte pro 0,01 % CPU-Last
+#define SCHEDULER_LOAD_WINDOW_CYCLES		(SCHEDULER_LOAD_WINDOW_TICKS * SCHEDULER_TICK_CYCLES)
+#define SCHEDULER_LOAD_CYCLES_PER_UNIT	(SCHEDULER_LOAD_WINDOW_CYCLES / 10000UL)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tasks mit ihren Messwerten
+SchedulerTaskStats schedulerTaskStats[SCHEDULER_MAX_TASKS];
+// Anzahl der angelegten Tasks
+uint16_t schedulerNumberOfTasks = 0;
+// Messwerte der Raten
+SchedulerRateStats schedulerRateStats[SCHEDULER_NUMBER_OF_RATES];
+// Gesamte CPU-Last aller Tasks im letzten Messfenster in 0,01 %
+uint16_t schedulerLoad = 0;
+// Grundtakte seit SchedulerStart()
+volatile uint32_t schedulerTicks = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Teiler der Raten bezogen auf den Grundtakt (10 kHz, 1 kHz, 100 Hz, 10 Hz)
+static const uint16_t schedulerDivider[SCHEDULER_NUMBER_OF_RATES] = {1, 10, 100, 1000};
+// Grundtakte bis zur nchsten Auslsung jeder Rate
+static uint16_t schedulerDividerCount[SCHEDULER_NUMBER_OF_RATES];
+// Zeitstempel (CPU-Timer 2) der letzten Auslsung jeder Rate
+static volatile uint32_t schedulerReleaseTimestamp[SCHEDULER_NUMBER_OF_RATES];
+// Grundtakt, mit dem das laufende Messfenster begonnen hat
+static uint32_t schedulerWindowStart = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SchedulerUpdateLoad ===============================================================
+///
+/// @brief	Funktion berechnet nach Ablauf eines Messfensters die CPU-Last jeder Task und die
+///					gesamte CPU-Last und beginnt ein neues Messfenster
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SchedulerUpdateLoad(void)
+{
+		uint32_t cyclesTotal = 0;
+		uint32_t load;
+
+		if ((schedulerTicks - schedulerWindowStart) < SCHEDULER_LOAD_WINDOW_TICKS)
+				return;
+		schedulerWindowStart += SCHEDULER_LOAD_WINDOW_TICKS;
+
+		for (uint16_t i = 0; i < schedulerNumberOfTasks; i++)
+		{
+				SchedulerTaskStats *task = &schedulerTaskStats[i];
+
+				cyclesTotal += task->cyclesWindow;
+				load = task->cyclesWindow / SCHEDULER_LOAD_CYCLES_PER_UNIT;
+				task->load = (load > 10000UL) ? 10000 : (uint16_t)load;
+				task->cyclesWindow = 0;
+		}
+		load = cyclesTotal / SCHEDULER_LOAD_CYCLES_PER_UNIT;
+		schedulerLoad = (load > 10000UL) ? 10000 : (uint16_t)load;
+}
+
+//=== Function: SchedulerClockChanged =============================================================
+///
+/// @brief	Funktion wird von DeviceSetSysclk() nach einer nderung des Systemtakts aufgerufen und
+///					setzt die Periode des CPU-Timer 0 neu, damit der Grundtakt SCHEDULER_TICK_HZ bleibt
+///
+/// @param  uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+static void SchedulerClockChanged(uint16_t oldMhz, uint16_t newMhz)
+{
+		CpuTimer0Regs.PRD.all = SCHEDULER_TICK_CYCLES - 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SchedulerInit =====================================================================
+///
+/// @brief	Funktion lscht alle Tasks und Messwerte und konfiguriert den CPU-Timer 0 fr einen
+///					Interrupt mit SCHEDULER_TICK_HZ (der Timer bleibt angehalten bis SchedulerStart()).
+///					ProfileInit() muss vorher aufgerufen worden sein, da der CPU-Timer 2 als Zeitbasis
+///					fr die Laufzeitmessung dient
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SchedulerInit(void)
+{
+		schedulerNumberOfTasks = 0;
+		for (uint16_t rate = 0; rate < SCHEDULER_NUMBER_OF_RATES; rate++)
+		{
+				schedulerRateStats[rate].released = 0;
+				schedulerRateStats[rate].served = 0;
+				schedulerRateStats[rate].overruns = 0;
+				schedulerRateStats[rate].latencyMax = 0;
+				schedulerDividerCount[rate] = schedulerDivider[rate];
+		}
+		schedulerTicks = 0;
+		schedulerWindowStart = 0;
+		schedulerLoad = 0;
+
+		EALLOW;
+		// Takt fr CPU-Timer 0 einschalten
+		CpuSysRegs.PCLKCR0.bit.CPUTIMER0 = 1;
+		// Timer anhalten, kein Vorteiler, Periode = ein Grundtakt
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TPR.all = 0;
+		CpuTimer0Regs.TPRH.all = 0;
+		CpuTimer0Regs.PRD.all = SCHEDULER_TICK_CYCLES - 1;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		// Interrupt einschalten, Timer hlt bei angehaltenem Debugger an
+		CpuTimer0Regs.TCR.bit.TIF = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 1;
+		CpuTimer0Regs.TCR.bit.FREE = 0;
+		CpuTimer0Regs.TCR.bit.SOFT = 0;
+
+    // Interrupt-Service-Routine fr den CPU-Timer 0 an die
+    // entsprechende Stelle (TIMER0_INT) der PIE-Vector Table speichern
+		PieVectTable.TIMER0_INT = &SchedulerTimer0ISR;
+    // INT1.7-Interrupt freischalten (Zeile 1, Spalte 7 der Tabelle 3-2)
+    // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+    // CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+		IER |= M_INT1;
+		EDIS;
+
+		// Periode bei einer nderung des Systemtakts anpassen
+		DeviceRegisterClockCallback(&SchedulerClockChanged);
+}
+
+//=== Function: SchedulerAddTask ==================================================================
+///
+/// @brief	Funktion hngt eine Task an die Tabelle einer Rate an. Innerhalb einer Rate werden
+///					die Tasks in der Reihenfolge ausgefhrt, in der sie angelegt wurden. Eine Task darf
+///					nicht blockieren, ihre Laufzeit sollte deutlich unter der Periode ihrer Rate liegen
+///
+/// @param  uint16_t rate, SchedulerTaskFunction function
+///
+/// @return uint16_t SCHEDULER_ADD_OK, SCHEDULER_ADD_FULL oder SCHEDULER_ADD_INVALID
+///
+//=================================================================================================
+uint16_t SchedulerAddTask(uint16_t rate, SchedulerTaskFunction function)
+{
+		SchedulerTaskStats *task;
+
+		if ((rate >= SCHEDULER_NUMBER_OF_RATES) || (function == 0))
+				return SCHEDULER_ADD_INVALID;
+		if (schedulerNumberOfTasks >= SCHEDULER_MAX_TASKS)
+				return SCHEDULER_ADD_FULL;
+
+		task = &schedulerTaskStats[schedulerNumberOfTasks];
+		task->function = function;
+		task->rate = rate;
+		task->runs = 0;
+		task->cyclesLast = 0;
+		task->cyclesMax = 0;
+		task->cyclesWindow = 0;
+		task->load = 0;
+		schedulerNumberOfTasks++;
+
+		return SCHEDULER_ADD_OK;
+}
+
+//=== Function: SchedulerStart ====================================================================
+///
+/// @brief	Funktion startet den CPU-Timer 0 und damit die Auslsung der Raten
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SchedulerStart(void)
+{
+		schedulerWindowStart = schedulerTicks;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		CpuTimer0Regs.TCR.bit.TSS = 0;
+}
+
+//=== Function: SchedulerRun ======================================================================
+///
+/// @brief	Funktion wird in der Dauerschleife aufgerufen und fhrt alle Tasks der schnellsten
+///					flligen Rate aus. Langsamere Raten kommen erst beim nchsten Aufruf an die Reihe,
+///					damit eine fllige schnellere Rate nicht warten muss. Wurden seit der letzten
+///					Abarbeitung mehrere Auslsungen gezhlt oder wird die Rate whrend der Abarbeitung
+///					erneut ausgelst, wird ein berlauf gezhlt. Ist keine Rate fllig, kehrt die
+///					Funktion sofort zurck und der restliche Code der Dauerschleife (Hintergrund) luft
+///
+/// @param  void
+///
+/// @return bool tasksExecuted
+///
+//=================================================================================================
+bool SchedulerRun(void)
+{
+		SchedulerUpdateLoad();
+
+		for (uint16_t rate = 0; rate < SCHEDULER_NUMBER_OF_RATES; rate++)
+		{
+				SchedulerRateStats *stats = &schedulerRateStats[rate];
+				uint32_t released = stats->released;
+				uint32_t start;
+
+				if (released == stats->served)
+						continue;
+
+				// Auslsungen, die nicht abgearbeitet wurden
+				stats->overruns += released - stats->served - 1;
+
+				start = PROFILE_TIMESTAMP();
+				if ((start - schedulerReleaseTimestamp[rate]) > stats->latencyMax)
+						stats->latencyMax = start - schedulerReleaseTimestamp[rate];
+
+				for (uint16_t i = 0; i < schedulerNumberOfTasks; i++)
+				{
+						SchedulerTaskStats *task = &schedulerTaskStats[i];
+						uint32_t cycles;
+
+						if (task->rate != rate)
+								continue;
+
+						start = PROFILE_TIMESTAMP();
+						task->function();
+						cycles = PROFILE_TIMESTAMP() - start;
+						cycles = (cycles > profileOverhead) ? (cycles - profileOverhead) : 0;
+
+						task->runs++;
+						task->cyclesLast = cycles;
+						task->cyclesWindow += cycles;
+						if (cycles > task->cyclesMax)
+								task->cyclesMax = cycles;
+				}
+
+				stats->served = released;
+				// Rate wurde whrend der Abarbeitung erneut ausgelst (Deadline verpasst)
+				if (stats->released != released)
+						stats->overruns++;
+
+				return true;
+		}
+
+		return false;
+}
+
+//=== Function: SchedulerPending ==================================================================
+///
+/// @brief	Funktion gibt true zurck, falls mindestens eine Rate ausgelst, aber noch nicht
+///					abgearbeitet wurde. Wird vor LowPowerSleep() mit gesperrten Interrupts aufgerufen, damit
+///					keine Auslsung zwischen Prfung und IDLE-Befehl verloren geht
+///
+/// @param  void
+///
+/// @return bool pending
+///
+//=================================================================================================
+bool SchedulerPending(void)
+{
+		for (uint16_t rate = 0; rate < SCHEDULER_NUMBER_OF_RATES; rate++)
+		{
+				if (schedulerRateStats[rate].released != schedulerRateStats[rate].served)
+						return true;
+		}
+		return false;
+}
+
+//=== Function: SchedulerTimer0ISR ================================================================
+///
+/// @brief  ISR wird mit SCHEDULER_TICK_HZ aufgerufen und zhlt die Auslsungen der Raten. Die
+///					Tasks selbst laufen nicht in der ISR. Anschlieend werden die Lebenszhler der Tasks
+///					geprft und der Watchdog bedient (WatchdogTick()). Die Verzgerung seit dem
+///					Nulldurchgang des Timers wird als Weck-Latenz gemeldet (LowPowerWake())
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(SchedulerTimer0ISR, ".TI.ramfunc");
+__interrupt void SchedulerTimer0ISR(void)
+{
+		uint32_t timestamp = PROFILE_TIMESTAMP();
+		LowPowerWake(LOWPOWER_TIMER_LATENCY(CpuTimer0Regs));
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_TIMER0);
+
+		schedulerTicks++;
+		for (uint16_t rate = 0; rate < SCHEDULER_NUMBER_OF_RATES; rate++)
+		{
+				if (--schedulerDividerCount[rate] == 0)
+				{
+						schedulerDividerCount[rate] = schedulerDivider[rate];
+						schedulerReleaseTimestamp[rate] = timestamp;
+						schedulerRateStats[rate].released++;
+				}
+		}
+		WatchdogTick();
+
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_TIMER0);
+    // Interrupt-Flag der Gruppe 1 lschen (da gehrt der CPU-Timer 0-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
@@ -0,0 +1,133 @@
+//=================================================================================================
+/// @file       myScheduler.h
+///
+/// @brief      Datei enthlt einen kooperativen Scheduler mit festen Taskraten. Der CPU-Timer 0
+///							erzeugt einen Grundtakt von 10 kHz. In dessen Interrupt werden nur die Aufrufe
+///							(Releases) der vier Raten 10 kHz, 1 kHz, 100 Hz und 10 Hz gezhlt, die Tasks
+///							selbst werden in der Dauerschleife von SchedulerRun() ausgefhrt. Pro Aufruf
+///							von SchedulerRun() wird nur die schnellste fllige Rate abgearbeitet
+///							(ratenmonoton: schnellere Raten haben Vorrang). Wurde eine Rate erneut
+///							ausgelst, bevor ihre Tasks fertig waren, wird ein berlauf (Overrun) gezhlt.
+///							Fr jede Task werden Anzahl der Aufrufe, letzte und maximale Laufzeit in Takten
+///							(Zeitbasis CPU-Timer 2, siehe myProfile.h) und die CPU-Last im letzten
+///							Messfenster (SCHEDULER_LOAD_WINDOW_TICKS) gespeichert. Die Werte knnen im
+///							Debugger ber "schedulerTaskStats", "schedulerRateStats" und "schedulerLoad"
+///							angezeigt werden.
+///
+///							nderung in Version 1.1: Die ISR des CPU-Timer 0 kann von Interrupts mit
+///							hherer Prioritt unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 1.2: Die ISR des CPU-Timer 0 bedient den Watchdog, solange
+///							die Anzahl der Aufrufe jeder Task (Lebenszhler) weiterzhlt (myWatchdog.h)
+///
+///							nderung in Version 1.3: SchedulerPending() fr den Low-Power-Modus der
+///							Dauerschleife, die ISR des CPU-Timer 0 meldet ihre Weck-Latenz (myLowPower.h)
+///
+///							nderung in Version 1.4: Die Periode des CPU-Timer 0 und die Takte pro Grundtakt
+///							folgen dem Systemtakt von DeviceSetSysclk() (myDevice.h)
+///
+/// @version    V1.4
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYSCHEDULER_H_
+#define MYSCHEDULER_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myInterrupt.h"
+#include "myLowPower.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Grundtakt des CPU-Timer 0 in Hz
+#define SCHEDULER_TICK_HZ								10000UL
+// Takte (SYSCLK) pro Grundtakt beim aktuellen Systemtakt
+#define SCHEDULER_TICK_CYCLES						(deviceSysclkMhz * 1000000UL / SCHEDULER_TICK_HZ)
+// Raten (Index in den Tabellen, die schnellste Rate hat den kleinsten Index)
+#define SCHEDULER_RATE_10KHZ						0
+#define SCHEDULER_RATE_1KHZ							1
+#define SCHEDULER_RATE_100HZ						2
+#define SCHEDULER_RATE_10HZ							3
+// Anzahl an Raten
+#define SCHEDULER_NUMBER_OF_RATES				4
+// Maximale Anzahl an Tasks
+#define SCHEDULER_MAX_TASKS							16
+// Lnge des Messfensters fr die CPU-Last in Grundtakten (1000 -> 100 ms)
+#define SCHEDULER_LOAD_WINDOW_TICKS			1000UL
+// Rckgabewerte von SchedulerAddTask()
+#define SCHEDULER_ADD_OK								0
+#define SCHEDULER_ADD_FULL							1
+#define SCHEDULER_ADD_INVALID						2
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Funktion einer Task (darf nicht blockieren)
+typedef void (*SchedulerTaskFunction)(void);
+
+// Messwerte einer Task (alle Zeiten in Takten)
+typedef struct
+{
+		SchedulerTaskFunction function;				// auszufhrende Funktion
+		uint16_t rate;												// SCHEDULER_RATE_...
+		uint32_t runs;												// Anzahl an Aufrufen (Lebenszhler des Watchdogs)
+		uint32_t cyclesLast;									// Laufzeit des letzten Aufrufs
+		uint32_t cyclesMax;										// maximale Laufzeit
+		uint32_t cyclesWindow;								// Laufzeit im laufenden Messfenster
+		uint16_t load;												// CPU-Last im letzten Messfenster in 0,01 %
+} SchedulerTaskStats;
+
+// Messwerte einer Rate
+typedef struct
+{
+		volatile uint32_t released;						// Anzahl der Auslsungen (nur im Interrupt geschrieben)
+		uint32_t served;											// Anzahl der abgearbeiteten Auslsungen
+		uint32_t overruns;										// Auslsungen, die verpasst wurden oder whrend
+																					// der Abarbeitung erneut aufgetreten sind
+		uint32_t latencyMax;									// maximale Verzgerung vom Grundtakt bis zum Start
+} SchedulerRateStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tasks mit ihren Messwerten
+extern SchedulerTaskStats schedulerTaskStats[SCHEDULER_MAX_TASKS];
+// Anzahl der angelegten Tasks
+extern uint16_t schedulerNumberOfTasks;
+// Messwerte der Raten
+extern SchedulerRateStats schedulerRateStats[SCHEDULER_NUMBER_OF_RATES];
+// Gesamte CPU-Last aller Tasks im letzten Messfenster in 0,01 %
+extern uint16_t schedulerLoad;
+// Grundtakte seit SchedulerStart()
+extern volatile uint32_t schedulerTicks;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt die Tasktabellen zurck und konfiguriert den CPU-Timer 0 (ProfileInit()
+// muss vorher aufgerufen worden sein)
+extern void SchedulerInit(void);
+// Funktion hngt eine Task an die Tabelle einer Rate an
+extern uint16_t SchedulerAddTask(uint16_t rate, SchedulerTaskFunction function);
+// Funktion startet den CPU-Timer 0
+extern void SchedulerStart(void);
+// Funktion fhrt die Tasks der schnellsten flligen Rate aus, gibt true zurck, falls
+// Tasks ausgefhrt wurden
+extern bool SchedulerRun(void);
+// Funktion gibt true zurck, falls eine Rate ausgelst, aber noch nicht abgearbeitet wurde
+extern bool SchedulerPending(void);
+// Interrupt-Service-Routine des CPU-Timer 0
+__interrupt void SchedulerTimer0ISR(void);
+
+
+#endif
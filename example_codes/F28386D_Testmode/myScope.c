@@ -0,0 +1,294 @@
+//=================================================================================================
+/// @file       myScope.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Aufzeichnung von Messwerten wie bei
+///							einem Oszilloskop. Bei jedem Aufruf von "ScopeSample()" (z.B. aus der ADC-ISR)
+///							werden bis zu SCOPE_MAX_CHANNELS Kanle in einen Ringpuffer im GSx-RAM
+///							geschrieben. Nach einem Trigger (Pegel mit steigender oder fallender Flanke,
+///							Tripzone-Ereignis von ePWM1 oder Software) werden noch "postTrigger" Abtastungen
+///							aufgezeichnet, danach wird der Puffer eingefroren. Die "preTrigger" Abtastungen
+///							vor dem Trigger bleiben erhalten. Die eingefrorene Aufzeichnung wird mit
+///							"ScopeExportService()" als Telemetrie-Rahmen (myTelemetry.h) ber UART gesendet.
+///
+///							nderung in Version 1.1: Ringpuffer liegt im Capture-Bereich (RAMGS2 bis
+///							RAMGS9) statt im GS0-RAM und ist viermal so tief
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myScope.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer der Aufzeichnung (eine Zeile pro Abtastung, im Capture-Bereich)
+DEVICE_CAPTURE_DATA(scopeBuffer)
+uint16_t scopeBuffer[SCOPE_BUFFER_SIZE][SCOPE_MAX_CHANNELS];
+// Konfiguration und Zustand der Aufzeichnung
+ScopeConfig scopeConfig;
+volatile uint16_t scopeState = SCOPE_STATE_IDLE;
+// Position der Abtastung, bei welcher der Trigger ausgelst wurde
+volatile uint16_t scopeTriggerIndex = 0;
+// Anzahl der abgeschlossenen Aufzeichnungen
+uint32_t scopeCaptureCount = 0;
+// Nchste Schreibposition, Anzahl der Abtastungen seit dem Start (bis "preTrigger"),
+// noch aufzuzeichnende Abtastungen nach dem Trigger und letzter Wert des Trigger-Kanals
+static uint16_t scopeWriteIndex = 0;
+static uint16_t scopeFill = 0;
+static uint16_t scopeRemaining = 0;
+static uint16_t scopeLastValue = 0;
+// Trigger per Software angefordert
+static volatile bool scopeForce = false;
+// Nchste zu sendende Abtastung und Puffer fr einen Telemetrie-Rahmen
+static uint16_t scopeExportSample = 0;
+static uint16_t scopeExportWords[SCOPE_WORDS_PER_FRAME];
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ScopeInit =========================================================================
+///
+/// @brief  Funktion setzt die Aufzeichnung zurck (Zustand "idle")
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ScopeInit(void)
+{
+		scopeState = SCOPE_STATE_IDLE;
+		scopeWriteIndex = 0;
+		scopeFill = 0;
+		scopeRemaining = 0;
+		scopeForce = false;
+		scopeTriggerIndex = 0;
+		scopeCaptureCount = 0;
+}
+
+
+//=== Function: ScopeArm ==========================================================================
+///
+/// @brief  Funktion startet eine neue Aufzeichnung mit der Konfiguration "config". Eine laufende
+///					Aufzeichnung oder ein laufender Export wird abgebrochen. Es muss gelten:
+///					1 <= numberOfChannels <= SCOPE_MAX_CHANNELS, triggerChannel < numberOfChannels,
+///					postTrigger >= 1 und preTrigger + postTrigger <= SCOPE_BUFFER_SIZE
+///
+/// @param  const ScopeConfig *config
+///
+/// @return bool started
+///
+//=================================================================================================
+bool ScopeArm(const ScopeConfig *config)
+{
+		if (   (config->numberOfChannels == 0)
+				|| (config->numberOfChannels > SCOPE_MAX_CHANNELS)
+				|| (config->triggerChannel >= config->numberOfChannels)
+				|| (config->postTrigger == 0)
+				|| ((uint32_t)config->preTrigger + config->postTrigger > SCOPE_BUFFER_SIZE))
+		{
+				return false;
+		}
+
+		// Erst anhalten, damit "ScopeSample()" keine halb geschriebene Konfiguration sieht
+		scopeState = SCOPE_STATE_IDLE;
+		scopeConfig = *config;
+		scopeWriteIndex = 0;
+		scopeFill = 0;
+		scopeForce = false;
+		scopeState = SCOPE_STATE_ARMED;
+
+		return true;
+}
+
+
+//=== Function: ScopeForceTrigger =================================================================
+///
+/// @brief  Funktion lst den Trigger per Software aus (wird bei der nchsten Abtastung bernommen,
+///					sobald die Abtastungen vor dem Trigger vollstndig sind)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ScopeForceTrigger(void)
+{
+		scopeForce = true;
+}
+
+
+//=== Function: ScopeSample =======================================================================
+///
+/// @brief  Funktion schreibt eine Abtastung aller Kanle in den Ringpuffer und wertet den Trigger
+///					aus. Der Trigger wird erst geprft, wenn "preTrigger" Abtastungen (mindestens eine
+///					fr die Flankenerkennung) im Puffer liegen. Nach "postTrigger" Abtastungen ab dem
+///					Trigger wird die Aufzeichnung eingefroren. Aufruf aus der ADC-ISR, nachdem die
+///					Messwerte gelesen wurden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ScopeSample(void)
+{
+		uint16_t state = scopeState;
+		uint16_t *slot;
+		uint16_t value;
+		bool trigger = false;
+
+		if ((state != SCOPE_STATE_ARMED) && (state != SCOPE_STATE_TRIGGERED))
+		{
+				return;
+		}
+
+		slot = scopeBuffer[scopeWriteIndex];
+		for (uint16_t i=0; i<scopeConfig.numberOfChannels; i++)
+		{
+				slot[i] = *scopeConfig.source[i];
+		}
+		value = slot[scopeConfig.triggerChannel];
+
+		if (state == SCOPE_STATE_ARMED)
+		{
+				if ((scopeFill < scopeConfig.preTrigger) || (scopeFill == 0))
+				{
+						scopeFill++;
+				}
+				else
+				{
+						switch (scopeConfig.triggerSource)
+						{
+								case SCOPE_TRIGGER_RISING:
+										trigger = (scopeLastValue < scopeConfig.triggerLevel)
+														&& (value >= scopeConfig.triggerLevel);
+										break;
+								case SCOPE_TRIGGER_FALLING:
+										trigger = (scopeLastValue > scopeConfig.triggerLevel)
+														&& (value <= scopeConfig.triggerLevel);
+										break;
+								case SCOPE_TRIGGER_TRIPZONE:
+										// Beliebiges Tripzone-Ereignis von ePWM1 (Flag bleibt bis zum Lschen gesetzt)
+										trigger = (EPwm1Regs.TZFLG.bit.INT == 1);
+										break;
+								default:
+										break;
+						}
+						if (trigger || scopeForce)
+						{
+								scopeForce = false;
+								scopeTriggerIndex = scopeWriteIndex;
+								scopeRemaining = scopeConfig.postTrigger;
+								state = SCOPE_STATE_TRIGGERED;
+						}
+				}
+		}
+
+		// Die Abtastung des Triggers zhlt zu den Abtastungen nach dem Trigger
+		if (state == SCOPE_STATE_TRIGGERED)
+		{
+				if (--scopeRemaining == 0)
+				{
+						state = SCOPE_STATE_FROZEN;
+						scopeCaptureCount++;
+				}
+		}
+
+		scopeLastValue = value;
+		scopeWriteIndex = (scopeWriteIndex + 1) & SCOPE_INDEX_MASK;
+		scopeState = state;
+}
+
+
+//=== Function: ScopeGetSample ====================================================================
+///
+/// @brief  Funktion gibt den Messwert "channel" der Abtastung "sample" einer eingefrorenen
+///					Aufzeichnung zurck. sample = 0 ist die lteste Abtastung, sample = preTrigger
+///					die Abtastung des Triggers
+///
+/// @param  uint16_t sample, uint16_t channel
+///
+/// @return uint16_t value
+///
+//=================================================================================================
+uint16_t ScopeGetSample(uint16_t sample, uint16_t channel)
+{
+		uint16_t index = (scopeTriggerIndex - scopeConfig.preTrigger + sample) & SCOPE_INDEX_MASK;
+
+		return scopeBuffer[index][channel];
+}
+
+
+//=== Function: ScopeExportService ================================================================
+///
+/// @brief  Funktion sendet eine eingefrorene Aufzeichnung ber die Telemetrie (Typ
+///					TELEMETRY_TYPE_ADC_CAPTURE). Pro Aufruf wird ein Rahmen gesendet, jeder Rahmen
+///					beginnt mit einem Kopf (Index der ersten Abtastung, Abtastungen vor dem Trigger,
+///					Anzahl aller Abtastungen, Anzahl der Kanle), danach folgen die Messwerte Abtastung
+///					fr Abtastung. Ist der Sende-Ringpuffer voll, wird der Rahmen beim nchsten Aufruf
+///					erneut gesendet. Nach dem letzten Rahmen wechselt die Aufzeichnung in den Zustand
+///					"idle". Die Funktion sollte zyklisch im Hauptprogramm aufgerufen werden.
+///
+/// @param  void
+///
+/// @return bool exporting
+///
+//=================================================================================================
+bool ScopeExportService(void)
+{
+		uint16_t total;
+		uint16_t count;
+		uint16_t n = SCOPE_FRAME_HEADER;
+
+		if (scopeState == SCOPE_STATE_FROZEN)
+		{
+				scopeExportSample = 0;
+				scopeState = SCOPE_STATE_EXPORTING;
+		}
+		if (scopeState != SCOPE_STATE_EXPORTING)
+		{
+				return false;
+		}
+
+		total = scopeConfig.preTrigger + scopeConfig.postTrigger;
+		count = (SCOPE_WORDS_PER_FRAME - SCOPE_FRAME_HEADER) / scopeConfig.numberOfChannels;
+		if (count > total - scopeExportSample)
+		{
+				count = total - scopeExportSample;
+		}
+
+		scopeExportWords[0] = scopeExportSample;
+		scopeExportWords[1] = scopeConfig.preTrigger;
+		scopeExportWords[2] = total;
+		scopeExportWords[3] = scopeConfig.numberOfChannels;
+		for (uint16_t s=0; s<count; s++)
+		{
+				for (uint16_t i=0; i<scopeConfig.numberOfChannels; i++)
+				{
+						scopeExportWords[n++] = ScopeGetSample(scopeExportSample + s, i);
+				}
+		}
+
+		if (!TelemetrySendWords(TELEMETRY_TYPE_ADC_CAPTURE, scopeExportWords, n))
+		{
+				// Sende-Ringpuffer voll, Rahmen beim nchsten Aufruf erneut senden
+				return true;
+		}
+
+		scopeExportSample += count;
+		if (scopeExportSample >= total)
+		{
+				scopeState = SCOPE_STATE_IDLE;
+		}
+
+		return true;
+}
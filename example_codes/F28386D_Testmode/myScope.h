@@ -0,0 +1,105 @@
+//=================================================================================================
+/// @file       myScope.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Aufzeichnung von Messwerten wie bei
+///							einem Oszilloskop. Bei jedem Aufruf von "ScopeSample()" (z.B. aus der ADC-ISR)
+///							werden bis zu SCOPE_MAX_CHANNELS Kanle in einen Ringpuffer im GSx-RAM
+///							geschrieben. Nach einem Trigger (Pegel mit steigender oder fallender Flanke,
+///							Tripzone-Ereignis von ePWM1 oder Software) werden noch "postTrigger" Abtastungen
+///							aufgezeichnet, danach wird der Puffer eingefroren. Die "preTrigger" Abtastungen
+///							vor dem Trigger bleiben erhalten. Die eingefrorene Aufzeichnung wird mit
+///							"ScopeExportService()" als Telemetrie-Rahmen (myTelemetry.h) ber UART gesendet.
+///
+///							nderung in Version 1.1: Ringpuffer liegt im Capture-Bereich (RAMGS2 bis
+///							RAMGS9) statt im GS0-RAM und ist viermal so tief
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYSCOPE_H_
+#define MYSCOPE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Max. Anzahl der Kanle pro Abtastung
+#define SCOPE_MAX_CHANNELS											4
+// Anzahl der Abtastungen im Ringpuffer (Zweierpotenz, 4096 * 4 Kanle = 16 KW = halber
+// Capture-Bereich)
+#define SCOPE_BUFFER_SIZE												4096
+#define SCOPE_INDEX_MASK												(SCOPE_BUFFER_SIZE - 1)
+// Triggerquelle
+#define SCOPE_TRIGGER_RISING										0
+#define SCOPE_TRIGGER_FALLING										1
+#define SCOPE_TRIGGER_TRIPZONE									2
+#define SCOPE_TRIGGER_SOFTWARE									3
+// Zustand der Aufzeichnung
+#define SCOPE_STATE_IDLE												0
+#define SCOPE_STATE_ARMED												1
+#define SCOPE_STATE_TRIGGERED										2
+#define SCOPE_STATE_FROZEN											3
+#define SCOPE_STATE_EXPORTING										4
+// Worte pro Telemetrie-Rahmen (Kopf + Messwerte) und Lnge des Kopfes:
+// Index der ersten Abtastung, Anzahl Abtastungen vor dem Trigger,
+// Anzahl aller Abtastungen, Anzahl der Kanle
+#define SCOPE_WORDS_PER_FRAME										(TELEMETRY_MAX_PAYLOAD / 2)
+#define SCOPE_FRAME_HEADER											4
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Konfiguration einer Aufzeichnung
+typedef struct
+{
+		uint16_t numberOfChannels;
+		const volatile uint16_t *source[SCOPE_MAX_CHANNELS];		// Messwert je Kanal
+		uint16_t triggerSource;
+		uint16_t triggerChannel;															// Kanal fr den Pegel-Trigger
+		uint16_t triggerLevel;
+		uint16_t preTrigger;																	// Abtastungen vor dem Trigger
+		uint16_t postTrigger;																	// Abtastungen ab dem Trigger
+} ScopeConfig;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer der Aufzeichnung (Capture-Bereich im GSx-RAM)
+extern uint16_t scopeBuffer[SCOPE_BUFFER_SIZE][SCOPE_MAX_CHANNELS];
+// Konfiguration und Zustand der Aufzeichnung
+extern ScopeConfig scopeConfig;
+extern volatile uint16_t scopeState;
+// Position des Triggers im Ringpuffer und Anzahl der Aufzeichnungen
+extern volatile uint16_t scopeTriggerIndex;
+extern uint32_t scopeCaptureCount;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt die Aufzeichnung zurck (Zustand "idle")
+extern void ScopeInit(void);
+// Funktion startet eine neue Aufzeichnung mit der Konfiguration "config"
+extern bool ScopeArm(const ScopeConfig *config);
+// Funktion lst den Trigger per Software aus
+extern void ScopeForceTrigger(void);
+// Funktion schreibt eine Abtastung aller Kanle in den Ringpuffer (Aufruf aus der ADC-ISR)
+extern void ScopeSample(void);
+// Funktion gibt den Messwert "channel" der Abtastung "sample" einer eingefrorenen
+// Aufzeichnung zurck (sample = 0: lteste Abtastung, preTrigger: Trigger)
+extern uint16_t ScopeGetSample(uint16_t sample, uint16_t channel);
+// Funktion sendet eine eingefrorene Aufzeichnung ber die Telemetrie (zyklisch aufrufen)
+extern bool ScopeExportService(void);
+
+
+#endif
@@ -0,0 +1,488 @@
+//=================================================================================================
+/// @file       mySpectrum.c
+///
+/// @brief      Datei enthlt eine Spektralanalyse (reelle FFT mit 256 bis 2048 Punkten) einer
+///							eingefrorenen Aufzeichnung von myScope.h. Beschreibung siehe mySpectrum.h
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "mySpectrum.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Quadratwurzel, Sinus und Kosinus (Winkel in Umdrehungen) mit der TMU, falls vorhanden
+#if defined(__TMS320C28XX_TMU__)
+#define SPECTRUM_SQRT(x)												__sqrt(x)
+#define SPECTRUM_SIN_PU(x)											__sinpuf32(x)
+#define SPECTRUM_COS_PU(x)											__cospuf32(x)
+#else
+#define SPECTRUM_SQRT(x)												sqrtf(x)
+#define SPECTRUM_SIN_PU(x)											sinf(6.2831853f * (x))
+#define SPECTRUM_COS_PU(x)											cosf(6.2831853f * (x))
+#endif
+// Leistung einer Frequenzlinie des Hann-Fensters verteilt sich auf die Linie und ihre
+// beiden Nachbarn, deren Summe ist 1,5 * Amplitude^2 (quivalente Rauschbandbreite)
+#define SPECTRUM_HANN_ENBW											1.5f
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Amplitude jeder Frequenzlinie der letzten Analyse (im Capture-Bereich)
+DEVICE_CAPTURE_DATA(spectrumMagnitude)
+float spectrumMagnitude[SPECTRUM_MAX_SIZE / 2 + 1];
+// Ergebnis und Zustand der Analyse
+SpectrumResult spectrumResult;
+volatile uint16_t spectrumState = SPECTRUM_STATE_IDLE;
+// Takte einer vollstndigen Analyse je Lnge
+uint32_t spectrumBenchmarkCycles[SPECTRUM_NUMBER_OF_SIZES];
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Arbeitspuffer der FFT: N/2 komplexe Werte, Real- und Imaginrteil abwechselnd
+DEVICE_CAPTURE_DATA(spectrumWork)
+static float spectrumWork[SPECTRUM_MAX_SIZE];
+// Drehfaktoren cos(2*pi*k/SPECTRUM_MAX_SIZE) und sin(2*pi*k/SPECTRUM_MAX_SIZE) abwechselnd
+// fr k = 0 bis SPECTRUM_MAX_SIZE/2 - 1
+DEVICE_CAPTURE_DATA(spectrumTwiddle)
+static float spectrumTwiddle[SPECTRUM_MAX_SIZE];
+// Lnge, Kanal, Schrittweite in der Tabelle der Drehfaktoren (SPECTRUM_MAX_SIZE / N) und
+// Anzahl der Bits des Index der N/2 komplexen Werte
+static uint16_t spectrumSize = SPECTRUM_MIN_SIZE;
+static uint16_t spectrumChannel = 0;
+static uint16_t spectrumStride = SPECTRUM_MAX_SIZE / SPECTRUM_MIN_SIZE;
+static uint16_t spectrumBits = 7;
+// Abstand der Butterflies der nchsten FFT-Stufe (in komplexen Werten)
+static uint16_t spectrumSpan = 1;
+// Takte aller Schritte und des lngsten Schritts der laufenden Analyse
+static uint32_t spectrumCycles = 0;
+static uint32_t spectrumCyclesMaxStep = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SpectrumPrepare ===================================================================
+///
+/// @brief  Funktion bernimmt Kanal und Lnge einer neuen Analyse und setzt die Messung der
+///					Takte zurck
+///
+/// @param  uint16_t channel, uint16_t size (Zweierpotenz, SPECTRUM_MIN_SIZE bis SPECTRUM_MAX_SIZE)
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumPrepare(uint16_t channel, uint16_t size)
+{
+		spectrumChannel = channel;
+		spectrumSize = size;
+		spectrumStride = SPECTRUM_MAX_SIZE / size;
+		spectrumBits = 0;
+		while ((1U << (spectrumBits + 1)) < size)
+		{
+				spectrumBits++;
+		}
+		spectrumCycles = 0;
+		spectrumCyclesMaxStep = 0;
+}
+
+//=== Function: SpectrumCos =======================================================================
+///
+/// @brief  Funktion gibt cos(2*pi*n/N) fr n = 0 bis N - 1 aus der Tabelle der Drehfaktoren
+///					zurck (zweite Hlfte ber cos(x + pi) = -cos(x))
+///
+/// @param  uint16_t n
+///
+/// @return float cos
+///
+//=================================================================================================
+static inline float SpectrumCos(uint16_t n)
+{
+		uint16_t half = spectrumSize >> 1;
+
+		if (n < half)
+				return spectrumTwiddle[2U * n * spectrumStride];
+		return -spectrumTwiddle[2U * (n - half) * spectrumStride];
+}
+
+//=== Function: SpectrumLoad ======================================================================
+///
+/// @brief  Funktion liest die ersten N Abtastungen des Kanals aus der Aufzeichnung, zieht den
+///					Mittelwert ab, gewichtet sie mit dem Hann-Fenster 0,5 - 0,5 * cos(2*pi*n/N) und
+///					speichert sie als N/2 komplexe Werte in bitumgekehrter Reihenfolge (Eingang der FFT)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumLoad(void)
+{
+		uint16_t half = spectrumSize >> 1;
+		float mean = 0.0f;
+
+		for (uint16_t n=0; n<spectrumSize; n++)
+		{
+				mean += (float)ScopeGetSample(n, spectrumChannel);
+		}
+		mean /= (float)spectrumSize;
+
+		for (uint16_t m=0; m<half; m++)
+		{
+				uint16_t reversed = 0;
+				uint16_t n = 2U * m;
+
+				for (uint16_t b=0; b<spectrumBits; b++)
+				{
+						reversed |= ((m >> b) & 1U) << (spectrumBits - 1U - b);
+				}
+				spectrumWork[2U * reversed]      = ((float)ScopeGetSample(n, spectrumChannel) - mean)
+																					 * (0.5f - 0.5f * SpectrumCos(n));
+				spectrumWork[2U * reversed + 1U] = ((float)ScopeGetSample(n + 1U, spectrumChannel) - mean)
+																					 * (0.5f - 0.5f * SpectrumCos(n + 1U));
+		}
+}
+
+//=== Function: SpectrumButterflyStage ============================================================
+///
+/// @brief  Funktion rechnet eine Stufe der Radix-2-FFT (Decimation in Time) ber die N/2
+///					komplexen Werte. "span" ist der Abstand der beiden Werte eines Butterflies (1, 2,
+///					4, ... N/4). Der Drehfaktor exp(-j*2*pi*i/(2*span)) steht fr jede Lnge an der
+///					Stelle i * SPECTRUM_MAX_SIZE / (2 * span) der Tabelle
+///
+/// @param  uint16_t span
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumButterflyStage(uint16_t span)
+{
+		uint16_t half = spectrumSize >> 1;
+		uint16_t step = (SPECTRUM_MAX_SIZE / 2) / span;
+
+		for (uint16_t j=0; j<span; j++)
+		{
+				float wr = spectrumTwiddle[2U * j * step];
+				float wi = spectrumTwiddle[2U * j * step + 1U];
+
+				for (uint16_t i=j; i<half; i+=2U*span)
+				{
+						float *a = &spectrumWork[2U * i];
+						float *b = &spectrumWork[2U * (i + span)];
+						// (wr - j*wi) * b
+						float tr = wr * b[0] + wi * b[1];
+						float ti = wr * b[1] - wi * b[0];
+
+						b[0] = a[0] - tr;
+						b[1] = a[1] - ti;
+						a[0] = a[0] + tr;
+						a[1] = a[1] + ti;
+				}
+		}
+}
+
+//=== Function: SpectrumSplit =====================================================================
+///
+/// @brief  Funktion berechnet aus der FFT Z der N/2 komplexen Werte das Spektrum X der N reellen
+///					Werte und davon die Amplitude jeder Frequenzlinie k = 0 bis N/2:
+///						X[k] = E[k] + exp(-j*2*pi*k/N) * O[k]
+///						E[k] = (Z[k] + Z*[N/2-k]) / 2,  O[k] = -j * (Z[k] - Z*[N/2-k]) / 2
+///					Die Amplitude wird auf die eines Sinus umgerechnet (Faktor 2/N, einseitiges
+///					Spektrum 2, Verstrkung des Hann-Fensters 0,5)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumSplit(void)
+{
+		uint16_t half = spectrumSize >> 1;
+		float scale = 4.0f / (float)spectrumSize;
+
+		// Gleichanteil und halbe Abtastfrequenz (reell, nicht doppelt gezhlt)
+		spectrumMagnitude[0]    = fabsf(spectrumWork[0] + spectrumWork[1]) * 0.5f * scale;
+		spectrumMagnitude[half] = fabsf(spectrumWork[0] - spectrumWork[1]) * 0.5f * scale;
+
+		for (uint16_t k=1; k<half; k++)
+		{
+				float a = spectrumWork[2U * k];
+				float b = spectrumWork[2U * k + 1U];
+				float c = spectrumWork[2U * (half - k)];
+				float d = spectrumWork[2U * (half - k) + 1U];
+				float cr = spectrumTwiddle[2U * k * spectrumStride];
+				float si = spectrumTwiddle[2U * k * spectrumStride + 1U];
+				float er = 0.5f * (a + c);
+				float ei = 0.5f * (b - d);
+				float orr = 0.5f * (b + d);
+				float oi = 0.5f * (c - a);
+				float xr = er + cr * orr + si * oi;
+				float xi = ei + cr * oi - si * orr;
+
+				spectrumMagnitude[k] = SPECTRUM_SQRT(xr * xr + xi * xi) * scale;
+		}
+}
+
+//=== Function: SpectrumHarmonics =================================================================
+///
+/// @brief  Funktion sucht die Grundschwingung (grte Frequenzlinie ab k = 1) und schtzt ihre
+///					Frequenz zwischen den Linien aus dem Schwerpunkt der Leistung der Linie und ihrer
+///					Nachbarn. Die Amplituden der Harmonischen werden aus der Leistung der Linie, die
+///					der h-fachen Frequenz am nchsten liegt, und ihrer beiden Nachbarn bestimmt
+///					(unabhngig davon, wo die Frequenz zwischen zwei Linien liegt), daraus der
+///					Klirrfaktor
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumHarmonics(void)
+{
+		uint16_t half = spectrumSize >> 1;
+		uint16_t fundamental = 1;
+		float distortion = 0.0f;
+		float weight = 0.0f;
+		float sum = 0.0f;
+		float frequency;
+
+		for (uint16_t k=2; k<half; k++)
+		{
+				if (spectrumMagnitude[k] > spectrumMagnitude[fundamental])
+						fundamental = k;
+		}
+		for (uint16_t k=fundamental-1U; k<=fundamental+1U; k++)
+		{
+				float power = spectrumMagnitude[k] * spectrumMagnitude[k];
+
+				weight += (float)k * power;
+				sum += power;
+		}
+		frequency = (sum > 0.0f) ? weight / sum : (float)fundamental;
+
+		for (uint16_t h=0; h<SPECTRUM_NUMBER_OF_HARMONICS; h++)
+		{
+				float bin = (float)(h + 1U) * frequency + 0.5f;
+				float power = 0.0f;
+
+				if (bin < (float)half)
+				{
+						uint16_t center = (uint16_t)bin;
+
+						for (uint16_t k=center-1U; k<=center+1U; k++)
+						{
+								power += spectrumMagnitude[k] * spectrumMagnitude[k];
+						}
+				}
+				spectrumResult.harmonics[h] = SPECTRUM_SQRT(power / SPECTRUM_HANN_ENBW);
+				if (h > 0)
+						distortion += power / SPECTRUM_HANN_ENBW;
+		}
+
+		spectrumResult.size = spectrumSize;
+		spectrumResult.channel = spectrumChannel;
+		spectrumResult.fundamentalBin = fundamental;
+		spectrumResult.thd = (spectrumResult.harmonics[0] > 0.0f)
+											 ? SPECTRUM_SQRT(distortion) / spectrumResult.harmonics[0] : 0.0f;
+}
+
+//=== Function: SpectrumRun =======================================================================
+///
+/// @brief  Funktion rechnet eine vollstndige Analyse fr SpectrumBenchmark() (alle Schritte
+///					ohne Unterbrechung)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void SpectrumRun(void)
+{
+		spectrumState = SPECTRUM_STATE_LOAD;
+		while (SpectrumService())
+		{
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: SpectrumInit ======================================================================
+///
+/// @brief  Funktion berechnet die Drehfaktoren fr SPECTRUM_MAX_SIZE (gelten mit Schrittweite
+///					SPECTRUM_MAX_SIZE / N fr jede Lnge) und setzt die Analyse zurck
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpectrumInit(void)
+{
+		spectrumState = SPECTRUM_STATE_IDLE;
+
+		for (uint16_t k=0; k<SPECTRUM_MAX_SIZE/2; k++)
+		{
+				float anglePu = (float)k / (float)SPECTRUM_MAX_SIZE;
+
+				spectrumTwiddle[2U * k]      = SPECTRUM_COS_PU(anglePu);
+				spectrumTwiddle[2U * k + 1U] = SPECTRUM_SIN_PU(anglePu);
+		}
+		for (uint16_t k=0; k<=SPECTRUM_MAX_SIZE/2; k++)
+		{
+				spectrumMagnitude[k] = 0.0f;
+		}
+
+		spectrumResult.size = 0;
+		spectrumResult.count = 0;
+		spectrumResult.cycles = 0;
+		spectrumResult.cyclesMaxStep = 0;
+}
+
+
+//=== Function: SpectrumStart =====================================================================
+///
+/// @brief  Funktion startet die Analyse der ersten "size" Abtastungen von "channel" einer
+///					eingefrorenen (oder gerade exportierten) Aufzeichnung. "size" muss eine
+///					Zweierpotenz von SPECTRUM_MIN_SIZE bis SPECTRUM_MAX_SIZE sein und darf nicht
+///					grer als die Aufzeichnung sein (preTrigger + postTrigger). Bis die Analyse
+///					fertig ist, darf keine neue Aufzeichnung gestartet werden
+///
+/// @param  uint16_t channel, uint16_t size
+///
+/// @return bool started
+///
+//=================================================================================================
+bool SpectrumStart(uint16_t channel, uint16_t size)
+{
+		if (   ((scopeState != SCOPE_STATE_FROZEN) && (scopeState != SCOPE_STATE_EXPORTING))
+				|| (spectrumState != SPECTRUM_STATE_IDLE)
+				|| (channel >= scopeConfig.numberOfChannels)
+				|| (size < SPECTRUM_MIN_SIZE)
+				|| (size > SPECTRUM_MAX_SIZE)
+				|| ((size & (size - 1U)) != 0)
+				|| ((uint32_t)scopeConfig.preTrigger + scopeConfig.postTrigger < size))
+		{
+				return false;
+		}
+
+		SpectrumPrepare(channel, size);
+		spectrumState = SPECTRUM_STATE_LOAD;
+
+		return true;
+}
+
+
+//=== Function: SpectrumService ===================================================================
+///
+/// @brief  Funktion rechnet einen Schritt der laufenden Analyse: Laden und Fenster, eine der
+///					log2(N/2) Stufen der FFT, Split mit Amplituden oder Harmonische. Die Takte jedes
+///					Schritts werden gemessen (Zeitbasis CPU-Timer 2, myProfile.h), nach dem letzten
+///					Schritt stehen Ergebnis und Takte in "spectrumResult". Die Funktion sollte zyklisch
+///					im Hauptprogramm aufgerufen werden
+///
+/// @param  void
+///
+/// @return bool busy
+///
+//=================================================================================================
+bool SpectrumService(void)
+{
+		uint32_t start;
+		uint32_t cycles;
+		bool done = false;
+
+		if (spectrumState == SPECTRUM_STATE_IDLE)
+		{
+				return false;
+		}
+
+		start = PROFILE_TIMESTAMP();
+		switch (spectrumState)
+		{
+				case SPECTRUM_STATE_LOAD:
+						SpectrumLoad();
+						spectrumSpan = 1;
+						spectrumState = SPECTRUM_STATE_BUTTERFLY;
+						break;
+				case SPECTRUM_STATE_BUTTERFLY:
+						SpectrumButterflyStage(spectrumSpan);
+						spectrumSpan <<= 1;
+						if (spectrumSpan >= (spectrumSize >> 1))
+								spectrumState = SPECTRUM_STATE_SPLIT;
+						break;
+				case SPECTRUM_STATE_SPLIT:
+						SpectrumSplit();
+						spectrumState = SPECTRUM_STATE_HARMONICS;
+						break;
+				default:
+						SpectrumHarmonics();
+						done = true;
+						break;
+		}
+		cycles = PROFILE_TIMESTAMP() - start;
+
+		spectrumCycles += cycles;
+		if (cycles > spectrumCyclesMaxStep)
+				spectrumCyclesMaxStep = cycles;
+
+		if (done)
+		{
+				spectrumResult.cycles = spectrumCycles;
+				spectrumResult.cyclesMaxStep = spectrumCyclesMaxStep;
+				spectrumResult.count++;
+				spectrumState = SPECTRUM_STATE_IDLE;
+		}
+
+		return true;
+}
+
+
+//=== Function: SpectrumBenchmark =================================================================
+///
+/// @brief  Funktion misst die Takte einer vollstndigen Analyse (alle Schritte ohne
+///					Unterbrechung, Minimum aus SPECTRUM_BENCHMARK_LOOPS Aufrufen mit gesperrten
+///					Interrupts, ProfileBenchmark()) fr 256, 512, 1024 und 2048 Punkte und speichert sie
+///					in "spectrumBenchmarkCycles". Gerechnet wird mit dem aktuellen Inhalt des
+///					Ringpuffers von Kanal 0, die Takte hngen nicht von den Messwerten ab. Bei 2048
+///					Punkten sind die Interrupts einige ms gesperrt, daher nur vor SchedulerStart()
+///					aufrufen. Das Ergebnis der Messungen wird danach verworfen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpectrumBenchmark(void)
+{
+		uint16_t size = SPECTRUM_MIN_SIZE;
+
+		if (spectrumState != SPECTRUM_STATE_IDLE)
+		{
+				return;
+		}
+
+		for (uint16_t i=0; i<SPECTRUM_NUMBER_OF_SIZES; i++)
+		{
+				SpectrumPrepare(0, size);
+				spectrumBenchmarkCycles[i] = ProfileBenchmark(SpectrumRun, SPECTRUM_BENCHMARK_LOOPS);
+				size <<= 1;
+		}
+
+		spectrumResult.size = 0;
+		spectrumResult.count = 0;
+		spectrumResult.cycles = 0;
+		spectrumResult.cyclesMaxStep = 0;
+}
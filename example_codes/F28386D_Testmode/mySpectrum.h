@@ -0,0 +1,99 @@
+//=================================================================================================
+/// @file       mySpectrum.h
+///
+/// @brief      Datei enthlt eine Spektralanalyse (reelle FFT mit 256 bis 2048 Punkten) einer
+///							eingefrorenen Aufzeichnung von myScope.h, z.B. fr die Oberschwingungen des
+///							Umrichterstroms. Die Messwerte eines Kanals werden vom Mittelwert befreit, mit
+///							einem Hann-Fenster gewichtet und als N/2 komplexe Werte (gerade Abtastung: Real-,
+///							ungerade: Imaginrteil) mit einer Radix-2-FFT transformiert. Ein abschlieender
+///							Split-Schritt liefert daraus das Spektrum der N reellen Werte. Ergebnis ist die
+///							Amplitude jeder Frequenzlinie (spectrumMagnitude[], in ADC-Einheiten), dazu die
+///							Grundschwingung, die ersten SPECTRUM_NUMBER_OF_HARMONICS Harmonischen und der
+///							Klirrfaktor (spectrumResult).
+///							Gerechnet wird mit der FPU (float), die Drehfaktoren (Twiddle-Faktoren) werden
+///							einmal mit der TMU (__sinpuf32(), __cospuf32()) fr SPECTRUM_MAX_SIZE berechnet
+///							und fr kleinere Lngen mit Schrittweite SPECTRUM_MAX_SIZE / N gelesen, die
+///							Betrge mit SQRTF32. "SpectrumService()" rechnet pro Aufruf nur einen Schritt
+///							(Laden, eine FFT-Stufe, Split, Harmonische), damit der Scheduler in der
+///							Dauerschleife nicht blockiert wird. "SpectrumBenchmark()" misst die Takte einer
+///							vollstndigen Analyse fr jede Lnge.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYSPECTRUM_H_
+#define MYSPECTRUM_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myScope.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Kleinste und grte Lnge der FFT (Zweierpotenzen) und Anzahl der Lngen dazwischen
+#define SPECTRUM_MIN_SIZE												256
+#define SPECTRUM_MAX_SIZE												2048
+#define SPECTRUM_NUMBER_OF_SIZES								4
+// Anzahl der ausgewerteten Harmonischen (Index 0: Grundschwingung)
+#define SPECTRUM_NUMBER_OF_HARMONICS						8
+// Aufrufe pro Lnge in SpectrumBenchmark() (gespeichert wird das Minimum)
+#define SPECTRUM_BENCHMARK_LOOPS								2
+// Zustand der Analyse
+#define SPECTRUM_STATE_IDLE											0
+#define SPECTRUM_STATE_LOAD											1
+#define SPECTRUM_STATE_BUTTERFLY								2
+#define SPECTRUM_STATE_SPLIT										3
+#define SPECTRUM_STATE_HARMONICS								4
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ergebnis der letzten Analyse
+typedef struct
+{
+		uint16_t size;												// Lnge der FFT
+		uint16_t channel;											// Kanal der Aufzeichnung
+		uint32_t count;												// Anzahl der Analysen
+		uint16_t fundamentalBin;							// Frequenzlinie der Grundschwingung
+		float harmonics[SPECTRUM_NUMBER_OF_HARMONICS];	// Amplitude der 1. bis 8. Harmonischen
+		float thd;														// Klirrfaktor (2. bis 8. Harmonische zur Grundschwingung)
+		uint32_t cycles;											// Takte aller Schritte
+		uint32_t cyclesMaxStep;								// Takte des lngsten Schritts
+} SpectrumResult;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Amplitude jeder Frequenzlinie 0 bis N/2 der letzten Analyse (Capture-Bereich im GSx-RAM)
+extern float spectrumMagnitude[SPECTRUM_MAX_SIZE / 2 + 1];
+// Ergebnis und Zustand der Analyse
+extern SpectrumResult spectrumResult;
+extern volatile uint16_t spectrumState;
+// Takte einer vollstndigen Analyse fr 256, 512, 1024 und 2048 Punkte (SpectrumBenchmark())
+extern uint32_t spectrumBenchmarkCycles[SPECTRUM_NUMBER_OF_SIZES];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion berechnet die Drehfaktoren und setzt die Analyse zurck
+extern void SpectrumInit(void);
+// Funktion startet die Analyse der ersten "size" Abtastungen von "channel" der eingefrorenen
+// Aufzeichnung
+extern bool SpectrumStart(uint16_t channel, uint16_t size);
+// Funktion rechnet einen Schritt der laufenden Analyse (zyklisch aufrufen)
+extern bool SpectrumService(void);
+// Funktion misst die Takte einer vollstndigen Analyse fr jede Lnge
+extern void SpectrumBenchmark(void);
+
+
+#endif
@@ -0,0 +1,1258 @@
+//=================================================================================================
+/// @file       uart.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstelle (SCI) eines
+///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Zum Senden wird
+////						die Funktion "UartTransmit()" aufgerufen und die zu sendene Anzahl an Bytes als
+///							Parameter bergeben. Die zu sendenen Daten werden zuvor in den Puffer
+///							"uartBufferTx[]" geschrieben. Der Empfangsvorgang wird durch Aufruf der Funktion
+///							"UartReceive()" freigegeben. Da UART asynchron ist, kann der Empfangsvorgang nur
+///							freigegeben, aber nicht aktiv forciert werden. Nach Aufruf der Funktion
+///							"UartReceive()", sollte in regelmigen Abstnden die Funktion "UartGetStatusRx()"
+///							aufgerufen werden um den korekten/vollstndigen Empfang eines Datenpakets zu
+///							prfen. Nheres ist der Beschreibung der Funktion "UartGetStatusRx()" zu entnehmen.
+///							Es wird das SCI-A Modul verwendet. Die Module B, C und D knnen analog zu den hier
+///							gezeigten Funktionen verwendet werden.
+///
+///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///
+///							nderung in Version 2.1: Streaming-Betrieb mit Ringpuffern. Nach Aufruf der
+///							Funktion "UartStartStreamA()" ist der Empfang dauerhaft eingeschaltet. Die ISRs
+///							fllen bzw. leeren je einen Ringpuffer fr Rx und Tx (ein Erzeuger, ein
+///							Verbraucher, keine Sperre ntig), sodass zwischen zwei Datenpaketen keine Bytes
+///							verloren gehen. Die Daten werden mit "UartWriteA()" in den Sende-Ringpuffer
+///							geschrieben und mit "UartReadA()" aus dem Empfangs-Ringpuffer gelesen.
+///
+///							nderung in Version 2.2: Die ISRs knnen von Interrupts mit hherer Prioritt
+///							(z.B. ADC) unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 2.3: Der Baudraten-Teiler wird aus dem aktuellen Low-Speed
+///							Peripheral Clock berechnet und nach einer nderung des Systemtakts (DeviceSetSysclk())
+///							umgerechnet
+///
+///							nderung in Version 2.4: Beliebige Baudraten (gerundeter Teiler, erreichte Baudrate
+///							und Abweichung in "uartBaudActualA" bzw. "uartBaudErrorPpmA"), Baudraten ber
+///							921600 bis LSPCLK / 16 und automatische Erkennung der Baudrate ("UartAutoBaudStartA()",
+///							"UartAutoBaudPollA()")
+///
+/// @version    V2.4
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myUART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Software-Puffer fr die UART-Kommunikation
+uint16_t uartBufferRxA[UART_SIZE_SOFTWARE_BUFFER_RX];
+uint16_t uartBufferTxA[UART_SIZE_SOFTWARE_BUFFER_TX];
+// Steuern das Kopieren in und aus den Software-Puffern whrend der UART-Kommunikation
+uint16_t uartBufferIndexRxA;
+uint16_t uartBufferIndexTxA;
+uint16_t uartBufferIndexRxOldA;
+uint16_t uartBytesToTransferRxA;
+uint16_t uartBytesToTransferTxA;
+// Dient zur Erkennung des Empfangsvorgangs
+uint32_t uartOldValueFifoBufferA;
+// Flags speichern den aktuellen Zustand der UART-Kommunikation
+uint16_t uartStatusFlagRxA;
+uint16_t uartStatusFlagTxA;
+// Alle Bytes des Datenpakets wurden in den Sende-FIFO geschrieben, das Ende des
+// Sendevorgangs (SCICTL2.TXEMPTY) wird von "UartPollTxA()" geprft
+volatile bool uartTxLastByteLoadedA;
+// Flag kann zum Aufruf der Funktion "UartGetStatusRxA()" genutzt werden
+// und sollte dazu regelmig (z.B. alle 5 ms) in einer ISR gesetzt werden.
+// Anschlieend kann z.B. im Hauptprogramm bei gesetztem Flag die Funktion
+// aufgerufen und das Flag gelscht werden
+bool uartFlagCheckRxA;
+// Timeout-Zhler fr den Empfang eines Datenpakets
+int32_t uartRxTimeoutA = UART_NO_TIMEOUT;
+// Ringpuffer fr den Streaming-Betrieb
+UartRingBuffer uartRingRxA;
+UartRingBuffer uartRingTxA;
+// Streaming-Betrieb aktiv
+bool uartStreamModeA = false;
+// Anzahl der Bytes, die wegen eines vollen Empfangs-Ringpuffers verworfen wurden
+uint32_t uartRingOverflowA = 0;
+// Tatschlich eingestellte Baudrate und Abweichung von der gewnschten Baudrate in ppm
+uint32_t uartBaudActualA = 0;
+int32_t uartBaudErrorPpmA = 0;
+// Automatische Erkennung der Baudrate aktiv
+bool uartAutoBaudActiveA = false;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Gewnschte Baudrate (Bezug fr "uartBaudErrorPpmA", nach der automatischen Erkennung die
+// erkannte Baudrate)
+static uint32_t uartBaudRequestedA = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UartUpdateBaudA ===================================================================
+///
+/// @brief  Funktion berechnet aus dem Baudraten-Teiler von SCI-A und dem aktuellen Low-Speed
+///					Peripheral Clock die tatschliche Baudrate und deren Abweichung von der gewnschten
+///					Baudrate (BAUD = LSPCLK / ((BRR + 1) * 8), BRR = 0 ergibt LSPCLK / 16)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UartUpdateBaudA(void)
+{
+		uint32_t divider = ((uint32_t)SciaRegs.SCIHBAUD.bit.BAUD << 8) | SciaRegs.SCILBAUD.bit.BAUD;
+
+		if (divider == 0)
+				divider = 1;
+		uartBaudActualA = DEVICE_LSPCLK_HZ / ((divider + 1UL) * 8UL);
+		if (uartBaudRequestedA == 0)
+				uartBaudRequestedA = uartBaudActualA;
+		uartBaudErrorPpmA = (int32_t)(((int64_t)uartBaudActualA - (int64_t)uartBaudRequestedA)
+																	* 1000000LL / (int64_t)uartBaudRequestedA);
+}
+
+
+//=== Function: UartSetBaudA ======================================================================
+///
+/// @brief  Funktion setzt den Baudraten-Teiler von SCI-A fr eine beliebige Baudrate. Der Teiler
+///					wird auf die nchstliegende Baudrate gerundet und auf 1 ... 0xFFFF begrenzt
+///					(BRR = LSPCLK / (BAUD * 8) - 1, hchste Baudrate LSPCLK / 16)
+///
+/// @param  uint32_t baud
+///
+/// @return void
+///
+//=================================================================================================
+static void UartSetBaudA(uint32_t baud)
+{
+		uint32_t divider;
+
+		if (baud == 0)
+				baud = UART_BAUD_9600;
+		// Gerundet: (LSPCLK + BAUD * 4) / (BAUD * 8) - 1
+		divider = (DEVICE_LSPCLK_HZ + baud * 4U) / (baud * 8U);
+		divider = (divider > 1) ? (divider - 1U) : 1U;
+		if (divider > 0xFFFF)
+				divider = 0xFFFF;
+		SciaRegs.SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
+		SciaRegs.SCILBAUD.bit.BAUD =  divider & 0x00FF;
+
+		uartBaudRequestedA = baud;
+		UartUpdateBaudA();
+}
+
+
+//=== Function: UartClockChangedA =================================================================
+///
+/// @brief  Funktion wird von DeviceSetSysclk() nach einer nderung des Systemtakts aufgerufen und
+///					rechnet den Baudraten-Teiler von SCI-A um. Ein Byte, das gerade bertragen wird, kann
+///					dabei verflscht werden
+///
+/// @param  uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+static void UartClockChangedA(uint16_t oldMhz, uint16_t newMhz)
+{
+		DeviceScaleSci(&SciaRegs, oldMhz, newMhz);
+		UartUpdateBaudA();
+}
+
+//=== Function: UartRxStreamDrainA ================================================================
+///
+/// @brief  Funktion kopiert alle Bytes des Empfangs-FIFOs in den Empfangs-Ringpuffer. Ist der
+///					Ringpuffer voll, wird das Byte verworfen und der Zhler "uartRingOverflowA" erhht.
+///					Wird aus "UartRxStreamISRA()" und "UartPollRxA()" aufgerufen. Beide laufen im
+///					Interrupt-Kontext ohne Verschachtelung, es gibt also weiterhin nur einen Erzeuger.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UartRxStreamDrainA(void)
+{
+		uint16_t head = uartRingRxA.head;
+
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				uint16_t byte = SciaRegs.SCIRXBUF.bit.SAR;
+				uint16_t next = (head + 1) & UART_RING_INDEX_MASK;
+				if (next == uartRingRxA.tail)
+				{
+						uartRingOverflowA++;
+				}
+				else
+				{
+						uartRingRxA.data[head] = byte;
+						head = next;
+				}
+		}
+		// Index erst nach dem Kopieren verffentlichen
+		uartRingRxA.head = head;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UartInitA =========================================================================
+///
+/// @brief  Funktion initialisiert GPIO 28 und 135 als UART-Pins und das
+///         SCI-A Modul fr den UART-Betrieb mit der gewnschten Baudrate. Die Baudrate ist
+///         beliebig (siehe "UartSetBaudA()"), die erreichte steht in "uartBaudActualA".
+///
+/// @param  uint32_t baud, uint32_t numberOfDataBits, uint32_t numberOfStopBits, uint32_t parity
+///
+/// @return void
+///
+//=================================================================================================
+void UartInitA(uint32_t baud,
+							 uint32_t numberOfDataBits,
+							 uint32_t numberOfStopBits,
+							 uint32_t parity)
+{
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+    // Rx-Pin
+    // GPIO-Sperre fr GPIO 28 aufheben
+    GpioCtrlRegs.GPALOCK.bit.GPIO28 = 0;
+    // GPIO 28 auf UART-Funktion setzen (RxD)
+    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
+    // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an.
+    // (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    GpioCtrlRegs.GPAGMUX2.bit.GPIO28 = (1 >> 2);
+    GpioCtrlRegs.GPAMUX2.bit.GPIO28  = (1 & 0x03);
+    // GPIO 28 Pull-Up-Widerstand deaktivieren
+    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 1;
+    // GPIO 28 Asynchroner Eingang (muss fr UART gesetzt sein)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 0x03;
+
+    // Tx-Pin:
+    // GPIO-Sperre aufheben
+    GpioCtrlRegs.GPELOCK.bit.GPIO135 = 0;
+    // Auf UART-Funktion setzen (TxD)
+    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
+    // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an.
+    // (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    GpioCtrlRegs.GPEGMUX1.bit.GPIO135 = (6 >> 2);
+    GpioCtrlRegs.GPEMUX1.bit.GPIO135  = (6 & 0x03);
+    // Pull-Up-Widerstand deaktivieren
+    GpioCtrlRegs.GPEPUD.bit.GPIO135 = 1;
+    // Asynchroner Eingang (muss fr UART gesetzt sein)
+    GpioCtrlRegs.GPEQSEL1.bit.GPIO135 = 0x03;
+
+    // Takt fr das UART-Modul einschalten und 5 Takte
+    // warten, bis der Takt zum Modul durchgestellt ist
+    // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    CpuSysRegs.PCLKCR7.bit.SCI_A = 1;
+    __asm(" RPT #4 || NOP");
+    // Baudrate setzen
+    // (Low-Speed CLK / (BAUD * 8)) - 1, gerundet
+    // Low-Speed CLK = SYSCLK / 4 (50 MHz bei 200 MHz, siehe "DeviceInit()")
+    UartSetBaudA(baud);
+    // Anzahl der Datenbits setzen
+    SciaRegs.SCICCR.bit.SCICHAR = numberOfDataBits;
+    // Anzahl der Stopbits setzen
+    SciaRegs.SCICCR.bit.STOPBITS = numberOfStopBits;
+    // Paritt setzen
+		switch (parity)
+		{
+				// Gerade Paritt
+				case UART_PARITY_EVEN:
+						SciaRegs.SCICCR.bit.PARITYENA = 1;
+						SciaRegs.SCICCR.bit.PARITY    = 1;
+						break;
+				// Ungerade Paritt
+				case UART_PARITY_ODD:
+						SciaRegs.SCICCR.bit.PARITYENA = 1;
+						SciaRegs.SCICCR.bit.PARITY    = 0;
+						break;
+				// Keine Paritt
+				default:
+						SciaRegs.SCICCR.bit.PARITYENA = 0;
+		}
+    // RxD und TxD ausschalten
+    SciaRegs.SCICTL1.bit.RXENA = 0;
+    SciaRegs.SCICTL1.bit.TXENA = 0;
+    // Soft-Reset deaktivieren (mit aktiverten
+		// Soft-Reset ist der FIFO-Modus ausgeschaltet)
+    SciaRegs.SCICTL1.bit.SWRESET = 1;
+    // FIFO-Modus (fr Tx und Rx) einschalten
+    SciaRegs.SCIFFTX.bit.SCIFFENA = 1;
+    // FIFO-Interrupts ausschalten
+    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+    SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+
+    // CPU-Interrupts whrend der Konfiguration global sperren
+    DINT;
+    // Interrupt-Service-Routinen fr den RxD-Interrupt an die
+    // entsprechende Stelle (SCIA_RX_INT) der PIE-Vector Table speichern
+    PieVectTable.SCIA_RX_INT = &UartRxISRA;
+    // SCIA_RX-Interrupt freischalten (Zeile 9, Spalte 1 der Tabelle)
+    // (siehe PIE-Vector Table S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 1;
+    // Interrupt-Service-Routinen fr den TxD-Interrupt an die
+    // entsprechende Stelle (SCIA_TX_INT) der PIE-Vector Table speichern
+    PieVectTable.SCIA_TX_INT = &UartTxISRA;
+    // SCIA_TX-Interrupt freischalten (Zeile 9, Spalte 2 der Tabelle 3-2)
+    // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1;
+    // CPU-Interrupt 9 einschalten (Zeile 9 der Tabelle 3-2)
+    IER |= M_INT9;
+    // CPU-Interrupts nach Konfiguration global wieder freigeben
+    EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		// Baudrate bei einer nderung des Systemtakts anpassen
+		DeviceRegisterClockCallback(&UartClockChangedA);
+
+    // Software-Puffer inititalisieren
+    UartInitBufferRxA();
+    UartInitBufferTxA();
+    // Steuervariablen initialisieren
+    uartBufferIndexRxA     = 0;
+    uartBufferIndexTxA     = 0;
+    uartBufferIndexRxOldA  = uartBufferIndexRxA;
+    uartBytesToTransferRxA = 0;
+		uartBytesToTransferTxA = 0;
+		uartStatusFlagRxA      = UART_STATUS_IDLE;
+		uartStatusFlagTxA      = UART_STATUS_IDLE;
+		uartTxLastByteLoadedA  = false;
+		uartFlagCheckRxA       = false;
+		uartRxTimeoutA         = UART_NO_TIMEOUT;
+		uartAutoBaudActiveA    = false;
+}
+
+
+//=== Function: UartAutoBaudStartA ================================================================
+///
+/// @brief  Funktion startet die automatische Erkennung der Baudrate (Autobaud, siehe Kapitel SCI
+///					im Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Der Teiler wird auf
+///					UART_AUTO_BAUD_DIVIDER gesetzt, danach muss die Gegenstelle in der gewnschten
+///					Baudrate das Zeichen 'A' oder 'a' senden. Die Hardware misst das Zeichen und trgt
+///					den Teiler ein, der Abschluss wird mit "UartAutoBaudPollA()" abgefragt. Bei hohen
+///					Baudraten (ab ca. 100 kBaud) kann die Flankensteilheit der bertragung die Erkennung
+///					verhindern, dann die Baudrate fest mit "UartInitA()" einstellen. Die Erkennung
+///					wird nur gestartet, falls keine Kommunikation und kein Streaming-Betrieb aktiv ist.
+///
+/// @param  void
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool UartAutoBaudStartA(void)
+{
+		if (   uartStreamModeA
+				|| (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+				|| (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS))
+		{
+				return false;
+		}
+
+		// Empfang einschalten, der Empfangs-Interrupt bleibt aus
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCICTL1.bit.RXENA = 1;
+		// Teiler fr die Messung setzen, Flag lschen und Erkennung einschalten
+		SciaRegs.SCIHBAUD.bit.BAUD = (UART_AUTO_BAUD_DIVIDER & 0xFF00) >> 8;
+		SciaRegs.SCILBAUD.bit.BAUD =  UART_AUTO_BAUD_DIVIDER & 0x00FF;
+		SciaRegs.SCIFFCT.bit.ABDCLR = 1;
+		SciaRegs.SCIFFCT.bit.CDC = 1;
+		uartAutoBaudActiveA = true;
+
+		return true;
+}
+
+
+//=== Function: UartAutoBaudPollA =================================================================
+///
+/// @brief  Funktion prft ohne zu blockieren, ob die automatische Erkennung der Baudrate
+///					abgeschlossen ist (SCIFFCT.ABD). In dem Fall wird die Erkennung ausgeschaltet, der
+///					Empfangs-FIFO geleert und die erkannte Baudrate in "uartBaudActualA" eingetragen.
+///					Sie ist danach der Bezug fr "uartBaudErrorPpmA" und wird bei einer nderung des
+///					Systemtakts ebenfalls umgerechnet. Zyklisch (z.B. in einer Task) aufrufen.
+///
+/// @param  void
+///
+/// @return bool baudDetected
+///
+//=================================================================================================
+bool UartAutoBaudPollA(void)
+{
+		if (!uartAutoBaudActiveA || !SciaRegs.SCIFFCT.bit.ABD)
+		{
+				return false;
+		}
+
+		// Flag lschen und Erkennung ausschalten
+		SciaRegs.SCIFFCT.bit.ABDCLR = 1;
+		SciaRegs.SCIFFCT.bit.CDC = 0;
+		uartAutoBaudActiveA = false;
+
+		// Zeichen der Messung verwerfen
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				(void)SciaRegs.SCIRXBUF.all;
+		}
+		SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+
+		// Erkannte Baudrate als neuen Bezug bernehmen
+		uartBaudRequestedA = 0;
+		UartUpdateBaudA();
+
+		return true;
+}
+
+
+//=== Function: UartInitBufferRxA =================================================================
+///
+/// @brief  Funktion initialisiert alle Elemente des UART Software-Empfangspuffers zu 0.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void UartInitBufferRxA(void)
+{
+    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_RX; i++)
+    {
+        uartBufferRxA[i] = 0;
+    }
+}
+
+
+//=== Function: UartInitTxBufferA =================================================================
+///
+/// @brief  Funktion initialisiert alle Elemente des UART Software-Sendepuffers zu 0.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void UartInitBufferTxA(void)
+{
+    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_TX; i++)
+    {
+        uartBufferTxA[i] = 0;
+    }
+}
+
+
+//=== Function: UartGetStatusRxA ==================================================================
+///
+/// @brief	Funktion gibt den aktuellen Status der UART-Kommunikation (Empfangs-Prozess) zurck
+///				  und prft den Empfang von Daten, d.h. es wird abhngig vom Wert der Variable
+///					"uartBytesToTransferRxA" (wird ber die Funktion "UartReceiveA()" gesetzt) die
+///					Gltigkeit der empfangenen Daten geprft (Lnge des empfangenen Datenpakets). Damit
+///					diese Prfung funktioniert, muss die Funktion innerhalb eines definierten Intervalls
+///					aufgerufen werden. Die min. Zeit zwischen den Aufrufen muss lnger sein, als der
+///					Empfang eines vollstndigen Datenpakets dauert:
+///
+///         t_min > ((1 Start-Bit + 1 Stop-Bit + 8 Daten-Bits)/Baud-Rate) * Bytes pro Datenpaket
+///
+///					Die max. Zeit richtet sich nach der Hufigkeit der zu empfangenen Daten. Die
+///					Kommunikation ist Interrupt-basiert. Die Funktion gibt folgende Zustnde der
+///					Kommunikation zurck:
+///
+///					- UART_STATUS_IDLE       : Es ist keine Empfangs-Kommunikation aktiv
+///					- UART_STATUS_IN_PROGRESS: Es werde mindestens 1 Byte empfangen
+///					- UART_STATUS_FINISHED   : Eine Empfangs-Kommunikation ist abgeschlossen
+///
+///					Zum starten einer Empfangs-Kommunikation muss die Funktionen "UartReceiveA()"
+///					aufgerufen werden. Dabei wird nicht aktiv ein Empfang durchgefhrt, da UART nicht
+///					Master-Slave-basiert ist. Siehe hierzu die Beschreibung der Funktion "UartReceiveA()".
+///
+/// @param	void
+///
+/// @return uint16_t uartStatusFlagRxA
+///
+//=================================================================================================
+extern uint16_t UartGetStatusRxA(void)
+{
+		// Die Kommunikaton wurde gestartet
+		if (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+		{
+				// Es wurden seit dem letzten Aufruf der Funktion
+				// keine neuen Daten in den Software-Puffer kopiert
+				if (uartBufferIndexRxA == uartBufferIndexRxOldA)
+				{
+						// Es wurde ein vollstndiges Datenpaket empfangen
+						// und keine weiteren Daten empfangen (FIFO ist leer)
+						if (   (uartBufferIndexRxA == uartBytesToTransferRxA)
+							  && !SciaRegs.SCIFFRX.bit.RXFFST)
+						{
+						    // Empfangen ausschalten
+						    SciaRegs.SCICTL1.bit.RXENA = 0;
+						    // Empfangs-FIFO-Interrupt ausschalten
+						    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+								// Timeout-Zhler initialisieren
+								uartRxTimeoutA = UART_NO_TIMEOUT;
+								// Status-Flag setzen
+								uartStatusFlagRxA = UART_STATUS_FINISHED;
+						}
+						// Es wurde mindestens ein Byte in den Software-Puffer kopiert, jedoch kein
+						// komplettes Datenpaket (entweder zu wenige oder zu viele Bytes empfangen)
+						// oder es wurden weniger Bytes empfangen, als das Interrupt-Niveau. Die
+						// letzte Bedingung wrde zutreffen, wenn diese Funktion kurz nach Beginn
+						// einer Empfangskommunikation aufgerufen wird, also wenn bereits ein Paar
+						// Bytes empfangen wurden, jedoch deren Anzahl noch unterhalb des ersten
+						// Interrupt-Niveaus liegt. Damit hierdurch die Abfrage-Bedingung nicht
+						// erfllt wird, wird der Wert der empfangenen Bytes mit dem aus dem vor-
+						// herigen Funktionsaufruf verglichen
+						else if (   uartBufferIndexRxA
+										 || (SciaRegs.SCIFFRX.bit.RXFFST && (SciaRegs.SCIFFRX.bit.RXFFST == uartOldValueFifoBufferA)))
+						{
+						    // Empfangen ausschalten
+						    SciaRegs.SCICTL1.bit.RXENA = 0;
+						    // Empfangs-FIFO-Interrupt ausschalten
+						    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+								// Status auf "bereit" setzen
+								uartStatusFlagRxA = UART_STATUS_IDLE;
+						}
+				}
+				// Es wurden seit dem letzten Aufruf der Funktion neue Daten in den Software-Puffer kopiert
+				else
+				{
+						// Alten und neuen Zhler synchronisieren
+						uartBufferIndexRxOldA = uartBufferIndexRxA;
+				}
+				// Aktuelle Zahl der im Empfangs-FIFO befindlichen Bytes speichern.
+				// Wird zur Erkennung von Empfangsfehlern bentigt
+				uartOldValueFifoBufferA = SciaRegs.SCIFFRX.bit.RXFFST;
+				// Innerhalb des vorgegebenen Zeitfensters (wird bei Aufruf der Funktion
+				// "UartReceive()" bergeben) wurde kein vollstndiges Datenpaket empfangen
+				if (uartRxTimeoutA == 0)
+				{
+						// Zhler initialisieren, damit der Empfangsvorgang
+						// in dieser Funktion nur einmalig abgebochen wird
+						uartRxTimeoutA = UART_NO_TIMEOUT;
+				    // Empfangen ausschalten
+				    SciaRegs.SCICTL1.bit.RXENA = 0;
+				    // Empfangs-FIFO-Interrupt ausschalten
+				    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+						// Staus auf "Timeout" setzen
+						uartStatusFlagRxA = UART_STATUS_RX_TIMEOUT;
+				}
+		}
+		return uartStatusFlagRxA;
+}
+
+
+//=== Function: UartGetStatusTxA ==================================================================
+///
+/// @brief	Funktion gibt den aktuellen Status der Tx UART-Kommunikation (senden) zurck.
+///					Die Kommunikation ist Interrupt-basiert und kann folgende Zustnde annehmen:
+///
+///					- UART_STATUS_IDLE       : Es ist keine Sende-Kommunikation aktiv
+///					- UART_STATUS_IN_PROGRESS: Eine Sende-Kommunikation wurde gestartet
+///					- UART_STATUS_FINISHED   : Das letzte Byte wurde vollstndig gesendet
+///
+///					Zum starten einer Sende-Kommunikation muss die Funktionen "UartTransmitA()"
+///					aufgerufen werden. Das Ende der bertragung wird bei jedem Aufruf mit der Funktion
+///					"UartPollTxA()" geprft.
+///
+/// @param	void
+///
+/// @return uint16_t uartStatusFlagTx
+///
+//=================================================================================================
+extern uint16_t UartGetStatusTxA(void)
+{
+		UartPollTxA();
+		return uartStatusFlagTxA;
+}
+
+
+//=== Function: UartPollTxA =======================================================================
+///
+/// @brief	Funktion prft, ob das letzte Byte eines Datenpakets vollstndig gesendet wurde und
+///					setzt in diesem Fall das Status-Flag auf "UART_STATUS_FINISHED". Die ISR
+///					"UartTxISRA()" wartet nicht mehr auf SCICTL2.TXEMPTY, sondern markiert nur, dass
+///					alle Bytes in den Sende-FIFO geschrieben wurden. Die Funktion wird von
+///					"UartGetStatusTxA()" aufgerufen und kann zustzlich zyklisch aus einer Timer-ISR
+///					aufgerufen werden (z.B. "Pwm8ISR()"), z.B. um einen RS485-Treiber rechtzeitig auf
+///					"Empfang" umzuschalten. Sie blockiert nie.
+///
+/// @param	void
+///
+/// @return bool transmissionFinished
+///
+//=================================================================================================
+extern bool UartPollTxA(void)
+{
+		// SCICTL2.TXEMPTY wird gesetzt, sobald der Sende-FIFO und das Ausgangs-
+		// Schieberegister TXSHF leer sind (S. 3888 Reference Manual TMS320F2838x,
+		// SPRUII0D, Rev. D, July 2022)
+		if (   uartTxLastByteLoadedA
+				&& (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS)
+				&& SciaRegs.SCICTL2.bit.TXEMPTY)
+		{
+				uartTxLastByteLoadedA = false;
+				uartStatusFlagTxA = UART_STATUS_FINISHED;
+		}
+		return (uartStatusFlagTxA == UART_STATUS_FINISHED);
+}
+
+
+//=== Function: UartSetStatusIdleRxA ==============================================================
+///
+/// @brief	Funktion setzt das Rx Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
+///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
+///					verndert und es wird "false" zurck gegeben.
+///
+/// @param	void
+///
+/// @return bool flagSetToIdle
+///
+//=================================================================================================
+extern bool UartSetStatusIdleRxA(void)
+{
+		bool flagSetToIdle = false;
+		// Staus-Flag nur auf "idle" setzen, falls eine
+		// vorherige Kommunikation abgeschlossen ist
+		if (uartStatusFlagRxA != UART_STATUS_IN_PROGRESS)
+		{
+				uartStatusFlagRxA = UART_STATUS_IDLE;
+				flagSetToIdle = true;
+		}
+		return flagSetToIdle;
+}
+
+
+//=== Function: UartSetStatusIdleTxA ==============================================================
+///
+/// @brief	Funktion setzt das Tx Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
+///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
+///					verndert und es wird "false" zurck gegeben.
+///
+/// @param	void
+///
+/// @return bool flagSetToIdle
+///
+//=================================================================================================
+extern bool UartSetStatusIdleTxA(void)
+{
+		bool flagSetToIdle = false;
+		// Staus-Flag nur auf "idle" setzen, falls eine
+		// vorherige Kommunikation abgeschlossen ist
+		if (UartPollTxA())
+		{
+				uartStatusFlagTxA = UART_STATUS_IDLE;
+				flagSetToIdle = true;
+		}
+		return flagSetToIdle;
+}
+
+
+//=== Function: UartReceiveA ======================================================================
+///
+/// @brief  Funktion konfiguriert die Steuervariablen und den Empfangs-Interrupt so, dass Daten
+///					ber UART empfangen werden knnen. Der Parameter "numberOfBytesRx" gibt an, wie viele
+///					Bytes empfangen werden sollen. Wenn diese Anzahl erreicht ist, gibt die Funktion
+///					"UartGetStatusRxA()" bei Aufruf den Wert "UART_STATUS_RX_FINISHED" zurck (Daten
+///					vollstndig empfangen). Wird innerhalb des mit dem Parameter "timeOut" bergebenen
+///					Zeitfensters (= timeOut * 5 ms) kein vollstndiges Datenpaket empfangen, so wird
+///					der Empfangsvorgang abgebrochen (z.B. im Hauptprogramm durch Abfrage der Variable
+///         "uartRxTimeoutA" auf 0). Da UART eine asynchrone Schnittstelle ist, ist die Funktion
+///					"UartReceiveA()" nicht als Funktion zum forcierten Empfangen von Daten zu verstehen,
+///					sondern als initialisierende Vorbereitung zum Empfang vom Daten.
+///
+/// @param  uint16_t numberOfBytesRx, int32_t timeOut
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+extern bool UartReceiveA(uint16_t numberOfBytesRx,
+												 int32_t timeOut)
+{
+		// Ergebnis des Funktionsaufrufes (Empfangsvorgang initiiert / nicht initiiert)
+		bool operationPerformed = false;
+		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist
+		// und die Anzahl der zu empfangenen Bytes die Gre des Software-Puffers
+		// nicht berschreitet und mindestens 1 ist
+		if ((uartStatusFlagRxA != UART_STATUS_IN_PROGRESS)
+				&& (numberOfBytesRx <= UART_SIZE_SOFTWARE_BUFFER_RX)
+				&& numberOfBytesRx
+				&& !uartStreamModeA
+				&& !uartAutoBaudActiveA)
+		{
+				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
+				// zu signalisieren, dass der Empfangsvorgang initiiert wurde
+				operationPerformed = true;
+				// Flag setzen um der aufrufenden Stelle zu signalisieren,
+				// dass eine UART-Kommunikation gestartet wurde
+				uartStatusFlagRxA = UART_STATUS_IN_PROGRESS;
+				// Timeout-Zhler auf den bergebenen Wert setzen
+				uartRxTimeoutA = timeOut;
+
+				// Index zur Verwaltung des Software-Puffers "uartBufferRxA[]" auf das erste Element
+				// setzen, damit die zu sendenen Daten vom Anfang des Puffers beginnend kopiert werden
+				uartBufferIndexRxA    = 0;
+				uartBufferIndexRxOldA = 0;
+				// Menge der zu empfangenen Bytes an die Steuervariable bergeben.
+				// Diese koordiniert die restliche Kommunikation in der ISR und
+				// der Funktion "UartGetStatusRxA()"
+				uartBytesToTransferRxA = numberOfBytesRx;
+				// Empfangs-FIFO leeren, falls in diesem noch Daten vorhanden sind
+				while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+				{
+						(void)SciaRegs.SCIRXBUF.all;
+				}
+				uartOldValueFifoBufferA = SciaRegs.SCIFFRX.bit.RXFFST;
+		    // Empfangs-FIFO-Interrupt auslsen, wenn die Anzahl
+				// erwarteter Bytes empfangen wurde oder die max.
+				// Kapazitt des FIFOs erreicht ist
+		    SciaRegs.SCIFFRX.bit.RXFFIL = numberOfBytesRx;
+		    if (numberOfBytesRx > UART_SIZE_HARDWARE_FIFO)
+		    {
+		    		SciaRegs.SCIFFRX.bit.RXFFIL = UART_SIZE_HARDWARE_FIFO;
+		    }
+		    // Evtl. gesetztes Overflow-Flag lschen, da kein Interrupt
+		    // ausgelst werden, falls das Bit gesetzt ist
+		    SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+		    //Empfangs-FIFO-Interrupt-Flag lschen
+		    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		    // Empfangs-FIFO-Interrupt einschalten
+		    SciaRegs.SCIFFRX.bit.RXFFIENA = 1;
+		    // Empfangen einschalten
+		    SciaRegs.SCICTL1.bit.RXENA = 1;
+		}
+		return operationPerformed;
+}
+
+
+//=== Function: UartTransmitA =====================================================================
+///
+/// @brief  Funktion sendet ber UART Daten aus dem Sotware-Puffer "uartBufferTx[]". Der
+///					Parameter "numberOfBytesTx" gibt an, wie viele Bytes gesendet werden sollen. Es
+///				  wird der Hardware-FIFO des Mikrocontrollers benutzt. In diesen werden zunchst
+///					die Daten aus dem Software-Puffer "uartBufferTx[]" kopiert. Sollen mehr Bytes
+///					versendet werden, als der FIFO fasst, so wird der FIFO vollstndig gefllt und
+///					im nchsten Aufruf der ISR die restlichen Bytes in den Sende-FIFO kopiert. Die
+///					ISR wird aufgerufen, sobald der Sende-FIFO leer ist.
+///
+/// @param  uint16_t numberOfBytesTx
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+extern bool UartTransmitA(uint16_t numberOfBytesTx)
+{
+		// Ergebnis des Funktionsaufrufes (Sendevorgang gestartet / nicht gestartet)
+		bool operationPerformed = false;
+		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist
+		// und die Anzahl der zu sendenen Bytes die Gre des Software-Puffers
+		// nicht berschreitet und mindestens 1 ist
+		if ((uartStatusFlagTxA != UART_STATUS_IN_PROGRESS)
+				&& (numberOfBytesTx <= UART_SIZE_SOFTWARE_BUFFER_TX)
+				&& numberOfBytesTx
+				&& !uartStreamModeA
+				&& !uartAutoBaudActiveA)
+		{
+				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
+				// zu signalisieren, dass der Sendevorgang gestartet wurde
+				operationPerformed = true;
+				// Flag setzen um der aufrufenden Stelle zu signalisieren,
+				// dass eine UART-Kommunikation gestartet wurde
+				uartStatusFlagTxA = UART_STATUS_IN_PROGRESS;
+				uartTxLastByteLoadedA = false;
+				// Index zur Verwaltung des Software-Puffers "uartBufferTxA[]" auf das erste Element
+				// setzen, damit die zu sendenen Daten vom Anfang des Puffers aus kopiert werden
+				uartBufferIndexTxA = 0;
+				// Menge der zu sendenen Bytes an die Steuervariable bergeben.
+				// Diese koordiniert die restliche Kommunikation in der ISR
+				uartBytesToTransferTxA = numberOfBytesTx;
+		    // Senden einschalten (muss VOR dem Beschreiben des Sende-FIFOs gesetzt werden)
+		    SciaRegs.SCICTL1.bit.TXENA = 1;
+		    // Zu sendene Daten von dem Software-Puffer in den Sende-FIFO kopieren
+				// bis dieser gefllt ist oder der Software-Puffer leer ist
+				while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
+							 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
+				{
+						SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
+						uartBufferIndexTxA++;
+				}
+		    // Sende-FIFO-Interrupt-Flag lschen
+		    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+		    // Tx-FIFO-Interrupt wird ausgelst, wenn der Wert in SCIFFTX.TXFFST gleich oder
+		    // kleiner SCIFFTX.TXFFIL ist. SCIFFTX.TXFFST gibt die Anzahl der sich im Sende-
+		    // FIFO befindlichen Bytes an. Dieser Wert wird mit jedem vom Sende-FIFO in das
+		    // Sende-Schieberegister kopierte Byte um 1 reduziert. ACHTUNG: SCIFFTX.TXFFST
+		    // = 0 bedeutet nicht, dass das Senden abgeschlossen sit, da sich das letzte Byte
+		    // noch im Sende-Shift-Register befindet und Bit fr Bit ausgesendet wird. Um zu
+		    // prfen, ob der Sendevorgang vollstndig abgeschlossen ist, muss das Bit
+		    // SCICTL2.TXEMPTY abgefragt werden. Dies ist 1, sobald Sende-FIFO und Sende-
+		    // Shift-Register leer sind.
+		    // Sende-FIFO-Interrupt auslsen, wenn der Sende-FIFO leer ist
+		    SciaRegs.SCIFFTX.bit.TXFFIL = 0;
+		    // Tx-FIFO-Interrupt einschalten
+		    SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+		}
+		return operationPerformed;
+}
+
+
+//=== Function: UartStartStreamA ==================================================================
+///
+/// @brief  Funktion startet den Streaming-Betrieb. Die Ringpuffer werden geleert, die ISRs fr
+///					den Streaming-Betrieb in die PIE-Vector Table eingetragen und der Empfang dauerhaft
+///					eingeschaltet. Im Gegensatz zu "UartReceiveA()" muss der Empfang nicht nach jedem
+///					Datenpaket neu freigegeben werden, alle empfangenen Bytes landen lckenlos im
+///					Ringpuffer "uartRingRxA". Die Funktionen "UartReceiveA()" und "UartTransmitA()"
+///					sind im Streaming-Betrieb gesperrt. Der Betrieb wird nur gestartet, falls keine
+///					Kommunikation mit den Funktionen "UartReceiveA()" bzw. "UartTransmitA()" aktiv ist.
+///
+/// @param  void
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+extern bool UartStartStreamA(void)
+{
+		if (   uartAutoBaudActiveA
+				|| (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+				|| (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS))
+		{
+				return false;
+		}
+
+		// FIFO-Interrupts whrend der Umstellung ausschalten
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+
+		// Ringpuffer leeren
+		uartRingRxA.head  = 0;
+		uartRingRxA.tail  = 0;
+		uartRingTxA.head  = 0;
+		uartRingTxA.tail  = 0;
+		uartRingOverflowA = 0;
+
+		// ISRs fr den Streaming-Betrieb eintragen
+		EALLOW;
+		PieVectTable.SCIA_RX_INT = &UartRxStreamISRA;
+		PieVectTable.SCIA_TX_INT = &UartTxStreamISRA;
+		EDIS;
+		uartStreamModeA = true;
+
+		// Empfangs-FIFO leeren, falls in diesem noch Daten vorhanden sind
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				(void)SciaRegs.SCIRXBUF.all;
+		}
+		SciaRegs.SCIFFRX.bit.RXFFIL = UART_STREAM_RX_FIFO_LEVEL;
+		SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 1;
+		SciaRegs.SCICTL1.bit.RXENA = 1;
+
+		// Senden bleibt dauerhaft eingeschaltet. Der Sende-FIFO-Interrupt
+		// wird erst von "UartWriteA()" eingeschaltet
+		SciaRegs.SCIFFTX.bit.TXFFIL = UART_STREAM_TX_FIFO_LEVEL;
+		SciaRegs.SCICTL1.bit.TXENA = 1;
+		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+
+		return true;
+}
+
+
+//=== Function: UartStopStreamA ===================================================================
+///
+/// @brief  Funktion beendet den Streaming-Betrieb und trgt wieder die ISRs fr die Kommunikation
+///					mit "UartReceiveA()" und "UartTransmitA()" ein. Noch nicht gesendete Bytes im
+///					Sende-Ringpuffer werden verworfen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartStopStreamA(void)
+{
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+		SciaRegs.SCICTL1.bit.RXENA = 0;
+		SciaRegs.SCICTL1.bit.TXENA = 0;
+
+		EALLOW;
+		PieVectTable.SCIA_RX_INT = &UartRxISRA;
+		PieVectTable.SCIA_TX_INT = &UartTxISRA;
+		EDIS;
+
+		uartStreamModeA   = false;
+		uartStatusFlagRxA = UART_STATUS_IDLE;
+		uartStatusFlagTxA = UART_STATUS_IDLE;
+}
+
+
+//=== Function: UartWriteA ========================================================================
+///
+/// @brief  Funktion schreibt bis zu "numberOfBytes" Bytes in den Sende-Ringpuffer und schaltet den
+///					Sende-FIFO-Interrupt ein. Die ISR "UartTxStreamISRA()" kopiert die Bytes in den
+///					Sende-FIFO. Ist im Ringpuffer nicht genug Platz, werden nur so viele Bytes
+///					geschrieben, wie Platz ist. Darf nur aus einem Programmteil aufgerufen werden
+///					(ein Erzeuger).
+///
+/// @param  const uint16_t *data, uint16_t numberOfBytes
+///
+/// @return uint16_t Anzahl der geschriebenen Bytes
+///
+//=================================================================================================
+extern uint16_t UartWriteA(const uint16_t *data, uint16_t numberOfBytes)
+{
+		uint16_t head = uartRingTxA.head;
+		uint16_t space = UartGetTxFreeA();
+
+		if (!uartStreamModeA)
+		{
+				return 0;
+		}
+		if (numberOfBytes > space)
+		{
+				numberOfBytes = space;
+		}
+		for (uint16_t i=0; i<numberOfBytes; i++)
+		{
+				uartRingTxA.data[head] = data[i] & 0x00FF;
+				head = (head + 1) & UART_RING_INDEX_MASK;
+		}
+		if (numberOfBytes)
+		{
+				UartTxCommitA(head);
+		}
+		return numberOfBytes;
+}
+
+
+//=== Function: UartTxCommitA =====================================================================
+///
+/// @brief  Funktion gibt die Bytes im Sende-Ringpuffer bis zur Position "head" (exklusive) fr die
+///					ISR frei und schaltet den Sende-FIFO-Interrupt ein. Ist der FIFO bereits unter dem
+///					Interrupt-Niveau, wird die ISR sofort aufgerufen. Damit knnen Daten direkt im
+///					Ringpuffer aufgebaut werden (z.B. von "myTelemetry.c"), ohne sie vorher in einen
+///					eigenen Puffer zu schreiben. Der Aufrufer muss zuvor mit "UartGetTxFreeA()" prfen,
+///					dass genug Platz vorhanden ist.
+///
+/// @param  uint16_t head
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartTxCommitA(uint16_t head)
+{
+		// Erst nach dem Kopieren der Daten den Index verffentlichen
+		uartRingTxA.head = head & UART_RING_INDEX_MASK;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+}
+
+
+//=== Function: UartReadA =========================================================================
+///
+/// @brief  Funktion liest bis zu "maxNumberOfBytes" Bytes aus dem Empfangs-Ringpuffer. Darf nur
+///					aus einem Programmteil aufgerufen werden (ein Verbraucher).
+///
+/// @param  uint16_t *data, uint16_t maxNumberOfBytes
+///
+/// @return uint16_t Anzahl der gelesenen Bytes
+///
+//=================================================================================================
+extern uint16_t UartReadA(uint16_t *data, uint16_t maxNumberOfBytes)
+{
+		uint16_t tail  = uartRingRxA.tail;
+		uint16_t count = UartGetRxCountA();
+
+		if (maxNumberOfBytes > count)
+		{
+				maxNumberOfBytes = count;
+		}
+		for (uint16_t i=0; i<maxNumberOfBytes; i++)
+		{
+				data[i] = uartRingRxA.data[tail];
+				tail = (tail + 1) & UART_RING_INDEX_MASK;
+		}
+		// Erst nach dem Kopieren der Daten den Platz freigeben
+		uartRingRxA.tail = tail;
+		return maxNumberOfBytes;
+}
+
+
+//=== Function: UartGetRxCountA ===================================================================
+///
+/// @brief  Funktion gibt die Anzahl der Bytes im Empfangs-Ringpuffer zurck
+///
+/// @param  void
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+extern uint16_t UartGetRxCountA(void)
+{
+		return (uartRingRxA.head - uartRingRxA.tail) & UART_RING_INDEX_MASK;
+}
+
+
+//=== Function: UartGetTxFreeA ====================================================================
+///
+/// @brief  Funktion gibt die Anzahl freier Pltze im Sende-Ringpuffer zurck. Ein Platz bleibt
+///					immer frei, um einen vollen von einem leeren Ringpuffer zu unterscheiden.
+///
+/// @param  void
+///
+/// @return uint16_t free
+///
+//=================================================================================================
+extern uint16_t UartGetTxFreeA(void)
+{
+		return (uartRingTxA.tail - uartRingTxA.head - 1) & UART_RING_INDEX_MASK;
+}
+
+
+//=== Function: UartPollRxA =======================================================================
+///
+/// @brief  Funktion kopiert im Streaming-Betrieb die Bytes aus dem Empfangs-FIFO in den Ring-
+///					puffer, die das Interrupt-Niveau UART_STREAM_RX_FIFO_LEVEL nicht erreichen (z.B.
+///					das Ende eines Datenpakets). Dadurch wird die ISR "UartRxStreamISRA()" nur einmal
+///					pro UART_STREAM_RX_FIFO_LEVEL Bytes statt fr jedes Byte aufgerufen. Die Funktion
+///					muss zyklisch aus einer ISR aufgerufen werden, die nicht von der SCI-A-ISR
+///					unterbrochen werden kann (z.B. "Pwm8ISR()", keine Interrupt-Verschachtelung).
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartPollRxA(void)
+{
+		if (uartStreamModeA)
+		{
+				UartRxStreamDrainA();
+		}
+}
+
+
+//=== Function: UartRxISRA ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald der (Hardware-) Empfangs-FIFO voll ist oder die Anzahl
+///					an Bytes die im Register SCIFFRX.RXFFIL steht empfangen wurde. Aus dem Empfangs-
+///					FIFO werden die Daten in den Software-Puffer "uartBufferRxA[]" kopiert, bis die
+///					erwartete Zahl an Bytes (uartBytesToTransferRx) erreicht ist.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_RX);
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_UART_RX);
+
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		// Daten aus dem Empfangs-FIFO in den Software-Puffer kopieren bis die
+		// erwartete Anzahl an Bytes empfangen wurde oder der FIFO leer ist
+		while (   (uartBufferIndexRxA < uartBytesToTransferRxA)
+					 && (SciaRegs.SCIFFRX.bit.RXFFST > 0))
+		{
+				uartBufferRxA[uartBufferIndexRxA] = SciaRegs.SCIRXBUF.bit.SAR;
+				uartBufferIndexRxA++;
+		}
+		// Es werden noch weitere Bytes erwartet -> neues Interrupt-Niveau setzen
+		if (uartBufferIndexRxA < uartBytesToTransferRxA)
+		{
+		    if ((uartBytesToTransferRxA - uartBufferIndexRxA) > UART_SIZE_HARDWARE_FIFO)
+		    {
+		    		SciaRegs.SCIFFRX.bit.RXFFIL = UART_SIZE_HARDWARE_FIFO;
+		    }
+		    else
+		    {
+		    		SciaRegs.SCIFFRX.bit.RXFFIL =	(uartBytesToTransferRxA - uartBufferIndexRxA);
+		    }
+		}
+		// Die erwartete Anzahl an Bytes wurde empfangen
+		else
+		{
+		    // Empfangs-FIFO-Interrupt ausschalten
+		    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		    // Empfangen weiterhin eingeschaltet lassen,
+		    // um eine berzahl an Bytes zu erkennen
+		    // (mehr Bytes empfangen als Datepaketgre)
+		}
+
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_UART_RX);
+		// Empfangs-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_RX);
+}
+
+
+//=== Function: UartTxISRA ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald ein Byte aus dem Register SCITXBUF in das Senderegister
+///					geshiftet wurde. Das bedeutet, dass die ISR aufgerufen wird, wenn das zu sendene
+///					Byte gerade angefangen wird an dem Pin TxD auszugeben und nicht nach Ende des
+///					Sendevorgangs! Sind beim Aufruf der ISR noch weitere Bytes zu senden, so wird
+///         das nchste aus dem Software-Puffer "uartBufferTxA[]" gesendet. Andernfalls wird
+///         der Tx-Interrupt ausgeschaltet. Anschlieend werden alle Interrupt-Flags gelscht.
+///					Auf das Ende des letzten Bytes wird nicht gewartet, dies prft "UartPollTxA()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_TX);
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_UART_TX);
+
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		// Alle Bytes wurden aus dem Software-Puffer uartBufferTx[] in den (Hardware-) Sende-Puffer
+		// SCIFFTX.TXFFST und von dort in das Ausgangs-Schieberegister TXSHF geladen (siehe S. 3866
+		// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Zu diesem Zeitpunkt wird
+		// das letzte Byte noch versendet!
+		if (uartBufferIndexTxA == uartBytesToTransferTxA)
+		{
+		    // Senden ausschalten. Es werden trotzdem noch alle Daten aus dem Puffer
+				// SCITXBUF.TXDT versendet (siehe S. 3885 Reference Manual TMS320F2838x,
+				// SPRUII0D, Rev. D, July 2022)
+		    SciaRegs.SCICTL1.bit.TXENA = 0;
+		    // Sende-FIFO-Interrupt ausschalten
+		    SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+				// Nicht auf das Ende des letzten Bytes warten (SCICTL2.TXEMPTY), da dies
+				// die PIE-Gruppe 9 bis zu einer Zeichendauer blockieren wrde. Das Ende
+				// der bertragung wird von "UartPollTxA()" erkannt
+				uartTxLastByteLoadedA = true;
+		}
+    // Zu sendene Daten von dem Software-Puffer in den Sende-FIFO kopieren
+		// bis diser gefllt ist oder der Software-Puffer leer ist. Dieser
+		// Teil muss hinter der obigen if-Abfrage stehen, da andernfalls der
+		// Sendevorgang beendet werden wrde
+		while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
+					 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
+		{
+				SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
+				uartBufferIndexTxA++;
+		}
+
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_UART_TX);
+		// Sende-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_TX);
+}
+
+
+//=== Function: UartRxStreamISRA ==================================================================
+///
+/// @brief  ISR des Streaming-Betriebs. Wird aufgerufen, sobald die Anzahl an Bytes im Empfangs-
+///					FIFO das Interrupt-Niveau erreicht. Alle Bytes des FIFOs werden in den Empfangs-
+///					Ringpuffer kopiert (siehe "UartRxStreamDrainA()"). Der Empfang bleibt eingeschaltet.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxStreamISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_RX);
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_UART_RX);
+
+		UartRxStreamDrainA();
+
+		// berlauf des Hardware-FIFOs quittieren, da sonst kein weiterer Interrupt ausgelst wird
+		if (SciaRegs.SCIFFRX.bit.RXFFOVF)
+		{
+				uartRingOverflowA++;
+				SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+		}
+
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_UART_RX);
+		// Empfangs-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_RX);
+}
+
+
+//=== Function: UartTxStreamISRA ==================================================================
+///
+/// @brief  ISR des Streaming-Betriebs. Wird aufgerufen, sobald die Anzahl an Bytes im Sende-FIFO
+///					auf das Interrupt-Niveau gesunken ist. Der Sende-FIFO wird aus dem Sende-Ringpuffer
+///					aufgefllt. Ist der Ringpuffer leer, wird der Sende-FIFO-Interrupt ausgeschaltet
+///					und erst mit dem nchsten Aufruf von "UartWriteA()" wieder eingeschaltet.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxStreamISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_TX);
+		INTERRUPT_NEST_ENTRY(INTERRUPT_ID_UART_TX);
+
+		uint16_t tail = uartRingTxA.tail;
+
+		while (   (tail != uartRingTxA.head)
+					 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
+		{
+				SciaRegs.SCITXBUF.bit.TXDT = uartRingTxA.data[tail];
+				tail = (tail + 1) & UART_RING_INDEX_MASK;
+		}
+		// Platz erst nach dem Kopieren freigeben
+		uartRingTxA.tail = tail;
+		// Ringpuffer leer -> Sende-FIFO-Interrupt ausschalten
+		if (tail == uartRingTxA.head)
+		{
+				SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+		}
+
+		// Interrupts mit hherer Prioritt wieder sperren
+		INTERRUPT_NEST_EXIT(INTERRUPT_ID_UART_TX);
+		// Sende-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_TX);
+}
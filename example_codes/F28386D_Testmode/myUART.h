@@ -16,9 +16,28 @@
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V2.0
+///							nderung in Version 2.1: Streaming-Betrieb mit Ringpuffern. Nach Aufruf der
+///							Funktion "UartStartStreamA()" ist der Empfang dauerhaft eingeschaltet. Die ISRs
+///							fllen bzw. leeren je einen Ringpuffer fr Rx und Tx (ein Erzeuger, ein
+///							Verbraucher, keine Sperre ntig), sodass zwischen zwei Datenpaketen keine Bytes
+///							verloren gehen. Die Daten werden mit "UartWriteA()" in den Sende-Ringpuffer
+///							geschrieben und mit "UartReadA()" aus dem Empfangs-Ringpuffer gelesen.
 ///
-/// @date       24.03.2023
+///							nderung in Version 2.2: Die ISRs knnen von Interrupts mit hherer Prioritt
+///							(z.B. ADC) unterbrochen werden (myInterrupt.h)
+///
+///							nderung in Version 2.3: Der Baudraten-Teiler wird aus dem aktuellen Low-Speed
+///							Peripheral Clock berechnet und nach einer nderung des Systemtakts (DeviceSetSysclk())
+///							umgerechnet
+///
+///							nderung in Version 2.4: Beliebige Baudraten (gerundeter Teiler, erreichte Baudrate
+///							und Abweichung in "uartBaudActualA" bzw. "uartBaudErrorPpmA"), Baudraten ber
+///							921600 bis LSPCLK / 16 und automatische Erkennung der Baudrate ("UartAutoBaudStartA()",
+///							"UartAutoBaudPollA()")
+///
+/// @version    V2.4
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -30,6 +49,8 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
+#include "myInterrupt.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -40,6 +61,15 @@
 #define UART_SIZE_SOFTWARE_BUFFER_TX		        50
 // Gre der Hardware-FIFOs
 #define UART_SIZE_HARDWARE_FIFO									16
+// Gre der Ringpuffer fr den Streaming-Betrieb (muss eine Zweierpotenz sein)
+#define UART_SIZE_RING_BUFFER										256
+#define UART_RING_INDEX_MASK										(UART_SIZE_RING_BUFFER - 1)
+// Interrupt-Niveau des Empfangs-FIFOs im Streaming-Betrieb. Die ISR wird erst nach
+// mehreren Bytes aufgerufen, Bytes unterhalb des Niveaus holt "UartPollRxA()" ab
+#define UART_STREAM_RX_FIFO_LEVEL								12
+// Interrupt-Niveau des Sende-FIFOs im Streaming-Betrieb. Der FIFO wird nachgefllt,
+// bevor er leer ist, damit zwischen zwei Bytes keine Pause entsteht
+#define UART_STREAM_TX_FIFO_LEVEL								2
 // Zustnde der UART-Kommunikation (uartRxStatusFlag und uartTxStatusFlag)
 #define UART_STATUS_IDLE												0
 #define UART_STATUS_IN_PROGRESS									1
@@ -72,6 +102,18 @@
 #define UART_BAUD_115200												115200
 #define UART_BAUD_230400												230400
 #define UART_BAUD_460800												460800
+// Hohe Baudraten. Der Teiler wird gerundet (BRR = LSPCLK / (BAUD * 8) - 1), eine Abweichung bis
+// ca. 2 % ist zulssig. Bei LSPCLK = 50 MHz (200 MHz Systemtakt) erreicht 921600 nur 892857 Baud
+// (-3,1 %), die folgenden Baudraten teilt der LSPCLK exakt. Der FT2232H des XDS100 erzeugt sie mit
+// weniger als 1 % Abweichung. 1562500 ist auch bei 100 MHz Systemtakt (LSPCLK = 25 MHz) exakt
+#define UART_BAUD_921600												921600
+#define UART_BAUD_1250000												1250000
+#define UART_BAUD_1562500												1562500
+#define UART_BAUD_3125000												3125000
+// Hchste Baudrate beim aktuellen Systemtakt (BRR = 1, BRR = 0 ergibt ebenfalls LSPCLK / 16)
+#define UART_BAUD_MAX														(DEVICE_LSPCLK_HZ / 16U)
+// Teiler whrend der automatischen Erkennung der Baudrate (siehe "UartAutoBaudStartA()")
+#define UART_AUTO_BAUD_DIVIDER									1
 // Wortlnge
 #define UART_DATA_1_BIT													0
 #define UART_DATA_2_BIT													1
@@ -95,6 +137,20 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer mit einem Erzeuger und einem Verbraucher. Nur der Erzeuger schreibt
+// "head", nur der Verbraucher schreibt "tail". Da beide Indizes 16 Bit breit sind,
+// werden sie atomar geschrieben und es ist keine Interrupt-Sperre ntig
+typedef struct
+{
+		uint16_t data[UART_SIZE_RING_BUFFER];
+		volatile uint16_t head;
+		volatile uint16_t tail;
+} UartRingBuffer;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
@@ -108,6 +164,18 @@ extern uint16_t uartBufferTxA[UART_SIZE_SOFTWARE_BUFFER_TX];
 extern bool uartFlagCheckRxA;
 // Timeout-Zhler fr den Empfang eines Datenpakets
 extern int32_t uartRxTimeoutA;
+// Ringpuffer fr den Streaming-Betrieb (Rx: Erzeuger ISR, Tx: Verbraucher ISR)
+extern UartRingBuffer uartRingRxA;
+extern UartRingBuffer uartRingTxA;
+// Streaming-Betrieb aktiv
+extern bool uartStreamModeA;
+// Anzahl der Bytes, die wegen eines vollen Empfangs-Ringpuffers verworfen wurden
+extern uint32_t uartRingOverflowA;
+// Tatschlich eingestellte Baudrate und Abweichung von der gewnschten Baudrate in ppm
+extern uint32_t uartBaudActualA;
+extern int32_t uartBaudErrorPpmA;
+// Automatische Erkennung der Baudrate aktiv
+extern bool uartAutoBaudActiveA;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -119,6 +187,10 @@ extern void UartInitA(uint32_t baud,
 										  uint32_t numberOfDataBits,
 										  uint32_t numberOfStopBits,
 										  uint32_t parity);
+// Funktion startet die automatische Erkennung der Baudrate (Gegenstelle sendet 'A' oder 'a')
+extern bool UartAutoBaudStartA(void);
+// Funktion prft ohne zu blockieren, ob die Baudrate erkannt wurde
+extern bool UartAutoBaudPollA(void);
 // Funktion initialisiert den UART Empfangs-Softwarepuffer zu 0
 extern void UartInitBufferRxA(void);
 // Funktion initialisiert den UART Sende-Softwarepuffer zu 0
@@ -128,6 +200,8 @@ extern void UartInitBufferTxA(void);
 extern uint16_t UartGetStatusRxA(void);
 // Funktion gibt den aktuellen Status der Tx-UART-Kommunikation (senden) zurck
 extern uint16_t UartGetStatusTxA(void);
+// Funktion prft ohne zu blockieren, ob das letzte Byte vollstndig gesendet wurde
+extern bool UartPollTxA(void);
 // Funktion setzt das Status-Flag fr den Empfangsvorgang auf "idle",
 // falls die vorherige Kommunikation abgeschlossen ist
 extern bool UartSetStatusIdleRxA(void);
@@ -141,10 +215,30 @@ extern bool UartReceiveA(uint16_t numberOfBytesRx,
 // Funktion sendet ber UART die mit dem Parameter "numberOfBytesTxA"
 // angegebene Anzahl an Bytes aus dem Software-Puffer "uartBufferTxA[]"
 extern bool UartTransmitA(uint16_t numberOfBytesTx);
+// Funktion startet den Streaming-Betrieb (Empfang dauerhaft eingeschaltet, Ringpuffer)
+extern bool UartStartStreamA(void);
+// Funktion beendet den Streaming-Betrieb
+extern void UartStopStreamA(void);
+// Funktion schreibt bis zu "numberOfBytes" Bytes in den Sende-Ringpuffer
+extern uint16_t UartWriteA(const uint16_t *data, uint16_t numberOfBytes);
+// Funktion gibt die direkt im Sende-Ringpuffer geschriebenen Bytes fr die ISR frei
+extern void UartTxCommitA(uint16_t head);
+// Funktion liest bis zu "maxNumberOfBytes" Bytes aus dem Empfangs-Ringpuffer
+extern uint16_t UartReadA(uint16_t *data, uint16_t maxNumberOfBytes);
+// Funktion gibt die Anzahl der Bytes im Empfangs-Ringpuffer zurck
+extern uint16_t UartGetRxCountA(void);
+// Funktion kopiert im Streaming-Betrieb die Bytes unterhalb des Interrupt-Niveaus
+// aus dem Empfangs-FIFO in den Ringpuffer (zyklisch aus einer Timer-ISR aufrufen)
+extern void UartPollRxA(void);
+// Funktion gibt die Anzahl freier Pltze im Sende-Ringpuffer zurck
+extern uint16_t UartGetTxFreeA(void);
 // Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, wenn ein Byte empfangen wurde)
 __interrupt void UartRxISRA(void);
 // Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, nachdem ein Byte gesendet wurde)
 __interrupt void UartTxISRA(void);
+// Interrupt-Service-Routinen fr den Streaming-Betrieb (werden von "UartStartStreamA()" eingetragen)
+__interrupt void UartRxStreamISRA(void);
+__interrupt void UartTxStreamISRA(void);
 
 
 #endif
@@ -0,0 +1,237 @@
+//=================================================================================================
+/// @file       myWatchdog.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die berwachung des Schedulers mit dem
+///							Watchdog-Timer im Fenster-Betrieb und das Reset-Protokoll, siehe myWatchdog.h.
+///							Registerbeschreibung siehe Kapitel "Watchdog Timers" im Reference Manual
+///							TMS320F2838x, SPRUII0D, Rev. D, July 2022
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myWatchdog.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Reset-Protokoll im nicht initialisierten GSx-RAM
+DEVICE_CAPTURE_DATA(watchdogResetRecord)
+WatchdogResetRecord watchdogResetRecord;
+// Ursache des letzten Resets
+WatchdogResetRecord watchdogLastReset;
+// Anzahl der Bedienungen seit WatchdogStart()
+volatile uint32_t watchdogServices = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Lngste erlaubte Zeit ohne Aufruf einer Task in Bedienungen (10 ms) je Rate: Periode der
+// Rate aufgerundet plus eine Bedienung Reserve (10 kHz, 1 kHz: 20 ms, 100 Hz: 30 ms,
+// 10 Hz: 120 ms)
+static const uint16_t watchdogAliveTimeout[SCHEDULER_NUMBER_OF_RATES] = {2, 2, 3, 12};
+// Lebenszhler jeder Task bei der letzten Bedienung und Bedienungen seitdem ohne Aufruf
+static uint32_t watchdogAliveLast[SCHEDULER_MAX_TASKS];
+static uint16_t watchdogAliveAge[SCHEDULER_MAX_TASKS];
+// Grundtakte seit der letzten Bedienung
+static uint16_t watchdogTickCount = 0;
+// Wird von WatchdogStart() gesetzt
+static bool watchdogRunning = false;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: WatchdogCheckAlive ================================================================
+///
+/// @brief  Funktion vergleicht den Lebenszhler jeder Task mit dem Stand der letzten Bedienung.
+///					Gibt den Index der ersten Task zurck, deren Zhler lnger als
+///					"watchdogAliveTimeout" ihrer Rate stehen geblieben ist
+///
+/// @param  void
+///
+/// @return uint16_t task (WATCHDOG_NO_TASK: alle Tasks laufen)
+///
+//=================================================================================================
+#pragma CODE_SECTION(WatchdogCheckAlive, ".TI.ramfunc");
+static uint16_t WatchdogCheckAlive(void)
+{
+		for (uint16_t i = 0; i < schedulerNumberOfTasks; i++)
+		{
+				uint32_t runs = schedulerTaskStats[i].runs;
+
+				if (runs != watchdogAliveLast[i])
+				{
+						watchdogAliveLast[i] = runs;
+						watchdogAliveAge[i] = 0;
+				}
+				else if (++watchdogAliveAge[i] > watchdogAliveTimeout[schedulerTaskStats[i].rate])
+				{
+						return i;
+				}
+		}
+		return WATCHDOG_NO_TASK;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: WatchdogInit ======================================================================
+///
+/// @brief	Funktion liest die Quelle des letzten Resets aus dem Register RESC und lscht es. Nach
+///					einem Watchdog-Reset wird das Reset-Protokoll nach "watchdogLastReset" kopiert und
+///					die Anzahl der Watchdog-Resets erhht. Nach dem Einschalten (POR) oder mit einem
+///					ungltigen Protokoll wird es neu angelegt. Fr den laufenden Betrieb wird
+///					WATCHDOG_CAUSE_SERVICE eingetragen (gilt, falls die Bedienung ausbleibt). Muss
+///					direkt nach DeviceInit() aufgerufen werden
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void WatchdogInit(void)
+{
+		uint32_t resetSource = CpuSysRegs.RESC.all;
+
+		if ((resetSource & WATCHDOG_RESC_POR) || (watchdogResetRecord.key != WATCHDOG_RECORD_KEY))
+		{
+				watchdogResetRecord.key = WATCHDOG_RECORD_KEY;
+				watchdogResetRecord.resets = 0;
+				watchdogResetRecord.cause = WATCHDOG_CAUSE_NONE;
+				watchdogResetRecord.task = WATCHDOG_NO_TASK;
+				watchdogResetRecord.ticks = 0;
+		}
+		else if ((resetSource & WATCHDOG_RESC_WDRS) == 0)
+		{
+				// Anderer Reset (z.B. XRSn): das Protokoll beschreibt keinen Watchdog-Reset
+				watchdogResetRecord.cause = WATCHDOG_CAUSE_NONE;
+				watchdogResetRecord.task = WATCHDOG_NO_TASK;
+		}
+		else
+		{
+				watchdogResetRecord.resets++;
+		}
+		watchdogResetRecord.resetSource = resetSource;
+		watchdogLastReset = watchdogResetRecord;
+
+		// Protokoll fr den laufenden Betrieb
+		watchdogResetRecord.cause = WATCHDOG_CAUSE_SERVICE;
+		watchdogResetRecord.task = WATCHDOG_NO_TASK;
+		watchdogResetRecord.ticks = 0;
+
+		// Bits der Reset-Quellen lschen (1 schreiben), damit der nchste Reset eindeutig ist
+		EALLOW;
+		CpuSysRegs.RESCCLR.all = resetSource;
+		EDIS;
+}
+
+//=== Function: WatchdogStart =====================================================================
+///
+/// @brief	Funktion setzt die Lebenszhler zurck, lscht den Zhler des Watchdogs und schaltet
+///					ihn mit WATCHDOG_PRESCALE und dem Fenster WATCHDOG_WINDOW_MIN ein (Reset bei
+///					Ablauf, kein Interrupt). Die erste Bedienung erfolgt WATCHDOG_SERVICE_TICKS
+///					Grundtakte spter, daher muss SchedulerStart() direkt danach aufgerufen werden.
+///					Mit WATCHDOG_ENABLE = 0 wird nur die Prfung der Lebenszhler eingeschaltet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void WatchdogStart(void)
+{
+		for (uint16_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+		{
+				watchdogAliveLast[i] = schedulerTaskStats[i].runs;
+				watchdogAliveAge[i] = 0;
+		}
+		watchdogTickCount = 0;
+		watchdogServices = 0;
+
+#if WATCHDOG_ENABLE
+		EALLOW;
+		// Ohne Fenster den Zhler lschen, danach einschalten und das Fenster setzen
+		WdRegs.WDWCR.all = 0;
+		WdRegs.WDKEY.all = WATCHDOG_KEY_1;
+		WdRegs.WDKEY.all = WATCHDOG_KEY_2;
+		// WDDIS = 0, Prfbits 101, Vorteiler (PREDIVCLK = 0: WDCLK / 512)
+		WdRegs.WDCR.all = WATCHDOG_WDCR_CHECK | WATCHDOG_PRESCALE;
+		WdRegs.WDWCR.all = WATCHDOG_WINDOW_MIN;
+		EDIS;
+#endif
+
+		watchdogRunning = true;
+}
+
+//=== Function: WatchdogTick ======================================================================
+///
+/// @brief	Funktion wird in jedem Grundtakt von der ISR des CPU-Timer 0 aufgerufen. Alle
+///					WATCHDOG_SERVICE_TICKS Grundtakte werden die Lebenszhler geprft und der Watchdog
+///					bedient. Ist eine Task stehen geblieben, wird sofort ein Reset ausgelst
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(WatchdogTick, ".TI.ramfunc");
+void WatchdogTick(void)
+{
+		uint16_t task;
+
+		if (!watchdogRunning || (++watchdogTickCount < WATCHDOG_SERVICE_TICKS))
+				return;
+		watchdogTickCount = 0;
+
+		task = WatchdogCheckAlive();
+		if (task != WATCHDOG_NO_TASK)
+				WatchdogForceReset(WATCHDOG_CAUSE_ALIVE, task);
+
+		watchdogResetRecord.ticks = schedulerTicks;
+		watchdogServices++;
+#if WATCHDOG_ENABLE
+		// Die ISR hebt den Register-Schreibschutz der Dauerschleife auf
+		EALLOW;
+		WdRegs.WDKEY.all = WATCHDOG_KEY_1;
+		WdRegs.WDKEY.all = WATCHDOG_KEY_2;
+		EDIS;
+#endif
+}
+
+//=== Function: WatchdogForceReset ================================================================
+///
+/// @brief	Funktion trgt Ursache, Task und Grundtakt in das Reset-Protokoll ein und lst durch
+///					ungltige Prfbits im Register WDCR sofort einen Watchdog-Reset aus. Mit
+///					WATCHDOG_ENABLE = 0 hlt die CPU stattdessen an (ESTOP0, Debugger verbunden)
+///
+/// @param  uint16_t cause, uint16_t task
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(WatchdogForceReset, ".TI.ramfunc");
+void WatchdogForceReset(uint16_t cause, uint16_t task)
+{
+		watchdogResetRecord.cause = cause;
+		watchdogResetRecord.task = task;
+		watchdogResetRecord.ticks = schedulerTicks;
+
+		DINT;
+#if WATCHDOG_ENABLE
+		EALLOW;
+		WdRegs.WDCR.all = WATCHDOG_WDCR_INVALID;
+#endif
+		while (1)
+		{
+				__asm(" ESTOP0");
+		}
+}
@@ -0,0 +1,112 @@
+//=================================================================================================
+/// @file       myWatchdog.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die berwachung des Schedulers
+///							(myScheduler.h) mit dem Watchdog-Timer im Fenster-Betrieb. DeviceInitCPU1()
+///							schaltet den Watchdog aus, WatchdogStart() schaltet ihn wieder ein:
+///							- WDCLK = INTOSC1 (10 MHz) / 512 / 2 -> 102,4 s pro Zhlschritt, nach 256
+///							  Schritten (26,2 ms) ohne Bedienung lst der Watchdog einen Reset aus
+///							- Fenster: ein Schlssel (0x55, 0xAA) vor WATCHDOG_WINDOW_MIN Schritten
+///							  (6,55 ms) lst ebenfalls einen Reset aus
+///							Der Watchdog wird nicht in der Dauerschleife bedient, sondern alle
+///							WATCHDOG_SERVICE_TICKS Grundtakte (10 ms) von WatchdogTick() in der ISR des
+///							CPU-Timer 0. Vorher wird fr jede Task geprft, ob ihr Lebenszhler ("runs" in
+///							"schedulerTaskStats") seit der letzten Bedienung weitergezhlt hat. Bleibt der
+///							Zhler einer Task lnger als "watchdogAliveTimeout" ihrer Rate stehen (z.B.
+///							hngende Task oder blockierte Dauerschleife), wird die Task im Reset-Protokoll
+///							eingetragen und sofort ein Reset ausgelst. Bleibt die ISR selbst aus (gesperrte
+///							Interrupts, hngende ISR), luft der Watchdog nach sptestens 26,2 ms ab.
+///							Das Reset-Protokoll "watchdogResetRecord" liegt im nicht initialisierten GSx-RAM
+///							(DEVICE_CAPTURE_DATA()) und bersteht den Reset. WatchdogInit() wertet es
+///							zusammen mit dem Register RESC aus und legt das Ergebnis in "watchdogLastReset"
+///							ab (im Debugger anzeigen). Da der Watchdog bei angehaltener CPU weiterluft, muss
+///							WATCHDOG_ENABLE zum Debuggen mit Haltepunkten auf 0 gesetzt werden
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYWATCHDOG_H_
+#define MYWATCHDOG_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myScheduler.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Watchdog ein- (1) oder ausschalten (0, z.B. zum Debuggen mit Haltepunkten)
+#define WATCHDOG_ENABLE									1
+// Vorteiler des Zhlers (WDCR.WDPS, 2: WDCLK / 512 / 2)
+#define WATCHDOG_PRESCALE								2
+// Zhlerstand, ab dem der Watchdog bedient werden darf (WDWCR.MIN, 64 -> 6,55 ms)
+#define WATCHDOG_WINDOW_MIN							64
+// Grundtakte des Schedulers zwischen zwei Bedienungen (100 -> 10 ms, mitten im Fenster
+// 6,55 ms ... 26,2 ms)
+#define WATCHDOG_SERVICE_TICKS					100
+// Prfbits im Register WDCR (mssen bei jedem Schreiben 101 sein, sonst sofortiger Reset)
+#define WATCHDOG_WDCR_CHECK							0x0028
+#define WATCHDOG_WDCR_INVALID						0x0000
+// Schlssel fr die Bedienung
+#define WATCHDOG_KEY_1									0x0055
+#define WATCHDOG_KEY_2									0x00AA
+// Quellen des letzten Resets (Bits im Register RESC)
+#define WATCHDOG_RESC_POR								0x0001UL
+#define WATCHDOG_RESC_XRS								0x0002UL
+#define WATCHDOG_RESC_WDRS							0x0004UL
+#define WATCHDOG_RESC_NMIWDRS						0x0008UL
+// Kennung eines gltigen Reset-Protokolls
+#define WATCHDOG_RECORD_KEY							0xD06E
+// Ursachen eines Watchdog-Resets
+#define WATCHDOG_CAUSE_NONE							0				// kein Watchdog-Reset
+#define WATCHDOG_CAUSE_SERVICE					1				// Bedienung ausgeblieben (ISR des CPU-Timer 0)
+#define WATCHDOG_CAUSE_ALIVE						2				// Lebenszhler einer Task stehen geblieben
+// Task-Index, falls keine Task betroffen ist
+#define WATCHDOG_NO_TASK								0xFFFF
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Reset-Protokoll
+typedef struct
+{
+		uint16_t key;													// WATCHDOG_RECORD_KEY, wenn gltig
+		uint16_t resets;											// Watchdog-Resets seit dem Einschalten (POR)
+		uint16_t cause;												// WATCHDOG_CAUSE_...
+		uint16_t task;												// Index in "schedulerTaskStats" oder WATCHDOG_NO_TASK
+		uint32_t ticks;												// Grundtakte bei der letzten Bedienung bzw. beim Fehler
+		uint32_t resetSource;									// Register RESC nach dem Reset
+} WatchdogResetRecord;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Reset-Protokoll des laufenden Programms (bersteht den Reset)
+extern WatchdogResetRecord watchdogResetRecord;
+// Auswertung des Protokolls beim Start (Ursache des letzten Resets)
+extern WatchdogResetRecord watchdogLastReset;
+// Anzahl der Bedienungen seit WatchdogStart()
+extern volatile uint32_t watchdogServices;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion wertet das Reset-Protokoll und das Register RESC aus (direkt nach DeviceInit())
+extern void WatchdogInit(void);
+// Funktion schaltet den Watchdog im Fenster-Betrieb ein (direkt vor SchedulerStart())
+extern void WatchdogStart(void);
+// Funktion prft die Lebenszhler und bedient den Watchdog (ISR des CPU-Timer 0)
+extern void WatchdogTick(void);
+// Funktion trgt die Ursache ein und lst sofort einen Reset aus
+extern void WatchdogForceReset(uint16_t cause, uint16_t task);
+
+
+#endif
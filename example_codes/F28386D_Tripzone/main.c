@@ -36,6 +36,10 @@
 //-------------------------------------------------------------------------------------------------
 // Messwert vom ADC A an Pin A2
 uint16_t ADCINA2 = 0;
+// Zum Ausgeben des Fehlerprotokolls ber UART (im Debugger auf 1 setzen)
+uint16_t tripLogExport = 0;
+// Zum Aufheben einer Abschaltung nach Latch-off (im Debugger auf 1 setzen)
+uint16_t tripzoneReset = 0;
 
 
 //=== Function: main ==============================================================================
@@ -51,10 +55,20 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
 		// ADC initialisieren, um den Messwert und damit die Spannung an Pin A2
 		// im Debugger anzeigen zu knnen. Dient zur Kontrolle der Tripzone-Funktion
 		AdcAInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
+		// UART (SCI-A) im Streaming-Betrieb fr die Ausgabe des Fehlerprotokolls initialisieren
+		UartInitA(UART_BAUD_115200,
+							UART_DATA_8_BIT,
+							UART_STOP_1_BIT,
+							UART_PARITY_NONE);
+		UartStartStreamA();
+		TelemetryInit();
+		TripLogInit();
 		// Tripzone initialisieren
 		TripzoneInitCmpss1();
 
@@ -64,6 +78,14 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
+				// Fehlerprotokoll auf Wunsch ber UART ausgeben
+				if (tripLogExport == 1)
+				{
+						tripLogExport = 0;
+						TripLogExportStart();
+				}
+				TripLogExportService();
+
 				// Beispiel fr eine manuell getriggerte ADC-Messung:
 				// Dazu muss zuerst ADCSOC0CTL.TRIGSEL = 0 gesetzt werden
 				// ADC-Messung triggern
@@ -73,6 +95,16 @@ void main(void)
 				// Messwert auslesen
 				ADCINA2 = AdcaResultRegs.ADCRESULT0;
 
+#if TRIPZONE_PWM1_ACTION == TRIPZONE_ACTION_CBC
+				// Cycle-by-Cycle-Strombegrenzung: Wiederanlauf nach einer Abschaltung
+				// (die Flags werden in der ISR bzw. in TripzoneRestartService() gelscht)
+				TripzoneRestartService();
+				if (tripzoneReset == 1)
+				{
+						tripzoneReset = 0;
+						TripzoneResetProtection();
+				}
+#else
 
 				// Eingangssignal liegt oberhalb vom Grenzwert (DACHVALS.DACVAL)
 				if (EPwm1Regs.TZFLG.bit.DCAEVT1)
@@ -96,6 +128,7 @@ void main(void)
 						// Flag lschen
 						EPwm1Regs.TZCLR.bit.OST = 1;
 				}
+#endif
     }
 }
 
@@ -0,0 +1,138 @@
+//=================================================================================================
+/// @file       myTripLog.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein Fehlerprotokoll der Tripzone. Bei
+///							jedem Tripzone-Interrupt wird ein Eintrag mit den Trip-Flags, einem Zeitstempel,
+///							dem letzten Messwert des ADC A und dem Zustand des ePWM-Moduls in einen
+///							Ringpuffer fester Gre geschrieben und spter ber UART ausgegeben.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myTripLog.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer des Fehlerprotokolls und Anzahl aller Eintrge
+TripLogRecord tripLog[TRIPLOG_SIZE];
+volatile uint32_t tripLogCount = 0;
+// Nchster auszugebender Eintrag und Ende der laufenden Ausgabe
+static uint32_t tripLogExportNext = 0;
+static uint32_t tripLogExportEnd = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TripLogInit =======================================================================
+///
+/// @brief  Funktion lscht das Fehlerprotokoll und bricht eine laufende Ausgabe ab
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripLogInit(void)
+{
+		tripLogCount = 0;
+		tripLogExportNext = 0;
+		tripLogExportEnd = 0;
+}
+
+
+//=== Function: TripLogRecordEvent ================================================================
+///
+/// @brief  Funktion schreibt einen Eintrag mit den Trip-Flags und dem Zustand des ePWM-Moduls
+///					in den Ringpuffer. Die Funktion liegt im RAM und kopiert nur Register (keine
+///					Verzweigung, kein Funktionsaufruf), damit die Laufzeit der Tripzone-ISR nur um
+///					wenige Dutzend Takte steigt. Nur in der Tripzone-ISR aufrufen (nicht reentrant)
+///
+/// @param  volatile struct EPWM_REGS *pwm
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(TripLogRecordEvent, ".TI.ramfunc");
+void TripLogRecordEvent(volatile struct EPWM_REGS *pwm)
+{
+		uint32_t count = tripLogCount;
+		TripLogRecord *record = &tripLog[(uint16_t)count & (TRIPLOG_SIZE - 1)];
+
+		record->timestamp = PROFILE_TIMESTAMP();
+		record->number = (uint16_t)count;
+		record->tzflg = pwm->TZFLG.all;
+		record->tzostflg = pwm->TZOSTFLG.all;
+		record->tzcbcflg = pwm->TZCBCFLG.all;
+		record->adc = AdcaResultRegs.ADCRESULT0;
+		record->tbctr = pwm->TBCTR;
+		record->tbsts = pwm->TBSTS.all;
+		record->cmpa = pwm->CMPA.bit.CMPA;
+		// Eintrag erst nach dem Schreiben freigeben
+		tripLogCount = count + 1;
+}
+
+
+//=== Function: TripLogExportStart ================================================================
+///
+/// @brief  Funktion startet die Ausgabe aller gespeicherten Eintrge (ltester zuerst). Eintrge,
+///					die whrend der Ausgabe hinzukommen, werden bei der nchsten Ausgabe gesendet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripLogExportStart(void)
+{
+		uint32_t count = tripLogCount;
+
+		tripLogExportEnd = count;
+		tripLogExportNext = (count > TRIPLOG_SIZE) ? (count - TRIPLOG_SIZE) : 0;
+}
+
+
+//=== Function: TripLogExportService ==============================================================
+///
+/// @brief  Funktion sendet den nchsten Eintrag der laufenden Ausgabe als Telemetrie-Rahmen.
+///					Ist der Sende-Ringpuffer voll, wird es beim nchsten Aufruf erneut versucht.
+///					Eintrge, die inzwischen von der ISR berschrieben wurden, werden bersprungen.
+///					Die Interrupts werden nur fr das Kopieren des Eintrags kurz gesperrt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripLogExportService(void)
+{
+		TripLogRecord record;
+
+		if (tripLogExportNext == tripLogExportEnd)
+				return;
+
+		// berschriebene Eintrge berspringen und eine Kopie anlegen, damit ein
+		// Tripzone-Interrupt den Eintrag nicht whrend des Sendens verndert
+		DINT;
+		if (tripLogCount - tripLogExportNext > TRIPLOG_SIZE)
+				tripLogExportNext = tripLogCount - TRIPLOG_SIZE;
+		record = tripLog[(uint16_t)tripLogExportNext & (TRIPLOG_SIZE - 1)];
+		EINT;
+
+		if (tripLogExportNext >= tripLogExportEnd)
+		{
+				tripLogExportNext = tripLogExportEnd;
+				return;
+		}
+
+		if (TelemetrySendWords(TELEMETRY_TYPE_TRIP_RECORD, (const uint16_t *)&record, TRIPLOG_RECORD_WORDS))
+				tripLogExportNext++;
+}
@@ -0,0 +1,83 @@
+//=================================================================================================
+/// @file       myTripLog.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein Fehlerprotokoll der Tripzone. Bei
+///							jedem Tripzone-Interrupt wird ein Eintrag mit den Trip-Flags (TZFLG, TZOSTFLG,
+///							TZCBCFLG), einem Zeitstempel (CPU-Timer 2, siehe myProfile.h), dem letzten
+///							Messwert des ADC A und dem Zustand des ePWM-Moduls (TBCTR, TBSTS, CMPA) in einen
+///							Ringpuffer fester Gre geschrieben. Die ISR kopiert dabei nur Register, die
+///							Auswertung erfolgt spter im Hauptprogramm. Ist der Ringpuffer voll, wird der
+///							lteste Eintrag berschrieben.
+///
+///							Die Eintrge werden mit "TripLogExportStart()" und "TripLogExportService()" als
+///							Telemetrie-Rahmen (TELEMETRY_TYPE_TRIP_RECORD, ein Eintrag pro Rahmen) ber UART
+///							ausgegeben.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYTRIPLOG_H_
+#define MYTRIPLOG_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl an Eintrgen im Ringpuffer (Zweierpotenz)
+#define TRIPLOG_SIZE														32
+// Gre eines Eintrags in 16 Bit-Worten (Nutzdaten eines Telemetrie-Rahmens)
+#define TRIPLOG_RECORD_WORDS										(sizeof(TripLogRecord))
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Eintrag des Fehlerprotokolls (10 Worte, ohne Fllworte)
+typedef struct
+{
+		uint32_t timestamp;																		// CPU-Timer 2 in Takten
+		uint16_t number;																			// laufende Nummer (untere 16 Bit)
+		uint16_t tzflg;																				// TZFLG (auslsende Events)
+		uint16_t tzostflg;																		// TZOSTFLG (One-Shot-Quellen)
+		uint16_t tzcbcflg;																		// TZCBCFLG (Cycle-by-Cycle-Quellen)
+		uint16_t adc;																					// ADCRESULT0 vom ADC A
+		uint16_t tbctr;																				// Zhlerstand
+		uint16_t tbsts;																				// Zhlrichtung etc.
+		uint16_t cmpa;																				// Tastverhltnis
+} TripLogRecord;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer des Fehlerprotokolls
+extern TripLogRecord tripLog[TRIPLOG_SIZE];
+// Anzahl aller aufgezeichneten Eintrge seit "TripLogInit()" (Schreibindex)
+extern volatile uint32_t tripLogCount;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion lscht das Fehlerprotokoll
+extern void TripLogInit(void);
+// Funktion schreibt einen Eintrag mit dem Zustand des ePWM-Moduls (Aufruf in der Tripzone-ISR,
+// vor dem Lschen der Flags)
+extern void TripLogRecordEvent(volatile struct EPWM_REGS *pwm);
+// Funktion startet die Ausgabe aller gespeicherten Eintrge ber UART
+extern void TripLogExportStart(void);
+// Funktion sendet den nchsten Eintrag, sobald im Sende-Ringpuffer Platz ist
+// (im Hauptprogramm zyklisch aufrufen)
+extern void TripLogExportService(void);
+
+
+#endif
@@ -22,7 +22,25 @@
 ///							- ADCINA2/CMPIN1P an Mittelabgriff Poti (0 ... 3,3 V)
 ///							- GPIO 0 und 1 an Oszilloskop
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Fr mehrere Leistungsstufen werden die Komparator-
+///							subsysteme (CMPSS1 ... 8) und die ePWM-Module (ePWM1 ... 16) ber zwei Tabellen
+///							konfiguriert (siehe TripzoneInitProtection()). Jeder Tabelleneintrag beschreibt
+///							die Schwellwerte, den digitalen Filter und die ePWM X-Bar Ausgnge eines
+///							Komparatorsubsystems bzw. die DC-Events und die Tripzone-Aktion eines ePWM-Moduls.
+///
+///							nderung in Version 1.3: Bei einem One-Shot-Trip des ePWM1-Moduls wird ein
+///							Interrupt ausgelst, die ISR schreibt einen Eintrag in das Fehlerprotokoll
+///							(TRIPZONE_FAULT_LOG, siehe myTripLog.h).
+///
+///							nderung in Version 1.4: Cycle-by-Cycle-Strombegrenzung fr ePWM1
+///							(TRIPZONE_PWM1_ACTION). Ein berstrom schaltet die Pins nur bis zum Ende der
+///							PWM-Periode ab. Treten innerhalb eines Zeitfensters zu viele CBC-Events auf, wird
+///							ePWM1 per One-Shot-Trip abgeschaltet und nach einer Wartezeit (Back-off, wird
+///							bei jedem Versuch verdoppelt) automatisch wieder gestartet. Nach der maximalen
+///							Anzahl an Versuchen bleibt ePWM1 abgeschaltet, bis "TripzoneResetProtection()"
+///							aufgerufen wird (Latch-off).
+///
+/// @version    V1.4
 ///
 /// @date       13.02.2023
 ///
@@ -34,210 +52,290 @@
 #include "myTripzone.h"
 
 
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Register eines Ausgangs der ePWM X-Bar (Quellzuweisung MUX0 ... 15 und Freigabe)
+typedef struct
+{
+		volatile uint32_t *config;
+		volatile uint32_t *enable;
+} TripzoneXbarOutput;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Register der Komparatorsubsysteme und ePWM-Module (Index = Modulnummer - 1)
+static volatile struct CMPSS_REGS * const tripzoneCmpssRegs[TRIPZONE_NUMBER_OF_CMPSS] =
+{
+		&Cmpss1Regs, &Cmpss2Regs, &Cmpss3Regs, &Cmpss4Regs,
+		&Cmpss5Regs, &Cmpss6Regs, &Cmpss7Regs, &Cmpss8Regs
+};
+static volatile struct EPWM_REGS * const tripzonePwmRegs[TRIPZONE_NUMBER_OF_PWMS] =
+{
+		&EPwm1Regs,  &EPwm2Regs,  &EPwm3Regs,  &EPwm4Regs,
+		&EPwm5Regs,  &EPwm6Regs,  &EPwm7Regs,  &EPwm8Regs,
+		&EPwm9Regs,  &EPwm10Regs, &EPwm11Regs, &EPwm12Regs,
+		&EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
+// Ausgnge der ePWM X-Bar in der Reihenfolge der Bits im Register TRIPOUTINV
+// (TRIP4, 5, 7, 8, 9, 10, 11, 12)
+static const TripzoneXbarOutput tripzoneXbarOutputs[8] =
+{
+		{&EPwmXbarRegs.TRIP4MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP4MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP5MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP5MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP7MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP7MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP8MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP8MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP9MUX0TO15CFG.all,  &EPwmXbarRegs.TRIP9MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP10MUX0TO15CFG.all, &EPwmXbarRegs.TRIP10MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP11MUX0TO15CFG.all, &EPwmXbarRegs.TRIP11MUXENABLE.all},
+		{&EPwmXbarRegs.TRIP12MUX0TO15CFG.all, &EPwmXbarRegs.TRIP12MUXENABLE.all}
+};
+// Konfiguration des Beispiels: Komparatorsubsystem 1 (Pin A2) berwacht das Analogsignal
+// mit den Schwellwerten 3000 (High) und 1000 (Low), die Ausgnge liegen ungefiltert auf
+// TRIP4 und TRIP5 und lsen im ePWM1-Modul einen One-Shot-Trip aus (beide Pins Low)
+static const TripzoneCmpssConfig tripzoneCmpss1Config =
+{
+		1, 0, 3000, 1000, CMPSS_HYSTERESIS_NONE, CMPSS_CTRIP_ASYNC, 0, 1, 1,
+		TRIPZONE_XBAR_TRIP4, TRIPZONE_XBAR_TRIP5
+};
+static const TripzonePwmConfig tripzonePwm1Config =
+{
+		1, PWM_DC_TRIP_TRIPIN4, PWM_DC_TRIP_TRIPIN5, PWM_DC_DCXH_HIGH, PWM_DC_DCXH_LOW,
+		PWM_DC_RAW_EVENT, TRIPZONE_PWM1_ACTION, PWM_TZ_FORCE_LO, PWM_TZ_FORCE_LO
+};
+// Zustand der Wiederanlauf-Strategie und Zhler
+volatile uint16_t tripzoneState = TRIPZONE_STATE_RUNNING;
+uint16_t tripzoneRetries = 0;
+volatile uint32_t tripzoneCbcEvents = 0;
+volatile uint32_t tripzoneShutdowns = 0;
+// Wiederanlauf-Strategie: mehr als 20 CBC-Events in 10 ms (100 Perioden bei 10 kHz) fhren
+// zur Abschaltung, 3 Versuche mit 10 ms, 20 ms und 40 ms Wartezeit, Zurcksetzen der
+// Versuche nach 2 s ohne Abschaltung
+static TripzoneRestartPolicy tripzoneRestartPolicy =
+{
+		20, 10 * TRIPZONE_CYCLES_PER_MS, 3, 10 * TRIPZONE_CYCLES_PER_MS,
+		1000 * TRIPZONE_CYCLES_PER_MS, 2000 * TRIPZONE_CYCLES_PER_MS
+};
+// Aktuelle Wartezeit, Zeitpunkt der Abschaltung bzw. des letzten Wiederanlaufs
+static uint32_t tripzoneBackoff = 10 * TRIPZONE_CYCLES_PER_MS;
+static volatile uint32_t tripzoneTripTime = 0;
+static uint32_t tripzoneRestartTime = 0;
+// Beginn und Anzahl der CBC-Events des aktuellen Zeitfensters
+static uint32_t tripzoneCbcWindowStart = 0;
+static uint16_t tripzoneCbcWindowCount = 0;
+
+
 
 
 //-------------------------------------------------------------------------------------------------
-// Global functions
+// Local functions
 //-------------------------------------------------------------------------------------------------
-//=== Function: TripzoneInitCmpss1 ================================================================
+//=== Function: TripzoneXbarIndex =================================================================
 ///
-/// @brief  Funktion initialisiert die beiden High- und Low-Komparatoren des Analog-Eingangs A2
-///					und die zugehrigen DACs (Analogsignal jeweils am +Eingang, DACs jeweils am -Eingang
-///					der Komparatoren, DAC mt VDDA als Referenz, Komparatorausgnge auf X-Bar legen), die
-///					ePWM X-Bar und das ePWM1-Modul. Wenn die analoge Spannung an Pin A2 unterhalb von
-///					(1000/4095) * 3,3 V (DACLVALS) oder oberhalb von (3000/4095) * 3,3 V (DACHVALS)
-///					liegt, werden beide PWM-Pins (ePWM1A und ePWM1B) auf Low-Pegel gesetzt. Anderfalls
-///					liegt an den Pins ein PWM-Signal mit 50 % Tastverhltnis und 10 kHz Freuqenz an
+/// @brief  Funktion gibt den Index eines Ausgangs der ePWM X-Bar in "tripzoneXbarOutputs"
+///					(= Bitposition im Register TRIPOUTINV) zurck
 ///
-/// @param  void
+/// @param  uint16_t trip (TRIPZONE_XBAR_TRIP4 ... TRIPZONE_XBAR_TRIP12)
+///
+/// @return uint16_t index, 0xFFFF bei ungltigem Ausgang
+///
+//=================================================================================================
+static uint16_t TripzoneXbarIndex(uint16_t trip)
+{
+		if ((trip == TRIPZONE_XBAR_TRIP4) || (trip == TRIPZONE_XBAR_TRIP5))
+				return trip - TRIPZONE_XBAR_TRIP4;
+		if ((trip >= TRIPZONE_XBAR_TRIP7) && (trip <= TRIPZONE_XBAR_TRIP12))
+				return trip - TRIPZONE_XBAR_TRIP7 + 2;
+		return 0xFFFF;
+}
+
+
+//=== Function: TripzoneCmpssConfigValid ==========================================================
+///
+/// @brief  Funktion prft einen Tabelleneintrag eines Komparatorsubsystems
+///
+/// @param  const TripzoneCmpssConfig *config
+///
+/// @return bool valid
+///
+//=================================================================================================
+static bool TripzoneCmpssConfigValid(const TripzoneCmpssConfig *config)
+{
+		if ((config->cmpss < 1) || (config->cmpss > TRIPZONE_NUMBER_OF_CMPSS))
+				return false;
+		if ((config->inputMux > 7) || (config->dacHigh > 4095) || (config->dacLow > 4095))
+				return false;
+		if ((config->hysteresis > CMPSS_HYSTERESIS_4X) || (config->ctripSelect > CMPSS_CTRIP_LATCH))
+				return false;
+		// Mehrheitsentscheidung des Filters: mehr als die Hlfte der Abtastwerte
+		// im Fenster mssen den neuen Pegel haben
+		if ((config->filterWindow < 1) || (config->filterWindow > CMPSS_FILTER_MAX_WINDOW))
+				return false;
+		if ((config->filterThreshold <= config->filterWindow / 2)
+				|| (config->filterThreshold > config->filterWindow))
+				return false;
+		if ((config->tripHigh != TRIPZONE_XBAR_NONE) && (TripzoneXbarIndex(config->tripHigh) == 0xFFFF))
+				return false;
+		if ((config->tripLow != TRIPZONE_XBAR_NONE) && (TripzoneXbarIndex(config->tripLow) == 0xFFFF))
+				return false;
+		return true;
+}
+
+
+//=== Function: TripzonePwmConfigValid ============================================================
+///
+/// @brief  Funktion prft einen Tabelleneintrag eines ePWM-Moduls
+///
+/// @param  const TripzonePwmConfig *config
+///
+/// @return bool valid
+///
+//=================================================================================================
+static bool TripzonePwmConfigValid(const TripzonePwmConfig *config)
+{
+		if ((config->pwm < 1) || (config->pwm > TRIPZONE_NUMBER_OF_PWMS))
+				return false;
+		if ((config->dcaSource > PWM_DC_TRIP_COMBINATION) || (config->dcbSource > PWM_DC_TRIP_COMBINATION))
+				return false;
+		if ((config->dcaCondition > PWM_DC_DCXL_HIGH_DCXH_LOW)
+				|| (config->dcbCondition > PWM_DC_DCXL_HIGH_DCXH_LOW))
+				return false;
+		if ((config->eventFilter > PWM_DC_FILTERED_EVENT) || (config->action > TRIPZONE_ACTION_CBC))
+				return false;
+		if ((config->pinStateA > PWM_TZ_NO_ACTION) || (config->pinStateB > PWM_TZ_NO_ACTION))
+				return false;
+		return true;
+}
+
+
+//=== Function: TripzoneInitCmpss =================================================================
+///
+/// @brief  Funktion initialisiert ein Komparatorsubsystem (DACs, Komparatoren, digitale
+///					Filter) und legt die Komparatorausgnge auf die ePWM X-Bar. Die Signale der
+///					CMPSSn-Komparatoren liegen auf MUX(2n-2) (CTRIPH bzw. CTRIPH_OR_CTRIPL) und
+///					MUX(2n-1) (CTRIPL) (siehe S. 2142 Reference Manual TMS320F2838x, SPRUII0D,
+///					Rev. D, July 2022). Der Register-Schreibschutz muss aufgehoben sein
+///
+/// @param  const TripzoneCmpssConfig *config
 ///
 /// @return void
 ///
 //=================================================================================================
-void TripzoneInitCmpss1(void)
+static void TripzoneInitCmpss(const TripzoneCmpssConfig *config)
 {
-		// Register-Schreibschutz aufheben
-		EALLOW;
+		volatile struct CMPSS_REGS *cmpss = tripzoneCmpssRegs[config->cmpss - 1];
+		uint16_t muxHigh = 2 * (config->cmpss - 1);
+		uint16_t muxLow = muxHigh + 1;
+		// Bitposition im Register CMPxPMXSEL (3 Bit pro Modul, Bit 15 ist reserviert)
+		uint16_t muxShift = 3 * (config->cmpss - 1) + ((config->cmpss > 5) ? 1 : 0);
+		const TripzoneXbarOutput *output;
+		uint16_t index;
 
-		// Takt fr das CMPSS1-Modul einschalten und 5 Takte
-    // warten, bis der Takt zum Modul durchgestellt ist
-    // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-		CpuSysRegs.PCLKCR14.bit.CMPSS1 = 1;
+		// Takt fr das Modul einschalten und 5 Takte warten, bis der Takt
+		// zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR14.all |= 1UL << (config->cmpss - 1);
 		__asm(" RPT #4 || NOP");
-		// berblick Komparator-Subsystem siehe S. 2505 Reference Manual TMS320F2838x,
-		// SPRUII0D, Rev. D, July 2022
-		// Komparatorsystem 1 einschalten
-		// 0: Komparator ausgeschaltet
-		// 1: Komparator eingeschaltet
-		Cmpss1Regs.COMPCTL.bit.COMPDACE = 1;
-		// VDDA als Referenzspannung fr die DACs setzen
-		// 0: VDDA als Referenzspannung (3,3 V Analog Spannungsversorgung)
-		// 1: VDAC als Referenzspannung (ADCINB0)
-		Cmpss1Regs.COMPDACCTL.bit.SELREF = 0;
-		// Wert des DAC aus dem Register DACHVALS bernehmen.
-		// Nur fr High-Komparator DAC, Low-Komparator DAC wird immer ber
-		// DACHVALS gespeist (siehe S. 2745 Reference Manual TMS320F2838x,
+
+		// Analog-Pin auf den nichtinvertierenden Eingang beider Komparatoren legen
+		AnalogSubsysRegs.CMPHPMXSEL.all = (AnalogSubsysRegs.CMPHPMXSEL.all & ~(7UL << muxShift))
+																			| ((uint32_t)config->inputMux << muxShift);
+		AnalogSubsysRegs.CMPLPMXSEL.all = (AnalogSubsysRegs.CMPLPMXSEL.all & ~(7UL << muxShift))
+																			| ((uint32_t)config->inputMux << muxShift);
+
+		// Komparatorsystem einschalten, VDDA als Referenzspannung, DAC-Werte aus
+		// DACxVALS bei jedem SYSCLK bernehmen (siehe S. 2745 Reference Manual TMS320F2838x,
 		// SPRUII0D, Rev. D, July 2022)
-		// 0: DAC-Wert wird gesetzt durch Register DACHVALS
-		// 1: DAC-Wert wird gesetzt vom Rampengenerator
-		Cmpss1Regs.COMPDACCTL.bit.DACSOURCE = 0;
-		// Wert aus dem Shadow-Register DACHVALS bei jedem SYSCLK bernehmen
-		// 0: Wert bei jedem SYSCLK bernehmen
-		// 1: Wert bei EPWMSYNCPER bernehmen
-		Cmpss1Regs.COMPDACCTL.bit.SWLOADSEL = 0;
-
-		// High-Komparator konfigurieren:
-		// DAC an den invertierenden Eingang des Komparators anlegen
-		// 0: DAC ist an invertierenden Eingang
-		// 1: Externer Pin ist an invertierenden Eingang
-		Cmpss1Regs.COMPCTL.bit.COMPHSOURCE = 0;
-		// Wert DAC setzen (12 Bit Shadow-Register).
-		// Wert wird abhngig vom Bit COMPDACCTL.SWLOADSEL bernommen
-		Cmpss1Regs.DACHVALS.bit.DACVAL = 3000;
-		// Ausgang des Komparators nicht invertieren
-		// 0: Ausgang nicht invertieren
-		// 1: Ausgang invertieren
-		Cmpss1Regs.COMPCTL.bit.COMPHINV = 0;
-		// Ausgang CTRIPx   : ePWM X-Bar
-		// Ausgang CTRIPOUTx: Output X-Bar
-		// Ausgangssignal des Komparators direkt auf die ePWM X-Bar
-		// legen (siehe S. 2745 Reference Manual TMS320F2838x, SPRUII0D,
-		// Rev. D, July 2022)
-		// 0: Komparator-Ausgangssignal asynchron zu SYSCLK (ohne
-		//    zeitliche Verzgerung) zu der ePWM X-Bar fhren
-		// 1: Komparator-Ausgangssignal synchron zu SYSCLK zu
-		//    der ePWM X-Bar fhren
-		// 2: Gefiltertes Komparator-Ausgangssignal zu der
-		//    ePWM X-Bar fhren
-		// 3: Gefiltertes Komparator-Ausgangssignal ber ein
-		//    Flip-Flop zu der ePWM X-Bar fhren
-		Cmpss1Regs.COMPCTL.bit.CTRIPHSEL = 0;
-
-		// Low-Komparator konfigurieren:
-		// DAC an den invertierenden Eingang des Komparators anlegen
-		Cmpss1Regs.COMPCTL.bit.COMPLSOURCE = 0;
-		// Wert DAC setzen (12 Bit)
-		Cmpss1Regs.DACLVALS.bit.DACVAL = 1000;
-		// Ausgang des Komparators nicht invertieren
-		Cmpss1Regs.COMPCTL.bit.COMPLINV = 0;
-		// Ausgangssignal des Komparators direkt zu der ePWM X-Bar fhren
-		Cmpss1Regs.COMPCTL.bit.CTRIPLSEL = 0;
-
-		// ePWMX-Bar konfigurieren:
+		cmpss->COMPCTL.bit.COMPDACE = 1;
+		cmpss->COMPDACCTL.bit.SELREF = 0;
+		cmpss->COMPDACCTL.bit.DACSOURCE = 0;
+		cmpss->COMPDACCTL.bit.SWLOADSEL = 0;
+		cmpss->COMPHYSCTL.bit.COMPHYS = config->hysteresis;
+
+		// High- und Low-Komparator: DAC am invertierenden Eingang, Ausgang nicht invertieren
+		cmpss->COMPCTL.bit.COMPHSOURCE = 0;
+		cmpss->COMPCTL.bit.COMPHINV = 0;
+		cmpss->DACHVALS.bit.DACVAL = config->dacHigh;
+		cmpss->COMPCTL.bit.COMPLSOURCE = 0;
+		cmpss->COMPCTL.bit.COMPLINV = 0;
+		cmpss->DACLVALS.bit.DACVAL = config->dacLow;
+
+		// Digitale Filter: Abtastung mit SYSCLK / (CLKPRESCALE + 1), Ausgang wechselt, wenn
+		// mindestens THRESH + 1 der letzten SAMPWIN + 1 Abtastwerte den neuen Pegel haben.
+		// Wirkt nur fr CMPSS_CTRIP_FILTER und CMPSS_CTRIP_LATCH
+		cmpss->CTRIPHFILCLKCTL.bit.CLKPRESCALE = config->filterPrescale;
+		cmpss->CTRIPHFILCTL.bit.SAMPWIN = config->filterWindow - 1;
+		cmpss->CTRIPHFILCTL.bit.THRESH = config->filterThreshold - 1;
+		cmpss->CTRIPLFILCLKCTL.bit.CLKPRESCALE = config->filterPrescale;
+		cmpss->CTRIPLFILCTL.bit.SAMPWIN = config->filterWindow - 1;
+		cmpss->CTRIPLFILCTL.bit.THRESH = config->filterThreshold - 1;
+		// Filter mit dem aktuellen Komparatorausgang initialisieren
+		cmpss->CTRIPHFILCTL.bit.FILINIT = 1;
+		cmpss->CTRIPLFILCTL.bit.FILINIT = 1;
+
 		// Die Signale der Komparatorsubsysteme in die ePWM X-Bar fallen unter
 		// "Other Sources" (siehe S. 2142 Reference Manual TMS320F2838x, SPRUII0D,
 		// Rev. D, July 2022). Quellen fr die Output und ePWM X-Bar sind Trip 4,
 		// 5, 7, 8, 9, 10, 11, 12 (Trip 1, 2, 3, 6 gehen direkt in die ePWM-Module).
-    // Die ePWM X-Bar hat 8 Ausgnge, die jeweils bis zu 32 Signale fhren knnen.
+		// Die ePWM X-Bar hat 8 Ausgnge, die jeweils bis zu 32 Signale fhren knnen.
 		// Jeder der 32 Multiplexer (MUX0 ... MUX31) kann aus bis zu 4 Signalen whlen.
 		// Je nach gewnschtem Signal muss der entsprechende Multiplexer ausgewhlt
 		// werden. Anschlieend muss das Ausgangssignal des Multiplexers noch durchge-
 		// schleift werden. Optional kann das aus den 32 Signalquellen veroderte Gesamt-
 		// signal noch invertiert werden (siehe S. 2144 Reference Manual TMS320F2838x,
 		// SPRUII0D, Rev. D, July 2022).
-		// Ausgangssignal vom CMPSS1 High-Komparator auf TRIP4
-		// legen (nach der Tabelle geht das nur auf MUX0)
-		EPwmXbarRegs.TRIP4MUX0TO15CFG.bit.MUX0 = 0;
-		// Jedes Eingangssignal muss neben einer Quellzuweisung
-		// zustzlich freigeschaltet werden
-		// Noch ggf. aktive Signalquellen sperren
-		EPwmXbarRegs.TRIP4MUXENABLE.all = 0;
-		// Eingangssignal fr MUX0 freigeben
-		// 0: Signalquelle gesperrt
-		// 1: Signalquelle freigegeben
-		EPwmXbarRegs.TRIP4MUXENABLE.bit.MUX0 = 1;
-		// Den Ausgang der ePWM X-Bar (= TRIP-Eingang
-		// der ePWM-Module) nicht invertieren
-		// 0: Signal nicht invertiert (active-high)
-		// 1: Signal invertiert (active-low)
-		EPwmXbarRegs.TRIPOUTINV.bit.TRIP4 = 0;
-		// Ausgangssignal vom CMPSS1 Low-Komparator auf TRIP5
-		// legen (nach der Tabelle geht das nur auf MUX1)
-		EPwmXbarRegs.TRIP5MUX0TO15CFG.bit.MUX1 = 0;
-		// Noch ggf. aktive Signalquellen sperren
-		EPwmXbarRegs.TRIP5MUXENABLE.all = 0;
-		// Eingangssignal fr MUX1 freigeben
-		EPwmXbarRegs.TRIP5MUXENABLE.bit.MUX1 = 1;
-		// Ausgang der ePWM X-Bar nicht invertieren
-		EPwmXbarRegs.TRIPOUTINV.bit.TRIP5 = 0;
-
-		// PWM-Modul konfigurieren:
-		// Takt fr das ePWM1-Modul einschalten und 5 Takte
-		// warten, bis der Takt zum Modul durchgestellt ist
-		// (siehe S. 169 Reference Manual TMS320F2838x,SPRUII0D, Rev. D, July 2022)
-		CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+		// Ausgangssignale zur ePWM X-Bar
+		cmpss->COMPCTL.bit.CTRIPHSEL = config->ctripSelect;
+		cmpss->COMPCTL.bit.CTRIPLSEL = config->ctripSelect;
+
+		if (config->tripHigh != TRIPZONE_XBAR_NONE)
+		{
+				index = TripzoneXbarIndex(config->tripHigh);
+				output = &tripzoneXbarOutputs[index];
+				// Liegen beide Komparatoren auf dem gleichen Ausgang, das veroderte
+				// Signal CTRIPH_OR_CTRIPL verwenden (Eingang 1 von MUX(2n-2))
+				*output->config = (*output->config & ~(3UL << (2 * muxHigh)))
+													| ((config->tripHigh == config->tripLow ? 1UL : 0UL) << (2 * muxHigh));
+				*output->enable |= 1UL << muxHigh;
+				EPwmXbarRegs.TRIPOUTINV.all &= ~(1UL << index);
+		}
+		if ((config->tripLow != TRIPZONE_XBAR_NONE) && (config->tripLow != config->tripHigh))
+		{
+				index = TripzoneXbarIndex(config->tripLow);
+				output = &tripzoneXbarOutputs[index];
+				*output->config &= ~(3UL << (2 * muxLow));
+				*output->enable |= 1UL << muxLow;
+				EPwmXbarRegs.TRIPOUTINV.all &= ~(1UL << index);
+		}
+}
+
+
+//=== Function: TripzoneInitPwm ===================================================================
+///
+/// @brief  Funktion initialisiert das Digital-Compare- und Tripzone-Submodul eines ePWM-
+///					Moduls. DCAH und DCBH werden mit den Eingngen dcaSource und dcbSource verbunden,
+///					die Events wirken je nach "action" direkt (DCxEVT1), als One-Shot-Trip (DCxEVT1)
+///					oder als Cycle-by-Cycle-Trip (DCxEVT2) auf die PWM-Pins. Die DC-Events werden
+///					asynchron und ohne Flip-Flop weitergeleitet (keine Zeitverzgerung). Der
+///					Register-Schreibschutz muss aufgehoben sein
+///
+/// @param  const TripzonePwmConfig *config
+///
+/// @return void
+///
+//=================================================================================================
+static void TripzoneInitPwm(const TripzonePwmConfig *config)
+{
+		volatile struct EPWM_REGS *pwm = tripzonePwmRegs[config->pwm - 1];
+
+		// Takt fr das Modul einschalten und 5 Takte warten, bis der Takt
+		// zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR2.all |= 1UL << (config->pwm - 1);
 		__asm(" RPT #4 || NOP");
-		// TRIPIN4 (CMPSS1 High-Komparator Ausgangssignal von der
-		// ePWM X-Bar) als Quelle fr das DCAH-Signal verwenden
-		// (siehe S. 2917 Reference Manual TMS320F2838x,SPRUII0D, Rev. D, July 2022)
-		EPwm1Regs.DCTRIPSEL.bit.DCAHCOMPSEL = PWM_DC_TRIP_TRIPIN4;
-		// TRIPIN5 (CMPSS1 Low-Komparator Ausgangssignal von der
-		// ePWM X-Bar) als Quelle fr das DCBH-Signal verwenden
-		EPwm1Regs.DCTRIPSEL.bit.DCBHCOMPSEL = PWM_DC_TRIP_TRIPIN5;
-		// Event DCAEVT1 auslsen, wenn das DCAH-Signal high ist
-		// 0: Event ausgeschaltet
-		// 1: Event wird ausgelst, wenn DCxH = low
-		// 2: Event wird ausgelst, wenn DCxH = high
-		// 3: Event wird ausgelst, wenn DCxL = low
-		// 4: Event wird ausgelst, wenn DCxL = high
-		// 5: Event wird ausgelst, wenn DCxH = low & DCxL = high
-		EPwm1Regs.TZDCSEL.bit.DCAEVT1 = PWM_DC_DCXH_HIGH;
-		// Event DCBEVT1 auslsen, wenn das DCBH-Signal low ist
-		EPwm1Regs.TZDCSEL.bit.DCBEVT1 = PWM_DC_DCXH_LOW;
-		// Ungefiltertes/originales DCAEVT1-Signal fr die weitere Verarbeitung verwenden
-		// (siehe S. 2921 + 2922 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-		// 0: Originales DCAEVT1-Signal verwenden
-		// 1: Gefiltertes DCAEVT1-Signal verwenden
-		EPwm1Regs.DCACTL.bit.EVT1SRCSEL = PWM_DC_RAW_EVENT;
-		// Ungefiltertes/originales DCBEVT1-Signal fr die weitere Verarbeitung
-		EPwm1Regs.DCBCTL.bit.EVT1SRCSEL = PWM_DC_RAW_EVENT;
-		/*
-		// Interrupt auslsen, wenn das DCAEVT1-Event auftritt
-		// 0: Interrupt auschgeschaltet
-		// 1: Interrupt eingeschaltet
-		EPwm1Regs.TZEINT.bit.DCAEVT1 = PWM_DC_INT_ENABLE;
-		// Interrupt auslsen, wenn das DCBEVT1-Event auftritt
-		EPwm1Regs.TZEINT.bit.DCBEVT1 = PWM_DC_INT_ENABLE;
-		// Interrupt auslsen, wenn ein OST-Event auftritt
-		EPwm1Regs.TZEINT.bit.OST = PWM_DC_OST_INT_ENABLE;
-		// Fr jedes Event wird immer der gleiche Interrupt ausgelst (EPWMxTZINT).
-		// CPU-Interrupts whrend der Konfiguration global sperren
-		DINT;
-		// Interrupt-Service-Routinen fr den TZ-Interrupt an die
-		// entsprechende Stelle (EPWM1_TZ_INT) der PIE-Vector Table speichern
-		PieVectTable.EPWM1_TZ_INT = &TripzonePwm1ISR;
-		// EPWM1-TZ-Interrupt freischalten (Zeile 2, Spalte 1 der Tabelle 3-2)
-		// (siehe S. 150 Reference Manual TMS320F2838x , SPRUII0D, Rev. D, July 2022)
-		PieCtrlRegs.PIEIER2.bit.INTx1 = 1;
-		// CPU-Interrupt 2 einschalten (Zeile 2 der Tabelle)
-		IER |= M_INT2;
-		// CPU-Interrupts nach Konfiguration global wieder freigeben
-		EINT;
-		*/
-		// Fr das Auslsen einer PWM-Schaltaktion (Signal DCAEVT1.force) das
-		// DCAEVT1-Signal asynchron zu SYSCLK verwenden (keine Zeitverzgerung)
-		// (siehe S. 2921 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-		// 0: Signal DCAEVT1.force synchron zu SYSCLK
-		// 1: Signal DCAEVT1.force asynchron zu SYSCLK
-		EPwm1Regs.DCACTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
-		// Fr das Auslsen einer PWM-Schaltaktion (Signal DCBEVT1.force)
-		// das DCBEVT1-Signal asynchron zu SYSCLK verwenden (keine Zeitverzgerung)
-		// 0: Signal asynchron zu SYSCLK
-		// 1: Signal synchron zu SYSCLK
-		EPwm1Regs.DCBCTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
-		// Fr das Auslsen einer PWM-Schaltaktion (Signal DCAEVT1.force) das
-		// DCAEVT1-Signal direkt verwenden (Flip-Flop umgehen). Die Information
-		// zum Einstellen des Nultiplexers fehlt im Reference Manual! Ich habe
-		// diese Information ber eine Anfrage bei TI erhalten (Mail: 22.04.2022)
-		// 0: Signal direkt
-		// 1: Signal ber Flip-Flop
-		EPwm1Regs.DCACTL.bit.EVT1LATSEL = PWM_DC_EVENT_UNLATCHED;
-		// Fr das Auslsen einer PWM-Schaltaktion (Signal DCBEVT1.force)
-		// das DCAEVT1-Signal direkt verwenden (Flip-Flop umgehen)
-		EPwm1Regs.DCBCTL.bit.EVT1LATSEL = PWM_DC_EVENT_UNLATCHED;
+
+		pwm->DCTRIPSEL.bit.DCAHCOMPSEL = config->dcaSource;
+		pwm->DCTRIPSEL.bit.DCBHCOMPSEL = config->dcbSource;
 		// Der Pegel am PWM-Ausgangspin des Mikrocontrollers wird durch vier Signale bestimmt
 		// (siehe S. 2910 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
 		// 1: TZx (Cycle-by-Cycle und One-Shot Trip Events)
@@ -255,45 +353,139 @@ void TripzoneInitCmpss1(void)
 		// Register TZCTL2, TZCTLDCA und TZCTLDCB festgelegt (TZCTL2.ETZE = 1). Letzteres
 		// erlaubt eine Konfiguration abhngig von der Zhlrichtung des Timers (hoch/runter).
 		// Tripzone-Einstellungen aus dem TZCTL-Register benutzen
-		// 0: Tripzone-Einstellungen aus dem TZCTL-Register benutzen
-		// 1: Tripzone-Einstellungen aus dem TZCTL2-, TZCTLDCA- und TZCTLDCB-Register benutzen
-		EPwm1Regs.TZCTL2.bit.ETZE = PWM_TZ_CONFIG_BY_TZCTL;
-		/*
-		// Bei einem DCAEVT1-Event den ePWM1A-Pin auf Low-Pegel setzen.
-		// Bei diesem Betrieb werden die PWM-Pins solange auf dem konfigurierten Zustand
-		// gehalten, solange das DCxEVTx-Event anliegt. Nachdem das DCxEVTx-Signal in den
-		// Ruhezustand wechselt, bernehmen die ePWMx-Signale wieder die Kontrolle ber
-		// die PWM-Pins. Die Flags fr die ausgelsten Events bleiben trotzdem gesetzt
-		// und mssen manuell gelscht werden.
-		// 0: PWM-in auf High-Impedance setzen
-		// 1: PWM-Pin auf High-Pegel setzen
-		// 2: PWM-Pin auf Low-Pegel setzen
-		// 3: Keine Aktion durchfhren
-		EPwm1Regs.TZCTL.bit.DCAEVT1 = PWM_TZ_FORCE_LO;
-		// Bei einem DCBEVT1-Event den ePWM1B-Signal auf 0 setzen
-		EPwm1Regs.TZCTL.bit.DCBEVT1 = PWM_TZ_FORCE_LO;
-		*/
-		// DCAEVT1-Signal als One-Shot-Trip Quelle setzen.
-		// Bei diesem Betrieb verbleiben die PWM-Pins auf dem konfigurierten Zustand,
-		// bis das One-Shot-Flag gelscht wird (TZCLR.OST), auch wenn das auslsende
-		// Event (TZ1...6, DCxEVT1) bereits verstrichen ist (siehe Trip-Zone Submodule
-		// Mode Control Logic S. 2910 Reference Manual TMS320F2838x, SPRUII0D, Rev. D,
-		// July 2022). Dieser Betrieb (One-Shot-Trip) bersteuert die Signale DCxEVT1.force
-		// und DCxEVT2.force. Die Flags der DCxEVT1- und DCxEVT2 werden ebenfalls gesetzt
-		// und mssen manuell gelscht werden.
-		// 0: DCAEVT1 als Quelle deaktiviert
-		// 1: DCAEVT1 als Quelle aktiviert
-		EPwm1Regs.TZSEL.bit.DCAEVT1 = PWM_TZ_ENABLE;
-		// DCBEVT1-Signal als One-Shot-Trip Quelle setzen
-		EPwm1Regs.TZSEL.bit.DCBEVT1 = PWM_TZ_ENABLE;
-		// Bei einem TZA-Event den ePWM1A-Pin auf Low-Pegel setzen
-		// 0: PWM-in auf High-Impedance setzen
-		// 1: PWM-Pin auf High-Pegel setzen
-		// 2: PWM-Pin auf Low-Pegel setzen
-		// 3: Keine Aktion durchfhren
-		EPwm1Regs.TZCTL.bit.TZA = PWM_TZ_FORCE_LO;
-		// Bei einem TZB-Event den ePWM1B-Pin auf Low-Pegel setzen
-		EPwm1Regs.TZCTL.bit.TZB = PWM_TZ_FORCE_LO;
+		pwm->TZCTL2.bit.ETZE = PWM_TZ_CONFIG_BY_TZCTL;
+
+		if (config->action == TRIPZONE_ACTION_CBC)
+		{
+				pwm->TZDCSEL.bit.DCAEVT2 = config->dcaCondition;
+				pwm->TZDCSEL.bit.DCBEVT2 = config->dcbCondition;
+				pwm->DCACTL.bit.EVT2SRCSEL = config->eventFilter;
+				pwm->DCBCTL.bit.EVT2SRCSEL = config->eventFilter;
+				pwm->DCACTL.bit.EVT2FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+				pwm->DCBCTL.bit.EVT2FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+				pwm->DCACTL.bit.EVT2LATSEL = PWM_DC_EVENT_UNLATCHED;
+				pwm->DCBCTL.bit.EVT2LATSEL = PWM_DC_EVENT_UNLATCHED;
+				// DCxEVT2 als Cycle-by-Cycle-Quelle, Pins werden bis zum nchsten
+				// Zhlerstand 0 bersteuert (TZCLR.CBCPULSE = 0)
+				pwm->TZSEL.bit.DCAEVT2 = PWM_TZ_ENABLE;
+				pwm->TZSEL.bit.DCBEVT2 = PWM_TZ_ENABLE;
+		}
+		else
+		{
+				pwm->TZDCSEL.bit.DCAEVT1 = config->dcaCondition;
+				pwm->TZDCSEL.bit.DCBEVT1 = config->dcbCondition;
+				pwm->DCACTL.bit.EVT1SRCSEL = config->eventFilter;
+				pwm->DCBCTL.bit.EVT1SRCSEL = config->eventFilter;
+				pwm->DCACTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+				pwm->DCBCTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+				pwm->DCACTL.bit.EVT1LATSEL = PWM_DC_EVENT_UNLATCHED;
+				pwm->DCBCTL.bit.EVT1LATSEL = PWM_DC_EVENT_UNLATCHED;
+		}
+
+		if (config->action == TRIPZONE_ACTION_DCEVT)
+		{
+				// Pins nur solange bersteuern, wie das Event anliegt
+				pwm->TZCTL.bit.DCAEVT1 = config->pinStateA;
+				pwm->TZCTL.bit.DCBEVT1 = config->pinStateB;
+		}
+		else
+		{
+				if (config->action == TRIPZONE_ACTION_OST)
+				{
+						// DCxEVT1 als One-Shot-Quelle setzen.
+						// Bei diesem Betrieb verbleiben die PWM-Pins auf dem konfigurierten Zustand,
+						// bis das One-Shot-Flag gelscht wird (TZCLR.OST), auch wenn das auslsende
+						// Event (TZ1...6, DCxEVT1) bereits verstrichen ist (siehe Trip-Zone Submodule
+						// Mode Control Logic S. 2910 Reference Manual TMS320F2838x, SPRUII0D, Rev. D,
+						// July 2022). Dieser Betrieb (One-Shot-Trip) bersteuert die Signale DCxEVT1.force
+						// und DCxEVT2.force. Die Flags der DCxEVT1- und DCxEVT2 werden ebenfalls gesetzt
+						// und mssen manuell gelscht werden.
+						pwm->TZSEL.bit.DCAEVT1 = PWM_TZ_ENABLE;
+						pwm->TZSEL.bit.DCBEVT1 = PWM_TZ_ENABLE;
+				}
+				pwm->TZCTL.bit.TZA = config->pinStateA;
+				pwm->TZCTL.bit.TZB = config->pinStateB;
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TripzoneInitProtection ============================================================
+///
+/// @brief  Funktion initialisiert die Komparatorsubsysteme und ePWM-Module aus zwei Tabellen.
+///					Zuerst werden alle Eintrge geprft, bei einem ungltigen Eintrag wird kein
+///					Register verndert. Die von der Tabelle verwendeten Ausgnge der ePWM X-Bar
+///					werden vollstndig neu belegt (vorherige Signalquellen werden gesperrt), mehrere
+///					Komparatorsubsysteme auf dem gleichen Ausgang werden verodert. Die Abschaltung
+///					erfolgt vollstndig in Hardware, die Software ist daran nicht beteiligt
+///
+/// @param  const TripzoneCmpssConfig *cmpss, uint16_t numberOfCmpss,
+///					const TripzonePwmConfig *pwm, uint16_t numberOfPwms
+///
+/// @return bool valid (false: ungltiger Tabelleneintrag, nichts konfiguriert)
+///
+//=================================================================================================
+bool TripzoneInitProtection(const TripzoneCmpssConfig *cmpss, uint16_t numberOfCmpss,
+														const TripzonePwmConfig *pwm, uint16_t numberOfPwms)
+{
+		uint16_t i;
+
+		for (i = 0; i < numberOfCmpss; i++)
+				if (!TripzoneCmpssConfigValid(&cmpss[i]))
+						return false;
+		for (i = 0; i < numberOfPwms; i++)
+				if (!TripzonePwmConfigValid(&pwm[i]))
+						return false;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Noch ggf. aktive Signalquellen der verwendeten X-Bar Ausgnge sperren
+		for (i = 0; i < numberOfCmpss; i++)
+		{
+				if (cmpss[i].tripHigh != TRIPZONE_XBAR_NONE)
+						*tripzoneXbarOutputs[TripzoneXbarIndex(cmpss[i].tripHigh)].enable = 0;
+				if (cmpss[i].tripLow != TRIPZONE_XBAR_NONE)
+						*tripzoneXbarOutputs[TripzoneXbarIndex(cmpss[i].tripLow)].enable = 0;
+		}
+		for (i = 0; i < numberOfCmpss; i++)
+				TripzoneInitCmpss(&cmpss[i]);
+		for (i = 0; i < numberOfPwms; i++)
+				TripzoneInitPwm(&pwm[i]);
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: TripzoneInitCmpss1 ================================================================
+///
+/// @brief  Funktion initialisiert die beiden High- und Low-Komparatoren des Analog-Eingangs A2
+///					und die zugehrigen DACs (Analogsignal jeweils am +Eingang, DACs jeweils am -Eingang
+///					der Komparatoren, DAC mt VDDA als Referenz, Komparatorausgnge auf X-Bar legen), die
+///					ePWM X-Bar und das ePWM1-Modul. Wenn die analoge Spannung an Pin A2 unterhalb von
+///					(1000/4095) * 3,3 V (DACLVALS) oder oberhalb von (3000/4095) * 3,3 V (DACHVALS)
+///					liegt, werden beide PWM-Pins (ePWM1A und ePWM1B) auf Low-Pegel gesetzt. Anderfalls
+///					liegt an den Pins ein PWM-Signal mit 50 % Tastverhltnis und 10 kHz Freuqenz an.
+///					Die Einstellungen der Komparatoren und der Tripzone stehen in den Tabelleneintrgen
+///					"tripzoneCmpss1Config" und "tripzonePwm1Config" (siehe TripzoneInitProtection())
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripzoneInitCmpss1(void)
+{
+		// Komparatorsubsystem 1, ePWM X-Bar und Tripzone von ePWM1 konfigurieren
+		TripzoneInitProtection(&tripzoneCmpss1Config, 1, &tripzonePwm1Config, 1);
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
 
 		// Nicht Tripzone-spezifische PWM-Konfiguration:
     // Takt-Teiler des PWM-Moduls setzen
@@ -371,12 +563,130 @@ void TripzoneInitCmpss1(void)
     // Pull-Up-Widerstand deaktivieren
     GpioCtrlRegs.GPAPUD.bit.GPIO1 = 1;
 
+#if TRIPZONE_FAULT_LOG || (TRIPZONE_PWM1_ACTION == TRIPZONE_ACTION_CBC)
+		// Interrupt auslsen, wenn ein OST-Event auftritt (DCAEVT1- oder DCBEVT1-Event),
+		// damit die ISR den Fehler protokolliert
+		EPwm1Regs.TZEINT.bit.OST = PWM_DC_OST_INT_ENABLE;
+#if TRIPZONE_PWM1_ACTION == TRIPZONE_ACTION_CBC
+		// Interrupt bei jedem CBC-Event auslsen (Zhlung fr die Wiederanlauf-Strategie)
+		EPwm1Regs.TZEINT.bit.CBC = PWM_DC_INT_ENABLE;
+#endif
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// Interrupt-Service-Routinen fr den TZ-Interrupt an die
+		// entsprechende Stelle (EPWM1_TZ_INT) der PIE-Vector Table speichern
+		PieVectTable.EPWM1_TZ_INT = &TripzonePwm1ISR;
+		// EPWM1-TZ-Interrupt freischalten (Zeile 2, Spalte 1 der Tabelle 3-2)
+		// (siehe S. 150 Reference Manual TMS320F2838x , SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER2.bit.INTx1 = 1;
+		// CPU-Interrupt 2 einschalten (Zeile 2 der Tabelle)
+		IER |= M_INT2;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+#endif
+
 		// Register-Schreibschutz setzen
 		EDIS;
 }
 
 
-//=== Function: TripzonePwm1ISR ==================================================================
+//=== Function: TripzoneSetRestartPolicy ==========================================================
+///
+/// @brief  Funktion setzt die Wiederanlauf-Strategie der Cycle-by-Cycle-Strombegrenzung und
+///					setzt die Versuche zurck
+///
+/// @param  const TripzoneRestartPolicy *policy
+///
+/// @return void
+///
+//=================================================================================================
+void TripzoneSetRestartPolicy(const TripzoneRestartPolicy *policy)
+{
+		// Die ISR liest die Strategie, daher whrend des Kopierens sperren
+		DINT;
+		tripzoneRestartPolicy = *policy;
+		tripzoneBackoff = policy->backoffCycles;
+		tripzoneRetries = 0;
+		tripzoneCbcWindowCount = 0;
+		EINT;
+}
+
+
+//=== Function: TripzoneRestartService ============================================================
+///
+/// @brief  Funktion startet ePWM1 nach einer Abschaltung wieder, sobald die Wartezeit abgelaufen
+///					ist (Lschen von TZFLG.OST). Die Wartezeit wird bei jedem Versuch bis auf
+///					backoffMaxCycles verdoppelt. Sind alle Versuche verbraucht, bleibt ePWM1
+///					abgeschaltet (TRIPZONE_STATE_LATCHED). Nach retryResetCycles ohne Abschaltung
+///					werden die Versuche und die Wartezeit zurckgesetzt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripzoneRestartService(void)
+{
+		uint32_t now = PROFILE_TIMESTAMP();
+
+		if (tripzoneState == TRIPZONE_STATE_RUNNING)
+		{
+				if ((tripzoneRetries > 0)
+						&& (now - tripzoneRestartTime >= tripzoneRestartPolicy.retryResetCycles))
+				{
+						tripzoneRetries = 0;
+						tripzoneBackoff = tripzoneRestartPolicy.backoffCycles;
+				}
+		}
+		else if (tripzoneState == TRIPZONE_STATE_TRIPPED)
+		{
+				if (tripzoneRetries >= tripzoneRestartPolicy.maxRetries)
+				{
+						// Latch-off: nur noch TripzoneResetProtection() gibt ePWM1 frei
+						tripzoneState = TRIPZONE_STATE_LATCHED;
+				}
+				else if (now - tripzoneTripTime >= tripzoneBackoff)
+				{
+						tripzoneRetries++;
+						tripzoneBackoff = (tripzoneBackoff > tripzoneRestartPolicy.backoffMaxCycles / 2)
+															? tripzoneRestartPolicy.backoffMaxCycles : (2 * tripzoneBackoff);
+						tripzoneRestartTime = now;
+						tripzoneCbcWindowCount = 0;
+						// Zustand vor dem Lschen setzen, damit eine sofortige erneute
+						// Abschaltung von der ISR erkannt wird
+						tripzoneState = TRIPZONE_STATE_RUNNING;
+						EALLOW;
+						EPwm1Regs.TZCLR.bit.OST = 1;
+						EDIS;
+				}
+		}
+}
+
+
+//=== Function: TripzoneResetProtection ===========================================================
+///
+/// @brief  Funktion hebt eine Abschaltung von ePWM1 sofort auf (auch nach Latch-off) und setzt
+///					die Versuche und die Wartezeit zurck
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripzoneResetProtection(void)
+{
+		tripzoneRetries = 0;
+		tripzoneBackoff = tripzoneRestartPolicy.backoffCycles;
+		tripzoneRestartTime = PROFILE_TIMESTAMP();
+		tripzoneCbcWindowCount = 0;
+		tripzoneState = TRIPZONE_STATE_RUNNING;
+		EALLOW;
+		EPwm1Regs.TZCLR.bit.OST = 1;
+		EDIS;
+}
+
+
+//=== Function: TripzonePwm1ISR
 ///
 /// @brief  ISR wird aufgerufen, wenn ein Tripzone-Event des ePWM1-Moduls
 ///					auftritt und der zugehrige Interrupt eingeschaltet ist
@@ -388,6 +698,13 @@ void TripzoneInitCmpss1(void)
 //=================================================================================================
 __interrupt void TripzonePwm1ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_TRIPZONE);
+
+#if TRIPZONE_FAULT_LOG
+		// Trip-Flags und Zustand von ePWM1 vor dem Lschen der Flags protokollieren
+		TripLogRecordEvent(&EPwm1Regs);
+#endif
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -407,11 +724,47 @@ __interrupt void TripzonePwm1ISR(void)
 		{
 				EPwm1Regs.TZCLR.bit.DCBEVT1 = 1;
 		}
+#if TRIPZONE_PWM1_ACTION == TRIPZONE_ACTION_CBC
+		// CBC-Event: die Pins wurden bereits von der Hardware bis zum Ende der Periode
+		// abgeschaltet. Hier nur zhlen und bei anhaltendem berstrom abschalten
+		if (EPwm1Regs.TZFLG.bit.CBC)
+		{
+				uint32_t now = PROFILE_TIMESTAMP();
+
+				tripzoneCbcEvents++;
+				if (now - tripzoneCbcWindowStart >= tripzoneRestartPolicy.cbcWindowCycles)
+				{
+						tripzoneCbcWindowStart = now;
+						tripzoneCbcWindowCount = 0;
+				}
+				if (++tripzoneCbcWindowCount > tripzoneRestartPolicy.cbcMaxPerWindow)
+				{
+						// Anhaltender berstrom: One-Shot-Trip per Software auslsen
+						// (gleiche Pin-Zustnde wie beim CBC-Event, TZCTL.TZA/TZB)
+						EPwm1Regs.TZFRC.bit.OST = 1;
+				}
+				// Flags der CBC-Quellen und das CBC-Flag lschen
+				EPwm1Regs.TZCBCCLR.bit.DCAEVT2 = 1;
+				EPwm1Regs.TZCBCCLR.bit.DCBEVT2 = 1;
+				EPwm1Regs.TZCLR.bit.DCAEVT2 = 1;
+				EPwm1Regs.TZCLR.bit.DCBEVT2 = 1;
+				EPwm1Regs.TZCLR.bit.CBC = 1;
+		}
+		// OST-Event: ePWM1 bleibt abgeschaltet, TripzoneRestartService() entscheidet
+		// ber den Wiederanlauf
+		if (EPwm1Regs.TZFLG.bit.OST && (tripzoneState == TRIPZONE_STATE_RUNNING))
+		{
+				tripzoneState = TRIPZONE_STATE_TRIPPED;
+				tripzoneTripTime = PROFILE_TIMESTAMP();
+				tripzoneShutdowns++;
+		}
+#else
 		// Trip-Flag des OST-Events lschen
 		if (EPwm1Regs.TZFLG.bit.OST)
 		{
 				EPwm1Regs.TZCLR.bit.OST = 1;
 		}
+#endif
 
 		// Allgemeines Trip-Flag lschen (wird immer mitgesetzt, wenn ein
 		// Trip-Flag gesetzt wird und der zugehrige Interrupt eingeschaltet
@@ -419,5 +772,6 @@ __interrupt void TripzonePwm1ISR(void)
 		EPwm1Regs.TZCLR.bit.INT = 1;
 		// Interrupt-Flag der Gruppe 2 lschen (da gehrt der EPWM1-TZ-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK2 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_TRIPZONE);
 }
 
@@ -22,7 +22,25 @@
 ///							- ADCINA2/CMPIN1P an Mittelabgriff Poti (0 ... 3,3 V)
 ///							- GPIO 0 und 1 an Oszilloskop
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Fr mehrere Leistungsstufen werden die Komparator-
+///							subsysteme (CMPSS1 ... 8) und die ePWM-Module (ePWM1 ... 16) ber zwei Tabellen
+///							konfiguriert (siehe TripzoneInitProtection()). Jeder Tabelleneintrag beschreibt
+///							die Schwellwerte, den digitalen Filter und die ePWM X-Bar Ausgnge eines
+///							Komparatorsubsystems bzw. die DC-Events und die Tripzone-Aktion eines ePWM-Moduls.
+///
+///							nderung in Version 1.3: Bei einem One-Shot-Trip des ePWM1-Moduls wird ein
+///							Interrupt ausgelst, die ISR schreibt einen Eintrag in das Fehlerprotokoll
+///							(TRIPZONE_FAULT_LOG, siehe myTripLog.h).
+///
+///							nderung in Version 1.4: Cycle-by-Cycle-Strombegrenzung fr ePWM1
+///							(TRIPZONE_PWM1_ACTION). Ein berstrom schaltet die Pins nur bis zum Ende der
+///							PWM-Periode ab. Treten innerhalb eines Zeitfensters zu viele CBC-Events auf, wird
+///							ePWM1 per One-Shot-Trip abgeschaltet und nach einer Wartezeit (Back-off, wird
+///							bei jedem Versuch verdoppelt) automatisch wieder gestartet. Nach der maximalen
+///							Anzahl an Versuchen bleibt ePWM1 abgeschaltet, bis "TripzoneResetProtection()"
+///							aufgerufen wird (Latch-off).
+///
+/// @version    V1.4
 ///
 /// @date       13.02.2023
 ///
@@ -34,11 +52,19 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myProfile.h"
+#include "myTripLog.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Fehlerprotokoll in der Tripzone-ISR (0: aus, 1: ein)
+#define TRIPZONE_FAULT_LOG									1
+// Tripzone-Aktion von ePWM1
+// TRIPZONE_ACTION_OST: Abschaltung, die ISR gibt die Pins sofort wieder frei
+// TRIPZONE_ACTION_CBC: Strombegrenzung pro PWM-Periode mit Wiederanlauf-Strategie
+#define TRIPZONE_PWM1_ACTION								TRIPZONE_ACTION_CBC
 // Taktteiler
 #define PWM_CLK_DIV_1   										0
 #define PWM_CLK_DIV_2												1
@@ -220,6 +246,96 @@
 #define PWM_ET_CTRD_CMPA    								5
 #define PWM_ET_CTRU_CMPB   					 				6
 #define PWM_ET_CTRD_CMPB    								7
+// Anzahl Komparatorsubsysteme und ePWM-Module
+#define TRIPZONE_NUMBER_OF_CMPSS						8
+#define TRIPZONE_NUMBER_OF_PWMS							16
+// Ausgang der ePWM X-Bar (= TRIPINx der ePWM-Module). TRIP1, 2, 3 und 6 werden
+// nicht ber die X-Bar gefhrt und stehen daher nicht zur Verfgung
+#define TRIPZONE_XBAR_NONE									0
+#define TRIPZONE_XBAR_TRIP4									4
+#define TRIPZONE_XBAR_TRIP5									5
+#define TRIPZONE_XBAR_TRIP7									7
+#define TRIPZONE_XBAR_TRIP8									8
+#define TRIPZONE_XBAR_TRIP9									9
+#define TRIPZONE_XBAR_TRIP10								10
+#define TRIPZONE_XBAR_TRIP11								11
+#define TRIPZONE_XBAR_TRIP12								12
+// Komparator-Ausgangssignal zur ePWM X-Bar (COMPCTL.CTRIPxSEL)
+#define CMPSS_CTRIP_ASYNC										0
+#define CMPSS_CTRIP_SYNC										1
+#define CMPSS_CTRIP_FILTER									2
+#define CMPSS_CTRIP_LATCH										3
+// Hysterese der Komparatoren (Vielfaches von 12 DAC-Schritten)
+#define CMPSS_HYSTERESIS_NONE								0
+#define CMPSS_HYSTERESIS_1X									1
+#define CMPSS_HYSTERESIS_2X									2
+#define CMPSS_HYSTERESIS_3X									3
+#define CMPSS_HYSTERESIS_4X									4
+// Maximale Fensterlnge des digitalen Filters (Abtastwerte)
+#define CMPSS_FILTER_MAX_WINDOW							32
+// Tripzone-Aktion eines ePWM-Moduls bei einem DC-Event
+// DCEVT: Pins nur solange bersteuern, wie das DCxEVT1-Event anliegt (TZCTL.DCxEVT1)
+// OST:   Pins bis zum Lschen von TZFLG.OST bersteuern (DCxEVT1 als One-Shot-Quelle)
+// CBC:   Pins bis zum Ende der PWM-Periode bersteuern (DCxEVT2 als Cycle-by-Cycle-Quelle)
+#define TRIPZONE_ACTION_DCEVT								0
+#define TRIPZONE_ACTION_OST									1
+#define TRIPZONE_ACTION_CBC									2
+// Takte von CPU-Timer 2 pro Millisekunde (Zeiten der Wiederanlauf-Strategie)
+#define TRIPZONE_CYCLES_PER_MS							(DEVICE_SYSCLK_MHZ * 1000UL)
+// Zustand der Wiederanlauf-Strategie
+#define TRIPZONE_STATE_RUNNING							0
+#define TRIPZONE_STATE_TRIPPED							1
+#define TRIPZONE_STATE_LATCHED							2
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Konfiguration eines Komparatorsubsystems. Liegen tripHigh und tripLow auf dem gleichen
+// X-Bar Ausgang, wird das veroderte Signal CTRIPH_OR_CTRIPL verwendet (ein Trip-Eingang
+// fr ber- und Unterschreitung)
+typedef struct
+{
+		uint16_t cmpss;																// 1 ... 8
+		uint16_t inputMux;														// CMPHPMXSEL/CMPLPMXSEL (Analog-Pin)
+		uint16_t dacHigh;															// Schwellwert High-Komparator (12 Bit)
+		uint16_t dacLow;															// Schwellwert Low-Komparator (12 Bit)
+		uint16_t hysteresis;
+		uint16_t ctripSelect;													// CMPSS_CTRIP_*
+		uint16_t filterPrescale;											// Filtertakt = SYSCLK / (filterPrescale + 1)
+		uint16_t filterWindow;												// 1 ... CMPSS_FILTER_MAX_WINDOW
+		uint16_t filterThreshold;											// > filterWindow / 2, <= filterWindow
+		uint16_t tripHigh;														// TRIPZONE_XBAR_*
+		uint16_t tripLow;															// TRIPZONE_XBAR_*
+} TripzoneCmpssConfig;
+
+// Konfiguration der Tripzone eines ePWM-Moduls. DCAH fhrt auf das A-, DCBH auf das
+// B-Event (DCAEVT1/2, DCBEVT1/2)
+typedef struct
+{
+		uint16_t pwm;																	// 1 ... 16
+		uint16_t dcaSource;														// PWM_DC_TRIP_*
+		uint16_t dcbSource;														// PWM_DC_TRIP_*
+		uint16_t dcaCondition;												// PWM_DC_* (Event-Bedingung)
+		uint16_t dcbCondition;												// PWM_DC_* (Event-Bedingung)
+		uint16_t eventFilter;													// PWM_DC_RAW_EVENT/PWM_DC_FILTERED_EVENT
+		uint16_t action;															// TRIPZONE_ACTION_*
+		uint16_t pinStateA;														// PWM_TZ_*
+		uint16_t pinStateB;														// PWM_TZ_*
+} TripzonePwmConfig;
+
+// Wiederanlauf-Strategie der Cycle-by-Cycle-Strombegrenzung (alle Zeiten in Takten von
+// CPU-Timer 2, max. ca. 21 s). Mehr als cbcMaxPerWindow CBC-Events innerhalb von
+// cbcWindowCycles gelten als anhaltender berstrom und fhren zur Abschaltung
+typedef struct
+{
+		uint16_t cbcMaxPerWindow;
+		uint32_t cbcWindowCycles;
+		uint16_t maxRetries;													// Versuche bis zum Latch-off
+		uint32_t backoffCycles;												// Wartezeit vor dem ersten Versuch
+		uint32_t backoffMaxCycles;										// max. Wartezeit (Verdopplung)
+		uint32_t retryResetCycles;										// fehlerfreie Zeit bis zum Zurcksetzen der Versuche
+} TripzoneRestartPolicy;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -230,6 +346,13 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Zustand der Wiederanlauf-Strategie (TRIPZONE_STATE_*) und Anzahl der Versuche seit
+// dem letzten Zurcksetzen
+extern volatile uint16_t tripzoneState;
+extern uint16_t tripzoneRetries;
+// Anzahl CBC-Events und Abschaltungen (One-Shot-Trips) seit dem Start
+extern volatile uint32_t tripzoneCbcEvents;
+extern volatile uint32_t tripzoneShutdowns;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -240,6 +363,15 @@
 // der Komparatoren, DAC mt VDDA als Referenz, Komparatorausgnge auf X-Bar legen), die
 // ePWM X-Bar und das ePWM1-Modul
 extern void TripzoneInitCmpss1(void);
+// Funktion initialisiert die Komparatorsubsysteme und ePWM-Module aus den Tabellen
+extern bool TripzoneInitProtection(const TripzoneCmpssConfig *cmpss, uint16_t numberOfCmpss,
+																	 const TripzonePwmConfig *pwm, uint16_t numberOfPwms);
+// Funktion setzt die Wiederanlauf-Strategie der Cycle-by-Cycle-Strombegrenzung
+extern void TripzoneSetRestartPolicy(const TripzoneRestartPolicy *policy);
+// Funktion startet ePWM1 nach Ablauf der Wartezeit wieder (im Hauptprogramm zyklisch aufrufen)
+extern void TripzoneRestartService(void);
+// Funktion hebt eine Abschaltung (auch Latch-off) auf und setzt die Versuche zurck
+extern void TripzoneResetProtection(void);
 // ISR fr das Tripzone-Event des ePWM1-Moduls
 __interrupt void TripzonePwm1ISR(void);
 
@@ -9,24 +9,15 @@ MEMORY
 //   RAMM1_RSVD       : origin = 0x0007F8, length = 0x000008     /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
    RAMD0            : origin = 0x00C000, length = 0x000800
    RAMD1            : origin = 0x00C800, length = 0x000800
-   RAMLS0           : origin = 0x008000, length = 0x000800
-   RAMLS1           : origin = 0x008800, length = 0x000800
-   RAMLS2           : origin = 0x009000, length = 0x000800
-   RAMLS3           : origin = 0x009800, length = 0x000800
+   /* RAMLS0 to RAMLS3 as one block for the code copied from flash (.TI.ramfunc with the Flash API) */
+   RAMLS0_3         : origin = 0x008000, length = 0x002000
    RAMLS4           : origin = 0x00A000, length = 0x000800
    RAMLS5           : origin = 0x00A800, length = 0x000800
    RAMLS6           : origin = 0x00B000, length = 0x000800
    RAMLS7           : origin = 0x00B800, length = 0x000800
    RAMGS0           : origin = 0x00D000, length = 0x001000
    RAMGS1           : origin = 0x00E000, length = 0x001000
-   RAMGS2           : origin = 0x00F000, length = 0x001000
-   RAMGS3           : origin = 0x010000, length = 0x001000
-   RAMGS4           : origin = 0x011000, length = 0x001000
-   RAMGS5           : origin = 0x012000, length = 0x001000
-   RAMGS6           : origin = 0x013000, length = 0x001000
-   RAMGS7           : origin = 0x014000, length = 0x001000
-   RAMGS8           : origin = 0x015000, length = 0x001000
-   RAMGS9           : origin = 0x016000, length = 0x001000
+   RAMGS2_9         : origin = 0x00F000, length = 0x008000     /* RAMGS2 to RAMGS9 as one block for large capture buffers */
    RAMGS10          : origin = 0x017000, length = 0x001000
    RAMGS11          : origin = 0x018000, length = 0x001000
    RAMGS12          : origin = 0x019000, length = 0x001000
@@ -65,29 +56,31 @@ MEMORY
 
 SECTIONS
 {
+   /* The resident program uses only sectors A to D (FLASH0 to FLASH3). E to G and H to J are the
+      update slots, N is the boot record (see myUpdate.h), these sectors are erased by an update */
    codestart           : > BEGIN, ALIGN(8)
-   .text               : >> FLASH1 | FLASH2 | FLASH3 | FLASH4, ALIGN(8)
-   .cinit              : > FLASH4, ALIGN(8)
+   .text               : >> FLASH0 | FLASH1 | FLASH2 | FLASH3, ALIGN(8)
+   .cinit              : >> FLASH0 | FLASH1 | FLASH2 | FLASH3, ALIGN(8)
    .switch             : > FLASH1, ALIGN(8)
    .reset              : > RESET, TYPE = DSECT /* not used, */
    .stack              : > RAMM1
 
 #if defined(__TI_EABI__)
    .init_array      : > FLASH1, ALIGN(8)
-   .bss             : > RAMLS5
-   .bss:output      : > RAMLS3
-   .bss:cio         : > RAMLS5
-   .data            : > RAMLS5
-   .sysmem          : > RAMLS5
+   .bss             : >> RAMLS5 | RAMLS6 | RAMLS7
+   .bss:output      : > RAMD1
+   .bss:cio         : > RAMD1
+   .data            : >> RAMLS5 | RAMLS6 | RAMLS7
+   .sysmem          : > RAMGS12
    /* Initalized sections go in Flash */
-   .const           : > FLASH5, ALIGN(8)
+   .const           : >> FLASH0 | FLASH1 | FLASH2 | FLASH3, ALIGN(8)
 #else
    .pinit           : > FLASH1, ALIGN(8)
-   .ebss            : > RAMLS5
-   .esysmem         : > RAMLS5
-   .cio             : > RAMLS5
+   .ebss            : >> RAMLS5 | RAMLS6 | RAMLS7
+   .esysmem         : > RAMGS12
+   .cio             : > RAMD1
    /* Initalized sections go in Flash */
-   .econst          : >> FLASH4 | FLASH5, ALIGN(8)
+   .econst          : >> FLASH0 | FLASH1 | FLASH2 | FLASH3, ALIGN(8)
 #endif
 
    ramgs0 : > RAMGS0, type=NOINIT
@@ -98,17 +91,22 @@ SECTIONS
    MSGRAM_CPU_TO_CM    : > CPUTOCMRAM, type=NOINIT
    MSGRAM_CM_TO_CPU    : > CMTOCPURAM, type=NOINIT
 
-   /* The following section definition are for SDFM examples */
-   Filter_RegsFile  : > RAMGS0
-   Filter1_RegsFile : > RAMGS1, fill=0x1111
-   Filter2_RegsFile : > RAMGS2, fill=0x2222
-   Filter3_RegsFile : > RAMGS3, fill=0x3333
-   Filter4_RegsFile : > RAMGS4, fill=0x4444
-   Difference_RegsFile : >RAMGS5, fill=0x3333
+   /* Named data sections, see the DEVICE_..._DATA() macros in myDevice.h:
+      hotdata  - hot control state in LSx RAM (single cycle, can be given to the CLA)
+      capture  - bulk capture and log buffers in RAMGS2 to RAMGS9 (32 KW, not initialised)
+      dmabuf   - further DMA buffers in RAMGS10/RAMGS11 (ramgs0/ramgs1 are DMA buffers too)
+      SHARERAMGS14/15 - data shared with CPU2 (CPU1 must give the master role of the
+                 block, which CPU2 writes, to CPU2 with MemCfgRegs.GSxMSEL) */
+   hotdata      : > RAMLS4
+   capture      : > RAMGS2_9, type=NOINIT
+   dmabuf       : >> RAMGS10 | RAMGS11, type=NOINIT
+   SHARERAMGS14 : > RAMGS14, type=NOINIT
+   SHARERAMGS15 : > RAMGS15, type=NOINIT
 
    #if defined(__TI_EABI__)
-       .TI.ramfunc : {} LOAD = FLASH3,
-                        RUN = RAMLS0 | RAMLS1 | RAMLS2 |RAMLS3,
+       .TI.ramfunc : { *(.TI.ramfunc) -l FAPI_F2838x_EABI_v1.58.10.lib }
+                        LOAD = FLASH3,
+                        RUN = RAMLS0_3,
                         LOAD_START(RamfuncsLoadStart),
                         LOAD_SIZE(RamfuncsLoadSize),
                         LOAD_END(RamfuncsLoadEnd),
@@ -117,8 +115,9 @@ SECTIONS
                         RUN_END(RamfuncsRunEnd),
                         ALIGN(8)
    #else
-       .TI.ramfunc : {} LOAD = FLASH3,
-                        RUN = RAMLS0 | RAMLS1 | RAMLS2 |RAMLS3,
+       .TI.ramfunc : { *(.TI.ramfunc) -l FAPI_F2838x_EABI_v1.58.10.lib }
+                        LOAD = FLASH3,
+                        RUN = RAMLS0_3,
                         LOAD_START(_RamfuncsLoadStart),
                         LOAD_SIZE(_RamfuncsLoadSize),
                         LOAD_END(_RamfuncsLoadEnd),
@@ -19,9 +19,13 @@
 ///
 ///						nderung myUART.c V2.0 : Verwendung der Hardware-Puffer zum Senden und Empfangen
 ///
-/// @version	V1.2
+///						nderung in Version 1.3: Mit MAIN_FIRMWARE_UPDATE = 1 luft die UART-Schnittstelle
+///						im Streaming-Betrieb und das Hauptprogramm bearbeitet nur das Firmware-Update
+///						(myUpdate.h) statt der Sende-/Empfangs-Demonstration.
 ///
-/// @date			09.09.2022
+/// @version	V1.3
+///
+/// @date			14.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -30,11 +34,14 @@
 //-------------------------------------------------------------------------------------------------
 #include "myUART.h"
 #include "myPWM.h"
+#include "myUpdate.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Firmware-Update ber UART (0: aus, 1: ein)
+#define MAIN_FIRMWARE_UPDATE								0
 
 
 //-------------------------------------------------------------------------------------------------
@@ -62,6 +69,8 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+		// Zeitbasis fr die Laufzeitmessung der ISRs starten (CPU-Timer 2)
+		ProfileInit();
     // UART (SCI-A) initialisieren
     UartInitA(UART_BAUD_115200,
 						  UART_DATA_8_BIT,
@@ -69,6 +78,12 @@ void main(void)
 						  UART_PARITY_NONE);
 		// Timer 8 als Zeitgeber initialisieren
     PwmInitPwm8();
+#if MAIN_FIRMWARE_UPDATE
+		// Streaming-Betrieb, Telemetrie-Rahmen und Flash API fr das Update initialisieren
+		UartStartStreamA();
+		TelemetryInit();
+		UpdateInit();
+#endif
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -92,6 +107,15 @@ void main(void)
     // 4) Funktion "UartTransmit(n)" aufrufen, n = Anzhal der zu sendenen Bytes
     // 5) Warten bis die Kommunikation abgeschlossen ist durch Abfrage von "UartGetStatusTx()"
     // 6) Kommunikations-Status auf "idle" setzen mit "UartSetStatusIdleTx()"
+    //
+    //
+    // Ablauf im Streaming-Betrieb (kontinuierlicher Datenstrom, keine Lcken zwischen Datenpaketen):
+    //
+    // 1) Funktion "UartStartStreamA()" aufrufen (Empfang bleibt dauerhaft eingeschaltet)
+    // 2) Zu sendene Daten mit "UartWriteA(data, n)" in den Sende-Ringpuffer schreiben
+    // 3) Empfangene Daten mit "UartReadA(data, max)" aus dem Empfangs-Ringpuffer lesen
+    //    ("UartGetRxCountA()" gibt die Anzahl der empfangenen Bytes zurck)
+    // 4) Mit "UartStopStreamA()" zurck zu "UartReceiveA()" und "UartTransmitA()" wechseln
 
 
 		// GPIO 5 (LED D1002 auf ControlBoard) als Ausgang
@@ -112,6 +136,12 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
+#if MAIN_FIRMWARE_UPDATE
+    		// Nchsten Schritt des Updates ausfhren (blockiert fr einen Vorgang der FSM)
+    		UpdateService();
+    		continue;
+#endif
+
     		// Solange das Bit nicht gesetzt ist, sind noch Daten im
     		// Tx-Ausgangs-Schieberegister und/oder im Tx-Ausgangsregister.
     		// Kann z.B. zur Umschaltung eines RS485-Treibers genutzt werden
@@ -187,9 +217,9 @@ void main(void)
     				// Datenpaket nur einmal senden
         		goTx = 0;
             // Daten, welche versendet werden sollen, in den Sende-Puffer schreiben
-    				uartBufferTxA[0] = 1;
-            uartBufferTxA[1] = 2;
-            uartBufferTxA[2] = 3;
+    				BYTE_BUFFER_SET(uartBufferTxA, 0, 1);
+            BYTE_BUFFER_SET(uartBufferTxA, 1, 2);
+            BYTE_BUFFER_SET(uartBufferTxA, 2, 3);
             // Sendevorgang starten (3 Bytes senden)
         		if (!UartTransmitA(20))
         		{
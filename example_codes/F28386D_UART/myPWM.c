@@ -102,6 +102,8 @@ void PwmInitPwm8(void)
 //=================================================================================================
 __interrupt void Pwm8ISR(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_PWM8);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -113,6 +115,10 @@ __interrupt void Pwm8ISR(void)
 
 		// Flag fr den Aufruf der Funktion "UartGetStatusRx()" setzen
 		uartFlagCheckRxA = true;
+		// Ende einer Sende-Kommunikation erkennen (blockiert nicht)
+		UartPollTxA();
+		// Streaming-Betrieb: Bytes unterhalb des Rx-Interrupt-Niveaus abholen
+		UartPollRxA();
 		// Timeout-Zhler herunterzhlen
 		if (uartRxTimeoutA > 0)
 		{
@@ -123,6 +129,7 @@ __interrupt void Pwm8ISR(void)
 		EPwm8Regs.ETCLR.bit.INT = 1;
     // Interrupt-Flag der Gruppe 3 lschen (da gehrt der ePMW8-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK3 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_PWM8);
 }
 
 
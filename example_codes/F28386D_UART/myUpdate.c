@@ -0,0 +1,641 @@
+//=================================================================================================
+/// @file       myUpdate.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein Firmware-Update ber die UART-
+///							Schnittstelle. Das Image wird schrittweise (ein Vorgang der FSM pro Aufruf von
+///							UpdateService(), mit gesperrten Interrupts) mit der Flash API in den nicht aktiven
+///							Slot geschrieben und nach der CRC-Prfung aktiv geschaltet (siehe myUpdate.h)
+///
+///							nderung in Version 1.1: Die Vorgnge der FSM laufen mit gesperrten Interrupts
+///							vollstndig im RAM ab (siehe myUpdate.h)
+///
+///							nderung in Version 1.2: Das residente Programm und der aktive Slot werden nie
+///							gelscht oder programmiert (UpdateRegionAllowed())
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myUpdate.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Code sections
+//-------------------------------------------------------------------------------------------------
+// Whrend die FSM Bank 0 lscht oder programmiert, darf nicht aus dem Flash gelesen werden.
+// Die Vorgnge werden daher im RAM gestartet und mit gesperrten Interrupts bis zum Ende der
+// FSM abgewartet. Die Flash API liegt ebenfalls in .TI.ramfunc (Linker-Befehlsdatei)
+#pragma CODE_SECTION(UpdateRegionAllowed, ".TI.ramfunc");
+#pragma CODE_SECTION(UpdateFsmWait, ".TI.ramfunc");
+#pragma CODE_SECTION(UpdateProgram, ".TI.ramfunc");
+#pragma CODE_SECTION(UpdateErase, ".TI.ramfunc");
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile uint16_t updateState = UPDATE_STATE_IDLE;
+uint16_t updateTargetSlot;
+uint32_t updateProgrammedWords;
+uint16_t updateFlashErrors;
+// Startadressen der Slots
+static const uint32_t updateSlotAddress[UPDATE_NUMBER_OF_SLOTS] =
+{
+		UPDATE_SLOT0_ADDRESS, UPDATE_SLOT1_ADDRESS
+};
+// Aktiver Boot-Datensatz und Adresse des nchsten freien Datensatzes im Sektor N
+static UpdateBootRecord updateActiveRecord;
+static uint32_t updateRecordAddress;
+static bool updateRecordErase;
+// Gre und CRC32 des laufenden Updates
+static uint32_t updateImageSize;
+static uint32_t updateImageCrc;
+// Nchster zu lschender Sektor
+static uint16_t updateEraseSector;
+// Datenwrter des letzten UPDATE_COMMAND_DATA-Rahmens, Zieladresse und programmierte Wrter
+static uint16_t updateData[UPDATE_MAX_DATA_WORDS];
+static uint32_t updateDataAddress;
+static uint16_t updateDataWords;
+static uint16_t updateDataIndex;
+// Offset des letzten Datenrahmens (fr die Antwort)
+static uint32_t updateDataOffset;
+// Neuer Boot-Datensatz (8 Wrter, wird als Ganzes programmiert)
+static uint16_t updateRecordBuffer[UPDATE_PROGRAM_WORDS];
+// Prfung des Images
+static CrcImageCheck updateCheck;
+// Empfangener Rahmen
+static TelemetryFrame updateFrame;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UpdateGetLong =====================================================================
+///
+/// @brief  Funktion setzt einen 32 Bit-Wert aus vier Bytes (Little-Endian, ein Byte pro Wort)
+///					zusammen
+///
+/// @param  const uint16_t *bytes
+///
+/// @return uint32_t value
+///
+//=================================================================================================
+static uint32_t UpdateGetLong(const uint16_t *bytes)
+{
+		return  ((uint32_t)(bytes[0] & 0x00FF))
+				 | ((uint32_t)(bytes[1] & 0x00FF) << 8)
+				 | ((uint32_t)(bytes[2] & 0x00FF) << 16)
+				 | ((uint32_t)(bytes[3] & 0x00FF) << 24);
+}
+
+
+//=== Function: UpdateSendAck =====================================================================
+///
+/// @brief  Funktion sendet die Antwort auf einen Befehl
+///
+/// @param  uint16_t command, uint16_t status, uint32_t offset
+///
+/// @return void
+///
+//=================================================================================================
+static void UpdateSendAck(uint16_t command, uint16_t status, uint32_t offset)
+{
+		uint16_t ack[7];
+
+		ack[0] = UPDATE_COMMAND_ACK;
+		ack[1] = command;
+		ack[2] = status;
+		ack[3] = offset & 0x00FF;
+		ack[4] = (offset >> 8) & 0x00FF;
+		ack[5] = (offset >> 16) & 0x00FF;
+		ack[6] = (offset >> 24) & 0x00FF;
+		TelemetrySendFrame(TELEMETRY_TYPE_UPDATE, ack, 7);
+}
+
+
+//=== Function: UpdateRegionAllowed ===============================================================
+///
+/// @brief  Funktion prft, ob der Bereich gelscht bzw. programmiert werden darf. Verweigert wird
+///					jeder Bereich, der das residente Programm (Sektoren A ... D) oder den aktiven Slot
+///					berschneidet (ohne Boot-Datensatz ist Slot 0 mit dem Auslieferungs-Image aktiv)
+///
+/// @param  uint32_t address, uint32_t words
+///
+/// @return bool allowed
+///
+//=================================================================================================
+static bool UpdateRegionAllowed(uint32_t address, uint32_t words)
+{
+		uint16_t activeSlot = (updateActiveRecord.key == UPDATE_RECORD_KEY) ? updateActiveRecord.slot : 0;
+		uint32_t activeAddress = updateSlotAddress[activeSlot];
+
+		if (   (address < UPDATE_RESIDENT_ADDRESS + UPDATE_RESIDENT_SIZE)
+				&& (address + words > UPDATE_RESIDENT_ADDRESS))
+		{
+				return false;
+		}
+		if (   (address < activeAddress + UPDATE_SLOT_SIZE)
+				&& (address + words > activeAddress))
+		{
+				return false;
+		}
+		return true;
+}
+
+
+//=== Function: UpdateFsmWait =====================================================================
+///
+/// @brief  Funktion wartet, bis die FSM den gestarteten Vorgang abgeschlossen hat. Wird nur aus
+///					UpdateProgram() und UpdateErase() mit gesperrten Interrupts aufgerufen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UpdateFsmWait(void)
+{
+		while (Fapi_checkFsmForReady() == Fapi_Status_FsmBusy)
+				;
+}
+
+
+//=== Function: UpdateFsmDone =====================================================================
+///
+/// @brief  Funktion gibt "true" zurck, wenn die FSM den letzten Vorgang abgeschlossen hat (nach
+///					UpdateProgram() und UpdateErase() immer der Fall). Ein Fehler des Vorgangs wird in
+///					"error" zurckgegeben
+///
+/// @param  bool *error
+///
+/// @return bool done
+///
+//=================================================================================================
+static bool UpdateFsmDone(bool *error)
+{
+		if (Fapi_checkFsmForReady() != Fapi_Status_FsmReady)
+		{
+				return false;
+		}
+		*error = (Fapi_getFsmStatus() != 0);
+		return true;
+}
+
+
+//=== Function: UpdateProgram =====================================================================
+///
+/// @brief  Funktion programmiert 8 Wrter (128 Bit, ECC wird von der FSM erzeugt) und kehrt erst
+///					nach dem Ende des Vorgangs zurck. Die Interrupts bleiben whrenddessen gesperrt, da
+///					die ISRs im Flash liegen. Die Adresse muss auf 8 Wrter ausgerichtet sein. Bereiche
+///					des residenten Programms und des aktiven Slots werden verweigert
+///
+/// @param  uint32_t address, uint16_t *data
+///
+/// @return bool started
+///
+//=================================================================================================
+static bool UpdateProgram(uint32_t address, uint16_t *data)
+{
+		Fapi_StatusType status;
+		uint16_t interruptState;
+
+		if (!UpdateRegionAllowed(address, UPDATE_PROGRAM_WORDS))
+		{
+				return false;
+		}
+		interruptState = __disable_interrupts();
+		EALLOW;
+		status = Fapi_issueProgrammingCommand((uint32 *)address, data, UPDATE_PROGRAM_WORDS,
+																					0, 0, Fapi_AutoEccGeneration);
+		if (status == Fapi_Status_Success)
+		{
+				UpdateFsmWait();
+		}
+		EDIS;
+		__restore_interrupts(interruptState);
+		return status == Fapi_Status_Success;
+}
+
+
+//=== Function: UpdateErase =======================================================================
+///
+/// @brief  Funktion lscht einen Sektor und kehrt erst nach dem Ende des Vorgangs zurck (bis zu
+///					einigen 100 ms bei 32K Wrtern, die Interrupts bleiben so lange gesperrt). Sektoren
+///					des residenten Programms und des aktiven Slots werden verweigert
+///
+/// @param  uint32_t address
+///
+/// @return bool started
+///
+//=================================================================================================
+static bool UpdateErase(uint32_t address)
+{
+		Fapi_StatusType status;
+		uint16_t interruptState;
+
+		if (!UpdateRegionAllowed(address, (address == UPDATE_RECORD_ADDRESS) ? UPDATE_RECORD_SECTOR_SIZE
+																																	: UPDATE_SECTOR_SIZE))
+		{
+				return false;
+		}
+		interruptState = __disable_interrupts();
+		EALLOW;
+		status = Fapi_issueAsyncCommandWithAddress(Fapi_EraseSector, (uint32 *)address);
+		if (status == Fapi_Status_Success)
+		{
+				UpdateFsmWait();
+		}
+		EDIS;
+		__restore_interrupts(interruptState);
+		return status == Fapi_Status_Success;
+}
+
+
+//=== Function: UpdateReadBootRecord ==============================================================
+///
+/// @brief  Funktion sucht den letzten gltigen Boot-Datensatz in Sektor N und die Adresse des
+///					nchsten freien Datensatzes. Ohne gltigen Datensatz ist Slot 0 aktiv
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UpdateReadBootRecord(void)
+{
+		uint32_t address = UPDATE_RECORD_ADDRESS;
+		const UpdateBootRecord *record;
+
+		updateActiveRecord.key = 0;
+		updateActiveRecord.slot = 0;
+		updateActiveRecord.sequence = 0;
+		updateActiveRecord.sequenceInverted = 0xFFFF;
+		updateActiveRecord.size = 0;
+		updateActiveRecord.crc = 0;
+
+		while (address < UPDATE_RECORD_ADDRESS + UPDATE_RECORD_SECTOR_SIZE)
+		{
+				record = (const UpdateBootRecord *)address;
+				// Gelschter Bereich: Ende der Datenstze
+				if (record->key == 0xFFFF)
+				{
+						break;
+				}
+				if (   (record->key == UPDATE_RECORD_KEY)
+						&& (record->sequenceInverted == (uint16_t)~record->sequence)
+						&& (record->slot < UPDATE_NUMBER_OF_SLOTS))
+				{
+						updateActiveRecord = *record;
+				}
+				address += UPDATE_PROGRAM_WORDS;
+		}
+		updateRecordAddress = address;
+}
+
+
+//=== Function: UpdateHandleFrame =================================================================
+///
+/// @brief  Funktion bearbeitet einen empfangenen Update-Rahmen und startet ggf. den ersten
+///					Vorgang im Flash. Die Antwort wird erst gesendet, wenn der Vorgang abgeschlossen ist
+///
+/// @param  const TelemetryFrame *frame
+///
+/// @return void
+///
+//=================================================================================================
+static void UpdateHandleFrame(const TelemetryFrame *frame)
+{
+		uint16_t command = frame->data[0];
+		uint16_t i;
+
+		if (frame->length < 1)
+		{
+				return;
+		}
+
+		switch (command)
+		{
+				case UPDATE_COMMAND_START:
+						updateImageSize = UpdateGetLong(&frame->data[1]);
+						updateImageCrc = UpdateGetLong(&frame->data[5]);
+						if (   (frame->length != 9) || (updateImageSize == 0)
+								|| (updateImageSize > UPDATE_SLOT_SIZE))
+						{
+								UpdateSendAck(command, UPDATE_STATUS_INVALID, 0);
+								return;
+						}
+						// Immer den nicht aktiven Slot beschreiben
+						updateTargetSlot = (updateActiveRecord.key == UPDATE_RECORD_KEY)
+															 ? (updateActiveRecord.slot ^ 1) : 1;
+						updateProgrammedWords = 0;
+						updateEraseSector = 0;
+						if (!UpdateErase(updateSlotAddress[updateTargetSlot]))
+						{
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(command, UPDATE_STATUS_FLASH_ERROR, 0);
+								return;
+						}
+						updateState = UPDATE_STATE_ERASING;
+						break;
+
+				case UPDATE_COMMAND_DATA:
+						updateDataOffset = UpdateGetLong(&frame->data[1]);
+						updateDataWords = (frame->length - 5) / 2;
+						if (   (updateState != UPDATE_STATE_RECEIVING) || (frame->length < 5)
+								|| ((frame->length - 5) & 1) || (updateDataWords > UPDATE_MAX_DATA_WORDS)
+								|| (updateDataWords % UPDATE_PROGRAM_WORDS) || (updateDataOffset % UPDATE_PROGRAM_WORDS)
+								|| (updateDataOffset + updateDataWords > UPDATE_SLOT_SIZE))
+						{
+								UpdateSendAck(command, UPDATE_STATUS_INVALID, updateDataOffset);
+								return;
+						}
+						for (i = 0; i < updateDataWords; i++)
+						{
+								updateData[i] = (frame->data[5 + 2 * i] & 0x00FF)
+															| ((frame->data[6 + 2 * i] & 0x00FF) << 8);
+						}
+						updateDataAddress = updateSlotAddress[updateTargetSlot] + updateDataOffset;
+						updateDataIndex = 0;
+						if (updateDataWords == 0)
+						{
+								UpdateSendAck(command, UPDATE_STATUS_OK, updateDataOffset);
+								return;
+						}
+						if (!UpdateProgram(updateDataAddress, &updateData[0]))
+						{
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(command, UPDATE_STATUS_FLASH_ERROR, updateDataOffset);
+								return;
+						}
+						updateState = UPDATE_STATE_PROGRAMMING;
+						break;
+
+				case UPDATE_COMMAND_FINISH:
+						if (updateState != UPDATE_STATE_RECEIVING)
+						{
+								UpdateSendAck(command, UPDATE_STATUS_INVALID, 0);
+								return;
+						}
+						CrcImageStart(&updateCheck, CRC_TYPE_32,
+													(const uint16_t *)updateSlotAddress[updateTargetSlot],
+													updateImageSize, UPDATE_CRC_INIT, updateImageCrc);
+						updateState = UPDATE_STATE_VERIFYING;
+						break;
+
+				case UPDATE_COMMAND_ABORT:
+						// Der aktive Slot bleibt unverndert
+						updateState = UPDATE_STATE_IDLE;
+						UpdateSendAck(command, UPDATE_STATUS_OK, 0);
+						break;
+
+				default:
+						UpdateSendAck(command, UPDATE_STATUS_INVALID, 0);
+						break;
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UpdateInit ========================================================================
+///
+/// @brief  Funktion bernimmt die Flash-Pumpe fr CPU1, initialisiert die Flash API fr Bank 0
+///					und liest den aktiven Slot aus dem Boot-Datensatz. "UartStartStreamA()" und
+///					"TelemetryInit()" mssen vorher aufgerufen worden sein
+///
+/// @param  void
+///
+/// @return bool success
+///
+//=================================================================================================
+bool UpdateInit(void)
+{
+		Fapi_StatusType status;
+
+		updateState = UPDATE_STATE_IDLE;
+		updateTargetSlot = 0;
+		updateProgrammedWords = 0;
+		updateFlashErrors = 0;
+
+		EALLOW;
+		// Flash-Pumpe fr CPU1 anfordern (Semaphore zwischen CPU1 und CPU2)
+		FlashPumpSemaphoreRegs.PUMPREQUEST.all = 0x5A5A0002UL;
+		status = Fapi_initializeAPI(FlashTech_CPU0_BASE_ADDRESS, DEVICE_SYSCLK_MHZ);
+		if (status == Fapi_Status_Success)
+		{
+				status = Fapi_setActiveFlashBank(Fapi_FlashBank0);
+		}
+		EDIS;
+
+		UpdateReadBootRecord();
+		return status == Fapi_Status_Success;
+}
+
+
+//=== Function: UpdateService =====================================================================
+///
+/// @brief  Funktion fhrt den nchsten Schritt des Updates aus (einen Sektor lschen bzw. 8 Wrter
+///					programmieren und prfen) und blockiert fr die Dauer dieses Vorgangs (siehe
+///					UpdateErase() und UpdateProgram()). Ist kein Vorgang aktiv, wird der
+///					nchste empfangene Update-Rahmen bearbeitet (Rahmen anderer Typen werden verworfen).
+///					Die CRC-Prfung erfolgt blockweise (CRC_IMAGE_BLOCK_WORDS pro Aufruf)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void UpdateService(void)
+{
+		bool error = false;
+		uint16_t i;
+
+		switch (updateState)
+		{
+				case UPDATE_STATE_ERASING:
+						if (!UpdateFsmDone(&error))
+						{
+								return;
+						}
+						if (error)
+						{
+								updateFlashErrors++;
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(UPDATE_COMMAND_START, UPDATE_STATUS_FLASH_ERROR, 0);
+								return;
+						}
+						// Nchster Sektor des Slots
+						if (++updateEraseSector < UPDATE_SECTORS_PER_SLOT)
+						{
+								if (!UpdateErase(updateSlotAddress[updateTargetSlot]
+																 + updateEraseSector * UPDATE_SECTOR_SIZE))
+								{
+										updateState = UPDATE_STATE_ERROR;
+										UpdateSendAck(UPDATE_COMMAND_START, UPDATE_STATUS_FLASH_ERROR, 0);
+								}
+								return;
+						}
+						updateState = UPDATE_STATE_RECEIVING;
+						UpdateSendAck(UPDATE_COMMAND_START, UPDATE_STATUS_OK, 0);
+						return;
+
+				case UPDATE_STATE_PROGRAMMING:
+						if (!UpdateFsmDone(&error))
+						{
+								return;
+						}
+						// Programmierte Wrter zurcklesen
+						for (i = 0; i < UPDATE_PROGRAM_WORDS; i++)
+						{
+								if (*(volatile uint16_t *)(updateDataAddress + updateDataIndex + i)
+										!= updateData[updateDataIndex + i])
+								{
+										error = true;
+								}
+						}
+						if (error)
+						{
+								updateFlashErrors++;
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(UPDATE_COMMAND_DATA, UPDATE_STATUS_FLASH_ERROR, updateDataOffset);
+								return;
+						}
+						updateProgrammedWords += UPDATE_PROGRAM_WORDS;
+						updateDataIndex += UPDATE_PROGRAM_WORDS;
+						if (updateDataIndex < updateDataWords)
+						{
+								if (!UpdateProgram(updateDataAddress + updateDataIndex, &updateData[updateDataIndex]))
+								{
+										updateState = UPDATE_STATE_ERROR;
+										UpdateSendAck(UPDATE_COMMAND_DATA, UPDATE_STATUS_FLASH_ERROR, updateDataOffset);
+								}
+								return;
+						}
+						updateState = UPDATE_STATE_RECEIVING;
+						UpdateSendAck(UPDATE_COMMAND_DATA, UPDATE_STATUS_OK, updateDataOffset);
+						return;
+
+				case UPDATE_STATE_VERIFYING:
+						i = CrcImageService(&updateCheck);
+						if (i == CRC_IMAGE_BUSY)
+						{
+								return;
+						}
+						if (i == CRC_IMAGE_FAILED)
+						{
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(UPDATE_COMMAND_FINISH, UPDATE_STATUS_CRC_ERROR, 0);
+								return;
+						}
+						// Neuen Boot-Datensatz vorbereiten, bei vollem Sektor zuerst lschen
+						updateRecordBuffer[0] = UPDATE_RECORD_KEY;
+						updateRecordBuffer[1] = updateTargetSlot;
+						updateRecordBuffer[2] = updateActiveRecord.sequence + 1;
+						updateRecordBuffer[3] = (uint16_t)~updateRecordBuffer[2];
+						updateRecordBuffer[4] = updateImageSize & 0xFFFF;
+						updateRecordBuffer[5] = updateImageSize >> 16;
+						updateRecordBuffer[6] = updateImageCrc & 0xFFFF;
+						updateRecordBuffer[7] = updateImageCrc >> 16;
+						updateRecordErase = (updateRecordAddress >= UPDATE_RECORD_ADDRESS + UPDATE_RECORD_SECTOR_SIZE);
+						if (updateRecordErase ? !UpdateErase(UPDATE_RECORD_ADDRESS)
+																	: !UpdateProgram(updateRecordAddress, updateRecordBuffer))
+						{
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(UPDATE_COMMAND_FINISH, UPDATE_STATUS_FLASH_ERROR, 0);
+								return;
+						}
+						updateState = UPDATE_STATE_COMMITTING;
+						return;
+
+				case UPDATE_STATE_COMMITTING:
+						if (!UpdateFsmDone(&error))
+						{
+								return;
+						}
+						if (!error && updateRecordErase)
+						{
+								// Sektor gelscht, Datensatz an den Anfang schreiben
+								updateRecordErase = false;
+								updateRecordAddress = UPDATE_RECORD_ADDRESS;
+								if (UpdateProgram(updateRecordAddress, updateRecordBuffer))
+								{
+										return;
+								}
+								error = true;
+						}
+						if (error)
+						{
+								updateFlashErrors++;
+								updateState = UPDATE_STATE_ERROR;
+								UpdateSendAck(UPDATE_COMMAND_FINISH, UPDATE_STATUS_FLASH_ERROR, 0);
+								return;
+						}
+						// Der neue Slot ist ab dem nchsten Start aktiv
+						UpdateReadBootRecord();
+						updateState = UPDATE_STATE_DONE;
+						UpdateSendAck(UPDATE_COMMAND_FINISH, UPDATE_STATUS_OK, 0);
+						return;
+
+				default:
+						// Kein Vorgang aktiv: nchsten Rahmen bearbeiten
+						if (TelemetryReceiveFrame(&updateFrame) && (updateFrame.type == TELEMETRY_TYPE_UPDATE))
+						{
+								UpdateHandleFrame(&updateFrame);
+						}
+						return;
+		}
+}
+
+
+//=== Function: UpdateGetActiveSlot ===============================================================
+///
+/// @brief  Funktion gibt den aktiven Slot zurck (letzter gltiger Boot-Datensatz, ohne Datensatz
+///					Slot 0)
+///
+/// @param  void
+///
+/// @return uint16_t slot
+///
+//=================================================================================================
+uint16_t UpdateGetActiveSlot(void)
+{
+		return updateActiveRecord.slot;
+}
+
+
+//=== Function: UpdateBootActiveSlot ==============================================================
+///
+/// @brief  Funktion prft die CRC32 des Images im aktiven Slot und springt an dessen Startadresse.
+///					Ohne Boot-Datensatz (noch kein Update) wird das Auslieferungs-Image in Slot 0
+///					gestartet. Kehrt nur zurck (false), wenn die CRC des aktiven Slots falsch ist
+///
+/// @param  void
+///
+/// @return bool (nur false)
+///
+//=================================================================================================
+bool UpdateBootActiveSlot(void)
+{
+		void (*entry)(void);
+
+		UpdateReadBootRecord();
+		if (updateActiveRecord.key != UPDATE_RECORD_KEY)
+		{
+				// Noch kein Update: Auslieferungs-Image in Slot 0
+				entry = (void (*)(void))UPDATE_SLOT0_ADDRESS;
+				entry();
+		}
+		if (CrcImageVerify(CRC_TYPE_32, (const uint16_t *)updateSlotAddress[updateActiveRecord.slot],
+											 updateActiveRecord.size, UPDATE_CRC_INIT, updateActiveRecord.crc))
+		{
+				entry = (void (*)(void))updateSlotAddress[updateActiveRecord.slot];
+				entry();
+		}
+		return false;
+}
@@ -0,0 +1,153 @@
+//=================================================================================================
+/// @file       myUpdate.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein Firmware-Update ber die UART-
+///							Schnittstelle ohne CCS. Die Befehle werden als Telemetrie-Rahmen
+///							(TELEMETRY_TYPE_UPDATE, myTelemetry.h, COBS und CRC16) bertragen, das erste
+///							Nutzdaten-Byte ist der Befehl. Der Flash von CPU1 (Bank 0) ist in zwei Slots fr
+///							Anwendungs-Images und einen Sektor fr den Boot-Datensatz geteilt:
+///							- Slot 0: Sektoren E ... G (0x088000 ... 0x09FFFF)
+///							- Slot 1: Sektoren H ... J (0x0A0000 ... 0x0B7FFF)
+///							- Boot-Datensatz: Sektor N (0x0BE000 ... 0x0BFFFF)
+///							Das neue Image wird immer in den nicht aktiven Slot geschrieben. Erst nach der
+///							Prfung der CRC32 (myCRC.h) ber den ganzen Slot wird ein neuer Boot-Datensatz
+///							angehngt, der den Slot aktiv schaltet. Ein abgebrochenes Update lsst das aktive
+///							Image unverndert.
+///
+///							Ablauf (Host -> CPU1, jede Antwort ist ein UPDATE_COMMAND_ACK-Rahmen):
+///							1) UPDATE_COMMAND_START | Gre in Wrtern (4 Byte) | CRC32 (4 Byte)
+///							   Lscht den nicht aktiven Slot (ein Sektor pro Schritt)
+///							2) UPDATE_COMMAND_DATA | Offset in Wrtern (4 Byte) | Daten (max. 128 Byte)
+///							   Offset und Lnge mssen ein Vielfaches von 8 Wrtern (128 Bit, ECC) sein
+///							3) UPDATE_COMMAND_FINISH
+///							   Prft die CRC32 und schaltet den Slot aktiv (Bankwechsel beim nchsten Start)
+///							Antwort: UPDATE_COMMAND_ACK | Befehl | Status (UPDATE_STATUS_*) | Offset (4 Byte)
+///
+///							Das Lschen und Programmieren erfolgt mit der Flash API (F021, C2000Ware) in
+///							Schritten: UpdateService() fhrt pro Aufruf einen Vorgang des Flash-
+///							Zustandsautomaten (FSM) aus (einen Sektor lschen bzw. 8 Wrter programmieren).
+///							Whrend die FSM arbeitet, darf Bank 0 nicht gelesen werden. Der Vorgang wird
+///							daher im RAM gestartet und mit gesperrten Interrupts bis zum Ende der FSM
+///							abgewartet (UpdateErase(), UpdateProgram()), Hauptprogramm und ISRs bleiben im
+///							Flash. Die ISRs ruhen fr die Dauer eines Vorgangs (beim Lschen eines Sektors
+///							bis zu einigen 100 ms), das Update ist daher nur in einem sicheren Zustand der
+///							Anwendung zulssig. Die Flash API Bibliothek (FAPI_F2838x_EABI) muss dem Projekt
+///							hinzugefgt werden, die Linker-Befehlsdatei legt sie in .TI.ramfunc.
+///
+///							nderung in Version 1.1: Vorgnge der FSM blockierend im RAM mit gesperrten
+///							Interrupts, Flash API in .TI.ramfunc
+///
+///							Der Start aus dem aktiven Slot erfolgt mit UpdateBootActiveSlot() (z.B. in einem
+///							kleinen residenten Boot-Programm in den Sektoren A ... D). Die Images mssen fr
+///							die Startadresse ihres Slots gelinkt sein.
+///
+///							nderung in Version 1.2: Das residente Programm (F28386D_UART) liegt nur in den
+///							Sektoren A ... D (Linker-Befehlsdatei), die Slots berschneiden sich nicht mit ihm.
+///							UpdateErase() und UpdateProgram() verweigern jeden Sektor des residenten Programms
+///							und des aktiven Slots (UpdateRegionAllowed())
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYUPDATE_H_
+#define MYUPDATE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myTelemetry.h"
+#include "myCRC.h"
+#include "F021_F2838x_C28x.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Residentes Programm (Sektoren A ... D), wird nie gelscht oder programmiert
+#define UPDATE_RESIDENT_ADDRESS							0x080000UL
+#define UPDATE_RESIDENT_SIZE								0x008000UL
+// Slots der Anwendungs-Images (Startadresse, Anzahl und Gre der Sektoren in Wrtern)
+#define UPDATE_NUMBER_OF_SLOTS							2
+#define UPDATE_SLOT0_ADDRESS								0x088000UL
+#define UPDATE_SLOT1_ADDRESS								0x0A0000UL
+#define UPDATE_SECTORS_PER_SLOT							3
+#define UPDATE_SECTOR_SIZE									0x8000UL
+#define UPDATE_SLOT_SIZE										(UPDATE_SECTORS_PER_SLOT * UPDATE_SECTOR_SIZE)
+// Sektor des Boot-Datensatzes (Sektor N, 8K Wrter)
+#define UPDATE_RECORD_ADDRESS								0x0BE000UL
+#define UPDATE_RECORD_SECTOR_SIZE						0x2000UL
+// Kennung eines gltigen Boot-Datensatzes
+#define UPDATE_RECORD_KEY										0x5AA5
+// Wrter pro Programmiervorgang (128 Bit mit ECC)
+#define UPDATE_PROGRAM_WORDS								8
+// Max. Datenwrter pro UPDATE_COMMAND_DATA-Rahmen
+#define UPDATE_MAX_DATA_WORDS								64
+// Startwert der CRC32 der Images
+#define UPDATE_CRC_INIT											0xFFFFFFFFUL
+// Befehle (erstes Nutzdaten-Byte)
+#define UPDATE_COMMAND_START								1
+#define UPDATE_COMMAND_DATA									2
+#define UPDATE_COMMAND_FINISH								3
+#define UPDATE_COMMAND_ABORT								4
+#define UPDATE_COMMAND_ACK									0x80
+// Status der Antwort
+#define UPDATE_STATUS_OK										0
+#define UPDATE_STATUS_BUSY									1
+#define UPDATE_STATUS_INVALID								2
+#define UPDATE_STATUS_FLASH_ERROR						3
+#define UPDATE_STATUS_CRC_ERROR							4
+// Zustand des Updates
+#define UPDATE_STATE_IDLE										0
+#define UPDATE_STATE_ERASING								1
+#define UPDATE_STATE_RECEIVING							2
+#define UPDATE_STATE_PROGRAMMING						3
+#define UPDATE_STATE_VERIFYING							4
+#define UPDATE_STATE_COMMITTING							5
+#define UPDATE_STATE_DONE										6
+#define UPDATE_STATE_ERROR									7
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Boot-Datensatz (8 Wrter = ein Programmiervorgang). Der letzte gltige Datensatz im Sektor
+// bestimmt den aktiven Slot
+typedef struct
+{
+		uint16_t key;																	// UPDATE_RECORD_KEY
+		uint16_t slot;																// aktiver Slot
+		uint16_t sequence;														// Nummer des Updates
+		uint16_t sequenceInverted;										// ~sequence (Prfung)
+		uint32_t size;																// Gre des Images in Wrtern
+		uint32_t crc;																	// CRC32 des Images
+} UpdateBootRecord;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Zustand des Updates (UPDATE_STATE_*) und Slot, in den geschrieben wird
+extern volatile uint16_t updateState;
+extern uint16_t updateTargetSlot;
+// Programmierte Wrter des laufenden Updates und Anzahl der Flash-Fehler
+extern uint32_t updateProgrammedWords;
+extern uint16_t updateFlashErrors;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die Flash API und liest den aktiven Slot aus dem Boot-Datensatz
+extern bool UpdateInit(void);
+// Funktion bearbeitet empfangene Update-Rahmen und den nchsten Schritt im Flash
+// (im Hauptprogramm zyklisch aufrufen)
+extern void UpdateService(void);
+// Funktion gibt den aktiven Slot zurck (letzter gltiger Boot-Datensatz)
+extern uint16_t UpdateGetActiveSlot(void);
+// Funktion prft das Image des aktiven Slots und springt an dessen Startadresse
+extern bool UpdateBootActiveSlot(void);
+
+
+#endif
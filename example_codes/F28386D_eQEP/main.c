@@ -0,0 +1,77 @@
+//=================================================================================================
+/// @file			main.c
+///
+/// @brief		Enthlt das Hauptprogramm zur Demonstration des Moduls "myEQEP.c". Das eQEP1-Modul
+///						erfasst Position und Drehzahl eines Inkrementalgebers an GPIO 20 bis 23 ohne
+///						CPU-Last pro Flanke. Die Ergebnisse stehen nach jedem Regelzyklus (Unit-Timer,
+///						10 kHz) in der Variable "eqepControl" (z.B. im Debugger ansehen). Erklrungen
+///						zur genauen Funktion sind im Modul zu finden.
+///
+/// @version	V1.0
+///
+/// @date			14.10.2026
+///
+/// @author		Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myEQEP.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Neues Homing anfordern (z.B. im Debugger auf 1 setzen)
+volatile uint16_t eqepHomingRequest = 0;
+
+
+//=== Function: main ==============================================================================
+///
+/// @brief  Hauptprogramm
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void main(void)
+{
+		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
+		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
+
+#ifdef _FLASH
+		// Ausfhrungsgeschwindigkeit aus dem Flash fr das gewhlte Flash-Profil sowie ohne
+		// ECC, ohne Cache/Prefetch und mit einem zustzlichen Wartezustand messen
+		// (Ergebnisse in "deviceFlashBenchmark", z.B. im Debugger ansehen)
+		DeviceBenchmarkFlash();
+#endif
+
+		// eQEP1-Modul initialisieren, der erste Indeximpuls setzt die Position auf 0
+		EqepInit();
+
+    // Register-Schreibschutz ausschalten
+    EALLOW;
+
+		// Dauerschleife Hauptprogramm
+    while(1)
+    {
+    		// Position und Drehzahl werden im Regel-Interrupt erfasst
+    		if (eqepHomingRequest)
+    		{
+    				eqepHomingRequest = 0;
+    				EqepStartHoming();
+    		}
+    }
+}
+
@@ -0,0 +1,255 @@
+//=================================================================================================
+/// @file       myEQEP.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die Position und Drehzahl eines
+///							Inkrementalgebers mit dem eQEP1-Modul des TMS320F2838x zu erfassen. Der
+///							Unit-Timer des Moduls gibt den Regelzyklus vor, die Ergebnisse jedes Zyklus
+///							werden in "eqepControl" geschrieben (siehe myEQEP.h)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myEQEP.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+#define EQEP_TWO_PI											6.283185307f
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+volatile EqepControlData eqepControl;
+// Gelatchte Position des vorherigen Regelzyklus
+static uint32_t eqepLastPosition;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EqepInit ==========================================================================
+///
+/// @brief  Funktion initialisiert GPIO 20 bis 23 und das eQEP1-Modul: Quadraturzhlung mit
+///					Rcksetzen bei EQEP_COUNTS_PER_REVOLUTION, Homing ber den Index, Unit-Timer mit
+///					EQEP_CONTROL_FREQUENCY_HZ als Regel-Interrupt (INT5.1), Capture-Unit fr kleine
+///					Drehzahlen und Positionsvergleich mit Ausgang auf EQEP1S
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EqepInit(void)
+{
+		eqepControl.position = 0;
+		eqepControl.angle = 0.0f;
+		eqepControl.deltaCounts = 0;
+		eqepControl.speedHighRpm = 0.0f;
+		eqepControl.speedLowRpm = 0.0f;
+		eqepControl.speedRpm = 0.0f;
+		eqepControl.homed = false;
+		eqepControl.forward = true;
+		eqepControl.cycles = 0;
+		eqepControl.errors = 0;
+		eqepLastPosition = 0;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// GPIO 20 bis 23 auf EQEP1A, EQEP1B, EQEP1S und EQEP1I setzen
+		// (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		GpioCtrlRegs.GPALOCK.bit.GPIO20 = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO21 = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO22 = 0;
+		GpioCtrlRegs.GPALOCK.bit.GPIO23 = 0;
+		GpioCtrlRegs.GPAGMUX2.bit.GPIO20 = (1 >> 2);
+		GpioCtrlRegs.GPAMUX2.bit.GPIO20  = (1 & 0x03);
+		GpioCtrlRegs.GPAGMUX2.bit.GPIO21 = (1 >> 2);
+		GpioCtrlRegs.GPAMUX2.bit.GPIO21  = (1 & 0x03);
+		GpioCtrlRegs.GPAGMUX2.bit.GPIO22 = (1 >> 2);
+		GpioCtrlRegs.GPAMUX2.bit.GPIO22  = (1 & 0x03);
+		GpioCtrlRegs.GPAGMUX2.bit.GPIO23 = (1 >> 2);
+		GpioCtrlRegs.GPAMUX2.bit.GPIO23  = (1 & 0x03);
+		// Pull-Up-Widerstnde der Gebereingnge aktivieren
+		GpioCtrlRegs.GPAPUD.bit.GPIO20 = 0;
+		GpioCtrlRegs.GPAPUD.bit.GPIO21 = 0;
+		GpioCtrlRegs.GPAPUD.bit.GPIO23 = 0;
+		// Gebereingnge mit 3 Abtastungen filtern (Strimpulse auf langen Leitungen)
+		GpioCtrlRegs.GPAQSEL2.bit.GPIO20 = 1;
+		GpioCtrlRegs.GPAQSEL2.bit.GPIO21 = 1;
+		GpioCtrlRegs.GPAQSEL2.bit.GPIO23 = 1;
+
+    // Takt fr das eQEP1-Modul einschalten und 5 Takte
+    // warten, bis der Takt zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR4.bit.EQEP1 = 1;
+    __asm(" RPT #4 || NOP");
+
+		// Modul whrend der Konfiguration anhalten
+		EQep1Regs.QEPCTL.all = 0;
+		EQep1Regs.QEINT.all = 0;
+		EQep1Regs.QCLR.all = 0xFFFF;
+
+		// Dekoder: Quadratur, Strobe-Pin als Ausgang des Positionsvergleichs
+		// 0: Quadraturzhlung
+		// 1: Richtung/Takt
+		// 2: Nur aufwrts
+		// 3: Nur abwrts
+		EQep1Regs.QDECCTL.all = 0;
+		EQep1Regs.QDECCTL.bit.QSRC = EQEP_QSRC_QUADRATURE;
+		EQep1Regs.QDECCTL.bit.SOEN = 1;
+		EQep1Regs.QDECCTL.bit.SPSEL = 1;
+
+		// Positionszhler: 0 ... EQEP_COUNTS_PER_REVOLUTION - 1
+		EQep1Regs.QPOSINIT = 0;
+		EQep1Regs.QPOSMAX = EQEP_COUNTS_PER_REVOLUTION - 1;
+		EQep1Regs.QPOSCNT = 0;
+
+		// Unit-Timer: Periode eines Regelzyklus in SYSCLK-Takten
+		EQep1Regs.QUPRD = EQEP_UNIT_PERIOD;
+
+		// Capture-Unit: Zeit zwischen 2^UPPS Zhlschritten in Takten von SYSCLK / 2^CCPS
+		EQep1Regs.QCAPCTL.bit.CEN = 0;
+		EQep1Regs.QCAPCTL.bit.CCPS = EQEP_CCPS;
+		EQep1Regs.QCAPCTL.bit.UPPS = EQEP_UPPS;
+		EQep1Regs.QCAPCTL.bit.CEN = 1;
+
+		// Positionsvergleich: Impuls auf EQEP1S bei EQEP_COMPARE_POSITION
+		EQep1Regs.QPOSCTL.all = 0;
+		EQep1Regs.QPOSCMP = EQEP_COMPARE_POSITION;
+		EQep1Regs.QPOSCTL.bit.PCSPW = EQEP_COMPARE_PULSE_WIDTH;
+		EQep1Regs.QPOSCTL.bit.PCPOL = 0;						// aktiv high
+		EQep1Regs.QPOSCTL.bit.PCSHDW = 0;						// QPOSCMP sofort bernehmen
+		EQep1Regs.QPOSCTL.bit.PCE = 1;
+
+		// Steuerung
+		// FREE_SOFT = 2: Zhler laufen beim Anhalten im Debugger weiter
+		// PCRM = 1: Rcksetzen bei QPOSMAX
+		// IEI = 2: Positionszhler bei steigender Indexflanke auf QPOSINIT setzen (Homing)
+		// IEL = 1: Position bei steigender Indexflanke latchen (QPOSILAT, Flag IEL)
+		// QCLM = 1: Position und Capture-Werte beim Ablauf des Unit-Timers latchen
+		// UTE = 1: Unit-Timer einschalten
+		EQep1Regs.QEPCTL.bit.FREE_SOFT = 2;
+		EQep1Regs.QEPCTL.bit.PCRM = EQEP_PCRM_MAXIMUM;
+		EQep1Regs.QEPCTL.bit.IEI = EQEP_IEI_RISING_EDGE;
+		EQep1Regs.QEPCTL.bit.IEL = 1;
+		EQep1Regs.QEPCTL.bit.QCLM = 1;
+		EQep1Regs.QEPCTL.bit.UTE = 1;
+		EQep1Regs.QEPCTL.bit.QPEN = 1;
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// Regel-Interrupt beim Ablauf des Unit-Timers (INT5.1)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieVectTable.EQEP1_INT = &EqepControlISR;
+		PieCtrlRegs.PIEIER5.bit.INTx1 = 1;
+		IER |= M_INT5;
+		EQep1Regs.QEINT.bit.UTO = 1;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		EDIS;
+}
+
+//=== Function: EqepStartHoming ===================================================================
+///
+/// @brief  Funktion startet ein neues Homing: Der nchste Indeximpuls setzt den Positionszhler
+///					auf 0, danach ist "eqepControl.homed" wieder true
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EqepStartHoming(void)
+{
+		// Die eQEP-Register sind nicht schreibgeschtzt (kein EALLOW ntig)
+		EQep1Regs.QCLR.bit.IEL = 1;
+		EQep1Regs.QEPCTL.bit.IEI = EQEP_IEI_RISING_EDGE;
+		eqepControl.homed = false;
+}
+
+//=== Function: EqepControlISR ====================================================================
+///
+/// @brief  ISR wird beim Ablauf des Unit-Timers aufgerufen (Regelzyklus). Position und Capture-
+///					Periode wurden von der Hardware zum selben Zeitpunkt gelatcht (QPOSLAT, QCPRDLAT).
+///					Die Drehzahl wird bei hohen Drehzahlen aus der Positionsnderung und bei wenigen
+///					Zhlschritten pro Zyklus aus der Capture-Periode berechnet. Nach dem ersten
+///					Indeximpuls wird die Initialisierung durch den Index ausgeschaltet (Homing fertig)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void EqepControlISR(void)
+{
+		uint32_t position = EQep1Regs.QPOSLAT;
+		uint16_t period = EQep1Regs.QCPRDLAT;
+		int32_t delta = (int32_t)position - (int32_t)eqepLastPosition;
+		bool forward = EQep1Regs.QEPSTS.bit.QDF == 1;
+		float speedLow = 0.0f;
+
+		eqepLastPosition = position;
+
+		// Homing: Der Positionszhler wurde durch den Index gesetzt, die Differenz ist ungltig
+		if (EQep1Regs.QFLG.bit.IEL)
+		{
+				EQep1Regs.QEPCTL.bit.IEI = EQEP_IEI_NOTHING;
+				EQep1Regs.QCLR.bit.IEL = 1;
+				eqepControl.homed = true;
+				delta = 0;
+		}
+
+		// berlauf bei QPOSMAX (krzester Weg)
+		if (delta > (int32_t)(EQEP_COUNTS_PER_REVOLUTION / 2))
+				delta -= EQEP_COUNTS_PER_REVOLUTION;
+		else if (delta < -(int32_t)(EQEP_COUNTS_PER_REVOLUTION / 2))
+				delta += EQEP_COUNTS_PER_REVOLUTION;
+
+		// Capture-Unit: ungltig bei berlauf des Capture-Timers (Stillstand) oder
+		// Richtungswechsel whrend der Messung
+		if (EQep1Regs.QEPSTS.bit.COEF || EQep1Regs.QEPSTS.bit.CDEF)
+		{
+				EQep1Regs.QEPSTS.all = 0x000C;			// COEF und CDEF lschen (write 1 to clear)
+		}
+		else if (period != 0)
+		{
+				speedLow = (float)EQEP_UPPS_COUNTS * EQEP_CAPTURE_CLOCK_HZ * 60.0f
+								 / ((float)period * EQEP_COUNTS_PER_REVOLUTION);
+				if (!forward)
+						speedLow = -speedLow;
+		}
+
+		if (EQep1Regs.QFLG.bit.PHE)
+		{
+				eqepControl.errors++;
+				EQep1Regs.QCLR.bit.PHE = 1;
+		}
+
+		eqepControl.position = position;
+		eqepControl.angle = (float)position * (EQEP_TWO_PI / EQEP_COUNTS_PER_REVOLUTION);
+		eqepControl.deltaCounts = delta;
+		eqepControl.speedHighRpm = (float)delta * (EQEP_CONTROL_FREQUENCY_HZ * 60.0f)
+														 / EQEP_COUNTS_PER_REVOLUTION;
+		eqepControl.speedLowRpm = speedLow;
+		eqepControl.speedRpm = (delta < EQEP_LOW_SPEED_COUNTS && delta > -EQEP_LOW_SPEED_COUNTS)
+												 ? speedLow : eqepControl.speedHighRpm;
+		eqepControl.forward = forward;
+		eqepControl.cycles++;
+
+		// Hier kann der Regler mit "eqepControl" aufgerufen werden
+
+    // Interrupt-Flags im eQEP1-Modul lschen
+		EQep1Regs.QCLR.bit.UTO = 1;
+		EQep1Regs.QCLR.bit.INT = 1;
+    // Interrupt der Gruppe 5 besttigen (da gehrt der eQEP1-Interrupt zu)
+    PieCtrlRegs.PIEACK.bit.ACK5 = 1;
+}
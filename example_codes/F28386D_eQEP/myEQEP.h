@@ -0,0 +1,107 @@
+//=================================================================================================
+/// @file       myEQEP.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die Position und Drehzahl eines
+///							Inkrementalgebers (Spuren A, B und Index) mit dem eQEP1-Modul des TMS320F2838x
+///							zu erfassen. Alle Flanken werden von der Hardware gezhlt, die CPU liest nur
+///							einmal pro Regelzyklus die gelatchten Werte:
+///							- Homing: Der erste Indeximpuls setzt den Positionszhler auf 0
+///							- Unit-Timer: Luft alle EQEP_CONTROL_FREQUENCY_HZ ab, latcht den
+///							  Positionszhler und die Capture-Werte und lst den Regel-Interrupt aus.
+///							  Die nderung der Position pro Zyklus ergibt die Drehzahl bei hohen Drehzahlen
+///							- Capture-Unit: Misst die Zeit zwischen EQEP_UPPS_COUNTS Zhlschritten und
+///							  liefert die Drehzahl bei kleinen Drehzahlen (wenige Flanken pro Zyklus)
+///							- Positionsvergleich: Bei EQEP_COMPARE_POSITION gibt das Modul einen Impuls
+///							  auf dem Strobe-Pin (EQEP1S) aus
+///							Die Ergebnisse stehen nach jedem Regel-Interrupt in "eqepControl"
+///
+///							Pins: GPIO 20 = EQEP1A, GPIO 21 = EQEP1B, GPIO 22 = EQEP1S (Vergleichsausgang),
+///							GPIO 23 = EQEP1I
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYEQEP_H_
+#define MYEQEP_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Strichzahl des Gebers, pro Strich werden 4 Flanken gezhlt
+#define EQEP_LINES											1024
+#define EQEP_COUNTS_PER_REVOLUTION			(4UL * EQEP_LINES)
+// Regelzyklus = Periode des Unit-Timers (SYSCLK)
+#define EQEP_CONTROL_FREQUENCY_HZ				10000UL
+#define EQEP_UNIT_PERIOD								(DEVICE_SYSCLK_MHZ * 1000000UL / EQEP_CONTROL_FREQUENCY_HZ)
+// Capture-Unit: Takt = SYSCLK / 2^EQEP_CCPS, ein Capture-Ereignis alle 2^EQEP_UPPS Zhlschritte
+#define EQEP_CCPS												7
+#define EQEP_UPPS												2
+#define EQEP_UPPS_COUNTS								(1UL << EQEP_UPPS)
+#define EQEP_CAPTURE_CLOCK_HZ						(DEVICE_SYSCLK_MHZ * 1000000.0f / (1UL << EQEP_CCPS))
+// Unterhalb dieser Zhlschritte pro Regelzyklus wird die Drehzahl der Capture-Unit verwendet
+#define EQEP_LOW_SPEED_COUNTS						8
+// Position des Vergleichsausgangs und Impulsbreite (4 * (PCSPW + 1) SYSCLK-Takte)
+#define EQEP_COMPARE_POSITION						0
+#define EQEP_COMPARE_PULSE_WIDTH				249
+// Quelle des Positionszhlers
+#define EQEP_QSRC_QUADRATURE						0
+#define EQEP_QSRC_DIRECTION_COUNT				1
+#define EQEP_QSRC_UP_COUNT							2
+#define EQEP_QSRC_DOWN_COUNT						3
+// Rcksetzen des Positionszhlers
+#define EQEP_PCRM_INDEX									0
+#define EQEP_PCRM_MAXIMUM								1
+#define EQEP_PCRM_FIRST_INDEX						2
+#define EQEP_PCRM_UNIT_TIMEOUT					3
+// Initialisierung des Positionszhlers durch den Index
+#define EQEP_IEI_NOTHING								0
+#define EQEP_IEI_RISING_EDGE						2
+#define EQEP_IEI_FALLING_EDGE						3
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse eines Regelzyklus
+typedef struct
+{
+		uint32_t position;							// Gelatchte Position 0 ... EQEP_COUNTS_PER_REVOLUTION - 1
+		float angle;										// Mechanischer Winkel in rad (0 ... 2 pi)
+		int32_t deltaCounts;						// Zhlschritte seit dem letzten Regelzyklus
+		float speedHighRpm;							// Drehzahl aus der Positionsnderung pro Zyklus
+		float speedLowRpm;							// Drehzahl aus der Capture-Unit
+		float speedRpm;									// Verwendete Drehzahl (mit Vorzeichen)
+		bool homed;											// Indeximpuls seit EqepInit() erkannt
+		bool forward;										// Drehrichtung (QEPSTS.QDF)
+		uint32_t cycles;								// Anzahl der Regelzyklen
+		uint16_t errors;								// Phasenfehler (Flanken A und B gleichzeitig)
+} EqepControlData;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse des letzten Regelzyklus (geschrieben von EqepControlISR())
+extern volatile EqepControlData eqepControl;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die GPIOs und das eQEP1-Modul
+extern void EqepInit(void);
+// Funktion startet ein neues Homing (nchster Indeximpuls setzt die Position auf 0)
+extern void EqepStartHoming(void);
+// Regel-Interrupt (Unit-Timer des eQEP1-Moduls)
+extern __interrupt void EqepControlISR(void);
+
+
+#endif
@@ -0,0 +1,248 @@
+//=================================================================================================
+/// @file       myBufferPool.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die bergabe ganzer GSx-RAM-Blcke
+///							zwischen CPU 1 und CPU 2 ohne Kopieren, siehe myBufferPool.h. Die Zugriffsrechte
+///							werden mit MemCfgRegs.GSxMSEL umgeschaltet (Abschnitt "Global Shared RAM" im
+///							Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+///							nderung in Version 1.1: CPU 1 wartet in der Initialisierung mit DeviceJoinCPU2()
+///							auf das Ende des Boot-Prozesses von CPU 2, der die IPC-Flags lscht
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myBufferPool.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Freie Blcke von CPU 1 (Bit n: Block BUFFERPOOL_FIRST_BLOCK + n)
+uint16_t bufferPoolFree = 0;
+// Anzahl der bergaben an CPU 2 und der Rckgaben an CPU 1
+uint32_t bufferPoolSent = 0;
+uint32_t bufferPoolCollected = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: BufferPoolSetOwner ================================================================
+///
+/// @brief  Funktion weist einen GSx-Block CPU 1 (0) oder CPU 2 (1) zu. Nur CPU 1 darf das
+///					Register GSxMSEL schreiben
+///
+/// @param  uint16_t block, uint16_t owner (DEVICE_OWNER_CPU1 oder DEVICE_OWNER_CPU2)
+///
+/// @return void
+///
+//=================================================================================================
+static void BufferPoolSetOwner(uint16_t block, uint16_t owner)
+{
+#ifdef CPU1
+		EALLOW;
+		if (owner == DEVICE_OWNER_CPU2)
+				MemCfgRegs.GSxMSEL.all |= 1UL << block;
+		else
+				MemCfgRegs.GSxMSEL.all &= ~(1UL << block);
+		EDIS;
+#endif
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: BufferPoolInit ====================================================================
+///
+/// @brief  Funktion weist alle Blcke des Pools CPU 1 zu, gibt sie frei und quittiert evtl. noch
+///					gesetzte IPC-Flags. Wird von CPU 1 nach DeviceInit() aufgerufen, bevor CPU 2 den
+///					Pool verwendet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void BufferPoolInit(void)
+{
+#ifdef CPU1
+		// Der Boot-Prozess von CPU 2 lscht die IPC-Flags
+		DeviceJoinCPU2();
+		for (uint16_t i=0; i<BUFFERPOOL_NUMBER_OF_BLOCKS; i++)
+		{
+				BufferPoolSetOwner(BUFFERPOOL_FIRST_BLOCK + i, DEVICE_OWNER_CPU1);
+		}
+		bufferPoolFree = (1U << BUFFERPOOL_NUMBER_OF_BLOCKS) - 1U;
+		bufferPoolSent = 0;
+		bufferPoolCollected = 0;
+
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCCLR.all = BUFFERPOOL_IPC_FLAG;
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = BUFFERPOOL_IPC_FLAG;
+#endif
+}
+
+
+//=== Function: BufferPoolAcquire =================================================================
+///
+/// @brief  Funktion gibt die Adresse eines freien Blocks von CPU 1 zurck und speichert seine
+///					Nummer in "block". Der Block gehrt CPU 1, bis er mit BufferPoolSend() bergeben
+///					wird. Nur von CPU 1 aufrufen
+///
+/// @param  uint16_t *block
+///
+/// @return uint16_t *buffer (0: kein Block frei)
+///
+//=================================================================================================
+uint16_t *BufferPoolAcquire(uint16_t *block)
+{
+		for (uint16_t i=0; i<BUFFERPOOL_NUMBER_OF_BLOCKS; i++)
+		{
+				if (bufferPoolFree & (1U << i))
+				{
+						bufferPoolFree &= ~(1U << i);
+						*block = BUFFERPOOL_FIRST_BLOCK + i;
+						return BUFFERPOOL_ADDRESS(*block);
+				}
+		}
+		*block = BUFFERPOOL_NO_BLOCK;
+		return 0;
+}
+
+
+//=== Function: BufferPoolSend ====================================================================
+///
+/// @brief  Funktion gibt einen gefllten Block an CPU 2 und meldet Block und Anzahl der gltigen
+///					Worte mit BUFFERPOOL_IPC_FLAG. Danach darf CPU 1 den Block nur noch lesen. Hat CPU 2
+///					die vorherige Meldung noch nicht bernommen, bleibt der Block bei CPU 1 und die
+///					Funktion gibt "false" zurck (spter erneut aufrufen). Nur von CPU 1 aufrufen
+///
+/// @param  uint16_t block, uint16_t words
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool BufferPoolSend(uint16_t block, uint16_t words)
+{
+#ifdef CPU1
+		if (Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCFLG.all & BUFFERPOOL_IPC_FLAG)
+		{
+				return false;
+		}
+
+		// Die Schreibzugriffe von CPU 1 sind abgeschlossen, bevor MSEL umschaltet
+		BufferPoolSetOwner(block, DEVICE_OWNER_CPU2);
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSENDDATA = BUFFERPOOL_MESSAGE(block, words);
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.all = BUFFERPOOL_IPC_FLAG;
+		bufferPoolSent++;
+		return true;
+#else
+		return false;
+#endif
+}
+
+
+//=== Function: BufferPoolCollect =================================================================
+///
+/// @brief  Funktion prft, ob CPU 2 einen Block zurckgegeben hat. In diesem Fall wird der Block
+///					wieder CPU 1 zugewiesen, freigegeben und die Meldung quittiert. Wird z.B. in der
+///					Hauptschleife aufgerufen. Nur von CPU 1 aufrufen
+///
+/// @param  void
+///
+/// @return bool blockCollected
+///
+//=================================================================================================
+bool BufferPoolCollect(void)
+{
+#ifdef CPU1
+		uint16_t block;
+
+		if ((Cpu1toCpu2IpcRegs.CPU2TOCPU1IPCSTS.all & BUFFERPOOL_IPC_FLAG) == 0)
+		{
+				return false;
+		}
+
+		block = (uint16_t)(Cpu1toCpu2IpcRegs.CPU2TOCPU1IPCRECVDATA & 0xFFFFU);
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = BUFFERPOOL_IPC_FLAG;
+		if (   (block >= BUFFERPOOL_FIRST_BLOCK)
+				&& (block < BUFFERPOOL_FIRST_BLOCK + BUFFERPOOL_NUMBER_OF_BLOCKS))
+		{
+				BufferPoolSetOwner(block, DEVICE_OWNER_CPU1);
+				bufferPoolFree |= 1U << (block - BUFFERPOOL_FIRST_BLOCK);
+				bufferPoolCollected++;
+		}
+		return true;
+#else
+		return false;
+#endif
+}
+
+
+//=== Function: BufferPoolReceive =================================================================
+///
+/// @brief  Funktion prft, ob CPU 1 einen Block bergeben hat, und quittiert die Meldung in diesem
+///					Fall. Der Block gehrt CPU 2, bis er mit BufferPoolRelease() zurckgegeben wird.
+///					Nur von CPU 2 aufrufen
+///
+/// @param  uint16_t *block, uint16_t *words (Anzahl der gltigen Worte)
+///
+/// @return uint16_t *buffer (0: kein Block bergeben)
+///
+//=================================================================================================
+uint16_t *BufferPoolReceive(uint16_t *block, uint16_t *words)
+{
+#ifdef CPU2
+		uint32_t message;
+
+		if ((Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCSTS.all & BUFFERPOOL_IPC_FLAG) == 0)
+		{
+				return 0;
+		}
+
+		message = Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCRECVDATA;
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = BUFFERPOOL_IPC_FLAG;
+		*block = (uint16_t)(message & 0xFFFFU);
+		*words = (uint16_t)(message >> 16);
+		return BUFFERPOOL_ADDRESS(*block);
+#else
+		return 0;
+#endif
+}
+
+
+//=== Function: BufferPoolRelease =================================================================
+///
+/// @brief  Funktion gibt einen verarbeiteten Block mit BUFFERPOOL_IPC_FLAG an CPU 1 zurck.
+///					Danach darf CPU 2 den Block nicht mehr verwenden. Hat CPU 1 die vorherige Rckgabe
+///					noch nicht bernommen, gibt die Funktion "false" zurck (spter erneut aufrufen).
+///					Nur von CPU 2 aufrufen
+///
+/// @param  uint16_t block
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool BufferPoolRelease(uint16_t block)
+{
+#ifdef CPU2
+		if (Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCFLG.all & BUFFERPOOL_IPC_FLAG)
+		{
+				return false;
+		}
+
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCSENDDATA = BUFFERPOOL_MESSAGE(block, 0);
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCSET.all = BUFFERPOOL_IPC_FLAG;
+		return true;
+#else
+		return false;
+#endif
+}
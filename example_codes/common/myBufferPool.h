@@ -0,0 +1,90 @@
+//=================================================================================================
+/// @file       myBufferPool.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen, mit denen ganze GSx-RAM-Blcke (je 4K Worte)
+///							zur Laufzeit ohne Kopieren zwischen CPU 1 und CPU 2 bergeben werden. Der Besitzer
+///							eines Blocks darf schreiben, die andere CPU nur lesen (MemCfgRegs.GSxMSEL, nur von
+///							CPU 1 beschreibbar). Ablauf:
+///							- CPU 1 holt mit BufferPoolAcquire() einen freien Block und fllt ihn (z.B. mit
+///							  einer Messung)
+///							- BufferPoolSend() gibt den Block an CPU 2 (MSEL = 1) und meldet Block und Anzahl
+///							  der gltigen Worte ber IPC2 und das Register CPU1TOCPU2IPCSENDDATA
+///							- CPU 2 bernimmt ihn mit BufferPoolReceive(), verarbeitet ihn (z.B. Ausgabe) und
+///							  gibt ihn mit BufferPoolRelease() ber IPC2 in der Gegenrichtung zurck
+///							- BufferPoolCollect() (CPU 1) schaltet den Block wieder auf CPU 1 (MSEL = 0) und
+///							  gibt ihn frei
+///							Je Richtung ist hchstens eine Meldung unterwegs, ist sie noch nicht quittiert,
+///							geben BufferPoolSend() und BufferPoolRelease() "false" zurck. Die Blcke
+///							BUFFERPOOL_FIRST_BLOCK bis BUFFERPOOL_FIRST_BLOCK + BUFFERPOOL_NUMBER_OF_BLOCKS - 1
+///							drfen vom Linker-Skript nicht belegt werden.
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+///							nderung in Version 1.1: CPU 1 wartet in der Initialisierung mit DeviceJoinCPU2()
+///							auf das Ende des Boot-Prozesses von CPU 2, der die IPC-Flags lscht
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYBUFFERPOOL_H_
+#define MYBUFFERPOOL_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Blcke des Pools (GS6 bis GS9, nicht vom Linker-Skript belegt)
+#define BUFFERPOOL_FIRST_BLOCK									6
+#define BUFFERPOOL_NUMBER_OF_BLOCKS							4
+// Gre eines Blocks in 16 Bit-Worten und Adresse von RAMGS0 (siehe Linker-Skript)
+#define BUFFERPOOL_BLOCK_WORDS									0x1000U
+#define BUFFERPOOL_GS0_ADDRESS									0x00D000UL
+// IPC-Flag fr die bergabe in beiden Richtungen (IPC0: SPI-D, IPC1: Datenkanal)
+#define BUFFERPOOL_IPC_FLAG											0x00000004UL
+// Kein Block
+#define BUFFERPOOL_NO_BLOCK											0xFFFF
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Adresse eines GSx-Blocks
+#define BUFFERPOOL_ADDRESS(block)								((uint16_t *)(BUFFERPOOL_GS0_ADDRESS + (uint32_t)(block) * BUFFERPOOL_BLOCK_WORDS))
+// Inhalt von IPCSENDDATA: Anzahl der gltigen Worte (Bit 31..16) und Block (Bit 15..0)
+#define BUFFERPOOL_MESSAGE(block, words)				(((uint32_t)(words) << 16) | (block))
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Freie Blcke von CPU 1 (Bit n: Block BUFFERPOOL_FIRST_BLOCK + n)
+extern uint16_t bufferPoolFree;
+// Anzahl der bergaben an CPU 2 und der Rckgaben an CPU 1
+extern uint32_t bufferPoolSent;
+extern uint32_t bufferPoolCollected;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion weist alle Blcke des Pools CPU 1 zu und gibt sie frei (CPU 1)
+extern void BufferPoolInit(void);
+// Funktion gibt einen freien Block zurck (CPU 1)
+extern uint16_t *BufferPoolAcquire(uint16_t *block);
+// Funktion gibt einen gefllten Block an CPU 2 (CPU 1)
+extern bool BufferPoolSend(uint16_t block, uint16_t words);
+// Funktion bernimmt einen von CPU 2 zurckgegebenen Block (CPU 1)
+extern bool BufferPoolCollect(void);
+// Funktion bernimmt einen von CPU 1 bergebenen Block (CPU 2)
+extern uint16_t *BufferPoolReceive(uint16_t *block, uint16_t *words);
+// Funktion gibt einen verarbeiteten Block an CPU 1 zurck (CPU 2)
+extern bool BufferPoolRelease(uint16_t block);
+
+
+#endif
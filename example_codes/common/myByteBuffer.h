@@ -0,0 +1,110 @@
+//=================================================================================================
+/// @file       myByteBuffer.h
+///
+/// @brief      Datei enthlt Makros und Funktionen fr gepackte Byte-Puffer. Der kleinste Datentyp
+///							des C28x ist 16 Bit breit, ein Puffer mit einem Byte pro "uint16_t" belegt also
+///							doppelt so viel RAM wie ntig. In einem gepackten Puffer liegen zwei Bytes in
+///							einem Wort (Byte 2*i im unteren, Byte 2*i+1 im oberen Byte von Wort i). Der Zugriff
+///							erfolgt mit dem Compiler-Intrinsic "__byte()", das direkt in einen MOVB-Befehl
+///							bersetzt wird. Ein Byte wird damit ohne Schiebe- und Maskenoperationen in einem
+///							Befehl gelesen oder geschrieben (auch in ISRs, der Befehl ist nicht unterbrechbar).
+///
+///							Verwendung:
+///							- Puffer anlegen: uint16_t buffer[BYTE_BUFFER_WORDS(Anzahl Bytes)]
+///							- Einzelnes Byte: BYTE_BUFFER_GET(buffer, index), BYTE_BUFFER_SET(buffer, index, wert)
+///							- Blcke: ByteBufferPack() und ByteBufferUnpack() kopieren zwischen einem gepackten
+///							  Puffer und einem Puffer mit einem Byte pro Wort (z.B. fr bestehenden Code)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYBYTEBUFFER_H_
+#define MYBYTEBUFFER_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Wrter eines gepackten Puffers fr "numberOfBytes" Bytes
+#define BYTE_BUFFER_WORDS(numberOfBytes)		(((numberOfBytes) + 1) / 2)
+// Byte "index" eines gepackten Puffers lesen (Ergebnis 0 ... 255)
+#define BYTE_BUFFER_GET(buffer, index)			((uint16_t)__byte((int *)(buffer), (index)))
+// Byte "index" eines gepackten Puffers schreiben (nur das untere Byte von "value" wird verwendet)
+#define BYTE_BUFFER_SET(buffer, index, value)	(__byte((int *)(buffer), (index)) = (value))
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ByteBufferPack ====================================================================
+///
+/// @brief  Funktion kopiert "numberOfBytes" Bytes (ein Byte pro Wort, unteres Byte) ab Byte
+///					"index" in einen gepackten Puffer
+///
+/// @param  uint16_t *packed, uint16_t index, const uint16_t *bytes, uint16_t numberOfBytes
+///
+/// @return void
+///
+//=================================================================================================
+static inline void ByteBufferPack(uint16_t *packed,
+																	uint16_t index,
+																	const uint16_t *bytes,
+																	uint16_t numberOfBytes)
+{
+		for (uint16_t i=0; i<numberOfBytes; i++)
+		{
+				BYTE_BUFFER_SET(packed, index + i, bytes[i]);
+		}
+}
+
+
+//=== Function: ByteBufferUnpack ==================================================================
+///
+/// @brief  Funktion kopiert "numberOfBytes" Bytes ab Byte "index" eines gepackten Puffers in
+///					einen Puffer mit einem Byte pro Wort
+///
+/// @param  uint16_t *bytes, const uint16_t *packed, uint16_t index, uint16_t numberOfBytes
+///
+/// @return void
+///
+//=================================================================================================
+static inline void ByteBufferUnpack(uint16_t *bytes,
+																		const uint16_t *packed,
+																		uint16_t index,
+																		uint16_t numberOfBytes)
+{
+		for (uint16_t i=0; i<numberOfBytes; i++)
+		{
+				bytes[i] = BYTE_BUFFER_GET(packed, index + i);
+		}
+}
+
+
+//=== Function: ByteBufferClear ===================================================================
+///
+/// @brief  Funktion setzt alle Bytes eines gepackten Puffers fr "numberOfBytes" Bytes zu 0
+///					(wortweise)
+///
+/// @param  uint16_t *packed, uint16_t numberOfBytes
+///
+/// @return void
+///
+//=================================================================================================
+static inline void ByteBufferClear(uint16_t *packed,
+																	 uint16_t numberOfBytes)
+{
+		for (uint16_t i=0; i<BYTE_BUFFER_WORDS(numberOfBytes); i++)
+		{
+				packed[i] = 0;
+		}
+}
+
+
+#endif
@@ -0,0 +1,314 @@
+//=================================================================================================
+/// @file       myCRC.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen um CRC-Prfsummen (CRC8, CRC16 und CRC32)
+///							mit der VCRC-Einheit des C28x zu berechnen, fortlaufend ber mehrere Puffer oder
+///							blockweise ber einen Speicherbereich (Flash-Image, siehe myCRC.h)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myCRC.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der CRC-Typen (CRC_TYPE_*)
+#define CRC_NUMBER_OF_TYPES									4
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+#if !CRC_USE_VCU
+// Bitbreite und Polynom der CRC-Typen fr die Berechnung in Software
+static const uint16_t crcWidth[CRC_NUMBER_OF_TYPES] = {8, 16, 16, 32};
+static const uint32_t crcPolynomial[CRC_NUMBER_OF_TYPES] =
+{
+		CRC_POLYNOMIAL_8, CRC_POLYNOMIAL_16_P1, CRC_POLYNOMIAL_16_P2, CRC_POLYNOMIAL_32
+};
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: CrcMask ===========================================================================
+///
+/// @brief  Funktion gibt die Bitmaske der Bitbreite eines CRC-Typs zurck
+///
+/// @param  uint16_t type
+///
+/// @return uint32_t mask
+///
+//=================================================================================================
+static uint32_t CrcMask(uint16_t type)
+{
+		if (type == CRC_TYPE_8)
+				return 0x000000FFUL;
+		if (type == CRC_TYPE_32)
+				return 0xFFFFFFFFUL;
+		return 0x0000FFFFUL;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: CrcStep ===========================================================================
+///
+/// @brief  Funktion bezieht das untere Byte von "byte" in die CRC ein und gibt die neue CRC
+///					zurck. Mit VCRC ist das ein einzelner Befehl (CRC8L, CRC16P1L, CRC16P2L, CRC32L),
+///					sonst wird die CRC bitweise berechnet
+///
+/// @param  uint16_t type, uint32_t crc, uint16_t byte
+///
+/// @return uint32_t crc
+///
+//=================================================================================================
+uint32_t CrcStep(uint16_t type, uint32_t crc, uint16_t byte)
+{
+#if CRC_USE_VCU
+		switch (type)
+		{
+				case CRC_TYPE_8:
+						return __crc8l(crc, byte, 0);
+				case CRC_TYPE_16_P1:
+						return __crc16p1l(crc, byte, 0);
+				case CRC_TYPE_16_P2:
+						return __crc16p2l(crc, byte, 0);
+				default:
+						return __crc32l(crc, byte, 0);
+		}
+#else
+		uint16_t width = crcWidth[type & 0x0003];
+		uint32_t polynomial = crcPolynomial[type & 0x0003];
+		uint32_t topBit = 1UL << (width - 1);
+		uint16_t bit;
+
+		crc ^= (uint32_t)(byte & 0x00FF) << (width - 8);
+		for (bit = 0; bit < 8; bit++)
+		{
+				crc = (crc & topBit) ? ((crc << 1) ^ polynomial) : (crc << 1);
+		}
+		return crc & CrcMask(type);
+#endif
+}
+
+
+//=== Function: CrcInit ===========================================================================
+///
+/// @brief  Funktion setzt Typ und Startwert einer fortlaufenden CRC-Berechnung
+///
+/// @param  CrcContext *context, uint16_t type, uint32_t initValue
+///
+/// @return void
+///
+//=================================================================================================
+void CrcInit(CrcContext *context, uint16_t type, uint32_t initValue)
+{
+		context->type = type;
+		context->crc = initValue & CrcMask(type);
+}
+
+
+//=== Function: CrcUpdateBytes ====================================================================
+///
+/// @brief  Funktion bezieht "numberOfBytes" Bytes in die CRC ein. Jedes Wort enthlt ein Byte im
+///					unteren Byte (wie die Puffer von UART, SPI und I2C)
+///
+/// @param  CrcContext *context, const uint16_t *bytes, uint16_t numberOfBytes
+///
+/// @return void
+///
+//=================================================================================================
+void CrcUpdateBytes(CrcContext *context, const uint16_t *bytes, uint16_t numberOfBytes)
+{
+		uint32_t crc = context->crc;
+		uint16_t i;
+
+#if CRC_USE_VCU
+		// Schleifen pro Typ, damit der Compiler den Befehl direkt in die Schleife legt
+		switch (context->type)
+		{
+				case CRC_TYPE_8:
+						for (i = 0; i < numberOfBytes; i++)
+								crc = __crc8l(crc, bytes[i], 0);
+						break;
+				case CRC_TYPE_16_P1:
+						for (i = 0; i < numberOfBytes; i++)
+								crc = __crc16p1l(crc, bytes[i], 0);
+						break;
+				case CRC_TYPE_16_P2:
+						for (i = 0; i < numberOfBytes; i++)
+								crc = __crc16p2l(crc, bytes[i], 0);
+						break;
+				default:
+						for (i = 0; i < numberOfBytes; i++)
+								crc = __crc32l(crc, bytes[i], 0);
+						break;
+		}
+#else
+		for (i = 0; i < numberOfBytes; i++)
+				crc = CrcStep(context->type, crc, bytes[i]);
+#endif
+		context->crc = crc;
+}
+
+
+//=== Function: CrcUpdateWords ====================================================================
+///
+/// @brief  Funktion bezieht "numberOfWords" Wrter in die CRC ein. Jedes Wort enthlt zwei Bytes,
+///					das untere Byte wird zuerst verarbeitet (Byte-Reihenfolge im Speicher des C28x)
+///
+/// @param  CrcContext *context, const uint16_t *words, uint32_t numberOfWords
+///
+/// @return void
+///
+//=================================================================================================
+void CrcUpdateWords(CrcContext *context, const uint16_t *words, uint32_t numberOfWords)
+{
+		uint32_t crc = context->crc;
+		uint32_t i;
+
+#if CRC_USE_VCU
+		switch (context->type)
+		{
+				case CRC_TYPE_8:
+						for (i = 0; i < numberOfWords; i++)
+						{
+								crc = __crc8l(crc, words[i], 0);
+								crc = __crc8l(crc, words[i], 1);
+						}
+						break;
+				case CRC_TYPE_16_P1:
+						for (i = 0; i < numberOfWords; i++)
+						{
+								crc = __crc16p1l(crc, words[i], 0);
+								crc = __crc16p1l(crc, words[i], 1);
+						}
+						break;
+				case CRC_TYPE_16_P2:
+						for (i = 0; i < numberOfWords; i++)
+						{
+								crc = __crc16p2l(crc, words[i], 0);
+								crc = __crc16p2l(crc, words[i], 1);
+						}
+						break;
+				default:
+						for (i = 0; i < numberOfWords; i++)
+						{
+								crc = __crc32l(crc, words[i], 0);
+								crc = __crc32l(crc, words[i], 1);
+						}
+						break;
+		}
+#else
+		for (i = 0; i < numberOfWords; i++)
+		{
+				crc = CrcStep(context->type, crc, words[i]);
+				crc = CrcStep(context->type, crc, words[i] >> 8);
+		}
+#endif
+		context->crc = crc;
+}
+
+
+//=== Function: CrcGetResult ======================================================================
+///
+/// @brief  Funktion gibt das Ergebnis einer fortlaufenden CRC-Berechnung zurck. Der Kontext kann
+///					danach weiter verwendet werden
+///
+/// @param  const CrcContext *context
+///
+/// @return uint32_t crc
+///
+//=================================================================================================
+uint32_t CrcGetResult(const CrcContext *context)
+{
+		return context->crc & CrcMask(context->type);
+}
+
+
+//=== Function: CrcImageStart =====================================================================
+///
+/// @brief  Funktion startet die blockweise Prfung eines Speicherbereichs (z.B. Flash-Image, die
+///					erwartete CRC legt z.B. das Build-Skript am Ende des Images ab). Die Prfung erfolgt
+///					mit CrcImageService()
+///
+/// @param  CrcImageCheck *check, uint16_t type, const uint16_t *start, uint32_t numberOfWords,
+///					uint32_t initValue, uint32_t expected
+///
+/// @return void
+///
+//=================================================================================================
+void CrcImageStart(CrcImageCheck *check, uint16_t type, const uint16_t *start,
+									 uint32_t numberOfWords, uint32_t initValue, uint32_t expected)
+{
+		CrcInit(&check->context, type, initValue);
+		check->position = start;
+		check->remaining = numberOfWords;
+		check->expected = expected & CrcMask(type);
+		check->state = CRC_IMAGE_BUSY;
+}
+
+
+//=== Function: CrcImageService ===================================================================
+///
+/// @brief  Funktion prft die nchsten (hchstens CRC_IMAGE_BLOCK_WORDS) Wrter und gibt den
+///					Zustand zurck. Nach dem letzten Block wird die CRC mit dem erwarteten Wert
+///					verglichen (CRC_IMAGE_PASSED bzw. CRC_IMAGE_FAILED)
+///
+/// @param  CrcImageCheck *check
+///
+/// @return uint16_t state
+///
+//=================================================================================================
+uint16_t CrcImageService(CrcImageCheck *check)
+{
+		uint32_t block;
+
+		if (check->state != CRC_IMAGE_BUSY)
+				return check->state;
+
+		block = (check->remaining > CRC_IMAGE_BLOCK_WORDS) ? CRC_IMAGE_BLOCK_WORDS : check->remaining;
+		CrcUpdateWords(&check->context, check->position, block);
+		check->position += block;
+		check->remaining -= block;
+
+		if (check->remaining == 0)
+		{
+				check->state = (CrcGetResult(&check->context) == check->expected)
+											 ? CRC_IMAGE_PASSED : CRC_IMAGE_FAILED;
+		}
+		return check->state;
+}
+
+
+//=== Function: CrcImageVerify ====================================================================
+///
+/// @brief  Funktion prft einen Speicherbereich vollstndig (z.B. Flash-Image in DeviceInit() bzw.
+///					vor dem Start der Anwendung) und gibt "true" zurck, wenn die CRC stimmt
+///
+/// @param  uint16_t type, const uint16_t *start, uint32_t numberOfWords, uint32_t initValue,
+///					uint32_t expected
+///
+/// @return bool passed
+///
+//=================================================================================================
+bool CrcImageVerify(uint16_t type, const uint16_t *start, uint32_t numberOfWords,
+										uint32_t initValue, uint32_t expected)
+{
+		CrcImageCheck check;
+
+		CrcImageStart(&check, type, start, numberOfWords, initValue, expected);
+		while (CrcImageService(&check) == CRC_IMAGE_BUSY);
+		return check.state == CRC_IMAGE_PASSED;
+}
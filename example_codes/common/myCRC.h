@@ -0,0 +1,125 @@
+//=================================================================================================
+/// @file       myCRC.h
+///
+/// @brief      Datei enthlt Variablen, Funktionen und Makros um CRC-Prfsummen (CRC8, CRC16 und
+///							CRC32) mit der VCRC-Einheit (Viterbi, Complex Math and CRC Unit) des C28x zu
+///							berechnen. Die VCRC-Befehle verarbeiten ein Byte pro Takt, eine Tabelle wird
+///							nicht bentigt. Alle CRCs werden MSB-first (nicht gespiegelt) und ohne
+///							abschlieendes XOR berechnet:
+///							- CRC_TYPE_8:      Polynom 0x07
+///							- CRC_TYPE_16_P1:  Polynom 0x8005
+///							- CRC_TYPE_16_P2:  Polynom 0x1021 (CCITT, Startwert 0xFFFF = CRC-16/CCITT-FALSE)
+///							- CRC_TYPE_32:     Polynom 0x04C11DB7
+///							Ohne VCRC-Untersttzung des Compilers (--vcu_support) wird die CRC bitweise in
+///							Software berechnet (gleiches Ergebnis).
+///
+///							Schnittstelle:
+///							- Fortlaufend: CrcInit(), beliebig viele CrcUpdateBytes()/CrcUpdateWords(), dann
+///							  CrcGetResult(). Ein Kontext kann so ber mehrere Puffer (z.B. DMA-Blcke oder
+///							  empfangene Rahmen) weitergefhrt werden
+///							- Einzelnes Byte: CRC16_P2_BYTE() (Telemetrie-Rahmen, myTelemetry.c)
+///							- Blockweise Prfung eines Speicherbereichs (Flash-Image beim Start):
+///							  CrcImageStart() und CrcImageService() bearbeiten pro Aufruf hchstens
+///							  CRC_IMAGE_BLOCK_WORDS Wrter, sodass die Prfung auch im Hauptprogramm neben
+///							  anderen Aufgaben laufen kann. CrcImageVerify() prft den Bereich vollstndig.
+///							  Der DMA hat keinen Zugriff auf den Flash, der Bereich wird daher von der CPU
+///							  gelesen. Daten, die der DMA in das GS-RAM kopiert hat, knnen blockweise mit
+///							  CrcUpdateWords() geprft werden
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYCRC_H_
+#define MYCRC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// VCRC-Befehle verwenden, wenn der Compiler sie untersttzt (--vcu_support=vcrc, vcu0 oder vcu2)
+#if defined(__TMS320C28XX_VCRC__) || defined(__TMS320C28XX_VCU0__) || defined(__TMS320C28XX_VCU2__)
+#define CRC_USE_VCU													1
+#else
+#define CRC_USE_VCU													0
+#endif
+// CRC-Typen
+#define CRC_TYPE_8													0
+#define CRC_TYPE_16_P1											1
+#define CRC_TYPE_16_P2											2
+#define CRC_TYPE_32													3
+// Polynome
+#define CRC_POLYNOMIAL_8										0x07UL
+#define CRC_POLYNOMIAL_16_P1								0x8005UL
+#define CRC_POLYNOMIAL_16_P2								0x1021UL
+#define CRC_POLYNOMIAL_32										0x04C11DB7UL
+// Wrter pro Aufruf von CrcImageService() (bei 200 MHz ca. 10 us pro Block)
+#define CRC_IMAGE_BLOCK_WORDS								512
+// Zustand der blockweisen Prfung
+#define CRC_IMAGE_BUSY											0
+#define CRC_IMAGE_PASSED										1
+#define CRC_IMAGE_FAILED										2
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Kontext einer fortlaufenden CRC-Berechnung
+typedef struct
+{
+		uint16_t type;																// CRC_TYPE_*
+		uint32_t crc;																	// Zwischenergebnis (rechtsbndig)
+} CrcContext;
+
+// Blockweise Prfung eines Speicherbereichs
+typedef struct
+{
+		CrcContext context;
+		const uint16_t *position;											// nchstes Wort
+		uint32_t remaining;														// verbleibende Wrter
+		uint32_t expected;														// erwartete CRC
+		uint16_t state;																// CRC_IMAGE_*
+} CrcImageCheck;
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// CRC16 (Polynom 0x1021) ber das untere Byte von "byte". Mit VCRC ein einzelner Befehl
+#if CRC_USE_VCU
+#define CRC16_P2_BYTE(crc, byte)						((uint16_t)__crc16p2l((uint32_t)(crc), (byte), 0))
+#else
+#define CRC16_P2_BYTE(crc, byte)						((uint16_t)CrcStep(CRC_TYPE_16_P2, (crc), (byte)))
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion bezieht das untere Byte von "byte" in die CRC ein und gibt die neue CRC zurck
+extern uint32_t CrcStep(uint16_t type, uint32_t crc, uint16_t byte);
+// Funktion setzt Typ und Startwert einer fortlaufenden CRC-Berechnung
+extern void CrcInit(CrcContext *context, uint16_t type, uint32_t initValue);
+// Funktion bezieht "numberOfBytes" Bytes (ein Byte pro Wort, unteres Byte) in die CRC ein
+extern void CrcUpdateBytes(CrcContext *context, const uint16_t *bytes, uint16_t numberOfBytes);
+// Funktion bezieht "numberOfWords" Wrter (zwei Bytes pro Wort, unteres Byte zuerst) in die CRC ein
+extern void CrcUpdateWords(CrcContext *context, const uint16_t *words, uint32_t numberOfWords);
+// Funktion gibt das Ergebnis einer fortlaufenden CRC-Berechnung zurck
+extern uint32_t CrcGetResult(const CrcContext *context);
+// Funktion startet die blockweise Prfung eines Speicherbereichs
+extern void CrcImageStart(CrcImageCheck *check, uint16_t type, const uint16_t *start,
+													uint32_t numberOfWords, uint32_t initValue, uint32_t expected);
+// Funktion prft den nchsten Block und gibt den Zustand (CRC_IMAGE_*) zurck
+extern uint16_t CrcImageService(CrcImageCheck *check);
+// Funktion prft einen Speicherbereich vollstndig und gibt "true" zurck, wenn die CRC stimmt
+extern bool CrcImageVerify(uint16_t type, const uint16_t *start, uint32_t numberOfWords,
+													 uint32_t initValue, uint32_t expected);
+
+
+#endif
@@ -0,0 +1,1241 @@
+//=================================================================================================
+/// @file       myDevice.c
+///
+/// @brief      Datei enthlt Funktionen um den Mikrocontorller TMS320F2838x grundlegend zu
+///							initialisieren. Dazu wird der Watchdog-Timer ausgeschaltet, der Systemtakt
+///							eingestellt, der Flash-Speicher initialisiert und die Interrupts freigeschaltet
+///							und initialisiert.
+///
+///							nderung in Version 1.3: Flash-Profile abhngig vom Systemtakt (minimale
+///							Wartezustnde, ECC mit Zhler fr Einzelbitfehler, Cache und Prefetch) und
+///							Benchmark fr die Ausfhrungsgeschwindigkeit aus dem Flash
+///
+///							nderung in Version 1.4: Umstellung des Systemtakts zur Laufzeit
+///							(DeviceSetSysclk()) mit Anpassung der Flash-Wartezustnde und Umrechnung der
+///							Perioden und Bittakte der Treiber. Prfung der PLL mit dem DCC0-Modul in
+///							DeviceCheckPll() zusammengefasst
+///
+///							nderung in Version 1.5: Zuordnung der Peripherie (Register CPUSELx) und GPIOs
+///							(Register GPxCSELy) zu CPU1 oder CPU2 mit einer Tabelle des Projekts, die vor dem
+///							Booten von CPU2 geschrieben wird
+///
+///							nderung in Version 1.6: Mit DEVICE_CPU2_BOOT_ASYNC wartet DeviceBootCPU2() nicht
+///							auf das Ende des Boot-Prozesses von CPU2. CPU1 initialisiert whrenddessen ihre
+///							Peripherie und wartet erst in DeviceJoinCPU2() (z.B. vor der ersten IPC-Nachricht)
+///
+/// @version    V1.6
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse von DeviceBenchmarkFlash()
+DeviceFlashBenchmark deviceFlashBenchmark[DEVICE_FLASH_NUMBER_OF_BENCHMARKS];
+// Aktueller Systemtakt in MHz (DeviceSetSysclk())
+volatile uint16_t deviceSysclkMhz = DEVICE_SYSCLK_MHZ;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Taktquelle von DeviceInit() (Teiler der PLL in DeviceSetSysclk())
+static uint32_t deviceClockSource = DEVICE_CLKSRC_EXTOSC_SE_25MHZ;
+// Mit DeviceRegisterClockCallback() angemeldete Funktionen
+static DeviceClockCallback deviceClockCallbacks[DEVICE_MAX_CLOCK_CALLBACKS];
+static uint16_t deviceNumberOfClockCallbacks = 0;
+// Mit DeviceSetOwnership() bergebene Zuordnung der Peripherie und GPIOs
+static const DeviceOwnership *deviceOwnership = 0;
+// Wird von DeviceBootCPU2() gesetzt und von DeviceJoinCPU2() gelscht
+static bool deviceCpu2Booting = false;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DeviceCheckPll ====================================================================
+///
+/// @brief	Funktion berprft den von der PLL ausgegebenen Takt (PLLRAWCLK) mit dem DCC0-Modul
+///					gegen die Referenzquelle (INTOSC2 oder XTAL/X1). Die Gleichungen stehen auf S. 1319
+///					im Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022. EALLOW muss gesetzt
+///					sein
+///
+/// @param  uint32_t referenceSource (DEVICE_DCC_REFERENCE_...), uint32_t REFDIV, uint32_t IMULT,
+///					uint32_t ODIV
+///
+/// @return bool pllOk (false: Abweichung zwischen Mess- und Referenzsignal zu gro)
+///
+//=================================================================================================
+static bool DeviceCheckPll(uint32_t referenceSource, uint32_t REFDIV, uint32_t IMULT, uint32_t ODIV)
+{
+		// Takt fr das DCC0-Modul einschalten
+		CpuSysRegs.PCLKCR21.bit.DCC0 = 1;
+		// Error- und Done-Flag lschen
+		Dcc0Regs.DCCSTATUS.bit.ERR  = 1;
+		Dcc0Regs.DCCSTATUS.bit.DONE = 1;
+		// DCC0-Modul anhalten
+		Dcc0Regs.DCCGCTRL.bit.DCCENA = 0x05;
+		// Error- und Done-Interruptsignal ausschalten
+		Dcc0Regs.DCCGCTRL.bit.ERRENA  = 0x05;
+		Dcc0Regs.DCCGCTRL.bit.DONEENA = 0x05;
+		// PLLRAWCLK als Messquelle
+		Dcc0Regs.DCCCLKSRC1.all = 0xA000;
+		// Referenzquelle
+		Dcc0Regs.DCCCLKSRC0.all = referenceSource;
+		// Frequenzverhltnis zwischen dem Messsignal und der Referenzquelle berechnen
+		float ratio_fMeasure_fReference = (float)IMULT / ((ODIV + 1U) * (REFDIV + 1U));
+		// Berechnung der Registerwerte nur fr ratio_fMeasure_fReference >= 1 gltig!
+		uint32_t toleranceInPercent, totalError, window, dccCounterSeed0, dccValidSeed0, dccCounterSeed1;
+		toleranceInPercent = 1;  // Wert aus DriverLib-Beispiel bernommen
+		totalError         = 12; // Wert aus DriverLib-Beispiel bernommen
+		window             = (totalError * 100) / toleranceInPercent; // Gleichung aus Datenblatt
+		dccCounterSeed0    = window - totalError;											// Gleichung aus Datenblatt
+		dccValidSeed0      = 2*totalError;														// Gleichung aus Datenblatt
+		dccCounterSeed1    = window * ratio_fMeasure_fReference;			// Gleichung aus Datenblatt
+		// Register mit den berechneten Werten beschreiben
+		Dcc0Regs.DCCCNTSEED0.bit.COUNTSEED0  = dccCounterSeed0;
+		Dcc0Regs.DCCVALIDSEED0.bit.VALIDSEED = dccValidSeed0;
+		Dcc0Regs.DCCCNTSEED1.bit.COUNTSEED1  = dccCounterSeed1;
+		// Single-Shot Betrieb des DCC-Moduls einschalten
+		Dcc0Regs.DCCGCTRL.bit.SINGLESHOT = 0x0A;
+		// DCC0-Modul starten
+		Dcc0Regs.DCCGCTRL.bit.DCCENA = 0x0A;
+		// Warten bis die Messung abgeschlossen ist
+		while((Dcc0Regs.DCCSTATUS.all & 0x03) == 0);
+		// Nur DONE gesetzt: Takt in Ordnung
+		return ((Dcc0Regs.DCCSTATUS.all & 0x03) == 0x02);
+}
+
+//=== Function: DeviceSetFlashRwait ===============================================================
+///
+/// @brief	Funktion setzt nur die Wartezustnde des Flash-Speichers und lsst ECC, Cache und
+///					Prefetch unverndert (Zhler und Fehlerflags bleiben erhalten). Muss aus dem RAM
+///					ausgefhrt werden. EALLOW muss gesetzt sein
+///
+/// @param  uint16_t rwait
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(DeviceSetFlashRwait, ".TI.ramfunc");
+static void DeviceSetFlashRwait(uint16_t rwait)
+{
+		uint16_t cache    = Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN;
+		uint16_t prefetch = Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN;
+
+		// Cache und Prefetch vor dem ndern der Wartezeit ausschalten
+		Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN = 0;
+		Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN   = 0;
+		Flash0CtrlRegs.FRDCNTL.bit.RWAIT = rwait;
+		Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN = cache;
+		Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN   = prefetch;
+		// 8 CPU-Takte warten (wie in DeviceSetFlashProfile())
+		__asm(" RPT #7 || NOP");
+}
+
+//=== Function: DeviceScale =======================================================================
+///
+/// @brief	Funktion rechnet eine in Takten angegebene Zeit vom alten auf den neuen Systemtakt um
+///					(gerundet)
+///
+/// @param  uint32_t cycles, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return uint32_t cycles
+///
+//=================================================================================================
+static uint32_t DeviceScale(uint32_t cycles, uint16_t oldMhz, uint16_t newMhz)
+{
+		return (uint32_t)(((uint64_t)cycles * newMhz + oldMhz / 2) / oldMhz);
+}
+
+
+//=== Function: DeviceFlashBenchmarkCode ==========================================================
+///
+/// @brief  Funktion enthlt den Code, der beim Benchmark aus dem Flash ausgefhrt wird (Schiebe-
+///					und Verknpfungsoperationen mit Verzweigung, hnlich einer CRC-Berechnung)
+///
+/// @param  uint32_t seed
+///
+/// @return uint32_t seed
+///
+//=================================================================================================
+static uint32_t DeviceFlashBenchmarkCode(uint32_t seed)
+{
+		for (uint16_t i=0; i<64; i++)
+		{
+				if (seed & 1)
+				{
+						seed = (seed >> 1) ^ 0xEDB88320UL;
+				}
+				else
+				{
+						seed = seed >> 1;
+				}
+				seed += (seed << 3) ^ i;
+		}
+		return seed;
+}
+
+
+//=== Function: DeviceFlashBenchmarkRun ===========================================================
+///
+/// @brief  Funktion setzt ein Flash-Profil, fhrt DEVICE_FLASH_BENCHMARK_LOOPS mal den Benchmark-
+///					Code aus und speichert die dafr bentigten Systemtakte (gemessen mit CPU-Timer 2)
+///
+/// @param  DeviceFlashBenchmark *result, uint16_t rwait, bool ecc, bool cache
+///
+/// @return void
+///
+//=================================================================================================
+static void DeviceFlashBenchmarkRun(DeviceFlashBenchmark *result, uint16_t rwait, bool ecc, bool cache)
+{
+		volatile uint32_t seed = 1;
+		uint32_t start;
+
+		DeviceSetFlashProfile(rwait, ecc, cache);
+
+		// Interrupts whrend der Messung sperren
+		DINT;
+		start = CpuTimer2Regs.TIM.all;
+		for (uint16_t i=0; i<DEVICE_FLASH_BENCHMARK_LOOPS; i++)
+		{
+				seed = DeviceFlashBenchmarkCode(seed);
+		}
+		// Timer zhlt abwrts
+		result->cycles = start - CpuTimer2Regs.TIM.all;
+		EINT;
+
+		result->rwait = rwait;
+		result->ecc   = ecc;
+		result->cache = cache;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: DeviceInit ========================================================================
+///
+/// @brief  Funktion ruft abhnging von der ausfhrenden CPU (CPU1 oder CPU2)
+///					die entsprechende Initialisierungsfunktion auf
+///
+/// @param  uint32_t clockSource
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceInit(uint32_t clockSource)
+{
+#ifdef CPU1
+		// bergabeparameter fr die Taktquelle prfen
+		if (   (clockSource == DEVICE_CLKSRC_INTOSC2)
+				|| (clockSource == DEVICE_CLKSRC_EXTOSC_SE_25MHZ))
+		{
+				DeviceInitCPU1(clockSource);
+		}
+		// Falls kein gltiger Parameter bergeben wurde, wird
+		// der interne 10 MHZ-Oszillator verwendet
+		else
+		{
+				DeviceInitCPU1(DEVICE_CLKSRC_INTOSC2);
+		}
+#else
+		DeviceInitCPU2();
+#endif
+}
+
+
+//=== Function: DeviceInitCPU1 ====================================================================
+///
+/// @brief  Funktion fhrt (durch CPU1) eine Grundinitialisation des Mikrocontrollers durch:
+///					- Watchdog-Timer ausschalten
+///					- Speicherinhalte zeitkritischer Funktionen von FLASH in dern RAM kopieren
+///					- Flash-Speicher fr 200 MHz initialisieren
+///					- Systemtakt einstellen (interner 10 MHz-Oszillator oder externer (single-ended)
+///																	 25 MHz Oszillator, 200 MHz Systemtakt, 50 MHz Low Speed CLK)
+///					- Fabrikationsdaten aus dem OTP-Speicher in die ADC-Trimmregister kopieren
+///					- CPU-Interrupts aus-, PIE-Vectrotabelle ein- und Interrupts global einschalten
+///
+/// @param  uint32_t clockSource
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceInitCPU1(uint32_t clockSource)
+{
+#ifdef CPU1
+    // Watchdog-Timer ausschalten
+    WdRegs.WDCR.bit.WDDIS = 1;
+
+    // Flash-Speicher initialisieren:
+    // Funktion zur Initialisierung des Flash-Speichers zur RAM-Sektion zuordnen
+    // (wird ber die .cmd-Datei durch den Linker entsprechen in den RAM kopiert)
+    #pragma CODE_SECTION(DeviceInitFlashMemory, ".TI.ramfunc");
+    #pragma CODE_SECTION(DeviceSetFlashProfile, ".TI.ramfunc");
+    // Zeitkritische Funktion in den RAM kopieren, wenn der Flash genutzt wird.
+    // Wird das nicht gemacht, funktioniert der Code nicht weil z.B. die Funktion
+    // DELAY_US() angehalten wird und das Programm dann nicht weiterluft. Die
+    // Namen der Variablen sind Platzhalter fr Konstanten des Linkers und drfen
+		// daher nicht verndert werden.
+    extern Uint16 RamfuncsRunStart, RamfuncsLoadStart, RamfuncsLoadSize;
+#ifdef _FLASH
+    // Flash-Initialisierungsfunktion in den RAM-Speicher kopieren
+		memcpy(&RamfuncsRunStart, &RamfuncsLoadStart, (size_t)&RamfuncsLoadSize);
+		// Flash initialisieren. Muss vom RAM aus aufgerufen werden
+		DeviceInitFlashMemory();
+#endif
+
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+		// Taktquelle fr DeviceSetSysclk() merken
+		deviceClockSource = clockSource;
+
+		// Interner 10 MHz-Oszillator:
+    if (clockSource == DEVICE_CLKSRC_INTOSC2)
+    {
+				// PPL umgehen und 120 Takte warten bis diese nderung wirksam wird
+    		// (siehe S. 173 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 0;
+				asm(" RPT #119 || NOP");
+				// PLL-Stromversorgung ausschalten und 60 Takte warten bis diese nderung wirksam wird
+				// (siehe S. 173 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 0;
+				asm(" RPT #59 || NOP");
+				// Internen Oszillator INTOSC2 (Primr-Oszillator) als Taktquelle setzen und 300 Takte
+				// warten bis diese nderung wirksam wird (siehe S. 173 Reference Manual TMS320F2838x,
+				// SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.CLKSRCCTL1.bit.OSCCLKSRCSEL = 0;
+				// Wenn mehr als 255 wiederholungen in einem Befehl gesetzt
+				// werden, kommt einen Warnung ([W0001] Value out of range).
+				// Daher werden die 300 NOPs in 2 Befehle aufgeteilt
+				asm(" RPT #200 || NOP");
+				asm(" RPT #99 || NOP");
+				// Taktteiler auf 1 setzen, damit die PLL schnellst mglich kofiguriert werden kann
+				ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 0;
+				// Teiler und Miltiplikatoren der PLL konfigurieren (siehe S. 172
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+				// f_PLL = (f_OSCCLK / (REFDIV+1)) * (IMULT / (ODIV+1))
+				// f_PLL = 200 MHZ: REFDIV = 0; ODIV = 0, IMULT = 20
+				// Achtung: REFDIV und IMULT mssen gleichzeitig gesetzt werden!
+				// Andernfalls hngt sich der Microcontroller auf (siehe S. 233
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				uint32_t REFDIV = 0;
+				uint32_t IMULT  = 20;
+				uint32_t ODIV   = 0;
+				ClkCfgRegs.SYSPLLMULT.all = ((REFDIV << 24) | (ODIV << 16) | IMULT);
+				// PLL-Stromversorgung einschalten
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 1;
+				// Warten bis die PLL eingerastet ist
+				while (ClkCfgRegs.SYSPLLSTS.bit.LOCKS == 0);
+				// PLLRAWCLK mit dem DCC0-Modul berprfen. Falls die Abweichung zwischen
+				// Mess- und Referenzsignal zu gro ist, Programm anhalten
+				if (!DeviceCheckPll(DEVICE_DCC_REFERENCE_INTOSC2, REFDIV, IMULT, ODIV))
+				{
+						__asm(" ESTOP0");
+				}
+				// Ab hier wird das Programm nur weiter ausgefhrt, falls die
+				// Takt-Initialisierung erfolgreich war. Takteiler fr fr den
+				// Systemtakt um 1 grer setzen als der tatschliche Wert fr
+				// den Betrieb um so die Stromaufnahme beim Umschalten der PLL
+				// als Systemtaktgeber zu reduzieren (siehe Punkt 8 S. 173
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 1;
+				// PLL als Systemtakt setzen und 200 Takte warten
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 1;
+				asm(" RPT #199 || NOP");
+				// Takteiler fr fr den Systemtakt auf 1 setzen (SYSCLK = PLLOUT)
+				ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 0;
+				// Taktteiler fr den Low-Speed Peripheral Clock auf 4 setzen -> 50 MHz
+				// Takt geht u.a. an: SPI- und UART-Clock
+				// (siehe S. 165 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// 0: Teiler = 1
+				// 1: Teiler = 2
+				// 2: Teiler = 4
+				// 3: Teiler = 6
+				// 4: Teiler = 8
+				// 5: Teiler = 10
+				// 6: Teiler = 12
+				// 7: Teiler = 14
+				ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = 2;
+				// PWM-Vorteiler (SYSCLK -> EPWMCLK) auf 2 setzen
+				// (siehe S. 2861 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// Dieser Takt geht auch zu den CLB-Modulen
+				// (siehe S. 1176 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// 0: Teiler = 1
+				// 1: Teiler = 2
+				ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV = 1;
+    }
+    // Externer (Single-Ended) 25 MHz Oszillator
+    else if (clockSource == DEVICE_CLKSRC_EXTOSC_SE_25MHZ)
+    {
+				// PPL umgehen und 120 Takte warten bis diese nderung wirksam wird
+    		// (siehe S. 173 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 0;
+				asm(" RPT #119 || NOP");
+				// PLL-Stromversorgung ausschalten und 60 Takte warten bis diese nderung wirksam wird
+				// (siehe S. 173 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 0;
+				asm(" RPT #59 || NOP");
+				// Stromversorgung fr den externen Oszillator einschalten
+				ClkCfgRegs.XTALCR.bit.OSCOFF = 0;
+				// Betriebsart auf Single-Ended setzen
+				ClkCfgRegs.XTALCR.bit.SE = 1;
+				// Kurz warten bis der Oszillator eingeschaltet und eingeschwungen ist
+				DELAY_US(1000);
+				// Vier mal den Flankenzhler von Pin X1 zurcksetzen
+				// (siehe S. 248 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				for (uint32_t i=0; i<4; i++)
+				{
+						// Flankenzhler von Pin X1 zurcksetzen. Vorgang
+						// solange wiederholen, bis der Zhler erfolgreich
+						// zurckgesetzt wurde
+						while (ClkCfgRegs.X1CNT.bit.X1CNT == 0x3FF)
+						{
+								// Zhlerstand lschen
+								ClkCfgRegs.X1CNT.bit.CLR = 1;
+								// Lschvorgang beenden
+								ClkCfgRegs.X1CNT.bit.CLR = 0;
+						}
+						// Warten bis der Endwert des Flankenzhlers erreicht wurde
+						while (ClkCfgRegs.X1CNT.bit.X1CNT < 0x3FF);
+				}
+				// Externen Oszillator als Taktquelle setzen
+				ClkCfgRegs.CLKSRCCTL1.bit.OSCCLKSRCSEL = 1;
+				// Prfen ob ein Takt besteht und Programm
+				// anhalten, falls dies nicht der Fall ist
+				// 0: Takt besteht
+				// 1: Takt fehlt
+				if(ClkCfgRegs.MCDCR.bit.MCLKSTS == 1)
+				{
+						__asm(" ESTOP0");
+				}
+				// Teiler und Miltiplikatoren der PLL konfigurieren (siehe S. 172
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+				// f_PLL = (f_OSCCLK / (REFDIV+1)) * (IMULT / (ODIV+1))
+				// f_PLL = 200 MHZ: REFDIV = 24; ODIV = 0, IMULT = 200
+				// Achtung: REFDIV und IMULT mssen gleichzeitig gesetzt werden!
+				// Andernfalls hngt sich der Microcontroller auf (siehe S. 233
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				uint32_t REFDIV = 24;
+				uint32_t IMULT  = 200;
+				uint32_t ODIV   = 0;
+				ClkCfgRegs.SYSPLLMULT.all = ((REFDIV << 24) | (ODIV << 16) | IMULT);
+				// PLL-Stromversorgung einschalten
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 1;
+				// Warten bis die PLL eingerastet ist
+				while (ClkCfgRegs.SYSPLLSTS.bit.LOCKS == 0);
+				// PLLRAWCLK mit dem DCC0-Modul berprfen. Falls die Abweichung zwischen
+				// Mess- und Referenzsignal zu gro ist, Programm anhalten
+				if (!DeviceCheckPll(DEVICE_DCC_REFERENCE_XTAL, REFDIV, IMULT, ODIV))
+				{
+						__asm(" ESTOP0");
+				}
+				// Ab hier wird das Programm nur weiter ausgefhrt, falls die
+				// Takt-Initialisierung erfolgreich war. Takteiler fr fr den
+				// Systemtakt um 1 grer setzen als der tatschliche Wert fr
+				// den Betrieb um so die Stromaufnahme beim Umschalten der PLL
+				// als Systemtaktgeber zu reduzieren (siehe Punkt 8 S. 173
+				// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022))
+				ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 1;
+				// PLL als Systemtakt setzen und 200 Takte warten
+				ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 1;
+				asm(" RPT #199 || NOP");
+				// Takteiler fr fr den Systemtakt auf den Wert fr den gewnschten Takt setzen
+				ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 0;
+				// Taktteiler fr den Low-Speed Peripheral Clock auf 4 setzen -> 50 MHz
+				// Takt geht u.a. an: SPI- und UART-Clock
+				// (siehe S. 165 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// 0: Teiler = 1
+				// 1: Teiler = 2
+				// 2: Teiler = 4
+				// 3: Teiler = 6
+				// 4: Teiler = 8
+				// 5: Teiler = 10
+				// 6: Teiler = 12
+				// 7: Teiler = 14
+				ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = 2;
+				// PWM-Vorteiler (SYSCLK -> EPWMCLK) auf 2 setzen
+				// (siehe S. 2861 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// Dieser Takt geht auch zu den CLB-Modulen
+				// (siehe S. 1176 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				// 0: Teiler = 1
+				// 1: Teiler = 2
+				ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV = 1;
+    }
+    // Ungltiger Funktionsparameter -> Programm abbrechen
+    else
+    {
+    		__asm(" ESTOP0");
+    }
+
+    // Funktion kalibriert ADC-Referenz, DAC-Offset und die internen Oszillatoren
+    DEVICE_CALIBRATION();
+
+    // Interrupts initialisieren:
+		// Interrupts global ausschalten
+		DINT;
+		// PIE-Vector-Table ausschalten
+		PieCtrlRegs.PIECTRL.bit.ENPIE = 0;
+		// Alle Interrupts (Interrupt-Gruppen) ausschalten
+		PieCtrlRegs.PIEIER1.all  = 0;
+		PieCtrlRegs.PIEIER2.all  = 0;
+		PieCtrlRegs.PIEIER3.all  = 0;
+		PieCtrlRegs.PIEIER4.all  = 0;
+		PieCtrlRegs.PIEIER5.all  = 0;
+		PieCtrlRegs.PIEIER6.all  = 0;
+		PieCtrlRegs.PIEIER7.all  = 0;
+		PieCtrlRegs.PIEIER8.all  = 0;
+		PieCtrlRegs.PIEIER9.all  = 0;
+		PieCtrlRegs.PIEIER10.all = 0;
+		PieCtrlRegs.PIEIER11.all = 0;
+		PieCtrlRegs.PIEIER12.all = 0;
+		// Alle Interrupt-Flags (Gruppen-Flags) lschen
+		PieCtrlRegs.PIEIFR1.all  = 0;
+		PieCtrlRegs.PIEIFR2.all  = 0;
+		PieCtrlRegs.PIEIFR3.all  = 0;
+		PieCtrlRegs.PIEIFR4.all  = 0;
+		PieCtrlRegs.PIEIFR5.all  = 0;
+		PieCtrlRegs.PIEIFR6.all  = 0;
+		PieCtrlRegs.PIEIFR7.all  = 0;
+		PieCtrlRegs.PIEIFR8.all  = 0;
+		PieCtrlRegs.PIEIFR9.all  = 0;
+		PieCtrlRegs.PIEIFR10.all = 0;
+		PieCtrlRegs.PIEIFR11.all = 0;
+		PieCtrlRegs.PIEIFR12.all = 0;
+		// Alle CPU-Interrupts ausschalten und deren Flags lschen
+		IER = 0x0000;
+		IFR = 0x0000;
+		// PIE-Vector-Table einschalten (speichert
+		// die Adressen der Interupt-Service-Routinen)
+		PieCtrlRegs.PIECTRL.bit.ENPIE = 1;
+		// Interrupts global einschalten
+		EINT;
+
+		// Peripherie und GPIOs zuordnen, bevor CPU2 startet
+		if (deviceOwnership != 0)
+		{
+				DeviceApplyOwnership(deviceOwnership);
+				EALLOW;
+		}
+
+		// CPU2 booten
+		DeviceBootCPU2();
+
+		// Register-Schreibschutz setzen
+		EDIS;
+#endif
+}
+
+
+//=== Function: DeviceInitCPU2 ====================================================================
+///
+/// @brief  Funktion fhrt (durch CPU2) eine Initialisation durch:
+///					- Speicherinhalte zeitkritischer Funktionen von FLASH in dern RAM kopieren
+///					- CPU-Interrupts aus-, PIE-Vectrotabelle ein- und Interrupts global einschalten
+///
+/// @param  uint32_t clockSource
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceInitCPU2(void)
+{
+#ifdef CPU2
+    // Zeitkritische Funktion in den RAM kopieren, wenn der Flash genutzt wird.
+    // Wird das nicht gemacht, funktioniert der Code nicht weil z.B. die Funktion
+    // DELAY_US() angehalten wird und das Programm dann nicht weiterluft. Die
+    // Namen der Variablen sind Platzhalter fr Konstanten des Linkers und drfen
+		// daher nicht verndert werden.
+    extern Uint16 RamfuncsRunStart, RamfuncsLoadStart, RamfuncsLoadSize;
+#ifdef _FLASH
+    // Flash-Initialisierungsfunktion in den RAM-Speicher kopieren
+		memcpy(&RamfuncsRunStart, &RamfuncsLoadStart, (size_t)&RamfuncsLoadSize);
+#endif
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+    // Interrupts initialisieren:
+		// Das Vorgehen entspricht exakt dem von CPU1 (gleiche Registernamen),
+		// da CPU1 und CPU2 identisch aufgebaute PIE-Module besitzen und diese
+		// entsprechend unabhngig von einander sind (siehe S. 146 Reference
+		// Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Interrupts global ausschalten
+		DINT;
+		// PIE-Vector-Table ausschalten
+		PieCtrlRegs.PIECTRL.bit.ENPIE = 0;
+		// Alle Interrupts (Interrupt-Gruppen) ausschalten
+		PieCtrlRegs.PIEIER1.all  = 0;
+		PieCtrlRegs.PIEIER2.all  = 0;
+		PieCtrlRegs.PIEIER3.all  = 0;
+		PieCtrlRegs.PIEIER4.all  = 0;
+		PieCtrlRegs.PIEIER5.all  = 0;
+		PieCtrlRegs.PIEIER6.all  = 0;
+		PieCtrlRegs.PIEIER7.all  = 0;
+		PieCtrlRegs.PIEIER8.all  = 0;
+		PieCtrlRegs.PIEIER9.all  = 0;
+		PieCtrlRegs.PIEIER10.all = 0;
+		PieCtrlRegs.PIEIER11.all = 0;
+		PieCtrlRegs.PIEIER12.all = 0;
+		// Alle Interrupt-Flags (Gruppen-Flags) lschen
+		PieCtrlRegs.PIEIFR1.all  = 0;
+		PieCtrlRegs.PIEIFR2.all  = 0;
+		PieCtrlRegs.PIEIFR3.all  = 0;
+		PieCtrlRegs.PIEIFR4.all  = 0;
+		PieCtrlRegs.PIEIFR5.all  = 0;
+		PieCtrlRegs.PIEIFR6.all  = 0;
+		PieCtrlRegs.PIEIFR7.all  = 0;
+		PieCtrlRegs.PIEIFR8.all  = 0;
+		PieCtrlRegs.PIEIFR9.all  = 0;
+		PieCtrlRegs.PIEIFR10.all = 0;
+		PieCtrlRegs.PIEIFR11.all = 0;
+		PieCtrlRegs.PIEIFR12.all = 0;
+		// Alle CPU-Interrupts ausschalten und deren Flags lschen
+		IER = 0x0000;
+		IFR = 0x0000;
+		// PIE-Vector-Table einschalten (speichert
+		// die Adressen der Interupt-Service-Routinen)
+		PieCtrlRegs.PIECTRL.bit.ENPIE = 1;
+		// Interrupts global einschalten
+		EINT;
+
+		// Alle IPC-Flags lschen
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCCLR.all = 0xFFFF;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+#endif
+}
+
+
+//=== Function: DeviceBootCPU2 ====================================================================
+///
+/// @brief  Funktion steuert den Boot-Prozess von CPU2. Mit DEVICE_CPU2_BOOT_ASYNC kehrt die
+///					Funktion zurck, sobald CPU2 aus dem Reset geholt wurde, und CPU1 wartet erst in
+///					DeviceJoinCPU2() auf das Ende des Boot-Prozesses
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceBootCPU2(void)
+{
+#ifdef CPU1
+    // CPU2 durch CPU1 booten:
+    // Register-Schreibschutz aufheben
+    EALLOW;
+    // Boot-Mode setzen (siehe S. 716 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#ifdef _FLASH
+    Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCBOOTMODE = (  DEVICE_CPU2_BOOTMODE_KEY
+    																					 | DEVICE_CPU2_FREQ_200MHZ
+																							 | DEVICE_CPU2_BOOTMODE_FLASH_SECTOR0);
+#else
+    Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCBOOTMODE = (  DEVICE_CPU2_BOOTMODE_KEY
+    																					 | DEVICE_CPU2_FREQ_200MHZ
+																							 | DEVICE_CPU2_BOOTMODE_RAM);
+#endif
+    // IPCFLG0 setzen (wird von CPU2 whrend ihres Boot-Prozesses
+    // gelscht, siehe S. 715 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.bit.IPC0 = 1;
+    // CPU2 aus dem Reset holen. Dieses Register wird nur dann verndert, wenn
+    // das gesamte Register beschrieben wird (32 Bit Schreibbefehl) und dabei
+    // die oberen 16 Bit mit einem gltigen Schlssel beschrieben werden (siehe
+    // S. 446 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    // 0: CPU2-Reset deaktiviert
+    // 1: CPU2-Reset aktiviert
+    DevCfgRegs.CPU2RESCTL.all = (DEVICE_CPU2_RESET_KEY | DEVICE_CPU2_CLEAR_RESET);
+		deviceCpu2Booting = true;
+
+#if DEVICE_CPU2_BOOT_ASYNC == 0
+		DeviceJoinCPU2();
+#endif
+#endif
+}
+
+
+//=== Function: DeviceJoinCPU2 ====================================================================
+///
+/// @brief  Funktion wartet, bis CPU2 aus dem Reset ist und mit dem Booten fertig ist, und lscht
+///					danach alle IPC-Flags von CPU1. Muss vor dem ersten Setzen eines IPC-Flags und vor
+///					DeviceSetSysclk() aufgerufen werden. Weitere Aufrufe kehren sofort zurck
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceJoinCPU2(void)
+{
+#ifdef CPU1
+		if (!deviceCpu2Booting)
+				return;
+
+    // Warten, bis CPU2 aus dem Reset ist
+    // 0: CPU2 ist im Reset
+    // 1: CPU2 ist nicht im Reset
+    while (DevCfgRegs.RSTSTAT.bit.CPU2RES == DEVICE_CPU2_IS_IN_RESET);
+    // Warten bis CPU2 mit dem Booten fertig ist (siehe S. 750
+    // Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    while (Cpu1toCpu2IpcRegs.CPU2TOCPU1IPCBOOTSTS & DEVICE_CPU2_BOOTSTATE_FINISHED);
+		// Alle IPC-Flags lschen
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCCLR.all = 0xFFFF;
+		deviceCpu2Booting = false;
+#endif
+}
+
+
+//=== Function: DeviceInitFlashMemory =============================================================
+///
+/// @brief  Funktion initialisert den Flah-Speicher mit dem Flash-Profil fr den Systemtakt
+///					DEVICE_SYSCLK_MHZ (Wartezustnde DEVICE_FLASH_RWAIT, ECC und Cache/Prefetch
+///					nach DEVICE_FLASH_ECC und DEVICE_FLASH_CACHE)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceInitFlashMemory(void)
+{
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+    // Nach einem Reset sind Flash-Bank und -Pump
+    // ausgeschaltet und mssen eingeschaltet werden
+    Flash0CtrlRegs.FPAC1.bit.PMPPWR       = 0x01;
+    Flash0CtrlRegs.FBFALLBACK.bit.BNKPWR0 = 0x03;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		// Flash-Profil fr den Systemtakt setzen
+		DeviceSetFlashProfile(DEVICE_FLASH_RWAIT, DEVICE_FLASH_ECC, DEVICE_FLASH_CACHE);
+}
+
+
+//=== Function: DeviceSetFlashProfile =============================================================
+///
+/// @brief  Funktion setzt die Wartezustnde, das ECC und Cache/Prefetch des Flash-Speichers. Die
+///					Funktion muss aus dem RAM ausgefhrt werden (.TI.ramfunc). Die Wartezustnde drfen
+///					nicht kleiner als DeviceGetFlashRwait() fr den aktuellen Systemtakt sein. Bei
+///					eingeschaltetem ECC werden Einzelbitfehler korrigiert und gezhlt (siehe
+///					DeviceGetFlashSingleBitErrors()), der Zhler und die Fehlerflags werden gelscht
+///
+/// @param  uint16_t rwait, bool ecc, bool cache
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceSetFlashProfile(uint16_t rwait, bool ecc, bool cache)
+{
+    // Register-Schreibschutz aufheben
+    EALLOW;
+
+    // Cache und Prefetch vor dem ndern der Wartezeit ausschalten
+    Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN = 0;
+    Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN   = 0;
+    // Wartezeit setzen (nicht kleiner als das Minimum fr den Systemtakt)
+    if (rwait < DeviceGetFlashRwait(deviceSysclkMhz))
+    {
+    		rwait = DeviceGetFlashRwait(deviceSysclkMhz);
+    }
+    Flash0CtrlRegs.FRDCNTL.bit.RWAIT = rwait;
+    // Error-Correction-Code-Protection ein- oder ausschalten. Dieses Modul
+    // kann Fehler im Flash-Speicher erkennen und ausblenden
+    // (siehe S. 1486 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    if (ecc)
+    {
+    		// Zhler fr Einzelbitfehler bis zum Maximalwert laufen lassen
+    		// (kein Interrupt) und Zhler sowie Fehlerflags lschen
+    		Flash0EccRegs.ERR_THRESHOLD.bit.ERR_THRESHOLD = 0xFFFF;
+    		Flash0EccRegs.ERR_CNT.bit.ERR_CNT             = 0;
+    		Flash0EccRegs.ERR_STATUS_CLR.all              = 0x00070007UL;
+    		Flash0EccRegs.ERR_INTCLR.all                  = 0x03;
+    		Flash0EccRegs.ECC_ENABLE.bit.ENABLE           = DEVICE_FLASH_ECC_ENABLE_KEY;
+    }
+    else
+    {
+    		Flash0EccRegs.ECC_ENABLE.bit.ENABLE = 0x00;
+    }
+    // Cache und Prefetch nach dem ndern der Wartezeit wieder
+    // einschalten. Dadurch wird die Code-Performance verbessert
+    if (cache)
+    {
+    		Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN = 1;
+    		Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN   = 1;
+    }
+    // 8 CPU-Takte warten damit die obigen Register-Operationen
+    // abgeschlossen sind, bevor weiterer Code ausgefhrt wird
+    __asm(" RPT #7 || NOP");
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: DeviceGetFlashSingleBitErrors =====================================================
+///
+/// @brief  Funktion gibt die Anzahl der vom ECC korrigierten Einzelbitfehler des Flash-Speichers
+///					seit dem letzten Lschen zurck. Ein steigender Wert deutet auf einen alternden
+///					oder fehlerhaft programmierten Flash-Sektor hin
+///
+/// @param  void
+///
+/// @return uint16_t errors
+///
+//=================================================================================================
+uint16_t DeviceGetFlashSingleBitErrors(void)
+{
+		return Flash0EccRegs.ERR_CNT.bit.ERR_CNT;
+}
+
+
+//=== Function: DeviceClearFlashErrors ============================================================
+///
+/// @brief  Funktion lscht den Zhler fr Einzelbitfehler und die Fehlerflags des ECC
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceClearFlashErrors(void)
+{
+		EALLOW;
+		Flash0EccRegs.ERR_CNT.bit.ERR_CNT = 0;
+		Flash0EccRegs.ERR_STATUS_CLR.all  = 0x00070007UL;
+		Flash0EccRegs.ERR_INTCLR.all      = 0x03;
+		EDIS;
+}
+
+
+//=== Function: DeviceBenchmarkFlash ==============================================================
+///
+/// @brief  Funktion misst, wie viele Systemtakte der Benchmark-Code bei Ausfhrung aus dem Flash
+///					bentigt, und speichert die Ergebnisse in "deviceFlashBenchmark":
+///					[0] gewhltes Profil (DEVICE_FLASH_RWAIT, DEVICE_FLASH_ECC, DEVICE_FLASH_CACHE)
+///					[1] wie [0], aber ohne ECC (Kosten des ECC)
+///					[2] wie [0], aber ohne Cache und Prefetch
+///					[3] wie [0], aber mit einem zustzlichen Wartezustand
+///					Danach wird wieder das gewhlte Profil gesetzt. Die Funktion nutzt CPU-Timer 2 und
+///					muss daher vor dessen Verwendung (z.B. ProfileInit()) aufgerufen werden. Nur in der
+///					FLASH-Konfiguration aussagekrftig
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceBenchmarkFlash(void)
+{
+		// CPU-Timer 2 mit dem Systemtakt frei laufen lassen
+		CpuTimer2Regs.TCR.bit.TSS = 1;
+		CpuTimer2Regs.TCR.bit.TIE = 0;
+		CpuTimer2Regs.PRD.all     = 0xFFFFFFFFUL;
+		CpuTimer2Regs.TPR.all     = 0;
+		CpuTimer2Regs.TPRH.all    = 0;
+		CpuTimer2Regs.TCR.bit.TRB = 1;
+		CpuTimer2Regs.TCR.bit.TSS = 0;
+
+		DeviceFlashBenchmarkRun(&deviceFlashBenchmark[0], DEVICE_FLASH_RWAIT, DEVICE_FLASH_ECC, DEVICE_FLASH_CACHE);
+		DeviceFlashBenchmarkRun(&deviceFlashBenchmark[1], DEVICE_FLASH_RWAIT, false, DEVICE_FLASH_CACHE);
+		DeviceFlashBenchmarkRun(&deviceFlashBenchmark[2], DEVICE_FLASH_RWAIT, DEVICE_FLASH_ECC, false);
+		DeviceFlashBenchmarkRun(&deviceFlashBenchmark[3], DEVICE_FLASH_RWAIT + 1, DEVICE_FLASH_ECC, DEVICE_FLASH_CACHE);
+
+		// Gewhltes Profil wieder setzen und Timer anhalten
+		DeviceSetFlashProfile(DEVICE_FLASH_RWAIT, DEVICE_FLASH_ECC, DEVICE_FLASH_CACHE);
+		CpuTimer2Regs.TCR.bit.TSS = 1;
+}
+
+
+//=== Function: DeviceGetFlashRwait ===============================================================
+///
+/// @brief  Funktion gibt die minimalen Wartezustnde des Flash-Speichers fr einen Systemtakt
+///					zurck (siehe Tabelle "Flash Wait States" im Datenblatt TMS320F2838x, SPRSP14,
+///					gleiche Grenzen wie DEVICE_FLASH_RWAIT)
+///
+/// @param  uint16_t mhz
+///
+/// @return uint16_t rwait
+///
+//=================================================================================================
+uint16_t DeviceGetFlashRwait(uint16_t mhz)
+{
+		if (mhz > 150)
+				return 3;
+		if (mhz > 100)
+				return 2;
+		if (mhz > 50)
+				return 1;
+		return 0;
+}
+
+
+//=== Function: DeviceSetSysclk ===================================================================
+///
+/// @brief  Funktion stellt den Systemtakt zur Laufzeit um (DEVICE_SYSCLK_MIN_MHZ bis
+///					DEVICE_SYSCLK_MHZ, mit INTOSC2 in 10 MHz-Schritten, mit dem externen 25 MHz-
+///					Oszillator in 1 MHz-Schritten). Die PLL wird wie in DeviceInitCPU1() umgangen, neu
+///					konfiguriert, mit dem DCC0-Modul geprft und wieder als Systemtakt gesetzt. Beim
+///					Erhhen werden die Wartezustnde des Flash-Speichers vorher, beim Verringern
+///					danach auf das Minimum fr den neuen Takt gesetzt. Anschlieend wird
+///					"deviceSysclkMhz" (DELAY_US(), DEVICE_LSPCLK_HZ) aktualisiert und alle mit
+///					DeviceRegisterClockCallback() angemeldeten Funktionen werden aufgerufen, damit sie
+///					ihre Perioden und Bittakte umrechnen. Whrend der Umstellung (PLL-Lock, einige
+///					10 s) sind die Interrupts gesperrt und SYSCLK = OSCCLK. Nur von CPU1 aufrufen, der
+///					Takt von CPU2 ndert sich mit. Die Funktion luft aus dem RAM
+///
+/// @param  uint16_t mhz
+///
+/// @return bool changed (false: ungltiger Takt oder Aufruf von CPU2)
+///
+//=================================================================================================
+#pragma CODE_SECTION(DeviceSetSysclk, ".TI.ramfunc");
+bool DeviceSetSysclk(uint16_t mhz)
+{
+#ifdef CPU1
+		uint16_t oldMhz = deviceSysclkMhz;
+		uint32_t REFDIV, IMULT, ODIV = 0;
+		uint32_t referenceSource;
+		uint16_t interruptState;
+
+		if ((mhz < DEVICE_SYSCLK_MIN_MHZ) || (mhz > DEVICE_SYSCLK_MHZ))
+				return false;
+		if (mhz == oldMhz)
+				return true;
+		// Der Boot-Prozess von CPU2 luft mit dem Takt von DeviceInit()
+		DeviceJoinCPU2();
+
+		// Teiler und Multiplikator der PLL wie in DeviceInitCPU1():
+		// f_PLL = (f_OSCCLK / (REFDIV+1)) * (IMULT / (ODIV+1))
+		if (deviceClockSource == DEVICE_CLKSRC_EXTOSC_SE_25MHZ)
+		{
+				REFDIV = 24;
+				IMULT  = mhz;
+				referenceSource = DEVICE_DCC_REFERENCE_XTAL;
+		}
+		else
+		{
+				if ((mhz % 10) != 0)
+						return false;
+				REFDIV = 0;
+				IMULT  = mhz / 10;
+				referenceSource = DEVICE_DCC_REFERENCE_INTOSC2;
+		}
+
+		interruptState = __disable_interrupts();
+		EALLOW;
+
+		// Hherer Takt: zuerst die Wartezustnde erhhen
+		if (mhz > oldMhz)
+				DeviceSetFlashRwait(DeviceGetFlashRwait(mhz));
+
+		// PPL umgehen (SYSCLK = OSCCLK) und ausschalten, Wartezeiten wie in DeviceInitCPU1()
+		ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 0;
+		asm(" RPT #119 || NOP");
+		ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 0;
+		asm(" RPT #59 || NOP");
+		// REFDIV und IMULT gleichzeitig setzen, PLL einschalten und warten bis sie eingerastet ist
+		ClkCfgRegs.SYSPLLMULT.all = ((REFDIV << 24) | (ODIV << 16) | IMULT);
+		ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 1;
+		while (ClkCfgRegs.SYSPLLSTS.bit.LOCKS == 0);
+		if (!DeviceCheckPll(referenceSource, REFDIV, IMULT, ODIV))
+		{
+				__asm(" ESTOP0");
+		}
+		// PLL mit um 1 grerem Teiler als Systemtakt setzen, 200 Takte warten, Teiler auf 1
+		ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 1;
+		ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 1;
+		asm(" RPT #199 || NOP");
+		ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = 0;
+
+		// Niedrigerer Takt: erst danach die Wartezustnde verringern
+		if (mhz < oldMhz)
+				DeviceSetFlashRwait(DeviceGetFlashRwait(mhz));
+
+		EDIS;
+
+		deviceSysclkMhz = mhz;
+		for (uint16_t i = 0; i < deviceNumberOfClockCallbacks; i++)
+		{
+				deviceClockCallbacks[i](oldMhz, mhz);
+		}
+
+		__restore_interrupts(interruptState);
+		return true;
+#else
+		return false;
+#endif
+}
+
+
+//=== Function: DeviceRegisterClockCallback =======================================================
+///
+/// @brief  Funktion meldet eine Funktion an, die nach jeder nderung des Systemtakts durch
+///					DeviceSetSysclk() mit dem alten und neuen Takt aufgerufen wird (bei gesperrten
+///					Interrupts). Jeder Treiber rechnet darin die Perioden und Bittakte seiner Module um,
+///					z.B. mit DeviceScaleCpuTimer(), DeviceScaleEpwm() oder DeviceScaleSci()
+///
+/// @param  DeviceClockCallback callback
+///
+/// @return bool registered (false: bereits DEVICE_MAX_CLOCK_CALLBACKS Funktionen angemeldet)
+///
+//=================================================================================================
+bool DeviceRegisterClockCallback(DeviceClockCallback callback)
+{
+		if (deviceNumberOfClockCallbacks >= DEVICE_MAX_CLOCK_CALLBACKS)
+				return false;
+
+		deviceClockCallbacks[deviceNumberOfClockCallbacks++] = callback;
+		return true;
+}
+
+
+//=== Function: DeviceScaleCpuTimer ===============================================================
+///
+/// @brief  Funktion rechnet die Periode eines CPU-Timers auf den neuen Systemtakt um, damit die
+///					Periodendauer gleich bleibt (wird beim nchsten Nulldurchgang geladen)
+///
+/// @param  volatile struct CPUTIMER_REGS *regs, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceScaleCpuTimer(volatile struct CPUTIMER_REGS *regs, uint16_t oldMhz, uint16_t newMhz)
+{
+		regs->PRD.all = DeviceScale(regs->PRD.all + 1UL, oldMhz, newMhz) - 1UL;
+}
+
+
+//=== Function: DeviceScaleEpwm ===================================================================
+///
+/// @brief  Funktion rechnet Periode (TBPRD) und Vergleichswerte (CMPA, CMPB) eines ePWM-Moduls
+///					auf den neuen Systemtakt um, damit Frequenz und Tastgrad gleich bleiben. Werte
+///					ber 16 Bit werden begrenzt
+///
+/// @param  volatile struct EPWM_REGS *regs, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceScaleEpwm(volatile struct EPWM_REGS *regs, uint16_t oldMhz, uint16_t newMhz)
+{
+		uint32_t period = DeviceScale(regs->TBPRD, oldMhz, newMhz);
+		uint32_t cmpa   = DeviceScale(regs->CMPA.bit.CMPA, oldMhz, newMhz);
+		uint32_t cmpb   = DeviceScale(regs->CMPB.bit.CMPB, oldMhz, newMhz);
+
+		regs->TBPRD         = (period > 0xFFFF) ? 0xFFFF : period;
+		regs->CMPA.bit.CMPA = (cmpa > 0xFFFF) ? 0xFFFF : cmpa;
+		regs->CMPB.bit.CMPB = (cmpb > 0xFFFF) ? 0xFFFF : cmpb;
+}
+
+
+//=== Function: DeviceScaleSci ====================================================================
+///
+/// @brief  Funktion rechnet den Baudraten-Teiler eines SCI-Moduls (UART) auf den neuen
+///					Low-Speed Peripheral Clock um, damit die Baudrate gleich bleibt
+///					(BRR = LSPCLK / (BAUD * 8) - 1)
+///
+/// @param  volatile struct SCI_REGS *regs, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceScaleSci(volatile struct SCI_REGS *regs, uint16_t oldMhz, uint16_t newMhz)
+{
+		uint32_t divider = ((uint32_t)regs->SCIHBAUD.bit.BAUD << 8) | regs->SCILBAUD.bit.BAUD;
+
+		divider = DeviceScale(divider + 1UL, oldMhz, newMhz) - 1UL;
+		if (divider > 0xFFFF)
+				divider = 0xFFFF;
+		regs->SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
+		regs->SCILBAUD.bit.BAUD =  divider & 0x00FF;
+}
+
+
+//=== Function: DeviceScaleSpi ====================================================================
+///
+/// @brief  Funktion rechnet den Bittakt-Teiler eines SPI-Moduls auf den neuen Low-Speed
+///					Peripheral Clock um (SPI-CLK = LSPCLK / (SPIBRR + 1), SPIBRR = 3 ... 127). Das Modul
+///					wird dazu kurz in den Reset gesetzt, eine laufende bertragung wird abgebrochen
+///
+/// @param  volatile struct SPI_REGS *regs, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceScaleSpi(volatile struct SPI_REGS *regs, uint16_t oldMhz, uint16_t newMhz)
+{
+		uint32_t rate = regs->SPIBRR.bit.SPI_BIT_RATE;
+
+		// SPIBRR = 0 ... 2: SPI-CLK = LSPCLK / 4
+		if (rate < 3)
+				rate = 3;
+		rate = DeviceScale(rate + 1UL, oldMhz, newMhz) - 1UL;
+		if (rate < 3)
+				rate = 3;
+		if (rate > 127)
+				rate = 127;
+
+		regs->SPICCR.bit.SPISWRESET = 0;
+		regs->SPIBRR.bit.SPI_BIT_RATE = rate;
+		regs->SPICCR.bit.SPISWRESET = 1;
+}
+
+
+//=== Function: DeviceScaleI2c ====================================================================
+///
+/// @brief  Funktion rechnet den Vorteiler eines I2C-Moduls auf den neuen Systemtakt um, damit
+///					der Modultakt (7 bis 12 MHz) und damit ICCL/ICCH gleich bleiben
+///					(Modultakt = SYSCLK / (IPSC + 1)). IPSC darf nur im Reset (IRS = 0) gendert
+///					werden, eine laufende bertragung wird abgebrochen
+///
+/// @param  volatile struct I2C_REGS *regs, uint16_t oldMhz, uint16_t newMhz
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceScaleI2c(volatile struct I2C_REGS *regs, uint16_t oldMhz, uint16_t newMhz)
+{
+		uint32_t prescaler = DeviceScale(regs->I2CPSC.bit.IPSC + 1UL, oldMhz, newMhz);
+
+		if (prescaler == 0)
+				prescaler = 1;
+		if (prescaler > 256)
+				prescaler = 256;
+
+		regs->I2CMDR.bit.IRS = 0;
+		regs->I2CPSC.bit.IPSC = prescaler - 1UL;
+		regs->I2CMDR.bit.IRS = 1;
+}
+
+
+//=== Function: DeviceSetOwnership ================================================================
+///
+/// @brief  Funktion bergibt die Zuordnung der Peripherie und GPIOs eines Projekts. Wird vor
+///					DeviceInit() aufgerufen, damit die Zuordnung geschrieben ist, bevor CPU2 bootet. Die
+///					Tabelle muss gltig bleiben (const/global)
+///
+/// @param  const DeviceOwnership *ownership
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceSetOwnership(const DeviceOwnership *ownership)
+{
+		deviceOwnership = ownership;
+}
+
+
+//=== Function: DeviceApplyOwnership ==============================================================
+///
+/// @brief  Funktion schreibt die Zuordnung aller Peripherie und GPIOs einer Tabelle. Wird von
+///					DeviceInit() aufgerufen, falls mit DeviceSetOwnership() eine Tabelle bergeben wurde
+///
+/// @param  const DeviceOwnership *ownership
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceApplyOwnership(const DeviceOwnership *ownership)
+{
+		for (uint16_t i = 0; i < ownership->numberOfPeripherals; i++)
+		{
+				DeviceAssignPeripheral(ownership->peripherals[i].peripheral,
+															 ownership->peripherals[i].owner);
+		}
+		for (uint16_t i = 0; i < ownership->numberOfPins; i++)
+		{
+				DeviceAssignPins(&ownership->pins[i].pin, 1, ownership->pins[i].owner);
+		}
+}
+
+
+//=== Function: DeviceAssignPeripheral ============================================================
+///
+/// @brief  Funktion ordnet eine Peripherie CPU1 oder CPU2 zu (Bit im Register CPUSELx, die
+///					Register liegen im Abstand von 32 Bit hintereinander). Nur CPU1 darf die Register
+///					schreiben. Die DMA-Controller gehren fest zu ihrer CPU und werden nicht zugeordnet
+///
+/// @param  uint16_t peripheral (DEVICE_EPWM(), DEVICE_SPI(), ...), uint16_t owner
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceAssignPeripheral(uint16_t peripheral, uint16_t owner)
+{
+#ifdef CPU1
+		volatile uint32_t *cpusel = &DevCfgRegs.CPUSEL0.all + peripheral / 32U;
+		uint32_t mask = 1UL << (peripheral % 32U);
+
+		EALLOW;
+		if (owner == DEVICE_OWNER_CPU2)
+				*cpusel |= mask;
+		else
+				*cpusel &= ~mask;
+		EDIS;
+#endif
+}
+
+
+//=== Function: DeviceAssignPins ==================================================================
+///
+/// @brief  Funktion ordnet mehrere GPIOs CPU1 oder CPU2 zu (4 Bit je GPIO in den Registern
+///					GPxCSEL1 bis GPxCSEL4). Der Eigentmer darf die Datenregister des GPIOs schreiben,
+///					Multiplexer und Pull-Up werden weiterhin von CPU1 eingestellt. Nur CPU1 darf die
+///					Register schreiben
+///
+/// @param  const uint16_t *pins, uint16_t numberOfPins, uint16_t owner
+///
+/// @return void
+///
+//=================================================================================================
+void DeviceAssignPins(const uint16_t *pins, uint16_t numberOfPins, uint16_t owner)
+{
+#ifdef CPU1
+		uint32_t value = (owner == DEVICE_OWNER_CPU2) ? DEVICE_GPIO_CSEL_CPU2 : 0;
+
+		EALLOW;
+		for (uint16_t i = 0; i < numberOfPins; i++)
+		{
+				uint16_t pin = pins[i];
+				volatile uint32_t *csel;
+				uint16_t shift = (pin % 8U) * 4U;
+
+				if (pin >= DEVICE_NUMBER_OF_GPIOS)
+						continue;
+				// Die Register eines Ports belegen 0x40 Worte, GPxCSEL1 bis 4 enthalten je 8 GPIOs
+				csel = &GpioCtrlRegs.GPACSEL1.all
+							 + (pin / 32U) * (DEVICE_GPIO_PORT_REGS_SIZE / 2U) + (pin % 32U) / 8U;
+				*csel = (*csel & ~(0xFUL << shift)) | (value << shift);
+		}
+		EDIS;
+#endif
+}
+
+
+//=== Function: DeviceGetOwner ====================================================================
+///
+/// @brief  Funktion gibt den Eigentmer einer Peripherie aus dem Register CPUSELx zurck
+///
+/// @param  uint16_t peripheral (DEVICE_EPWM(), DEVICE_SPI(), ...)
+///
+/// @return uint16_t owner (DEVICE_OWNER_CPU1 oder DEVICE_OWNER_CPU2)
+///
+//=================================================================================================
+uint16_t DeviceGetOwner(uint16_t peripheral)
+{
+		volatile uint32_t *cpusel = &DevCfgRegs.CPUSEL0.all + peripheral / 32U;
+
+		return (*cpusel & (1UL << (peripheral % 32U))) ? DEVICE_OWNER_CPU2 : DEVICE_OWNER_CPU1;
+}
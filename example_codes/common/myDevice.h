@@ -0,0 +1,300 @@
+//=================================================================================================
+/// @file       myDevice.h
+///
+/// @brief      Datei enthlt Funktionen um den Mikrocontorller TMS320F2838x grundlegend zu
+///							initialisieren. Dazu wird der Watchdog-Timer ausgeschaltet, der Systemtakt
+///							eingestellt, der Flash-Speicher initialisiert und die Interrupts freigeschaltet
+///							und initialisiert.
+///
+///							nderung in Version 1.3: Flash-Profile abhngig vom Systemtakt (minimale
+///							Wartezustnde, ECC mit Zhler fr Einzelbitfehler, Cache und Prefetch) und
+///							Benchmark fr die Ausfhrungsgeschwindigkeit aus dem Flash
+///
+///							nderung in Version 1.4: Makros zur Platzierung von Variablen in den
+///							Speicherbereichen des Linker-Skripts (schnelle Daten im LSx-RAM,
+///							Messpuffer im GSx-RAM, DMA-Puffer und mit CPU2 geteilte Daten)
+///
+///							nderung in Version 1.5: Build-Profile. Mit DEVICE_BUILD_PERFORMANCE (Build-
+///							Konfiguration CPUx_FLASH_PERF) entfallen DEVICE_ASSERT() und die Messungen
+///							(DEVICE_INSTRUMENTATION)
+///
+///							nderung in Version 1.6: Systemtakt zur Laufzeit umstellbar (DeviceSetSysclk()).
+///							DELAY_US() und DEVICE_LSPCLK_HZ rechnen mit dem aktuellen Takt
+///							"deviceSysclkMhz", die Treiber melden mit DeviceRegisterClockCallback() eine
+///							Funktion an, die ihre Perioden und Bittakte umrechnet (DeviceScaleCpuTimer(),
+///							DeviceScaleEpwm(), DeviceScaleSci(), DeviceScaleSpi(), DeviceScaleI2c())
+///
+///							nderung in Version 1.7: Zuordnung der Peripherie und GPIOs zu CPU1 oder CPU2
+///							(DeviceAssignPeripheral(), DeviceAssignPins()). Die Zuordnung eines Projekts steht
+///							in einer Tabelle "DeviceOwnership", die mit DeviceSetOwnership() vor DeviceInit()
+///							bergeben und dort einmal vor dem Booten von CPU2 geschrieben wird
+///
+///							nderung in Version 1.8: Asynchroner Boot von CPU2 (DEVICE_CPU2_BOOT_ASYNC).
+///							DeviceInit() holt CPU2 nur aus dem Reset, DeviceJoinCPU2() wartet auf das Ende des
+///							Boot-Prozesses, bevor gemeinsame Ressourcen (IPC, Systemtakt) verwendet werden
+///
+/// @version    V1.8
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYDEVICE_H_
+#define MYDEVICE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+// Header fr das CLA-Modul (muss vor "f2838x_device.h" eingebunden werden)
+#include "f2838x_cla_typedefs.h"
+// Header zur Nutzung der Registernamen und Einbindung von Standard-Bibliotheken
+#include "f2838x_device.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Primrtaktquellen fr den Systemtakt
+// Keine Taktquelle (bei Aufruf durch CPU2)
+#define DEVICE_DEFAULT													0
+// Interner 10 MHz Oszillator
+#define DEVICE_CLKSRC_INTOSC2										1
+// Externer (Single-Ended) 25 MHz Oszillator
+#define DEVICE_CLKSRC_EXTOSC_SE_25MHZ						2
+// CPU2 Boot-Optionen
+#define DEVICE_CPU2_BOOTMODE_KEY								0x5A000000UL
+#define DEVICE_CPU2_FREQ_200MHZ									0xC800UL
+#define DEVICE_CPU2_BOOTMODE_FLASH_SECTOR0			0x03
+#define DEVICE_CPU2_BOOTMODE_FLASH_SECTOR4			0x23
+#define DEVICE_CPU2_BOOTMODE_FLASH_SECTOR8			0x43
+#define DEVICE_CPU2_BOOTMODE_FLASH_SECTOR13			0x63
+#define DEVICE_CPU2_BOOTMODE_RAM								0x05
+// CPU2 Boot-Status
+#define DEVICE_CPU2_BOOTSTATE_FINISHED					0x80000000UL
+// CPU2-Reset
+#define DEVICE_CPU2_RESET_KEY										0xA5A50000UL
+#define DEVICE_CPU2_CLEAR_RESET									0
+#define DEVICE_CPU2_SET_RESET										1
+#define DEVICE_CPU2_IS_NOT_IN_RESET							1
+#define DEVICE_CPU2_IS_IN_RESET									0
+// 1: DeviceInit() wartet nicht auf das Ende des Boot-Prozesses von CPU2, sondern erst
+//    DeviceJoinCPU2() (Aufruf vor der ersten Nutzung von IPC-Flags oder DeviceSetSysclk())
+// 0: DeviceInit() wartet, bis CPU2 gebootet hat
+#define DEVICE_CPU2_BOOT_ASYNC									1
+// Systemtakt in MHz nach DeviceInit() und hchster Takt fr DeviceSetSysclk(). Bestimmt die
+// Wartezustnde des Flash-Speichers beim Start. Muss zur Konfiguration der PLL passen
+#define DEVICE_SYSCLK_MHZ												200
+// Niedrigster Systemtakt fr DeviceSetSysclk() in MHz
+#define DEVICE_SYSCLK_MIN_MHZ										50
+// Teiler des Low-Speed Peripheral Clock (LOSPCP.LSPCLKDIV = 2, siehe DeviceInitCPU1())
+#define DEVICE_LSPCLK_DIV												4
+// Maximale Anzahl der Funktionen, die bei einer nderung des Systemtakts aufgerufen werden
+#define DEVICE_MAX_CLOCK_CALLBACKS							8
+// Referenzquellen des DCC0-Moduls fr die Prfung der PLL (Register DCCCLKSRC0)
+#define DEVICE_DCC_REFERENCE_XTAL								0xA000
+#define DEVICE_DCC_REFERENCE_INTOSC2						0xA002
+// Eigentmer einer Peripherie oder eines GPIOs
+#define DEVICE_OWNER_CPU1												0
+#define DEVICE_OWNER_CPU2												1
+// Wert von GPxCSELy fr CPU2 (0: CPU1, 2: CPU2)
+#define DEVICE_GPIO_CSEL_CPU2										2
+// Anzahl der GPIOs (GPIO0 bis GPIO168) und Gre der Register eines Ports in 16-Bit-Worten
+#define DEVICE_NUMBER_OF_GPIOS									169
+#define DEVICE_GPIO_PORT_REGS_SIZE							0x40
+// Flash-Profil:
+// Minimale Wartezustnde (RWAIT) fr den Systemtakt (siehe Tabelle "Flash
+// Wait States" im Datenblatt TMS320F2838x, SPRSP14)
+#if DEVICE_SYSCLK_MHZ > 150
+#define DEVICE_FLASH_RWAIT											3
+#elif DEVICE_SYSCLK_MHZ > 100
+#define DEVICE_FLASH_RWAIT											2
+#elif DEVICE_SYSCLK_MHZ > 50
+#define DEVICE_FLASH_RWAIT											1
+#else
+#define DEVICE_FLASH_RWAIT											0
+#endif
+// Error-Correction-Code (ECC) des Flash-Speichers
+// 0: ausgeschaltet
+// 1: eingeschaltet (Einzelbitfehler werden korrigiert und gezhlt)
+#define DEVICE_FLASH_ECC												1
+// Daten-Cache und Prefetch des Flash-Speichers
+// 0: ausgeschaltet
+// 1: eingeschaltet
+#define DEVICE_FLASH_CACHE											1
+// Wert zum Einschalten des ECC (alle anderen Werte schalten das ECC aus)
+#define DEVICE_FLASH_ECC_ENABLE_KEY							0x0A
+// Benchmark: Anzahl der Durchlufe und der gemessenen Konfigurationen
+#define DEVICE_FLASH_BENCHMARK_LOOPS						100
+#define DEVICE_FLASH_NUMBER_OF_BENCHMARKS				4
+// Build-Profil, wird ber die Predefined Symbols der Build-Konfiguration gewhlt:
+// CPUx_RAM, CPUx_FLASH (DEBUG):	ohne Optimierung, Prfungen und Messungen eingeschaltet
+// CPUx_FLASH_PERF (DEVICE_BUILD_PERFORMANCE, NDEBUG): -O4 und --opt_for_speed=5, Prfungen
+//						(DEVICE_ASSERT()) und Messungen (z.B. PROFILE_ENABLE in myProfile.h) ausgeschaltet
+#if defined(DEVICE_BUILD_PERFORMANCE)
+#define DEVICE_INSTRUMENTATION									0
+#else
+#define DEVICE_INSTRUMENTATION									1
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Dauer eines Takts in ns beim aktuellen Systemtakt
+#define DEVICE_CPU_RATE   											(1000.0L / deviceSysclkMhz)
+// Low-Speed Peripheral Clock in Hz (SCI-, SPI-Bittakt) beim aktuellen Systemtakt
+#define DEVICE_LSPCLK_HZ												((uint32_t)deviceSysclkMhz * 1000000UL / DEVICE_LSPCLK_DIV)
+// Delay-Funktion (ganzzahlig mit dem aktuellen Systemtakt, eine Schleife in F28x_usDelay()
+// dauert 5 Takte, der Aufruf 9 Takte)
+extern void F28x_usDelay(long LoopCount);
+#define DELAY_US(A)  														F28x_usDelay((((long)(A) * deviceSysclkMhz) - 9L) / 5L)
+
+// Platzierung von Variablen in den Speicherbereichen der Linker-Skripte 2838x_..._lnk_cpu1.cmd.
+// Das Makro steht vor der Definition der Variablen (ohne Semikolon), z.B.:
+//		DEVICE_CAPTURE_DATA(scopeBuffer)
+//		Uint16 scopeBuffer[...];
+// HOT:			Regelgren und Zustnde der ISRs im LSx-RAM (RAMLS4, kann der CLA zugewiesen werden)
+// CAPTURE:		groe Mess- und Aufzeichnungspuffer im GSx-RAM (RAMGS2 bis RAMGS9, 32 KW),
+//						werden beim Start nicht initialisiert
+// DMA:			weitere DMA-Puffer im GSx-RAM (RAMGS10 und RAMGS11), nicht initialisiert
+// SHARED:		mit CPU2 geteilte Daten im GSx-RAM (RAMGS14 schreibt CPU1, RAMGS15 schreibt CPU2,
+//						dazu muss die Master-Rolle von RAMGS15 mit MemCfgRegs.GSxMSEL an CPU2
+//						bergeben werden)
+#define DEVICE_PRAGMA(x)																_Pragma(#x)
+#define DEVICE_HOT_DATA(symbol)													DEVICE_PRAGMA(DATA_SECTION(symbol, "hotdata"))
+#define DEVICE_CAPTURE_DATA(symbol)											DEVICE_PRAGMA(DATA_SECTION(symbol, "capture"))
+#define DEVICE_DMA_DATA(symbol)													DEVICE_PRAGMA(DATA_SECTION(symbol, "dmabuf"))
+#define DEVICE_SHARED_CPU1_DATA(symbol)									DEVICE_PRAGMA(DATA_SECTION(symbol, "SHARERAMGS14"))
+#define DEVICE_SHARED_CPU2_DATA(symbol)									DEVICE_PRAGMA(DATA_SECTION(symbol, "SHARERAMGS15"))
+
+// Prfung einer Bedingung, bei einer Verletzung hlt die CPU an (ESTOP0, Debugger verbunden).
+// Mit DEVICE_BUILD_PERFORMANCE wird die Bedingung nicht ausgewertet (keine Nebeneffekte verwenden)
+#if defined(DEVICE_BUILD_PERFORMANCE)
+#define DEVICE_ASSERT(expr)															((void)0)
+#else
+#define DEVICE_ASSERT(expr)															do { if (!(expr)) { __asm(" ESTOP0"); } } while (0)
+#endif
+
+// Makro zeigt auf Funktion, welche die ADC-Referenz, den DAC-Offset
+// und die internen Oszillatoren kalibriert (direkt bernommen aus
+// Beispielcode der Driverlib)
+// Kennung einer Peripherie: Index des Registers CPUSELx * 32 + Bit (siehe Abschnitt "CPU1 and
+// CPU2 Peripheral Selection" im Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+// Module mit Nummer n = 1, 2, ..., Module mit Buchstabe m = 0 (A), 1 (B), ...
+#define DEVICE_PERIPHERAL(sel, bit)											((sel) * 32U + (bit))
+#define DEVICE_EPWM(n)																	DEVICE_PERIPHERAL(0, (n) - 1)
+#define DEVICE_ECAP(n)																	DEVICE_PERIPHERAL(1, (n) - 1)
+#define DEVICE_EQEP(n)																	DEVICE_PERIPHERAL(2, (n) - 1)
+#define DEVICE_SD(n)																		DEVICE_PERIPHERAL(4, (n) - 1)
+#define DEVICE_SCI(m)																		DEVICE_PERIPHERAL(5, (m))
+#define DEVICE_SPI(m)																		DEVICE_PERIPHERAL(6, (m))
+#define DEVICE_I2C(m)																		DEVICE_PERIPHERAL(7, (m))
+#define DEVICE_CAN(m)																		DEVICE_PERIPHERAL(8, (m))
+#define DEVICE_MCBSP(m)																	DEVICE_PERIPHERAL(9, (m))
+#define DEVICE_ADC(m)																		DEVICE_PERIPHERAL(11, (m))
+#define DEVICE_CMPSS(n)																	DEVICE_PERIPHERAL(12, (n) - 1)
+#define DEVICE_DAC(m)																		DEVICE_PERIPHERAL(14, 16 + (m))
+
+#define DEVICE_CALIBRATION ((void (*)(void))((uintptr_t)0x70260))
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ergebnis einer Benchmark-Messung des Flash-Speichers
+typedef struct
+{
+		uint16_t rwait;			// Wartezustnde
+		uint16_t ecc;				// ECC eingeschaltet
+		uint16_t cache;			// Cache und Prefetch eingeschaltet
+		uint32_t cycles;		// Systemtakte fr DEVICE_FLASH_BENCHMARK_LOOPS Durchlufe
+} DeviceFlashBenchmark;
+
+// Funktion, die nach einer nderung des Systemtakts aufgerufen wird (alter, neuer Takt in MHz)
+typedef void (*DeviceClockCallback)(uint16_t oldMhz, uint16_t newMhz);
+
+// Eigentmer einer Peripherie (DEVICE_EPWM(), DEVICE_SPI(), ...)
+typedef struct
+{
+		uint16_t peripheral;
+		uint16_t owner;			// DEVICE_OWNER_CPU1 oder DEVICE_OWNER_CPU2
+} DevicePeripheralOwner;
+
+// Eigentmer eines GPIOs (Schreibzugriff auf die Datenregister GPxDAT, GPxSET, ...)
+typedef struct
+{
+		uint16_t pin;
+		uint16_t owner;			// DEVICE_OWNER_CPU1 oder DEVICE_OWNER_CPU2
+} DevicePinOwner;
+
+// Zuordnung eines Projekts (nicht aufgefhrte Peripherie und GPIOs bleiben bei CPU1)
+typedef struct
+{
+		const DevicePeripheralOwner *peripherals;
+		uint16_t numberOfPeripherals;
+		const DevicePinOwner *pins;
+		uint16_t numberOfPins;
+} DeviceOwnership;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Ergebnisse von DeviceBenchmarkFlash() (z.B. im Debugger ansehen)
+extern DeviceFlashBenchmark deviceFlashBenchmark[DEVICE_FLASH_NUMBER_OF_BENCHMARKS];
+// Aktueller Systemtakt in MHz (DeviceSetSysclk())
+extern volatile uint16_t deviceSysclkMhz;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion ruft abhnging von der ausfhrenden CPU
+// die entsprechende Initialisierungsfunktion auf
+extern void DeviceInit(uint32_t clockSource);
+// Funktion fhrt eine Grundinitialisation des Mikrocontrollers durch
+// durch (Watchdog-Timer, Systemtakt, Flash-Speicher, Interrupts) und
+// kopiert bestimmte Speicherinhalte vom Flash in den RAM. Ausgefhrt
+// von CPU1
+void DeviceInitCPU1(uint32_t clockSource);
+// Funktion kopiert bestimmte Speicherinhalte vom Flash in den RAM
+// und initialisiert die Interrupts. Ausgefhrt von CPU2
+void DeviceInitCPU2(void);
+// Funktion steuert den Boot-Prozess von CPU2
+void DeviceBootCPU2(void);
+// Funktion wartet, bis CPU2 gebootet hat (bei DEVICE_CPU2_BOOT_ASYNC)
+void DeviceJoinCPU2(void);
+// Funktion initialisert den Flash-Speicher mit dem Flash-Profil (DEVICE_FLASH_...)
+void DeviceInitFlashMemory(void);
+// Funktion setzt Wartezustnde, ECC, Cache und Prefetch des Flash-Speichers
+void DeviceSetFlashProfile(uint16_t rwait, bool ecc, bool cache);
+// Funktion gibt die Anzahl der korrigierten Einzelbitfehler des Flash-Speichers zurck
+uint16_t DeviceGetFlashSingleBitErrors(void);
+// Funktion lscht den Fehlerzhler und die Fehlerflags des ECC
+void DeviceClearFlashErrors(void);
+// Funktion misst die Ausfhrungsgeschwindigkeit aus dem Flash fr mehrere Profile
+void DeviceBenchmarkFlash(void);
+// Funktion gibt die minimalen Wartezustnde des Flash-Speichers fr einen Systemtakt zurck
+uint16_t DeviceGetFlashRwait(uint16_t mhz);
+// Funktion stellt den Systemtakt zur Laufzeit um (nur CPU1)
+bool DeviceSetSysclk(uint16_t mhz);
+// Funktion meldet eine Funktion an, die nach einer nderung des Systemtakts aufgerufen wird
+bool DeviceRegisterClockCallback(DeviceClockCallback callback);
+// Funktionen rechnen Perioden und Bittakte eines Moduls auf den neuen Systemtakt um
+void DeviceScaleCpuTimer(volatile struct CPUTIMER_REGS *regs, uint16_t oldMhz, uint16_t newMhz);
+void DeviceScaleEpwm(volatile struct EPWM_REGS *regs, uint16_t oldMhz, uint16_t newMhz);
+void DeviceScaleSci(volatile struct SCI_REGS *regs, uint16_t oldMhz, uint16_t newMhz);
+void DeviceScaleSpi(volatile struct SPI_REGS *regs, uint16_t oldMhz, uint16_t newMhz);
+void DeviceScaleI2c(volatile struct I2C_REGS *regs, uint16_t oldMhz, uint16_t newMhz);
+// Funktion bergibt die Zuordnung der Peripherie und GPIOs, die DeviceInit() schreibt
+void DeviceSetOwnership(const DeviceOwnership *ownership);
+// Funktion schreibt die Zuordnung einer Tabelle (nur CPU1)
+void DeviceApplyOwnership(const DeviceOwnership *ownership);
+// Funktion ordnet eine Peripherie CPU1 oder CPU2 zu (nur CPU1)
+void DeviceAssignPeripheral(uint16_t peripheral, uint16_t owner);
+// Funktion ordnet mehrere GPIOs CPU1 oder CPU2 zu (nur CPU1)
+void DeviceAssignPins(const uint16_t *pins, uint16_t numberOfPins, uint16_t owner);
+// Funktion gibt den Eigentmer einer Peripherie zurck
+uint16_t DeviceGetOwner(uint16_t peripheral);
+
+
+#endif
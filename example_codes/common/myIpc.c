@@ -0,0 +1,349 @@
+//=================================================================================================
+/// @file       myIpc.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Befehls-/Antwort-Kanal von CPU 1 zu
+///							CPU 2 ber die Message-RAMs und Flags der IPC, siehe myIpc.h. Registerbeschreibung
+///							siehe Abschnitt "Interprocessor Communication (IPC)" im Reference Manual
+///							TMS320F2838x, SPRUII0D, Rev. D, July 2022.
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+///							nderung in Version 1.1: CPU 1 wartet in der Initialisierung mit DeviceJoinCPU2()
+///							auf das Ende des Boot-Prozesses von CPU 2, der die IPC-Flags lscht
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myIpc.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Befehl im CPU1TOCPU2-Message-RAM (nur von CPU 1 beschreibbar)
+IpcMessage ipcRequest;
+#pragma DATA_SECTION(ipcRequest,"MSGRAM_CPU1_TO_CPU2");
+// Antwort im CPU2TOCPU1-Message-RAM (nur von CPU 2 beschreibbar)
+IpcMessage ipcResponse;
+#pragma DATA_SECTION(ipcResponse,"MSGRAM_CPU2_TO_CPU1");
+// Laufzeiten
+IpcStats ipcStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Angemeldete Funktionen der Befehle (CPU 2)
+static IpcHandler ipcHandlers[IPC_MAX_COMMANDS];
+// Kennung des letzten Befehls und Zeitpunkt des Sendens (CPU 1)
+static uint16_t ipcLastId = 0;
+static uint32_t ipcSendTimestamp = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: IpcTimestamp ======================================================================
+///
+/// @brief  Funktion gibt den unteren Teil des freilaufenden IPC-Zhlers zurck (Systemtakt, auf
+///					beiden CPUs gleich)
+///
+/// @param  void
+///
+/// @return uint32_t timestamp
+///
+//=================================================================================================
+static inline uint32_t IpcTimestamp(void)
+{
+#ifdef CPU1
+		return Cpu1toCpu2IpcRegs.IPCCOUNTERL;
+#else
+		return Cpu2toCpu1IpcRegs.IPCCOUNTERL;
+#endif
+}
+
+//=== Function: IpcPing ===========================================================================
+///
+/// @brief  Funktion des Befehls IPC_COMMAND_PING, gibt die Daten unverndert zurck
+///
+/// @param  const volatile uint16_t *request, uint16_t length, volatile uint16_t *response,
+///					uint16_t *responseLength
+///
+/// @return uint16_t status
+///
+//=================================================================================================
+static uint16_t IpcPing(const volatile uint16_t *request, uint16_t length,
+												volatile uint16_t *response, uint16_t *responseLength)
+{
+		for (uint16_t i=0; i<length; i++)
+		{
+				response[i] = request[i];
+		}
+		*responseLength = length;
+		return IPC_STATUS_OK;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: IpcInit ===========================================================================
+///
+/// @brief  Funktion lscht die Laufzeiten und quittiert evtl. noch gesetzte Flags. Auf CPU 2
+///					wird zustzlich der Befehl IPC_COMMAND_PING angemeldet und IpcISR() fr den
+///					IPC3-Interrupt (Zeile 1, Spalte 16 der PIE-Tabelle) eingetragen. Wird auf beiden
+///					CPUs nach DeviceInit() aufgerufen
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void IpcInit(void)
+{
+		ipcStats.calls = 0;
+		ipcStats.timeouts = 0;
+		ipcStats.roundTripLast = 0;
+		ipcStats.roundTripMax = 0;
+		ipcStats.serviceMax = 0;
+
+#ifdef CPU1
+		// Der Boot-Prozess von CPU 2 lscht die IPC-Flags
+		DeviceJoinCPU2();
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCCLR.all = IPC_FLAG;
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = IPC_FLAG;
+#else
+		for (uint16_t i=0; i<IPC_MAX_COMMANDS; i++)
+		{
+				ipcHandlers[i] = 0;
+		}
+		ipcHandlers[IPC_COMMAND_PING] = &IpcPing;
+
+		EALLOW;
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCCLR.all = IPC_FLAG;
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = IPC_FLAG;
+		// ISR an die entsprechende Stelle (CIPC3_INT) der PIE-Vector Table speichern
+		PieVectTable.CIPC3_INT = &IpcISR;
+		// IPC3-Interrupt freischalten (Zeile 1, Spalte 16 der Tabelle)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER1.bit.INTx16 = 1;
+		// CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+		IER |= M_INT1;
+		EDIS;
+#endif
+}
+
+
+//=== Function: IpcRegisterHandler ================================================================
+///
+/// @brief  Funktion meldet die Funktion eines Befehls an, die im IPC3-Interrupt aufgerufen wird.
+///					Nur von CPU 2 aufrufen
+///
+/// @param  uint16_t command (0 ... IPC_MAX_COMMANDS - 1), IpcHandler handler
+///
+/// @return bool registered
+///
+//=================================================================================================
+bool IpcRegisterHandler(uint16_t command, IpcHandler handler)
+{
+		if (command >= IPC_MAX_COMMANDS)
+		{
+				return false;
+		}
+		ipcHandlers[command] = handler;
+		return true;
+}
+
+
+//=== Function: IpcSend ===========================================================================
+///
+/// @brief  Funktion schreibt einen Befehl mit neuer Kennung in den Message-RAM und setzt IPC3.
+///					Eine noch anstehende (versptete) Antwort wird verworfen. Hat CPU 2 den letzten
+///					Befehl noch nicht quittiert, wird nichts gesendet. Nur von CPU 1 aufrufen
+///
+/// @param  uint16_t command, const uint16_t *data, uint16_t length, uint16_t *id
+///
+/// @return uint16_t status (IPC_STATUS_OK, IPC_STATUS_BUSY oder IPC_STATUS_INVALID_LENGTH)
+///
+//=================================================================================================
+#pragma CODE_SECTION(IpcSend, ".TI.ramfunc");
+uint16_t IpcSend(uint16_t command, const uint16_t *data, uint16_t length, uint16_t *id)
+{
+#ifdef CPU1
+		if (length > IPC_MAX_WORDS)
+		{
+				return IPC_STATUS_INVALID_LENGTH;
+		}
+		if (Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCFLG.all & IPC_FLAG)
+		{
+				return IPC_STATUS_BUSY;
+		}
+
+		// Versptete Antwort verwerfen
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = IPC_FLAG;
+
+		ipcRequest.id = ++ipcLastId;
+		ipcRequest.code = command;
+		ipcRequest.length = length;
+		for (uint16_t i=0; i<length; i++)
+		{
+				ipcRequest.data[i] = data[i];
+		}
+		*id = ipcLastId;
+		ipcSendTimestamp = IpcTimestamp();
+		ipcStats.calls++;
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.all = IPC_FLAG;
+		return IPC_STATUS_OK;
+#else
+		return IPC_STATUS_ERROR;
+#endif
+}
+
+
+//=== Function: IpcPoll ===========================================================================
+///
+/// @brief  Funktion prft, ob die Antwort des Befehls mit der Kennung "id" vorliegt, kopiert die
+///					Antwortdaten nach "data" (max. IPC_MAX_WORDS Worte) und quittiert sie. Die Antwort
+///					eines lteren Befehls wird verworfen. Nur von CPU 1 aufrufen
+///
+/// @param  uint16_t id, uint16_t *data, uint16_t *length
+///
+/// @return uint16_t status (IPC_STATUS_PENDING: Antwort steht noch aus, sonst Status von CPU 2)
+///
+//=================================================================================================
+#pragma CODE_SECTION(IpcPoll, ".TI.ramfunc");
+uint16_t IpcPoll(uint16_t id, uint16_t *data, uint16_t *length)
+{
+#ifdef CPU1
+		uint16_t status;
+
+		if ((Cpu1toCpu2IpcRegs.CPU2TOCPU1IPCSTS.all & IPC_FLAG) == 0)
+		{
+				return IPC_STATUS_PENDING;
+		}
+		if (ipcResponse.id != id)
+		{
+				Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = IPC_FLAG;
+				return IPC_STATUS_PENDING;
+		}
+
+		ipcStats.roundTripLast = IpcTimestamp() - ipcSendTimestamp;
+		if (ipcStats.roundTripLast > ipcStats.roundTripMax)
+		{
+				ipcStats.roundTripMax = ipcStats.roundTripLast;
+		}
+		status = ipcResponse.code;
+		*length = ipcResponse.length;
+		for (uint16_t i=0; i<*length; i++)
+		{
+				data[i] = ipcResponse.data[i];
+		}
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = IPC_FLAG;
+		return status;
+#else
+		return IPC_STATUS_ERROR;
+#endif
+}
+
+
+//=== Function: IpcCall ===========================================================================
+///
+/// @brief  Funktion sendet einen Befehl an CPU 2 und wartet hchstens "timeoutUs" Mikrosekunden
+///					auf seine Antwort (Zeitmessung mit dem IPC-Zhler). Nur von CPU 1 aufrufen
+///
+/// @param  uint16_t command, const uint16_t *request, uint16_t requestLength, uint16_t *response,
+///					uint16_t *responseLength, uint32_t timeoutUs
+///
+/// @return uint16_t status (IPC_STATUS_TIMEOUT: keine Antwort, sonst Status von CPU 2)
+///
+//=================================================================================================
+#pragma CODE_SECTION(IpcCall, ".TI.ramfunc");
+uint16_t IpcCall(uint16_t command, const uint16_t *request, uint16_t requestLength,
+								 uint16_t *response, uint16_t *responseLength, uint32_t timeoutUs)
+{
+		uint32_t timeoutCycles = timeoutUs * deviceSysclkMhz;
+		uint16_t id;
+		uint16_t status = IpcSend(command, request, requestLength, &id);
+
+		if (status != IPC_STATUS_OK)
+		{
+				return status;
+		}
+
+		do
+		{
+				status = IpcPoll(id, response, responseLength);
+				if (status != IPC_STATUS_PENDING)
+				{
+						return status;
+				}
+		} while ((IpcTimestamp() - ipcSendTimestamp) < timeoutCycles);
+
+		ipcStats.timeouts++;
+		return IPC_STATUS_TIMEOUT;
+}
+
+
+//=== Function: IpcISR ============================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald CPU 1 einen Befehl gesendet hat. Die Funktion des Befehls
+///					wird mit den Daten aus dem Message-RAM aufgerufen und schreibt die Antwortdaten
+///					direkt in den Message-RAM der Gegenrichtung. Danach wird der Befehl quittiert und
+///					die Antwort mit IPC3 gemeldet
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(IpcISR, ".TI.ramfunc");
+__interrupt void IpcISR(void)
+{
+#ifdef CPU2
+		uint16_t command = ipcRequest.code;
+		uint16_t length = ipcRequest.length;
+		uint16_t responseLength = 0;
+		uint16_t status;
+		uint32_t start = IpcTimestamp();
+		uint32_t duration;
+
+		if (length > IPC_MAX_WORDS)
+		{
+				status = IPC_STATUS_INVALID_LENGTH;
+		}
+		else if ((command >= IPC_MAX_COMMANDS) || (ipcHandlers[command] == 0))
+		{
+				status = IPC_STATUS_UNKNOWN_COMMAND;
+		}
+		else
+		{
+				status = ipcHandlers[command](ipcRequest.data, length, ipcResponse.data, &responseLength);
+				if (responseLength > IPC_MAX_WORDS)
+				{
+						responseLength = IPC_MAX_WORDS;
+				}
+		}
+
+		ipcResponse.id = ipcRequest.id;
+		ipcResponse.code = status;
+		ipcResponse.length = responseLength;
+		ipcStats.calls++;
+		duration = IpcTimestamp() - start;
+		if (duration > ipcStats.serviceMax)
+		{
+				ipcStats.serviceMax = duration;
+		}
+
+		// Befehl quittieren (CPU 1 darf den nchsten schreiben) und Antwort melden
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = IPC_FLAG;
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCSET.all = IPC_FLAG;
+#endif
+
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der IPC3-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
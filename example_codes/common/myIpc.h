@@ -0,0 +1,112 @@
+//=================================================================================================
+/// @file       myIpc.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Befehls-/Antwort-Kanal von CPU 1 zu
+///							CPU 2 ber die Message-RAMs der IPC und das Flag IPC_FLAG (IPC3):
+///							- CPU 1 schreibt Befehl, Kennung und Daten in den CPU1TOCPU2-Message-RAM
+///							  (nur von CPU 1 beschreibbar) und setzt IPC3 (IpcSend())
+///							- Der IPC3-Interrupt von CPU 2 (IpcISR()) ruft die mit IpcRegisterHandler()
+///							  angemeldete Funktion des Befehls auf, schreibt Kennung, Status und Antwortdaten
+///							  in den CPU2TOCPU1-Message-RAM, quittiert den Befehl und setzt IPC3 in der
+///							  Gegenrichtung
+///							- CPU 1 bernimmt die Antwort mit IpcPoll() oder wartet mit IpcCall() hchstens
+///							  "timeoutUs" Mikrosekunden darauf
+///							ber die Kennung wird eine versptete Antwort (nach einer Zeitberschreitung) von
+///							der Antwort des aktuellen Befehls unterschieden. Es ist immer nur ein Befehl
+///							unterwegs. Laufzeiten werden mit dem IPC-Zhler (Systemtakt) in "ipcStats"
+///							gemessen. Befehl IPC_COMMAND_PING wird von IpcInit() angemeldet und gibt die
+///							Daten unverndert zurck (Messung der Umlaufzeit).
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+///							nderung in Version 1.1: CPU 1 wartet in der Initialisierung mit DeviceJoinCPU2()
+///							auf das Ende des Boot-Prozesses von CPU 2, der die IPC-Flags lscht
+///
+/// @version    V1.1
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYIPC_H_
+#define MYIPC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// IPC-Flag des Kanals (IPC0: SPI-D, IPC1: Datenkanal, IPC2: Blcke des Pools)
+#define IPC_FLAG																0x00000008UL
+// Max. Gre der Daten eines Befehls und einer Antwort in 16 Bit-Worten
+#define IPC_MAX_WORDS														32
+// Max. Anzahl der Befehle (0 ... IPC_MAX_COMMANDS - 1)
+#define IPC_MAX_COMMANDS												8
+// Befehl, der die Daten unverndert zurckgibt
+#define IPC_COMMAND_PING												0
+// Status einer Antwort
+#define IPC_STATUS_OK														0
+#define IPC_STATUS_UNKNOWN_COMMAND							1				// kein Handler angemeldet
+#define IPC_STATUS_INVALID_LENGTH								2				// zu viele Daten
+#define IPC_STATUS_ERROR												3				// Handler meldet einen Fehler
+#define IPC_STATUS_BUSY													4				// CPU 2 hat den letzten Befehl nicht quittiert
+#define IPC_STATUS_PENDING											5				// Antwort steht noch aus
+#define IPC_STATUS_TIMEOUT											6				// keine Antwort innerhalb "timeoutUs"
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Befehl von CPU 1 oder Antwort von CPU 2 im Message-RAM
+typedef struct
+{
+		volatile uint16_t id;										// Kennung (Antwort: Kennung des Befehls)
+		volatile uint16_t code;									// Befehl bzw. Status (IPC_STATUS_...)
+		volatile uint16_t length;								// Anzahl der Daten in 16 Bit-Worten
+		volatile uint16_t data[IPC_MAX_WORDS];
+} IpcMessage;
+
+// Funktion eines Befehls (CPU 2). Gibt den Status zurck (IPC_STATUS_OK oder IPC_STATUS_ERROR)
+// und setzt die Anzahl der Antwortdaten (max. IPC_MAX_WORDS)
+typedef uint16_t (*IpcHandler)(const volatile uint16_t *request, uint16_t length,
+															 volatile uint16_t *response, uint16_t *responseLength);
+
+// Laufzeiten in Systemtakten
+typedef struct
+{
+		uint32_t calls;													// Anzahl der Befehle (CPU 1) bzw. Aufrufe (CPU 2)
+		uint32_t timeouts;											// Anzahl der Zeitberschreitungen (CPU 1)
+		uint32_t roundTripLast;									// Umlaufzeit des letzten Befehls (CPU 1)
+		uint32_t roundTripMax;									// max. Umlaufzeit (CPU 1)
+		uint32_t serviceMax;										// max. Dauer eines Handlers (CPU 2)
+} IpcStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Laufzeiten (im Debugger anzeigen)
+extern IpcStats ipcStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert den Kanal (CPU 2: IPC3-Interrupt und Befehl IPC_COMMAND_PING)
+extern void IpcInit(void);
+// Funktion meldet die Funktion eines Befehls an (CPU 2)
+extern bool IpcRegisterHandler(uint16_t command, IpcHandler handler);
+// Funktion sendet einen Befehl an CPU 2 und gibt seine Kennung zurck (CPU 1)
+extern uint16_t IpcSend(uint16_t command, const uint16_t *data, uint16_t length, uint16_t *id);
+// Funktion bernimmt die Antwort des Befehls mit der Kennung "id" (CPU 1)
+extern uint16_t IpcPoll(uint16_t id, uint16_t *data, uint16_t *length);
+// Funktion sendet einen Befehl und wartet hchstens "timeoutUs" auf die Antwort (CPU 1)
+extern uint16_t IpcCall(uint16_t command, const uint16_t *request, uint16_t requestLength,
+												uint16_t *response, uint16_t *responseLength, uint32_t timeoutUs);
+// ISR des IPC3-Interrupts, fhrt einen Befehl aus (CPU 2)
+extern __interrupt void IpcISR(void);
+
+
+#endif
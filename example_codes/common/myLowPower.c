@@ -0,0 +1,198 @@
+//=================================================================================================
+/// @file       myLowPower.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr die Low-Power-Modi IDLE und STANDBY,
+///							siehe myLowPower.h. Registerbeschreibung siehe Abschnitt "Low Power Modes" im
+///							Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myLowPower.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte
+LowPowerStats lowPowerStats;
+// Gewhlter Modus
+uint16_t lowPowerMode = LOWPOWER_MODE_IDLE;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Wird vor dem IDLE-Befehl gesetzt und von LowPowerWake() gelscht
+static volatile bool lowPowerSleeping = false;
+// Beginn der Schlafphase und Zeitpunkt der Weckung (von LowPowerWake())
+static uint32_t lowPowerSleepStart = 0;
+static volatile uint32_t lowPowerWakeTimestamp = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: LowPowerInit ======================================================================
+///
+/// @brief	Funktion lscht die Messwerte und whlt den Low-Power-Modus, der mit dem IDLE-Befehl
+///					aktiviert wird. Im STANDBY wird die Qualifizierung des Weck-GPIOs gesetzt und
+///					LowPowerWakeISR() fr den WAKE_INT (Zeile 1, Spalte 8 der PIE-Tabelle) eingetragen.
+///					Luft CPU-Timer 2 noch nicht (z.B. ohne ProfileInit()), wird er mit dem Systemtakt
+///					frei laufend gestartet
+///
+/// @param  uint16_t mode (LOWPOWER_MODE_IDLE oder LOWPOWER_MODE_STANDBY)
+///
+/// @return void
+///
+//=================================================================================================
+void LowPowerInit(uint16_t mode)
+{
+		lowPowerStats.sleeps = 0;
+		lowPowerStats.sleepCycles = 0;
+		lowPowerStats.wakeLatencyLast = 0;
+		lowPowerStats.wakeLatencyMax = 0;
+		lowPowerStats.activeLatencyMax = 0;
+		lowPowerSleeping = false;
+		lowPowerMode = mode;
+
+		EALLOW;
+		// Zeitbasis (gleiche Einstellung wie ProfileInit())
+		CpuSysRegs.PCLKCR0.bit.CPUTIMER2 = 1;
+		if (CpuTimer2Regs.TCR.bit.TSS == 1)
+		{
+				CpuTimer2Regs.TPR.all = 0;
+				CpuTimer2Regs.TPRH.all = 0;
+				CpuTimer2Regs.PRD.all = 0xFFFFFFFFUL;
+				CpuTimer2Regs.TCR.bit.TRB = 1;
+				CpuTimer2Regs.TCR.bit.TIE = 0;
+				CpuTimer2Regs.TCR.bit.FREE = 1;
+				CpuTimer2Regs.TCR.bit.TSS = 0;
+		}
+
+		// 0: IDLE, 1: STANDBY
+		CpuSysRegs.LPMCR.bit.LPM = mode;
+		if (mode == LOWPOWER_MODE_STANDBY)
+		{
+				CpuSysRegs.LPMCR.bit.QUALSTDBY = LOWPOWER_STANDBY_QUALIFICATION;
+				// ISR an die entsprechende Stelle (WAKE_INT) der PIE-Vector Table speichern
+				PieVectTable.WAKE_INT = &LowPowerWakeISR;
+				// INT1.8-Interrupt freischalten (Zeile 1, Spalte 8 der Tabelle)
+				// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				PieCtrlRegs.PIEIER1.bit.INTx8 = 1;
+				// CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+				IER |= M_INT1;
+		}
+		EDIS;
+}
+
+//=== Function: LowPowerSetWakeGpio ===============================================================
+///
+/// @brief	Funktion whlt einen GPIO (0 bis 63), dessen Pegel die CPU aus dem STANDBY weckt
+///					(Register GPIOLPMSEL0/1). Mehrere GPIOs knnen nacheinander gewhlt werden
+///
+/// @param  uint16_t pin
+///
+/// @return void
+///
+//=================================================================================================
+void LowPowerSetWakeGpio(uint16_t pin)
+{
+		if (pin >= LOWPOWER_NUMBER_OF_WAKE_GPIOS)
+				return;
+
+		EALLOW;
+		if (pin < 32)
+				CpuSysRegs.GPIOLPMSEL0.all |= 1UL << pin;
+		else
+				CpuSysRegs.GPIOLPMSEL1.all |= 1UL << (pin - 32);
+		EDIS;
+}
+
+//=== Function: LowPowerSleep =====================================================================
+///
+/// @brief	Funktion legt die CPU mit dem IDLE-Befehl im gewhlten Modus schlafen, bis ein
+///					freigegebener Interrupt auftritt. Muss mit gesperrten Interrupts (DINT) aufgerufen
+///					werden, nachdem geprft wurde, dass nichts zu tun ist. Der IDLE-Befehl gibt die
+///					Interrupts frei, die weckende ISR luft vor der Rckkehr. Die Schlafzeit endet mit
+///					LowPowerWake() oder, falls die ISR es nicht aufruft, nach dem IDLE-Befehl. Danach
+///					sind die Interrupts wieder gesperrt
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(LowPowerSleep, ".TI.ramfunc");
+void LowPowerSleep(void)
+{
+		uint32_t end;
+
+		lowPowerSleepStart = LOWPOWER_TIMESTAMP();
+		lowPowerSleeping = true;
+		__asm(" IDLE");
+		DINT;
+
+		end = lowPowerSleeping ? LOWPOWER_TIMESTAMP() : lowPowerWakeTimestamp;
+		lowPowerSleeping = false;
+		lowPowerStats.sleeps++;
+		if (lowPowerMode == LOWPOWER_MODE_IDLE)
+				lowPowerStats.sleepCycles += end - lowPowerSleepStart;
+}
+
+//=== Function: LowPowerWake ======================================================================
+///
+/// @brief	Funktion wird am Anfang der weckenden ISR aufgerufen. "latencyCycles" ist die
+///					Verzgerung der ISR seit ihrem Ereignis (z.B. LOWPOWER_TIMER_LATENCY()). Schlief die
+///					CPU, endet die Schlafzeit und die Latenz wird als Weck-Latenz gespeichert, sonst als
+///					Latenz bei laufender CPU. Die Differenz der Maxima ist die Verlngerung der Latenz
+///					durch den Schlaf
+///
+/// @param  uint32_t latencyCycles
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(LowPowerWake, ".TI.ramfunc");
+void LowPowerWake(uint32_t latencyCycles)
+{
+		if (lowPowerSleeping)
+		{
+				lowPowerWakeTimestamp = LOWPOWER_TIMESTAMP();
+				lowPowerSleeping = false;
+				lowPowerStats.wakeLatencyLast = latencyCycles;
+				if (latencyCycles > lowPowerStats.wakeLatencyMax)
+						lowPowerStats.wakeLatencyMax = latencyCycles;
+		}
+		else if (latencyCycles > lowPowerStats.activeLatencyMax)
+		{
+				lowPowerStats.activeLatencyMax = latencyCycles;
+		}
+}
+
+//=== Function: LowPowerWakeISR ===================================================================
+///
+/// @brief  ISR wird beim Verlassen des STANDBY durch einen Weck-GPIO aufgerufen (WAKE_INT). Die
+///					Latenz seit der Flanke ist nicht messbar (CPU-Timer angehalten), sie ergibt sich aus
+///					der Qualifizierung (LOWPOWER_STANDBY_QUALIFICATION + 2 OSCCLK) und dem Hochlaufen
+///					des Takts
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(LowPowerWakeISR, ".TI.ramfunc");
+__interrupt void LowPowerWakeISR(void)
+{
+		LowPowerWake(0);
+
+    // Interrupt-Flag der Gruppe 1 lschen (da gehrt der WAKE_INT-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
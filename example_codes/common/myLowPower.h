@@ -0,0 +1,98 @@
+//=================================================================================================
+/// @file       myLowPower.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen, mit denen eine CPU die Wartezeit zwischen
+///							zwei Ereignissen in einem Low-Power-Modus verbringt, statt in einer leeren
+///							Schleife auf ein Flag zu warten:
+///							- LOWPOWER_MODE_IDLE: der CPU-Takt wird angehalten, die Peripherie luft weiter,
+///							  jeder freigegebene Interrupt weckt die CPU (z.B. CPU-Timer, SPI, IPC)
+///							- LOWPOWER_MODE_STANDBY: zustzlich wird der Takt der Peripherie angehalten (auch
+///							  die CPU-Timer), nur ein GPIO (LowPowerSetWakeGpio(), Interrupt WAKE_INT) oder
+///							  der Watchdog wecken die CPU. Fr Prfpltze, die auf ein externes Signal warten
+///							Vor LowPowerSleep() werden die Interrupts gesperrt und geprft, ob etwas zu tun
+///							ist, damit zwischen Prfung und IDLE-Befehl kein Ereignis verloren geht:
+///								DINT;
+///								if (nichts zu tun)
+///										LowPowerSleep();
+///								EINT;
+///							Der IDLE-Befehl gibt die Interrupts selbst frei. Ruft die weckende ISR am Anfang
+///							LowPowerWake() mit ihrer Verzgerung seit dem Ereignis auf (bei CPU-Timern
+///							LOWPOWER_TIMER_LATENCY()), werden die Weck-Latenz aus dem Schlaf und zum Vergleich
+///							die Latenz bei laufender CPU in "lowPowerStats" gespeichert. Die Schlafzeit wird
+///							mit CPU-Timer 2 gemessen (im STANDBY angehalten, dort nur die Anzahl der
+///							Schlafphasen)
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYLOWPOWER_H_
+#define MYLOWPOWER_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Low-Power-Modi (Register LPMCR.LPM)
+#define LOWPOWER_MODE_IDLE							0
+#define LOWPOWER_MODE_STANDBY						1
+// Qualifizierung des Weck-GPIOs im STANDBY in OSCCLK-Takten (LPMCR.QUALSTDBY + 2, 0 ... 63)
+#define LOWPOWER_STANDBY_QUALIFICATION	8
+// Anzahl der GPIOs im Register GPIOLPMSEL0/1 (GPIO0 bis GPIO63)
+#define LOWPOWER_NUMBER_OF_WAKE_GPIOS		64
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel in Takten (CPU-Timer 2 zhlt abwrts, wie PROFILE_TIMESTAMP() in myProfile.h)
+#define LOWPOWER_TIMESTAMP()						(0xFFFFFFFFUL - CpuTimer2Regs.TIM.all)
+// Verzgerung einer Timer-ISR seit dem Nulldurchgang des Zhlers in Takten (am Anfang der ISR)
+#define LOWPOWER_TIMER_LATENCY(regs)		((regs).PRD.all - (regs).TIM.all)
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Messwerte (Zeiten in Takten)
+typedef struct
+{
+		uint32_t sleeps;											// Anzahl der Schlafphasen
+		uint64_t sleepCycles;									// Summe der Schlafzeiten
+		uint32_t wakeLatencyLast;							// Latenz der letzten Weckung aus dem Schlaf
+		uint32_t wakeLatencyMax;							// maximale Latenz aus dem Schlaf
+		uint32_t activeLatencyMax;						// maximale Latenz bei laufender CPU (Vergleich)
+} LowPowerStats;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte (im Debugger anzeigen)
+extern LowPowerStats lowPowerStats;
+// Gewhlter Modus
+extern uint16_t lowPowerMode;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion whlt den Low-Power-Modus und startet bei Bedarf CPU-Timer 2 als Zeitbasis
+extern void LowPowerInit(uint16_t mode);
+// Funktion whlt einen GPIO (0 ... 63), der die CPU aus dem STANDBY weckt
+extern void LowPowerSetWakeGpio(uint16_t pin);
+// Funktion legt die CPU bis zum nchsten Interrupt schlafen (mit gesperrten Interrupts aufrufen)
+extern void LowPowerSleep(void);
+// Funktion wird am Anfang der weckenden ISR aufgerufen und speichert die Latenz
+extern void LowPowerWake(uint32_t latencyCycles);
+// ISR des WAKE_INT (Weckung aus dem STANDBY)
+extern __interrupt void LowPowerWakeISR(void);
+
+
+#endif
@@ -0,0 +1,175 @@
+//=================================================================================================
+/// @file       myMailbox.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Datenkanal von CPU 1 zu CPU 2 ber
+///							einen gemeinsamen RAM-Bereich (GSx). Die Zugriffsrechte werden mit
+///							MemCfgRegs.GSxMSEL so gesetzt, dass nur CPU 1 schreiben und CPU 2 nur lesen kann.
+///							Damit CPU 2 keinen halb geschriebenen Datensatz liest, wird ein Sequenzzhler
+///							verwendet (Seqlock): CPU 1 erhht den Zhler vor dem Schreiben auf einen ungeraden
+///							und nach dem Schreiben auf einen geraden Wert. CPU 2 kopiert die Daten und prft,
+///							ob der Zhler vorher und nachher gleich und gerade war, andernfalls wird das
+///							Lesen wiederholt. Es sind keine Sperren ntig und keine CPU wartet auf die andere.
+///							Als Nutzdaten kann eine beliebige Struktur (bis MAILBOX_MAX_WORDS 16 Bit-Worte)
+///							verwendet werden. Nach jedem Schreiben kann optional ein IPC-Flag gesetzt werden.
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myMailbox.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: MailboxInit =======================================================================
+///
+/// @brief  Funktion initialisiert einen Datenkanal (Sequenzzhler und Gre 0). Wird von CPU 1
+///					aufgerufen, nachdem der RAM-Bereich mit MemCfgRegs.GSxMSEL CPU 1 zugewiesen wurde.
+///
+/// @param  Mailbox *mailbox
+///
+/// @return void
+///
+//=================================================================================================
+void MailboxInit(Mailbox *mailbox)
+{
+		mailbox->sequence = 0;
+		mailbox->size     = 0;
+		for (uint16_t i=0; i<MAILBOX_MAX_WORDS; i++)
+		{
+				mailbox->data[i] = 0;
+		}
+}
+
+
+//=== Function: MailboxWrite ======================================================================
+///
+/// @brief  Funktion schreibt "size" 16 Bit-Worte aus "payload" in den Datenkanal. Der Sequenz-
+///					zhler ist whrend des Schreibens ungerade. Mit "ipcFlag" (z.B. MAILBOX_IPC_FLAG1)
+///					wird CPU 2 nach dem Schreiben ber ein IPC-Flag benachrichtigt (MAILBOX_IPC_NONE:
+///					keine Benachrichtigung). Nur von CPU 1 aufrufen.
+///
+/// @param  Mailbox *mailbox, const void *payload, uint16_t size, uint32_t ipcFlag
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool MailboxWrite(Mailbox *mailbox, const void *payload, uint16_t size, uint32_t ipcFlag)
+{
+		const uint16_t *source = (const uint16_t *)payload;
+
+		if (size > MAILBOX_MAX_WORDS)
+		{
+				return false;
+		}
+
+		// Ungerade: Daten werden geschrieben
+		mailbox->sequence++;
+		for (uint16_t i=0; i<size; i++)
+		{
+				mailbox->data[i] = source[i];
+		}
+		mailbox->size = size;
+		// Gerade: Daten gltig
+		mailbox->sequence++;
+
+#ifdef CPU1
+		if (ipcFlag != MAILBOX_IPC_NONE)
+		{
+				Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.all = ipcFlag;
+		}
+#endif
+		return true;
+}
+
+
+//=== Function: MailboxRead =======================================================================
+///
+/// @brief  Funktion kopiert die Nutzdaten des Datenkanals nach "payload". ndert sich der Sequenz-
+///					zhler whrend des Kopierens oder ist er ungerade (CPU 1 schreibt gerade), wird
+///					das Lesen bis zu MAILBOX_READ_RETRIES mal wiederholt. Die Funktion gibt "true" zurck,
+///					falls ein vollstndiger Datensatz gelesen wurde. In "sequence" wird der zugehrige
+///					Sequenzzhler gespeichert (kann 0 sein, falls nicht bentigt).
+///
+/// @param  const Mailbox *mailbox, void *payload, uint16_t size, uint32_t *sequence
+///
+/// @return bool dataValid
+///
+//=================================================================================================
+bool MailboxRead(const Mailbox *mailbox, void *payload, uint16_t size, uint32_t *sequence)
+{
+		uint16_t *destination = (uint16_t *)payload;
+
+		if (size > MAILBOX_MAX_WORDS)
+		{
+				return false;
+		}
+
+		for (uint16_t retry=0; retry<MAILBOX_READ_RETRIES; retry++)
+		{
+				uint32_t before = mailbox->sequence;
+				if (before & 1)
+				{
+						continue;
+				}
+				for (uint16_t i=0; i<size; i++)
+				{
+						destination[i] = mailbox->data[i];
+				}
+				if (mailbox->sequence == before)
+				{
+						if (sequence)
+						{
+								*sequence = before;
+						}
+						return true;
+				}
+		}
+		return false;
+}
+
+
+//=== Function: MailboxHasNewData =================================================================
+///
+/// @brief  Funktion gibt "true" zurck, falls seit dem mit "sequence" gelesenen Datensatz neue
+///					Daten geschrieben wurden oder gerade geschrieben werden.
+///
+/// @param  const Mailbox *mailbox, uint32_t sequence
+///
+/// @return bool newData
+///
+//=================================================================================================
+bool MailboxHasNewData(const Mailbox *mailbox, uint32_t sequence)
+{
+		return (mailbox->sequence != sequence);
+}
+
+
+//=== Function: MailboxTakeIpcFlag ================================================================
+///
+/// @brief  Funktion prft, ob CPU 1 das IPC-Flag "ipcFlag" gesetzt hat, und quittiert es in diesem
+///					Fall. Nur von CPU 2 aufrufen.
+///
+/// @param  uint32_t ipcFlag
+///
+/// @return bool flagWasSet
+///
+//=================================================================================================
+bool MailboxTakeIpcFlag(uint32_t ipcFlag)
+{
+#ifdef CPU2
+		if (Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCSTS.all & ipcFlag)
+		{
+				Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.all = ipcFlag;
+				return true;
+		}
+#endif
+		return false;
+}
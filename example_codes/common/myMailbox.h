@@ -0,0 +1,79 @@
+//=================================================================================================
+/// @file       myMailbox.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Datenkanal von CPU 1 zu CPU 2 ber
+///							einen gemeinsamen RAM-Bereich (GSx). Die Zugriffsrechte werden mit
+///							MemCfgRegs.GSxMSEL so gesetzt, dass nur CPU 1 schreiben und CPU 2 nur lesen kann.
+///							Damit CPU 2 keinen halb geschriebenen Datensatz liest, wird ein Sequenzzhler
+///							verwendet (Seqlock): CPU 1 erhht den Zhler vor dem Schreiben auf einen ungeraden
+///							und nach dem Schreiben auf einen geraden Wert. CPU 2 kopiert die Daten und prft,
+///							ob der Zhler vorher und nachher gleich und gerade war, andernfalls wird das
+///							Lesen wiederholt. Es sind keine Sperren ntig und keine CPU wartet auf die andere.
+///							Als Nutzdaten kann eine beliebige Struktur (bis MAILBOX_MAX_WORDS 16 Bit-Worte)
+///							verwendet werden. Nach jedem Schreiben kann optional ein IPC-Flag gesetzt werden.
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYMAILBOX_H_
+#define MYMAILBOX_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Max. Gre der Nutzdaten in 16 Bit-Worten
+#define MAILBOX_MAX_WORDS												64
+// Max. Anzahl an Leseversuchen, falls CPU 1 gerade schreibt
+#define MAILBOX_READ_RETRIES										8
+// IPC-Flags (IPC0 wird fr die bergabe des SPI-D verwendet)
+#define MAILBOX_IPC_NONE												0x00000000UL
+#define MAILBOX_IPC_FLAG1												0x00000002UL
+#define MAILBOX_IPC_FLAG2												0x00000004UL
+#define MAILBOX_IPC_FLAG3												0x00000008UL
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Schreibt/liest eine Variable beliebigen Typs (sizeof gibt auf dem C28x 16 Bit-Worte zurck)
+#define MAILBOX_WRITE(mailbox, variable, ipcFlag)	MailboxWrite(&(mailbox), &(variable), sizeof(variable), (ipcFlag))
+#define MAILBOX_READ(mailbox, variable, sequence)	MailboxRead(&(mailbox), &(variable), sizeof(variable), (sequence))
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Datenkanal im gemeinsamen RAM (wird nur von CPU 1 geschrieben)
+typedef struct
+{
+		volatile uint32_t sequence;							// gerade: Daten gltig, ungerade: CPU 1 schreibt
+		volatile uint16_t size;									// Gre der Nutzdaten in 16 Bit-Worten
+		volatile uint16_t data[MAILBOX_MAX_WORDS];
+} Mailbox;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert einen Datenkanal (CPU 1)
+extern void MailboxInit(Mailbox *mailbox);
+// Funktion schreibt Nutzdaten in einen Datenkanal und setzt optional ein IPC-Flag (CPU 1)
+extern bool MailboxWrite(Mailbox *mailbox, const void *payload, uint16_t size, uint32_t ipcFlag);
+// Funktion liest die Nutzdaten eines Datenkanals ohne halb geschriebene Daten (CPU 2)
+extern bool MailboxRead(const Mailbox *mailbox, void *payload, uint16_t size, uint32_t *sequence);
+// Funktion gibt "true" zurck, falls seit "sequence" neue Daten geschrieben wurden
+extern bool MailboxHasNewData(const Mailbox *mailbox, uint32_t sequence);
+// Funktion gibt "true" zurck, falls CPU 1 das IPC-Flag gesetzt hat, und quittiert es (CPU 2)
+extern bool MailboxTakeIpcFlag(uint32_t ipcFlag);
+
+
+#endif
@@ -0,0 +1,316 @@
+//=================================================================================================
+/// @file       myProfile.c
+///
+/// @brief      Datei enthlt Variablen, Funktionen und Makros um die Ausfhrungszeit von
+///							Interrupt-Service-Routinen (ISR) zu messen. Als Zeitbasis dient der CPU-Timer 2,
+///							der frei mit SYSCLK (200 MHz, 5 ns pro Takt) luft. Am Anfang einer ISR wird
+///							das Makro PROFILE_ISR_ENTRY(), am Ende das Makro PROFILE_ISR_EXIT() mit der
+///							Nummer des Messplatzes (Slot) aufgerufen. Pro Slot werden die minimale,
+///							maximale und mittlere Ausfhrungszeit in Takten, der minimale und maximale
+///							Abstand zweier Aufrufe und ein Histogramm des Jitters (Abweichung des Abstands
+///							vom Sollabstand) im RAM abgelegt. Die Werte knnen im Debugger ber die
+///							Variable "profileSlots" angezeigt oder mit ProfileFormatSlot() als Text (z.B.
+///							fr die UART-Schnittstelle) ausgegeben werden.
+///							Mit PROFILE_ENABLE = 0 werden die Makros leer und verursachen keine Laufzeit.
+///
+///							nderung in Version 1.2: Zwischenzeiten (ProfileMark()) und Mikro-Benchmark
+///							einer Funktion (ProfileBenchmark())
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include "myProfile.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte aller Slots
+ProfileSlot profileSlots[PROFILE_NUMBER_OF_SLOTS];
+// Laufzeit der Messung selbst in Takten
+uint32_t profileOverhead = 0;
+// Zwischenzeiten in Takten
+uint32_t profileMarks[PROFILE_NUMBER_OF_MARKS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel des letzten ProfileMark() bzw. von ProfileInit()
+static uint32_t profileMarkLast = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ProfileInit =======================================================================
+///
+/// @brief	Funktion startet den CPU-Timer 2 als freilaufende 32 Bit-Zeitbasis (ein Takt SYSCLK
+///					pro Zhlschritt, kein Interrupt), misst die Laufzeit der Messung selbst und setzt
+///					die Messwerte aller Slots zurck
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ProfileInit(void)
+{
+		uint32_t start;
+
+		EALLOW;
+		// Takt fr CPU-Timer 2 einschalten
+		CpuSysRegs.PCLKCR0.bit.CPUTIMER2 = 1;
+		// Timer anhalten, kein Vorteiler, maximale Periode
+		CpuTimer2Regs.TCR.bit.TSS = 1;
+		CpuTimer2Regs.TPR.all = 0;
+		CpuTimer2Regs.TPRH.all = 0;
+		CpuTimer2Regs.PRD.all = 0xFFFFFFFFUL;
+		CpuTimer2Regs.TCR.bit.TRB = 1;
+		// Kein Interrupt, Timer luft auch bei angehaltenem Debugger weiter
+		CpuTimer2Regs.TCR.bit.TIE = 0;
+		CpuTimer2Regs.TCR.bit.FREE = 1;
+		// Timer starten
+		CpuTimer2Regs.TCR.bit.TSS = 0;
+		EDIS;
+
+		// Laufzeit zweier aufeinanderfolgender Zeitstempel bestimmen
+		start = PROFILE_TIMESTAMP();
+		profileOverhead = PROFILE_TIMESTAMP() - start;
+
+		for (uint16_t slot = 0; slot < PROFILE_NUMBER_OF_SLOTS; slot++)
+		{
+				profileSlots[slot].periodNominal = 0;
+				ProfileReset(slot);
+		}
+		for (uint16_t mark = 0; mark < PROFILE_NUMBER_OF_MARKS; mark++)
+				profileMarks[mark] = 0;
+		profileMarkLast = PROFILE_TIMESTAMP();
+}
+
+//=== Function: ProfileReset ======================================================================
+///
+/// @brief	Funktion setzt die Messwerte eines Slots zurck (der Sollabstand bleibt erhalten)
+///
+/// @param  uint16_t slot
+///
+/// @return void
+///
+//=================================================================================================
+void ProfileReset(uint16_t slot)
+{
+		ProfileSlot *p;
+
+		if (slot >= PROFILE_NUMBER_OF_SLOTS)
+				return;
+
+		p = &profileSlots[slot];
+		p->count = 0;
+		p->cyclesMin = 0xFFFFFFFFUL;
+		p->cyclesMax = 0;
+		p->cyclesSum = 0;
+		p->periodMin = 0xFFFFFFFFUL;
+		p->periodMax = 0;
+		p->lastEntry = 0;
+		for (uint16_t i = 0; i < PROFILE_JITTER_BINS; i++)
+				p->jitter[i] = 0;
+}
+
+//=== Function: ProfileSetPeriod ==================================================================
+///
+/// @brief	Funktion legt den Sollabstand zweier Aufrufe eines Slots in Takten fest (z.B. die
+///					Periodendauer des auslsenden ePWM-Moduls). Bei 0 wird der erste gemessene Abstand
+///					als Sollabstand verwendet
+///
+/// @param  uint16_t slot, uint32_t periodCycles
+///
+/// @return void
+///
+//=================================================================================================
+void ProfileSetPeriod(uint16_t slot, uint32_t periodCycles)
+{
+		if (slot < PROFILE_NUMBER_OF_SLOTS)
+				profileSlots[slot].periodNominal = periodCycles;
+}
+
+//=== Function: ProfileEnter ======================================================================
+///
+/// @brief	Funktion wertet den Abstand zum letzten Aufruf des Slots aus (min, max, Jitter).
+///					Wird von PROFILE_ISR_ENTRY() aufgerufen
+///
+/// @param  uint16_t slot, uint32_t timestamp
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(ProfileEnter, ".TI.ramfunc");
+void ProfileEnter(uint16_t slot, uint32_t timestamp)
+{
+		ProfileSlot *p = &profileSlots[slot];
+
+		if (p->count > 0)
+		{
+				uint32_t period = timestamp - p->lastEntry;
+				uint32_t deviation;
+				uint32_t bin;
+
+				if (period < p->periodMin)
+						p->periodMin = period;
+				if (period > p->periodMax)
+						p->periodMax = period;
+
+				// Erster Abstand dient als Sollabstand, falls keiner vorgegeben wurde
+				if (p->periodNominal == 0)
+						p->periodNominal = period;
+
+				deviation = (period > p->periodNominal) ? (period - p->periodNominal)
+																								: (p->periodNominal - period);
+				bin = deviation / PROFILE_JITTER_BIN_CYCLES;
+				if (bin >= PROFILE_JITTER_BINS)
+						bin = PROFILE_JITTER_BINS - 1;
+				p->jitter[bin]++;
+		}
+		p->lastEntry = timestamp;
+}
+
+//=== Function: ProfileExit =======================================================================
+///
+/// @brief	Funktion berechnet die Ausfhrungszeit seit PROFILE_ISR_ENTRY() und aktualisiert
+///					min, max und Summe des Slots. Wird von PROFILE_ISR_EXIT() aufgerufen
+///
+/// @param  uint16_t slot, uint32_t entryTimestamp
+///
+/// @return void
+///
+//=================================================================================================
+#pragma CODE_SECTION(ProfileExit, ".TI.ramfunc");
+void ProfileExit(uint16_t slot, uint32_t entryTimestamp)
+{
+		ProfileSlot *p = &profileSlots[slot];
+		uint32_t cycles = PROFILE_TIMESTAMP() - entryTimestamp;
+
+		cycles = (cycles > profileOverhead) ? (cycles - profileOverhead) : 0;
+
+		p->count++;
+		p->cyclesSum += cycles;
+		if (cycles < p->cyclesMin)
+				p->cyclesMin = cycles;
+		if (cycles > p->cyclesMax)
+				p->cyclesMax = cycles;
+}
+
+//=== Function: ProfileGetAverage =================================================================
+///
+/// @brief	Funktion gibt die mittlere Ausfhrungszeit eines Slots in Takten zurck
+///
+/// @param  uint16_t slot
+///
+/// @return uint32_t average
+///
+//=================================================================================================
+uint32_t ProfileGetAverage(uint16_t slot)
+{
+		if (slot >= PROFILE_NUMBER_OF_SLOTS || profileSlots[slot].count == 0)
+				return 0;
+		return (uint32_t)(profileSlots[slot].cyclesSum / profileSlots[slot].count);
+}
+
+//=== Function: ProfileFormatSlot =================================================================
+///
+/// @brief	Funktion schreibt die Messwerte eines Slots als Textzeile in einen Puffer, z.B. um sie
+///					mit der UART-Schnittstelle zu senden. Format (Werte in Takten):
+///					"<slot>;<count>;<min>;<avg>;<max>;<periodMin>;<periodMax>;<jitter[0]>;...\r\n"
+///
+/// @param  uint16_t slot, char *buffer, uint16_t size
+///
+/// @return uint16_t Anzahl der geschriebenen Zeichen (0: Puffer zu klein oder ungltiger Slot)
+///
+//=================================================================================================
+uint16_t ProfileFormatSlot(uint16_t slot, char *buffer, uint16_t size)
+{
+		ProfileSlot *p;
+		int length;
+
+		if (slot >= PROFILE_NUMBER_OF_SLOTS)
+				return 0;
+
+		p = &profileSlots[slot];
+		length = snprintf(buffer, size, "%u;%lu;%lu;%lu;%lu;%lu;%lu",
+											slot, p->count, (p->count > 0) ? p->cyclesMin : 0UL,
+											ProfileGetAverage(slot), p->cyclesMax,
+											(p->count > 1) ? p->periodMin : 0UL, p->periodMax);
+
+		for (uint16_t i = 0; i < PROFILE_JITTER_BINS && length > 0 && length < size; i++)
+				length += snprintf(buffer + length, size - length, ";%lu", p->jitter[i]);
+
+		if (length > 0 && length + 2 < size)
+		{
+				buffer[length++] = '\r';
+				buffer[length++] = '\n';
+				buffer[length] = 0;
+				return length;
+		}
+		return 0;
+}
+
+//=== Function: ProfileMark =======================================================================
+///
+/// @brief	Funktion speichert die Zeit seit dem letzten Aufruf (bzw. seit ProfileInit()) in
+///					Takten als Zwischenzeit "profileMarks[mark]". Damit kann z.B. die Dauer jeder
+///					Initialisierung im Hauptprogramm gemessen und mit frheren Versionen verglichen
+///					werden. Die Laufzeit der Funktion selbst wird nicht mitgezhlt
+///
+/// @param  uint16_t mark
+///
+/// @return void
+///
+//=================================================================================================
+void ProfileMark(uint16_t mark)
+{
+		uint32_t cycles = PROFILE_TIMESTAMP() - profileMarkLast;
+
+		if (mark < PROFILE_NUMBER_OF_MARKS)
+				profileMarks[mark] = (cycles > profileOverhead) ? (cycles - profileOverhead) : 0;
+		profileMarkLast = PROFILE_TIMESTAMP();
+}
+
+//=== Function: ProfileBenchmark ==================================================================
+///
+/// @brief	Funktion ruft eine Funktion "loops" Mal mit gesperrten Interrupts auf und gibt die
+///					minimale Laufzeit eines Aufrufs in Takten zurck (ohne die Laufzeit der Messung).
+///					Das Minimum ist, anders als der Mittelwert, kaum von Flash-Wartezustnden und
+///					Cache-Effekten des ersten Aufrufs abhngig und eignet sich daher zum Vergleich
+///					zweier Software-Stnde
+///
+/// @param  ProfileBenchmarkFunction function, uint16_t loops
+///
+/// @return uint32_t cyclesMin (0xFFFFFFFF bei loops = 0)
+///
+//=================================================================================================
+uint32_t ProfileBenchmark(ProfileBenchmarkFunction function, uint16_t loops)
+{
+		uint16_t interruptState;
+		uint32_t cyclesMin = 0xFFFFFFFFUL;
+		uint32_t start;
+		uint32_t cycles;
+
+		interruptState = __disable_interrupts();
+		for (uint16_t i = 0; i < loops; i++)
+		{
+				start = PROFILE_TIMESTAMP();
+				function();
+				cycles = PROFILE_TIMESTAMP() - start;
+				cycles = (cycles > profileOverhead) ? (cycles - profileOverhead) : 0;
+				if (cycles < cyclesMin)
+						cyclesMin = cycles;
+		}
+		__restore_interrupts(interruptState);
+		return cyclesMin;
+}
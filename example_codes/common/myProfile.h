@@ -0,0 +1,141 @@
+//=================================================================================================
+/// @file       myProfile.h
+///
+/// @brief      Datei enthlt Variablen, Funktionen und Makros um die Ausfhrungszeit von
+///							Interrupt-Service-Routinen (ISR) zu messen. Als Zeitbasis dient der CPU-Timer 2,
+///							der frei mit SYSCLK (200 MHz, 5 ns pro Takt) luft. Am Anfang einer ISR wird
+///							das Makro PROFILE_ISR_ENTRY(), am Ende das Makro PROFILE_ISR_EXIT() mit der
+///							Nummer des Messplatzes (Slot) aufgerufen. Pro Slot werden die minimale,
+///							maximale und mittlere Ausfhrungszeit in Takten, der minimale und maximale
+///							Abstand zweier Aufrufe und ein Histogramm des Jitters (Abweichung des Abstands
+///							vom Sollabstand) im RAM abgelegt. Die Werte knnen im Debugger ber die
+///							Variable "profileSlots" angezeigt oder mit ProfileFormatSlot() als Text (z.B.
+///							fr die UART-Schnittstelle) ausgegeben werden.
+///							Mit PROFILE_ENABLE = 0 werden die Makros leer und verursachen keine Laufzeit.
+///
+///							nderung in Version 1.1: PROFILE_ENABLE folgt dem Build-Profil
+///							(DEVICE_INSTRUMENTATION, myDevice.h)
+///
+///							nderung in Version 1.2: Zwischenzeiten (ProfileMark(), z.B. fr die Dauer der
+///							einzelnen Initialisierungen) und Mikro-Benchmark einer Funktion
+///							(ProfileBenchmark(), minimale Laufzeit eines Aufrufs in Takten)
+///
+/// @version    V1.2
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYPROFILE_H_
+#define MYPROFILE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Messung ein- (1) oder ausschalten (0), im Build-Profil DEVICE_BUILD_PERFORMANCE ausgeschaltet
+#define PROFILE_ENABLE									DEVICE_INSTRUMENTATION
+// Messpltze (Slots) der ISRs aller Beispielprojekte
+#define PROFILE_SLOT_ADCA1							0
+#define PROFILE_SLOT_ADCB1							1
+#define PROFILE_SLOT_ADCC1							2
+#define PROFILE_SLOT_ADCD1							3
+#define PROFILE_SLOT_PWM1								4
+#define PROFILE_SLOT_PWM8								5
+#define PROFILE_SLOT_UART_RX						6
+#define PROFILE_SLOT_UART_TX						7
+#define PROFILE_SLOT_SPI								8
+#define PROFILE_SLOT_I2C								9
+#define PROFILE_SLOT_TRIPZONE						10
+#define PROFILE_SLOT_CLA_TASK1					11
+#define PROFILE_SLOT_CLA_TASK2					12
+#define PROFILE_SLOT_CLA_TASK3					13
+#define PROFILE_SLOT_XINT1							14
+#define PROFILE_SLOT_USER								15
+// Anzahl an Slots
+#define PROFILE_NUMBER_OF_SLOTS					16
+// Anzahl und Breite (in Takten) der Klassen des Jitter-Histogramms. Die letzte Klasse
+// enthlt alle Abweichungen ab (PROFILE_JITTER_BINS - 1) * PROFILE_JITTER_BIN_CYCLES
+#define PROFILE_JITTER_BINS							16
+#define PROFILE_JITTER_BIN_CYCLES				20
+// Anzahl der Zwischenzeiten (ProfileMark())
+#define PROFILE_NUMBER_OF_MARKS					16
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zeitstempel in Takten (CPU-Timer 2 zhlt abwrts, daher invertiert)
+#define PROFILE_TIMESTAMP()							(0xFFFFFFFFUL - CpuTimer2Regs.TIM.all)
+#if PROFILE_ENABLE
+// Am Anfang der ISR aufrufen (legt die lokale Variable "profileEntry" an)
+#define PROFILE_ISR_ENTRY(slot)					uint32_t profileEntry = PROFILE_TIMESTAMP(); \
+																				ProfileEnter((slot), profileEntry)
+// Am Ende der ISR aufrufen (vor jedem return)
+#define PROFILE_ISR_EXIT(slot)					ProfileExit((slot), profileEntry)
+#else
+#define PROFILE_ISR_ENTRY(slot)
+#define PROFILE_ISR_EXIT(slot)
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Messwerte eines Slots (alle Zeiten in Takten)
+typedef struct
+{
+		uint32_t count;												// Anzahl an Messungen
+		uint32_t cyclesMin;										// minimale Ausfhrungszeit
+		uint32_t cyclesMax;										// maximale Ausfhrungszeit
+		uint64_t cyclesSum;										// Summe der Ausfhrungszeiten (Mittelwert)
+		uint32_t periodNominal;								// Sollabstand zweier Aufrufe (0: erster Abstand)
+		uint32_t periodMin;										// minimaler Abstand zweier Aufrufe
+		uint32_t periodMax;										// maximaler Abstand zweier Aufrufe
+		uint32_t lastEntry;										// Zeitstempel des letzten Aufrufs
+		uint32_t jitter[PROFILE_JITTER_BINS];	// Histogramm der Abweichung vom Sollabstand
+} ProfileSlot;
+
+// Funktion, deren Laufzeit mit ProfileBenchmark() gemessen wird
+typedef void (*ProfileBenchmarkFunction)(void);
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Messwerte aller Slots
+extern ProfileSlot profileSlots[PROFILE_NUMBER_OF_SLOTS];
+// Laufzeit der Messung selbst in Takten (wird von den Messwerten abgezogen)
+extern uint32_t profileOverhead;
+// Zwischenzeiten in Takten (Abstand zum vorherigen ProfileMark() bzw. zu ProfileInit())
+extern uint32_t profileMarks[PROFILE_NUMBER_OF_MARKS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion startet den CPU-Timer 2 als freilaufende Zeitbasis und setzt alle Messwerte zurck
+extern void ProfileInit(void);
+// Funktion setzt die Messwerte eines Slots zurck
+extern void ProfileReset(uint16_t slot);
+// Funktion legt den Sollabstand zweier Aufrufe eines Slots fest
+extern void ProfileSetPeriod(uint16_t slot, uint32_t periodCycles);
+// Funktion wird von PROFILE_ISR_ENTRY() aufgerufen
+extern void ProfileEnter(uint16_t slot, uint32_t timestamp);
+// Funktion wird von PROFILE_ISR_EXIT() aufgerufen
+extern void ProfileExit(uint16_t slot, uint32_t entryTimestamp);
+// Funktion gibt die mittlere Ausfhrungszeit eines Slots in Takten zurck
+extern uint32_t ProfileGetAverage(uint16_t slot);
+// Funktion schreibt die Messwerte eines Slots als Textzeile in einen Puffer
+extern uint16_t ProfileFormatSlot(uint16_t slot, char *buffer, uint16_t size);
+// Funktion speichert die Zeit seit dem letzten Aufruf als Zwischenzeit
+extern void ProfileMark(uint16_t mark);
+// Funktion gibt die minimale Laufzeit eines Aufrufs einer Funktion in Takten zurck
+extern uint32_t ProfileBenchmark(ProfileBenchmarkFunction function, uint16_t loops);
+
+
+#endif
@@ -0,0 +1,333 @@
+//=================================================================================================
+/// @file       myPwmSync.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine gemeinsame Zeitbasis der ePWM-Module
+///							von CPU 1 und CPU 2. Eine Beschreibung des Ablaufs ist in der Header-Datei
+///							myPwmSync.h zu finden.
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myPwmSync.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of local functions
+//-------------------------------------------------------------------------------------------------
+static void PwmSyncInitModule(const PwmSyncModule *module, uint16_t master);
+#ifdef CPU1
+static void PwmSyncSetPinMux(uint16_t pin);
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Register der ePWM-Module (Index = Modulnummer - 1)
+static volatile struct EPWM_REGS * const pwmSyncRegs[PWMSYNC_NUMBER_OF_PWMS] =
+{
+		&EPwm1Regs,  &EPwm2Regs,  &EPwm3Regs,  &EPwm4Regs,
+		&EPwm5Regs,  &EPwm6Regs,  &EPwm7Regs,  &EPwm8Regs,
+		&EPwm9Regs,  &EPwm10Regs, &EPwm11Regs, &EPwm12Regs,
+		&EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
+// Zwei 3-phasige Wechselrichter: ePWM1 bis 3 (CPU 1, ePWM1 ist Master) und ePWM4 bis 6 (CPU 2),
+// beide schalten in Phase. Fr einen Versatz die Phase der Module von CPU 2 ndern
+static const PwmSyncModule pwmSyncModules[] =
+{
+		{1, DEVICE_OWNER_CPU1, 0, PWMSYNC_PHSDIR_UP},
+		{2, DEVICE_OWNER_CPU1, 0, PWMSYNC_PHSDIR_UP},
+		{3, DEVICE_OWNER_CPU1, 0, PWMSYNC_PHSDIR_UP},
+		{4, DEVICE_OWNER_CPU2, 0, PWMSYNC_PHSDIR_UP},
+		{5, DEVICE_OWNER_CPU2, 0, PWMSYNC_PHSDIR_UP},
+		{6, DEVICE_OWNER_CPU2, 0, PWMSYNC_PHSDIR_UP}
+};
+const PwmSyncChain pwmSyncChain =
+{
+		pwmSyncModules, sizeof(pwmSyncModules) / sizeof(pwmSyncModules[0])
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: PwmSyncInitModule =================================================================
+///
+/// @brief  Funktion initialisiert ein ePWM-Modul im Auf-/Abzhlmodus mit komplementren Ausgngen
+///					und Totzeit (wie PwmInitPwm123() im Beispiel F28386D_PWM). Der Master erzeugt SYNCOUT
+///					beim Nulldurchgang und per Software, alle anderen Module laden dann ihre Phase.
+///					Periode, Vergleichswerte und Ausgangsfreigabe werden nur global geladen, die
+///					One-Shot-Anforderung ist ber EPWMXLINK mit dem Master verbunden. Bis zum ersten
+///					globalen Laden sind beide Ausgnge auf low gehalten. Der Register-Schreibschutz muss
+///					aufgehoben sein
+///
+/// @param  const PwmSyncModule *module, uint16_t master (Nummer des Masters)
+///
+/// @return void
+///
+//=================================================================================================
+static void PwmSyncInitModule(const PwmSyncModule *module, uint16_t master)
+{
+		volatile struct EPWM_REGS *epwm = pwmSyncRegs[module->number - 1];
+
+		// Takt fr das Modul einschalten und 5 Takte warten, bis der Takt zum Modul durchgestellt ist
+		CpuSysRegs.PCLKCR2.all |= 1UL << (module->number - 1);
+		__asm(" RPT #4 || NOP");
+
+		// Ausgnge sofort auf low halten (kontinuierliche Software-Erzwingung)
+		epwm->AQSFRC.bit.RLDCSF = 3;
+		epwm->AQCSFRC.bit.CSFA = 1;
+		epwm->AQCSFRC.bit.CSFB = 1;
+
+		// TBCLK = EPWMCLK = 100 MHz
+		epwm->TBCTL.bit.CLKDIV    = 0;
+		epwm->TBCTL.bit.HSPCLKDIV = 0;
+		if (module->number == master)
+		{
+				// Master: keine Phase, SYNCOUT beim Nulldurchgang und bei SWFSYNC
+				epwm->TBCTL.bit.PHSEN = 0;
+				epwm->EPWMSYNCOUTEN.bit.ZEROEN = 1;
+				epwm->EPWMSYNCOUTEN.bit.SWEN = 1;
+		}
+		else
+		{
+				// Synchronisation mit SYNCOUT des Masters (Codes 1 bis 16 = SYNCOUT von ePWM1 bis 16,
+				// siehe PWM_TB_SYNCIN_EPWMx_SYNCOUT in myPWM.h), Phase und Zhlrichtung beim Laden
+				epwm->EPWMSYNCINSEL.bit.SEL = master;
+				epwm->TBCTL.bit.PHSEN = 1;
+				epwm->TBCTL.bit.PHSDIR = module->phaseDirection;
+				epwm->EPWMSYNCOUTEN.all = 0;
+		}
+		epwm->TBPHS.bit.TBPHS = module->phase;
+		// Kontinuierlicher Synchronisationsbetrieb
+		epwm->TBCTL2.bit.OSHTSYNCMODE = 0;
+		// Betriebsart: hoch-runter zhlen, Periode ber das Schattenregister
+		epwm->TBCTL.bit.CTRMODE = 2;
+		epwm->TBCTL.bit.PRDLD = 0;
+		epwm->TBPRD = PWMSYNC_PERIOD;
+
+		// Vergleichswerte ber die Schattenregister (der Lademodus wird vom globalen Laden ersetzt)
+		epwm->CMPCTL.bit.SHDWAMODE = 0;
+		epwm->CMPCTL.bit.LOADAMODE = 0;
+		epwm->CMPCTL.bit.SHDWBMODE = 0;
+		epwm->CMPCTL.bit.LOADBMODE = 0;
+		epwm->CMPA.bit.CMPA = 0;
+		epwm->CMPB.bit.CMPB = 0;
+		// PWMxA setzen beim Hochzhlen bei CMPA, lschen beim Runterzhlen bei CMPB
+		epwm->AQCTLA.bit.CAU = 2;
+		epwm->AQCTLA.bit.CBD = 1;
+		// PWMxA mit verzgerter steigender Flanke, PWMxB invertiert mit verzgerter fallender Flanke
+		epwm->DBCTL.bit.HALFCYCLE = 0;
+		epwm->DBCTL.bit.IN_MODE = 0;
+		epwm->DBCTL.bit.POLSEL = 2;
+		epwm->DBCTL.bit.OUT_MODE = 3;
+		epwm->DBRED.bit.DBRED = PWMSYNC_DEAD_BAND;
+		epwm->DBFED.bit.DBFED = PWMSYNC_DEAD_BAND;
+		epwm->TBCTR = 0;
+
+		// Globales Laden beim Nulldurchgang (GLDMODE = 0), nur nach einer One-Shot-Anforderung,
+		// fr Periode, Vergleichswerte und die Software-Erzwingung der Ausgnge
+		epwm->GLDCFG.bit.TBPRD_TBPRDHR = 1;
+		epwm->GLDCFG.bit.CMPA_CMPAHR = 1;
+		epwm->GLDCFG.bit.CMPB_CMPBHR = 1;
+		epwm->GLDCFG.bit.AQCSFRC = 1;
+		epwm->GLDCTL.bit.GLDMODE = 0;
+		epwm->GLDCTL.bit.GLDPRD = 1;
+		epwm->GLDCTL.bit.OSHTMODE = 1;
+		epwm->GLDCTL.bit.GLD = 1;
+		// One-Shot-Anforderung (GLDCTL2) mit dem Master verbinden (Wert = Nummer - 1)
+		epwm->EPWMXLINK.bit.GLDCTL2LINK = master - 1;
+
+		// Software-Erzwingung aus dem Schattenregister laden und die Freigabe der Ausgnge
+		// vorbereiten. Sie wird erst beim ersten globalen Laden wirksam
+		epwm->AQSFRC.bit.RLDCSF = 0;
+		epwm->AQCSFRC.bit.CSFA = 0;
+		epwm->AQCSFRC.bit.CSFB = 0;
+}
+
+
+#ifdef CPU1
+//=== Function: PwmSyncSetPinMux ==================================================================
+///
+/// @brief  Funktion legt GPIO144 bis GPIO159 auf die ePWM-Funktion (Mux 1, siehe S. 1645
+///					Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022) und deaktiviert den
+///					Pull-Up-Widerstand. Der Register-Schreibschutz muss aufgehoben sein
+///
+/// @param  uint16_t pin
+///
+/// @return void
+///
+//=================================================================================================
+static void PwmSyncSetPinMux(uint16_t pin)
+{
+		uint32_t bit = 1UL << (pin - 128U);
+		uint16_t shift = (pin - 144U) * 2U;
+
+		if ((pin < 144U) || (pin > 159U))
+				return;
+		// Konfigurationssperre aufheben, erst GMUX, dann MUX schreiben
+		GpioCtrlRegs.GPELOCK.all &= ~bit;
+		GpioCtrlRegs.GPEGMUX2.all &= ~(3UL << shift);
+		GpioCtrlRegs.GPEMUX2.all = (GpioCtrlRegs.GPEMUX2.all & ~(3UL << shift)) | (1UL << shift);
+		GpioCtrlRegs.GPEPUD.all |= bit;
+}
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: PwmSyncInit =======================================================================
+///
+/// @brief  Funktion initialisiert alle Module der Kette, die der eigenen CPU gehren. Die
+///					Zeitbasis der eigenen CPU ist dabei angehalten. CPU 1 legt zustzlich die Ausgnge
+///					aller Module mit GPIOs von GPIO145 an (ePWM1A bis ePWM7B, die Multiplexer stellt nur
+///					CPU 1 ein). CPU 2 gibt ihre Zeitbasis danach frei und meldet die Bereitschaft mit
+///					PWMSYNC_IPC_FLAG. Ihre Zhler laufen bis zum ersten Synchronisationsimpuls des
+///					Masters frei, die Ausgnge sind whrenddessen auf low gehalten
+///
+/// @param  const PwmSyncChain *chain
+///
+/// @return void
+///
+//=================================================================================================
+void PwmSyncInit(const PwmSyncChain *chain)
+{
+		uint16_t master = chain->modules[0].number;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+		// Synchronisierungstakt whrend der Konfiguration ausschalten
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+
+		for (uint16_t i = 0; i < chain->numberOfModules; i++)
+		{
+				const PwmSyncModule *module = &chain->modules[i];
+
+				if (module->owner == PWMSYNC_OWN_CPU)
+				{
+						PwmSyncInitModule(module, master);
+				}
+#ifdef CPU1
+				PwmSyncSetPinMux(145U + 2U * (module->number - 1U));
+				PwmSyncSetPinMux(146U + 2U * (module->number - 1U));
+#endif
+		}
+
+#ifdef CPU2
+		// Zeitbasis von CPU 2 freigeben und Bereitschaft an CPU 1 melden
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCSET.all = PWMSYNC_IPC_FLAG;
+#endif
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: PwmSyncStart ======================================================================
+///
+/// @brief  Funktion wartet hchstens "timeoutUs" Mikrosekunden auf die Bereitschaft von CPU 2,
+///					gibt die Zeitbasis von CPU 1 frei und synchronisiert alle Module einmalig per
+///					Software. Danach wird das erste globale Laden angefordert, das Vergleichswerte und
+///					Ausgnge aller Module im selben PWM-Takt freigibt. Ohne Meldung von CPU 2 bleiben
+///					alle Ausgnge auf low. Nur von CPU 1 aufrufen
+///
+/// @param  const PwmSyncChain *chain, uint32_t timeoutUs
+///
+/// @return bool started
+///
+//=================================================================================================
+bool PwmSyncStart(const PwmSyncChain *chain, uint32_t timeoutUs)
+{
+#ifdef CPU1
+		volatile struct EPWM_REGS *epwm = pwmSyncRegs[chain->modules[0].number - 1];
+		bool cpu2Modules = false;
+
+		for (uint16_t i = 0; i < chain->numberOfModules; i++)
+		{
+				if (chain->modules[i].owner == DEVICE_OWNER_CPU2)
+				{
+						cpu2Modules = true;
+				}
+		}
+
+		if (cpu2Modules)
+		{
+				// Der Boot-Prozess von CPU 2 lscht die IPC-Flags
+				DeviceJoinCPU2();
+				while ((Cpu1toCpu2IpcRegs.CPU2TOCPU1IPCSTS.all & PWMSYNC_IPC_FLAG) == 0)
+				{
+						if (timeoutUs < PWMSYNC_POLL_US)
+						{
+								return false;
+						}
+						DELAY_US(PWMSYNC_POLL_US);
+						timeoutUs -= PWMSYNC_POLL_US;
+				}
+				Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCACK.all = PWMSYNC_IPC_FLAG;
+		}
+
+		EALLOW;
+		// Zeitbasis von CPU 1 freigeben und alle Module auf den Master synchronisieren
+		CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+		epwm->TBCTL.bit.SWFSYNC = 1;
+		EDIS;
+
+		// Vergleichswerte und Ausgnge aller Module beim nchsten Nulldurchgang freigeben
+		PwmSyncGlobalLoad(chain);
+		return true;
+#else
+		return false;
+#endif
+}
+
+
+//=== Function: PwmSyncSetDuty ====================================================================
+///
+/// @brief  Funktion schreibt die Vergleichswerte eines Moduls in die Schattenregister. Sie werden
+///					erst mit dem nchsten PwmSyncGlobalLoad() wirksam. Nur fr Module der eigenen CPU
+///
+/// @param  uint16_t number, uint16_t compareA (steigende Flanke), uint16_t compareB (fallende Flanke)
+///
+/// @return void
+///
+//=================================================================================================
+void PwmSyncSetDuty(uint16_t number, uint16_t compareA, uint16_t compareB)
+{
+		volatile struct EPWM_REGS *epwm;
+
+		if ((number == 0) || (number > PWMSYNC_NUMBER_OF_PWMS))
+				return;
+		epwm = pwmSyncRegs[number - 1];
+		epwm->CMPA.bit.CMPA = compareA;
+		epwm->CMPB.bit.CMPB = compareB;
+}
+
+
+//=== Function: PwmSyncGlobalLoad =================================================================
+///
+/// @brief  Funktion fordert das globale Laden beim Master an. ber EPWMXLINK gilt die Anforderung
+///					gleichzeitig fr alle Module der Kette, auch fr die von CPU 2. Jedes Modul bernimmt
+///					seine Schattenregister beim nchsten eigenen Nulldurchgang. Die Schattenregister von
+///					CPU 2 mssen vorher geschrieben sein (z.B. Meldung ber den Befehlskanal myIpc.h).
+///					Nur von CPU 1 aufrufen
+///
+/// @param  const PwmSyncChain *chain
+///
+/// @return void
+///
+//=================================================================================================
+void PwmSyncGlobalLoad(const PwmSyncChain *chain)
+{
+#ifdef CPU1
+		pwmSyncRegs[chain->modules[0].number - 1]->GLDCTL2.bit.OSHTLD = 1;
+#endif
+}
@@ -0,0 +1,110 @@
+//=================================================================================================
+/// @file       myPwmSync.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine gemeinsame Zeitbasis der ePWM-Module
+///							von CPU 1 und CPU 2. Alle Module der Tabelle "pwmSyncChain" (myPwmSync.c) laufen
+///							mit derselben Periode und werden vom SYNCOUT des ersten Moduls (Master, gehrt
+///							CPU 1) synchronisiert. Der Synchronisationsimpuls ist ein Hardware-Signal und
+///							wirkt unabhngig davon, welcher CPU ein Modul gehrt (EPWMSYNCINSEL). Ablauf:
+///							- CPU 1 ordnet die Module von CPU 2 vor dem Booten von CPU 2 zu
+///							  (DeviceSetOwnership()) und ruft PwmSyncInit() auf, die Zeitbasis von CPU 1
+///							  bleibt angehalten (TBCLKSYNC = 0)
+///							- CPU 2 ruft PwmSyncInit() fr ihre Module auf, gibt deren Zeitbasis frei und
+///							  meldet die Bereitschaft mit PWMSYNC_IPC_FLAG
+///							- PwmSyncStart() (CPU 1) wartet auf die Meldung, gibt die Zeitbasis von CPU 1 frei
+///							  und synchronisiert alle Module einmalig per Software (SWFSYNC). Danach ldt jeder
+///							  Nulldurchgang des Masters die Zhler der brigen Module mit ihrer Phase
+///							- Alle Module bernehmen Periode, Vergleichswerte und Ausgangsfreigabe nur beim
+///							  globalen Laden (GLDCTL, One-Shot). Die One-Shot-Anforderung aller Module ist ber
+///							  EPWMXLINK mit dem Master verbunden, PwmSyncGlobalLoad() (CPU 1) lst sie fr alle
+///							  Module gleichzeitig aus. Bis zum ersten globalen Laden sind die Ausgnge auf
+///							  low gehalten (AQCSFRC), sodass kein Modul vor der Synchronisation schaltet
+///							Die Vergleichswerte schreibt jede CPU mit PwmSyncSetDuty() in die Schattenregister
+///							ihrer Module. Sie werden beim nchsten PwmSyncGlobalLoad() gemeinsam im selben
+///							PWM-Takt wirksam (beim Nulldurchgang des jeweiligen Moduls).
+///							Die Datei liegt in "common" und wird von den Projekten von CPU 1 und CPU 2 verlinkt.
+///
+/// @version    V1.0
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYPWMSYNC_H_
+#define MYPWMSYNC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// IPC-Flag der Bereitschaftsmeldung von CPU 2 (IPC0: SPI-D, IPC1: Datenkanal, IPC2: Blcke
+// des Pools, IPC3: Befehlskanal)
+#define PWMSYNC_IPC_FLAG												0x00000010UL
+// Anzahl der ePWM-Module
+#define PWMSYNC_NUMBER_OF_PWMS									16
+// Periode fr 16 kHz Schaltfrequenz bei 100 MHz EPWMCLK im Auf-/Abzhlmodus
+#define PWMSYNC_PERIOD													3125
+// Totzeit in Takten von TBCLK (250 ns)
+#define PWMSYNC_DEAD_BAND												25
+// Zhlrichtung nach dem Laden der Phase (TBCTL.PHSDIR, nur im Auf-/Abzhlmodus wirksam)
+#define PWMSYNC_PHSDIR_DOWN											0
+#define PWMSYNC_PHSDIR_UP												1
+// Max. Wartezeit von PwmSyncStart() auf CPU 2 in Mikrosekunden
+#define PWMSYNC_TIMEOUT_US											100000UL
+// Wartezeit zwischen zwei Abfragen der Meldung von CPU 2 in Mikrosekunden
+#define PWMSYNC_POLL_US													10
+// Eigene CPU (Vergleich mit "owner" der Tabelle)
+#ifdef CPU1
+#define PWMSYNC_OWN_CPU													DEVICE_OWNER_CPU1
+#else
+#define PWMSYNC_OWN_CPU													DEVICE_OWNER_CPU2
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ein ePWM-Modul der Kette
+typedef struct
+{
+		uint16_t number;												// ePWM-Modul (1 ... 16)
+		uint16_t owner;													// DEVICE_OWNER_CPU1 oder DEVICE_OWNER_CPU2
+		uint16_t phase;													// Phase (TBPHS) in Takten von TBCLK
+		uint16_t phaseDirection;								// PWMSYNC_PHSDIR_x
+} PwmSyncModule;
+
+// Kette aus Master (erster Eintrag, gehrt CPU 1) und synchronisierten Modulen
+typedef struct
+{
+		const PwmSyncModule *modules;
+		uint16_t numberOfModules;
+} PwmSyncChain;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Module beider CPUs (eine Tabelle fr beide Projekte)
+extern const PwmSyncChain pwmSyncChain;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die Module der eigenen CPU (CPU 2: gibt die Zeitbasis frei und meldet
+// die Bereitschaft)
+extern void PwmSyncInit(const PwmSyncChain *chain);
+// Funktion wartet auf CPU 2, gibt die Zeitbasis von CPU 1 frei und synchronisiert alle Module
+// (CPU 1)
+extern bool PwmSyncStart(const PwmSyncChain *chain, uint32_t timeoutUs);
+// Funktion schreibt die Vergleichswerte eines Moduls der eigenen CPU in die Schattenregister
+extern void PwmSyncSetDuty(uint16_t number, uint16_t compareA, uint16_t compareB);
+// Funktion fordert das globale Laden aller verbundenen Module an (CPU 1)
+extern void PwmSyncGlobalLoad(const PwmSyncChain *chain);
+
+
+#endif
@@ -0,0 +1,428 @@
+//=================================================================================================
+/// @file       myTelemetry.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein binres, rahmenbasiertes Telemetrie-
+///							Protokoll auf Basis des Streaming-Betriebs von "myUART.c". Jeder Rahmen besteht
+///							aus Sequenznummer, Typ, Nutzdaten mit variabler Lnge und einer CRC16 (CCITT,
+///							Polynom 0x1021, Startwert 0xFFFF). Der Rahmen wird mit COBS (Consistent Overhead
+///							Byte Stuffing) kodiert und mit einem 0x00-Byte abgeschlossen. Da 0x00 nur als
+///							Rahmenende vorkommt, kann sich der Empfnger nach jedem beliebigen Byte neu
+///							synchronisieren:
+///
+///							COBS( seq | type | data[0..n-1] | crcHigh | crcLow ) | 0x00
+///
+///							Die Rahmen werden ohne Zwischenpuffer direkt im Sende-Ringpuffer "uartRingTxA"
+///							kodiert und erst nach dem letzten Byte fr die ISR freigegeben. Vor der Benutzung
+///							muss "UartStartStreamA()" und "TelemetryInit()" aufgerufen werden.
+///
+///							nderung in Version 1.1: Die CRC16 wird mit der VCRC-Einheit berechnet
+///							(CRC16_P2_BYTE(), myCRC.h), die CRC-Tabelle entfllt.
+///
+///							nderung in Version 1.3: Die Datei liegt in "common" und wird von den Projekten
+///							F28386D_UART, F28386D_Testmode und F28386D_Tripzone verlinkt.
+///
+/// @version    V1.3
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Zustand des COBS-Kodierers im Sende-Ringpuffer
+typedef struct
+{
+		uint16_t position;												// nchste Schreibposition im Ringpuffer
+		uint16_t codePosition;										// Position des aktuellen COBS-Code-Bytes
+		uint16_t code;														// Abstand bis zum nchsten 0x00-Byte
+		uint16_t crc;
+} TelemetryEncoder;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Statistik Senden und Empfangen
+uint32_t telemetryTxFrames        = 0;
+uint32_t telemetryTxDropped       = 0;
+uint32_t telemetryRxFrames        = 0;
+uint32_t telemetryRxCrcErrors     = 0;
+uint32_t telemetryRxFramingErrors = 0;
+uint32_t telemetryRxLostFrames    = 0;
+// Sequenznummer des nchsten gesendeten Rahmens
+uint16_t telemetryTxSequence;
+// Erwartete Sequenznummer des nchsten empfangenen Rahmens
+uint16_t telemetryRxSequence;
+bool telemetryRxSynchronized;
+// Kodierte Bytes des aktuell empfangenen Rahmens
+uint16_t telemetryRxEncoded[TELEMETRY_MAX_ENCODED];
+uint16_t telemetryRxEncodedLength;
+bool telemetryRxOverflow;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TelemetryEncoderStart =============================================================
+///
+/// @brief  Funktion startet die Kodierung eines Rahmens an der aktuellen Schreibposition des
+///					Sende-Ringpuffers. Die erste Stelle wird fr das COBS-Code-Byte reserviert.
+///
+/// @param  TelemetryEncoder *encoder
+///
+/// @return void
+///
+//=================================================================================================
+static void TelemetryEncoderStart(TelemetryEncoder *encoder)
+{
+		encoder->codePosition = uartRingTxA.head;
+		encoder->position     = (uartRingTxA.head + 1) & UART_RING_INDEX_MASK;
+		encoder->code         = 1;
+		encoder->crc          = TELEMETRY_CRC_INIT;
+}
+
+
+//=== Function: TelemetryEncoderPut ===============================================================
+///
+/// @brief  Funktion kodiert ein Byte mit COBS direkt in den Sende-Ringpuffer. Ein 0x00-Byte wird
+///					nicht geschrieben, sondern beendet den aktuellen Block, dessen Code-Byte nachtrglich
+///					an der reservierten Stelle eingetragen wird.
+///
+/// @param  TelemetryEncoder *encoder, uint16_t byte
+///
+/// @return void
+///
+//=================================================================================================
+static void TelemetryEncoderPut(TelemetryEncoder *encoder, uint16_t byte)
+{
+		byte &= 0x00FF;
+		if (byte != 0)
+		{
+				uartRingTxA.data[encoder->position] = byte;
+				encoder->position = (encoder->position + 1) & UART_RING_INDEX_MASK;
+				encoder->code++;
+		}
+		// Block beenden bei 0x00 oder nach 254 Bytes ungleich 0x00
+		if ((byte == 0) || (encoder->code == 0xFF))
+		{
+				uartRingTxA.data[encoder->codePosition] = encoder->code;
+				encoder->codePosition = encoder->position;
+				encoder->position = (encoder->position + 1) & UART_RING_INDEX_MASK;
+				encoder->code = 1;
+		}
+}
+
+
+//=== Function: TelemetryEncoderPutData ===========================================================
+///
+/// @brief  Funktion kodiert ein Byte und bezieht es in die CRC16 ein.
+///
+/// @param  TelemetryEncoder *encoder, uint16_t byte
+///
+/// @return void
+///
+//=================================================================================================
+static void TelemetryEncoderPutData(TelemetryEncoder *encoder, uint16_t byte)
+{
+		encoder->crc = TelemetryCrc16(encoder->crc, byte);
+		TelemetryEncoderPut(encoder, byte);
+}
+
+
+//=== Function: TelemetryEncoderFinish ============================================================
+///
+/// @brief  Funktion kodiert die CRC16, schliet den letzten Block ab, hngt das Rahmenende an und
+///					gibt den Rahmen fr die Sende-ISR frei.
+///
+/// @param  TelemetryEncoder *encoder
+///
+/// @return void
+///
+//=================================================================================================
+static void TelemetryEncoderFinish(TelemetryEncoder *encoder)
+{
+		uint16_t crc = encoder->crc;
+
+		TelemetryEncoderPut(encoder, crc >> 8);
+		TelemetryEncoderPut(encoder, crc & 0x00FF);
+		uartRingTxA.data[encoder->codePosition] = encoder->code;
+		uartRingTxA.data[encoder->position] = TELEMETRY_DELIMITER;
+		UartTxCommitA((encoder->position + 1) & UART_RING_INDEX_MASK);
+		telemetryTxSequence = (telemetryTxSequence + 1) & 0x00FF;
+		telemetryTxFrames++;
+}
+
+
+//=== Function: TelemetryReserve ==================================================================
+///
+/// @brief  Funktion prft, ob ein Rahmen mit "numberOfBytes" Nutzdaten-Bytes im ungnstigsten Fall
+///					(max. COBS-Overhead) in den Sende-Ringpuffer passt.
+///
+/// @param  uint16_t numberOfBytes
+///
+/// @return bool enoughSpace
+///
+//=================================================================================================
+static bool TelemetryReserve(uint16_t numberOfBytes)
+{
+		uint16_t length = numberOfBytes + TELEMETRY_FRAME_OVERHEAD;
+
+		if (   !uartStreamModeA
+				|| (numberOfBytes > TELEMETRY_MAX_PAYLOAD)
+				|| (UartGetTxFreeA() < (length + length / 254 + 2)))
+		{
+				telemetryTxDropped++;
+				return false;
+		}
+		return true;
+}
+
+
+//=== Function: TelemetryDecode ===================================================================
+///
+/// @brief  Funktion dekodiert den empfangenen COBS-Rahmen, prft die CRC16 und die Sequenznummer
+///					und schreibt die Nutzdaten in "frame".
+///
+/// @param  TelemetryFrame *frame
+///
+/// @return bool frameValid
+///
+//=================================================================================================
+static bool TelemetryDecode(TelemetryFrame *frame)
+{
+		uint16_t decoded[TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD];
+		uint16_t length = 0;
+		uint16_t crc = TELEMETRY_CRC_INIT;
+		uint16_t i = 0;
+
+		// COBS dekodieren
+		while (i < telemetryRxEncodedLength)
+		{
+				uint16_t code = telemetryRxEncoded[i++];
+				if ((code == 0) || ((i + code - 1) > telemetryRxEncodedLength))
+				{
+						telemetryRxFramingErrors++;
+						return false;
+				}
+				for (uint16_t j=1; j<code; j++)
+				{
+						if (length >= (TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD))
+						{
+								telemetryRxFramingErrors++;
+								return false;
+						}
+						decoded[length++] = telemetryRxEncoded[i++];
+				}
+				// Nach einem Block ohne 0xFF-Code folgt ein 0x00-Byte (auer am Rahmenende)
+				if ((code != 0xFF) && (i < telemetryRxEncodedLength))
+				{
+						if (length >= (TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD))
+						{
+								telemetryRxFramingErrors++;
+								return false;
+						}
+						decoded[length++] = 0;
+				}
+		}
+		if (length < TELEMETRY_FRAME_OVERHEAD)
+		{
+				telemetryRxFramingErrors++;
+				return false;
+		}
+
+		// CRC ber Sequenznummer, Typ und Nutzdaten prfen
+		for (i=0; i<(length - 2); i++)
+		{
+				crc = TelemetryCrc16(crc, decoded[i]);
+		}
+		if (crc != ((decoded[length - 2] << 8) | decoded[length - 1]))
+		{
+				telemetryRxCrcErrors++;
+				return false;
+		}
+
+		frame->sequence = decoded[0];
+		frame->type     = decoded[1];
+		frame->length   = length - TELEMETRY_FRAME_OVERHEAD;
+		for (i=0; i<frame->length; i++)
+		{
+				frame->data[i] = decoded[2 + i];
+		}
+
+		// Lcken in der Sequenznummer zhlen
+		if (telemetryRxSynchronized)
+		{
+				telemetryRxLostFrames += (frame->sequence - telemetryRxSequence) & 0x00FF;
+		}
+		telemetryRxSequence = (frame->sequence + 1) & 0x00FF;
+		telemetryRxSynchronized = true;
+		telemetryRxFrames++;
+		return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TelemetryInit =====================================================================
+///
+/// @brief  Funktion initialisiert die Sequenznummern, die Statistik und den Empfangszustand.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TelemetryInit(void)
+{
+		telemetryTxSequence      = 0;
+		telemetryRxSequence      = 0;
+		telemetryRxSynchronized  = false;
+		telemetryRxEncodedLength = 0;
+		telemetryRxOverflow      = false;
+		telemetryTxFrames        = 0;
+		telemetryTxDropped       = 0;
+		telemetryRxFrames        = 0;
+		telemetryRxCrcErrors     = 0;
+		telemetryRxFramingErrors = 0;
+		telemetryRxLostFrames    = 0;
+}
+
+
+//=== Function: TelemetryCrc16 ====================================================================
+///
+/// @brief  Funktion berechnet die CRC16 (CCITT, Polynom 0x1021) ber ein Byte mit der VCRC-Einheit.
+///
+/// @param  uint16_t crc, uint16_t byte
+///
+/// @return uint16_t crc
+///
+//=================================================================================================
+uint16_t TelemetryCrc16(uint16_t crc, uint16_t byte)
+{
+		return CRC16_P2_BYTE(crc, byte);
+}
+
+
+//=== Function: TelemetrySendFrame ================================================================
+///
+/// @brief  Funktion kodiert einen Rahmen mit "numberOfBytes" Nutzdaten-Bytes (ein Byte pro
+///					Element von "data") direkt in den Sende-Ringpuffer. Passt der Rahmen nicht mehr in
+///					den Ringpuffer, wird er verworfen und "false" zurckgegeben.
+///
+/// @param  uint16_t type, const uint16_t *data, uint16_t numberOfBytes
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool TelemetrySendFrame(uint16_t type, const uint16_t *data, uint16_t numberOfBytes)
+{
+		TelemetryEncoder encoder;
+
+		if (!TelemetryReserve(numberOfBytes))
+		{
+				return false;
+		}
+		TelemetryEncoderStart(&encoder);
+		TelemetryEncoderPutData(&encoder, telemetryTxSequence);
+		TelemetryEncoderPutData(&encoder, type);
+		for (uint16_t i=0; i<numberOfBytes; i++)
+		{
+				TelemetryEncoderPutData(&encoder, data[i] & 0x00FF);
+		}
+		TelemetryEncoderFinish(&encoder);
+		return true;
+}
+
+
+//=== Function: TelemetrySendWords ================================================================
+///
+/// @brief  Funktion kodiert einen Rahmen mit "numberOfWords" 16 Bit-Werten (je zwei Bytes, Little-
+///					Endian) direkt in den Sende-Ringpuffer, z.B. fr ADC-Messreihen. Passt der Rahmen
+///					nicht mehr in den Ringpuffer, wird er verworfen und "false" zurckgegeben.
+///
+/// @param  uint16_t type, const uint16_t *words, uint16_t numberOfWords
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool TelemetrySendWords(uint16_t type, const uint16_t *words, uint16_t numberOfWords)
+{
+		TelemetryEncoder encoder;
+
+		if (!TelemetryReserve(numberOfWords * 2))
+		{
+				return false;
+		}
+		TelemetryEncoderStart(&encoder);
+		TelemetryEncoderPutData(&encoder, telemetryTxSequence);
+		TelemetryEncoderPutData(&encoder, type);
+		for (uint16_t i=0; i<numberOfWords; i++)
+		{
+				TelemetryEncoderPutData(&encoder, words[i] & 0x00FF);
+				TelemetryEncoderPutData(&encoder, words[i] >> 8);
+		}
+		TelemetryEncoderFinish(&encoder);
+		return true;
+}
+
+
+//=== Function: TelemetryReceiveFrame =============================================================
+///
+/// @brief  Funktion liest die empfangenen Bytes aus dem Empfangs-Ringpuffer, bis ein Rahmenende
+///					(0x00) erkannt wird. Anschlieend wird der Rahmen dekodiert und geprft. Bei einem
+///					gltigen Rahmen wird "true" zurckgegeben und der Rahmen in "frame" geschrieben.
+///					Fehlerhafte Rahmen werden verworfen, der Empfang synchronisiert sich mit dem nchsten
+///					Rahmenende neu. Die Funktion sollte zyklisch im Hauptprogramm aufgerufen werden.
+///
+/// @param  TelemetryFrame *frame
+///
+/// @return bool frameReceived
+///
+//=================================================================================================
+bool TelemetryReceiveFrame(TelemetryFrame *frame)
+{
+		uint16_t byte;
+
+		while (UartReadA(&byte, 1))
+		{
+				if (byte != TELEMETRY_DELIMITER)
+				{
+						// Zu langer Rahmen: Rest bis zum nchsten Rahmenende verwerfen
+						if (telemetryRxEncodedLength < TELEMETRY_MAX_ENCODED)
+						{
+								telemetryRxEncoded[telemetryRxEncodedLength++] = byte;
+						}
+						else
+						{
+								telemetryRxOverflow = true;
+						}
+						continue;
+				}
+
+				// Rahmenende erkannt
+				if (telemetryRxOverflow)
+				{
+						telemetryRxFramingErrors++;
+						telemetryRxOverflow = false;
+						telemetryRxEncodedLength = 0;
+				}
+				else if (telemetryRxEncodedLength > 0)
+				{
+						bool frameValid = TelemetryDecode(frame);
+						telemetryRxEncodedLength = 0;
+						if (frameValid)
+						{
+								return true;
+						}
+				}
+		}
+		return false;
+}
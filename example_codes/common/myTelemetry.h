@@ -0,0 +1,112 @@
+//=================================================================================================
+/// @file       myTelemetry.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein binres, rahmenbasiertes Telemetrie-
+///							Protokoll auf Basis des Streaming-Betriebs von "myUART.c". Jeder Rahmen besteht
+///							aus Sequenznummer, Typ, Nutzdaten mit variabler Lnge und einer CRC16 (CCITT,
+///							Polynom 0x1021, Startwert 0xFFFF). Der Rahmen wird mit COBS (Consistent Overhead
+///							Byte Stuffing) kodiert und mit einem 0x00-Byte abgeschlossen. Da 0x00 nur als
+///							Rahmenende vorkommt, kann sich der Empfnger nach jedem beliebigen Byte neu
+///							synchronisieren:
+///
+///							COBS( seq | type | data[0..n-1] | crcHigh | crcLow ) | 0x00
+///
+///							Die Rahmen werden ohne Zwischenpuffer direkt im Sende-Ringpuffer "uartRingTxA"
+///							kodiert und erst nach dem letzten Byte fr die ISR freigegeben. Vor der Benutzung
+///							muss "UartStartStreamA()" und "TelemetryInit()" aufgerufen werden.
+///
+///							nderung in Version 1.1: Die CRC16 wird mit der VCRC-Einheit berechnet
+///							(CRC16_P2_BYTE(), myCRC.h), die CRC-Tabelle entfllt.
+///
+///							nderung in Version 1.2: Rahmen-Typ fr das Firmware-Update (myUpdate.h)
+///
+///							nderung in Version 1.3: Die Datei liegt in "common" und wird von den Projekten
+///							F28386D_UART, F28386D_Testmode und F28386D_Tripzone verlinkt. Die Rahmen-Typen
+///							der Projekte sind zusammengefhrt und eindeutig nummeriert (CPU-Last fr myLoad.h,
+///							Trip-Eintrge fr myTripLog.h), TELEMETRY_TYPE_UPDATE ist jetzt 5.
+///
+/// @version    V1.3
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYTELEMETRY_H_
+#define MYTELEMETRY_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myUART.h"
+#include "myCRC.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Max. Anzahl an Nutzdaten-Bytes eines Rahmens (der kodierte Rahmen
+// muss vollstndig in den Sende-Ringpuffer passen)
+#define TELEMETRY_MAX_PAYLOAD										200
+// Bytes eines Rahmens zustzlich zu den Nutzdaten (Sequenznummer, Typ, CRC16)
+#define TELEMETRY_FRAME_OVERHEAD								4
+// Max. Lnge eines kodierten Rahmens inkl. COBS-Overhead und 0x00-Rahmenende
+#define TELEMETRY_MAX_ENCODED										(TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD \
+																								 + (TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD) / 254 + 2)
+// Rahmenende
+#define TELEMETRY_DELIMITER											0x00
+// Startwert der CRC16
+#define TELEMETRY_CRC_INIT											0xFFFF
+// Rahmen-Typen (frei erweiterbar)
+#define TELEMETRY_TYPE_RAW											0
+#define TELEMETRY_TYPE_ADC_CAPTURE							1
+#define TELEMETRY_TYPE_STATUS										2
+#define TELEMETRY_TYPE_CPU_LOAD									3
+#define TELEMETRY_TYPE_TRIP_RECORD							4
+#define TELEMETRY_TYPE_UPDATE										5
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Empfangener, dekodierter Rahmen (ein Byte pro Element)
+typedef struct
+{
+		uint16_t sequence;
+		uint16_t type;
+		uint16_t length;
+		uint16_t data[TELEMETRY_MAX_PAYLOAD];
+} TelemetryFrame;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl gesendeter Rahmen und der Rahmen, die wegen eines vollen Sende-Ringpuffers verworfen wurden
+extern uint32_t telemetryTxFrames;
+extern uint32_t telemetryTxDropped;
+// Anzahl empfangener gltiger Rahmen, Rahmen mit falscher CRC, fehlerhafter Kodierung und
+// fehlender Rahmen (Lcke in der Sequenznummer)
+extern uint32_t telemetryRxFrames;
+extern uint32_t telemetryRxCrcErrors;
+extern uint32_t telemetryRxFramingErrors;
+extern uint32_t telemetryRxLostFrames;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die Sequenznummern, die Statistik und den Empfangszustand
+extern void TelemetryInit(void);
+// Funktion berechnet die CRC16 ber ein Byte
+extern uint16_t TelemetryCrc16(uint16_t crc, uint16_t byte);
+// Funktion sendet einen Rahmen mit "numberOfBytes" Nutzdaten-Bytes
+extern bool TelemetrySendFrame(uint16_t type, const uint16_t *data, uint16_t numberOfBytes);
+// Funktion sendet einen Rahmen mit "numberOfWords" 16 Bit-Werten (Little-Endian, z.B. ADC-Werte)
+extern bool TelemetrySendWords(uint16_t type, const uint16_t *words, uint16_t numberOfWords);
+// Funktion liest Bytes aus dem Empfangs-Ringpuffer und gibt "true" zurck,
+// sobald ein vollstndiger, gltiger Rahmen empfangen wurde
+extern bool TelemetryReceiveFrame(TelemetryFrame *frame);
+
+
+#endif
@@ -13,12 +13,30 @@
 ///							prfen. Nheres ist der Beschreibung der Funktion "UartGetStatusRx()" zu entnehmen.
 ///							Es wird das SCI-A Modul verwendet. Die Module B, C und D knnen analog zu den hier
 ///							gezeigten Funktionen verwendet werden.
+///							Die Datei liegt in "common" und wird von den Projekten F28386D_UART und
+///							F28386D_Tripzone verlinkt.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
 ///
-/// @version    V2.0
+///							nderung in Version 2.1: Streaming-Betrieb mit Ringpuffern. Nach Aufruf der
+///							Funktion "UartStartStreamA()" ist der Empfang dauerhaft eingeschaltet. Die ISRs
+///							fllen bzw. leeren je einen Ringpuffer fr Rx und Tx (ein Erzeuger, ein
+///							Verbraucher, keine Sperre ntig), sodass zwischen zwei Datenpaketen keine Bytes
+///							verloren gehen. Die Daten werden mit "UartWriteA()" in den Sende-Ringpuffer
+///							geschrieben und mit "UartReadA()" aus dem Empfangs-Ringpuffer gelesen.
 ///
-/// @date       24.03.2023
+///							nderung in Version 2.2: Die Software-Puffer "uartBufferRxA[]" und "uartBufferTxA[]"
+///							sind gepackt (zwei Bytes pro Wort, myByteBuffer.h) und belegen nur noch die Hlfte
+///							des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET() und BYTE_BUFFER_SET().
+///
+///							nderung in Version 2.3: Beliebige Baudraten (gerundeter Teiler aus dem aktuellen
+///							Low-Speed Peripheral Clock, erreichte Baudrate und Abweichung in "uartBaudActualA"
+///							bzw. "uartBaudErrorPpmA"), Baudraten ber 921600 bis LSPCLK / 16 und automatische
+///							Erkennung der Baudrate ("UartAutoBaudStartA()", "UartAutoBaudPollA()")
+///
+/// @version    V2.3
+///
+/// @date       14.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -31,9 +49,9 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die UART-Kommunikation
-uint16_t uartBufferRxA[UART_SIZE_SOFTWARE_BUFFER_RX];
-uint16_t uartBufferTxA[UART_SIZE_SOFTWARE_BUFFER_TX];
+// Software-Puffer fr die UART-Kommunikation (gepackt, zwei Bytes pro Wort)
+uint16_t uartBufferRxA[BYTE_BUFFER_WORDS(UART_SIZE_SOFTWARE_BUFFER_RX)];
+uint16_t uartBufferTxA[BYTE_BUFFER_WORDS(UART_SIZE_SOFTWARE_BUFFER_TX)];
 // Steuern das Kopieren in und aus den Software-Puffern whrend der UART-Kommunikation
 uint16_t uartBufferIndexRxA;
 uint16_t uartBufferIndexTxA;
@@ -45,6 +63,9 @@ uint32_t uartOldValueFifoBufferA;
 // Flags speichern den aktuellen Zustand der UART-Kommunikation
 uint16_t uartStatusFlagRxA;
 uint16_t uartStatusFlagTxA;
+// Alle Bytes des Datenpakets wurden in den Sende-FIFO geschrieben, das Ende des
+// Sendevorgangs (SCICTL2.TXEMPTY) wird von "UartPollTxA()" geprft
+volatile bool uartTxLastByteLoadedA;
 // Flag kann zum Aufruf der Funktion "UartGetStatusRxA()" genutzt werden
 // und sollte dazu regelmig (z.B. alle 5 ms) in einer ISR gesetzt werden.
 // Anschlieend kann z.B. im Hauptprogramm bei gesetztem Flag die Funktion
@@ -52,6 +73,119 @@ uint16_t uartStatusFlagTxA;
 bool uartFlagCheckRxA;
 // Timeout-Zhler fr den Empfang eines Datenpakets
 int32_t uartRxTimeoutA = UART_NO_TIMEOUT;
+// Ringpuffer fr den Streaming-Betrieb
+UartRingBuffer uartRingRxA;
+UartRingBuffer uartRingTxA;
+// Streaming-Betrieb aktiv
+bool uartStreamModeA = false;
+// Anzahl der Bytes, die wegen eines vollen Empfangs-Ringpuffers verworfen wurden
+uint32_t uartRingOverflowA = 0;
+// Tatschlich eingestellte Baudrate und Abweichung von der gewnschten Baudrate in ppm
+uint32_t uartBaudActualA = 0;
+int32_t uartBaudErrorPpmA = 0;
+// Automatische Erkennung der Baudrate aktiv
+bool uartAutoBaudActiveA = false;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local variables
+//-------------------------------------------------------------------------------------------------
+// Gewnschte Baudrate (Bezug fr "uartBaudErrorPpmA", nach der automatischen Erkennung die
+// erkannte Baudrate)
+static uint32_t uartBaudRequestedA = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UartUpdateBaudA ===================================================================
+///
+/// @brief  Funktion berechnet aus dem Baudraten-Teiler von SCI-A und dem aktuellen Low-Speed
+///					Peripheral Clock die tatschliche Baudrate und deren Abweichung von der gewnschten
+///					Baudrate (BAUD = LSPCLK / ((BRR + 1) * 8), BRR = 0 ergibt LSPCLK / 16)
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UartUpdateBaudA(void)
+{
+		uint32_t divider = ((uint32_t)SciaRegs.SCIHBAUD.bit.BAUD << 8) | SciaRegs.SCILBAUD.bit.BAUD;
+
+		if (divider == 0)
+				divider = 1;
+		uartBaudActualA = DEVICE_LSPCLK_HZ / ((divider + 1UL) * 8UL);
+		if (uartBaudRequestedA == 0)
+				uartBaudRequestedA = uartBaudActualA;
+		uartBaudErrorPpmA = (int32_t)(((int64_t)uartBaudActualA - (int64_t)uartBaudRequestedA)
+																	* 1000000LL / (int64_t)uartBaudRequestedA);
+}
+
+
+//=== Function: UartSetBaudA ======================================================================
+///
+/// @brief  Funktion setzt den Baudraten-Teiler von SCI-A fr eine beliebige Baudrate. Der Teiler
+///					wird auf die nchstliegende Baudrate gerundet und auf 1 ... 0xFFFF begrenzt
+///					(BRR = LSPCLK / (BAUD * 8) - 1, hchste Baudrate LSPCLK / 16)
+///
+/// @param  uint32_t baud
+///
+/// @return void
+///
+//=================================================================================================
+static void UartSetBaudA(uint32_t baud)
+{
+		uint32_t divider;
+
+		if (baud == 0)
+				baud = UART_BAUD_9600;
+		// Gerundet: (LSPCLK + BAUD * 4) / (BAUD * 8) - 1
+		divider = (DEVICE_LSPCLK_HZ + baud * 4U) / (baud * 8U);
+		divider = (divider > 1) ? (divider - 1U) : 1U;
+		if (divider > 0xFFFF)
+				divider = 0xFFFF;
+		SciaRegs.SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
+		SciaRegs.SCILBAUD.bit.BAUD =  divider & 0x00FF;
+
+		uartBaudRequestedA = baud;
+		UartUpdateBaudA();
+}
+
+
+//=== Function: UartRxStreamDrainA ================================================================
+///
+/// @brief  Funktion kopiert alle Bytes des Empfangs-FIFOs in den Empfangs-Ringpuffer. Ist der
+///					Ringpuffer voll, wird das Byte verworfen und der Zhler "uartRingOverflowA" erhht.
+///					Wird aus "UartRxStreamISRA()" und "UartPollRxA()" aufgerufen. Beide laufen im
+///					Interrupt-Kontext ohne Verschachtelung, es gibt also weiterhin nur einen Erzeuger.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+static void UartRxStreamDrainA(void)
+{
+		uint16_t head = uartRingRxA.head;
+
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				uint16_t byte = SciaRegs.SCIRXBUF.bit.SAR;
+				uint16_t next = (head + 1) & UART_RING_INDEX_MASK;
+				if (next == uartRingRxA.tail)
+				{
+						uartRingOverflowA++;
+				}
+				else
+				{
+						uartRingRxA.data[head] = byte;
+						head = next;
+				}
+		}
+		// Index erst nach dem Kopieren verffentlichen
+		uartRingRxA.head = head;
+}
 
 
 //-------------------------------------------------------------------------------------------------
@@ -60,7 +194,8 @@ int32_t uartRxTimeoutA = UART_NO_TIMEOUT;
 //=== Function: UartInitA =========================================================================
 ///
 /// @brief  Funktion initialisiert GPIO 28 und 135 als UART-Pins und das
-///         SCI-A Modul fr den UART-Betrieb mit der gewnschten Baudrate.
+///         SCI-A Modul fr den UART-Betrieb mit der gewnschten Baudrate. Die Baudrate ist
+///         beliebig (siehe "UartSetBaudA()"), die erreichte steht in "uartBaudActualA".
 ///
 /// @param  uint32_t baud, uint32_t numberOfDataBits, uint32_t numberOfStopBits, uint32_t parity
 ///
@@ -109,11 +244,9 @@ void UartInitA(uint32_t baud,
     CpuSysRegs.PCLKCR7.bit.SCI_A = 1;
     __asm(" RPT #4 || NOP");
     // Baudrate setzen
-    // (Low-Speed CLK / (BAUD * SCICHAR)) - 1
-    // Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
-    uint32_t divider = (50000000 / (baud * 8U)) - 1U;
-    SciaRegs.SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
-    SciaRegs.SCILBAUD.bit.BAUD =  divider & 0x00FF;
+    // (Low-Speed CLK / (BAUD * 8)) - 1, gerundet
+    // Low-Speed CLK = SYSCLK / 4 (50 MHz bei 200 MHz, siehe "DeviceInit()")
+    UartSetBaudA(baud);
     // Anzahl der Datenbits setzen
     SciaRegs.SCICCR.bit.SCICHAR = numberOfDataBits;
     // Anzahl der Stopbits setzen
@@ -180,8 +313,89 @@ void UartInitA(uint32_t baud,
 		uartBytesToTransferTxA = 0;
 		uartStatusFlagRxA      = UART_STATUS_IDLE;
 		uartStatusFlagTxA      = UART_STATUS_IDLE;
+		uartTxLastByteLoadedA  = false;
 		uartFlagCheckRxA       = false;
 		uartRxTimeoutA         = UART_NO_TIMEOUT;
+		uartAutoBaudActiveA    = false;
+}
+
+
+//=== Function: UartAutoBaudStartA ================================================================
+///
+/// @brief  Funktion startet die automatische Erkennung der Baudrate (Autobaud, siehe Kapitel SCI
+///					im Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Der Teiler wird auf
+///					UART_AUTO_BAUD_DIVIDER gesetzt, danach muss die Gegenstelle in der gewnschten
+///					Baudrate das Zeichen 'A' oder 'a' senden. Die Hardware misst das Zeichen und trgt
+///					den Teiler ein, der Abschluss wird mit "UartAutoBaudPollA()" abgefragt. Bei hohen
+///					Baudraten (ab ca. 100 kBaud) kann die Flankensteilheit der bertragung die Erkennung
+///					verhindern, dann die Baudrate fest mit "UartInitA()" einstellen. Die Erkennung
+///					wird nur gestartet, falls keine Kommunikation und kein Streaming-Betrieb aktiv ist.
+///
+/// @param  void
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool UartAutoBaudStartA(void)
+{
+		if (   uartStreamModeA
+				|| (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+				|| (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS))
+		{
+				return false;
+		}
+
+		// Empfang einschalten, der Empfangs-Interrupt bleibt aus
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCICTL1.bit.RXENA = 1;
+		// Teiler fr die Messung setzen, Flag lschen und Erkennung einschalten
+		SciaRegs.SCIHBAUD.bit.BAUD = (UART_AUTO_BAUD_DIVIDER & 0xFF00) >> 8;
+		SciaRegs.SCILBAUD.bit.BAUD =  UART_AUTO_BAUD_DIVIDER & 0x00FF;
+		SciaRegs.SCIFFCT.bit.ABDCLR = 1;
+		SciaRegs.SCIFFCT.bit.CDC = 1;
+		uartAutoBaudActiveA = true;
+
+		return true;
+}
+
+
+//=== Function: UartAutoBaudPollA =================================================================
+///
+/// @brief  Funktion prft ohne zu blockieren, ob die automatische Erkennung der Baudrate
+///					abgeschlossen ist (SCIFFCT.ABD). In dem Fall wird die Erkennung ausgeschaltet, der
+///					Empfangs-FIFO geleert und die erkannte Baudrate in "uartBaudActualA" eingetragen.
+///					Sie ist danach der Bezug fr "uartBaudErrorPpmA". Zyklisch (z.B. in einer Task)
+///					aufrufen.
+///
+/// @param  void
+///
+/// @return bool baudDetected
+///
+//=================================================================================================
+bool UartAutoBaudPollA(void)
+{
+		if (!uartAutoBaudActiveA || !SciaRegs.SCIFFCT.bit.ABD)
+		{
+				return false;
+		}
+
+		// Flag lschen und Erkennung ausschalten
+		SciaRegs.SCIFFCT.bit.ABDCLR = 1;
+		SciaRegs.SCIFFCT.bit.CDC = 0;
+		uartAutoBaudActiveA = false;
+
+		// Zeichen der Messung verwerfen
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				(void)SciaRegs.SCIRXBUF.all;
+		}
+		SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+
+		// Erkannte Baudrate als neuen Bezug bernehmen
+		uartBaudRequestedA = 0;
+		UartUpdateBaudA();
+
+		return true;
 }
 
 
@@ -196,10 +410,7 @@ void UartInitA(uint32_t baud,
 //=================================================================================================
 void UartInitBufferRxA(void)
 {
-    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_RX; i++)
-    {
-        uartBufferRxA[i] = 0;
-    }
+    ByteBufferClear(uartBufferRxA, UART_SIZE_SOFTWARE_BUFFER_RX);
 }
 
 
@@ -214,10 +425,7 @@ void UartInitBufferRxA(void)
 //=================================================================================================
 void UartInitBufferTxA(void)
 {
-    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_TX; i++)
-    {
-        uartBufferTxA[i] = 0;
-    }
+    ByteBufferClear(uartBufferTxA, UART_SIZE_SOFTWARE_BUFFER_TX);
 }
 
 
@@ -328,11 +536,11 @@ extern uint16_t UartGetStatusRxA(void)
 ///
 ///					- UART_STATUS_IDLE       : Es ist keine Sende-Kommunikation aktiv
 ///					- UART_STATUS_IN_PROGRESS: Eine Sende-Kommunikation wurde gestartet
-///					- UART_STATUS_FINISHED   : Das letzte Byte wurde begonnen zu senden,
-///																		 ist aber noch nicht koplett versendet
+///					- UART_STATUS_FINISHED   : Das letzte Byte wurde vollstndig gesendet
 ///
 ///					Zum starten einer Sende-Kommunikation muss die Funktionen "UartTransmitA()"
-///					aufgerufen werden.
+///					aufgerufen werden. Das Ende der bertragung wird bei jedem Aufruf mit der Funktion
+///					"UartPollTxA()" geprft.
 ///
 /// @param	void
 ///
@@ -341,10 +549,42 @@ extern uint16_t UartGetStatusRxA(void)
 //=================================================================================================
 extern uint16_t UartGetStatusTxA(void)
 {
+		UartPollTxA();
 		return uartStatusFlagTxA;
 }
 
 
+//=== Function: UartPollTxA =======================================================================
+///
+/// @brief	Funktion prft, ob das letzte Byte eines Datenpakets vollstndig gesendet wurde und
+///					setzt in diesem Fall das Status-Flag auf "UART_STATUS_FINISHED". Die ISR
+///					"UartTxISRA()" wartet nicht mehr auf SCICTL2.TXEMPTY, sondern markiert nur, dass
+///					alle Bytes in den Sende-FIFO geschrieben wurden. Die Funktion wird von
+///					"UartGetStatusTxA()" aufgerufen und kann zustzlich zyklisch aus einer Timer-ISR
+///					aufgerufen werden (z.B. "Pwm8ISR()"), z.B. um einen RS485-Treiber rechtzeitig auf
+///					"Empfang" umzuschalten. Sie blockiert nie.
+///
+/// @param	void
+///
+/// @return bool transmissionFinished
+///
+//=================================================================================================
+extern bool UartPollTxA(void)
+{
+		// SCICTL2.TXEMPTY wird gesetzt, sobald der Sende-FIFO und das Ausgangs-
+		// Schieberegister TXSHF leer sind (S. 3888 Reference Manual TMS320F2838x,
+		// SPRUII0D, Rev. D, July 2022)
+		if (   uartTxLastByteLoadedA
+				&& (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS)
+				&& SciaRegs.SCICTL2.bit.TXEMPTY)
+		{
+				uartTxLastByteLoadedA = false;
+				uartStatusFlagTxA = UART_STATUS_FINISHED;
+		}
+		return (uartStatusFlagTxA == UART_STATUS_FINISHED);
+}
+
+
 //=== Function: UartSetStatusIdleRxA ==============================================================
 ///
 /// @brief	Funktion setzt das Rx Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
@@ -386,7 +626,7 @@ extern bool UartSetStatusIdleTxA(void)
 		bool flagSetToIdle = false;
 		// Staus-Flag nur auf "idle" setzen, falls eine
 		// vorherige Kommunikation abgeschlossen ist
-		if (uartStatusFlagTxA == UART_STATUS_FINISHED)
+		if (UartPollTxA())
 		{
 				uartStatusFlagTxA = UART_STATUS_IDLE;
 				flagSetToIdle = true;
@@ -423,7 +663,9 @@ extern bool UartReceiveA(uint16_t numberOfBytesRx,
 		// nicht berschreitet und mindestens 1 ist
 		if ((uartStatusFlagRxA != UART_STATUS_IN_PROGRESS)
 				&& (numberOfBytesRx <= UART_SIZE_SOFTWARE_BUFFER_RX)
-				&& numberOfBytesRx)
+				&& numberOfBytesRx
+				&& !uartStreamModeA
+				&& !uartAutoBaudActiveA)
 		{
 				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
 				// zu signalisieren, dass der Empfangsvorgang initiiert wurde
@@ -445,7 +687,7 @@ extern bool UartReceiveA(uint16_t numberOfBytesRx,
 				// Empfangs-FIFO leeren, falls in diesem noch Daten vorhanden sind
 				while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
 				{
-						uint16_t dummy = SciaRegs.SCIRXBUF.bit.SAR;
+						(void)SciaRegs.SCIRXBUF.all;
 				}
 				uartOldValueFifoBufferA = SciaRegs.SCIFFRX.bit.RXFFST;
 		    // Empfangs-FIFO-Interrupt auslsen, wenn die Anzahl
@@ -494,7 +736,9 @@ extern bool UartTransmitA(uint16_t numberOfBytesTx)
 		// nicht berschreitet und mindestens 1 ist
 		if ((uartStatusFlagTxA != UART_STATUS_IN_PROGRESS)
 				&& (numberOfBytesTx <= UART_SIZE_SOFTWARE_BUFFER_TX)
-				&& numberOfBytesTx)
+				&& numberOfBytesTx
+				&& !uartStreamModeA
+				&& !uartAutoBaudActiveA)
 		{
 				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
 				// zu signalisieren, dass der Sendevorgang gestartet wurde
@@ -502,6 +746,7 @@ extern bool UartTransmitA(uint16_t numberOfBytesTx)
 				// Flag setzen um der aufrufenden Stelle zu signalisieren,
 				// dass eine UART-Kommunikation gestartet wurde
 				uartStatusFlagTxA = UART_STATUS_IN_PROGRESS;
+				uartTxLastByteLoadedA = false;
 				// Index zur Verwaltung des Software-Puffers "uartBufferTxA[]" auf das erste Element
 				// setzen, damit die zu sendenen Daten vom Anfang des Puffers aus kopiert werden
 				uartBufferIndexTxA = 0;
@@ -515,7 +760,7 @@ extern bool UartTransmitA(uint16_t numberOfBytesTx)
 				while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
 							 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
 				{
-						SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
+						SciaRegs.SCITXBUF.bit.TXDT = BYTE_BUFFER_GET(uartBufferTxA, uartBufferIndexTxA);
 						uartBufferIndexTxA++;
 				}
 		    // Sende-FIFO-Interrupt-Flag lschen
@@ -538,6 +783,243 @@ extern bool UartTransmitA(uint16_t numberOfBytesTx)
 }
 
 
+//=== Function: UartStartStreamA ==================================================================
+///
+/// @brief  Funktion startet den Streaming-Betrieb. Die Ringpuffer werden geleert, die ISRs fr
+///					den Streaming-Betrieb in die PIE-Vector Table eingetragen und der Empfang dauerhaft
+///					eingeschaltet. Im Gegensatz zu "UartReceiveA()" muss der Empfang nicht nach jedem
+///					Datenpaket neu freigegeben werden, alle empfangenen Bytes landen lckenlos im
+///					Ringpuffer "uartRingRxA". Die Funktionen "UartReceiveA()" und "UartTransmitA()"
+///					sind im Streaming-Betrieb gesperrt. Der Betrieb wird nur gestartet, falls keine
+///					Kommunikation mit den Funktionen "UartReceiveA()" bzw. "UartTransmitA()" aktiv ist.
+///
+/// @param  void
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+extern bool UartStartStreamA(void)
+{
+		if (   uartAutoBaudActiveA
+				|| (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+				|| (uartStatusFlagTxA == UART_STATUS_IN_PROGRESS))
+		{
+				return false;
+		}
+
+		// FIFO-Interrupts whrend der Umstellung ausschalten
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+
+		// Ringpuffer leeren
+		uartRingRxA.head  = 0;
+		uartRingRxA.tail  = 0;
+		uartRingTxA.head  = 0;
+		uartRingTxA.tail  = 0;
+		uartRingOverflowA = 0;
+
+		// ISRs fr den Streaming-Betrieb eintragen
+		EALLOW;
+		PieVectTable.SCIA_RX_INT = &UartRxStreamISRA;
+		PieVectTable.SCIA_TX_INT = &UartTxStreamISRA;
+		EDIS;
+		uartStreamModeA = true;
+
+		// Empfangs-FIFO leeren, falls in diesem noch Daten vorhanden sind
+		while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				(void)SciaRegs.SCIRXBUF.all;
+		}
+		SciaRegs.SCIFFRX.bit.RXFFIL = UART_STREAM_RX_FIFO_LEVEL;
+		SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 1;
+		SciaRegs.SCICTL1.bit.RXENA = 1;
+
+		// Senden bleibt dauerhaft eingeschaltet. Der Sende-FIFO-Interrupt
+		// wird erst von "UartWriteA()" eingeschaltet
+		SciaRegs.SCIFFTX.bit.TXFFIL = UART_STREAM_TX_FIFO_LEVEL;
+		SciaRegs.SCICTL1.bit.TXENA = 1;
+		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+
+		return true;
+}
+
+
+//=== Function: UartStopStreamA ===================================================================
+///
+/// @brief  Funktion beendet den Streaming-Betrieb und trgt wieder die ISRs fr die Kommunikation
+///					mit "UartReceiveA()" und "UartTransmitA()" ein. Noch nicht gesendete Bytes im
+///					Sende-Ringpuffer werden verworfen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartStopStreamA(void)
+{
+		SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+		SciaRegs.SCICTL1.bit.RXENA = 0;
+		SciaRegs.SCICTL1.bit.TXENA = 0;
+
+		EALLOW;
+		PieVectTable.SCIA_RX_INT = &UartRxISRA;
+		PieVectTable.SCIA_TX_INT = &UartTxISRA;
+		EDIS;
+
+		uartStreamModeA   = false;
+		uartStatusFlagRxA = UART_STATUS_IDLE;
+		uartStatusFlagTxA = UART_STATUS_IDLE;
+}
+
+
+//=== Function: UartWriteA ========================================================================
+///
+/// @brief  Funktion schreibt bis zu "numberOfBytes" Bytes in den Sende-Ringpuffer und schaltet den
+///					Sende-FIFO-Interrupt ein. Die ISR "UartTxStreamISRA()" kopiert die Bytes in den
+///					Sende-FIFO. Ist im Ringpuffer nicht genug Platz, werden nur so viele Bytes
+///					geschrieben, wie Platz ist. Darf nur aus einem Programmteil aufgerufen werden
+///					(ein Erzeuger).
+///
+/// @param  const uint16_t *data, uint16_t numberOfBytes
+///
+/// @return uint16_t Anzahl der geschriebenen Bytes
+///
+//=================================================================================================
+extern uint16_t UartWriteA(const uint16_t *data, uint16_t numberOfBytes)
+{
+		uint16_t head = uartRingTxA.head;
+		uint16_t space = UartGetTxFreeA();
+
+		if (!uartStreamModeA)
+		{
+				return 0;
+		}
+		if (numberOfBytes > space)
+		{
+				numberOfBytes = space;
+		}
+		for (uint16_t i=0; i<numberOfBytes; i++)
+		{
+				uartRingTxA.data[head] = data[i] & 0x00FF;
+				head = (head + 1) & UART_RING_INDEX_MASK;
+		}
+		if (numberOfBytes)
+		{
+				UartTxCommitA(head);
+		}
+		return numberOfBytes;
+}
+
+
+//=== Function: UartTxCommitA =====================================================================
+///
+/// @brief  Funktion gibt die Bytes im Sende-Ringpuffer bis zur Position "head" (exklusive) fr die
+///					ISR frei und schaltet den Sende-FIFO-Interrupt ein. Ist der FIFO bereits unter dem
+///					Interrupt-Niveau, wird die ISR sofort aufgerufen. Damit knnen Daten direkt im
+///					Ringpuffer aufgebaut werden (z.B. von "myTelemetry.c"), ohne sie vorher in einen
+///					eigenen Puffer zu schreiben. Der Aufrufer muss zuvor mit "UartGetTxFreeA()" prfen,
+///					dass genug Platz vorhanden ist.
+///
+/// @param  uint16_t head
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartTxCommitA(uint16_t head)
+{
+		// Erst nach dem Kopieren der Daten den Index verffentlichen
+		uartRingTxA.head = head & UART_RING_INDEX_MASK;
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+}
+
+
+//=== Function: UartReadA =========================================================================
+///
+/// @brief  Funktion liest bis zu "maxNumberOfBytes" Bytes aus dem Empfangs-Ringpuffer. Darf nur
+///					aus einem Programmteil aufgerufen werden (ein Verbraucher).
+///
+/// @param  uint16_t *data, uint16_t maxNumberOfBytes
+///
+/// @return uint16_t Anzahl der gelesenen Bytes
+///
+//=================================================================================================
+extern uint16_t UartReadA(uint16_t *data, uint16_t maxNumberOfBytes)
+{
+		uint16_t tail  = uartRingRxA.tail;
+		uint16_t count = UartGetRxCountA();
+
+		if (maxNumberOfBytes > count)
+		{
+				maxNumberOfBytes = count;
+		}
+		for (uint16_t i=0; i<maxNumberOfBytes; i++)
+		{
+				data[i] = uartRingRxA.data[tail];
+				tail = (tail + 1) & UART_RING_INDEX_MASK;
+		}
+		// Erst nach dem Kopieren der Daten den Platz freigeben
+		uartRingRxA.tail = tail;
+		return maxNumberOfBytes;
+}
+
+
+//=== Function: UartGetRxCountA ===================================================================
+///
+/// @brief  Funktion gibt die Anzahl der Bytes im Empfangs-Ringpuffer zurck
+///
+/// @param  void
+///
+/// @return uint16_t count
+///
+//=================================================================================================
+extern uint16_t UartGetRxCountA(void)
+{
+		return (uartRingRxA.head - uartRingRxA.tail) & UART_RING_INDEX_MASK;
+}
+
+
+//=== Function: UartGetTxFreeA ====================================================================
+///
+/// @brief  Funktion gibt die Anzahl freier Pltze im Sende-Ringpuffer zurck. Ein Platz bleibt
+///					immer frei, um einen vollen von einem leeren Ringpuffer zu unterscheiden.
+///
+/// @param  void
+///
+/// @return uint16_t free
+///
+//=================================================================================================
+extern uint16_t UartGetTxFreeA(void)
+{
+		return (uartRingTxA.tail - uartRingTxA.head - 1) & UART_RING_INDEX_MASK;
+}
+
+
+//=== Function: UartPollRxA =======================================================================
+///
+/// @brief  Funktion kopiert im Streaming-Betrieb die Bytes aus dem Empfangs-FIFO in den Ring-
+///					puffer, die das Interrupt-Niveau UART_STREAM_RX_FIFO_LEVEL nicht erreichen (z.B.
+///					das Ende eines Datenpakets). Dadurch wird die ISR "UartRxStreamISRA()" nur einmal
+///					pro UART_STREAM_RX_FIFO_LEVEL Bytes statt fr jedes Byte aufgerufen. Die Funktion
+///					muss zyklisch aus einer ISR aufgerufen werden, die nicht von der SCI-A-ISR
+///					unterbrochen werden kann (z.B. "Pwm8ISR()", keine Interrupt-Verschachtelung).
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+extern void UartPollRxA(void)
+{
+		if (uartStreamModeA)
+		{
+				UartRxStreamDrainA();
+		}
+}
+
+
 //=== Function: UartRxISRA ========================================================================
 ///
 /// @brief  ISR wird aufgerufen, sobald der (Hardware-) Empfangs-FIFO voll ist oder die Anzahl
@@ -552,6 +1034,8 @@ extern bool UartTransmitA(uint16_t numberOfBytesTx)
 //=================================================================================================
 __interrupt void UartRxISRA(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_RX);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -566,7 +1050,7 @@ __interrupt void UartRxISRA(void)
 		while (   (uartBufferIndexRxA < uartBytesToTransferRxA)
 					 && (SciaRegs.SCIFFRX.bit.RXFFST > 0))
 		{
-				uartBufferRxA[uartBufferIndexRxA] = SciaRegs.SCIRXBUF.bit.SAR;
+				BYTE_BUFFER_SET(uartBufferRxA, uartBufferIndexRxA, SciaRegs.SCIRXBUF.bit.SAR);
 				uartBufferIndexRxA++;
 		}
 		// Es werden noch weitere Bytes erwartet -> neues Interrupt-Niveau setzen
@@ -595,6 +1079,7 @@ __interrupt void UartRxISRA(void)
 		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_RX-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_RX);
 }
 
 
@@ -606,6 +1091,7 @@ __interrupt void UartRxISRA(void)
 ///					Sendevorgangs! Sind beim Aufruf der ISR noch weitere Bytes zu senden, so wird
 ///         das nchste aus dem Software-Puffer "uartBufferTxA[]" gesendet. Andernfalls wird
 ///         der Tx-Interrupt ausgeschaltet. Anschlieend werden alle Interrupt-Flags gelscht.
+///					Auf das Ende des letzten Bytes wird nicht gewartet, dies prft "UartPollTxA()".
 ///
 /// @param  void
 ///
@@ -614,6 +1100,8 @@ __interrupt void UartRxISRA(void)
 //=================================================================================================
 __interrupt void UartTxISRA(void)
 {
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_TX);
+
 		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
 		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
 		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
@@ -635,16 +1123,10 @@ __interrupt void UartTxISRA(void)
 		    SciaRegs.SCICTL1.bit.TXENA = 0;
 		    // Sende-FIFO-Interrupt ausschalten
 		    SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
-				// Warten, bis das letzte Byte vollstndig gesendet wurde und anschlieend
-		    // das Status-Flag setzen um das Ende der bertragung zu signalisieren.
-		    // SCICTL2.TXEMPTY wird gesetzt, sobald der Sende-FIFO und das Ausgangs-
-		    // Schieberegister TXSHF leer sind (S. 3888 Reference Manual TMS320F2838x,
-		    // SPRUII0D, Rev. D, July 2022). Bei zeitkritischen Anwendungen sollte die
-		    // Abfrage von SCICTL2.TXEMPTY aus der ISR ausgelagert werden und zyklisch
-		    // erfolgen
-		    #warning "Achtung: while()-Schleife blockiert Prorammablauf!"
-		    while(!SciaRegs.SCICTL2.bit.TXEMPTY);
-				uartStatusFlagTxA = UART_STATUS_FINISHED;
+				// Nicht auf das Ende des letzten Bytes warten (SCICTL2.TXEMPTY), da dies
+				// die PIE-Gruppe 9 bis zu einer Zeichendauer blockieren wrde. Das Ende
+				// der bertragung wird von "UartPollTxA()" erkannt
+				uartTxLastByteLoadedA = true;
 		}
     // Zu sendene Daten von dem Software-Puffer in den Sende-FIFO kopieren
 		// bis diser gefllt ist oder der Software-Puffer leer ist. Dieser
@@ -653,7 +1135,7 @@ __interrupt void UartTxISRA(void)
 		while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
 					 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
 		{
-				SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
+				SciaRegs.SCITXBUF.bit.TXDT = BYTE_BUFFER_GET(uartBufferTxA, uartBufferIndexTxA);
 				uartBufferIndexTxA++;
 		}
 
@@ -661,4 +1143,77 @@ __interrupt void UartTxISRA(void)
 		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_TX-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_TX);
+}
+
+
+//=== Function: UartRxStreamISRA ==================================================================
+///
+/// @brief  ISR des Streaming-Betriebs. Wird aufgerufen, sobald die Anzahl an Bytes im Empfangs-
+///					FIFO das Interrupt-Niveau erreicht. Alle Bytes des FIFOs werden in den Empfangs-
+///					Ringpuffer kopiert (siehe "UartRxStreamDrainA()"). Der Empfang bleibt eingeschaltet.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxStreamISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_RX);
+
+		UartRxStreamDrainA();
+
+		// berlauf des Hardware-FIFOs quittieren, da sonst kein weiterer Interrupt ausgelst wird
+		if (SciaRegs.SCIFFRX.bit.RXFFOVF)
+		{
+				uartRingOverflowA++;
+				SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+		}
+
+		// Empfangs-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_RX);
+}
+
+
+//=== Function: UartTxStreamISRA ==================================================================
+///
+/// @brief  ISR des Streaming-Betriebs. Wird aufgerufen, sobald die Anzahl an Bytes im Sende-FIFO
+///					auf das Interrupt-Niveau gesunken ist. Der Sende-FIFO wird aus dem Sende-Ringpuffer
+///					aufgefllt. Ist der Ringpuffer leer, wird der Sende-FIFO-Interrupt ausgeschaltet
+///					und erst mit dem nchsten Aufruf von "UartWriteA()" wieder eingeschaltet.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxStreamISRA(void)
+{
+		PROFILE_ISR_ENTRY(PROFILE_SLOT_UART_TX);
+
+		uint16_t tail = uartRingTxA.tail;
+
+		while (   (tail != uartRingTxA.head)
+					 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
+		{
+				SciaRegs.SCITXBUF.bit.TXDT = uartRingTxA.data[tail];
+				tail = (tail + 1) & UART_RING_INDEX_MASK;
+		}
+		// Platz erst nach dem Kopieren freigeben
+		uartRingTxA.tail = tail;
+		// Ringpuffer leer -> Sende-FIFO-Interrupt ausschalten
+		if (tail == uartRingTxA.head)
+		{
+				SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+		}
+
+		// Sende-FIFO-Interrupt-Flag lschen
+		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+		PROFILE_ISR_EXIT(PROFILE_SLOT_UART_TX);
 }
@@ -0,0 +1,245 @@
+//=================================================================================================
+/// @file       uart.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstelle (SCI) eines
+///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Zum Senden wird
+////						die Funktion "UartTransmit()" aufgerufen und die zu sendene Anzahl an Bytes als
+///							Parameter bergeben. Die zu sendenen Daten werden zuvor in den Puffer
+///							"uartBufferTx[]" geschrieben. Der Empfangsvorgang wird durch Aufruf der Funktion
+///							"UartReceive()" freigegeben. Da UART asynchron ist, kann der Empfangsvorgang nur
+///							freigegeben, aber nicht aktiv forciert werden. Nach Aufruf der Funktion
+///							"UartReceive()", sollte in regelmigen Abstnden die Funktion "UartGetStatusRx()"
+///							aufgerufen werden um den korekten/vollstndigen Empfang eines Datenpakets zu
+///							prfen. Nheres ist der Beschreibung der Funktion "UartGetStatusRx()" zu entnehmen.
+///							Es wird das SCI-A Modul verwendet. Die Module B, C und D knnen analog zu den hier
+///							gezeigten Funktionen verwendet werden.
+///							Die Datei liegt in "common" und wird von den Projekten F28386D_UART und
+///							F28386D_Tripzone verlinkt.
+///
+///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///
+///							nderung in Version 2.1: Streaming-Betrieb mit Ringpuffern. Nach Aufruf der
+///							Funktion "UartStartStreamA()" ist der Empfang dauerhaft eingeschaltet. Die ISRs
+///							fllen bzw. leeren je einen Ringpuffer fr Rx und Tx (ein Erzeuger, ein
+///							Verbraucher, keine Sperre ntig), sodass zwischen zwei Datenpaketen keine Bytes
+///							verloren gehen. Die Daten werden mit "UartWriteA()" in den Sende-Ringpuffer
+///							geschrieben und mit "UartReadA()" aus dem Empfangs-Ringpuffer gelesen.
+///
+///							nderung in Version 2.2: Die Software-Puffer "uartBufferRxA[]" und "uartBufferTxA[]"
+///							sind gepackt (zwei Bytes pro Wort, myByteBuffer.h) und belegen nur noch die Hlfte
+///							des RAMs. Der Zugriff erfolgt mit BYTE_BUFFER_GET() und BYTE_BUFFER_SET().
+///
+///							nderung in Version 2.3: Beliebige Baudraten (gerundeter Teiler aus dem aktuellen
+///							Low-Speed Peripheral Clock, erreichte Baudrate und Abweichung in "uartBaudActualA"
+///							bzw. "uartBaudErrorPpmA"), Baudraten ber 921600 bis LSPCLK / 16 und automatische
+///							Erkennung der Baudrate ("UartAutoBaudStartA()", "UartAutoBaudPollA()")
+///
+/// @version    V2.3
+///
+/// @date       14.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYUART_H_
+#define MYUART_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myProfile.h"
+#include "myByteBuffer.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Gre der Software-Puffer
+#define UART_SIZE_SOFTWARE_BUFFER_RX		        50
+#define UART_SIZE_SOFTWARE_BUFFER_TX		        50
+// Gre der Hardware-FIFOs
+#define UART_SIZE_HARDWARE_FIFO									16
+// Gre der Ringpuffer fr den Streaming-Betrieb (muss eine Zweierpotenz sein)
+#define UART_SIZE_RING_BUFFER										256
+#define UART_RING_INDEX_MASK										(UART_SIZE_RING_BUFFER - 1)
+// Interrupt-Niveau des Empfangs-FIFOs im Streaming-Betrieb. Die ISR wird erst nach
+// mehreren Bytes aufgerufen, Bytes unterhalb des Niveaus holt "UartPollRxA()" ab
+#define UART_STREAM_RX_FIFO_LEVEL								12
+// Interrupt-Niveau des Sende-FIFOs im Streaming-Betrieb. Der FIFO wird nachgefllt,
+// bevor er leer ist, damit zwischen zwei Bytes keine Pause entsteht
+#define UART_STREAM_TX_FIFO_LEVEL								2
+// Zustnde der UART-Kommunikation (uartRxStatusFlag und uartTxStatusFlag)
+#define UART_STATUS_IDLE												0
+#define UART_STATUS_IN_PROGRESS									1
+#define UART_STATUS_RX_TIMEOUT									2
+#define UART_STATUS_FINISHED										3
+// Werte fr den Timeout-Zhler beim Empfangen von Daten. Wird innerhalb des
+// gewhlten Zeitfensters (bergeben beim Aufruf der Funktion "UartReceive()")
+// kein vollstndiges Datenpaket empfangen, so wird der Empfangsvorgang abgerochen
+#define UART_NO_TIMEOUT													-1
+#define UART_10_MS_TIMEOUT											2
+#define UART_20_MS_TIMEOUT											4
+#define UART_50_MS_TIMEOUT											10
+#define UART_100_MS_TIMEOUT											20
+#define UART_200_MS_TIMEOUT											40
+#define UART_500_MS_TIMEOUT											100
+#define UART_1_S_TIMEOUT												200
+#define UART_2_S_TIMEOUT												400
+#define UART_5_S_TIMEOUT												1000
+#define UART_10_S_TIMEOUT												2000
+#define UART_20_S_TIMEOUT												4000
+#define UART_1_M_TIMEOUT												12000
+#define UART_2_M_TIMEOUT												24000
+#define UART_5_M_TIMEOUT												60000
+// Baud-Raten
+#define UART_BAUD_2400													2400
+#define UART_BAUD_4800													4800
+#define UART_BAUD_9600													9600
+#define UART_BAUD_19200			  									19200
+#define UART_BAUD_38400 												38400
+#define UART_BAUD_115200												115200
+#define UART_BAUD_230400												230400
+#define UART_BAUD_460800												460800
+// Hohe Baudraten. Der Teiler wird gerundet (BRR = LSPCLK / (BAUD * 8) - 1), eine Abweichung bis
+// ca. 2 % ist zulssig. Bei LSPCLK = 50 MHz (200 MHz Systemtakt) erreicht 921600 nur 892857 Baud
+// (-3,1 %), die folgenden Baudraten teilt der LSPCLK exakt. Der FT2232H des XDS100 erzeugt sie mit
+// weniger als 1 % Abweichung. 1562500 ist auch bei 100 MHz Systemtakt (LSPCLK = 25 MHz) exakt
+#define UART_BAUD_921600												921600
+#define UART_BAUD_1250000												1250000
+#define UART_BAUD_1562500												1562500
+#define UART_BAUD_3125000												3125000
+// Hchste Baudrate beim aktuellen Systemtakt (BRR = 1, BRR = 0 ergibt ebenfalls LSPCLK / 16)
+#define UART_BAUD_MAX														(DEVICE_LSPCLK_HZ / 16U)
+// Teiler whrend der automatischen Erkennung der Baudrate (siehe "UartAutoBaudStartA()")
+#define UART_AUTO_BAUD_DIVIDER									1
+// Wortlnge
+#define UART_DATA_1_BIT													0
+#define UART_DATA_2_BIT													1
+#define UART_DATA_3_BIT													2
+#define UART_DATA_4_BIT													3
+#define UART_DATA_5_BIT													4
+#define UART_DATA_6_BIT													5
+#define UART_DATA_7_BIT													6
+#define UART_DATA_8_BIT													7
+// Lnge Stopbit
+#define UART_STOP_1_BIT													0
+#define UART_STOP_2_BIT													1
+// Paritt
+#define UART_PARITY_NONE												0
+#define UART_PARITY_EVEN  											1
+#define UART_PARITY_ODD													2
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Type definitions
+//-------------------------------------------------------------------------------------------------
+// Ringpuffer mit einem Erzeuger und einem Verbraucher. Nur der Erzeuger schreibt
+// "head", nur der Verbraucher schreibt "tail". Da beide Indizes 16 Bit breit sind,
+// werden sie atomar geschrieben und es ist keine Interrupt-Sperre ntig
+typedef struct
+{
+		uint16_t data[UART_SIZE_RING_BUFFER];
+		volatile uint16_t head;
+		volatile uint16_t tail;
+} UartRingBuffer;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Software-Puffer fr die UART-Kommunikation (SCI-A), gepackt: Zugriff mit
+// BYTE_BUFFER_GET(uartBufferRxA, i) bzw. BYTE_BUFFER_SET(uartBufferTxA, i, byte)
+extern uint16_t uartBufferRxA[BYTE_BUFFER_WORDS(UART_SIZE_SOFTWARE_BUFFER_RX)];
+extern uint16_t uartBufferTxA[BYTE_BUFFER_WORDS(UART_SIZE_SOFTWARE_BUFFER_TX)];
+// Flag kann zum Aufruf der Funktion "UartGetStatusRxA()" genutzt werden
+// und sollte dazu regelmig (z.B. alle 5 ms) in einer ISR gesetzt werden.
+// Anschlieend kann z.B. im Hauptprogramm bei gesetztem Flag die Funktion
+// aufgerufen und das Flag gelscht werden
+extern bool uartFlagCheckRxA;
+// Timeout-Zhler fr den Empfang eines Datenpakets
+extern int32_t uartRxTimeoutA;
+// Ringpuffer fr den Streaming-Betrieb (Rx: Erzeuger ISR, Tx: Verbraucher ISR)
+extern UartRingBuffer uartRingRxA;
+extern UartRingBuffer uartRingTxA;
+// Streaming-Betrieb aktiv
+extern bool uartStreamModeA;
+// Anzahl der Bytes, die wegen eines vollen Empfangs-Ringpuffers verworfen wurden
+extern uint32_t uartRingOverflowA;
+// Tatschlich eingestellte Baudrate und Abweichung von der gewnschten Baudrate in ppm
+extern uint32_t uartBaudActualA;
+extern int32_t uartBaudErrorPpmA;
+// Automatische Erkennung der Baudrate aktiv
+extern bool uartAutoBaudActiveA;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert das UART-Modul (SCI-A)
+// und die GPIOs fr die Kommunikation ber UART
+extern void UartInitA(uint32_t baud,
+										  uint32_t numberOfDataBits,
+										  uint32_t numberOfStopBits,
+										  uint32_t parity);
+// Funktion startet die automatische Erkennung der Baudrate (Gegenstelle sendet 'A' oder 'a')
+extern bool UartAutoBaudStartA(void);
+// Funktion prft ohne zu blockieren, ob die Baudrate erkannt wurde
+extern bool UartAutoBaudPollA(void);
+// Funktion initialisiert den UART Empfangs-Softwarepuffer zu 0
+extern void UartInitBufferRxA(void);
+// Funktion initialisiert den UART Sende-Softwarepuffer zu 0
+extern void UartInitBufferTxA(void);
+// Funktion prft den Empfang eines Datenpakets ber UART und
+// gibt den aktuellen Status der Empfangs-Kommuniktaion zurck
+extern uint16_t UartGetStatusRxA(void);
+// Funktion gibt den aktuellen Status der Tx-UART-Kommunikation (senden) zurck
+extern uint16_t UartGetStatusTxA(void);
+// Funktion prft ohne zu blockieren, ob das letzte Byte vollstndig gesendet wurde
+extern bool UartPollTxA(void);
+// Funktion setzt das Status-Flag fr den Empfangsvorgang auf "idle",
+// falls die vorherige Kommunikation abgeschlossen ist
+extern bool UartSetStatusIdleRxA(void);
+// Funktion setzt das Status-Flag fr den Sendevorgang auf "idle",
+// falls die vorherige Kommunikation abgeschlossen ist
+extern bool UartSetStatusIdleTxA(void);
+// Funktion initialisiert Steuervariablen und den Rx-Interrupt, um die mit
+// dem Parameter "numberOfBytesRxA" angegebene Anzahl an Bytes zu empfangen
+extern bool UartReceiveA(uint16_t numberOfBytesRx,
+												 int32_t timeOut);
+// Funktion sendet ber UART die mit dem Parameter "numberOfBytesTxA"
+// angegebene Anzahl an Bytes aus dem Software-Puffer "uartBufferTxA[]"
+extern bool UartTransmitA(uint16_t numberOfBytesTx);
+// Funktion startet den Streaming-Betrieb (Empfang dauerhaft eingeschaltet, Ringpuffer)
+extern bool UartStartStreamA(void);
+// Funktion beendet den Streaming-Betrieb
+extern void UartStopStreamA(void);
+// Funktion schreibt bis zu "numberOfBytes" Bytes in den Sende-Ringpuffer
+extern uint16_t UartWriteA(const uint16_t *data, uint16_t numberOfBytes);
+// Funktion gibt die direkt im Sende-Ringpuffer geschriebenen Bytes fr die ISR frei
+extern void UartTxCommitA(uint16_t head);
+// Funktion liest bis zu "maxNumberOfBytes" Bytes aus dem Empfangs-Ringpuffer
+extern uint16_t UartReadA(uint16_t *data, uint16_t maxNumberOfBytes);
+// Funktion gibt die Anzahl der Bytes im Empfangs-Ringpuffer zurck
+extern uint16_t UartGetRxCountA(void);
+// Funktion kopiert im Streaming-Betrieb die Bytes unterhalb des Interrupt-Niveaus
+// aus dem Empfangs-FIFO in den Ringpuffer (zyklisch aus einer Timer-ISR aufrufen)
+extern void UartPollRxA(void);
+// Funktion gibt die Anzahl freier Pltze im Sende-Ringpuffer zurck
+extern uint16_t UartGetTxFreeA(void);
+// Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, wenn ein Byte empfangen wurde)
+__interrupt void UartRxISRA(void);
+// Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, nachdem ein Byte gesendet wurde)
+__interrupt void UartTxISRA(void);
+// Interrupt-Service-Routinen fr den Streaming-Betrieb (werden von "UartStartStreamA()" eingetragen)
+__interrupt void UartRxStreamISRA(void);
+__interrupt void UartTxStreamISRA(void);
+
+
+#endif
+